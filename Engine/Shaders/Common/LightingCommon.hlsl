@@ -42,25 +42,28 @@ int ConvertSharpenToSampleCount(float SharpenValue)
     return SampleCount;
 }
 
-// 타일 인덱스 계산 (픽셀 위치로부터)
+// 클러스터 인덱스 계산 (픽셀 위치 + 뷰 공간 깊이로부터)
 // SV_POSITION은 픽셀 중심 좌표 (0.5, 0.5 offset)
-uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportStartY)
+// 깊이 슬라이스는 Near~Far 지수 분할 (TileLightCuller.cpp와 같은 식)
+uint CalculateClusterIndex(float4 screenPos, float viewZ, float viewportStartX, float viewportStartY)
 {
     uint localX = uint(screenPos.x) - viewportStartX;
     uint localY = uint(screenPos.y) - viewportStartY;
     
-    uint tileX = localX / TileSize;
-    uint tileY = localY / TileSize;
+    uint tileX = min(localX / TileSize, TileCountX - 1);
+    uint tileY = min(localY / TileSize, TileCountY - 1);
     
-    return tileY * TileCountX + tileX;
+    float sliceF = log2(max(viewZ, 1e-4f)) * ClusterDepthScale + ClusterDepthBias;
+    uint slice = (uint) clamp(sliceF, 0.0f, (float) (ClusterCountZ - 1));
+    
+    return (slice * TileCountY + tileY) * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 클러스터 라이트 인덱스 데이터의 시작 오프셋 (헤더에 기록된 오프셋)
+// 해당 위치에 [LightCount, LightIndices...]가 기존 타일 구조와 같은 형식으로 들어 있음
+uint GetClusterDataOffset(uint clusterIndex)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    return g_TileLightIndices[clusterIndex];
 }
 
 //================================================================================================
@@ -856,8 +859,8 @@ float3 CalculateAllLights(
     // Point + Spot with 타일 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        uint clusterIndex = CalculateClusterIndex(screenPos, viewPos.z, ViewportStartX, ViewportStartY);
+        uint tileDataOffset = GetClusterDataOffset(clusterIndex);
         uint lightCount = g_TileLightIndices[tileDataOffset];
 
         for (uint i = 0; i < lightCount; i++)
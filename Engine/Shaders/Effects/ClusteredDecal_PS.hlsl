@@ -0,0 +1,227 @@
+//================================================================================================
+// Filename:      ClusteredDecal_PS.hlsl
+// Description:   Screen-space clustered decal pass
+//                씬 깊이로 월드 위치를 복원하고, 픽셀이 속한 클러스터의 데칼만 투영해 합성
+//                Supports GOURAUD, LAMBERT, PHONG lighting models (모두 픽셀 단위 조명)
+//================================================================================================
+
+// --- 조명 모델 선택 ---
+// ViewMode에서 동적으로 설정됨 (FDecalRenderResources::GetShaders)
+// 가능한 매크로:
+// - LIGHTING_MODEL_GOURAUD
+// - LIGHTING_MODEL_LAMBERT
+// - LIGHTING_MODEL_PHONG
+// - (매크로 없음 = Unlit)
+
+// --- 공통 조명 시스템 include ---
+#include "../Common/LightStructures.hlsl"
+#include "../Common/LightingBuffers.hlsl"
+#include "../Common/LightingCommon.hlsl"
+
+// C++의 FMeshBatchElement::DecalReceiverIDBit와 일치
+#define DECAL_RECEIVER_ID_BIT 0x80000000u
+
+cbuffer ViewProjBuffer : register(b1)
+{
+    row_major float4x4 ViewMatrix;
+    row_major float4x4 ProjectionMatrix;
+    row_major float4x4 InverseViewMatrix;
+    row_major float4x4 InverseProjectionMatrix;
+}
+
+// D3D11RHI::UpdateUVScrollConstantBuffers가 엔진 틱마다 갱신 (Decal.hlsl과 같은 b5)
+cbuffer PSScrollCB : register(b5)
+{
+    float2 UVScrollSpeed;
+    float UVScrollTime;
+    float _pad_scrollcb;
+}
+
+// C++의 FDecalClusterBufferType과 일치
+cbuffer DecalClusterBuffer : register(b6)
+{
+    uint DecalTileSize;
+    uint DecalTileCountX;
+    uint DecalTileCountY;
+    uint DecalClusterCountZ;
+    uint2 DecalViewportStart;
+    float DecalDepthScale;
+    float DecalDepthBias;
+    float2 DecalViewportSize;
+    uint DecalCount;
+    uint _pad_decalcluster;
+}
+
+// C++의 FDecalRenderResources::FDecalInfo와 일치
+struct FDecalInfo
+{
+    row_major float4x4 DecalMatrix;
+    float Opacity;
+    uint TextureSlice;
+    float2 Padding;
+};
+
+// --- 리소스 ---
+Texture2DArray g_DecalAtlas : register(t0);
+Texture2D<float> g_SceneDepth : register(t1);
+Texture2D<uint> g_SceneObjectId : register(t2);    // 불투명 패스의 ID 버퍼 (최상위 비트 = 데칼 수신 메시)
+StructuredBuffer<uint> g_DecalClusterIndices : register(t6);    // [헤더: 클러스터별 오프셋][개수, 데칼 인덱스...]
+StructuredBuffer<FDecalInfo> g_DecalInfos : register(t7);
+TextureCubeArray g_ShadowAtlasCube : register(t8);
+Texture2D g_ShadowAtlas2D : register(t9);
+Texture2D<float2> g_VSMShadowAtlas : register(t10);
+TextureCubeArray<float2> g_VSMShadowCube : register(t11);
+
+SamplerState g_Sample : register(s0);
+SamplerComparisonState g_ShadowSample : register(s2);
+SamplerState g_VSMSampler : register(s3);
+
+struct PS_INPUT
+{
+    float4 Position : SV_POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+// 렌더 타겟 픽셀 좌표의 깊이로 뷰 공간 위치 복원
+float3 ReconstructViewPosition(int2 pixel)
+{
+    float depth = g_SceneDepth.Load(int3(pixel, 0));
+    float2 localUV = (float2(pixel) + 0.5f - float2(DecalViewportStart)) / DecalViewportSize;
+    float4 clipPos = float4(localUV.x * 2.0f - 1.0f, 1.0f - localUV.y * 2.0f, depth, 1.0f);
+    float4 viewPos = mul(clipPos, InverseProjectionMatrix);
+    return viewPos.xyz / viewPos.w;
+}
+
+float3 ViewToWorld(float3 viewPos)
+{
+    return mul(float4(viewPos, 1.0f), InverseViewMatrix).xyz;
+}
+
+// 데칼 투영 좌표 (x: 투영 방향 0~1, yz: -1~1)
+float3 ProjectToDecal(float3 worldPos, float4x4 decalMatrix)
+{
+    float4 decalPos = mul(float4(worldPos, 1.0f), decalMatrix);
+    return decalPos.xyz / decalPos.w;
+}
+
+float2 DecalUV(float3 ndc)
+{
+    float2 uv = (ndc.yz + 1.0f) / 2.0f;
+    uv.y = 1.0f - uv.y;
+    return uv;
+}
+
+float4 mainPS(PS_INPUT input) : SV_TARGET
+{
+    // 부동 소수점 오차 무시를 위해 Epsilon 사용
+    static const float Epsilon = 1e-6f;
+
+    int2 pixel = int2(input.Position.xy);
+    float depth = g_SceneDepth.Load(int3(pixel, 0));
+    if (depth >= 1.0f)
+    {
+        discard;    // 배경 (지오메트리 없음)
+    }
+
+    // 데칼을 받지 않는 표면 (기즈모, 빌보드, 숨긴 액터 등, FMeshBatchElement::DecalReceiverIDBit)
+    if ((g_SceneObjectId.Load(int3(pixel, 0)) & DECAL_RECEIVER_ID_BIT) == 0)
+    {
+        discard;
+    }
+
+    // 1. 클러스터 조회 (TileLightCuller의 데칼 리스트)
+    float3 viewPos = ReconstructViewPosition(pixel);
+    uint2 tile = min(uint2(pixel - int2(DecalViewportStart)) / DecalTileSize, uint2(DecalTileCountX - 1, DecalTileCountY - 1));
+    float sliceF = log2(max(viewPos.z, 1e-4f)) * DecalDepthScale + DecalDepthBias;
+    uint slice = (uint) clamp(sliceF, 0.0f, (float) (DecalClusterCountZ - 1));
+    uint clusterIndex = (slice * DecalTileCountY + tile.y) * DecalTileCountX + tile.x;
+
+    uint dataOffset = g_DecalClusterIndices[clusterIndex];
+    uint clusterDecalCount = g_DecalClusterIndices[dataOffset];
+    if (clusterDecalCount == 0)
+    {
+        discard;
+    }
+
+    // 2. 이웃 픽셀로 월드 위치 미분 (깊이 차가 작은 쪽을 써서 실루엣 경계의 번짐 방지)
+    float3 worldPos = ViewToWorld(viewPos);
+    float3 viewRight = ReconstructViewPosition(pixel + int2(1, 0));
+    float3 viewLeft = ReconstructViewPosition(pixel - int2(1, 0));
+    float3 viewDown = ReconstructViewPosition(pixel + int2(0, 1));
+    float3 viewUp = ReconstructViewPosition(pixel - int2(0, 1));
+    float3 viewDX = abs(viewRight.z - viewPos.z) < abs(viewPos.z - viewLeft.z) ? viewRight - viewPos : viewPos - viewLeft;
+    float3 viewDY = abs(viewDown.z - viewPos.z) < abs(viewPos.z - viewUp.z) ? viewDown - viewPos : viewPos - viewUp;
+    float3 worldDX = mul(viewDX, (float3x3) InverseViewMatrix);
+    float3 worldDY = mul(viewDY, (float3x3) InverseViewMatrix);
+
+    // 3. 클러스터의 데칼을 배열 순서대로 합성 (뒤에 오는 데칼이 위, 프리멀티플라이드 누적)
+    float4 accum = float4(0.0f, 0.0f, 0.0f, 0.0f);
+    for (uint i = 0; i < clusterDecalCount; ++i)
+    {
+        FDecalInfo decal = g_DecalInfos[g_DecalClusterIndices[dataOffset + 1 + i]];
+
+        // decal의 forward가 +x임 -> x방향 projection
+        float3 ndc = ProjectToDecal(worldPos, decal.DecalMatrix);
+        if (ndc.x < 0.0f - Epsilon || 1.0f + Epsilon < ndc.x ||
+            ndc.y < -1.0f - Epsilon || 1.0f + Epsilon < ndc.y ||
+            ndc.z < -1.0f - Epsilon || 1.0f + Epsilon < ndc.z)
+        {
+            continue;
+        }
+
+        float2 uv = DecalUV(ndc);
+        float2 uvDX = DecalUV(ProjectToDecal(worldPos + worldDX, decal.DecalMatrix)) - uv;
+        float2 uvDY = DecalUV(ProjectToDecal(worldPos + worldDY, decal.DecalMatrix)) - uv;
+        uv += UVScrollSpeed * UVScrollTime;    // 미분은 스크롤과 무관하므로 그 뒤에 적용
+        float4 decalTexture = g_DecalAtlas.SampleGrad(g_Sample, float3(uv, decal.TextureSlice), uvDX, uvDY);
+
+        float alpha = saturate(decalTexture.a * decal.Opacity);
+        accum.rgb = decalTexture.rgb * alpha + accum.rgb * (1.0f - alpha);
+        accum.a = alpha + accum.a * (1.0f - alpha);
+    }
+
+    if (accum.a <= Epsilon)
+    {
+        discard;
+    }
+
+    // 블렌드 스테이트가 SrcAlpha이므로 프리멀티플라이드를 되돌림
+    float4 baseColor = float4(accum.rgb / accum.a, 1.0f);
+
+    // 4. 조명 계산 (매크로에 따라, 합성된 데칼 색으로 한 번)
+#if defined(LIGHTING_MODEL_GOURAUD) || defined(LIGHTING_MODEL_LAMBERT) || defined(LIGHTING_MODEL_PHONG)
+    float3 normal = normalize(cross(worldDY, worldDX));
+    float3 toCamera = CameraPosition - worldPos;
+    if (dot(normal, toCamera) < 0.0f)
+    {
+        normal = -normal;
+    }
+    float specPower = 32.0f;
+
+    #if defined(LIGHTING_MODEL_PHONG) || defined(LIGHTING_MODEL_GOURAUD)
+        float3 viewDir = normalize(toCamera);
+    #else
+        float3 viewDir = float3(0, 0, 0);  // Lambert는 사용 안 함
+    #endif
+
+    float3 litColor = CalculateAllLights(
+        worldPos,
+        viewPos,
+        normal,
+        viewDir,
+        baseColor,
+        specPower,
+        input.Position,
+        g_ShadowSample,
+        g_ShadowAtlas2D,
+        g_ShadowAtlasCube,
+        g_VSMSampler,
+        g_VSMShadowAtlas,
+        g_VSMShadowCube
+    );
+
+    return float4(litColor, accum.a);
+#else
+    return float4(baseColor.rgb, accum.a);
+#endif
+}
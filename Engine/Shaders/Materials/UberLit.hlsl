@@ -17,6 +17,9 @@
 // #define PARTICLE_MESH 1    // 메시 파티클 (3D 메시)
 // #define PARTICLE_BEAM 1    // 빔 파티클 (C++에서 빌보딩 완료)
 
+// --- 자동 인스턴싱 (FMeshDrawInstancer) ---
+// #define MESH_INSTANCING 1  // 월드 행렬/ObjectID를 슬롯 1 인스턴스 버퍼에서 읽음
+
 // --- Material 구조체 (OBJ 머티리얼 정보) ---
 // 주의: SPECULAR_COLOR 매크로에서 사용하므로 include 전에 정의 필요
 struct FMaterial
@@ -180,6 +183,17 @@ struct VS_INPUT
 	uint4 BlendIndices : BLENDINDICES;
 	float4 BlendWeights : BLENDWEIGHTS;
 #endif
+#if MESH_INSTANCING
+	// Per-instance data (slot 1) - FMeshInstanceData 및 C++ Input Layout과 정확히 일치해야 함
+	float4 InstanceWorld0 : INSTANCE_WORLD0;      // offset 0
+	float4 InstanceWorld1 : INSTANCE_WORLD1;      // offset 16
+	float4 InstanceWorld2 : INSTANCE_WORLD2;      // offset 32
+	float4 InstanceWorld3 : INSTANCE_WORLD3;      // offset 48
+	float4 InstanceNormal0 : INSTANCE_NORMAL0;    // offset 64: WorldInverseTranspose 행
+	float4 InstanceNormal1 : INSTANCE_NORMAL1;    // offset 80
+	float4 InstanceNormal2 : INSTANCE_NORMAL2;    // offset 96
+	uint InstanceObjectID : INSTANCE_ID;          // offset 112: 피킹용 UUID
+#endif
 	
 #endif
 
@@ -196,6 +210,9 @@ struct PS_INPUT
 #if PARTICLE
     float SubImageIndex : TEXCOORD1;  // SubUV 프레임 인덱스 (정수부 + 보간용 소수부)
 #endif
+#if MESH_INSTANCING
+    nointerpolation uint InstanceObjectID : INSTANCE_ID;  // 인스턴스별 피킹 UUID
+#endif
 };
 
 struct PS_OUTPUT
@@ -351,7 +368,17 @@ PS_INPUT mainVS(VS_INPUT Input, uint VertexId : SV_VertexID)
         Input.Position = posComp;
     }
 
-    float4 worldPos = mul(float4(Input.Position, 1.0f), WorldMatrix);
+#if MESH_INSTANCING
+    // 자동 인스턴싱: 오브젝트 상수 버퍼 대신 인스턴스 버퍼의 월드 행렬 사용
+    row_major float4x4 ObjectWorldMatrix = float4x4(Input.InstanceWorld0, Input.InstanceWorld1, Input.InstanceWorld2, Input.InstanceWorld3);
+    row_major float4x4 ObjectWorldInverseTranspose = float4x4(Input.InstanceNormal0, Input.InstanceNormal1, Input.InstanceNormal2, float4(0, 0, 0, 1));
+    Out.InstanceObjectID = Input.InstanceObjectID;
+#else
+    row_major float4x4 ObjectWorldMatrix = WorldMatrix;
+    row_major float4x4 ObjectWorldInverseTranspose = WorldInverseTranspose;
+#endif
+
+    float4 worldPos = mul(float4(Input.Position, 1.0f), ObjectWorldMatrix);
     Out.WorldPos = worldPos.xyz;
 
     // 뷰 공간으로 변환
@@ -363,9 +390,9 @@ PS_INPUT mainVS(VS_INPUT Input, uint VertexId : SV_VertexID)
     // 노멀을 월드 공간으로 변환
     // 비균등 스케일에서 올바른 노멀 변환을 위해 WorldInverseTranspose 사용
     // 노멀 벡터는 transpose(inverse(WorldMatrix))로 변환됨
-    worldNormal = normalize(mul(Input.Normal, (float3x3) WorldInverseTranspose));
+    worldNormal = normalize(mul(Input.Normal, (float3x3) ObjectWorldInverseTranspose));
     Out.Normal = worldNormal;
-    float3 Tangent = normalize(mul(Input.Tangent.xyz, (float3x3) WorldMatrix));
+    float3 Tangent = normalize(mul(Input.Tangent.xyz, (float3x3) ObjectWorldMatrix));
     float3 BiTangent = normalize(cross(Tangent, worldNormal) * Input.Tangent.w);
     row_major float3x3 TBN;
     TBN._m00_m01_m02 = Tangent;
@@ -453,7 +480,11 @@ PS_INPUT mainVS(VS_INPUT Input, uint VertexId : SV_VertexID)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#if MESH_INSTANCING
+    Output.UUID = Input.InstanceObjectID;
+#else
     Output.UUID = UUID;
+#endif
 
     //CSM 구간 시각화
     float3 Color[2] =
@@ -688,9 +719,9 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 계산 (타일 + 깊이 슬라이스)
+        uint clusterIndex = CalculateClusterIndex(Input.Position, ViewPos.z, ViewportStartX, ViewportStartY);
+        uint tileDataOffset = GetClusterDataOffset(clusterIndex);
 
         // 타일에 영향을 주는 라이트 개수
         uint lightCount = g_TileLightIndices[tileDataOffset];
@@ -800,9 +831,9 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 계산 (타일 + 깊이 슬라이스)
+        uint clusterIndex = CalculateClusterIndex(Input.Position, ViewPos.z, ViewportStartX, ViewportStartY);
+        uint tileDataOffset = GetClusterDataOffset(clusterIndex);
 
         // 타일에 영향을 주는 라이트 개수
         uint lightCount = g_TileLightIndices[tileDataOffset];
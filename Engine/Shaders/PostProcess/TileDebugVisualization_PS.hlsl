@@ -13,16 +13,19 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint2 Padding;          // 16바이트 정렬을 위한 패딩
+    uint ClusterCountZ;     // 깊이 슬라이스 개수
+    float ClusterDepthScale; // Slice = log2(ViewZ) * Scale + Bias
+    float ClusterDepthBias;
+    uint3 Padding;          // 16바이트 정렬을 위한 패딩
 };
 
 // t0: 원본 씬 텍스처
 Texture2D g_SceneTexture : register(t0);
 SamplerState g_SamplerLinear : register(s0);
 
-// t2: 타일별 라이트 인덱스 Structured Buffer
-// 구조: [TileIndex * MaxLightsPerTile] = LightCount
-//       [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices
+// t2: 클러스터별 라이트 인덱스 Structured Buffer
+// 구조: [ClusterIndex] = 클러스터 데이터 오프셋
+//       [Offset] = LightCount, [Offset + 1 ~ ...] = LightIndices
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // 타일 인덱스 계산
@@ -38,11 +41,23 @@ uint CalculateTileIndex(float2 screenPos)
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 클러스터 라이트 인덱스 데이터의 시작 오프셋 (헤더에 기록된 오프셋)
+uint GetClusterDataOffset(uint clusterIndex)
 {
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    return g_TileLightIndices[clusterIndex];
+}
+
+// 타일의 깊이 슬라이스 중 가장 많은 라이트 개수 (디버그 패스는 깊이를 모르므로 타일 열 전체를 봄)
+uint GetTileMaxLightCount(uint tileIndex)
+{
+    uint maxCount = 0;
+    uint tileCount = TileCountX * TileCountY;
+    for (uint slice = 0; slice < ClusterCountZ; slice++)
+    {
+        uint dataOffset = GetClusterDataOffset(slice * tileCount + tileIndex);
+        maxCount = max(maxCount, g_TileLightIndices[dataOffset]);
+    }
+    return maxCount;
 }
 
 // 라이트 개수를 색상으로 변환 (히트맵)
@@ -98,10 +113,9 @@ float4 mainPS(float4 Pos : SV_Position, float2 TexCoord : TEXCOORD0) : SV_Target
 
     // 현재 픽셀이 속한 타일 계산
     uint tileIndex = CalculateTileIndex(Pos.xy);
-    uint tileDataOffset = GetTileDataOffset(tileIndex);
 
-    // 타일의 라이트 개수
-    uint lightCount = g_TileLightIndices[tileDataOffset];
+    // 타일의 라이트 개수 (깊이 슬라이스 중 최대)
+    uint lightCount = GetTileMaxLightCount(tileIndex);
 
     // 히트맵 색상 계산
     float3 heatmapColor = LightCountToHeatmap(lightCount);
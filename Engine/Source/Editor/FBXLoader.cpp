@@ -12,6 +12,7 @@
 #include "Source/Runtime/Engine/Animation/AnimationTypes.h"
 #include "Source/Runtime/Engine/Animation/MixamoChainMapper.h"
 #include "Source/Runtime/AssetManagement/ResourceManager.h"
+#include "Source/Runtime/AssetManagement/MeshSimplifier.h"
 #include <filesystem>
 #include <cmath>
 #include <cfloat>
@@ -266,6 +267,17 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
                 UE_LOG("FBXLoader: Successfully loaded and registered material '%s'", MaterialInfo.MaterialName.c_str());
             }
 
+            // LOD가 없던 구버전 캐시이거나 LOD 생성기 버전이 바뀐 경우 LOD 체인을 다시 만들어 캐시 갱신
+            if (MeshData->LODBuildVersion != FMeshSimplifier::BuildVersion)
+            {
+                FMeshSimplifier::BuildSkeletalMeshLODs(*MeshData);
+
+                UE_LOG("Updating outdated FBX cache for '%s'.", NormalizedPath.c_str());
+                FWindowsBinWriter Writer(BinPathFileName);
+                Writer << *MeshData;
+                Writer.Close();
+            }
+
             MeshData->CacheFilePath = BinPathFileName;
             bLoadedFromCache = true;
 
@@ -400,6 +412,9 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
         Count += IndexList.Num();
     }
 
+    // LOD 체인 생성 (캐시에 함께 저장)
+    FMeshSimplifier::BuildSkeletalMeshLODs(*MeshData);
+
 #ifdef USE_OBJ_CACHE
     // 13. 캐시 저장
     try
@@ -7,6 +7,7 @@
 #include "Enums.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "MeshSimplifier.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -420,6 +421,9 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		// 캐시 저장 *직전에* 기본 머티리얼 로직을 호출합니다.
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
+		// LOD 체인도 캐시에 함께 저장
+		FMeshSimplifier::BuildStaticMeshLODs(*NewFStaticMesh);
+
 #ifdef USE_OBJ_CACHE
 		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
 		FWindowsBinWriter Writer(BinPathFileName);
@@ -437,11 +441,20 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	{
 		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
 		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
+		bool bCacheOutdated = EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
+
+		// LOD가 없던 구버전 캐시이거나 LOD 생성기 버전이 바뀐 경우 LOD 체인을 다시 만듭니다.
+		if (NewFStaticMesh->LODBuildVersion != FMeshSimplifier::BuildVersion)
+		{
+			FMeshSimplifier::BuildStaticMeshLODs(*NewFStaticMesh);
+			bCacheOutdated = true;
+		}
+
+		if (bCacheOutdated)
 		{
 #ifdef USE_OBJ_CACHE
 			// 변경된 경우, 캐시를 갱신합니다.
-			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
+			UE_LOG("Updating outdated cache for '%s'.", NormalizedPathStr.c_str());
 			try
 			{
 				FWindowsBinWriter Writer(BinPathFileName);
@@ -453,7 +466,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			}
 			catch (const std::exception& e)
 			{
-				UE_LOG("Failed to update cache for default material: %s", e.what());
+				UE_LOG("Failed to update outdated cache: %s", e.what());
 			}
 #endif // USE_OBJ_CACHE
 		}
@@ -0,0 +1,885 @@
+#include "pch.h"
+#include "MeshSimplifier.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 웨지 판정과 비용 계산에 쓰는 정점 속성 (패딩 없이 4바이트 단위, 바이트 비교로 정렬/동일성 판정)
+	struct FSimplifyVertex
+	{
+		FVector Position;
+		float Attributes[9];		// Normal(3), UV(2), Color(4)
+		uint32 BoneIndices[4];
+		float BoneWeights[4];
+	};
+
+	// -0.0과 0.0이 다른 위치로 분류되지 않게 함
+	inline float CanonicalFloat(float Value)
+	{
+		return Value == 0.0f ? 0.0f : Value;
+	}
+
+	FSimplifyVertex MakeSimplifyVertex(const FVector& Position, const FVector& Normal, const FVector2D& UV, const FVector4& Color)
+	{
+		FSimplifyVertex Vertex;
+		std::memset(&Vertex, 0, sizeof(Vertex));
+		Vertex.Position = FVector(CanonicalFloat(Position.X), CanonicalFloat(Position.Y), CanonicalFloat(Position.Z));
+		Vertex.Attributes[0] = Normal.X;
+		Vertex.Attributes[1] = Normal.Y;
+		Vertex.Attributes[2] = Normal.Z;
+		Vertex.Attributes[3] = UV.X;
+		Vertex.Attributes[4] = UV.Y;
+		Vertex.Attributes[5] = Color.X;
+		Vertex.Attributes[6] = Color.Y;
+		Vertex.Attributes[7] = Color.Z;
+		Vertex.Attributes[8] = Color.W;
+		return Vertex;
+	}
+
+	// 두 정점의 본 가중치 차이 (0: 같음, 1: 겹치는 본 없음)
+	float SkinWeightDistance(const FSimplifyVertex& A, const FSimplifyVertex& B)
+	{
+		float Diff = 0.0f;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (A.BoneWeights[i] <= 0.0f)
+			{
+				continue;
+			}
+			float WeightB = 0.0f;
+			for (int32 j = 0; j < 4; ++j)
+			{
+				if (B.BoneWeights[j] > 0.0f && B.BoneIndices[j] == A.BoneIndices[i])
+				{
+					WeightB = B.BoneWeights[j];
+					break;
+				}
+			}
+			Diff += std::fabs(A.BoneWeights[i] - WeightB);
+		}
+		for (int32 j = 0; j < 4; ++j)
+		{
+			if (B.BoneWeights[j] <= 0.0f)
+			{
+				continue;
+			}
+			bool bShared = false;
+			for (int32 i = 0; i < 4; ++i)
+			{
+				if (A.BoneWeights[i] > 0.0f && A.BoneIndices[i] == B.BoneIndices[j])
+				{
+					bShared = true;
+					break;
+				}
+			}
+			if (!bShared)
+			{
+				Diff += B.BoneWeights[j];
+			}
+		}
+		return Diff * 0.5f;
+	}
+
+	// 평면까지 거리 제곱 합을 나타내는 대칭 4x4 행렬 (상삼각 10개 성분) + 가중치 합
+	struct FQuadric
+	{
+		double A00 = 0.0, A01 = 0.0, A02 = 0.0, A03 = 0.0;
+		double A11 = 0.0, A12 = 0.0, A13 = 0.0;
+		double A22 = 0.0, A23 = 0.0;
+		double A33 = 0.0;
+		double Weight = 0.0;
+
+		void AddPlane(const FVector& N, float D, double W)
+		{
+			A00 += W * N.X * N.X; A01 += W * N.X * N.Y; A02 += W * N.X * N.Z; A03 += W * N.X * D;
+			A11 += W * N.Y * N.Y; A12 += W * N.Y * N.Z; A13 += W * N.Y * D;
+			A22 += W * N.Z * N.Z; A23 += W * N.Z * D;
+			A33 += W * D * D;
+			Weight += W;
+		}
+
+		void Add(const FQuadric& Other)
+		{
+			A00 += Other.A00; A01 += Other.A01; A02 += Other.A02; A03 += Other.A03;
+			A11 += Other.A11; A12 += Other.A12; A13 += Other.A13;
+			A22 += Other.A22; A23 += Other.A23;
+			A33 += Other.A33;
+			Weight += Other.Weight;
+		}
+
+		// 가중 거리 제곱 합
+		double Evaluate(const FVector& P) const
+		{
+			const double X = P.X, Y = P.Y, Z = P.Z;
+			return A00 * X * X + 2.0 * A01 * X * Y + 2.0 * A02 * X * Z + 2.0 * A03 * X
+				+ A11 * Y * Y + 2.0 * A12 * Y * Z + 2.0 * A13 * Y
+				+ A22 * Z * Z + 2.0 * A23 * Z
+				+ A33;
+		}
+	};
+
+	enum class EVertexKind : uint8
+	{
+		Manifold,	// 내부 정점, 어느 이웃으로든 붕괴 가능
+		Border,		// 경계 간선 2개를 가진 열린 경계 정점, 경계를 따라서만 붕괴
+		Locked,		// 이음새/섹션 경계/비다양체, 움직이지 않음 (다른 정점이 이쪽으로 붕괴하는 것은 허용)
+	};
+
+	// 단순화 결과 하나 (인덱스는 원본 정점 번호)
+	struct FSimplifiedLOD
+	{
+		TArray<uint32> Indices;
+		TArray<uint32> GroupIndexCounts;	// 섹션별 인덱스 수 (섹션 순서대로 Indices에 이어짐)
+	};
+
+	class FSimplifyContext
+	{
+	public:
+		FSimplifyContext(const TArray<FSimplifyVertex>& InVertices, bool bInSkinned)
+			: Vertices(InVertices), bSkinned(bInSkinned)
+		{
+		}
+
+		// 위치/웨지 분류, 삼각형/인접 정보, 쿼드릭, 초기 붕괴 후보 구성
+		void Initialize(const TArray<uint32>& Indices, const TArray<FGroupInfo>& Groups);
+
+		/**
+		 * @brief 목표 삼각형 수 또는 허용 오차(거리 제곱)에 도달할 때까지 붕괴
+		 * @details 이전 호출에서 이어서 진행하므로 LOD 순서대로 호출한다.
+		 */
+		void SimplifyTo(uint32 TargetTriangles, double MaxError);
+
+		void Snapshot(FSimplifiedLOD& OutLOD) const;
+
+		uint32 GetNumTriangles() const { return AliveTriangles; }
+		uint32 GetNumGroups() const { return NumGroups; }
+		float GetBoundsRadius() const { return BoundsRadius; }
+
+	private:
+		struct FCollapse
+		{
+			double Cost;
+			uint32 From;
+			uint32 To;
+			uint32 FromVersion;
+			uint32 ToVersion;
+		};
+
+		struct FCollapseGreater
+		{
+			bool operator()(const FCollapse& A, const FCollapse& B) const { return A.Cost > B.Cost; }
+		};
+
+		double CollapseCost(uint32 From, uint32 To) const;
+		void PushEdge(uint32 A, uint32 B);
+		bool TryCollapse(uint32 From, uint32 To);
+		bool TriangleHasPosition(uint32 Triangle, uint32 Position) const;
+		void GatherNeighbors(uint32 Position, TArray<uint32>& OutNeighbors) const;
+
+		const TArray<FSimplifyVertex>& Vertices;
+		bool bSkinned;
+
+		// 정점 -> 대표 웨지 정점 (속성까지 같은 중복 정점 병합), 정점 -> 위치 번호
+		TArray<uint32> WedgeRemap;
+		TArray<uint32> PositionOf;
+
+		// 위치별 정보
+		TArray<FVector> Positions;
+		TArray<uint32> PositionWedge;		// 첫 번째 웨지 (Locked가 아니면 유일한 웨지)
+		TArray<EVertexKind> Kinds;
+		TArray<uint32> BorderLinks;			// Border 정점의 경계 이웃 2개 (위치 * 2)
+		TArray<FQuadric> Quadrics;
+		TArray<uint32> Versions;
+		TArray<uint8> Removed;
+		TArray<TArray<uint32>> PositionTriangles;
+
+		// 삼각형 (웨지 정점 번호 3개), 섹션, 생존 여부
+		TArray<uint32> Triangles;
+		TArray<uint32> TriangleGroups;
+		TArray<uint8> TriangleAlive;
+		uint32 AliveTriangles = 0;
+		uint32 NumGroups = 0;
+
+		float BoundsRadius = 0.0f;
+
+		TArray<FCollapse> Heap;
+		TArray<uint32> NeighborScratchA;
+		TArray<uint32> NeighborScratchB;
+	};
+
+	void FSimplifyContext::Initialize(const TArray<uint32>& Indices, const TArray<FGroupInfo>& Groups)
+	{
+		const uint32 NumVertices = static_cast<uint32>(Vertices.Num());
+
+		// 1. 바이트 순 정렬로 같은 위치 / 같은 웨지를 인접하게 모음 (Position이 구조체 앞쪽이므로 위치가 먼저 묶임)
+		TArray<uint32> Order;
+		Order.SetNum(NumVertices);
+		for (uint32 Index = 0; Index < NumVertices; ++Index)
+		{
+			Order[Index] = Index;
+		}
+		std::sort(Order.begin(), Order.end(), [this](uint32 A, uint32 B)
+		{
+			const int32 Result = std::memcmp(&Vertices[A], &Vertices[B], sizeof(FSimplifyVertex));
+			return Result < 0 || (Result == 0 && A < B);
+		});
+
+		WedgeRemap.SetNum(NumVertices);
+		PositionOf.SetNum(NumVertices);
+		TArray<uint32> WedgeCounts;
+		for (uint32 SortedIndex = 0; SortedIndex < NumVertices; ++SortedIndex)
+		{
+			const uint32 Vertex = Order[SortedIndex];
+			const uint32 Previous = SortedIndex > 0 ? Order[SortedIndex - 1] : Vertex;
+			const bool bNewPosition = SortedIndex == 0 || std::memcmp(&Vertices[Vertex].Position, &Vertices[Previous].Position, sizeof(FVector)) != 0;
+			const bool bNewWedge = bNewPosition || std::memcmp(&Vertices[Vertex], &Vertices[Previous], sizeof(FSimplifyVertex)) != 0;
+
+			if (bNewPosition)
+			{
+				Positions.Add(Vertices[Vertex].Position);
+				PositionWedge.Add(Vertex);
+				WedgeCounts.Add(0);
+			}
+			if (bNewWedge)
+			{
+				++WedgeCounts[Positions.Num() - 1];
+				WedgeRemap[Vertex] = Vertex;
+			}
+			else
+			{
+				WedgeRemap[Vertex] = WedgeRemap[Previous];
+			}
+			PositionOf[Vertex] = static_cast<uint32>(Positions.Num() - 1);
+		}
+
+		const uint32 NumPositions = static_cast<uint32>(Positions.Num());
+
+		FVector BoundsMin = NumPositions > 0 ? Positions[0] : FVector(0.0f, 0.0f, 0.0f);
+		FVector BoundsMax = BoundsMin;
+		for (const FVector& Position : Positions)
+		{
+			BoundsMin = BoundsMin.ComponentMin(Position);
+			BoundsMax = BoundsMax.ComponentMax(Position);
+		}
+		BoundsRadius = (BoundsMax - BoundsMin).Size() * 0.5f;
+
+		// 2. 섹션 순서대로 삼각형 수집 (섹션 범위 밖 인덱스는 그려지지 않으므로 제외, 퇴화 삼각형 제외)
+		NumGroups = Groups.IsEmpty() ? 1 : static_cast<uint32>(Groups.Num());
+		for (uint32 Group = 0; Group < NumGroups; ++Group)
+		{
+			const uint32 Start = Groups.IsEmpty() ? 0 : Groups[Group].StartIndex;
+			const uint32 Count = Groups.IsEmpty() ? static_cast<uint32>(Indices.Num()) : Groups[Group].IndexCount;
+			const uint32 End = std::min<uint32>(Start + Count, static_cast<uint32>(Indices.Num()));
+
+			for (uint32 Index = Start; Index + 3 <= End; Index += 3)
+			{
+				const uint32 I0 = Indices[Index];
+				const uint32 I1 = Indices[Index + 1];
+				const uint32 I2 = Indices[Index + 2];
+				if (I0 >= NumVertices || I1 >= NumVertices || I2 >= NumVertices)
+				{
+					continue;
+				}
+				const uint32 P0 = PositionOf[I0];
+				const uint32 P1 = PositionOf[I1];
+				const uint32 P2 = PositionOf[I2];
+				if (P0 == P1 || P1 == P2 || P0 == P2)
+				{
+					continue;
+				}
+				Triangles.Add(WedgeRemap[I0]);
+				Triangles.Add(WedgeRemap[I1]);
+				Triangles.Add(WedgeRemap[I2]);
+				TriangleGroups.Add(Group);
+			}
+		}
+
+		const uint32 NumTriangles = static_cast<uint32>(TriangleGroups.Num());
+		TriangleAlive.SetNum(NumTriangles);
+		std::fill(TriangleAlive.begin(), TriangleAlive.end(), static_cast<uint8>(1));
+		AliveTriangles = NumTriangles;
+
+		// 3. 위치별 인접 삼각형, 섹션 경계 판정
+		PositionTriangles.SetNum(NumPositions);
+		Kinds.SetNum(NumPositions);
+		TArray<int32> FirstGroup;
+		FirstGroup.SetNum(NumPositions);
+		std::fill(FirstGroup.begin(), FirstGroup.end(), -1);
+		for (uint32 Position = 0; Position < NumPositions; ++Position)
+		{
+			Kinds[Position] = WedgeCounts[Position] > 1 ? EVertexKind::Locked : EVertexKind::Manifold;
+		}
+		for (uint32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Position = PositionOf[Triangles[Triangle * 3 + Corner]];
+				PositionTriangles[Position].Add(Triangle);
+
+				const int32 Group = static_cast<int32>(TriangleGroups[Triangle]);
+				if (FirstGroup[Position] < 0)
+				{
+					FirstGroup[Position] = Group;
+				}
+				else if (FirstGroup[Position] != Group)
+				{
+					Kinds[Position] = EVertexKind::Locked;
+				}
+			}
+		}
+
+		// 4. 간선 분류 (위치 기준 무방향 간선의 삼각형 수: 1 = 열린 경계, 3 이상 = 비다양체)
+		TArray<uint64> EdgeKeys;
+		EdgeKeys.Reserve(NumTriangles * 3);
+		auto MakeEdgeKey = [](uint32 A, uint32 B)
+		{
+			return A < B ? (static_cast<uint64>(A) << 32) | B : (static_cast<uint64>(B) << 32) | A;
+		};
+		for (uint32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 A = PositionOf[Triangles[Triangle * 3 + Corner]];
+				const uint32 B = PositionOf[Triangles[Triangle * 3 + (Corner + 1) % 3]];
+				EdgeKeys.Add(MakeEdgeKey(A, B));
+			}
+		}
+		std::sort(EdgeKeys.begin(), EdgeKeys.end());
+
+		TArray<uint64> UniqueEdges;
+		TArray<uint32> EdgeCounts;
+		for (int32 Index = 0; Index < EdgeKeys.Num(); ++Index)
+		{
+			if (Index == 0 || EdgeKeys[Index] != EdgeKeys[Index - 1])
+			{
+				UniqueEdges.Add(EdgeKeys[Index]);
+				EdgeCounts.Add(0);
+			}
+			++EdgeCounts[EdgeCounts.Num() - 1];
+		}
+
+		TArray<uint32> BorderDegrees;
+		BorderDegrees.SetNum(NumPositions);
+		std::fill(BorderDegrees.begin(), BorderDegrees.end(), 0u);
+		BorderLinks.SetNum(NumPositions * 2);
+		std::fill(BorderLinks.begin(), BorderLinks.end(), UINT32_MAX);
+		for (int32 Edge = 0; Edge < UniqueEdges.Num(); ++Edge)
+		{
+			const uint32 A = static_cast<uint32>(UniqueEdges[Edge] >> 32);
+			const uint32 B = static_cast<uint32>(UniqueEdges[Edge] & 0xFFFFFFFFu);
+			if (EdgeCounts[Edge] > 2)
+			{
+				Kinds[A] = EVertexKind::Locked;
+				Kinds[B] = EVertexKind::Locked;
+			}
+			else if (EdgeCounts[Edge] == 1)
+			{
+				if (BorderDegrees[A] < 2) { BorderLinks[A * 2 + BorderDegrees[A]] = B; }
+				if (BorderDegrees[B] < 2) { BorderLinks[B * 2 + BorderDegrees[B]] = A; }
+				++BorderDegrees[A];
+				++BorderDegrees[B];
+			}
+		}
+		for (uint32 Position = 0; Position < NumPositions; ++Position)
+		{
+			if (Kinds[Position] == EVertexKind::Locked || BorderDegrees[Position] == 0)
+			{
+				continue;
+			}
+			// 경계 간선이 2개가 아니면 (경계가 한 점에서 만나는 등) 고정
+			Kinds[Position] = BorderDegrees[Position] == 2 ? EVertexKind::Border : EVertexKind::Locked;
+		}
+
+		// 5. 쿼드릭: 삼각형 평면 (면적 가중) + 열린 경계 간선의 수직 평면 (길이^2 가중)
+		constexpr double BorderPlaneWeight = 10.0;
+		Quadrics.SetNum(NumPositions);
+		for (uint32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const uint32 P[3] = {
+				PositionOf[Triangles[Triangle * 3 + 0]],
+				PositionOf[Triangles[Triangle * 3 + 1]],
+				PositionOf[Triangles[Triangle * 3 + 2]] };
+			const FVector& V0 = Positions[P[0]];
+			FVector Normal = FVector::Cross(Positions[P[1]] - V0, Positions[P[2]] - V0);
+			const float DoubleArea = Normal.Size();
+			if (DoubleArea <= 0.0f)
+			{
+				continue;
+			}
+			Normal = Normal * (1.0f / DoubleArea);
+
+			const float D = -FVector::Dot(Normal, V0);
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				Quadrics[P[Corner]].AddPlane(Normal, D, DoubleArea * 0.5);
+			}
+
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 A = P[Corner];
+				const uint32 B = P[(Corner + 1) % 3];
+				const uint64 Key = MakeEdgeKey(A, B);
+				const auto It = std::lower_bound(UniqueEdges.begin(), UniqueEdges.end(), Key);
+				if (EdgeCounts[static_cast<int32>(It - UniqueEdges.begin())] != 1)
+				{
+					continue;
+				}
+
+				const FVector Edge = Positions[B] - Positions[A];
+				FVector BorderNormal = FVector::Cross(Edge, Normal);
+				const float BorderNormalSize = BorderNormal.Size();
+				if (BorderNormalSize <= 0.0f)
+				{
+					continue;
+				}
+				BorderNormal = BorderNormal * (1.0f / BorderNormalSize);
+				const float BorderD = -FVector::Dot(BorderNormal, Positions[A]);
+				const double Weight = Edge.SizeSquared() * BorderPlaneWeight;
+				Quadrics[A].AddPlane(BorderNormal, BorderD, Weight);
+				Quadrics[B].AddPlane(BorderNormal, BorderD, Weight);
+			}
+		}
+
+		// 6. 초기 붕괴 후보
+		Versions.SetNum(NumPositions);
+		std::fill(Versions.begin(), Versions.end(), 0u);
+		Removed.SetNum(NumPositions);
+		std::fill(Removed.begin(), Removed.end(), static_cast<uint8>(0));
+
+		Heap.Reserve(UniqueEdges.Num());
+		for (uint64 Key : UniqueEdges)
+		{
+			PushEdge(static_cast<uint32>(Key >> 32), static_cast<uint32>(Key & 0xFFFFFFFFu));
+		}
+	}
+
+	double FSimplifyContext::CollapseCost(uint32 From, uint32 To) const
+	{
+		if (Kinds[From] == EVertexKind::Locked)
+		{
+			return DBL_MAX;
+		}
+		if (Kinds[From] == EVertexKind::Border && BorderLinks[From * 2] != To && BorderLinks[From * 2 + 1] != To)
+		{
+			return DBL_MAX;
+		}
+
+		FQuadric Quadric = Quadrics[From];
+		Quadric.Add(Quadrics[To]);
+		double Cost = Quadric.Weight > 0.0 ? Quadric.Evaluate(Positions[To]) / Quadric.Weight : 0.0;
+		Cost = std::max(Cost, 0.0);
+
+		if (bSkinned)
+		{
+			const float WeightDistance = SkinWeightDistance(Vertices[PositionWedge[From]], Vertices[PositionWedge[To]]);
+			Cost += static_cast<double>(WeightDistance) * FMeshSimplifier::SkinWeightPenalty * (Positions[From] - Positions[To]).SizeSquared();
+		}
+		return Cost;
+	}
+
+	void FSimplifyContext::PushEdge(uint32 A, uint32 B)
+	{
+		const double CostAB = CollapseCost(A, B);
+		const double CostBA = CollapseCost(B, A);
+		if (CostAB == DBL_MAX && CostBA == DBL_MAX)
+		{
+			return;
+		}
+
+		FCollapse Collapse;
+		if (CostAB <= CostBA)
+		{
+			Collapse = { CostAB, A, B, Versions[A], Versions[B] };
+		}
+		else
+		{
+			Collapse = { CostBA, B, A, Versions[B], Versions[A] };
+		}
+		Heap.Add(Collapse);
+		std::push_heap(Heap.begin(), Heap.end(), FCollapseGreater());
+	}
+
+	bool FSimplifyContext::TriangleHasPosition(uint32 Triangle, uint32 Position) const
+	{
+		return PositionOf[Triangles[Triangle * 3 + 0]] == Position
+			|| PositionOf[Triangles[Triangle * 3 + 1]] == Position
+			|| PositionOf[Triangles[Triangle * 3 + 2]] == Position;
+	}
+
+	void FSimplifyContext::GatherNeighbors(uint32 Position, TArray<uint32>& OutNeighbors) const
+	{
+		OutNeighbors.Empty();
+		for (uint32 Triangle : PositionTriangles[Position])
+		{
+			if (!TriangleAlive[Triangle])
+			{
+				continue;
+			}
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Neighbor = PositionOf[Triangles[Triangle * 3 + Corner]];
+				if (Neighbor != Position && std::find(OutNeighbors.begin(), OutNeighbors.end(), Neighbor) == OutNeighbors.end())
+				{
+					OutNeighbors.Add(Neighbor);
+				}
+			}
+		}
+	}
+
+	bool FSimplifyContext::TryCollapse(uint32 From, uint32 To)
+	{
+		// 1. 간선을 공유하는 삼각형과 그 삼각형들이 쓰는 To의 웨지 (From은 웨지가 하나뿐이므로 To 웨지도 하나여야 함)
+		uint32 ToWedge = UINT32_MAX;
+		uint32 NumShared = 0;
+		for (uint32 Triangle : PositionTriangles[From])
+		{
+			if (!TriangleAlive[Triangle])
+			{
+				continue;
+			}
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Wedge = Triangles[Triangle * 3 + Corner];
+				if (PositionOf[Wedge] != To)
+				{
+					continue;
+				}
+				if (ToWedge != UINT32_MAX && ToWedge != Wedge)
+				{
+					return false;
+				}
+				ToWedge = Wedge;
+				++NumShared;
+			}
+		}
+		if (NumShared == 0)
+		{
+			return false;
+		}
+
+		// 2. 링크 조건: 공통 이웃은 공유 삼각형의 세 번째 정점뿐이어야 함 (아니면 비다양체가 생김)
+		GatherNeighbors(From, NeighborScratchA);
+		GatherNeighbors(To, NeighborScratchB);
+		uint32 NumCommon = 0;
+		for (uint32 Neighbor : NeighborScratchA)
+		{
+			if (std::find(NeighborScratchB.begin(), NeighborScratchB.end(), Neighbor) != NeighborScratchB.end())
+			{
+				++NumCommon;
+			}
+		}
+		if (NumCommon != NumShared)
+		{
+			return false;
+		}
+
+		// 3. 경계를 따라 붕괴하면 From의 다른 경계 이웃이 To와 이어짐 (To의 다른 경계 이웃과 같으면 구멍이 닫힘)
+		uint32 FromOtherLink = UINT32_MAX;
+		if (Kinds[From] == EVertexKind::Border)
+		{
+			FromOtherLink = BorderLinks[From * 2] == To ? BorderLinks[From * 2 + 1] : BorderLinks[From * 2];
+			if (Kinds[To] == EVertexKind::Border)
+			{
+				const uint32 ToOtherLink = BorderLinks[To * 2] == From ? BorderLinks[To * 2 + 1] : BorderLinks[To * 2];
+				if (ToOtherLink == FromOtherLink)
+				{
+					return false;
+				}
+			}
+		}
+
+		// 4. 남는 삼각형이 뒤집히거나 퇴화하지 않아야 함
+		const FVector& Target = Positions[To];
+		for (uint32 Triangle : PositionTriangles[From])
+		{
+			if (!TriangleAlive[Triangle] || TriangleHasPosition(Triangle, To))
+			{
+				continue;
+			}
+			FVector Old[3];
+			FVector New[3];
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 Position = PositionOf[Triangles[Triangle * 3 + Corner]];
+				Old[Corner] = Positions[Position];
+				New[Corner] = Position == From ? Target : Old[Corner];
+			}
+			const FVector OldNormal = FVector::Cross(Old[1] - Old[0], Old[2] - Old[0]);
+			const FVector NewNormal = FVector::Cross(New[1] - New[0], New[2] - New[0]);
+			const float OldSize = OldNormal.Size();
+			const float NewSize = NewNormal.Size();
+			if (OldSize <= 0.0f)
+			{
+				continue;
+			}
+			if (NewSize <= OldSize * 1e-4f || FVector::Dot(OldNormal, NewNormal) < 0.25f * OldSize * NewSize)
+			{
+				return false;
+			}
+		}
+
+		// 5. 붕괴: 공유 삼각형 제거, 나머지는 From 코너를 To 웨지로 교체
+		TArray<uint32>& ToTriangles = PositionTriangles[To];
+		for (uint32 Triangle : PositionTriangles[From])
+		{
+			if (!TriangleAlive[Triangle])
+			{
+				continue;
+			}
+			if (TriangleHasPosition(Triangle, To))
+			{
+				TriangleAlive[Triangle] = 0;
+				--AliveTriangles;
+				continue;
+			}
+			for (uint32 Corner = 0; Corner < 3; ++Corner)
+			{
+				if (PositionOf[Triangles[Triangle * 3 + Corner]] == From)
+				{
+					Triangles[Triangle * 3 + Corner] = ToWedge;
+				}
+			}
+			ToTriangles.Add(Triangle);
+		}
+		ToTriangles.erase(std::remove_if(ToTriangles.begin(), ToTriangles.end(),
+			[this](uint32 Triangle) { return !TriangleAlive[Triangle]; }), ToTriangles.end());
+		PositionTriangles[From].Empty();
+
+		if (Kinds[From] == EVertexKind::Border)
+		{
+			if (FromOtherLink != UINT32_MAX && Kinds[FromOtherLink] == EVertexKind::Border)
+			{
+				uint32* Links = &BorderLinks[FromOtherLink * 2];
+				(Links[0] == From ? Links[0] : Links[1]) = To;
+			}
+			if (Kinds[To] == EVertexKind::Border)
+			{
+				uint32* Links = &BorderLinks[To * 2];
+				(Links[0] == From ? Links[0] : Links[1]) = FromOtherLink;
+			}
+		}
+
+		Quadrics[To].Add(Quadrics[From]);
+		Removed[From] = 1;
+		++Versions[To];
+
+		// 6. To 주변 간선 비용 갱신 (이전 항목은 버전 불일치로 버려짐)
+		GatherNeighbors(To, NeighborScratchA);
+		for (uint32 Neighbor : NeighborScratchA)
+		{
+			PushEdge(To, Neighbor);
+		}
+		return true;
+	}
+
+	void FSimplifyContext::SimplifyTo(uint32 TargetTriangles, double MaxError)
+	{
+		while (AliveTriangles > TargetTriangles && !Heap.IsEmpty())
+		{
+			const FCollapse Top = Heap[0];
+			if (Removed[Top.From] || Removed[Top.To] || Versions[Top.From] != Top.FromVersion || Versions[Top.To] != Top.ToVersion)
+			{
+				std::pop_heap(Heap.begin(), Heap.end(), FCollapseGreater());
+				Heap.pop_back();
+				continue;
+			}
+			// 다음 LOD에서 더 큰 오차로 이어서 진행할 수 있도록 힙에 남겨 둠
+			if (Top.Cost > MaxError)
+			{
+				break;
+			}
+			std::pop_heap(Heap.begin(), Heap.end(), FCollapseGreater());
+			Heap.pop_back();
+
+			// 실패한 후보는 버림 (주변이 바뀌면 PushEdge로 다시 들어옴)
+			TryCollapse(Top.From, Top.To);
+		}
+	}
+
+	void FSimplifyContext::Snapshot(FSimplifiedLOD& OutLOD) const
+	{
+		OutLOD.Indices.Empty();
+		OutLOD.Indices.Reserve(AliveTriangles * 3);
+		OutLOD.GroupIndexCounts.SetNum(NumGroups);
+		std::fill(OutLOD.GroupIndexCounts.begin(), OutLOD.GroupIndexCounts.end(), 0u);
+
+		// 삼각형은 섹션 순서대로 수집했으므로 순서대로 쓰면 섹션별로 연속
+		for (int32 Triangle = 0; Triangle < TriangleGroups.Num(); ++Triangle)
+		{
+			if (!TriangleAlive[Triangle])
+			{
+				continue;
+			}
+			OutLOD.Indices.Add(Triangles[Triangle * 3 + 0]);
+			OutLOD.Indices.Add(Triangles[Triangle * 3 + 1]);
+			OutLOD.Indices.Add(Triangles[Triangle * 3 + 2]);
+			OutLOD.GroupIndexCounts[TriangleGroups[Triangle]] += 3;
+		}
+	}
+
+	/**
+	 * @brief LOD1~ 단순화 결과 생성
+	 * @return 만든 LOD 수 (LOD0 제외)
+	 */
+	int32 SimplifyMesh(const TArray<FSimplifyVertex>& Vertices, const TArray<uint32>& Indices, const TArray<FGroupInfo>& Groups,
+		bool bSkinned, TArray<FSimplifiedLOD>& OutLODs)
+	{
+		OutLODs.Empty();
+
+		FSimplifyContext Context(Vertices, bSkinned);
+		Context.Initialize(Indices, Groups);
+
+		const uint32 BaseTriangles = Context.GetNumTriangles();
+		if (BaseTriangles < FMeshSimplifier::MinTrianglesForLOD)
+		{
+			return 0;
+		}
+
+		uint32 PreviousTriangles = BaseTriangles;
+		for (int32 LODIndex = 1; LODIndex < MaxMeshLODCount; ++LODIndex)
+		{
+			const uint32 Target = static_cast<uint32>(BaseTriangles * FMeshSimplifier::LODTriangleRatios[LODIndex]);
+			const double MaxDistance = static_cast<double>(FMeshSimplifier::LODMaxErrors[LODIndex]) * Context.GetBoundsRadius();
+			Context.SimplifyTo(Target, MaxDistance * MaxDistance);
+
+			const uint32 NumTriangles = Context.GetNumTriangles();
+			if (NumTriangles == 0 || NumTriangles > PreviousTriangles * FMeshSimplifier::MinReductionPerLOD)
+			{
+				break;
+			}
+			Context.Snapshot(OutLODs.emplace_back());
+			PreviousTriangles = NumTriangles;
+		}
+		return OutLODs.Num();
+	}
+
+	/**
+	 * @brief 단순화 결과를 LOD가 실제로 쓰는 정점만 남긴 정점/인덱스/섹션으로 변환
+	 * @details 정점은 처음 쓰이는 순서로 배치 (정점 캐시 지역성). 섹션 수/순서는 원본과 같다.
+	 */
+	template<typename TVertex>
+	void CompactLOD(const TArray<TVertex>& SourceVertices, const TArray<FGroupInfo>& SourceGroups, const FSimplifiedLOD& Simplified,
+		TArray<TVertex>& OutVertices, TArray<uint32>& OutIndices, TArray<FGroupInfo>& OutGroups)
+	{
+		TArray<uint32> Remap;
+		Remap.SetNum(SourceVertices.Num());
+		std::fill(Remap.begin(), Remap.end(), UINT32_MAX);
+
+		OutVertices.Empty();
+		OutIndices.Empty();
+		OutIndices.Reserve(Simplified.Indices.Num());
+		for (uint32 Index : Simplified.Indices)
+		{
+			if (Remap[Index] == UINT32_MAX)
+			{
+				Remap[Index] = static_cast<uint32>(OutVertices.Num());
+				OutVertices.Add(SourceVertices[Index]);
+			}
+			OutIndices.Add(Remap[Index]);
+		}
+
+		OutGroups.Empty();
+		if (SourceGroups.IsEmpty())
+		{
+			return;
+		}
+		uint32 StartIndex = 0;
+		for (int32 Group = 0; Group < SourceGroups.Num(); ++Group)
+		{
+			FGroupInfo GroupInfo = SourceGroups[Group];
+			GroupInfo.StartIndex = StartIndex;
+			GroupInfo.IndexCount = Simplified.GroupIndexCounts[Group];
+			StartIndex += GroupInfo.IndexCount;
+			OutGroups.Add(GroupInfo);
+		}
+	}
+
+	void LogLODChain(const FString& PathFileName, uint32 BaseTriangles, const TArray<uint32>& LODTriangles, double ElapsedMs)
+	{
+		char Buffer[160] = {};
+		int32 Length = 0;
+		for (int32 LODIndex = 0; LODIndex < LODTriangles.Num(); ++LODIndex)
+		{
+			Length += snprintf(Buffer + Length, sizeof(Buffer) - Length, " / LOD%d %u", LODIndex + 1, LODTriangles[LODIndex]);
+		}
+		UE_LOG("MeshSimplifier: '%s' LOD0 %u tris%s (%.2f ms)", PathFileName.c_str(), BaseTriangles, Buffer, ElapsedMs);
+	}
+}
+
+void FMeshSimplifier::BuildStaticMeshLODs(FStaticMesh& Mesh)
+{
+	Mesh.LODs.Empty();
+	Mesh.LODBuildVersion = BuildVersion;
+
+	FScopeCycleCounter BuildCounter;
+
+	TArray<FSimplifyVertex> SimplifyVertices;
+	SimplifyVertices.Reserve(Mesh.Vertices.Num());
+	for (const FNormalVertex& Vertex : Mesh.Vertices)
+	{
+		SimplifyVertices.Add(MakeSimplifyVertex(Vertex.pos, Vertex.normal, Vertex.tex, Vertex.color));
+	}
+
+	TArray<FSimplifiedLOD> Simplified;
+	if (SimplifyMesh(SimplifyVertices, Mesh.Indices, Mesh.GroupInfos, false, Simplified) == 0)
+	{
+		return;
+	}
+
+	TArray<uint32> LODTriangles;
+	for (int32 Index = 0; Index < Simplified.Num(); ++Index)
+	{
+		FStaticMeshLOD& LOD = Mesh.LODs.emplace_back();
+		LOD.ScreenSize = LODScreenSizes[Index + 1];
+		CompactLOD(Mesh.Vertices, Mesh.GroupInfos, Simplified[Index], LOD.Vertices, LOD.Indices, LOD.GroupInfos);
+		LODTriangles.Add(static_cast<uint32>(LOD.Indices.Num() / 3));
+	}
+
+	LogLODChain(Mesh.PathFileName, static_cast<uint32>(Mesh.Indices.Num() / 3), LODTriangles, BuildCounter.Finish());
+}
+
+void FMeshSimplifier::BuildSkeletalMeshLODs(FSkeletalMeshData& Data)
+{
+	Data.LODs.Empty();
+	Data.LODBuildVersion = BuildVersion;
+
+	for (const FGroupInfo& Group : Data.GroupInfos)
+	{
+		if (Group.bEnableCloth)
+		{
+			return;
+		}
+	}
+
+	FScopeCycleCounter BuildCounter;
+
+	TArray<FSimplifyVertex> SimplifyVertices;
+	SimplifyVertices.Reserve(Data.Vertices.Num());
+	for (const FSkinnedVertex& Vertex : Data.Vertices)
+	{
+		FSimplifyVertex& SimplifyVertex = SimplifyVertices.emplace_back(MakeSimplifyVertex(Vertex.Position, Vertex.Normal, Vertex.UV, Vertex.Color));
+		for (int32 Influence = 0; Influence < 4; ++Influence)
+		{
+			// 가중치 0인 슬롯의 본 번호는 의미가 없으므로 웨지 판정에서 제외
+			SimplifyVertex.BoneIndices[Influence] = Vertex.BoneWeights[Influence] > 0.0f ? Vertex.BoneIndices[Influence] : 0;
+			SimplifyVertex.BoneWeights[Influence] = Vertex.BoneWeights[Influence] > 0.0f ? Vertex.BoneWeights[Influence] : 0.0f;
+		}
+	}
+
+	TArray<FSimplifiedLOD> Simplified;
+	if (SimplifyMesh(SimplifyVertices, Data.Indices, Data.GroupInfos, true, Simplified) == 0)
+	{
+		return;
+	}
+
+	TArray<uint32> LODTriangles;
+	for (int32 Index = 0; Index < Simplified.Num(); ++Index)
+	{
+		FSkeletalMeshLOD& LOD = Data.LODs.emplace_back();
+		LOD.ScreenSize = LODScreenSizes[Index + 1];
+		CompactLOD(Data.Vertices, Data.GroupInfos, Simplified[Index], LOD.Vertices, LOD.Indices, LOD.GroupInfos);
+		LODTriangles.Add(static_cast<uint32>(LOD.Indices.Num() / 3));
+	}
+
+	LogLODChain(Data.PathFileName, static_cast<uint32>(Data.Indices.Num() / 3), LODTriangles, BuildCounter.Finish());
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @brief 캐시 생성 시점의 자동 LOD 체인 생성기 (Quadric Error Metric 기반 half-edge collapse)
+ * @details 간선 (u, v)를 붕괴할 때 u를 기존 정점 v로 합치기만 하고 새 정점을 만들지 않는다.
+ * 따라서 LOD 정점은 항상 원본 정점의 부분 집합이고, UV/노멀/본 가중치를 보간 없이 그대로 쓴다.
+ *
+ * - UV 이음새: 위치는 같고 속성이 다른 정점(웨지)이 둘 이상인 위치는 움직이지 않는다 (이음새가 벌어지지 않음)
+ * - 머티리얼 경계: 여러 섹션이 공유하는 위치도 움직이지 않는다 (섹션 사이에 틈이 생기지 않음)
+ * - 열린 경계: 경계 간선을 따라서만 붕괴하고, 경계에 수직인 평면 쿼드릭으로 외곽선을 유지한다
+ * - 스킨 가중치: 가중치가 다른 정점끼리의 붕괴에 비용을 더해 관절 부근 변형을 보존한다
+ *
+ * 단순화를 한 번 진행하면서 LOD마다 목표 삼각형 수(또는 허용 오차)에 도달할 때의 결과를 잘라 저장한다.
+ */
+class FMeshSimplifier
+{
+public:
+	// 알고리즘/설정이 바뀌면 올려서 캐시에 저장된 LOD를 다시 만들게 함
+	static constexpr uint32 BuildVersion = 1;
+
+	// 이보다 삼각형이 적은 메시는 LOD를 만들지 않음
+	static constexpr uint32 MinTrianglesForLOD = 128;
+
+	// LOD별 원본 대비 목표 삼각형 비율
+	static constexpr float LODTriangleRatios[MaxMeshLODCount] = { 1.0f, 0.5f, 0.25f, 0.125f };
+
+	// LOD별 허용 오차 (메시 경계 구 반지름 대비 거리)
+	static constexpr float LODMaxErrors[MaxMeshLODCount] = { 0.0f, 0.01f, 0.025f, 0.05f };
+
+	// LOD별 전환 화면 크기 (경계 구 반지름 * max(P00, P11) / 거리, 화면 높이를 채우면 약 1)
+	static constexpr float LODScreenSizes[MaxMeshLODCount] = { 1.0f, 0.5f, 0.25f, 0.125f };
+
+	// 이전 LOD 대비 삼각형이 이 비율 이하로 줄지 않으면 더 만들지 않음 (거의 같은 LOD를 저장하지 않음)
+	static constexpr float MinReductionPerLOD = 0.8f;
+
+	// 가중치 차이(0~1) * 간선 길이^2에 곱해 붕괴 비용에 더하는 계수
+	static constexpr float SkinWeightPenalty = 0.25f;
+
+	/**
+	 * @brief Mesh.LODs를 다시 만들고 LODBuildVersion을 갱신
+	 * @details 삼각형이 적거나 더 줄일 수 없으면 LODs는 비어 있다.
+	 */
+	static void BuildStaticMeshLODs(FStaticMesh& Mesh);
+
+	/**
+	 * @brief Data.LODs를 다시 만들고 LODBuildVersion을 갱신
+	 * @details 클로스 섹션이 있는 메시는 클로스가 LOD0 정점/섹션 범위를 직접 참조하므로 LOD를 만들지 않는다.
+	 */
+	static void BuildSkeletalMeshLODs(FSkeletalMeshData& Data);
+};
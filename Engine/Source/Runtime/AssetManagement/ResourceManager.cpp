@@ -635,6 +635,29 @@ void UResourceManager::InitShaderILMap()
 	ShaderToInputLayoutMap["Shaders/Materials/UberLit.hlsl#PARTICLE_MESH"] = layout;
 	layout.clear();
 
+	// ────────────────────────────────
+	// Mesh Instancing (정점: 일반 메시, 인스턴스: FMeshInstanceData)
+	// ────────────────────────────────
+	// Slot 0: 메시 정점 (FVertexDynamic)
+	layout.Add({ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+	layout.Add({ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+	layout.Add({ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+	layout.Add({ "TANGENT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+	layout.Add({ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 48, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+
+	// Slot 1: 인스턴스 데이터 (FMeshInstanceData)
+	layout.Add({ "INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 });     // WorldMatrix[0]
+	layout.Add({ "INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });    // WorldMatrix[1]
+	layout.Add({ "INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 });    // WorldMatrix[2]
+	layout.Add({ "INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 });    // WorldMatrix[3]
+	layout.Add({ "INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64, D3D11_INPUT_PER_INSTANCE_DATA, 1 });   // WorldInverseTranspose[0]
+	layout.Add({ "INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 80, D3D11_INPUT_PER_INSTANCE_DATA, 1 });   // WorldInverseTranspose[1]
+	layout.Add({ "INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 96, D3D11_INPUT_PER_INSTANCE_DATA, 1 });   // WorldInverseTranspose[2]
+	layout.Add({ "INSTANCE_ID", 0, DXGI_FORMAT_R32_UINT, 1, 112, D3D11_INPUT_PER_INSTANCE_DATA, 1 });                // ObjectID
+
+	ShaderToInputLayoutMap["Shaders/Materials/UberLit.hlsl#MESH_INSTANCING"] = layout;
+	layout.clear();
+
 	// ────────────────────────────────
 	// Beam Particle 렌더링 (FParticleBeamVertex)
 	// C++에서 빌보딩 완료된 월드 좌표를 직접 전달
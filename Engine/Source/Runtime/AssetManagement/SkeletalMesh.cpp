@@ -43,6 +43,7 @@ void USkeletalMesh::Load(const FString& InFilePath, ID3D11Device* InDevice)
         // GPU 버퍼 생성
         CreateVertexBuffer(Data, InDevice);
         CreateIndexBuffer(Data, InDevice);
+        CreateLODResources(Data, InDevice);
         CreateLocalBound(Data);
         VertexCount = static_cast<uint32>(Data->Vertices.size());
         IndexCount = static_cast<uint32>(Data->Indices.size());
@@ -72,6 +73,14 @@ void USkeletalMesh::ReleaseResources()
         IndexBuffer = nullptr;
     }
 
+    for (FLODResource& Resource : LODResources)
+    {
+        if (Resource.VertexBuffer) { Resource.VertexBuffer->Release(); }
+        if (Resource.IndexBuffer) { Resource.IndexBuffer->Release(); }
+    }
+    LODResources.Empty();
+    LODScreenSizes.Empty();
+
     if (Data)
     {
         delete Data;
@@ -79,14 +88,14 @@ void USkeletalMesh::ReleaseResources()
     }
 }
 
-void USkeletalMesh::CreateVertexBufferForComp(ID3D11Buffer** InVertexBuffer)
+void USkeletalMesh::CreateVertexBufferForComp(ID3D11Buffer** InVertexBuffer, int32 LODIndex)
 {
-    if (!Data || Data->Vertices.empty())
+    if (!Data || Data->Vertices.empty() || LODIndex >= GetNumLODs())
     {
         return;
     }
     ID3D11Device* Device = GEngine.GetRHIDevice()->GetDevice();
-    HRESULT hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(Device, Data->Vertices, InVertexBuffer, false);
+    HRESULT hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(Device, GetLODVertices(LODIndex), InVertexBuffer, false);
     if (FAILED(hr))
     {
         UE_LOG("SkeletalMesh: CreateVertexBufferForComp failed, hr=0x%08X", hr);
@@ -112,6 +121,25 @@ void USkeletalMesh::CreateIndexBuffer(FSkeletalMeshData* InSkeletalMesh, ID3D11D
     assert(SUCCEEDED(hr));
 }
 
+void USkeletalMesh::CreateLODResources(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice)
+{
+    LODScreenSizes.Add(1.0f);
+    for (const FSkeletalMeshLOD& LOD : InSkeletalMesh->LODs)
+    {
+        FLODResource Resource;
+        if (FAILED(D3D11RHI::CreateVertexBuffer<FSkinnedVertexDynamic>(InDevice, LOD.Vertices, &Resource.VertexBuffer, true)) ||
+            FAILED(D3D11RHI::CreateIndexBuffer(InDevice, LOD.Indices, &Resource.IndexBuffer)))
+        {
+            // 중간 LOD가 빠지면 인덱스가 어긋나므로 이후 LOD는 사용하지 않음
+            if (Resource.VertexBuffer) { Resource.VertexBuffer->Release(); }
+            break;
+        }
+        Resource.IndexCount = static_cast<uint32>(LOD.Indices.size());
+        LODResources.Add(Resource);
+        LODScreenSizes.Add(LOD.ScreenSize);
+    }
+}
+
 void USkeletalMesh::CreateLocalBound(const FSkeletalMeshData* InSkeletalMesh)
 {
     if (!InSkeletalMesh || InSkeletalMesh->Vertices.empty())
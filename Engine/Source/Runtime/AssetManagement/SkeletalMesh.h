@@ -56,7 +56,19 @@ public:
 
     uint64 GetMeshGroupCount() const { return Data ? Data->GroupInfos.size() : 0; }
 
-    void CreateVertexBufferForComp(ID3D11Buffer** InVertexBuffer);
+    // LOD (0은 원본: GetVertexBuffer/GetIndexBuffer/GetMeshGroupInfo와 같음)
+    int32 GetNumLODs() const { return 1 + static_cast<int32>(LODResources.size()); }
+    ID3D11Buffer* GetLODVertexBuffer(int32 LODIndex) const { return LODIndex > 0 ? LODResources[LODIndex - 1].VertexBuffer : VertexBuffer; } // GPU Skinning용
+    ID3D11Buffer* GetLODIndexBuffer(int32 LODIndex) const { return LODIndex > 0 ? LODResources[LODIndex - 1].IndexBuffer : IndexBuffer; }
+    uint32 GetLODIndexCount(int32 LODIndex) const { return LODIndex > 0 ? LODResources[LODIndex - 1].IndexCount : IndexCount; }
+    const TArray<FGroupInfo>& GetLODGroupInfos(int32 LODIndex) const { return LODIndex > 0 ? Data->LODs[LODIndex - 1].GroupInfos : GetMeshGroupInfo(); }
+    // CPU Skinning 원본 정점
+    const TArray<FSkinnedVertex>& GetLODVertices(int32 LODIndex) const { return LODIndex > 0 ? Data->LODs[LODIndex - 1].Vertices : Data->Vertices; }
+    // LOD별 전환 화면 크기 (GetNumLODs()개, [0] = 1)
+    const TArray<float>& GetLODScreenSizes() const { return LODScreenSizes; }
+
+    // CPU Skinning 결과를 담을 컴포넌트별 VB 생성 (LODIndex의 정점 수만큼)
+    void CreateVertexBufferForComp(ID3D11Buffer** InVertexBuffer, int32 LODIndex = 0);
     void UpdateVertexBuffer(const TArray<FNormalVertex>& SkinnedVertices, ID3D11Buffer* InVertexBuffer);
 
     // Local space bounding box
@@ -66,6 +78,7 @@ private:
     void CreateVertexBuffer(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice);
     void CreateIndexBuffer(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice);
     void CreateLocalBound(const FSkeletalMeshData* InSkeletalMesh);
+    void CreateLODResources(FSkeletalMeshData* InSkeletalMesh, ID3D11Device* InDevice);
     void ReleaseResources();
 
 private:
@@ -76,6 +89,16 @@ private:
     uint32 IndexCount = 0;     // 버텍스 점의 개수
     uint32 VertexStride = 0;
 
+    // LOD1~ GPU 리소스 (CPU 데이터는 Data->LODs)
+    struct FLODResource
+    {
+        ID3D11Buffer* VertexBuffer = nullptr;
+        ID3D11Buffer* IndexBuffer = nullptr;
+        uint32 IndexCount = 0;
+    };
+    TArray<FLODResource> LODResources;
+    TArray<float> LODScreenSizes;
+
     // CPU 리소스
     FSkeletalMeshData* Data = nullptr;
     FAABB LocalBound;
@@ -13,6 +13,17 @@ IMPLEMENT_CLASS(UStaticMesh)
 namespace
 {
     // FSkeletalMeshData를 FStaticMesh로 변환 (본 정보 제거)
+    FNormalVertex ToNormalVertex(const FSkinnedVertex& SkinnedVtx)
+    {
+        FNormalVertex NormalVtx;
+        NormalVtx.pos = SkinnedVtx.Position;
+        NormalVtx.normal = SkinnedVtx.Normal;
+        NormalVtx.tex = SkinnedVtx.UV;
+        NormalVtx.Tangent = SkinnedVtx.Tangent;
+        NormalVtx.color = SkinnedVtx.Color;
+        return NormalVtx;
+    }
+
     FStaticMesh* ConvertSkeletalToStaticMesh(const FSkeletalMeshData& SkeletalData)
     {
         FStaticMesh* StaticMesh = new FStaticMesh();
@@ -21,13 +32,7 @@ namespace
         StaticMesh->Vertices.reserve(SkeletalData.Vertices.size());
         for (const auto& SkinnedVtx : SkeletalData.Vertices)
         {
-            FNormalVertex NormalVtx;
-            NormalVtx.pos = SkinnedVtx.Position;
-            NormalVtx.normal = SkinnedVtx.Normal;
-            NormalVtx.tex = SkinnedVtx.UV;
-            NormalVtx.Tangent = SkinnedVtx.Tangent;
-            NormalVtx.color = SkinnedVtx.Color;
-            StaticMesh->Vertices.push_back(NormalVtx);
+            StaticMesh->Vertices.push_back(ToNormalVertex(SkinnedVtx));
         }
 
         // 인덱스 복사
@@ -37,6 +42,21 @@ namespace
         StaticMesh->GroupInfos = SkeletalData.GroupInfos;
         StaticMesh->bHasMaterial = SkeletalData.bHasMaterial;
 
+        // LOD 체인 복사 (정점만 변환)
+        StaticMesh->LODBuildVersion = SkeletalData.LODBuildVersion;
+        for (const FSkeletalMeshLOD& SkeletalLOD : SkeletalData.LODs)
+        {
+            FStaticMeshLOD& LOD = StaticMesh->LODs.emplace_back();
+            LOD.ScreenSize = SkeletalLOD.ScreenSize;
+            LOD.Indices = SkeletalLOD.Indices;
+            LOD.GroupInfos = SkeletalLOD.GroupInfos;
+            LOD.Vertices.reserve(SkeletalLOD.Vertices.size());
+            for (const FSkinnedVertex& SkinnedVtx : SkeletalLOD.Vertices)
+            {
+                LOD.Vertices.push_back(ToNormalVertex(SkinnedVtx));
+            }
+        }
+
         // 캐시 경로 복사
         StaticMesh->CacheFilePath = SkeletalData.CacheFilePath;
 
@@ -159,6 +179,7 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
         CacheFilePath = StaticMeshAsset->CacheFilePath;
         CreateVertexBuffer(StaticMeshAsset, InDevice, InVertexType);
         CreateIndexBuffer(StaticMeshAsset, InDevice);
+        CreateLODResources(StaticMeshAsset, InDevice);
         CreateLocalBound(StaticMeshAsset);
         VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
         IndexCount = static_cast<uint32>(StaticMeshAsset->Indices.size());
@@ -182,6 +203,7 @@ void UStaticMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutT
         IndexBuffer->Release();
         IndexBuffer = nullptr;
     }
+    ReleaseLODResources();
 
     CreateVertexBuffer(InData, InDevice, InVertexType);
     CreateIndexBuffer(InData, InDevice);
@@ -270,8 +292,42 @@ void UStaticMesh::CreateLocalBound(const FStaticMesh* InStaticMesh)
     LocalBound = FAABB(Min, Max);
 }
 
+void UStaticMesh::CreateLODResources(FStaticMesh* InStaticMesh, ID3D11Device* InDevice)
+{
+    ReleaseLODResources();
+
+    LODScreenSizes.Add(1.0f);
+    for (const FStaticMeshLOD& LOD : InStaticMesh->LODs)
+    {
+        FLODResource Resource;
+        if (FAILED(D3D11RHI::CreateVertexBuffer<FVertexDynamic>(InDevice, LOD.Vertices, &Resource.VertexBuffer)) ||
+            FAILED(D3D11RHI::CreateIndexBuffer(InDevice, LOD.Indices, &Resource.IndexBuffer)))
+        {
+            // 중간 LOD가 빠지면 인덱스가 어긋나므로 이후 LOD는 사용하지 않음
+            if (Resource.VertexBuffer) { Resource.VertexBuffer->Release(); }
+            break;
+        }
+        Resource.IndexCount = static_cast<uint32>(LOD.Indices.size());
+        LODResources.Add(Resource);
+        LODScreenSizes.Add(LOD.ScreenSize);
+    }
+}
+
+void UStaticMesh::ReleaseLODResources()
+{
+    for (FLODResource& Resource : LODResources)
+    {
+        if (Resource.VertexBuffer) { Resource.VertexBuffer->Release(); }
+        if (Resource.IndexBuffer) { Resource.IndexBuffer->Release(); }
+    }
+    LODResources.Empty();
+    LODScreenSizes.Empty();
+}
+
 void UStaticMesh::ReleaseResources()
 {
+    ReleaseLODResources();
+
     if (VertexBuffer)
     {
         VertexBuffer->Release();
@@ -40,6 +40,18 @@ public:
     uint64 GetMeshGroupCount() const { return StaticMeshAsset ? StaticMeshAsset->GroupInfos.size() : 0; }
     
     FAABB GetLocalBound() const {return LocalBound; }
+
+    // LOD (0은 원본: GetVertexBuffer/GetIndexBuffer/GetMeshGroupInfo와 같음)
+    int32 GetNumLODs() const { return 1 + static_cast<int32>(LODResources.size()); }
+    ID3D11Buffer* GetLODVertexBuffer(int32 LODIndex) const { return LODIndex > 0 ? LODResources[LODIndex - 1].VertexBuffer : VertexBuffer; }
+    ID3D11Buffer* GetLODIndexBuffer(int32 LODIndex) const { return LODIndex > 0 ? LODResources[LODIndex - 1].IndexBuffer : IndexBuffer; }
+    uint32 GetLODIndexCount(int32 LODIndex) const { return LODIndex > 0 ? LODResources[LODIndex - 1].IndexCount : IndexCount; }
+    const TArray<FGroupInfo>& GetLODGroupInfos(int32 LODIndex) const
+    {
+        return LODIndex > 0 ? StaticMeshAsset->LODs[LODIndex - 1].GroupInfos : GetMeshGroupInfo();
+    }
+    // LOD별 전환 화면 크기 (GetNumLODs()개, [0] = 1)
+    const TArray<float>& GetLODScreenSizes() const { return LODScreenSizes; }
     
     const FString& GetCacheFilePath() const { return CacheFilePath; }
 
@@ -54,6 +66,8 @@ private:
 	void CreateIndexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
     void CreateLocalBound(const FMeshData* InMeshData);
     void CreateLocalBound(const FStaticMesh* InStaticMesh);
+    void CreateLODResources(FStaticMesh* InStaticMesh, ID3D11Device* InDevice);
+    void ReleaseLODResources();
     void ReleaseResources();
 
     FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube.obj.bin)
@@ -66,6 +80,16 @@ private:
     uint32 VertexStride = 0;
     EVertexLayoutType VertexType = EVertexLayoutType::PositionColorTexturNormal;  // Stride를 계산하기 위한 버텍스 타입
 
+    // LOD1~ GPU 리소스 (CPU 데이터는 StaticMeshAsset->LODs)
+    struct FLODResource
+    {
+        ID3D11Buffer* VertexBuffer = nullptr;
+        ID3D11Buffer* IndexBuffer = nullptr;
+        uint32 IndexCount = 0;
+    };
+    TArray<FLODResource> LODResources;
+    TArray<float> LODScreenSizes;
+
 	// CPU 리소스
     FStaticMesh* StaticMeshAsset = nullptr;
     UBodySetup* BodySetup = nullptr; // simple collision setup (AggGeom)
@@ -0,0 +1,192 @@
+#include "pch.h"
+#include "TaskScheduler.h"
+
+namespace
+{
+	thread_local int32 GCurrentThreadIndex = 0;
+}
+
+FTaskScheduler& FTaskScheduler::Get()
+{
+	static FTaskScheduler Instance;
+	return Instance;
+}
+
+FTaskScheduler::~FTaskScheduler()
+{
+	Shutdown();
+}
+
+int32 FTaskScheduler::GetCurrentThreadIndex()
+{
+	return GCurrentThreadIndex;
+}
+
+void FTaskScheduler::Initialize(int32 NumWorkers)
+{
+	if (IsInitialized())
+	{
+		return;
+	}
+
+	// 워커 수 결정: 0이면 (CPU 코어 수 - 1), 최소 1개
+	if (NumWorkers <= 0)
+	{
+		NumWorkers = static_cast<int32>(std::thread::hardware_concurrency());
+		if (NumWorkers > 1)
+		{
+			--NumWorkers; // 메인 스레드를 위해 1개 예약
+		}
+	}
+	NumWorkers = std::max(1, NumWorkers);
+
+	bShutdownRequested = false;
+
+	// 작업 등록이 재할당되지 않도록 미리 용량 확보
+	JobQueue.reserve((NumWorkers + 1) * ReservedJobsPerThread);
+
+	WorkerThreads.reserve(NumWorkers);
+	for (int32 i = 0; i < NumWorkers; ++i)
+	{
+		WorkerThreads.emplace_back(&FTaskScheduler::WorkerThreadFunc, this, i + 1);
+	}
+
+	UE_LOG("TaskScheduler: Initialized with %d worker threads", NumWorkers);
+}
+
+void FTaskScheduler::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		bShutdownRequested = true;
+	}
+	JobCV.notify_all();
+
+	for (auto& Worker : WorkerThreads)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	WorkerThreads.clear();
+
+	std::lock_guard<std::mutex> Lock(JobMutex);
+	JobQueue.Empty();
+}
+
+bool FTaskScheduler::ExecuteOneBatch(FParallelForJob& Job)
+{
+	const int32 Begin = Job.NextIndex.fetch_add(Job.BatchSize);
+	if (Begin >= Job.Num)
+	{
+		return false;
+	}
+
+	const int32 End = std::min(Begin + Job.BatchSize, Job.Num);
+	Job.Body(Begin, End);
+	Job.PendingBatches.fetch_sub(1, std::memory_order_acq_rel);
+	return true;
+}
+
+void FTaskScheduler::ParallelForRange(int32 Num, int32 BatchSize, TFunctionRef<void(int32, int32)> Body)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	BatchSize = std::max(1, BatchSize);
+	const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+
+	// 배치가 하나뿐이거나 워커가 없으면 스케줄링 비용 없이 바로 실행
+	if (NumBatches == 1 || !IsInitialized())
+	{
+		Body(0, Num);
+		return;
+	}
+
+	// 이 함수가 반환하기 전에 모든 워커가 손을 떼므로 스택에 둠
+	FParallelForJob Job(Body, Num, BatchSize);
+	Job.PendingBatches = NumBatches;
+
+	{
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		JobQueue.Add(&Job);
+	}
+	JobCV.notify_all();
+
+	// 호출 스레드도 배치를 직접 소화
+	while (ExecuteOneBatch(Job))
+	{
+	}
+
+	// 다른 스레드가 들고 있는 배치가 끝날 때까지 대기
+	while (Job.PendingBatches.load(std::memory_order_acquire) > 0)
+	{
+		std::this_thread::yield();
+	}
+
+	// 큐에서 뺀 뒤로는 새 워커가 집어 들 수 없음, 이미 집어 든 워커가 놓을 때까지 대기
+	{
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		JobQueue.Remove(&Job);
+	}
+	while (Job.ActiveWorkers.load(std::memory_order_acquire) > 0)
+	{
+		std::this_thread::yield();
+	}
+}
+
+void FTaskScheduler::WorkerThreadFunc(int32 WorkerIndex)
+{
+	GCurrentThreadIndex = WorkerIndex;
+
+	while (true)
+	{
+		FParallelForJob* Job = nullptr;
+		{
+			std::unique_lock<std::mutex> Lock(JobMutex);
+			JobCV.wait(Lock, [this]()
+			{
+				if (bShutdownRequested)
+				{
+					return true;
+				}
+				for (const FParallelForJob* Pending : JobQueue)
+				{
+					if (Pending->NextIndex.load() < Pending->Num)
+					{
+						return true;
+					}
+				}
+				return false;
+			});
+
+			if (bShutdownRequested)
+			{
+				return;
+			}
+
+			for (FParallelForJob* Pending : JobQueue)
+			{
+				if (Pending->NextIndex.load() < Pending->Num)
+				{
+					// 잠금 안에서 표시해야 호출 스레드가 큐에서 뺀 뒤 이 워커를 기다릴 수 있음
+					Pending->ActiveWorkers.fetch_add(1, std::memory_order_relaxed);
+					Job = Pending;
+					break;
+				}
+			}
+		}
+
+		if (Job)
+		{
+			while (ExecuteOneBatch(*Job))
+			{
+			}
+			// 이후로는 Job을 건드리지 않음 (호출 스레드가 반환하며 스택에서 사라짐)
+			Job->ActiveWorkers.fetch_sub(1, std::memory_order_release);
+		}
+	}
+}
@@ -0,0 +1,164 @@
+#pragma once
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include "UEContainer.h"
+
+template<typename FuncType>
+class TFunctionRef;
+
+/**
+ * @brief 호출 가능한 객체를 소유하지 않고 가리키는 함수 참조
+ * @details std::function과 달리 캡처를 복사하지 않으므로 힙 할당이 없다.
+ * 가리키는 객체(보통 호출 식의 임시 람다)보다 오래 보관해서는 안 된다.
+ */
+template<typename ReturnType, typename... ArgTypes>
+class TFunctionRef<ReturnType(ArgTypes...)>
+{
+public:
+	template<typename FunctorType, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctorType>, TFunctionRef>>>
+	TFunctionRef(FunctorType&& Functor)
+		: Callable(const_cast<void*>(static_cast<const void*>(std::addressof(Functor))))
+		, Invoker(&Invoke<std::remove_reference_t<FunctorType>>)
+	{
+	}
+
+	ReturnType operator()(ArgTypes... Args) const
+	{
+		return Invoker(Callable, std::forward<ArgTypes>(Args)...);
+	}
+
+private:
+	template<typename FunctorType>
+	static ReturnType Invoke(void* InCallable, ArgTypes... Args)
+	{
+		return (*static_cast<FunctorType*>(InCallable))(std::forward<ArgTypes>(Args)...);
+	}
+
+	void* Callable;
+	ReturnType (*Invoker)(void*, ArgTypes...);
+};
+
+/**
+ * @brief ParallelFor 한 번에 해당하는 작업 묶음
+ * @details 인덱스 범위 [0, Num)을 BatchSize 단위로 잘라 워커들이 원자적으로 가져간다.
+ * 호출 스레드의 스택에 놓이며, 호출 스레드는 ActiveWorkers가 0이 될 때까지 반환하지 않는다.
+ *
+ * @param Body 범위 실행 함수 (Begin, End), 호출 측 람다를 참조만 함
+ * @param Num 전체 인덱스 개수
+ * @param BatchSize 한 번에 가져갈 인덱스 개수
+ * @param NextIndex 다음으로 가져갈 시작 인덱스
+ * @param PendingBatches 아직 끝나지 않은 배치 수 (0이 되면 완료)
+ * @param ActiveWorkers 이 작업을 집어 들고 아직 놓지 않은 워커 수
+ */
+struct FParallelForJob
+{
+	FParallelForJob(TFunctionRef<void(int32, int32)> InBody, int32 InNum, int32 InBatchSize)
+		: Body(InBody), Num(InNum), BatchSize(InBatchSize)
+	{
+	}
+
+	TFunctionRef<void(int32, int32)> Body;
+	int32 Num = 0;
+	int32 BatchSize = 1;
+	std::atomic<int32> NextIndex{0};
+	std::atomic<int32> PendingBatches{0};
+	std::atomic<int32> ActiveWorkers{0};
+};
+
+/**
+ * @brief 상주 워커 스레드 풀 기반 데이터 병렬 스케줄러
+ * @details 프레임 내 동기 병렬 처리(컬링, 배치 쿼리, 파티클 시뮬레이션 등)를 위한 공용 워커 풀
+ *
+ * Work Flow:
+ * ParallelFor 호출 시 작업이 JobQueue에 추가되고 워커들을 깨움
+ * 호출 스레드도 직접 배치를 가져가 실행 (중첩 호출 시 데드락 방지)
+ * 모든 배치가 끝날 때까지 호출 스레드는 반환하지 않음
+ *
+ * 작업은 호출 스레드 스택에 두고 본문은 TFunctionRef로 참조하므로 호출마다 힙 할당이 없다.
+ * JobQueue는 Initialize에서 용량을 잡아 두며, 그보다 깊게 중첩 호출될 때만 늘어난다.
+ *
+ * Note: FAsyncLoader(파일 로딩)와는 별도의 풀이며, 블로킹 I/O 작업을 넣어서는 안 된다.
+ */
+class FTaskScheduler
+{
+public:
+	static FTaskScheduler& Get();
+
+	// NumWorkers: 워커 스레드 개수 (기본값 = CPU 코어 수 - 1, 최소 1)
+	void Initialize(int32 NumWorkers = 0);
+	void Shutdown();
+
+	bool IsInitialized() const { return !WorkerThreads.empty(); }
+	int32 GetWorkerCount() const { return static_cast<int32>(WorkerThreads.size()); }
+
+	// 호출 스레드를 포함한 최대 동시 실행 스레드 수 (스레드별 스크래치 버퍼 크기 결정용)
+	int32 GetMaxConcurrency() const { return GetWorkerCount() + 1; }
+
+	// 0 = 워커가 아닌 스레드(게임 스레드 등), 1..N = 워커 스레드
+	static int32 GetCurrentThreadIndex();
+
+	/**
+	 * @brief [0, Num) 범위를 BatchSize 단위로 나누어 병렬 실행
+	 * @param Num 전체 작업 개수
+	 * @param BatchSize 배치 하나의 크기 (너무 작으면 원자 연산 오버헤드가 커짐)
+	 * @param Body (Begin, End) 범위를 처리하는 함수
+	 */
+	void ParallelForRange(int32 Num, int32 BatchSize, TFunctionRef<void(int32, int32)> Body);
+
+private:
+	FTaskScheduler() = default;
+	~FTaskScheduler();
+
+	FTaskScheduler(const FTaskScheduler&) = delete;
+	FTaskScheduler& operator=(const FTaskScheduler&) = delete;
+
+	void WorkerThreadFunc(int32 WorkerIndex);
+
+	// 배치를 하나씩 가져가 실행, 가져갈 배치가 없으면 false
+	static bool ExecuteOneBatch(FParallelForJob& Job);
+
+	std::vector<std::thread> WorkerThreads;
+	std::atomic<bool> bShutdownRequested{false};
+
+	// 동시에 진행 중인 작업 예상치 (스레드마다 중첩 몇 단계), 초과 시에만 JobQueue가 재할당됨
+	static constexpr int32 ReservedJobsPerThread = 4;
+
+	TArray<FParallelForJob*> JobQueue;
+	std::mutex JobMutex;
+	std::condition_variable JobCV;
+};
+
+/**
+ * @brief 인덱스 단위 ParallelFor 헬퍼
+ * @details 작업이 MinBatchSize 이하이거나 워커가 없으면 호출 스레드에서 그대로 실행한다.
+ */
+inline void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body, int32 MinBatchSize = 1)
+{
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	FTaskScheduler& Scheduler = FTaskScheduler::Get();
+	if (Num <= MinBatchSize || !Scheduler.IsInitialized())
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Body(Index);
+		}
+		return;
+	}
+
+	// 스레드당 4배치 정도로 쪼개 불균형을 흡수
+	const int32 TargetBatches = Scheduler.GetMaxConcurrency() * 4;
+	const int32 BatchSize = std::max(MinBatchSize, (Num + TargetBatches - 1) / TargetBatches);
+	Scheduler.ParallelForRange(Num, BatchSize, [Body](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			Body(Index);
+		}
+	});
+}
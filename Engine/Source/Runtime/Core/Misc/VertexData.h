@@ -276,6 +276,50 @@ struct FGroupInfo
     }
 };
 
+// 자동 생성 LOD 최대 개수 (LOD0 = 원본 포함)
+constexpr int32 MaxMeshLODCount = 4;
+
+// 캐시 파일의 LOD 블록 식별자 ('MLOD'), 이 블록이 없는 구버전 캐시는 LOD 없이 읽힘
+constexpr uint32 MeshLODCacheTag = 0x444F4C4D;
+
+/**
+ * @brief 스태틱 메시의 단순화된 LOD 하나 (LOD1~)
+ * @details GroupInfos는 원본과 개수/순서가 같아 머티리얼 슬롯 인덱스를 그대로 쓴다.
+ * 단순화로 삼각형이 모두 사라진 섹션은 IndexCount = 0.
+ */
+struct FStaticMeshLOD
+{
+    float ScreenSize = 0.0f;        // 화면 크기가 이보다 작으면 이 LOD 사용
+    TArray<FNormalVertex> Vertices; // 원본 정점의 부분 집합 (위치/UV/노멀 그대로)
+    TArray<uint32> Indices;
+    TArray<FGroupInfo> GroupInfos;
+
+    friend FArchive& operator<<(FArchive& Ar, FStaticMeshLOD& LOD)
+    {
+        Ar << LOD.ScreenSize;
+        if (Ar.IsSaving())
+        {
+            Serialization::WriteArray(Ar, LOD.Vertices);
+            Serialization::WriteArray(Ar, LOD.Indices);
+
+            uint32 gCount = static_cast<uint32>(LOD.GroupInfos.size());
+            Ar << gCount;
+            for (auto& g : LOD.GroupInfos) Ar << g;
+        }
+        else if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, LOD.Vertices);
+            Serialization::ReadArray(Ar, LOD.Indices);
+
+            uint32 gCount;
+            Ar << gCount;
+            LOD.GroupInfos.resize(gCount);
+            for (auto& g : LOD.GroupInfos) Ar << g;
+        }
+        return Ar;
+    }
+};
+
 struct FStaticMesh
 {
     FString PathFileName;
@@ -287,6 +331,10 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    // 캐시 생성 시 만든 LOD1~ (비어 있으면 원본만 사용)
+    TArray<FStaticMeshLOD> LODs;
+    uint32 LODBuildVersion = 0;     // LOD를 만든 FMeshSimplifier::BuildVersion (0 = LOD 블록 없는 구버전 캐시)
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
@@ -300,6 +348,13 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+
+            uint32 LODTag = MeshLODCacheTag;
+            Ar << LODTag;
+            Ar << Mesh.LODBuildVersion;
+            uint32 LODCount = static_cast<uint32>(Mesh.LODs.size());
+            Ar << LODCount;
+            for (auto& LOD : Mesh.LODs) Ar << LOD;
         }
         else if (Ar.IsLoading())
         {
@@ -313,6 +368,24 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+
+            // 구버전 캐시는 여기서 파일이 끝나므로 태그가 0으로 남음
+            uint32 LODTag = 0;
+            Ar << LODTag;
+            Mesh.LODs.clear();
+            Mesh.LODBuildVersion = 0;
+            if (LODTag == MeshLODCacheTag)
+            {
+                Ar << Mesh.LODBuildVersion;
+                uint32 LODCount;
+                Ar << LODCount;
+                if (LODCount >= MaxMeshLODCount)
+                {
+                    throw std::runtime_error("Cache corrupt: LOD count is unreasonable.");
+                }
+                Mesh.LODs.resize(LODCount);
+                for (auto& LOD : Mesh.LODs) Ar << LOD;
+            }
         }
         return Ar;
     }
@@ -505,6 +578,43 @@ struct FBoneVertInfo
 	TArray<FVector> Normals;
 };
 
+/**
+ * @brief 스켈레탈 메시의 단순화된 LOD 하나 (LOD1~)
+ * @details 정점은 원본의 부분 집합이라 본 인덱스/가중치가 그대로 유지된다. GroupInfos는 FStaticMeshLOD와 같은 규칙.
+ */
+struct FSkeletalMeshLOD
+{
+    float ScreenSize = 0.0f;            // 화면 크기가 이보다 작으면 이 LOD 사용
+    TArray<FSkinnedVertex> Vertices;
+    TArray<uint32> Indices;
+    TArray<FGroupInfo> GroupInfos;
+
+    friend FArchive& operator<<(FArchive& Ar, FSkeletalMeshLOD& LOD)
+    {
+        Ar << LOD.ScreenSize;
+        if (Ar.IsSaving())
+        {
+            Serialization::WriteArray(Ar, LOD.Vertices);
+            Serialization::WriteArray(Ar, LOD.Indices);
+
+            uint32 gCount = static_cast<uint32>(LOD.GroupInfos.size());
+            Ar << gCount;
+            for (auto& g : LOD.GroupInfos) Ar << g;
+        }
+        else if (Ar.IsLoading())
+        {
+            Serialization::ReadArray(Ar, LOD.Vertices);
+            Serialization::ReadArray(Ar, LOD.Indices);
+
+            uint32 gCount;
+            Ar << gCount;
+            LOD.GroupInfos.resize(gCount);
+            for (auto& g : LOD.GroupInfos) Ar << g;
+        }
+        return Ar;
+    }
+};
+
 struct FSkeletalMeshData
 {
     FString PathFileName;
@@ -516,6 +626,10 @@ struct FSkeletalMeshData
     TArray<FGroupInfo> GroupInfos; // 머티리얼 그룹 (기존 시스템 재사용)
     bool bHasMaterial = false;
 
+    // 캐시 생성 시 만든 LOD1~ (비어 있으면 원본만 사용)
+    TArray<FSkeletalMeshLOD> LODs;
+    uint32 LODBuildVersion = 0;     // LOD를 만든 FMeshSimplifier::BuildVersion (0 = LOD 블록 없는 구버전 캐시)
+
     friend FArchive& operator<<(FArchive& Ar, FSkeletalMeshData& Data)
     {
         if (Ar.IsSaving())
@@ -542,6 +656,17 @@ struct FSkeletalMeshData
 
             // 6. CacheFilePath 저장
             Serialization::WriteString(Ar, Data.CacheFilePath);
+
+            // 7. LOD 저장
+            uint32 LODTag = MeshLODCacheTag;
+            Ar << LODTag;
+            Ar << Data.LODBuildVersion;
+            uint32 LODCount = static_cast<uint32>(Data.LODs.size());
+            Ar << LODCount;
+            for (auto& LOD : Data.LODs)
+            {
+                Ar << LOD;
+            }
         }
         else if (Ar.IsLoading())
         {
@@ -571,6 +696,27 @@ struct FSkeletalMeshData
 
             // 6. CacheFilePath 로드
             Serialization::ReadString(Ar, Data.CacheFilePath);
+
+            // 7. LOD 로드 (구버전 캐시는 여기서 파일이 끝나므로 태그가 0으로 남음)
+            uint32 LODTag = 0;
+            Ar << LODTag;
+            Data.LODs.clear();
+            Data.LODBuildVersion = 0;
+            if (LODTag == MeshLODCacheTag)
+            {
+                Ar << Data.LODBuildVersion;
+                uint32 LODCount;
+                Ar << LODCount;
+                if (LODCount >= MaxMeshLODCount)
+                {
+                    throw std::runtime_error("Cache corrupt: LOD count is unreasonable.");
+                }
+                Data.LODs.resize(LODCount);
+                for (auto& LOD : Data.LODs)
+                {
+                    Ar << LOD;
+                }
+            }
         }
         return Ar;
     }
@@ -192,6 +192,7 @@ void AActor::AddOwnedComponent(UActorComponent* Component)
 
 	OwnedComponents.insert(Component);
 	Component->SetOwner(this);
+	UWorld::MarkSceneStructureDirty();
 	if (USceneComponent* SC = Cast<USceneComponent>(Component))
 	{
 		SceneComponents.AddUnique(SC);
@@ -242,6 +243,7 @@ void AActor::RemoveOwnedComponent(UActorComponent* Component)
 
 	// OwnedComponents에서 제거
 	OwnedComponents.erase(Component);
+	UWorld::MarkSceneStructureDirty();
 
 	Component->DestroyComponent();
 }
@@ -301,6 +303,9 @@ void AActor::DestroyAllComponents()
 
 	SceneComponents.Empty();
 	RootComponent = nullptr;
+
+	// 등록되지 않은 에디터 보조 컴포넌트도 FScene 목록에서 빠지도록
+	UWorld::MarkSceneStructureDirty();
 }
 
 // ───────────────
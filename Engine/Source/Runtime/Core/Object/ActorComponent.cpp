@@ -52,6 +52,9 @@ void UActorComponent::RegisterComponent(UWorld* InWorld)
 
     bRegistered = true;
     OnRegister(InWorld);
+
+    // 렌더러의 월드 단위 프록시 수집 결과 무효화
+    UWorld::MarkSceneStructureDirty();
 }
 
 // DestroyComponent에서 스스로 호출됨 (내부에서도 처리 가능하기 때문에)
@@ -64,6 +67,8 @@ void UActorComponent::UnregisterComponent()
 
     OnUnregister();
     bRegistered = false;
+
+    UWorld::MarkSceneStructureDirty();
 }
 
 // Override시 Super::OnRegister() 권장
@@ -399,6 +399,400 @@ namespace Collision
     }
 
 
+
+    // ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ형상 vs AABB 오버랩/스윕ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ
+
+    namespace
+    {
+        inline float PointAABBDistanceSquared(const FVector& Point, const FAABB& Box)
+        {
+            float Dist2 = 0.0f;
+            for (int32 i = 0; i < 3; ++i)
+            {
+                const float Clamped = std::clamp(Point[i], Box.Min[i], Box.Max[i]);
+                Dist2 += (Point[i] - Clamped) * (Point[i] - Clamped);
+            }
+            return Dist2;
+        }
+
+        // Index의 비트 0/1/2가 켜져 있으면 해당 축의 Max, 아니면 Min을 고른 꼭짓점
+        inline FVector GetAABBCorner(const FAABB& Box, int32 Index)
+        {
+            return FVector(
+                (Index & 1) ? Box.Max.X : Box.Min.X,
+                (Index & 2) ? Box.Max.Y : Box.Min.Y,
+                (Index & 4) ? Box.Max.Z : Box.Min.Z);
+        }
+
+        // 슬랩 판정, 시작점이 박스 안이면 OutEnter = 0
+        inline bool IntersectRayAABBEnter(const FVector& Origin, const FVector& Dir, const FVector& Min, const FVector& Max,
+            float MaxDistance, float& OutEnter)
+        {
+            float TMin = 0.0f;
+            float TMax = MaxDistance;
+            for (int32 i = 0; i < 3; ++i)
+            {
+                if (std::fabs(Dir[i]) < 1e-8f)
+                {
+                    if (Origin[i] < Min[i] || Origin[i] > Max[i])
+                        return false;
+                    continue;
+                }
+                const float InvDir = 1.0f / Dir[i];
+                float T1 = (Min[i] - Origin[i]) * InvDir;
+                float T2 = (Max[i] - Origin[i]) * InvDir;
+                if (T1 > T2) std::swap(T1, T2);
+                TMin = std::max(TMin, T1);
+                TMax = std::min(TMax, T2);
+                if (TMin > TMax)
+                    return false;
+            }
+            OutEnter = TMin;
+            return true;
+        }
+    }
+
+    bool IntersectRayCapsule(const FVector& Origin, const FVector& Dir, const FVector& P0, const FVector& P1, float Radius, float& OutT)
+    {
+        const FVector BA = P1 - P0;
+        const FVector OA = Origin - P0;
+        const float BaBa = FVector::Dot(BA, BA);
+        const float R2 = Radius * Radius;
+
+        // 시작점이 이미 캡슐 안
+        const float S = BaBa > 0.0f ? std::clamp(FVector::Dot(OA, BA) / BaBa, 0.0f, 1.0f) : 0.0f;
+        if ((OA - BA * S).SizeSquared() <= R2)
+        {
+            OutT = 0.0f;
+            return true;
+        }
+
+        float BestT = FLT_MAX;
+
+        // 원통 몸통 (축 방향 범위 안의 근만 유효)
+        if (BaBa > 1e-12f)
+        {
+            const float BaRd = FVector::Dot(BA, Dir);
+            const float BaOa = FVector::Dot(BA, OA);
+            const float RdOa = FVector::Dot(Dir, OA);
+            const float OaOa = FVector::Dot(OA, OA);
+            const float A = BaBa - BaRd * BaRd;
+            const float B = BaBa * RdOa - BaOa * BaRd;
+            const float C = BaBa * OaOa - BaOa * BaOa - R2 * BaBa;
+            const float H = B * B - A * C;
+            if (A > 1e-8f * BaBa && H >= 0.0f)
+            {
+                const float T = (-B - std::sqrt(H)) / A;
+                const float Y = BaOa + T * BaRd;
+                if (T >= 0.0f && Y > 0.0f && Y < BaBa)
+                {
+                    BestT = T;
+                }
+            }
+        }
+
+        // 양 끝 반구
+        const FVector Caps[2] = { P0, P1 };
+        for (const FVector& Cap : Caps)
+        {
+            const FVector OC = Origin - Cap;
+            const float B = FVector::Dot(Dir, OC);
+            const float C = FVector::Dot(OC, OC) - R2;
+            const float H = B * B - C;
+            if (H >= 0.0f)
+            {
+                const float T = -B - std::sqrt(H);
+                if (T >= 0.0f && T < BestT)
+                {
+                    BestT = T;
+                }
+            }
+        }
+
+        if (BestT == FLT_MAX)
+            return false;
+        OutT = BestT;
+        return true;
+    }
+
+    float SegmentAABBDistanceSquared(const FVector& P0, const FVector& P1, const FAABB& Box, float* OutSegmentT)
+    {
+        const FVector D = P1 - P0;
+
+        // 선분이 각 축의 Min/Max 평면을 지나는 매개변수로 구간을 나누면, 구간 안에서 거리 제곱은 t의 2차식
+        float Breaks[8];
+        int32 NumBreaks = 0;
+        Breaks[NumBreaks++] = 0.0f;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            if (std::fabs(D[i]) < 1e-12f)
+                continue;
+            const float TMin = (Box.Min[i] - P0[i]) / D[i];
+            const float TMax = (Box.Max[i] - P0[i]) / D[i];
+            if (TMin > 0.0f && TMin < 1.0f) Breaks[NumBreaks++] = TMin;
+            if (TMax > 0.0f && TMax < 1.0f) Breaks[NumBreaks++] = TMax;
+        }
+        Breaks[NumBreaks++] = 1.0f;
+        std::sort(Breaks, Breaks + NumBreaks);
+
+        float BestDist2 = FLT_MAX;
+        float BestT = 0.0f;
+        for (int32 k = 0; k + 1 < NumBreaks; ++k)
+        {
+            const float T0 = Breaks[k];
+            const float T1 = Breaks[k + 1];
+            const float Mid = 0.5f * (T0 + T1);
+
+            // 구간 안에서 박스 밖에 있는 축만 거리에 기여 -> 도함수 0인 지점을 구간으로 클램프
+            float Num = 0.0f;
+            float Den = 0.0f;
+            for (int32 i = 0; i < 3; ++i)
+            {
+                const float V = P0[i] + D[i] * Mid;
+                float Target;
+                if (V < Box.Min[i]) Target = Box.Min[i];
+                else if (V > Box.Max[i]) Target = Box.Max[i];
+                else continue;
+                Num += (Target - P0[i]) * D[i];
+                Den += D[i] * D[i];
+            }
+            const float T = Den > 0.0f ? std::clamp(Num / Den, T0, T1) : T0;
+            const float Dist2 = PointAABBDistanceSquared(P0 + D * T, Box);
+            if (Dist2 < BestDist2)
+            {
+                BestDist2 = Dist2;
+                BestT = T;
+            }
+        }
+
+        if (OutSegmentT)
+        {
+            *OutSegmentT = BestT;
+        }
+        return BestDist2;
+    }
+
+    bool OverlapCapsuleAABB(const FVector& P0, const FVector& P1, float Radius, const FAABB& Box)
+    {
+        return SegmentAABBDistanceSquared(P0, P1, Box) <= Radius * Radius;
+    }
+
+    bool OverlapOBBAABB(const FOBB& Obb, const FAABB& Box)
+    {
+        float T;
+        FVector Normal;
+        return SweepOBBAABB(Obb, FVector(0.0f, 0.0f, 0.0f), 0.0f, Box, T, Normal);
+    }
+
+    bool SweepSphereAABB(const FVector& Center, float Radius, const FVector& Dir, float MaxDistance, const FAABB& Box, float& OutT)
+    {
+        // Real-Time Collision Detection 5.5.7 Intersecting Moving Sphere Against AABB
+        if (PointAABBDistanceSquared(Center, Box) <= Radius * Radius)
+        {
+            OutT = 0.0f;
+            return true;
+        }
+
+        // 반지름만큼 확장한 박스에 대한 레이 판정 후, 모서리/꼭짓점 영역이면 둥근 부분(캡슐)으로 재판정
+        const FVector Expand(Radius, Radius, Radius);
+        float TEnter;
+        if (!IntersectRayAABBEnter(Center, Dir, Box.Min - Expand, Box.Max + Expand, MaxDistance, TEnter))
+            return false;
+
+        const FVector P = Center + Dir * TEnter;
+        int32 U = 0;
+        int32 V = 0;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            if (P[i] < Box.Min[i]) U |= (1 << i);
+            if (P[i] > Box.Max[i]) V |= (1 << i);
+        }
+        const int32 Mask = U | V;
+
+        // 면 영역
+        if ((Mask & (Mask - 1)) == 0)
+        {
+            OutT = TEnter;
+            return true;
+        }
+
+        float BestT = FLT_MAX;
+        float T;
+        if (Mask == 7)
+        {
+            // 꼭짓점 영역: 꼭짓점에서 뻗은 세 모서리 캡슐 중 가장 먼저 닿는 곳
+            const FVector Corner = GetAABBCorner(Box, V);
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                if (IntersectRayCapsule(Center, Dir, Corner, GetAABBCorner(Box, V ^ (1 << Axis)), Radius, T) && T < BestT)
+                {
+                    BestT = T;
+                }
+            }
+        }
+        else if (IntersectRayCapsule(Center, Dir, GetAABBCorner(Box, U ^ 7), GetAABBCorner(Box, V), Radius, T))
+        {
+            // 모서리 영역
+            BestT = T;
+        }
+
+        if (BestT > MaxDistance)
+            return false;
+        OutT = BestT;
+        return true;
+    }
+
+    bool SweepCapsuleAABB(const FVector& P0, const FVector& P1, float Radius, const FVector& Dir, float MaxDistance, const FAABB& Box, float& OutT)
+    {
+        if (OverlapCapsuleAABB(P0, P1, Radius, Box))
+        {
+            OutT = 0.0f;
+            return true;
+        }
+
+        // 첫 접촉은 (캡슐 끝점, 박스 임의 지점) / (캡슐 몸통, 박스 꼭짓점) / (캡슐 몸통, 박스 모서리 내부) 중 하나
+        float BestT = FLT_MAX;
+        float T;
+
+        // 1. 양 끝 반구: 구 스윕
+        if (SweepSphereAABB(P0, Radius, Dir, MaxDistance, Box, T) && T < BestT) BestT = T;
+        if (SweepSphereAABB(P1, Radius, Dir, MaxDistance, Box, T) && T < BestT) BestT = T;
+
+        // 2. 박스 꼭짓점이 반대 방향으로 움직여 캡슐에 닿는 시점
+        const FVector NegDir = Dir * -1.0f;
+        for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
+        {
+            if (IntersectRayCapsule(GetAABBCorner(Box, CornerIndex), NegDir, P0, P1, Radius, T) && T < BestT)
+            {
+                BestT = T;
+            }
+        }
+
+        // 3. 박스 모서리 내부와 캡슐 축 내부: 두 직선 사이 거리는 공통 법선 성분이므로 이동 거리에 선형
+        const FVector S = P1 - P0;
+        const float SS = FVector::Dot(S, S);
+        if (SS > 1e-12f)
+        {
+            for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
+            {
+                for (int32 Axis = 0; Axis < 3; ++Axis)
+                {
+                    const int32 Bit = 1 << Axis;
+                    if (CornerIndex & Bit)
+                        continue; // 각 모서리를 한 번만 (Min 쪽 꼭짓점에서 시작)
+
+                    const FVector A = GetAABBCorner(Box, CornerIndex);
+                    const FVector E = GetAABBCorner(Box, CornerIndex | Bit) - A;
+                    FVector N = FVector::Cross(E, S);
+                    const float NN = N.SizeSquared();
+                    if (NN < 1e-10f * SS * E.SizeSquared())
+                        continue; // 평행하면 끝점/꼭짓점 판정에서 처리됨
+
+                    N = N / std::sqrt(NN);
+                    const float W0 = FVector::Dot(P0 - A, N);
+                    const float DN = FVector::Dot(Dir, N);
+                    if (std::fabs(W0) <= Radius || std::fabs(DN) < 1e-8f)
+                        continue;
+                    const float Target = W0 > 0.0f ? Radius : -Radius;
+                    const float TContact = (Target - W0) / DN;
+                    if (TContact < 0.0f || TContact >= BestT || TContact > MaxDistance)
+                        continue;
+
+                    // 그 시점의 두 직선 최근접점이 두 선분 내부에 있어야 유효
+                    const FVector R = (P0 + Dir * TContact) - A;
+                    const float B = FVector::Dot(S, E);
+                    const float C = FVector::Dot(S, R);
+                    const float F = FVector::Dot(E, R);
+                    const float EE = E.SizeSquared();
+                    const float Denom = SS * EE - B * B;
+                    const float SegS = (B * F - C * EE) / Denom;
+                    const float SegE = (B * SegS + F) / EE;
+                    if (SegS >= 0.0f && SegS <= 1.0f && SegE >= 0.0f && SegE <= 1.0f)
+                    {
+                        BestT = TContact;
+                    }
+                }
+            }
+        }
+
+        if (BestT > MaxDistance)
+            return false;
+        OutT = BestT;
+        return true;
+    }
+
+    bool SweepOBBAABB(const FOBB& Obb, const FVector& Dir, float MaxDistance, const FAABB& Box, float& OutT, FVector& OutNormal)
+    {
+        const FVector BoxCenter = Box.GetCenter();
+        const FVector BoxHalf = Box.GetHalfExtent();
+        const FVector Offset = Obb.Center - BoxCenter;
+        const FVector WorldAxes[3] = { FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1) };
+
+        float TEnter = -FLT_MAX;
+        float TExit = FLT_MAX;
+        FVector EnterNormal = Dir * -1.0f;
+
+        // 축 하나에서 두 구간이 겹치는 시간 범위를 누적, 영원히 분리되면 false
+        const auto TestAxis = [&](FVector Axis) -> bool
+            {
+                const float Len2 = Axis.SizeSquared();
+                if (Len2 < 1e-8f)
+                    return true; // 평행 모서리 쌍: 다른 축에서 판정됨
+                Axis = Axis / std::sqrt(Len2);
+
+                const float RadiusBox = std::fabs(Axis.X) * BoxHalf.X + std::fabs(Axis.Y) * BoxHalf.Y + std::fabs(Axis.Z) * BoxHalf.Z;
+                const float RadiusObb = std::fabs(FVector::Dot(Axis, Obb.Axes[0])) * Obb.HalfExtent.X
+                    + std::fabs(FVector::Dot(Axis, Obb.Axes[1])) * Obb.HalfExtent.Y
+                    + std::fabs(FVector::Dot(Axis, Obb.Axes[2])) * Obb.HalfExtent.Z;
+                const float Sum = RadiusBox + RadiusObb;
+                const float Dist = FVector::Dot(Offset, Axis);
+                const float Speed = FVector::Dot(Dir, Axis);
+
+                if (std::fabs(Speed) < 1e-8f)
+                {
+                    return std::fabs(Dist) <= Sum;
+                }
+
+                float T0 = (-Sum - Dist) / Speed;
+                float T1 = (Sum - Dist) / Speed;
+                if (T0 > T1) std::swap(T0, T1);
+                if (T0 > TEnter)
+                {
+                    TEnter = T0;
+                    EnterNormal = Dist >= 0.0f ? Axis : Axis * -1.0f;
+                }
+                TExit = std::min(TExit, T1);
+                return TEnter <= TExit;
+            };
+
+        for (int32 i = 0; i < 3; ++i)
+        {
+            if (!TestAxis(WorldAxes[i]) || !TestAxis(Obb.Axes[i]))
+                return false;
+        }
+        for (int32 i = 0; i < 3; ++i)
+        {
+            for (int32 j = 0; j < 3; ++j)
+            {
+                if (!TestAxis(FVector::Cross(WorldAxes[i], Obb.Axes[j])))
+                    return false;
+            }
+        }
+
+        if (TExit < 0.0f || TEnter > MaxDistance)
+            return false;
+
+        // 모든 축에서 시작부터 겹쳐 있으면 초기 침투
+        if (TEnter <= 0.0f)
+        {
+            OutT = 0.0f;
+            OutNormal = Dir * -1.0f;
+            return true;
+        }
+        OutT = TEnter;
+        OutNormal = EnterNormal;
+        return true;
+    }
 }
 
 
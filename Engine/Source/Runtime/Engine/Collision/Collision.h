@@ -42,4 +42,22 @@ namespace Collision
     
     bool CheckOverlap(const UShapeComponent* A, const UShapeComponent* B);
 
+    // ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ형상 vs AABB 오버랩/스윕 (엔진 BVH 형상 쿼리용)ㅡㅡㅡㅡㅡㅡㅡㅡㅡㅡ
+    // Dir는 정규화된 이동 방향, OutT는 첫 접촉까지의 이동 거리 (시작부터 겹쳐 있으면 0)
+    // 모두 힙 할당 없이 동작하므로 워커 스레드에서 호출해도 된다.
+
+    // 레이(t >= 0)와 캡슐(선분 P0-P1, 반지름 Radius)의 첫 진입 거리
+    bool IntersectRayCapsule(const FVector& Origin, const FVector& Dir, const FVector& P0, const FVector& P1, float Radius, float& OutT);
+
+    // 선분 P0-P1과 AABB 사이 최단 거리의 제곱 (OutSegmentT: 선분 위 최근접점의 매개변수 0~1)
+    float SegmentAABBDistanceSquared(const FVector& P0, const FVector& P1, const FAABB& Box, float* OutSegmentT = nullptr);
+
+    bool OverlapCapsuleAABB(const FVector& P0, const FVector& P1, float Radius, const FAABB& Box);
+    bool OverlapOBBAABB(const FOBB& Obb, const FAABB& Box);
+
+    bool SweepSphereAABB(const FVector& Center, float Radius, const FVector& Dir, float MaxDistance, const FAABB& Box, float& OutT);
+    bool SweepCapsuleAABB(const FVector& P0, const FVector& P1, float Radius, const FVector& Dir, float MaxDistance, const FAABB& Box, float& OutT);
+    // 분리축 15개에 대한 진입/이탈 시간으로 계산 (OutNormal: 접촉면 법선, 박스 -> OBB 방향)
+    bool SweepOBBAABB(const FOBB& Obb, const FVector& Dir, float MaxDistance, const FAABB& Box, float& OutT, FVector& OutNormal);
+
 }
\ No newline at end of file
@@ -152,6 +152,50 @@ FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideA
     return Result;
 }
 
+// ------------------------------------------------------------
+// VP 행렬에서 평면 추출
+//  - row-vector 규약(p' = p * VP)에서 클립 좌표의 각 성분은 VP의 "열"과의 내적
+//  - 클립 내부: -w <= x <= w, -w <= y <= w, 0 <= z <= w (D3D)
+//  - 결합 결과 (a,b,c,d)에 대해 a*x + b*y + c*z + d >= 0 이 내부이므로
+//    평면식 dot(N,X) - D >= 0 에 맞춰 N = (a,b,c) / Len, D = -d / Len
+// ------------------------------------------------------------
+static FPlane MakePlaneFromClipEquation(float A, float B, float C, float D)
+{
+    FPlane Out;
+    const float Len = std::sqrt(A * A + B * B + C * C);
+    if (Len > KINDA_SMALL_NUMBER)
+    {
+        Out.Normal = FVector4(A / Len, B / Len, C / Len, 0.0f);
+        Out.Distance = -D / Len;
+    }
+    return Out;
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    const auto& M = ViewProjection.M;
+    auto Column = [&M](int Index, float Sign, float (&Out)[4])
+    {
+        for (int Row = 0; Row < 4; ++Row)
+        {
+            Out[Row] = M[Row][3] + Sign * M[Row][Index];
+        }
+    };
+
+    float Eq[4];
+    FFrustum Result;
+
+    Column(0, 1.0f, Eq);  Result.LeftFace = MakePlaneFromClipEquation(Eq[0], Eq[1], Eq[2], Eq[3]);
+    Column(0, -1.0f, Eq); Result.RightFace = MakePlaneFromClipEquation(Eq[0], Eq[1], Eq[2], Eq[3]);
+    Column(1, 1.0f, Eq);  Result.BottomFace = MakePlaneFromClipEquation(Eq[0], Eq[1], Eq[2], Eq[3]);
+    Column(1, -1.0f, Eq); Result.TopFace = MakePlaneFromClipEquation(Eq[0], Eq[1], Eq[2], Eq[3]);
+    Column(2, -1.0f, Eq); Result.FarFace = MakePlaneFromClipEquation(Eq[0], Eq[1], Eq[2], Eq[3]);
+
+    // Near: z >= 0 (w 결합 없음)
+    Result.NearFace = MakePlaneFromClipEquation(M[0][2], M[1][2], M[2][2], M[3][2]);
+    return Result;
+}
+
 // ------------------------------------------------------------
 // AABB vs 프러스텀 판정
 //  - 각 평면에 대해: 중심의 부호 + 박스의 "프로젝션 반경"으로 배제 테스트
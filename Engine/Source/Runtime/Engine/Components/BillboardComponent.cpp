@@ -87,64 +87,85 @@ void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshB
 		return; // 그릴 메시 데이터 없음
 	}
 
-	// 2. 사용할 머티리얼과 셰이더 결정
-	UMaterialInterface* MaterialToUse = GetMaterial(0); // this->Material 반환
-	UShader* ShaderToUse = nullptr;
-
-	if (MaterialToUse && MaterialToUse->GetShader())
-	{
-		ShaderToUse = MaterialToUse->GetShader();
-	}
-	else
+	// 빌보드 셰이더는 뷰 모드 매크로를 쓰지 않으므로 키 하나만 사용
+	// 쿼드/머티리얼이 그대로면 셰이더 변형 조회 없이 캐시된 커맨드를 재사용
+	constexpr uint64 DrawCommandKey = 0;
+	FCachedMeshDrawCommandList* CachedList = CachedDrawCommands.Find(DrawCommandKey);
+	if (!CachedList || !CachedList->IsUpToDate(Quad, Quad->GetVertexBuffer(), Quad->GetIndexBuffer(), this, 1))
 	{
-		// [Fallback 로직]
-		UE_LOG("UBillboardComponent: Material이 없거나 셰이더가 없어서 기본 빌보드 셰이더 사용");
+		CachedList = &CachedDrawCommands.Allocate(DrawCommandKey);
+		CachedList->RecordInputs(Quad, Quad->GetVertexBuffer(), Quad->GetIndexBuffer(), this, 1);
+
+		// 2. 사용할 머티리얼과 셰이더 결정
+		UMaterialInterface* MaterialToUse = GetMaterial(0); // this->Material 반환
+		UShader* ShaderToUse = nullptr;
 
-		// 생성자에서 사용한 경로와 동일하게 Fallback
-		MaterialToUse = UResourceManager::GetInstance().Load<UMaterial>("Shaders/UI/Billboard.hlsl");
-		if (MaterialToUse)
+		if (MaterialToUse && MaterialToUse->GetShader())
 		{
 			ShaderToUse = MaterialToUse->GetShader();
 		}
+		else
+		{
+			// [Fallback 로직]
+			UE_LOG("UBillboardComponent: Material이 없거나 셰이더가 없어서 기본 빌보드 셰이더 사용");
+
+			// 생성자에서 사용한 경로와 동일하게 Fallback
+			MaterialToUse = UResourceManager::GetInstance().Load<UMaterial>("Shaders/UI/Billboard.hlsl");
+			if (MaterialToUse)
+			{
+				ShaderToUse = MaterialToUse->GetShader();
+			}
+
+			// 기본 셰이더조차 없으면 렌더링 불가 (빈 커맨드 목록이 캐시되어 입력이 바뀔 때까지 건너뜀)
+			if (!MaterialToUse || !ShaderToUse)
+			{
+				UE_LOG("UBillboardComponent: 기본 빌보드 머티리얼/셰이더를 찾을 수 없습니다!");
+				return;
+			}
+		}
 
-		// 기본 셰이더조차 없으면 렌더링 불가
-		if (!MaterialToUse || !ShaderToUse)
+		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderMacros());
+		if (!ShaderVariant)
 		{
-			UE_LOG("UBillboardComponent: 기본 빌보드 머티리얼/셰이더를 찾을 수 없습니다!");
 			return;
 		}
-	}
 
-	// 3. FMeshBatchElement 생성
-	// UQuad는 GroupInfo가 없는 단일 메시로 처리합니다.
-	FMeshBatchElement BatchElement;
+		// 3. FMeshBatchElement 생성
+		// UQuad는 GroupInfo가 없는 단일 메시로 처리합니다.
+		FMeshBatchElement BatchElement;
 
-	FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderMacros());
+		// --- 정렬 키 ---
+		BatchElement.VertexShader = ShaderVariant->VertexShader;
+		BatchElement.PixelShader = ShaderVariant->PixelShader;
+		BatchElement.InputLayout = ShaderVariant->InputLayout;
+		BatchElement.Material = MaterialToUse;
+		BatchElement.VertexBuffer = Quad->GetVertexBuffer();
+		BatchElement.IndexBuffer = Quad->GetIndexBuffer();
 
-	// --- 정렬 키 ---
-	BatchElement.VertexShader = ShaderVariant->VertexShader;
-	BatchElement.PixelShader = ShaderVariant->PixelShader;
-	BatchElement.InputLayout = ShaderVariant->InputLayout;
-	BatchElement.Material = MaterialToUse;
-	BatchElement.VertexBuffer = Quad->GetVertexBuffer();
-	BatchElement.IndexBuffer = Quad->GetIndexBuffer();
+		// 참고: UQuad 클래스에 GetVertexStride() 함수가 필요합니다.
+		BatchElement.VertexStride = Quad->GetVertexStride();
 
-	// 참고: UQuad 클래스에 GetVertexStride() 함수가 필요합니다.
-	BatchElement.VertexStride = Quad->GetVertexStride();
+		// --- 드로우 데이터 (메시 전체 범위 사용) ---
+		BatchElement.IndexCount = Quad->GetIndexCount(); // 전체 인덱스 수
+		BatchElement.StartIndex = 0;
+		BatchElement.BaseVertexIndex = 0;
+		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-	// --- 드로우 데이터 (메시 전체 범위 사용) ---
-	BatchElement.IndexCount = Quad->GetIndexCount(); // 전체 인덱스 수
-	BatchElement.StartIndex = 0;
-	BatchElement.BaseVertexIndex = 0;
+		CachedList->Commands.Add(BatchElement);
+	}
+
+	if (CachedList->Commands.IsEmpty())
+	{
+		return;
+	}
 
 	// --- 인스턴스 데이터 ---
 	// 빌보드는 3개의 스케일 펙터중에서 가장 큰 값으로 유니폼스케일, 회전 미적용, Tarnslation 적용
 	float Scale = GetRelativeScale().GetMaxValue();
-	BatchElement.WorldMatrix = FMatrix::MakeScale(Scale) * FMatrix::MakeTranslation(GetWorldLocation());
-
-	BatchElement.ObjectID = InternalIndex;
-	BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	const FMatrix WorldMatrix = FMatrix::MakeScale(Scale) * FMatrix::MakeTranslation(GetWorldLocation());
+	FCachedMeshDrawCommandSet::AppendTo(*CachedList, WorldMatrix, InternalIndex, OutMeshBatchElements);
 
+	FMeshBatchElement& BatchElement = OutMeshBatchElements.back();
 	BatchElement.InstanceShaderResourceView = Texture->GetShaderResourceView();
 
 	FLinearColor Color{ 1,1,1,1 };
@@ -153,6 +174,4 @@ void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshB
 		Color = LightBase->GetLightColor();
 	}
 	BatchElement.InstanceColor = Color;
-
-	OutMeshBatchElements.Add(BatchElement);
 }
@@ -2,6 +2,7 @@
 
 #include "PrimitiveComponent.h"
 #include "Object.h"
+#include "CachedMeshDrawCommand.h"
 #include "UBillboardComponent.generated.h"
 
 class UQuad;
@@ -50,5 +51,8 @@ private:
 
     UMaterialInterface* Material = nullptr;
     UQuad* Quad = nullptr;
+
+    // 셰이더 변형 조회 결과를 담은 캐시된 드로우 커맨드 (텍스처/색상/행렬만 매 프레임 갱신)
+    FCachedMeshDrawCommandSet CachedDrawCommands;
 };
 
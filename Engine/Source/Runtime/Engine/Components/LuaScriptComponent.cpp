@@ -7,6 +7,7 @@
 #include "CameraActor.h"
 #include "LuaManager.h"
 #include "GameObject.h"
+#include "ParticleSystemComponent.h"
 
 // for test
 #include "PlayerCameraManager.h"
@@ -78,6 +79,19 @@ void ULuaScriptComponent::BeginPlay()
 	FuncOnBeginOverlap = FLuaManager::GetFunc(Env, "OnBeginOverlap");
 	FuncOnEndOverlap = FLuaManager::GetFunc(Env, "OnEndOverlap");
 	FuncEndPlay		  =	FLuaManager::GetFunc(Env, "EndPlay");
+	FuncOnParticleCollision = FLuaManager::GetFunc(Env, "OnParticleCollision");
+
+	// 스크립트가 받을 때만 같은 액터의 파티클 충돌 이벤트 구독
+	if (FuncOnParticleCollision.valid())
+	{
+		for (UActorComponent* Component : Owner->GetOwnedComponents())
+		{
+			if (UParticleSystemComponent* ParticleComp = Cast<UParticleSystemComponent>(Component))
+			{
+				ParticleCollisionHandles.Add({ ParticleComp, ParticleComp->OnParticleCollide.AddDynamic(this, &ULuaScriptComponent::OnParticleCollision) });
+			}
+		}
+	}
 	
 	if (FuncBeginPlay.valid()) {
 		auto Result = FuncBeginPlay();
@@ -175,6 +189,31 @@ void ULuaScriptComponent::OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent
 	}
 }
 
+void ULuaScriptComponent::OnParticleCollision(UParticleSystemComponent* ParticleComp, const FParticleCollisionEvent& Event)
+{
+	if (FuncOnParticleCollision.valid())
+	{
+		// 높이장 충돌이나 액터가 없는 면이면 nil
+		FGameObject* OtherGameObject = nullptr;
+		if (Event.HitComponent)
+		{
+			if (AActor* OtherActor = Event.HitComponent->GetOwner())
+			{
+				OtherGameObject = OtherActor->GetGameObject();
+			}
+		}
+
+		auto Result = FuncOnParticleCollision(OtherGameObject, Event.Location, Event.Normal, Event.Velocity, Event.EmitterIndex);
+		if (!Result.valid())
+		{
+			sol::error Err = Result; UE_LOG("Lua: Error: %s", Err.what());
+#ifdef _EDITOR
+			GEngine.EndPIE();
+#endif
+		}
+	}
+}
+
 void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
 	if (FuncTick.valid()) {
@@ -203,7 +242,17 @@ void ULuaScriptComponent::EndPlay()
 		Owner->OnComponentBeginOverlap.Remove(BeginHandleLua);
 		Owner->OnComponentEndOverlap.Remove(EndHandleLua);
 		// Owner->OnComponentHit.Remove(HitHandleLua);
+
+		// 먼저 삭제된 파티클 컴포넌트는 건너뜀
+		for (const auto& [ParticleComp, Handle] : ParticleCollisionHandles)
+		{
+			if (Owner->GetOwnedComponents().Contains(ParticleComp))
+			{
+				ParticleComp->OnParticleCollide.Remove(Handle);
+			}
+		}
 	}
+	ParticleCollisionHandles.Empty();
 
 	// 모든 Lua 관련 리소스 정리
 	CleanupLuaResources();
@@ -233,6 +282,7 @@ void ULuaScriptComponent::CleanupLuaResources()
 	FuncOnBeginOverlap = sol::nil;
 	FuncOnEndOverlap = sol::nil;
 	FuncOnHit = sol::nil;
+	FuncOnParticleCollision = sol::nil;
 	FuncEndPlay = sol::nil;
 	Env = sol::nil;
 	Lua = nullptr;
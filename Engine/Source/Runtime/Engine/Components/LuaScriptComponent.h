@@ -9,6 +9,8 @@ namespace sol { class state; }
 using state = sol::state;
 
 class USceneComponent;
+class UParticleSystemComponent;
+struct FParticleCollisionEvent;
 
 UCLASS(DisplayName="Lua 스크립트 컴포넌트", Description="Lua 스크립트를 실행하는 컴포넌트입니다")
 class ULuaScriptComponent : public UActorComponent
@@ -33,6 +35,7 @@ public:
 	void OnBeginOverlap(UPrimitiveComponent* MyComp, UPrimitiveComponent* OtherComp);
 	void OnEndOverlap(UPrimitiveComponent* MyComp, UPrimitiveComponent* OtherComp);
 	void OnHit(UPrimitiveComponent* MyComp, UPrimitiveComponent* OtherComp);
+	void OnParticleCollision(UParticleSystemComponent* ParticleComp, const FParticleCollisionEvent& Event);
 
 	bool Call(const char* FuncName, sol::variadic_args VarArgs); // 다른 클래스가 날 호출할 때 씀
 
@@ -49,10 +52,14 @@ protected:
 	sol::protected_function FuncOnBeginOverlap{};
 	sol::protected_function FuncOnEndOverlap{};
 	sol::protected_function FuncOnHit{};
+	sol::protected_function FuncOnParticleCollision{};
 	sol::protected_function FuncEndPlay{};
 
 	FDelegateHandle BeginHandleLua{};
 	FDelegateHandle EndHandleLua{};
+
+	// 같은 액터의 파티클 컴포넌트에 등록한 OnParticleCollide 핸들
+	TArray<std::pair<UParticleSystemComponent*, FDelegateHandle>> ParticleCollisionHandles;
 	
 	bool bIsLuaCleanedUp = false;
 };
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include "Material.h"
 #include "ResourceManager.h"
 #include "WorldPartitionManager.h"
+#include "SceneView.h"
+#include "SceneViewState.h"
+#include "RenderSettings.h"
 
 UMeshComponent::UMeshComponent() = default;
 
@@ -105,6 +108,9 @@ void UMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 void UMeshComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
+
+	// 원본의 캐시(컴포넌트 전용 버퍼/스키닝 행렬 포인터 포함)를 물려받지 않도록 비움
+	CachedDrawCommands.Invalidate();
 	
 	// 이 함수는 '복사본' (PIE 컴포넌트)에서 실행됩니다.
 	// 현재 'DynamicMaterialInstances'와 'MaterialSlots'는 
@@ -173,6 +179,58 @@ void UMeshComponent::MarkWorldPartitionDirty()
 	}
 }
 
+int32 UMeshComponent::SelectLOD(const FSceneView* View, const TArray<float>& ScreenSizes, int32 NumLODs)
+{
+	NumLODs = std::min(NumLODs, static_cast<int32>(ScreenSizes.Num()));
+	if (NumLODs <= 1 || !View)
+	{
+		return 0;
+	}
+
+	const int32 ForcedLOD = View->RenderSettings ? View->RenderSettings->GetForcedLOD() : -1;
+	if (ForcedLOD >= 0)
+	{
+		return std::min(ForcedLOD, NumLODs - 1);
+	}
+
+	// 화면 크기: 경계 구의 투영 반지름 (화면 높이 절반 = 1)
+	const FAABB Bounds = GetWorldAABB();
+	const FVector Center = (Bounds.Min + Bounds.Max) * 0.5f;
+	const float Radius = (Bounds.Max - Bounds.Min).Size() * 0.5f;
+	const float ProjectionScale = std::max(View->ProjectionMatrix.M[0][0], View->ProjectionMatrix.M[1][1]);
+
+	float ScreenSize = Radius * ProjectionScale;
+	if (View->ProjectionMode == ECameraProjectionMode::Perspective)
+	{
+		const float Distance = (Center - View->ViewLocation).Size();
+		ScreenSize = Distance > Radius ? ScreenSize / Distance : FLT_MAX;
+	}
+
+	FSceneViewState* ViewState = View->ViewState;
+	const int32 PreviousLOD = ViewState ? ViewState->FindMeshLOD(this) : -1;
+
+	// 경계마다 직전 LOD 쪽으로 여유를 둠 (직전 LOD가 없으면 여유 없이 판정)
+	int32 LODIndex = 0;
+	for (int32 Candidate = 1; Candidate < NumLODs; ++Candidate)
+	{
+		float Threshold = ScreenSizes[Candidate];
+		if (PreviousLOD >= 0)
+		{
+			Threshold *= Candidate <= PreviousLOD ? 1.0f + LODHysteresis : 1.0f - LODHysteresis;
+		}
+		if (ScreenSize < Threshold)
+		{
+			LODIndex = Candidate;
+		}
+	}
+
+	if (ViewState && LODIndex != PreviousLOD)
+	{
+		ViewState->SetMeshLOD(this, LODIndex);
+	}
+	return LODIndex;
+}
+
 UMaterialInterface* UMeshComponent::GetMaterial(uint32 InSectionIndex) const
 {
 	if (MaterialSlots.size() <= InSectionIndex)
@@ -1,8 +1,11 @@
 ﻿#pragma once
 #include "PrimitiveComponent.h"
+#include "CachedMeshDrawCommand.h"
+#include "MeshLODStats.h"
 #include "UMeshComponent.generated.h"
 
 class UShader;
+class FSceneView;
 
 UCLASS(DisplayName="메시 컴포넌트", Description="지오메트리 데이터를 렌더링하는 컴포넌트입니다")
 class UMeshComponent : public UPrimitiveComponent
@@ -58,9 +61,31 @@ protected:
 
     TArray<UMaterialInstanceDynamic*> DynamicMaterialInstances;
 
+    // 뷰 모드 매크로 조합별로 캐시된 섹션 드로우 커맨드 (CollectMeshBatches에서 재사용)
+    FCachedMeshDrawCommandSet CachedDrawCommands;
+
 // Shadow Section
 public:
     bool IsCastShadows() const { return bCastShadows; }
 
+// LOD Section
+public:
+    // 마지막 CollectMeshBatches에서 고른 LOD (STAT LOD 집계용)
+    const FMeshLODSelection& GetLastLODSelection() const { return LastLODSelection; }
+
+protected:
+    /**
+     * @brief 뷰에서 본 화면 크기(경계 구 반지름 * max(P00, P11) / 거리)로 LOD 선택
+     * @param ScreenSizes LOD별 전환 화면 크기 (NumLODs개, 화면 크기가 ScreenSizes[i]보다 작으면 LOD i 이상)
+     * @details 직전 LOD보다 낮은 LOD로는 경계의 (1 - LODHysteresis)배, 높은 LOD로는 (1 + LODHysteresis)배를 넘어야 전환해
+     * 경계 근처에서 LOD가 깜빡이지 않게 한다. 직전 LOD는 FSceneViewState에 뷰별로 두므로 같은 프레임에
+     * 같은 뷰로 여러 번(그림자 패스, 불투명 패스) 불러도 결과가 같다. RenderSettings의 ForcedLOD가 있으면 그 LOD를 쓴다.
+     */
+    int32 SelectLOD(const FSceneView* View, const TArray<float>& ScreenSizes, int32 NumLODs);
+
+    static constexpr float LODHysteresis = 0.1f;
+
+    FMeshLODSelection LastLODSelection;
+
 private:
 };
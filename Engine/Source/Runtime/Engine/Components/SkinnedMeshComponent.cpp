@@ -3,6 +3,8 @@
 #include "MeshBatchElement.h"
 #include "PlatformTime.h"
 #include "SceneView.h"
+#include "Hash.h"
+#include "MeshLODStats.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
@@ -16,6 +18,7 @@ USkinnedMeshComponent::~USkinnedMeshComponent()
       VertexBuffer->Release();
       VertexBuffer = nullptr;
    }
+   ReleaseLODVertexBuffers();
 }
 
 void USkinnedMeshComponent::BeginPlay()
@@ -69,6 +72,10 @@ void USkinnedMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle
 void USkinnedMeshComponent::DuplicateSubObjects()
 {
    Super::DuplicateSubObjects();
+
+   // 얕은 복사된 LOD VB는 원본 소유이므로 해제하지 않고 비움 (처음 그릴 때 다시 생성)
+   LODVertexBuffers.Empty();
+   SkinnedLODMask = 0;
    if (SkeletalMesh)
    {
       SkeletalMesh->CreateVertexBufferForComp(&VertexBuffer);
@@ -81,16 +88,54 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
 
 	bool bIsGPUSkinning = View->RenderSettings->GetSkinningMode() == ESkinningMode::GPU;
 
-	if (!bIsGPUSkinning && bSkinningMatricesDirty)
-	{
-		TIME_PROFILE(SKINNING_CPU_TASK)
+	// 화면 크기로 LOD를 고르고 해당 LOD의 버퍼/섹션으로 그림 (섹션 수와 순서는 LOD끼리 같음)
+	const int32 LODIndex = SelectLOD(View, SkeletalMesh->GetLODScreenSizes(), SkeletalMesh->GetNumLODs());
+	LastLODSelection.LODIndex = LODIndex;
+	LastLODSelection.NumTriangles = SkeletalMesh->GetLODIndexCount(LODIndex) / 3;
+	LastLODSelection.NumBaseTriangles = SkeletalMesh->GetIndexCount() / 3;
 
-		PerformSkinning();
-		SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, VertexBuffer);
-		bSkinningMatricesDirty = false;
+	if (!bIsGPUSkinning)
+	{
+		// 행렬이 바뀌면 모든 LOD의 결과가 무효, LOD별로 처음 그릴 때 한 번만 스키닝
+		if (bSkinningMatricesDirty)
+		{
+			SkinnedLODMask = 0;
+			bSkinningMatricesDirty = false;
+		}
+
+		const uint32 LODBit = 1u << LODIndex;
+		if ((SkinnedLODMask & LODBit) == 0)
+		{
+			TIME_PROFILE(SKINNING_CPU_TASK)
+			FScopeCycleCounter SkinningCounter;
+
+			PerformSkinning(LODIndex);
+			SkeletalMesh->UpdateVertexBuffer(SkinnedVertices, GetCPUSkinningVertexBuffer(LODIndex));
+			SkinnedLODMask |= LODBit;
+
+			FMeshLODStatManager::GetInstance().AddCPUSkinning(static_cast<uint32>(SkinnedVertices.Num()), SkeletalMesh->GetVertexCount(), SkinningCounter.Finish());
+		}
 	}
 
-    const TArray<FGroupInfo>& MeshGroupInfos = SkeletalMesh->GetMeshGroupInfo();
+    const TArray<FGroupInfo>& MeshGroupInfos = SkeletalMesh->GetLODGroupInfos(LODIndex);
+    const bool bHasSections = !MeshGroupInfos.IsEmpty();
+    const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
+
+    // 스키닝 방식과 LOD에 따라 셰이더 변형과 정점/인덱스 버퍼가 달라지므로 캐시 키에 포함
+    // 메시/머티리얼/뷰 모드가 그대로면 캐시된 드로우 커맨드를 복사하고 월드 행렬과 ObjectID만 갱신
+    const uint64 DrawCommandKey = HashCombine(HashCombine(View->ViewShaderMacroKey, bIsGPUSkinning ? 1 : 0), static_cast<uint64>(LODIndex));
+    ID3D11Buffer* MeshVertexBuffer = bIsGPUSkinning ? SkeletalMesh->GetLODVertexBuffer(LODIndex) : GetCPUSkinningVertexBuffer(LODIndex);
+    ID3D11Buffer* MeshIndexBuffer = SkeletalMesh->GetLODIndexBuffer(LODIndex);
+    FCachedMeshDrawCommandList* CachedList = CachedDrawCommands.Find(DrawCommandKey);
+    if (CachedList && CachedList->IsUpToDate(SkeletalMesh, MeshVertexBuffer, MeshIndexBuffer, this, NumSectionsToProcess))
+    {
+       FCachedMeshDrawCommandSet::AppendTo(*CachedList, GetWorldMatrix(), InternalIndex, OutMeshBatchElements);
+       return;
+    }
+
+    CachedList = &CachedDrawCommands.Allocate(DrawCommandKey);
+    CachedList->RecordInputs(SkeletalMesh, MeshVertexBuffer, MeshIndexBuffer, this, NumSectionsToProcess);
+
     auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
     {
        UMaterialInterface* Material = GetMaterial(SectionIndex);
@@ -117,9 +162,6 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        return { Material, Shader };
     };
 
-    const bool bHasSections = !MeshGroupInfos.IsEmpty();
-    const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
-
     for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
     {
        uint32 IndexCount = 0;
@@ -133,7 +175,7 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        }
        else
        {
-          IndexCount = SkeletalMesh->GetIndexCount();
+          IndexCount = SkeletalMesh->GetLODIndexCount(LODIndex);
           StartIndex = 0;
        }
 
@@ -172,19 +214,19 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
 
        BatchElement.Material = MaterialToUse;
 
-       BatchElement.VertexBuffer = bIsGPUSkinning ? SkeletalMesh->GetVertexBuffer() : VertexBuffer;
-       BatchElement.IndexBuffer = SkeletalMesh->GetIndexBuffer();
+       BatchElement.VertexBuffer = MeshVertexBuffer;
+       BatchElement.IndexBuffer = MeshIndexBuffer;
        BatchElement.VertexStride = bIsGPUSkinning ? SkeletalMesh->GetVertexStride() : sizeof(FVertexDynamic);
 
        BatchElement.IndexCount = IndexCount;
        BatchElement.StartIndex = StartIndex;
        BatchElement.BaseVertexIndex = 0;
-       BatchElement.WorldMatrix = GetWorldMatrix();
-       BatchElement.ObjectID = InternalIndex;
        BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-       OutMeshBatchElements.Add(BatchElement);
+       CachedList->Commands.Add(BatchElement);
     }
+
+    FCachedMeshDrawCommandSet::AppendTo(*CachedList, GetWorldMatrix(), InternalIndex, OutMeshBatchElements);
 }
 
 FAABB USkinnedMeshComponent::GetWorldAABB() const
@@ -246,6 +288,7 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
       VertexBuffer->Release();
       VertexBuffer = nullptr;
    }
+   ReleaseLODVertexBuffers();
 
    auto& RM = UResourceManager::GetInstance();
 
@@ -272,6 +315,7 @@ void USkinnedMeshComponent::SetSkeletalMesh(const FString& PathFileName)
             this->VertexBuffer->Release();
             this->VertexBuffer = nullptr;
          }
+         this->ReleaseLODVertexBuffers();
          LoadedMesh->CreateVertexBufferForComp(&this->VertexBuffer);
 
          const TArray<FMatrix> IdentityMatrices(LoadedMesh->GetBoneCount(), FMatrix::Identity());
@@ -334,11 +378,43 @@ void USkinnedMeshComponent::OnSkeletalMeshLoaded()
    // 기본 구현: 파생 클래스에서 오버라이드하여 추가 초기화 수행 (Pose, Cloth 등)
 }
 
-void USkinnedMeshComponent::PerformSkinning()
+ID3D11Buffer* USkinnedMeshComponent::GetCPUSkinningVertexBuffer(int32 LODIndex)
+{
+   if (LODIndex <= 0)
+   {
+      return VertexBuffer;
+   }
+
+   if (LODVertexBuffers.Num() < LODIndex)
+   {
+      LODVertexBuffers.resize(LODIndex, nullptr);
+   }
+   ID3D11Buffer*& LODVertexBuffer = LODVertexBuffers[LODIndex - 1];
+   if (!LODVertexBuffer && SkeletalMesh)
+   {
+      SkeletalMesh->CreateVertexBufferForComp(&LODVertexBuffer, LODIndex);
+   }
+   return LODVertexBuffer;
+}
+
+void USkinnedMeshComponent::ReleaseLODVertexBuffers()
+{
+   for (ID3D11Buffer* LODVertexBuffer : LODVertexBuffers)
+   {
+      if (LODVertexBuffer)
+      {
+         LODVertexBuffer->Release();
+      }
+   }
+   LODVertexBuffers.Empty();
+   SkinnedLODMask = 0;
+}
+
+void USkinnedMeshComponent::PerformSkinning(int32 LODIndex)
 {
    if (!SkeletalMesh || FinalSkinningMatrices.IsEmpty()) { return; }
 
-   const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetSkeletalMeshData()->Vertices;
+   const TArray<FSkinnedVertex>& SrcVertices = SkeletalMesh->GetLODVertices(LODIndex);
    const int32 NumVertices = SrcVertices.Num();
    SkinnedVertices.SetNum(NumVertices);
 
@@ -82,6 +82,15 @@ protected:
 	ID3D11Buffer* VertexBuffer = nullptr;
 	bool bSkinningMatricesDirty = true;
 
+	/**
+	 * @brief LOD1~의 CPU 스키닝 결과 VB (LOD0은 VertexBuffer), 처음 그리는 LOD만 생성
+	*/
+	TArray<ID3D11Buffer*> LODVertexBuffers;
+	/**
+	 * @brief 현재 스키닝 행렬로 VB가 최신인 LOD (비트 i = LOD i), 뷰포트마다 LOD가 달라도 LOD별로 한 번만 스키닝
+	*/
+	uint32 SkinnedLODMask = 0;
+
 
 
 	// GPU Cloth Buffer
@@ -91,7 +100,9 @@ protected:
 
 
 private:
-    void PerformSkinning();
+    void PerformSkinning(int32 LODIndex);
+    ID3D11Buffer* GetCPUSkinningVertexBuffer(int32 LODIndex);
+    void ReleaseLODVertexBuffers();
     FVector SkinVertexPosition(const FSkinnedVertex& InVertex) const;
     FVector SkinVertexNormal(const FSkinnedVertex& InVertex) const;
     FVector4 SkinVertexTangent(const FSkinnedVertex& InVertex) const;
@@ -9,6 +9,7 @@
 #include "MeshBatchElement.h"
 #include "Material.h"
 #include "SceneView.h"
+#include "Hash.h"
 #include "LuaBindHelpers.h"
 #include "Source/Runtime/Engine/PhysicsEngine/BodySetup.h"
 
@@ -48,6 +49,7 @@ void UStaticMeshComponent::OnStaticMeshReleased(UStaticMesh* ReleasedMesh)
 	}
 
 	StaticMesh = nullptr;
+	CachedDrawCommands.Invalidate();
 }
 
 void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
@@ -57,7 +59,30 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		return;
 	}
 
-	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
+	// 화면 크기로 LOD를 고르고 해당 LOD의 버퍼/섹션으로 그림 (섹션 수와 순서는 LOD끼리 같음)
+	const int32 LODIndex = SelectLOD(View, StaticMesh->GetLODScreenSizes(), StaticMesh->GetNumLODs());
+	LastLODSelection.LODIndex = LODIndex;
+	LastLODSelection.NumTriangles = StaticMesh->GetLODIndexCount(LODIndex) / 3;
+	LastLODSelection.NumBaseTriangles = StaticMesh->GetIndexCount() / 3;
+
+	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetLODGroupInfos(LODIndex);
+	const bool bHasSections = !MeshGroupInfos.IsEmpty();
+	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
+
+	// 메시/머티리얼/뷰 모드가 그대로면 캐시된 드로우 커맨드를 복사하고 월드 행렬과 ObjectID만 갱신
+	// LOD마다 버퍼와 섹션 범위가 다르므로 LOD도 캐시 키에 포함
+	const uint64 DrawCommandKey = HashCombine(View->ViewShaderMacroKey, static_cast<uint64>(LODIndex));
+	ID3D11Buffer* MeshVertexBuffer = StaticMesh->GetLODVertexBuffer(LODIndex);
+	ID3D11Buffer* MeshIndexBuffer = StaticMesh->GetLODIndexBuffer(LODIndex);
+	FCachedMeshDrawCommandList* CachedList = CachedDrawCommands.Find(DrawCommandKey);
+	if (CachedList && CachedList->IsUpToDate(StaticMesh, MeshVertexBuffer, MeshIndexBuffer, this, NumSectionsToProcess))
+	{
+		FCachedMeshDrawCommandSet::AppendTo(*CachedList, GetWorldMatrix(), InternalIndex, OutMeshBatchElements);
+		return;
+	}
+
+	CachedList = &CachedDrawCommands.Allocate(DrawCommandKey);
+	CachedList->RecordInputs(StaticMesh, MeshVertexBuffer, MeshIndexBuffer, this, NumSectionsToProcess);
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
 		{
@@ -85,9 +110,6 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			return { Material, Shader };
 		};
 
-	const bool bHasSections = !MeshGroupInfos.IsEmpty();
-	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
-
 	for (uint32 SectionIndex = 0; SectionIndex < NumSectionsToProcess; ++SectionIndex)
 	{
 		uint32 IndexCount = 0;
@@ -102,7 +124,7 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 		else
 		{
-			IndexCount = StaticMesh->GetIndexCount();
+			IndexCount = StaticMesh->GetLODIndexCount(LODIndex);
 			StartIndex = 0;
 		}
 
@@ -133,21 +155,34 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			BatchElement.InputLayout = ShaderVariant->InputLayout;
 		}
 
+		// 자동 인스턴싱용 변형 (월드 행렬/ObjectID를 인스턴스 버퍼에서 읽음), UberLit만 지원
+		if (ShaderVariant && ShaderToUse->GetFilePath() == "Shaders/Materials/UberLit.hlsl")
+		{
+			TArray<FShaderMacro> InstancedMacros = ShaderMacros;
+			InstancedMacros.Add(FShaderMacro{ "MESH_INSTANCING", "1" });
+			if (FShaderVariant* InstancedVariant = ShaderToUse->GetOrCompileShaderVariant(InstancedMacros))
+			{
+				BatchElement.InstancedVertexShader = InstancedVariant->VertexShader;
+				BatchElement.InstancedPixelShader = InstancedVariant->PixelShader;
+				BatchElement.InstancedInputLayout = InstancedVariant->InputLayout;
+			}
+		}
+
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
 		BatchElement.Material = MaterialToUse;
-		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
-		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
+		BatchElement.VertexBuffer = MeshVertexBuffer;
+		BatchElement.IndexBuffer = MeshIndexBuffer;
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
 		BatchElement.IndexCount = IndexCount;
 		BatchElement.StartIndex = StartIndex;
 		BatchElement.BaseVertexIndex = 0;
-		BatchElement.WorldMatrix = GetWorldMatrix();
-		BatchElement.ObjectID = InternalIndex;
 		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-		OutMeshBatchElements.Add(BatchElement);
+		CachedList->Commands.Add(BatchElement);
 	}
+
+	FCachedMeshDrawCommandSet::AppendTo(*CachedList, GetWorldMatrix(), InternalIndex, OutMeshBatchElements);
 }
 
 void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
@@ -7,6 +7,8 @@
 #include <ObjManager.h>
 #include "ClothManager.h"
 #include "AsyncLoader.h"
+#include "TaskScheduler.h"
+#include "ParticleEmitterInstancePool.h"
 
 #include "MiniDump.h"
 
@@ -276,6 +278,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     // Audio Device 초기화
     FAudioDevice::Initialize();
 
+    // 프레임 내 병렬 작업(배치 쿼리, 컬링 등)용 워커 풀
+    FTaskScheduler::Get().Initialize();
+
     //매니저 초기화
     UI.Initialize(HWnd, RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
     INPUT.Initialize(HWnd);
@@ -313,6 +318,9 @@ void UEditorEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 파티클 풀 카운터는 모든 월드가 공유하므로 월드 Tick 전에 프레임마다 한 번만 초기화
+    FParticleEmitterInstancePool::GetCounters().ResetFrame();
+
     //@TODO: Delta Time 계산 + EditorActor Tick은 어떻게 할 것인가
     for (auto& WorldContext : WorldContexts)
     {
@@ -446,6 +454,9 @@ void UEditorEngine::Shutdown()
     // 비동기 로더를 먼저 종료해야 워커 스레드가 리소스 접근 중 크래시 방지
     UResourceManager::GetInstance().Clear();
 
+    // 워커가 월드 데이터에 접근 중일 수 있으므로 월드 삭제 전에 종료
+    FTaskScheduler::Get().Shutdown();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
@@ -6,6 +6,8 @@
 #include "PlayerCameraManager.h"
 #include <ObjManager.h>
 #include "FAudioDevice.h"
+#include "TaskScheduler.h"
+#include "ParticleEmitterInstancePool.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -183,6 +185,9 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     // Initialize audio device for game runtime
     FAudioDevice::Initialize();
 
+    // 프레임 내 병렬 작업(배치 쿼리, 컬링 등)용 워커 풀
+    FTaskScheduler::Get().Initialize();
+
     // 뷰포트 생성
     GameViewport = std::make_unique<FViewport>();
     if (!GameViewport->Initialize(0, 0, ClientWidth, ClientHeight, GetRHIDevice()->GetDevice()))
@@ -229,6 +234,9 @@ void UGameEngine::Tick(float DeltaSeconds)
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 파티클 풀 카운터는 모든 월드가 공유하므로 월드 Tick 전에 프레임마다 한 번만 초기화
+    FParticleEmitterInstancePool::GetCounters().ResetFrame();
+
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
@@ -322,6 +330,9 @@ void UGameEngine::MainLoop()
 
 void UGameEngine::Shutdown()
 {
+    // 워커가 월드 데이터에 접근 중일 수 있으므로 월드 삭제 전에 종료
+    FTaskScheduler::Get().Shutdown();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
@@ -27,6 +27,7 @@
 #include "Frustum.h"
 #include "Level.h"
 #include "LightManager.h"
+#include "Scene.h"
 #include "LuaManager.h"
 #include "VehicleActor.h"
 #include "SkeletalMeshComponent.h"
@@ -43,9 +44,26 @@
 #include "SkySphereActor.h"
 #include "ClothManager.h"
 #include "GameModeBase.h"
+#include "ParticleSimulationManager.h"
 
 IMPLEMENT_CLASS(UWorld)
 
+namespace
+{
+	// 게임 스레드에서만 갱신/조회한다
+	uint64 GSceneStructureRevision = 1;
+}
+
+uint64 UWorld::GetSceneStructureRevision()
+{
+	return GSceneStructureRevision;
+}
+
+void UWorld::MarkSceneStructureDirty()
+{
+	++GSceneStructureRevision;
+}
+
 UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based on world type
 {
 	SelectionMgr = std::make_unique<USelectionManager>();
@@ -53,7 +71,9 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	Level = std::make_unique<ULevel>();
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
+	Scene = std::make_unique<FScene>(this);
 	LuaManager = std::make_unique<FLuaManager>();
+	ParticleSimulation = std::make_unique<FParticleSimulationManager>(this);
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -298,6 +318,13 @@ void UWorld::Tick(float DeltaSeconds)
 		}
     }
 
+	// 파티클 시뮬레이션 단계: 액터 Tick에서 등록된 파티클 시스템의 에미터를 워커에서 병렬로 시뮬레이션
+	// 반환 시점(동기화 지점)에 모든 결과가 준비되므로 이후 Lua/렌더러는 이번 프레임 결과를 본다
+	if (ParticleSimulation)
+	{
+		ParticleSimulation->Simulate();
+	}
+
 	// Lua 코루틴 전용 Tick
 	if (LuaManager && bPie)
 	{
@@ -435,6 +462,8 @@ bool UWorld::DestroyActor(AActor* Actor)
 {
 	if (!Actor) return false;
 
+	MarkSceneStructureDirty();
+
 	// 선택/UI 해제
 	if (SelectionMgr) SelectionMgr->DeselectActor(Actor);
 
@@ -546,6 +575,8 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     // Make UI/selection safe before destroying previous actors
     if (SelectionMgr) SelectionMgr->ClearSelection();
 
+	MarkSceneStructureDirty();
+
 	PlayerCameraManager = nullptr;
 
     // Cleanup current
@@ -596,6 +627,7 @@ void UWorld::AddActorToLevel(AActor* Actor)
 	if (Level)
 	{
 		Level->AddActor(Actor);
+		MarkSceneStructureDirty();
 
 		Actor->SetWorld(this);
 
@@ -13,6 +13,7 @@ class UUIManager;
 class UInputManager;
 class USelectionManager;
 class FLuaManager;
+class FParticleSimulationManager;
 class AActor;
 class URenderer;
 class ACameraActor;
@@ -28,6 +29,7 @@ class BVHierachy;
 class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
+class FScene;
 
 struct FTransform;
 struct FSceneCompData;
@@ -100,6 +102,10 @@ public:
     const FString& GetLevelName() const { return LevelName; }
     FLightManager* GetLightManager() const { return LightManager.get(); }
     FLuaManager* GetLuaManager() const { return LuaManager.get(); }
+    // 액터 Tick 뒤 파티클 에미터를 병렬로 시뮬레이션하는 단계
+    FParticleSimulationManager* GetParticleSimulation() const { return ParticleSimulation.get(); }
+    // 렌더러가 매 프레임 순회하는 타입별 리테인드 프록시 목록
+    FScene* GetScene() const { return Scene.get(); }
 
     ACameraActor* GetEditorCameraActor() { return MainEditorCameraActor; }
     void SetEditorCameraActor(ACameraActor* InCamera);
@@ -155,6 +161,15 @@ public:
     void RequestSlomo(float Duration, float Dilation = 0.0f);
 
 	void SetTimeDilation(float NewDilation) { TimeDilation = NewDilation; }
+
+    /**
+     * @brief 액터/컴포넌트 구성이 바뀔 때마다 증가하는 전역 리비전
+     * @details 렌더러가 월드 단위 프록시 수집 결과를 같은 프레임의 여러 뷰포트에서 공유할 때,
+     *          수집 이후 액터/컴포넌트가 추가·삭제되었는지 판별하는 키로 사용한다.
+     *          모든 월드가 하나의 카운터를 공유하므로 해제된 월드 주소가 재사용되어도 잘못 일치하지 않는다.
+     */
+    static uint64 GetSceneStructureRevision();
+    static void MarkSceneStructureDirty();
 private:
     bool DestroyActor(AActor* Actor);   // 즉시 삭제
 
@@ -174,8 +189,14 @@ private:
     /** === 라이트 매니저 ===*/
     std::unique_ptr<FLightManager> LightManager;
 
+    /** === 렌더 씬 ===*/
+    std::unique_ptr<FScene> Scene;
+
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
+
+    /** === 파티클 시뮬레이션 단계 ===*/
+    std::unique_ptr<FParticleSimulationManager> ParticleSimulation;
     
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
@@ -12,8 +12,17 @@
 
 IMPLEMENT_CLASS(UWorldPartitionManager)
 
+namespace
+{
+	// 모든 파티션 매니저가 공유하는 가시성 리비전 카운터 (월드가 바뀌어도 리비전이 재사용되지 않도록)
+	uint64 GVisibilityRevisionCounter = 0;
+}
+
 UWorldPartitionManager::UWorldPartitionManager()
 {
+	VisibilityRevision = ++GVisibilityRevisionCounter;
+	VisibilityLogBaseRevision = VisibilityRevision;
+
 	//FBound WorldBounds(FVector(-50, -50, -50), FVector(50, 50, 50));
 	FAABB WorldBounds(FVector(-50, -50, -50), FVector(50, 50, 50));
 	SceneOctree = new FOctree(WorldBounds, 0, 8, 10);
@@ -44,6 +53,11 @@ void UWorldPartitionManager::Clear()
 
 	ComponentDirtyQueue.Empty();
 	ComponentDirtySet.Empty();
+
+	// 기록을 비우고 기준 리비전을 올려 모든 뷰의 가시성 캐시를 무효화
+	VisibilityChangeLog.Empty();
+	VisibilityRevision = ++GVisibilityRevisionCounter;
+	VisibilityLogBaseRevision = VisibilityRevision;
 }
 
 // 새로 만들어진 StaticMeshComponent를 등록하는 상황에서 맥락을 분명히 드러내기 위한 API입니다.
@@ -73,6 +87,7 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 			{
 				StaticMeshComponents.push_back(Smc);
 				ComponentDirtySet.erase(Smc);
+				RecordVisibilityChange(Smc);
 			}
 		}
 	}
@@ -87,6 +102,7 @@ void UWorldPartitionManager::Unregister(UPrimitiveComponent* Component)
 		if (BVH) BVH->Remove(Smc);
 
 		ComponentDirtySet.erase(Smc);
+		RecordVisibilityChange(Smc);
 	}
 }
 
@@ -123,6 +139,9 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 		return;
 	}
 
+	// BVH 갱신은 Update에서 예산만큼 나눠 처리되지만, 가시성 캐시는 이번 프레임에 바로 무효화
+	RecordVisibilityChange(Smc);
+
 	// second: 새로운 요소가 성공적으로 삽입되었으면 true, 이미 요소가 존재하여 삽입에 실패했으면 false
 	// DirtyQueue 중복 삽입 방지 로직
 	if (ComponentDirtySet.insert(Smc).second)
@@ -161,6 +180,40 @@ void UWorldPartitionManager::Update(float DeltaTime, const uint32 BudgetCount)
 	}
 }
 
+bool UWorldPartitionManager::GetVisibilityChangesSince(uint64 SinceRevision, OUT TArray<UPrimitiveComponent*>& OutComponents) const
+{
+	OutComponents.Empty();
+	if (SinceRevision < VisibilityLogBaseRevision)
+	{
+		return false;
+	}
+
+	// 최신 기록부터 거슬러 올라가며 SinceRevision 이후 항목만 수집
+	for (int32 i = VisibilityChangeLog.Num() - 1; i >= 0; --i)
+	{
+		if (VisibilityChangeLog[i].first <= SinceRevision)
+		{
+			break;
+		}
+		OutComponents.Add(VisibilityChangeLog[i].second);
+	}
+	return true;
+}
+
+void UWorldPartitionManager::RecordVisibilityChange(UPrimitiveComponent* Component)
+{
+	if (VisibilityChangeLog.Num() >= MaxVisibilityChangeLog)
+	{
+		// 오래된 절반을 버리고, 그 이전 리비전을 캐시한 뷰는 전체 재컬링하도록 기준 리비전을 올림
+		const int32 NumDropped = MaxVisibilityChangeLog / 2;
+		VisibilityLogBaseRevision = VisibilityChangeLog[NumDropped - 1].first;
+		VisibilityChangeLog.erase(VisibilityChangeLog.begin(), VisibilityChangeLog.begin() + NumDropped);
+	}
+
+	VisibilityRevision = ++GVisibilityRevisionCounter;
+	VisibilityChangeLog.Add({ VisibilityRevision, Component });
+}
+
 //void UWorldPartitionManager::RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates)
 //{
 //    if (SceneOctree)
@@ -182,6 +235,65 @@ void UWorldPartitionManager::RayQueryClosest(FRay InRay, OUT AActor*& OutActor,
 	}
 }
 
+void UWorldPartitionManager::RayQueryBatch(const TArray<FBVHRayQuery>& Queries, OUT TArray<FBVHRayHit>& OutHits, EBVHRayQueryMode Mode)
+{
+	if (!BVH)
+	{
+		OutHits.SetNum(Queries.Num());
+		for (FBVHRayHit& Hit : OutHits)
+		{
+			Hit = FBVHRayHit();
+		}
+		return;
+	}
+	BVH->QueryRayBatch(Queries, OutHits, Mode);
+}
+
+int32 UWorldPartitionManager::OverlapShape(const FBVHShapeQuery& Query, UPrimitiveComponent** OutComponents, int32 MaxResults)
+{
+	return BVH ? BVH->OverlapShape(Query, OutComponents, MaxResults) : 0;
+}
+
+bool UWorldPartitionManager::SweepShape(const FBVHShapeQuery& Query, OUT FBVHSweepHit& OutHit)
+{
+	if (!BVH)
+	{
+		OutHit = FBVHSweepHit();
+		return false;
+	}
+	return BVH->SweepShape(Query, OutHit);
+}
+
+void UWorldPartitionManager::OverlapShapeBatch(const TArray<FBVHShapeQuery>& Queries, int32 MaxResultsPerQuery,
+	OUT TArray<UPrimitiveComponent*>& OutComponents, OUT TArray<int32>& OutCounts)
+{
+	if (!BVH)
+	{
+		OutComponents.Empty();
+		OutCounts.SetNum(Queries.Num());
+		for (int32& Count : OutCounts)
+		{
+			Count = 0;
+		}
+		return;
+	}
+	BVH->OverlapShapeBatch(Queries, MaxResultsPerQuery, OutComponents, OutCounts);
+}
+
+void UWorldPartitionManager::SweepShapeBatch(const TArray<FBVHShapeQuery>& Queries, OUT TArray<FBVHSweepHit>& OutHits)
+{
+	if (!BVH)
+	{
+		OutHits.SetNum(Queries.Num());
+		for (FBVHSweepHit& Hit : OutHits)
+		{
+			Hit = FBVHSweepHit();
+		}
+		return;
+	}
+	BVH->SweepShapeBatch(Queries, OutHits);
+}
+
 void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
 {
 	if (BVH)
@@ -0,0 +1,111 @@
+#include "pch.h"
+#include "ParticleModuleCollision.h"
+#include "ParticleEmitterInstance.h"
+
+UParticleModuleCollision::UParticleModuleCollision()
+{
+	// 충돌 횟수 Payload는 스폰 시 0으로 초기화되므로 Spawn/Update가 필요 없음
+	bSpawnModule = false;
+	bUpdateModule = false;
+	bFinalUpdateModule = false;
+}
+
+uint32 UParticleModuleCollision::RequiredBytes(UParticleModuleTypeDataBase* TypeData)
+{
+	return sizeof(FParticleCollisionPayload);
+}
+
+int32 UParticleModuleCollision::GetPayloadOffset(const FParticleEmitterInstance* Owner) const
+{
+	if (!Owner || !Owner->CurrentLODLevel)
+	{
+		return INDEX_NONE;
+	}
+
+	// ParticleStride를 계산할 때와 같은 모듈 목록으로 나머지 모듈의 Payload 크기 합산
+	int32 Offset = Owner->PayloadOffset;
+	for (UParticleModule* Module : Owner->CurrentLODLevel->Modules)
+	{
+		if (Module && Module != this)
+		{
+			Offset += static_cast<int32>(Module->RequiredBytes(Owner->CurrentLODLevel->TypeDataModule));
+		}
+	}
+
+	if (Offset + static_cast<int32>(sizeof(FParticleCollisionPayload)) > Owner->ParticleStride)
+	{
+		return INDEX_NONE;
+	}
+	return Offset;
+}
+
+UParticleModuleCollision* UParticleModuleCollision::Find(const FParticleEmitterInstance* Owner)
+{
+	if (!Owner || !Owner->CurrentLODLevel)
+	{
+		return nullptr;
+	}
+
+	for (UParticleModule* Module : Owner->CurrentLODLevel->Modules)
+	{
+		UParticleModuleCollision* Collision = Cast<UParticleModuleCollision>(Module);
+		if (Collision && Collision->IsEnabled() && Collision->IsValidForLODLevel(Owner->CurrentLODLevelIndex))
+		{
+			return Collision;
+		}
+	}
+	return nullptr;
+}
+
+void UParticleModuleCollision::Serialize(bool bIsLoading, JSON& InOutHandle)
+{
+	UParticleModule::Serialize(bIsLoading, InOutHandle);
+
+	if (bIsLoading)
+	{
+		if (InOutHandle.hasKey("Response")) Settings.Response = static_cast<EParticleCollisionResponse>(InOutHandle["Response"].ToInt());
+		if (InOutHandle.hasKey("Restitution")) Settings.Restitution = static_cast<float>(InOutHandle["Restitution"].ToFloat());
+		if (InOutHandle.hasKey("Friction")) Settings.Friction = static_cast<float>(InOutHandle["Friction"].ToFloat());
+		if (InOutHandle.hasKey("RadiusScale")) Settings.RadiusScale = static_cast<float>(InOutHandle["RadiusScale"].ToFloat());
+		if (InOutHandle.hasKey("MaxCollisions")) Settings.MaxCollisions = static_cast<int32>(InOutHandle["MaxCollisions"].ToInt());
+		if (InOutHandle.hasKey("CollisionCompletion")) Settings.CollisionCompletion = static_cast<EParticleCollisionComplete>(InOutHandle["CollisionCompletion"].ToInt());
+		if (InOutHandle.hasKey("MaxQueriesPerFrame")) Settings.MaxQueriesPerFrame = static_cast<int32>(InOutHandle["MaxQueriesPerFrame"].ToInt());
+		if (InOutHandle.hasKey("bGenerateEvents")) Settings.bGenerateEvents = InOutHandle["bGenerateEvents"].ToBool();
+		if (InOutHandle.hasKey("MaxEventsPerFrame")) Settings.MaxEventsPerFrame = static_cast<int32>(InOutHandle["MaxEventsPerFrame"].ToInt());
+		if (InOutHandle.hasKey("Mode")) Settings.Mode = static_cast<EParticleCollisionMode>(InOutHandle["Mode"].ToInt());
+		if (InOutHandle.hasKey("HeightFieldResolution")) Settings.HeightFieldResolution = static_cast<int32>(InOutHandle["HeightFieldResolution"].ToInt());
+		if (InOutHandle.hasKey("HeightFieldCellSize")) Settings.HeightFieldCellSize = static_cast<float>(InOutHandle["HeightFieldCellSize"].ToFloat());
+		if (InOutHandle.hasKey("HeightFieldTraceHeight")) Settings.HeightFieldTraceHeight = static_cast<float>(InOutHandle["HeightFieldTraceHeight"].ToFloat());
+		if (InOutHandle.hasKey("HeightFieldRefreshInterval")) Settings.HeightFieldRefreshInterval = static_cast<float>(InOutHandle["HeightFieldRefreshInterval"].ToFloat());
+	}
+	else
+	{
+		InOutHandle["Response"] = static_cast<int32>(Settings.Response);
+		InOutHandle["Restitution"] = Settings.Restitution;
+		InOutHandle["Friction"] = Settings.Friction;
+		InOutHandle["RadiusScale"] = Settings.RadiusScale;
+		InOutHandle["MaxCollisions"] = Settings.MaxCollisions;
+		InOutHandle["CollisionCompletion"] = static_cast<int32>(Settings.CollisionCompletion);
+		InOutHandle["MaxQueriesPerFrame"] = Settings.MaxQueriesPerFrame;
+		InOutHandle["bGenerateEvents"] = Settings.bGenerateEvents;
+		InOutHandle["MaxEventsPerFrame"] = Settings.MaxEventsPerFrame;
+		InOutHandle["Mode"] = static_cast<int32>(Settings.Mode);
+		InOutHandle["HeightFieldResolution"] = Settings.HeightFieldResolution;
+		InOutHandle["HeightFieldCellSize"] = Settings.HeightFieldCellSize;
+		InOutHandle["HeightFieldTraceHeight"] = Settings.HeightFieldTraceHeight;
+		InOutHandle["HeightFieldRefreshInterval"] = Settings.HeightFieldRefreshInterval;
+	}
+}
+
+void UParticleModuleCollision::DuplicateFrom(const UParticleModule* Source)
+{
+	UParticleModule::DuplicateFrom(Source);
+
+	const UParticleModuleCollision* SrcCollision = static_cast<const UParticleModuleCollision*>(Source);
+	if (!SrcCollision)
+	{
+		return;
+	}
+
+	Settings = SrcCollision->Settings;
+}
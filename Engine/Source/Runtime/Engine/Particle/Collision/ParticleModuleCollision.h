@@ -0,0 +1,43 @@
+#pragma once
+#include "ParticleModule.h"
+#include "ParticleTypes.h"
+#include "ParticleCollision.h"
+
+#include "UParticleModuleCollision.generated.h"
+
+/**
+ * @brief 파티클을 씬 지오메트리와 충돌시키는 모듈
+ * @details 모듈 자체는 설정과 Payload(충돌 횟수)만 가진다. 실제 충돌은 에미터 시뮬레이션이 끝난 뒤
+ *          FParticleCollisionSolver가 모든 충돌 에미터를 모아 파티션 BVH에 배치 쿼리로 처리한다.
+ *
+ * @param Settings 충돌 반응/쿼리 예산/높이장 설정 (FParticleCollisionSettings)
+ */
+UCLASS()
+class UParticleModuleCollision :
+	public UParticleModule
+{
+	GENERATED_REFLECTION_BODY()
+
+public:
+	UParticleModuleCollision();
+	~UParticleModuleCollision() override = default;
+
+	// Serialize/Duplicate
+	void Serialize(bool bIsLoading, JSON& InOutHandle) override;
+	void DuplicateFrom(const UParticleModule* Source) override;
+
+	// Payload 크기 반환 (FParticleCollisionPayload 크기)
+	uint32 RequiredBytes(UParticleModuleTypeDataBase* TypeData) override;
+
+	FParticleCollisionSettings Settings;
+
+	/**
+	 * 인스턴스 안에서 이 모듈의 Payload 오프셋 (AoS 파티클 기준)
+	 * @details 다른 Payload 모듈들이 모두 PayloadOffset부터 쓰므로 겹치지 않도록 그 뒤에 둔다.
+	 * @return 파티클 Stride 안에 자리가 없으면 INDEX_NONE
+	 */
+	int32 GetPayloadOffset(const FParticleEmitterInstance* Owner) const;
+
+	/** 에미터 인스턴스의 현재 LOD에서 켜져 있는 충돌 모듈 (없으면 nullptr) */
+	static UParticleModuleCollision* Find(const FParticleEmitterInstance* Owner);
+};
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleColor.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleColor::UParticleModuleColor()
 	: StartColor(FLinearColor(1.0f, 1.0f, 1.0f, 1.0f))
@@ -19,10 +20,10 @@ void UParticleModuleColor::Spawn(FParticleEmitterInstance* Owner, int32 Offset,
 	}
 
 	// 색상 설정
-	FLinearColor Color = StartColor.GetValue();
+	FLinearColor Color = StartColor.GetValue(Owner->RandomStream);
 
 	// 알파 별도 설정
-	float Alpha = StartAlpha.GetValue();
+	float Alpha = StartAlpha.GetValue(Owner->RandomStream);
 	if (bClampAlpha)
 	{
 		Alpha = std::max(0.0f, std::min(1.0f, Alpha));
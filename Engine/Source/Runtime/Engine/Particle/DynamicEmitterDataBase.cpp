@@ -13,84 +13,91 @@
 #include "Source/Runtime/AssetManagement/ResourceManager.h"
 #include "Source/Runtime/Renderer/Material.h"
 
-void FDynamicSpriteEmitterDataBase::SortSpriteParticles(EParticleSortMode SortMode, bool bLocalSpace,
-	int32 ParticleCount, const uint8* ParticleData, int32 ParticleStride, const uint16* ParticleIndices,
-	const FSceneView* View, const FMatrix& LocalToWorld, FParticleOrder* ParticleOrder) const
+#include <immintrin.h> // For SSE
+
+namespace
 {
+	// 쿼드 하나 = FParticleSpriteVertex 4개 = 288바이트 = float 72개 = SSE 레지스터 18개
+	constexpr int32 SpriteQuadFloats = sizeof(FParticleSpriteVertex) * 4 / sizeof(float);
+	constexpr int32 MeshInstanceFloats = sizeof(FMeshParticleInstanceVertex) / sizeof(float);
+	static_assert(sizeof(FParticleSpriteVertex) == 72, "스프라이트 쿼드 SSE 기록은 72바이트 정점 레이아웃을 가정");
+	static_assert(sizeof(FMeshParticleInstanceVertex) == 96, "메시 인스턴스 SSE 기록은 96바이트 레이아웃을 가정");
 
-	if (SortMode == EParticleSortMode::ViewProjDepth)
+	bool IsAligned16(const void* Ptr)
 	{
-		for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ParticleIndex++)
-		{
-			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[ParticleIndex]);
-			float InZ;
-			if (bLocalSpace)
-			{
-				InZ = View->GetViewProjectionMatrix().TransformPositionVector4(LocalToWorld.TransformPosition(Particle.Location)).W;
-			}
-			else
-			{
-				InZ = View->GetViewProjectionMatrix().TransformPositionVector4(Particle.Location).W;
-			}
-			ParticleOrder[ParticleIndex].ParticleIndex = ParticleIndex;
+		return (reinterpret_cast<uintptr_t>(Ptr) & 15) == 0;
+	}
 
-			ParticleOrder[ParticleIndex].Z = InZ;
+	// 맵한 업로드 메모리는 다시 읽지 않으므로 캐시를 거치지 않는 스트리밍 저장 (정렬되지 않았으면 일반 저장)
+	inline void StoreVector(float* Dst, __m128 Value, bool bStream)
+	{
+		if (bStream)
+		{
+			_mm_stream_ps(Dst, Value);
 		}
-		std::sort(ParticleOrder, ParticleOrder + ParticleCount, [](const FParticleOrder& A, const FParticleOrder& B)
+		else
 		{
-			return A.Z > B.Z;
-		}); // 내림차순 정렬
+			_mm_storeu_ps(Dst, Value);
+		}
 	}
-	else if (SortMode == EParticleSortMode::DistanceToView)
+
+	// 동적 버퍼를 WRITE_DISCARD로 맵 (이전 프레임 내용은 버림)
+	void* MapDiscard(ID3D11Buffer* Buffer)
 	{
-		for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ParticleIndex++)
+		ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
+		if (!Context || !Buffer)
 		{
-			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[ParticleIndex]);
-			float InZ;
-			FVector Position;
-			if (bLocalSpace)
-			{
-				Position = LocalToWorld.TransformPosition(Particle.Location);
-			}
-			else
-			{
-				Position = Particle.Location;
-			}
-			InZ = (View->ViewLocation - Position).SizeSquared();
-			ParticleOrder[ParticleIndex].ParticleIndex = ParticleIndex;
-			ParticleOrder[ParticleIndex].Z = InZ;
+			return nullptr;
 		}
-		std::sort(ParticleOrder, ParticleOrder + ParticleCount, [](const FParticleOrder& A, const FParticleOrder& B)
+
+		D3D11_MAPPED_SUBRESOURCE MappedResource;
+		if (FAILED(Context->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource)))
 		{
-			return A.Z > B.Z;
-		}); // 내림차순 정렬
+			return nullptr;
+		}
+		return MappedResource.pData;
 	}
-	else if (SortMode == EParticleSortMode::Age_OldestFirst)
+
+	void Unmap(ID3D11Buffer* Buffer)
 	{
-		for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ParticleIndex++)
+		if (ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext())
 		{
-			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[ParticleIndex]);
-			ParticleOrder[ParticleIndex].ParticleIndex = ParticleIndex;
-			ParticleOrder[ParticleIndex].C = Particle.Flags & STATE_CounterMask;
+			Context->Unmap(Buffer, 0);
 		}
-		std::sort(ParticleOrder, ParticleOrder + ParticleCount, [](const FParticleOrder& A, const FParticleOrder& B)
-		{
-			return A.C > B.C;
-		}); // 내림차순 정렬
 	}
-	else if (SortMode == EParticleSortMode::Age_NewestFirst)
+}
+
+int32 FDynamicEmitterDataBase::AcquireRenderData(const FSceneView* View) const
+{
+	int32 NumItems = GeneratedRenderItems;
+	if (NumItems == INDEX_NONE)
 	{
-		for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ParticleIndex++)
+		// 정점 생성기를 거치지 않은 호출: 이 에미터만 여기서 바로 생성
+		NumItems = PrepareRenderData(View);
+		FParticleRenderDataDest Dest;
+		if (NumItems > 0 && MapRenderData(Dest))
 		{
-			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[ParticleIndex]);
-			ParticleOrder[ParticleIndex].ParticleIndex = ParticleIndex;
-			ParticleOrder[ParticleIndex].C = (~Particle.Flags) & STATE_CounterMask;
+			WriteRenderData(Dest, 0, NumItems);
+			UnmapRenderData();
 		}
-		std::sort(ParticleOrder, ParticleOrder + ParticleCount, [](const FParticleOrder& A, const FParticleOrder& B)
+		else
 		{
-			return A.C > B.C;
-		}); // 내림차순 정렬
+			NumItems = 0;
+		}
 	}
+
+	// 정렬/카메라 방향이 들어간 결과는 그린 뷰에서만 유효하므로 소비
+	GeneratedRenderItems = IsRenderDataViewDependent() ? INDEX_NONE : NumItems;
+	return NumItems;
+}
+
+void FDynamicSpriteEmitterDataBase::SortSpriteParticles(EParticleSortMode SortMode, bool bLocalSpace,
+	int32 ParticleCount, const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices,
+	const FSceneView* View, const FMatrix& LocalToWorld, FParticleOrder* ParticleOrder) const
+{
+	// 깊이/거리는 16비트, 나이는 32비트 키로 기수 정렬 (큰 에미터는 워커로 분할)
+	Sorter.Sort(SortMode, bLocalSpace, ParticleCount, ParticleData, ParticleStride, ParticleIndices,
+		View, LocalToWorld, ParticleOrder);
 }
 
 int32 FDynamicSpriteEmitterData::GetDynamicVertexStride() const
@@ -98,64 +105,83 @@ int32 FDynamicSpriteEmitterData::GetDynamicVertexStride() const
 	return sizeof(FParticleSpriteVertex);
 }
 
-void FDynamicSpriteEmitterData::GetDynamicMeshElementsEmitter(
-	TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const
+int32 FDynamicSpriteEmitterData::PrepareRenderData(const FSceneView* View) const
 {
-	// 1. 유효성 검사
+	// 1. 유효성 검사 (GPU 버퍼는 MapRenderData에서 확인)
 	if (!bValid || Source.ActiveParticleCount <= 0)
 	{
-		return;
+		return 0;
 	}
 
 	// 2. Source 데이터 가져오기
 	const FDynamicSpriteEmitterReplayDataBase& SourceData = Source;
-	const int32 ParticleCount = SourceData.MaxDrawCount != 0 ? std::min(SourceData.ActiveParticleCount, SourceData.MaxDrawCount) : SourceData.ActiveParticleCount;
+	const int32 ParticleCount = GetDrawParticleCount(SourceData);
 	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
-	const uint16* ParticleIndices = SourceData.DataContainer.ParticleIndices;
+	const uint32* ParticleIndices = SourceData.DataContainer.ParticleIndices;
 	const int32 ParticleStride = SourceData.ParticleStride;
 
-	if (!ParticleData || !ParticleIndices)
+	if (!ParticleData || !ParticleIndices || ParticleCount <= 0)
 	{
-		return;
+		return 0;
 	}
 
-	// SubUV 설정 가져오기
-	const int32 SubImages_Horizontal = SourceData.SubImages_Horizontal;
-	const int32 SubImages_Vertical = SourceData.SubImages_Vertical;
-	const int32 TotalSubImages = SubImages_Horizontal * SubImages_Vertical;
-	const bool bHasSubUV = (TotalSubImages > 1) && (SourceData.SubUVDataOffset > 0);
-
 	// 3. 파티클 정렬 (필요한 경우)
-	TArray<FParticleOrder> ParticleOrder;
-	ParticleOrder.reserve(ParticleCount);
+	// 정렬 결과 배열은 풀링된 렌더 데이터에 두고 재사용 (늘어날 때만 할당)
+	TArray<FParticleOrder>& ParticleOrder = ParticleOrderScratch;
+	ParticleOrder.SetNum(ParticleCount, FParticleOrder(0, 0.0f));
 
 	// 기본 순서로 초기화
 	for (int32 i = 0; i < ParticleCount; ++i)
 	{
-		ParticleOrder.Add(FParticleOrder(i, 0.0f));
+		ParticleOrder[i].ParticleIndex = i;
 	}
 
-	// 정렬 모드에 따라 정렬 수행
-	if (SourceData.SortMode != EParticleSortMode::None)
-	{
-		FMatrix LocalToWorld = FMatrix::Identity(); // TODO: Get actual LocalToWorld from component
-		bool bLocalSpace = false; // TODO: Get from emitter settings
-		SortSpriteParticles(SourceData.SortMode, bLocalSpace, ParticleCount, 
-			ParticleData, ParticleStride, ParticleIndices, View, LocalToWorld, ParticleOrder.GetData());
-	}
+	// 정렬 모드에 따라 정렬 수행 (None이면 정렬 통계만 0으로 초기화됨)
+	FMatrix LocalToWorld = FMatrix::Identity(); // TODO: Get actual LocalToWorld from component
+	bool bLocalSpace = false; // TODO: Get from emitter settings
+	SortSpriteParticles(SourceData.SortMode, bLocalSpace, ParticleCount, 
+		ParticleData, ParticleStride, ParticleIndices, View, LocalToWorld, ParticleOrder.GetData());
+
+	return ParticleCount;
+}
+
+bool FDynamicSpriteEmitterData::MapRenderData(FParticleRenderDataDest& OutDest) const
+{
+	// 정점 버퍼는 Resize에서 MaxActiveParticles * 4개로 만들어 두므로 그대로 덮어씀
+	OutDest.VertexData = OwnerInstance ? MapDiscard(OwnerInstance->VertexBuffer) : nullptr;
+	OutDest.IndexData = nullptr;
+	return OutDest.VertexData != nullptr;
+}
+
+void FDynamicSpriteEmitterData::UnmapRenderData() const
+{
+	Unmap(OwnerInstance->VertexBuffer);
+}
 
-	// 4. 정점 데이터 생성 (각 파티클당 4개의 정점)
-	const int32 VertexCount = ParticleCount * 4;
-	const int32 IndexCount = ParticleCount * 6; // 2 triangles per quad
+void FDynamicSpriteEmitterData::WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const
+{
+	const FDynamicSpriteEmitterReplayDataBase& SourceData = Source;
+	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
+	const uint32* ParticleIndices = SourceData.DataContainer.ParticleIndices;
+	const int32 ParticleStride = SourceData.ParticleStride;
+	const FParticleOrder* ParticleOrder = ParticleOrderScratch.GetData();
+
+	// SubUV 프레임 (정수부 = 현재 프레임, 소수부 = 다음 프레임과의 보간 인자, 셰이더에서 floor / frac 분리)
+	// Payload 값이 아틀라스 범위를 벗어나도 다른 칸을 샘플링하지 않도록 [0, 전체 프레임 수)로 제한
+	const int32 TotalSubImages = SourceData.SubImages_Horizontal * SourceData.SubImages_Vertical;
+	const bool bHasSubUV = (TotalSubImages > 1) && (SourceData.SubUVDataOffset > 0);
+	const float MaxSubImageIndex = std::nextafter(static_cast<float>(TotalSubImages), 0.0f);
 
-	TArray<FParticleSpriteVertex> Vertices;
-	Vertices.reserve(VertexCount);
+	// 쿼드의 4개 코너 UV (좌상단, 우상단, 좌하단, 우하단), 원본 0~1 범위 (SubUV 계산은 셰이더에서 수행)
+	const __m128 UV0 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 0.0f);
+	const __m128 UV1 = _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	const __m128 UV2 = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f);
+	const __m128 UV3 = _mm_setr_ps(1.0f, 1.0f, 0.0f, 0.0f);
 
-	TArray<uint32> Indices;
-	Indices.reserve(IndexCount);
+	float* Dst = static_cast<float*>(Dest.VertexData) + static_cast<size_t>(Begin) * SpriteQuadFloats;
+	const bool bStream = IsAligned16(Dst);
 
-	// 5. 각 파티클에 대해 쿼드 생성
-	for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ++ParticleIndex)
+	for (int32 ParticleIndex = Begin; ParticleIndex < End; ++ParticleIndex, Dst += SpriteQuadFloats)
 	{
 		// 정렬된 인덱스 사용
 		const int32 SortedParticleIndex = ParticleOrder[ParticleIndex].ParticleIndex;
@@ -169,72 +195,78 @@ void FDynamicSpriteEmitterData::GetDynamicMeshElementsEmitter(
 		{
 			const FSubUVPayloadData* SubUVData = 
 				reinterpret_cast<const FSubUVPayloadData*>(ParticlePtr + SourceData.SubUVDataOffset);
-			SubImageIndex = SubUVData->ImageIndex;
+			SubImageIndex = std::clamp(SubUVData->ImageIndex, 0.0f, MaxSubImageIndex);
 		}
 
-		// 정점 인덱스 계산
-		const int32 BaseVertexIndex = ParticleIndex * 4;
-
-		// UV 좌표 (쿼드의 4개 코너) - 원본 0~1 범위 사용
-		// SubUV 계산은 셰이더에서 수행 (보간 지원을 위해)
-		const FVector2D UVs[4] = {
-			FVector2D(0.0f, 0.0f),  // 좌상단
-			FVector2D(1.0f, 0.0f),  // 우상단
-			FVector2D(0.0f, 1.0f),  // 좌하단
-			FVector2D(1.0f, 1.0f)   // 우하단
-		};
-
-		// 각 코너에 대해 정점 생성
-		for (int32 CornerIndex = 0; CornerIndex < 4; ++CornerIndex)
-		{
-			FParticleSpriteVertex Vertex;
-
-			// 파티클 기본 정보 복사
-			Vertex.Position = Particle.Location;
-			Vertex.OldPosition = Particle.OldLocation;
-			Vertex.RelativeTime = Particle.RelativeTime;
-			Vertex.ParticleId = static_cast<float>(SortedParticleIndex);
-			Vertex.Size = FVector2D(Particle.Size.X, Particle.Size.Y);
-			Vertex.Rotation = Particle.Rotation;
-			Vertex.SubImageIndex = SubImageIndex; // 셰이더에서 SubUV 계산에 사용
-			Vertex.Color = Particle.Color;
-			Vertex.TexCoord = UVs[CornerIndex];  // 원본 UV (0~1 범위)
-
-			Vertices.Add(Vertex);
-		}
+		// 정점 하나 (72바이트 = 레지스터 4.5개)
+		// A: Position | RelativeTime, B: OldPosition | ParticleId, C: Size | Rotation | SubImageIndex, D: Color, 이어서 TexCoord
+		const __m128 A = _mm_setr_ps(Particle.Location.X, Particle.Location.Y, Particle.Location.Z, Particle.RelativeTime);
+		const __m128 B = _mm_setr_ps(Particle.OldLocation.X, Particle.OldLocation.Y, Particle.OldLocation.Z, static_cast<float>(SortedParticleIndex));
+		const __m128 C = _mm_setr_ps(Particle.Size.X, Particle.Size.Y, Particle.Rotation, SubImageIndex);
+		const __m128 D = _mm_loadu_ps(&Particle.Color.R);
+
+		// 홀수 번째 코너는 8바이트 밀려 시작하므로 이웃 레지스터의 뒤/앞 절반을 이어 붙임
+		const __m128 AB = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 BC = _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m128 CD = _mm_shuffle_ps(C, D, _MM_SHUFFLE(1, 0, 3, 2));
+
+		// 좌상단 + 우상단 (0 ~ 143바이트)
+		StoreVector(Dst + 0, A, bStream);
+		StoreVector(Dst + 4, B, bStream);
+		StoreVector(Dst + 8, C, bStream);
+		StoreVector(Dst + 12, D, bStream);
+		StoreVector(Dst + 16, _mm_movelh_ps(UV0, A), bStream);
+		StoreVector(Dst + 20, AB, bStream);
+		StoreVector(Dst + 24, BC, bStream);
+		StoreVector(Dst + 28, CD, bStream);
+		StoreVector(Dst + 32, _mm_shuffle_ps(D, UV1, _MM_SHUFFLE(1, 0, 3, 2)), bStream);
+
+		// 좌하단 + 우하단 (144 ~ 287바이트)
+		StoreVector(Dst + 36, A, bStream);
+		StoreVector(Dst + 40, B, bStream);
+		StoreVector(Dst + 44, C, bStream);
+		StoreVector(Dst + 48, D, bStream);
+		StoreVector(Dst + 52, _mm_movelh_ps(UV2, A), bStream);
+		StoreVector(Dst + 56, AB, bStream);
+		StoreVector(Dst + 60, BC, bStream);
+		StoreVector(Dst + 64, CD, bStream);
+		StoreVector(Dst + 68, _mm_shuffle_ps(D, UV3, _MM_SHUFFLE(1, 0, 3, 2)), bStream);
+	}
 
-		// 인덱스 생성 (2개의 삼각형)
-		Indices.Add(BaseVertexIndex + 0); // Triangle 1
-		Indices.Add(BaseVertexIndex + 1);
-		Indices.Add(BaseVertexIndex + 2);
-		Indices.Add(BaseVertexIndex + 2); // Triangle 2
-		Indices.Add(BaseVertexIndex + 1);
-		Indices.Add(BaseVertexIndex + 3);
+	if (bStream)
+	{
+		_mm_sfence();
 	}
+}
 
-	// 6. GPU 버퍼 업데이트 (동적 버퍼)
-	// VertexBuffer 업데이트 (OwnerInstance의 버퍼에 새로 생성한 정점 데이터를 업데이트)
-	if (OwnerInstance && OwnerInstance->VertexBuffer && !Vertices.empty())
+void FDynamicSpriteEmitterData::GetDynamicMeshElementsEmitter(
+	TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const
+{
+	// 정점 생성기가 이미 기록했으면 그 결과 사용 (아니면 여기서 정렬 + 기록)
+	// 인덱스 버퍼는 Resize에서 만든 정적 쿼드 인덱스이므로 매 프레임 만들지 않음
+	const int32 ParticleCount = AcquireRenderData(View);
+	if (ParticleCount <= 0)
 	{
-		GEngine.GetRHIDevice()->VertexBufferUpdate(OwnerInstance->VertexBuffer, Vertices);
+		return;
 	}
-	
-	// 7. FMeshBatchElement 생성
+
+	const FDynamicSpriteEmitterReplayDataBase& SourceData = Source;
+
+	// FMeshBatchElement 생성
 	FMeshBatchElement BatchElement;
 
 	// 머티리얼과 셰이더는 렌더러에서 설정됨 (RenderParticlesPass)
 	// 여기서는 기하 데이터만 설정
 	
-	BatchElement.VertexBuffer = OwnerInstance ? OwnerInstance->VertexBuffer : nullptr;
-	BatchElement.IndexBuffer = OwnerInstance ? OwnerInstance->IndexBuffer : nullptr;
+	BatchElement.VertexBuffer = OwnerInstance->VertexBuffer;
+	BatchElement.IndexBuffer = OwnerInstance->IndexBuffer;
 
 	BatchElement.VertexStride = sizeof(FParticleSpriteVertex);
-	BatchElement.IndexCount = IndexCount;
+	BatchElement.IndexCount = ParticleCount * 6; // 2 triangles per quad
 	BatchElement.StartIndex = 0;
 	BatchElement.BaseVertexIndex = 0;
 	BatchElement.WorldMatrix = FMatrix::Identity(); // TODO: Get from component transform
 
-	assert(OwnerInstance != nullptr);
 	assert(OwnerInstance->Component != nullptr);
 	BatchElement.ObjectID = OwnerInstance->Component->UUID; 
 	BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
@@ -255,108 +287,127 @@ int32 FDynamicMeshEmitterData::GetDynamicVertexStride() const
 	return sizeof(FMeshParticleInstanceVertex);
 }
 
-void FDynamicMeshEmitterData::GetDynamicMeshElementsEmitter(
-	TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const
+int32 FDynamicMeshEmitterData::PrepareRenderData(const FSceneView* View) const
 {
-	// 1. 유효성 검사
+	// 1. 유효성 검사 (GPU 버퍼는 MapRenderData에서 확인)
 	if (!bValid || Source.ActiveParticleCount <= 0 || !Source.MeshAsset)
 	{
-		return;
+		return 0;
 	}
 
-	// 2. Source 데이터 가져오기
+	// 2. 메시 파티클은 정렬하지 않으므로 활성 순서 그대로 인스턴스 생성
 	const FDynamicMeshEmitterReplayData& SourceData = Source;
-	const int32 ParticleCount = SourceData.MaxDrawCount != 0 ? std::min(SourceData.ActiveParticleCount, SourceData.MaxDrawCount) : SourceData.ActiveParticleCount;
-	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
-	const uint16* ParticleIndices = SourceData.DataContainer.ParticleIndices;
-	const int32 ParticleStride = SourceData.ParticleStride;
-
-	if (!ParticleData || !ParticleIndices)
+	if (!SourceData.DataContainer.ParticleData || !SourceData.DataContainer.ParticleIndices)
 	{
-		return;
+		return 0;
 	}
+	return GetDrawParticleCount(SourceData);
+}
 
-	// 3. 인스턴스 데이터 생성 (각 파티클당 1개의 인스턴스)
-	TArray<FMeshParticleInstanceVertex> InstanceData;
-	InstanceData.reserve(ParticleCount);
+bool FDynamicMeshEmitterData::MapRenderData(FParticleRenderDataDest& OutDest) const
+{
+	// 인스턴스 버퍼는 MaxActiveParticles개로 만들고 Resize 때 다시 만듦
+	const FParticleMeshEmitterInstance* MeshInstance = static_cast<const FParticleMeshEmitterInstance*>(OwnerInstance);
+	OutDest.VertexData = MeshInstance ? MapDiscard(MeshInstance->InstanceBuffer) : nullptr;
+	OutDest.IndexData = nullptr;
+	return OutDest.VertexData != nullptr;
+}
+
+void FDynamicMeshEmitterData::UnmapRenderData() const
+{
+	Unmap(static_cast<const FParticleMeshEmitterInstance*>(OwnerInstance)->InstanceBuffer);
+}
+
+void FDynamicMeshEmitterData::WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const
+{
+	const FDynamicMeshEmitterReplayData& SourceData = Source;
+	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
+	const uint32* ParticleIndices = SourceData.DataContainer.ParticleIndices;
+	const int32 ParticleStride = SourceData.ParticleStride;
+	const bool bHasMeshRotation = SourceData.bMeshRotationActive && SourceData.MeshRotationOffset > 0;
 
-	for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ++ParticleIndex)
+	float* Dst = static_cast<float*>(Dest.VertexData) + static_cast<size_t>(Begin) * MeshInstanceFloats;
+	const bool bStream = IsAligned16(Dst);
+
+	for (int32 ParticleIndex = Begin; ParticleIndex < End; ++ParticleIndex, Dst += MeshInstanceFloats)
 	{
 		const int32 CurrentIndex = ParticleIndices[ParticleIndex];
 		const uint8* ParticlePtr = ParticleData + (CurrentIndex * ParticleStride);
 		const FBaseParticle& Particle = *reinterpret_cast<const FBaseParticle*>(ParticlePtr);
 
-		FMeshParticleInstanceVertex Instance;
-
-		// 색상
-		Instance.Color = Particle.Color;
-
 		// Transform 행렬 구성 (Scale * Rotation * Translation)
 		// FVector4 Transform[3]에 3x4 행렬 저장 (W에 Translation)
-		FVector Scale = Particle.Size;
-		FVector Location = Particle.Location;
+		const FVector& Scale = Particle.Size;
+		const FVector& Location = Particle.Location;
 
 		// Payload에서 3D 회전 읽기
 		FVector MeshRotation = FVector::Zero();
-		if (SourceData.bMeshRotationActive && SourceData.MeshRotationOffset > 0)
+		if (bHasMeshRotation)
 		{
 			const FMeshRotationPayloadData* MeshRotPayload =
 				reinterpret_cast<const FMeshRotationPayloadData*>(ParticlePtr + SourceData.MeshRotationOffset);
 			MeshRotation = MeshRotPayload->Rotation;
 		}
 
-		// 회전 행렬 계산 (라디안 → 도 변환 후 쿼터니언)
-		FVector RotDeg(RadiansToDegrees(MeshRotation.X),
-		               RadiansToDegrees(MeshRotation.Y),
-		               RadiansToDegrees(MeshRotation.Z));
-		FQuat RotQuat = FQuat::MakeFromEulerZYX(RotDeg);
-		FMatrix RotMatrix = RotQuat.ToMatrix();
-
-		// Scale * Rotation 행렬 구성 후 Translation 적용
-		// Row 0: Scale.X * RotMatrix Row 0, Location.X
-		Instance.Transform[0] = FVector4(
-			RotMatrix.M[0][0] * Scale.X, RotMatrix.M[0][1] * Scale.Y, RotMatrix.M[0][2] * Scale.Z, Location.X);
-		// Row 1: Scale.Y * RotMatrix Row 1, Location.Y
-		Instance.Transform[1] = FVector4(
-			RotMatrix.M[1][0] * Scale.X, RotMatrix.M[1][1] * Scale.Y, RotMatrix.M[1][2] * Scale.Z, Location.Y);
-		// Row 2: Scale.Z * RotMatrix Row 2, Location.Z
-		Instance.Transform[2] = FVector4(
-			RotMatrix.M[2][0] * Scale.X, RotMatrix.M[2][1] * Scale.Y, RotMatrix.M[2][2] * Scale.Z, Location.Z);
-
-		// Velocity
-		FVector Velocity = Particle.Velocity;
-		float Speed = Velocity.Size();
-		Instance.Velocity = FVector4(Velocity.X, Velocity.Y, Velocity.Z, Speed);
-
-		// SubUV (기본값)
-		Instance.SubUVParams[0] = 0;
-		Instance.SubUVParams[1] = 0;
-		Instance.SubUVParams[2] = 0;
-		Instance.SubUVParams[3] = 0;
-		Instance.SubUVLerp = 0.0f;
-
-		// RelativeTime
-		Instance.RelativeTime = Particle.RelativeTime;
-
-		InstanceData.Add(Instance);
+		__m128 Row0, Row1, Row2;
+		if (MeshRotation.X == 0.0f && MeshRotation.Y == 0.0f && MeshRotation.Z == 0.0f)
+		{
+			// 회전이 없으면 회전 행렬이 단위 행렬이므로 쿼터니언 변환 생략
+			Row0 = _mm_setr_ps(Scale.X, 0.0f, 0.0f, Location.X);
+			Row1 = _mm_setr_ps(0.0f, Scale.Y, 0.0f, Location.Y);
+			Row2 = _mm_setr_ps(0.0f, 0.0f, Scale.Z, Location.Z);
+		}
+		else
+		{
+			// 회전 행렬 계산 (라디안 → 도 변환 후 쿼터니언)
+			FVector RotDeg(RadiansToDegrees(MeshRotation.X),
+			               RadiansToDegrees(MeshRotation.Y),
+			               RadiansToDegrees(MeshRotation.Z));
+			const FMatrix RotMatrix = FQuat::MakeFromEulerZYX(RotDeg).ToMatrix();
+
+			// Row r: RotMatrix Row r의 각 열에 Scale 적용, W에 Location
+			const __m128 ScaleW = _mm_setr_ps(Scale.X, Scale.Y, Scale.Z, 1.0f);
+			Row0 = _mm_mul_ps(_mm_setr_ps(RotMatrix.M[0][0], RotMatrix.M[0][1], RotMatrix.M[0][2], Location.X), ScaleW);
+			Row1 = _mm_mul_ps(_mm_setr_ps(RotMatrix.M[1][0], RotMatrix.M[1][1], RotMatrix.M[1][2], Location.Y), ScaleW);
+			Row2 = _mm_mul_ps(_mm_setr_ps(RotMatrix.M[2][0], RotMatrix.M[2][1], RotMatrix.M[2][2], Location.Z), ScaleW);
+		}
+
+		// Velocity (XYZ: 방향, W: 속력)
+		const FVector& Velocity = Particle.Velocity;
+		const __m128 VelocityVector = _mm_setr_ps(Velocity.X, Velocity.Y, Velocity.Z, Velocity.Size());
+
+		// SubUVParams (int16 x 4 = 0) | SubUVLerp (0) | RelativeTime
+		const __m128 Tail = _mm_setr_ps(0.0f, 0.0f, 0.0f, Particle.RelativeTime);
+
+		StoreVector(Dst + 0, _mm_loadu_ps(&Particle.Color.R), bStream);
+		StoreVector(Dst + 4, Row0, bStream);
+		StoreVector(Dst + 8, Row1, bStream);
+		StoreVector(Dst + 12, Row2, bStream);
+		StoreVector(Dst + 16, VelocityVector, bStream);
+		StoreVector(Dst + 20, Tail, bStream);
 	}
 
-	// 4. MeshEmitterInstance로 캐스팅 (InstanceBuffer 접근용)
-	FParticleMeshEmitterInstance* MeshInstance =
-		static_cast<FParticleMeshEmitterInstance*>(OwnerInstance);
+	if (bStream)
+	{
+		_mm_sfence();
+	}
+}
 
-	// 5. 인스턴스 버퍼 업데이트
-	if (MeshInstance && MeshInstance->InstanceBuffer && !InstanceData.empty())
+void FDynamicMeshEmitterData::GetDynamicMeshElementsEmitter(
+	TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const
+{
+	// 1. 인스턴스 데이터 (그림자 패스나 정점 생성기에서 이미 기록했으면 재사용)
+	const int32 InstanceCount = AcquireRenderData(View);
+	if (InstanceCount <= 0)
 	{
-#if defined(DEBUG) || defined(_DEBUG)
-		D3D11_BUFFER_DESC desc;
-		MeshInstance->InstanceBuffer->GetDesc(&desc);
-		uint32 VertexCountInBuffer = desc.ByteWidth / sizeof(FMeshParticleInstanceVertex);
-#endif
-		GEngine.GetRHIDevice()->VertexBufferUpdate(MeshInstance->InstanceBuffer, InstanceData);
+		return;
 	}
 
-	// 6. 메시 에셋 정보 가져오기
+	const FDynamicMeshEmitterReplayData& SourceData = Source;
+	FParticleMeshEmitterInstance* MeshInstance =
+		static_cast<FParticleMeshEmitterInstance*>(OwnerInstance);
+
+	// 2. 메시 에셋 정보 가져오기
 	UStaticMesh* MeshAsset = SourceData.MeshAsset;
 	if (!MeshAsset || !MeshAsset->GetStaticMeshAsset())
 	{
@@ -365,7 +416,7 @@ void FDynamicMeshEmitterData::GetDynamicMeshElementsEmitter(
 
 	const TArray<FGroupInfo>& MeshGroupInfos = MeshAsset->GetMeshGroupInfo();
 
-	// 7. 그룹별로 FMeshBatchElement 생성 (UStaticMeshComponent::CollectMeshBatches 로직 참고)
+	// 3. 그룹별로 FMeshBatchElement 생성 (UStaticMeshComponent::CollectMeshBatches 로직 참고)
 	const bool bHasSections = !MeshGroupInfos.IsEmpty();
 	const uint32 NumSectionsToProcess = bHasSections ? static_cast<uint32>(MeshGroupInfos.size()) : 1;
 
@@ -414,14 +465,13 @@ void FDynamicMeshEmitterData::GetDynamicMeshElementsEmitter(
 		BatchElement.BaseVertexIndex = 0;
 
 		// 인스턴싱 데이터
-		BatchElement.InstanceBuffer = MeshInstance ? MeshInstance->InstanceBuffer : nullptr;
-		BatchElement.InstanceCount = ParticleCount;
+		BatchElement.InstanceBuffer = MeshInstance->InstanceBuffer;
+		BatchElement.InstanceCount = InstanceCount;
 		BatchElement.InstanceStride = sizeof(FMeshParticleInstanceVertex);
 
 		BatchElement.WorldMatrix = FMatrix::Identity();
 		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-		assert(OwnerInstance != nullptr);
 		assert(OwnerInstance->Component != nullptr);
 		BatchElement.ObjectID = OwnerInstance->Component->UUID;
 
@@ -439,49 +489,77 @@ int32 FDynamicBeamEmitterData::GetDynamicVertexStride() const
 	return sizeof(FParticleBeamVertex);
 }
 
-void FDynamicBeamEmitterData::GetDynamicMeshElementsEmitter(
-	TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const
+int32 FDynamicBeamEmitterData::PrepareRenderData(const FSceneView* View) const
 {
-	// 1. 유효성 검사
-	if (!bValid || Source.BeamPoints.Num() < 2)
+	// 1. 유효성 검사 (GPU 버퍼는 MapRenderData에서 확인)
+	if (!bValid || Source.BeamPoints.Num() < 2 || !View)
 	{
-		return;
+		return 0;
 	}
 
-	// 2. Source 데이터 가져오기
+	// 카메라 방향 폭 벡터는 기록 단계에서 계산
+	RenderViewLocation = View->ViewLocation;
+	return 1;
+}
+
+bool FDynamicBeamEmitterData::MapRenderData(FParticleRenderDataDest& OutDest) const
+{
+	const FParticleBeamEmitterInstance* BeamInstance = static_cast<const FParticleBeamEmitterInstance*>(OwnerInstance);
+	if (!BeamInstance || !BeamInstance->BeamIndexBuffer)
+	{
+		return false;
+	}
+
+	OutDest.VertexData = MapDiscard(BeamInstance->BeamVertexBuffer);
+	if (!OutDest.VertexData)
+	{
+		return false;
+	}
+
+	OutDest.IndexData = static_cast<uint32*>(MapDiscard(BeamInstance->BeamIndexBuffer));
+	if (!OutDest.IndexData)
+	{
+		Unmap(BeamInstance->BeamVertexBuffer);
+		return false;
+	}
+	return true;
+}
+
+void FDynamicBeamEmitterData::UnmapRenderData() const
+{
+	const FParticleBeamEmitterInstance* BeamInstance = static_cast<const FParticleBeamEmitterInstance*>(OwnerInstance);
+	Unmap(BeamInstance->BeamVertexBuffer);
+	Unmap(BeamInstance->BeamIndexBuffer);
+}
+
+int32 FDynamicBeamEmitterData::GetRenderDataItemBytes() const
+{
+	const int32 NumPoints = Source.BeamPoints.Num();
+	const int32 Sheets = FMath::Max(1, Source.Sheets);
+	return (NumPoints * 2 * static_cast<int32>(sizeof(FParticleBeamVertex)) + (NumPoints - 1) * 6 * static_cast<int32>(sizeof(uint32))) * Sheets;
+}
+
+void FDynamicBeamEmitterData::WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const
+{
+	// 빔 전체가 항목 하나 (Begin = 0, End = 1)
 	const FDynamicBeamEmitterReplayData& SourceData = Source;
 	const TArray<FBeamPoint>& BeamPoints = SourceData.BeamPoints;
 	const int32 NumPoints = BeamPoints.Num();
 	const int32 NumSegments = NumPoints - 1;
 	const int32 Sheets = FMath::Max(1, SourceData.Sheets);
 	const float UVTiling = SourceData.UVTiling;
+	const FVector CameraLocation = RenderViewLocation;
 
-	// 3. 버텍스 및 인덱스 데이터 생성
-	// 각 시트마다: (NumPoints * 2) 버텍스, (NumSegments * 6) 인덱스
-	const int32 VertexCountPerSheet = NumPoints * 2;
-	const int32 IndexCountPerSheet = NumSegments * 6;
-	const int32 TotalVertexCount = VertexCountPerSheet * Sheets;
-	const int32 TotalIndexCount = IndexCountPerSheet * Sheets;
-
-	TArray<FParticleBeamVertex> Vertices;
-	Vertices.reserve(TotalVertexCount);
-
-	TArray<uint32> Indices;
-	Indices.reserve(TotalIndexCount);
+	// 각 시트마다: (NumPoints * 2) 버텍스, (NumSegments * 6) 인덱스를 업로드 메모리에 바로 기록
+	FParticleBeamVertex* Vertices = static_cast<FParticleBeamVertex*>(Dest.VertexData);
+	uint32* Indices = Dest.IndexData;
+	uint32 BaseVertexIndex = 0;
 
-	// 카메라 방향 (빌보딩용)
-	// ViewRotation에서 Forward 방향 계산
-	FVector CameraForward = View->ViewRotation.RotateVector(FVector(1.0f, 0.0f, 0.0f));
-	FVector CameraLocation = View->ViewLocation;
-
-	// 4. 각 시트에 대해 버텍스 생성
 	for (int32 SheetIndex = 0; SheetIndex < Sheets; ++SheetIndex)
 	{
 		// 시트 회전 각도 (180도씩 분할)
 		float SheetAngle = (PI / Sheets) * SheetIndex;
 
-		int32 BaseVertexIndex = Vertices.Num();
-
 		// 각 빔 포인트에 대해 2개의 버텍스 생성 (상단, 하단)
 		for (int32 PointIndex = 0; PointIndex < NumPoints; ++PointIndex)
 		{
@@ -518,83 +596,70 @@ void FDynamicBeamEmitterData::GetDynamicMeshElementsEmitter(
 			float U = Point.Parameter * UVTiling;
 
 			// 상단 버텍스
-			FParticleBeamVertex TopVertex;
+			FParticleBeamVertex& TopVertex = *Vertices++;
 			TopVertex.Position = Point.Position + RightVector * HalfWidth;
 			TopVertex.Color = Point.Color;
 			TopVertex.Tex_U = U;
 			TopVertex.Tex_V = 0.0f;
-			Vertices.Add(TopVertex);
 
 			// 하단 버텍스
-			FParticleBeamVertex BottomVertex;
+			FParticleBeamVertex& BottomVertex = *Vertices++;
 			BottomVertex.Position = Point.Position - RightVector * HalfWidth;
 			BottomVertex.Color = Point.Color;
 			BottomVertex.Tex_U = U;
 			BottomVertex.Tex_V = 1.0f;
-			Vertices.Add(BottomVertex);
 		}
 
 		// 인덱스 생성 (삼각형 스트립을 삼각형 리스트로 변환)
 		for (int32 SegIndex = 0; SegIndex < NumSegments; ++SegIndex)
 		{
-			int32 V0 = BaseVertexIndex + (SegIndex * 2) + 0; // 현재 상단
-			int32 V1 = BaseVertexIndex + (SegIndex * 2) + 1; // 현재 하단
-			int32 V2 = BaseVertexIndex + (SegIndex * 2) + 2; // 다음 상단
-			int32 V3 = BaseVertexIndex + (SegIndex * 2) + 3; // 다음 하단
+			uint32 V0 = BaseVertexIndex + (SegIndex * 2) + 0; // 현재 상단
+			uint32 V1 = BaseVertexIndex + (SegIndex * 2) + 1; // 현재 하단
+			uint32 V2 = BaseVertexIndex + (SegIndex * 2) + 2; // 다음 상단
+			uint32 V3 = BaseVertexIndex + (SegIndex * 2) + 3; // 다음 하단
 
 			// 삼각형 1: V0 - V2 - V1
-			Indices.Add(V0);
-			Indices.Add(V2);
-			Indices.Add(V1);
+			*Indices++ = V0;
+			*Indices++ = V2;
+			*Indices++ = V1;
 
 			// 삼각형 2: V1 - V2 - V3
-			Indices.Add(V1);
-			Indices.Add(V2);
-			Indices.Add(V3);
+			*Indices++ = V1;
+			*Indices++ = V2;
+			*Indices++ = V3;
 		}
-	}
 
-	// 5. GPU 버퍼 업데이트
-	FParticleBeamEmitterInstance* BeamInstance =
-		static_cast<FParticleBeamEmitterInstance*>(OwnerInstance);
+		BaseVertexIndex += static_cast<uint32>(NumPoints * 2);
+	}
+}
 
-	if (BeamInstance && BeamInstance->BeamVertexBuffer && !Vertices.empty())
+void FDynamicBeamEmitterData::GetDynamicMeshElementsEmitter(
+	TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const
+{
+	// 1. 정점/인스턴스 생성 (정점 생성기가 이미 기록했으면 재사용)
+	if (AcquireRenderData(View) <= 0)
 	{
-		ID3D11DeviceContext* Context = GEngine.GetRHIDevice()->GetDeviceContext();
-		if (Context)
-		{
-			// Vertex Buffer 업데이트
-			D3D11_MAPPED_SUBRESOURCE MappedResource;
-			HRESULT hr = Context->Map(BeamInstance->BeamVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-			if (SUCCEEDED(hr))
-			{
-				memcpy(MappedResource.pData, Vertices.GetData(), Vertices.Num() * sizeof(FParticleBeamVertex));
-				Context->Unmap(BeamInstance->BeamVertexBuffer, 0);
-			}
-
-			// Index Buffer 업데이트
-			hr = Context->Map(BeamInstance->BeamIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-			if (SUCCEEDED(hr))
-			{
-				memcpy(MappedResource.pData, Indices.GetData(), Indices.Num() * sizeof(uint32));
-				Context->Unmap(BeamInstance->BeamIndexBuffer, 0);
-			}
-		}
+		return;
 	}
 
-	// 6. FMeshBatchElement 생성
+	const FDynamicBeamEmitterReplayData& SourceData = Source;
+	const int32 NumSegments = SourceData.BeamPoints.Num() - 1;
+	const int32 Sheets = FMath::Max(1, SourceData.Sheets);
+	const FParticleBeamEmitterInstance* BeamInstance =
+		static_cast<const FParticleBeamEmitterInstance*>(OwnerInstance);
+
+	// 2. FMeshBatchElement 생성
 	FMeshBatchElement BatchElement;
 
-	BatchElement.VertexBuffer = BeamInstance ? BeamInstance->BeamVertexBuffer : nullptr;
-	BatchElement.IndexBuffer = BeamInstance ? BeamInstance->BeamIndexBuffer : nullptr;
+	BatchElement.VertexBuffer = BeamInstance->BeamVertexBuffer;
+	BatchElement.IndexBuffer = BeamInstance->BeamIndexBuffer;
 
 	BatchElement.VertexStride = sizeof(FParticleBeamVertex);
-	BatchElement.IndexCount = TotalIndexCount;
+	BatchElement.IndexCount = NumSegments * 6 * Sheets;
 	BatchElement.StartIndex = 0;
 	BatchElement.BaseVertexIndex = 0;
 	BatchElement.WorldMatrix = FMatrix::Identity();
 
-	assert(OwnerInstance != nullptr);
 	assert(OwnerInstance->Component != nullptr);
 	BatchElement.ObjectID = OwnerInstance->Component->UUID;
 	BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
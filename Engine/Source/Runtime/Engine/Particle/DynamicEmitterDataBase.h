@@ -1,12 +1,23 @@
 #pragma once
 #include "UEContainer.h"
 #include "DynamicEmitterReplayDataBase.h"
+#include "ParticleSort.h"
+#include "ParticleHelper.h"
 
 #include "MeshBatchElement.h"
 
 // Forward declarations
 struct FParticleEmitterInstance;
 
+/**
+ * @brief 에미터 정점/인스턴스를 기록할 업로드 메모리 (MapRenderData가 채움)
+ */
+struct FParticleRenderDataDest
+{
+	void* VertexData = nullptr;		// 스프라이트 정점 / 메시 인스턴스 / 빔 정점
+	uint32* IndexData = nullptr;	// 빔만 사용 (스프라이트 인덱스 버퍼는 Resize에서 만든 정적 버퍼)
+};
+
 /**
  * @brief 이미터 렌더 데이터의 기본 구조체
  * @details 렌더링 스레드로 전달되는 파티클 이미터 데이터
@@ -31,6 +42,7 @@ struct FDynamicEmitterDataBase
 		: bSelected(false)
 		, bValid(false)
 		, EmitterIndex(0)
+		, OwnerInstance(nullptr)
 	{
 	}
 
@@ -42,6 +54,46 @@ struct FDynamicEmitterDataBase
 	//...
 
 	virtual void GetDynamicMeshElementsEmitter(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const {}
+
+	/**
+	 * 정점/인스턴스 생성 준비 (정렬 등 에미터 단위 선행 작업, 렌더 스레드)
+	 * @return 생성할 항목 수 (스프라이트/메시는 파티클 수, 빔은 1), 0이면 생성할 것이 없음
+	 */
+	virtual int32 PrepareRenderData(const FSceneView* View) const { return 0; }
+
+	/** 업로드 버퍼를 WRITE_DISCARD로 맵 (디바이스 컨텍스트를 사용하므로 렌더 스레드 전용) */
+	virtual bool MapRenderData(FParticleRenderDataDest& OutDest) const { return false; }
+	virtual void UnmapRenderData() const {}
+
+	/**
+	 * [Begin, End) 항목의 정점/인스턴스를 Dest의 항목 위치에 바로 기록
+	 * @note 구간이 겹치지 않으면 워커 스레드에서 동시에 호출해도 됨 (PrepareRenderData 결과만 읽음)
+	 */
+	virtual void WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const {}
+
+	/** 파티클 하나(빔은 전체)가 쓰는 업로드 바이트 수 */
+	virtual int32 GetRenderDataItemBytes() const { return 0; }
+
+	/** 뷰에 따라 결과가 달라지면 true (정렬/카메라 방향), false면 같은 프레임의 다른 패스가 결과를 재사용 */
+	virtual bool IsRenderDataViewDependent() const { return true; }
+
+	/** FParticleVertexGenerator가 생성을 마쳤다고 표시 */
+	void MarkRenderDataGenerated(int32 NumItems) const { GeneratedRenderItems = NumItems; }
+	bool HasGeneratedRenderData() const { return GeneratedRenderItems != INDEX_NONE; }
+
+protected:
+	/**
+	 * GetDynamicMeshElementsEmitter용: 생성된 항목 수를 돌려주고, 뷰마다 다시 만들어야 하면 소비
+	 * 생성기를 거치지 않았으면 이 자리에서 직접 준비/맵/기록 (정점 생성기가 없는 경로 호환)
+	 */
+	int32 AcquireRenderData(const FSceneView* View) const;
+
+	/** 새 프레임 데이터를 채울 때 이전 생성 결과 무효화 (각 Init에서 호출) */
+	void ResetRenderData() { GeneratedRenderItems = INDEX_NONE; }
+
+private:
+	/** 업로드 버퍼에 기록한 항목 수 (INDEX_NONE이면 아직 생성하지 않음) */
+	mutable int32 GeneratedRenderItems = INDEX_NONE;
 };
 
 struct FParticleOrder;
@@ -59,14 +111,36 @@ struct FDynamicSpriteEmitterDataBase : public FDynamicEmitterDataBase
 	 *	@param	View				The scene view being rendered
 	 *	@param	LocalToWorld		The local to world transform of the component rendering the emitter
 	 *	@param	ParticleOrder		The array to fill in with ordered indices
+	 *
+	 *	@note	FParticleSorter(양자화 키 + 기수 정렬)로 정렬하며, 걸린 시간은 GetLastSortTimeMS로 확인
 	 */
 	void SortSpriteParticles(EParticleSortMode SortMode, bool bLocalSpace,
-		int32 ParticleCount, const uint8* ParticleData, int32 ParticleStride, const uint16* ParticleIndices,
+		int32 ParticleCount, const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices,
 		const FSceneView* View, const FMatrix& LocalToWorld, FParticleOrder* ParticleOrder) const;
 
+	/** 마지막 정렬에 걸린 시간 (정렬하지 않았으면 0) */
+	double GetLastSortTimeMS() const { return Sorter.GetLastSortTimeMS(); }
+
+	/** 마지막으로 정렬한 파티클 수 */
+	int32 GetLastSortedCount() const { return Sorter.GetLastSortedCount(); }
+
 	virtual int32 GetDynamicVertexStride() const = 0;
 	//...
 
+protected:
+	/** 정렬 결과 순서대로 읽을 파티클 수 (MaxDrawCount 반영) */
+	static int32 GetDrawParticleCount(const FDynamicSpriteEmitterReplayDataBase& SourceData)
+	{
+		return SourceData.MaxDrawCount != 0 ? std::min(SourceData.ActiveParticleCount, SourceData.MaxDrawCount) : SourceData.ActiveParticleCount;
+	}
+
+	/** 정렬 스크래치 (렌더 데이터가 에미터별로 풀링되므로 프레임 사이에 재사용) */
+	mutable FParticleSorter Sorter;
+
+	/** 정렬 결과 (PrepareRenderData마다 재사용, WriteRenderData가 이 순서로 정점 생성) */
+	mutable TArray<FParticleOrder> ParticleOrderScratch;
+
+public:
 	// 아래는 UE에 존재하지만, 현재 엔진에서는 사용하지 않을 것 같은 멤버들
 	///** The material render proxy for this emitter */
 	//const FMaterialRenderProxy* MaterialResource;
@@ -95,10 +169,19 @@ struct FDynamicSpriteEmitterData : public FDynamicSpriteEmitterDataBase
 	{
 		bSelected = bInSelected;
 		bValid = (Source.ActiveParticleCount > 0);
+		ResetRenderData();
 	}
 
 	virtual void GetDynamicMeshElementsEmitter(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const override;
 
+	virtual int32 PrepareRenderData(const FSceneView* View) const override;
+	virtual bool MapRenderData(FParticleRenderDataDest& OutDest) const override;
+	virtual void UnmapRenderData() const override;
+
+	/** 파티클마다 정점 하나를 만들어 SSE로 4개 코너(TexCoord만 다름)의 쿼드 288바이트를 스트리밍 저장 */
+	virtual void WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const override;
+	virtual int32 GetRenderDataItemBytes() const override { return sizeof(FParticleSpriteVertex) * 4; }
+
 
 	/** The frame source data for this particle system.  This is everything needed to represent this
 		this particle system frame.  It does not include any transient rendering thread data.  Also, for
@@ -124,10 +207,22 @@ struct FDynamicMeshEmitterData : public FDynamicSpriteEmitterData
 	{
 		bSelected = bInSelected;
 		bValid = (Source.ActiveParticleCount > 0) && (Source.MeshAsset != nullptr);
+		ResetRenderData();
 	}
 
 	virtual void GetDynamicMeshElementsEmitter(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const override;
 
+	virtual int32 PrepareRenderData(const FSceneView* View) const override;
+	virtual bool MapRenderData(FParticleRenderDataDest& OutDest) const override;
+	virtual void UnmapRenderData() const override;
+
+	/** 인스턴스 96바이트를 SSE 레지스터 6개로 만들어 스트리밍 저장 (회전이 없으면 쿼터니언 계산 생략) */
+	virtual void WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const override;
+	virtual int32 GetRenderDataItemBytes() const override { return sizeof(FMeshParticleInstanceVertex); }
+
+	/** 인스턴스 데이터는 뷰와 무관하므로 그림자 패스에서 만든 것을 파티클 패스가 그대로 사용 */
+	virtual bool IsRenderDataViewDependent() const override { return false; }
+
 	/** The frame source data for this particle system.  This is everything needed to represent this
 		this particle system frame.  It does not include any transient rendering thread data.  Also, for
 		non-simulating 'replay' particle systems, this data may have come straight from disk! */
@@ -152,10 +247,22 @@ struct FDynamicBeamEmitterData : public FDynamicSpriteEmitterDataBase
 		bSelected = bInSelected;
 		// 빔은 포인트가 2개 이상이면 유효
 		bValid = (Source.BeamPoints.Num() >= 2);
+		ResetRenderData();
 	}
 
 	virtual void GetDynamicMeshElementsEmitter(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View) const override;
 
+	/** 빔 하나를 항목 하나로 취급 (포인트 수가 적어 에미터 단위로 나눔) */
+	virtual int32 PrepareRenderData(const FSceneView* View) const override;
+	virtual bool MapRenderData(FParticleRenderDataDest& OutDest) const override;
+	virtual void UnmapRenderData() const override;
+	virtual void WriteRenderData(const FParticleRenderDataDest& Dest, int32 Begin, int32 End) const override;
+	virtual int32 GetRenderDataItemBytes() const override;
+
 	/** The frame source data for beam particles */
 	FDynamicBeamEmitterReplayData Source;
+
+private:
+	/** PrepareRenderData에서 받은 카메라 위치 (WriteRenderData가 카메라 방향 폭 벡터 계산에 사용) */
+	mutable FVector RenderViewLocation;
 };
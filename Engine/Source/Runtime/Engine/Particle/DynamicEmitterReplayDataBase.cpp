@@ -32,11 +32,11 @@ void FDynamicEmitterReplayDataBase::Serialize(FArchive& Ar)
 		}
 
 		// Save indices
-		int32 IndexCount = DataContainer.ParticleIndicesNumShorts;
+		int32 IndexCount = DataContainer.ParticleIndicesNum;
 		Ar << IndexCount;
 		if (IndexCount > 0 && DataContainer.ParticleIndices)
 		{
-			Ar.Serialize(DataContainer.ParticleIndices, IndexCount * sizeof(uint16));
+			Ar.Serialize(DataContainer.ParticleIndices, IndexCount * sizeof(uint32));
 		}
 	}
 	else if (Ar.IsLoading())
@@ -58,7 +58,7 @@ void FDynamicEmitterReplayDataBase::Serialize(FArchive& Ar)
 			// Allocate already created ParticleIndices, just load data
 			if (DataContainer.ParticleIndices)
 			{
-				Ar.Serialize(DataContainer.ParticleIndices, IndexCount * sizeof(uint16));
+				Ar.Serialize(DataContainer.ParticleIndices, IndexCount * sizeof(uint32));
 			}
 		}
 	}
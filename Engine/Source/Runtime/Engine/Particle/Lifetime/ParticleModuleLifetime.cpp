@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleLifetime.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleLifetime::UParticleModuleLifetime()
 	: Lifetime(1.0f)
@@ -17,7 +18,7 @@ void UParticleModuleLifetime::Spawn(FParticleEmitterInstance* Owner, int32 Offse
 	}
 
 	// 파티클 수명 설정
-	ParticleBase->Lifetime = Lifetime.GetValue();
+	ParticleBase->Lifetime = Lifetime.GetValue(Owner->RandomStream);
 	ParticleBase->RelativeTime = 0.0f;
 }
 
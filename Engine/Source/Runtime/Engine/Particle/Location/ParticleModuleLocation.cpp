@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleLocation.h"
+#include "ParticleEmitterInstance.h"
 
 IMPLEMENT_CLASS(UParticleModuleLocation)
 
@@ -19,7 +20,7 @@ void UParticleModuleLocation::Spawn(FParticleEmitterInstance* Owner, int32 Offse
 	}
 
 	// 파티클 초기 위치 설정 (기존 위치에 더함)
-	ParticleBase->Location = ParticleBase->Location + StartLocation.GetValue();
+	ParticleBase->Location = ParticleBase->Location + StartLocation.GetValue(Owner->RandomStream);
 }
 
 void UParticleModuleLocation::Serialize(bool bIsLoading, JSON& InOutHandle)
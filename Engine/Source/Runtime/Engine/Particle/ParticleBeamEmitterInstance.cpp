@@ -116,6 +116,14 @@ void FParticleBeamEmitterInstance::Init(UParticleEmitter* InTemplate, UParticleS
 	CalculateBeamPoints();
 }
 
+void FParticleBeamEmitterInstance::Reuse(UParticleSystemComponent* InComponent)
+{
+	FParticleEmitterInstance::Reuse(InComponent);
+
+	NoiseTime = 0.0f;
+	CalculateBeamPoints();
+}
+
 // ============== Tick ==============
 
 void FParticleBeamEmitterInstance::Tick(float DeltaTime)
@@ -162,13 +170,16 @@ FDynamicEmitterDataBase* FParticleBeamEmitterInstance::GetDynamicData(bool bSele
 		return nullptr;
 	}
 
-	// FDynamicBeamEmitterData 생성
-	FDynamicBeamEmitterData* NewEmitterData = new FDynamicBeamEmitterData();
+	// 풀링된 FDynamicBeamEmitterData 재사용 (처음 한 번만 생성)
+	if (!PooledDynamicData)
+	{
+		PooledDynamicData = new FDynamicBeamEmitterData();
+	}
+	FDynamicBeamEmitterData* NewEmitterData = static_cast<FDynamicBeamEmitterData*>(PooledDynamicData);
 
 	// Source 데이터 채우기
 	if (!FillReplayData(NewEmitterData->Source))
 	{
-		delete NewEmitterData;
 		return nullptr;
 	}
 
@@ -193,11 +204,15 @@ bool FParticleBeamEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBase&
 	if (CurrentLODLevel && CurrentLODLevel->RequiredModule)
 	{
 		BeamData.MaterialInterface = CurrentLODLevel->RequiredModule->GetMaterial();
-		BeamData.RequiredModule = CurrentLODLevel->RequiredModule->CreateRendererResource();
+		if (!BeamData.RequiredModule)
+		{
+			BeamData.RequiredModule = new FParticleRequiredModule();
+		}
+		CurrentLODLevel->RequiredModule->FillRendererResource(*BeamData.RequiredModule);
 		BeamData.BlendMode = CurrentLODLevel->RequiredModule->GetBlendMode();
 	}
 
-	// 빔 포인트 복사
+	// 빔 포인트 복사 (풀링된 배열의 용량을 재사용)
 	BeamData.BeamPoints = BeamPoints;
 
 	// 빔 설정
@@ -278,7 +293,7 @@ void FParticleBeamEmitterInstance::CalculateBeamPoints()
 	}
 
 	// 빔 폭 가져오기
-	float BaseWidth = BeamTypeData->BeamWidth.GetValue();
+	float BaseWidth = BeamTypeData->BeamWidth.GetValue(RandomStream);
 
 	// 각 포인트 계산
 	for (int32 i = 0; i < NumPoints; ++i)
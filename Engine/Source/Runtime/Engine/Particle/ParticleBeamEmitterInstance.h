@@ -54,6 +54,16 @@ struct FParticleBeamEmitterInstance : public FParticleEmitterInstance
 	 */
 	virtual void Init(UParticleEmitter* InTemplate, UParticleSystemComponent* InComponent) override;
 
+	/**
+	 * 풀에서 꺼낸 인스턴스 재사용 (빔 모듈/GPU 버퍼는 유지, 노이즈 시간과 빔 포인트만 새 컴포넌트 기준으로)
+	 */
+	virtual void Reuse(UParticleSystemComponent* InComponent) override;
+
+	/**
+	 * 빔은 파티클 수로 수명을 관리하지 않으므로 자동 비활성화 대상이 아님
+	 */
+	virtual bool IsComplete() const override { return false; }
+
 	/**
 	 * 파티클 Tick (빔은 위치 고정이므로 물리 시뮬레이션 없음)
 	 */
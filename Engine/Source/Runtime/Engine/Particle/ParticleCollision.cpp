@@ -0,0 +1,549 @@
+#include "pch.h"
+#include "ParticleCollision.h"
+#include "ParticleEmitterInstance.h"
+#include "Collision/ParticleModuleCollision.h"
+#include "TypeData/ParticleModuleTypeDataBase.h"
+#include "BVHierarchy.h"
+#include "WorldPartitionManager.h"
+#include "ParticleStats.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 충돌 검사에 필요한 필드만 읽은 파티클 (로컬 공간 에미터도 월드 공간으로 변환)
+	struct FParticleCollisionView
+	{
+		FVector Location;
+		FVector OldLocation;
+		float Radius = 0.0f;
+		uint32 Flags = 0;
+	};
+
+	void ReadParticle(const FParticleEmitterInstance* Instance, int32 ActiveIndex, float RadiusScale,
+		bool bLocalSpace, const FTransform& ComponentToWorld, FParticleCollisionView& Out)
+	{
+		FVector Size;
+		if (Instance->bUseSoALayout)
+		{
+			// SoA는 파티클 전체를 모으지 않고 필요한 스트림만 읽음
+			const FParticleSoAData& SoA = Instance->SoAData;
+			Out.Location = SoA.GetLocation(ActiveIndex);
+			Out.OldLocation = FVector(SoA.GetStream(FParticleSoAData::Stream_OldLocationX)[ActiveIndex],
+				SoA.GetStream(FParticleSoAData::Stream_OldLocationY)[ActiveIndex],
+				SoA.GetStream(FParticleSoAData::Stream_OldLocationZ)[ActiveIndex]);
+			Size = FVector(SoA.GetStream(FParticleSoAData::Stream_SizeX)[ActiveIndex],
+				SoA.GetStream(FParticleSoAData::Stream_SizeY)[ActiveIndex],
+				SoA.GetStream(FParticleSoAData::Stream_SizeZ)[ActiveIndex]);
+			Out.Flags = SoA.GetFlags()[ActiveIndex];
+		}
+		else
+		{
+			const FBaseParticle& Particle = *reinterpret_cast<const FBaseParticle*>(
+				Instance->ParticleData + Instance->ParticleIndices[ActiveIndex] * Instance->ParticleStride);
+			Out.Location = Particle.Location;
+			Out.OldLocation = Particle.OldLocation;
+			Size = Particle.Size;
+			Out.Flags = static_cast<uint32>(Particle.Flags);
+		}
+
+		if (bLocalSpace)
+		{
+			Out.Location = ComponentToWorld.TransformPosition(Out.Location);
+			Out.OldLocation = ComponentToWorld.TransformPosition(Out.OldLocation);
+		}
+		Out.Radius = std::max(std::abs(Size.X), std::max(std::abs(Size.Y), std::abs(Size.Z))) * RadiusScale;
+	}
+
+	// 충돌하지 않은 파티클: 여기까지 검사했으므로 마지막 검사 위치를 현재 위치로
+	void CommitLocation(FParticleEmitterInstance* Instance, int32 ActiveIndex)
+	{
+		if (Instance->bUseSoALayout)
+		{
+			const FParticleSoAData& SoA = Instance->SoAData;
+			SoA.GetStream(FParticleSoAData::Stream_OldLocationX)[ActiveIndex] = SoA.GetStream(FParticleSoAData::Stream_LocationX)[ActiveIndex];
+			SoA.GetStream(FParticleSoAData::Stream_OldLocationY)[ActiveIndex] = SoA.GetStream(FParticleSoAData::Stream_LocationY)[ActiveIndex];
+			SoA.GetStream(FParticleSoAData::Stream_OldLocationZ)[ActiveIndex] = SoA.GetStream(FParticleSoAData::Stream_LocationZ)[ActiveIndex];
+		}
+		else
+		{
+			FBaseParticle& Particle = *reinterpret_cast<FBaseParticle*>(
+				Instance->ParticleData + Instance->ParticleIndices[ActiveIndex] * Instance->ParticleStride);
+			Particle.OldLocation = Particle.Location;
+		}
+	}
+
+	// 반응을 적용할 파티클 (AoS는 제자리, SoA는 Scratch에 모은 사본이라 StoreParticle로 되돌려야 함)
+	FBaseParticle* LoadParticle(FParticleEmitterInstance* Instance, int32 ActiveIndex, TArray<uint8>& Scratch)
+	{
+		if (Instance->bUseSoALayout)
+		{
+			if (Scratch.Num() < Instance->ParticleStride)
+			{
+				Scratch.SetNum(Instance->ParticleStride);
+			}
+			Instance->SoAData.LoadParticle(ActiveIndex, Scratch.GetData());
+			return reinterpret_cast<FBaseParticle*>(Scratch.GetData());
+		}
+		return reinterpret_cast<FBaseParticle*>(Instance->ParticleData + Instance->ParticleIndices[ActiveIndex] * Instance->ParticleStride);
+	}
+
+	void StoreParticle(FParticleEmitterInstance* Instance, int32 ActiveIndex, const FBaseParticle* Particle)
+	{
+		if (Instance->bUseSoALayout)
+		{
+			Instance->SoAData.StoreParticle(ActiveIndex, reinterpret_cast<const uint8*>(Particle));
+		}
+	}
+
+	// 높이장 설정을 쓸 수 있는 범위로 (NeedsRebuild와 BeginBuild가 같은 값을 비교하도록)
+	void GetHeightFieldParams(const FParticleCollisionSettings& Settings, int32& OutResolution, float& OutCellSize, float& OutTraceHeight)
+	{
+		OutResolution = std::clamp(Settings.HeightFieldResolution, 2, 256);
+		OutCellSize = std::max(1.0f, Settings.HeightFieldCellSize);
+		OutTraceHeight = std::max(1.0f, Settings.HeightFieldTraceHeight);
+	}
+}
+
+// ============================================================================
+// FParticleCollisionHeightField
+// ============================================================================
+
+bool FParticleCollisionHeightField::NeedsRebuild(const FVector& Center, const FParticleCollisionSettings& Settings) const
+{
+	int32 NewResolution;
+	float NewCellSize, NewTraceHeight;
+	GetHeightFieldParams(Settings, NewResolution, NewCellSize, NewTraceHeight);
+
+	if (!bValid || Resolution != NewResolution || CellSize != NewCellSize || TraceHeight != NewTraceHeight)
+	{
+		return true;
+	}
+	if (Settings.HeightFieldRefreshInterval > 0.0f && TimeSinceBuild >= Settings.HeightFieldRefreshInterval)
+	{
+		return true;
+	}
+
+	const float HalfSpan = 0.5f * CellSize * static_cast<float>(Resolution - 1);
+	return std::abs(Center.X - (Origin.X + HalfSpan)) > CellSize
+		|| std::abs(Center.Y - (Origin.Y + HalfSpan)) > CellSize
+		|| std::abs(Center.Z - Origin.Z) > TraceHeight * 0.5f;
+}
+
+void FParticleCollisionHeightField::BeginBuild(const FVector& Center, const FParticleCollisionSettings& Settings, const AActor* IgnoreActor, TArray<FBVHRayQuery>& OutQueries)
+{
+	GetHeightFieldParams(Settings, Resolution, CellSize, TraceHeight);
+
+	// 격자를 셀 크기에 스냅해 에미터가 조금 움직여도 같은 샘플 위치를 씀
+	const float HalfSpan = 0.5f * CellSize * static_cast<float>(Resolution - 1);
+	Origin = FVector(std::floor(Center.X / CellSize) * CellSize - HalfSpan, std::floor(Center.Y / CellSize) * CellSize - HalfSpan, Center.Z);
+
+	Heights.SetNum(Resolution * Resolution);
+	TimeSinceBuild = 0.0f;
+	bValid = false;
+
+	for (int32 Y = 0; Y < Resolution; ++Y)
+	{
+		for (int32 X = 0; X < Resolution; ++X)
+		{
+			const FVector Top(Origin.X + X * CellSize, Origin.Y + Y * CellSize, Origin.Z + TraceHeight);
+			OutQueries.Add(FBVHRayQuery::MakeSegment(Top, Top - FVector(0.0f, 0.0f, 2.0f * TraceHeight), IgnoreActor));
+		}
+	}
+}
+
+void FParticleCollisionHeightField::FinishBuild(const FBVHRayHit* InHits)
+{
+	for (int32 i = 0; i < Heights.Num(); ++i)
+	{
+		Heights[i] = InHits[i].IsValidHit() ? InHits[i].Location.Z : NoGround;
+	}
+	bValid = true;
+}
+
+bool FParticleCollisionHeightField::Sample(float X, float Y, float& OutHeight, FVector& OutNormal) const
+{
+	if (!bValid)
+	{
+		return false;
+	}
+
+	const float FX = (X - Origin.X) / CellSize;
+	const float FY = (Y - Origin.Y) / CellSize;
+	if (FX < 0.0f || FY < 0.0f)
+	{
+		return false;
+	}
+
+	const int32 IX = static_cast<int32>(FX);
+	const int32 IY = static_cast<int32>(FY);
+	if (IX >= Resolution - 1 || IY >= Resolution - 1)
+	{
+		return false;
+	}
+
+	const float H00 = Heights[IY * Resolution + IX];
+	const float H10 = Heights[IY * Resolution + IX + 1];
+	const float H01 = Heights[(IY + 1) * Resolution + IX];
+	const float H11 = Heights[(IY + 1) * Resolution + IX + 1];
+	if (H00 == NoGround || H10 == NoGround || H01 == NoGround || H11 == NoGround)
+	{
+		return false;
+	}
+
+	// 쌍선형 보간 높이와 그 기울기로 만든 법선
+	const float TX = FX - static_cast<float>(IX);
+	const float TY = FY - static_cast<float>(IY);
+	const float Bottom = H00 + (H10 - H00) * TX;
+	const float Top = H01 + (H11 - H01) * TX;
+	OutHeight = Bottom + (Top - Bottom) * TY;
+
+	const float SlopeX = ((H10 - H00) * (1.0f - TY) + (H11 - H01) * TY) / CellSize;
+	const float SlopeY = ((H01 - H00) * (1.0f - TX) + (H11 - H10) * TX) / CellSize;
+	OutNormal = FVector(-SlopeX, -SlopeY, 1.0f).GetNormalized();
+	return true;
+}
+
+// ============================================================================
+// FParticleCollisionSolver
+// ============================================================================
+
+FParticleCollisionSolver::FParticleCollisionSolver() = default;
+FParticleCollisionSolver::~FParticleCollisionSolver() = default;
+
+void FParticleCollisionSolver::AddEmitter(FParticleEmitterInstance* Instance, int32 EmitterIndex, float DeltaTime)
+{
+	if (!Instance || !Instance->CurrentLODLevel || !Instance->Component || !Instance->HasParticleStorage())
+	{
+		return;
+	}
+
+	// 빔은 파티클 위치가 빔의 제어점이므로 충돌하지 않음
+	UParticleModuleTypeDataBase* TypeData = Instance->CurrentLODLevel->TypeDataModule;
+	if (TypeData && Cast<UParticleModuleTypeDataBeam>(TypeData))
+	{
+		return;
+	}
+
+	const UParticleModuleCollision* Module = UParticleModuleCollision::Find(Instance);
+	const UParticleModuleTypeDataMesh* MeshTypeData = TypeData ? Cast<UParticleModuleTypeDataMesh>(TypeData) : nullptr;
+	if (!Module && !(MeshTypeData && MeshTypeData->DoCollisions))
+	{
+		return;
+	}
+
+	if (NumEntries >= Entries.Num())
+	{
+		Entries.SetNum(NumEntries + 1);
+	}
+	FEmitterEntry& Entry = Entries[NumEntries++];
+	Entry.Instance = Instance;
+	Entry.EmitterIndex = EmitterIndex;
+	Entry.Settings = Module ? Module->Settings : FParticleCollisionSettings();
+	Entry.CollisionPayloadOffset = Module ? Module->GetPayloadOffset(Instance) : INDEX_NONE;
+	Entry.bLocalSpace = Instance->CurrentLODLevel->RequiredModule && Instance->CurrentLODLevel->RequiredModule->IsUseLocalSpace();
+	Entry.ComponentToWorld = Instance->Component->GetWorldTransform();
+	Entry.WorldToComponent = Entry.ComponentToWorld.Inverse();
+	Entry.IgnoreActor = Instance->Component->GetOwner();
+	Entry.DeltaTime = DeltaTime;
+	Entry.FirstQuery = 0;
+	Entry.NumQueries = 0;
+	Entry.FirstHeightFieldQuery = 0;
+	Entry.NumHeightFieldQueries = 0;
+	Entry.NumHits = 0;
+}
+
+void FParticleCollisionSolver::Solve(UWorldPartitionManager* Partition, FParticleSimulationStats& Stats)
+{
+	if (NumEntries == 0)
+	{
+		return;
+	}
+
+	FScopeCycleCounter Counter;
+
+	// ========== 1단계: 에미터별 세그먼트/높이장 쿼리 수집 ==========
+	Queries.Empty();
+	QueryParticles.Empty();
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		FEmitterEntry& Entry = Entries[EntryIndex];
+		Entry.Events.Empty();
+		Entry.Kills.Empty();
+		Entry.NumHits = 0;
+		if (Partition)
+		{
+			GatherSegments(Entry, Stats);
+		}
+	}
+
+	if (!Partition)
+	{
+		NumEntries = 0;
+		return;
+	}
+
+	// ========== 2단계: 모든 에미터의 쿼리를 한 번에 판정 ==========
+	if (!Queries.IsEmpty())
+	{
+		Partition->RayQueryBatch(Queries, Hits, EBVHRayQueryMode::ClosestHit);
+	}
+
+	// ========== 3단계: 에미터별 반응 (에미터끼리 공유 상태 없음) ==========
+	ParallelFor(NumEntries, [this](int32 EntryIndex)
+	{
+		SolveEmitter(Entries[EntryIndex]);
+	});
+
+	Stats.CollisionEmitters += static_cast<uint32>(NumEntries);
+	Stats.CollisionQueries += static_cast<uint32>(Queries.Num());
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		Stats.CollisionHits += Entries[EntryIndex].NumHits;
+		Stats.CollisionEvents += static_cast<uint32>(Entries[EntryIndex].Events.Num());
+	}
+	Stats.CollisionTimeMS += Counter.Finish();
+}
+
+void FParticleCollisionSolver::GatherSegments(FEmitterEntry& Entry, FParticleSimulationStats& Stats)
+{
+	FParticleEmitterInstance* Instance = Entry.Instance;
+	const FParticleCollisionSettings& Settings = Entry.Settings;
+	Entry.FirstQuery = Queries.Num();
+
+	if (Settings.Mode == EParticleCollisionMode::HeightField)
+	{
+		// 파티클은 높이장과만 비교하므로 다시 샘플링할 때만 격자점 레이를 넣음
+		FParticleCollisionHeightField& HeightField = Instance->CollisionHeightField;
+		HeightField.TimeSinceBuild += Entry.DeltaTime;
+
+		const FVector Center = Entry.ComponentToWorld.Translation;
+		if (HeightField.NeedsRebuild(Center, Settings))
+		{
+			Entry.FirstHeightFieldQuery = Queries.Num();
+			HeightField.BeginBuild(Center, Settings, Entry.IgnoreActor, Queries);
+			Entry.NumHeightFieldQueries = Queries.Num() - Entry.FirstHeightFieldQuery;
+			while (QueryParticles.Num() < Queries.Num())
+			{
+				QueryParticles.Add(INDEX_NONE);
+			}
+			++Stats.HeightFieldRebuilds;
+		}
+		return;
+	}
+
+	const int32 NumParticles = Instance->ActiveParticles;
+	if (NumParticles <= 0)
+	{
+		return;
+	}
+
+	// 예산만큼 커서부터 돌아가며 검사 (나머지는 OldLocation이 그대로라 다음 차례에 밀린 구간 전체를 검사)
+	const int32 Budget = Settings.MaxQueriesPerFrame > 0 ? std::min(NumParticles, Settings.MaxQueriesPerFrame) : NumParticles;
+	const int32 Start = Instance->CollisionCursor % NumParticles;
+
+	FParticleCollisionView View;
+	for (int32 Step = 0; Step < Budget; ++Step)
+	{
+		const int32 ActiveIndex = (Start + Step) % NumParticles;
+		ReadParticle(Instance, ActiveIndex, Settings.RadiusScale, Entry.bLocalSpace, Entry.ComponentToWorld, View);
+		if (View.Flags & STATE_Particle_CollisionIgnoreCheck)
+		{
+			continue;
+		}
+
+		const FVector Delta = View.Location - View.OldLocation;
+		const float Length = Delta.Size();
+		if (Length <= KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		// 반지름만큼 늘려 표면에 파고들기 전에 닿게 함
+		const FVector Direction = Delta / Length;
+		Queries.Add(FBVHRayQuery::MakeSegment(View.OldLocation, View.Location + Direction * View.Radius, Entry.IgnoreActor));
+		QueryParticles.Add(ActiveIndex);
+	}
+
+	Entry.NumQueries = Queries.Num() - Entry.FirstQuery;
+	Instance->CollisionCursor = (Start + Budget) % NumParticles;
+	Stats.DeferredCollisionQueries += static_cast<uint32>(NumParticles - Budget);
+}
+
+void FParticleCollisionSolver::SolveEmitter(FEmitterEntry& Entry) const
+{
+	FParticleEmitterInstance* Instance = Entry.Instance;
+
+	if (Entry.NumHeightFieldQueries > 0)
+	{
+		Instance->CollisionHeightField.FinishBuild(Hits.GetData() + Entry.FirstHeightFieldQuery);
+	}
+
+	if (Entry.Settings.Mode == EParticleCollisionMode::HeightField)
+	{
+		SolveHeightField(Entry);
+	}
+	else
+	{
+		for (int32 QueryIndex = Entry.FirstQuery; QueryIndex < Entry.FirstQuery + Entry.NumQueries; ++QueryIndex)
+		{
+			const int32 ActiveIndex = QueryParticles[QueryIndex];
+			const FBVHRayHit& Hit = Hits[QueryIndex];
+			if (!Hit.IsValidHit())
+			{
+				CommitLocation(Instance, ActiveIndex);
+				continue;
+			}
+
+			FBaseParticle* Particle = LoadParticle(Instance, ActiveIndex, Entry.Scratch);
+			const float Radius = std::max(std::abs(Particle->Size.X), std::max(std::abs(Particle->Size.Y), std::abs(Particle->Size.Z))) * Entry.Settings.RadiusScale;
+			Respond(Entry, ActiveIndex, *Particle, Hit.Location + Hit.Normal * Radius, Hit.Normal, Hit.Component);
+			StoreParticle(Instance, ActiveIndex, Particle);
+		}
+	}
+
+	if (!Entry.Kills.IsEmpty())
+	{
+		// Swap-and-Pop이므로 뒤에서부터 제거
+		std::sort(Entry.Kills.begin(), Entry.Kills.end(), std::greater<int32>());
+		for (int32 ActiveIndex : Entry.Kills)
+		{
+			Instance->KillParticle(ActiveIndex);
+		}
+	}
+
+	if (Entry.NumHits > 0)
+	{
+		Instance->UpdateParticleBounds();
+	}
+}
+
+void FParticleCollisionSolver::SolveHeightField(FEmitterEntry& Entry) const
+{
+	FParticleEmitterInstance* Instance = Entry.Instance;
+	const FParticleCollisionHeightField& HeightField = Instance->CollisionHeightField;
+	if (!HeightField.bValid)
+	{
+		return;
+	}
+
+	FParticleCollisionView View;
+	for (int32 ActiveIndex = 0; ActiveIndex < Instance->ActiveParticles; ++ActiveIndex)
+	{
+		ReadParticle(Instance, ActiveIndex, Entry.Settings.RadiusScale, Entry.bLocalSpace, Entry.ComponentToWorld, View);
+		if (View.Flags & STATE_Particle_CollisionIgnoreCheck)
+		{
+			continue;
+		}
+
+		float Height;
+		FVector Normal;
+		if (!HeightField.Sample(View.Location.X, View.Location.Y, Height, Normal) || View.Location.Z - View.Radius >= Height)
+		{
+			CommitLocation(Instance, ActiveIndex);
+			continue;
+		}
+
+		// 지난 검사 때 이미 지면 아래였던 파티클(지하 스폰, 높이장 밖에서 들어온 경우)은 밀어 올리지 않음
+		float OldHeight;
+		FVector OldNormal;
+		const bool bWasAbove = !HeightField.Sample(View.OldLocation.X, View.OldLocation.Y, OldHeight, OldNormal)
+			|| View.OldLocation.Z - View.Radius >= OldHeight - HeightField.CellSize * 0.25f;
+		if (!bWasAbove)
+		{
+			CommitLocation(Instance, ActiveIndex);
+			continue;
+		}
+
+		FBaseParticle* Particle = LoadParticle(Instance, ActiveIndex, Entry.Scratch);
+		Respond(Entry, ActiveIndex, *Particle, FVector(View.Location.X, View.Location.Y, Height + View.Radius), Normal, nullptr);
+		StoreParticle(Instance, ActiveIndex, Particle);
+	}
+}
+
+void FParticleCollisionSolver::Respond(FEmitterEntry& Entry, int32 ActiveIndex, FBaseParticle& Particle,
+	const FVector& Contact, const FVector& Normal, UPrimitiveComponent* HitComponent) const
+{
+	const FParticleCollisionSettings& Settings = Entry.Settings;
+	++Entry.NumHits;
+	Particle.Flags |= STATE_Particle_CollisionHasOccurred;
+
+	FVector Velocity = Entry.bLocalSpace ? Entry.ComponentToWorld.TransformVector(Particle.Velocity) : Particle.Velocity;
+
+	if (Settings.bGenerateEvents && Entry.Events.Num() < Settings.MaxEventsPerFrame)
+	{
+		FParticleCollisionEvent Event;
+		Event.EmitterIndex = Entry.EmitterIndex;
+		Event.Location = Contact;
+		Event.Normal = Normal;
+		Event.Velocity = Velocity;
+		Event.HitComponent = HitComponent;
+		Entry.Events.Add(Event);
+	}
+
+	bool bKill = false;
+	bool bFreeze = false;
+	bool bHaltCollisions = false;
+	switch (Settings.Response)
+	{
+	case EParticleCollisionResponse::Bounce:
+	{
+		// 법선 성분은 Restitution만큼 뒤집고 접선 성분은 Friction만큼 감쇠
+		const float NormalSpeed = FVector::Dot(Velocity, Normal);
+		if (NormalSpeed < 0.0f)
+		{
+			const FVector NormalVelocity = Normal * NormalSpeed;
+			const FVector TangentVelocity = Velocity - NormalVelocity;
+			Velocity = TangentVelocity * (1.0f - std::clamp(Settings.Friction, 0.0f, 1.0f)) - NormalVelocity * std::max(0.0f, Settings.Restitution);
+		}
+		break;
+	}
+	case EParticleCollisionResponse::Stick:
+		bFreeze = true;
+		break;
+	case EParticleCollisionResponse::Kill:
+		bKill = true;
+		break;
+	}
+
+	if (!bKill && Settings.MaxCollisions > 0 && Entry.CollisionPayloadOffset != INDEX_NONE)
+	{
+		FParticleCollisionPayload* Payload = reinterpret_cast<FParticleCollisionPayload*>(reinterpret_cast<uint8*>(&Particle) + Entry.CollisionPayloadOffset);
+		if (++Payload->UsedCollisions >= Settings.MaxCollisions)
+		{
+			switch (Settings.CollisionCompletion)
+			{
+			case EParticleCollisionComplete::Kill:
+				bKill = true;
+				break;
+			case EParticleCollisionComplete::Freeze:
+				bFreeze = true;
+				break;
+			case EParticleCollisionComplete::HaltCollisions:
+				bHaltCollisions = true;
+				break;
+			}
+		}
+	}
+
+	if (bKill)
+	{
+		Entry.Kills.Add(ActiveIndex);
+		return;
+	}
+
+	if (bFreeze)
+	{
+		Velocity = FVector::Zero();
+		Particle.Flags |= STATE_Particle_FreezeTranslation | STATE_Particle_IgnoreCollisions;
+	}
+	if (bHaltCollisions)
+	{
+		Particle.Flags |= STATE_Particle_IgnoreCollisions;
+	}
+
+	Particle.Location = Entry.bLocalSpace ? Entry.WorldToComponent.TransformPosition(Contact) : Contact;
+	Particle.OldLocation = Particle.Location;
+	Particle.Velocity = Entry.bLocalSpace ? Entry.WorldToComponent.TransformVector(Velocity) : Velocity;
+	Particle.BaseVelocity = Particle.Velocity;
+}
@@ -0,0 +1,182 @@
+#pragma once
+#include "ParticleTypes.h"
+
+struct FParticleEmitterInstance;
+struct FBaseParticle;
+struct FBVHRayQuery;
+struct FBVHRayHit;
+struct FParticleSimulationStats;
+class UPrimitiveComponent;
+class UWorldPartitionManager;
+class AActor;
+
+/**
+ * @brief 파티클 충돌 설정 (UParticleModuleCollision이 소유, 메시 TypeData의 DoCollisions만 켜져 있으면 기본값 사용)
+ */
+struct FParticleCollisionSettings
+{
+	EParticleCollisionResponse Response = EParticleCollisionResponse::Bounce;
+
+	/** 법선 방향 속도 유지 비율 (0 = 튕기지 않음, 1 = 완전 탄성) */
+	float Restitution = 0.5f;
+
+	/** 접선 방향 속도 감쇠 비율 (0 = 미끄러짐, 1 = 접선 속도 제거) */
+	float Friction = 0.2f;
+
+	/** 파티클 크기 대비 충돌 반지름 (세그먼트를 이만큼 늘려 미리 닿고, 표면에서 이만큼 띄움) */
+	float RadiusScale = 0.5f;
+
+	/** 파티클 하나가 충돌할 수 있는 횟수 (0이면 제한 없음, 충돌 모듈이 있을 때만 사용) */
+	int32 MaxCollisions = 0;
+	EParticleCollisionComplete CollisionCompletion = EParticleCollisionComplete::Kill;
+
+	/** 에미터당 프레임 세그먼트 쿼리 상한 (0이면 제한 없음), 넘는 파티클은 다음 프레임에 이어서 검사 */
+	int32 MaxQueriesPerFrame = 512;
+
+	/** 충돌 이벤트 발행 (UParticleSystemComponent::OnParticleCollide → Lua OnParticleCollision) */
+	bool bGenerateEvents = false;
+
+	/** 에미터당 프레임 이벤트 상한 (Lua 호출 비용 제한) */
+	int32 MaxEventsPerFrame = 16;
+
+	EParticleCollisionMode Mode = EParticleCollisionMode::SceneBVH;
+
+	// 높이장 모드 (에미터 위치를 중심으로 Resolution x Resolution 격자)
+	int32 HeightFieldResolution = 32;
+	float HeightFieldCellSize = 100.0f;
+	float HeightFieldTraceHeight = 2000.0f;		// 에미터 높이 기준 위/아래로 샘플링할 범위
+	float HeightFieldRefreshInterval = 0.0f;	// 다시 샘플링할 주기 (초, 0이면 에미터가 움직였을 때만)
+};
+
+/**
+ * @brief 충돌 모듈의 파티클별 Payload
+ */
+struct FParticleCollisionPayload
+{
+	int32 UsedCollisions;
+};
+
+/**
+ * @brief 파티클 충돌 이벤트 한 건 (모두 월드 공간)
+ */
+struct FParticleCollisionEvent
+{
+	int32 EmitterIndex = 0;
+	FVector Location;
+	FVector Normal;
+	FVector Velocity;								// 충돌 직전 속도
+	UPrimitiveComponent* HitComponent = nullptr;	// 높이장 모드에서는 nullptr
+};
+
+/**
+ * @brief 에미터 주변 지형을 BVH로 한 번 샘플링해 둔 거친 높이장 (에미터 인스턴스 소유)
+ * @details 격자점마다 아래로 레이를 쏴 가장 높은 면의 높이를 저장하고, 파티클은 쌍선형 보간한 높이와 비교만 한다.
+ *          동굴/다리 아래처럼 위에 덮인 면이 있는 곳이나 벽은 표현하지 못하므로 비/불꽃 같은 대량 파티클용.
+ */
+struct FParticleCollisionHeightField
+{
+	static constexpr float NoGround = -std::numeric_limits<float>::max();
+
+	FVector Origin;				// (0, 0) 격자점의 월드 위치 (Z는 빌드할 때의 에미터 높이)
+	float CellSize = 0.0f;
+	float TraceHeight = 0.0f;
+	int32 Resolution = 0;
+	TArray<float> Heights;		// Resolution * Resolution, 바닥이 없으면 NoGround
+	float TimeSinceBuild = 0.0f;
+	bool bValid = false;
+
+	/** 에미터가 격자 한 칸 이상 움직였거나 설정/주기가 바뀌었으면 true */
+	bool NeedsRebuild(const FVector& Center, const FParticleCollisionSettings& Settings) const;
+
+	/** 격자를 Center에 맞추고 격자점마다 아래로 내려가는 쿼리를 OutQueries에 추가 */
+	void BeginBuild(const FVector& Center, const FParticleCollisionSettings& Settings, const AActor* IgnoreActor, TArray<FBVHRayQuery>& OutQueries);
+
+	/** BeginBuild로 추가한 쿼리의 결과로 높이 채움 (Hits는 그 쿼리 구간의 시작) */
+	void FinishBuild(const FBVHRayHit* Hits);
+
+	/**
+	 * 월드 XY 위치의 지면 높이와 법선
+	 * @return 격자 밖이거나 주변 격자점 중 바닥이 없는 곳이 있으면 false
+	 */
+	bool Sample(float X, float Y, float& OutHeight, FVector& OutNormal) const;
+};
+
+/**
+ * @brief 시뮬레이션 단계 뒤에 도는 파티클 충돌 처리기 (FParticleSimulationManager 소유)
+ * @details 파티션 BVH 배치 쿼리는 게임 스레드에서만 호출할 수 있으므로 워커의 에미터 시뮬레이션과 분리했다.
+ *          1. 수집: 충돌 에미터마다 (마지막 검사 위치 → 현재 위치) 세그먼트를 MaxQueriesPerFrame개까지 모음
+ *             - 예산을 넘는 파티클은 다음 프레임에 커서 위치부터 이어서 검사 (마지막 검사 위치가 남아 있어 빠뜨리지 않음)
+ *             - 높이장 모드는 다시 샘플링할 때만 격자점 레이를 같은 배치에 넣음
+ *          2. 판정: 모든 에미터의 쿼리를 한 번의 RayQueryBatch로 처리 (BVH가 내부에서 패킷 단위로 병렬화)
+ *          3. 반응: 에미터별로 ParallelFor (반사/마찰/고정/제거, 이벤트 수집)
+ *
+ * 파티클의 OldLocation을 마지막으로 충돌을 검사한 위치로 사용한다 (스폰 시 스폰 위치).
+ */
+class FParticleCollisionSolver
+{
+public:
+	FParticleCollisionSolver();
+	~FParticleCollisionSolver();
+
+	FParticleCollisionSolver(const FParticleCollisionSolver&) = delete;
+	FParticleCollisionSolver& operator=(const FParticleCollisionSolver&) = delete;
+
+	/**
+	 * 이번 단계에 충돌을 처리할 에미터 등록 (충돌 모듈이 없고 메시 TypeData의 DoCollisions도 꺼져 있으면 무시)
+	 * @param DeltaTime - 이번 단계에 진행한 시간 (높이장 갱신 주기용)
+	 */
+	void AddEmitter(FParticleEmitterInstance* Instance, int32 EmitterIndex, float DeltaTime);
+
+	/** 등록된 에미터의 충돌 처리 (Partition이 없으면 높이장도 만들 수 없으므로 아무것도 하지 않음) */
+	void Solve(UWorldPartitionManager* Partition, FParticleSimulationStats& Stats);
+
+	/** 등록 해제 (이벤트는 다음 Solve까지 남아 있음) */
+	void Reset() { NumEntries = 0; }
+
+	int32 GetNumEmitters() const { return NumEntries; }
+	FParticleEmitterInstance* GetInstance(int32 Index) const { return Entries[Index].Instance; }
+	const TArray<FParticleCollisionEvent>& GetEvents(int32 Index) const { return Entries[Index].Events; }
+
+private:
+	struct FEmitterEntry
+	{
+		FParticleEmitterInstance* Instance = nullptr;
+		int32 EmitterIndex = 0;
+		FParticleCollisionSettings Settings;
+		int32 CollisionPayloadOffset = INDEX_NONE;	// INDEX_NONE이면 충돌 횟수를 세지 않음
+		bool bLocalSpace = false;
+		FTransform ComponentToWorld;
+		FTransform WorldToComponent;
+		const AActor* IgnoreActor = nullptr;
+		float DeltaTime = 0.0f;
+
+		// Queries 안에서 이 에미터가 쓰는 구간
+		int32 FirstQuery = 0;
+		int32 NumQueries = 0;
+		int32 FirstHeightFieldQuery = 0;
+		int32 NumHeightFieldQueries = 0;
+
+		// 반응 단계 결과 (프레임 사이에 재사용)
+		TArray<FParticleCollisionEvent> Events;
+		TArray<int32> Kills;
+		TArray<uint8> Scratch;						// SoA 파티클을 풀어 둘 버퍼
+		uint32 NumHits = 0;
+	};
+
+	void GatherSegments(FEmitterEntry& Entry, FParticleSimulationStats& Stats);
+	void SolveEmitter(FEmitterEntry& Entry) const;
+	void SolveHeightField(FEmitterEntry& Entry) const;
+
+	/** 접촉 지점/법선(월드)으로 반응 적용, 제거할 파티클이면 Kills에 넣음 */
+	void Respond(FEmitterEntry& Entry, int32 ActiveIndex, FBaseParticle& Particle,
+		const FVector& Contact, const FVector& Normal, UPrimitiveComponent* HitComponent) const;
+
+	// 등록된 에미터 (앞쪽 NumEntries개만 유효, 이벤트 버퍼를 재사용하려고 줄이지 않음)
+	TArray<FEmitterEntry> Entries;
+	int32 NumEntries = 0;
+
+	// 모든 에미터의 쿼리 / 결과 / 쿼리별 파티클 활성 인덱스
+	TArray<FBVHRayQuery> Queries;
+	TArray<FBVHRayHit> Hits;
+	TArray<int32> QueryParticles;
+};
@@ -3,12 +3,16 @@
 /**
  * Container for particle data arrays
  * Manages memory allocation for particle data and indices
+ *
+ * 두 가지 모드로 동작:
+ * - 소유 모드 (Allocate/Reserve): 데이터 + 인덱스를 한 블록으로 직접 할당
+ * - 뷰 모드 (SetView): 에미터 인스턴스의 파티클 버퍼를 복사 없이 가리키기만 함 (해제하지 않음)
  */
 struct FParticleDataContainer
 {
 	/** Total size of allocated memory block in bytes */
 	// OS로부터 할당받은 메모리 덩어리 전체 바이트 크기
-	// = MaxParticles * ParticleStride + MaxParticles * sizeof(uint16)
+	// = MaxParticles * ParticleStride + MaxParticles * sizeof(uint32)
 	int32 MemBlockSize;
 
 	/** Size of particle data array in bytes */
@@ -18,10 +22,10 @@ struct FParticleDataContainer
 	// ParticleIndices 의 시작 주소를 계산하는 기준점이 됨
 	int32 ParticleDataNumBytes;
 
-	/** Size of particle indices array in shorts (uint16) */
-	// 뒤쪽 구역에 저장된 인덱스(uint16)의 개수 (바이트 크기 아님)
+	/** Number of entries in the particle indices array (uint32) */
+	// 뒤쪽 구역에 저장된 인덱스(uint32)의 개수 (바이트 크기 아님)
 	// 최대 몇개 파티클을 관리할 수 있는지 MaxCount 의미도 가짐
-	int32 ParticleIndicesNumShorts;
+	int32 ParticleIndicesNum;
 
 	/** Pointer to particle data array (also the base of the allocated memory block) */
 	// 할당된 전체 메모리 블록의 '시작 주소'
@@ -32,16 +36,20 @@ struct FParticleDataContainer
 	/** Pointer to particle indices array (located at the end of the memory block, not separately allocated) */
 	// 할당된 메모리 블록의 뒷부분,즉 인덱스 배열이 시작되는 주소를 가리킴
 	// ParticleData에서 ParticleDataNumBytes를 더한 위치를 가리키도록 세팅만 해줌
-	// 메모리 아끼려고 인덱스를 int(4바이트)대신 uint16(2바이트로 씀)
+	// 에미터당 65,535개를 넘는 파티클을 다룰 수 있도록 uint32 인덱스 사용
 	// 주의: ParticleData를 delete[] 하면 얘가 가리키던 메모리도 같이 날아가니, 절대 따로 delete하지 말 것
-	uint16* ParticleIndices;
+	uint32* ParticleIndices;
+
+	/** true면 다른 곳(에미터 인스턴스)의 메모리를 가리키는 뷰 - Free에서 해제하지 않음 */
+	bool bIsView;
 
 	FParticleDataContainer()
 		: MemBlockSize(0)
 		, ParticleDataNumBytes(0)
-		, ParticleIndicesNumShorts(0)
+		, ParticleIndicesNum(0)
 		, ParticleData(nullptr)
 		, ParticleIndices(nullptr)
+		, bIsView(false)
 	{
 	}
 
@@ -66,8 +74,8 @@ struct FParticleDataContainer
 
 		// Calculate required memory
 		ParticleDataNumBytes = InMaxParticles * InParticleStride;
-		ParticleIndicesNumShorts = InMaxParticles;
-		int32 IndicesBytes = ParticleIndicesNumShorts * sizeof(uint16);
+		ParticleIndicesNum = InMaxParticles;
+		int32 IndicesBytes = ParticleIndicesNum * sizeof(uint32);
 		MemBlockSize = ParticleDataNumBytes + IndicesBytes;
 
 		// Allocate single block for both particle data and indices
@@ -77,12 +85,79 @@ struct FParticleDataContainer
 		memset(ParticleData, 0, MemBlockSize); // 메모리 잡자마자 0으로 초기화
 
 		// ParticleIndices points to the end of ParticleData
-		ParticleIndices = reinterpret_cast<uint16*>(ParticleData + ParticleDataNumBytes);
+		ParticleIndices = reinterpret_cast<uint32*>(ParticleData + ParticleDataNumBytes);
 
 		// Initialize indices to 0, 1, 2, 3 ... (identity mapping)
-		for (int32 i = 0; i < ParticleIndicesNumShorts;++i)
+		for (int32 i = 0; i < ParticleIndicesNum;++i)
+		{
+			ParticleIndices[i] = static_cast<uint32>(i);
+		}
+	}
+	/**
+	* @brief 블록을 재사용하는 할당 (풀링된 렌더 데이터용)
+	* @details 기존 블록이 충분히 크면 해제/할당 없이 크기 정보만 바꾸고, 부족할 때만 새로 할당한다.
+	*          인덱스는 항상 데이터 바로 뒤에 0, 1, 2 ... 로 다시 채운다. 내용은 0으로 초기화하지 않으니 호출자가 채울 것.
+	*/
+	void Reserve(int32 InNumParticles, int32 InParticleStride)
+	{
+		if (InNumParticles <= 0 || InParticleStride <= 0)
+		{
+			ParticleDataNumBytes = 0;
+			ParticleIndicesNum = 0;
+			return;
+		}
+
+		const int32 RequiredBytes = InNumParticles * InParticleStride + InNumParticles * static_cast<int32>(sizeof(uint32));
+		if (bIsView || !ParticleData || MemBlockSize < RequiredBytes)
+		{
+			Allocate(InNumParticles, InParticleStride);
+			return;
+		}
+
+		ParticleDataNumBytes = InNumParticles * InParticleStride;
+		ParticleIndicesNum = InNumParticles;
+		ParticleIndices = reinterpret_cast<uint32*>(ParticleData + ParticleDataNumBytes);
+		for (int32 i = 0; i < ParticleIndicesNum; ++i)
+		{
+			ParticleIndices[i] = static_cast<uint32>(i);
+		}
+	}
+	/**
+	* @brief 외부 파티클 버퍼를 복사 없이 가리킴 (뷰 모드)
+	* @param InParticleData - 파티클 데이터 (InNumParticles * InParticleStride 바이트 이상)
+	* @param InParticleIndices - 활성 파티클 간접 인덱스 (InNumParticles개 이상)
+	* @note 가리키는 버퍼는 다음 시뮬레이션 전까지만 유효
+	*/
+	void SetView(uint8* InParticleData, uint32* InParticleIndices, int32 InNumParticles, int32 InParticleStride)
+	{
+		Free();
+
+		ParticleData = InParticleData;
+		ParticleIndices = InParticleIndices;
+		ParticleDataNumBytes = InNumParticles * InParticleStride;
+		ParticleIndicesNum = InNumParticles;
+		bIsView = true;
+	}
+	/**
+	* @brief 뷰 모드라면 가리키던 내용을 자체 블록으로 복사해 소유 모드로 전환
+	* @details 시뮬레이션이 진행돼도 내용이 바뀌면 안 되는 리플레이 데이터용
+	*/
+	void MakeOwned(int32 InParticleStride)
+	{
+		if (!bIsView)
+		{
+			return;
+		}
+
+		const uint8* SrcData = ParticleData;
+		const uint32* SrcIndices = ParticleIndices;
+		const int32 NumParticles = ParticleIndicesNum;
+
+		Allocate(NumParticles, InParticleStride);
+		if (ParticleData && SrcData)
 		{
-			ParticleIndices[i] = static_cast<uint16>(i);
+			memcpy(ParticleData, SrcData, static_cast<size_t>(NumParticles) * InParticleStride);
+			memcpy(ParticleIndices, SrcIndices, static_cast<size_t>(NumParticles) * sizeof(uint32));
 		}
 	}
 	/**
@@ -90,17 +165,18 @@ struct FParticleDataContainer
 	*/
 	void Free()
 	{
-		if (ParticleData)
+		if (ParticleData && !bIsView)
 		{
 			_aligned_free(ParticleData);
-
-			ParticleData = nullptr;
-			ParticleIndices = nullptr; // Don't delete separtely - same memory block
 		}
 
+		ParticleData = nullptr;
+		ParticleIndices = nullptr; // Don't delete separtely - same memory block
+		bIsView = false;
+
 		MemBlockSize = 0;
 		ParticleDataNumBytes = 0;
-		ParticleIndicesNumShorts = 0;
+		ParticleIndicesNum = 0;
 	}
 	/**
 	* @brief Check if memory is allocated
@@ -118,7 +194,7 @@ struct FParticleDataContainer
 	template<typename ParticleType>
 	ParticleType* GetParticle(int32 Index, int32 ParticleStride) const
 	{
-		if (!ParticleData || Index < 0 || Index >= ParticleIndicesNumShorts)
+		if (!ParticleData || Index < 0 || Index >= ParticleIndicesNum)
 		{
 			return nullptr;
 		}
@@ -26,6 +26,12 @@ UParticleEmitter::UParticleEmitter()
 {
 }
 
+void UParticleEmitter::RefreshPeakActiveParticles()
+{
+	UParticleLODLevel* LODLevel = LODLevels.empty() ? nullptr : LODLevels[0];
+	PeakActiveParticles = LODLevel ? LODLevel->CalculateMaxActiveParticleCount() : 0;
+}
+
 void UParticleEmitter::CacheEmitterModuleInfo()
 {
 	// 캐시 초기화
@@ -58,6 +58,9 @@ public:
 
 	// Functions
 	void CacheEmitterModuleInfo();
+
+	/** 스폰율/수명/버스트 값만 바뀌어도 맞도록 PeakActiveParticles만 다시 계산 (모듈 리스트는 그대로, 게임 스레드 전용) */
+	void RefreshPeakActiveParticles();
 	UParticleLODLevel* GetLODLevel(int32 LODIndex);
 	void SetEmitterName(const FString& InName);
 	bool AutogenerateLowestLODLevel(bool bDuplicateHighest = false);
@@ -2,11 +2,14 @@
 #include "pch.h"
 #include "Particle.h"
 #include "ParticleHelper.h"
+#include "ParticleSoAData.h"
+#include "ParticleCollision.h"
 #include "Source/Runtime/Core/Memory/Memory.h"
 #include "ParticleLODLevel.h"
 #include "ParticleModule.h"
 #include "ParticleEmitter.h"
 #include "DynamicEmitterReplayDataBase.h"
+#include "DynamicEmitterDataBase.h"
 #include "ParticleModuleRequired.h"
 #include "ParticleSystemComponent.h"
 
@@ -49,7 +52,8 @@ struct FParticleEmitterInstance
 	/** Pointer to the particle index array */
 	// 살아있는 파티클들의 번호(Index)가 적힌 배열
 	// ex) 3, 7, 9번 파티클이 살아있으니까 얘네만 업데이트
-	uint16* ParticleIndices;
+	// 에미터당 65,535개를 넘는 파티클을 다룰 수 있도록 uint32 사용
+	uint32* ParticleIndices;
 
 	/** Pointer to the instance data array */
 	// 인스턴스별 데이터 (파티클 개별 데이터 말고, 에미터 자체 변수 값 등)
@@ -113,6 +117,9 @@ struct FParticleEmitterInstance
 	/** 스폰 완료 여부 (모든 루프가 끝났거나 Duration 초과) */
 	bool bEmitterIsDone;
 
+	/** 이 에미터 전용 난수 스트림 (모듈의 분포 샘플링, 워커에서 시뮬레이션해도 결과가 같도록 전역 rand() 대신 사용) */
+	FParticleRandomStream RandomStream;
+
 	// GPU 리소스
 	ID3D11Buffer* VertexBuffer = nullptr;
 	ID3D11Buffer* IndexBuffer = nullptr;
@@ -120,6 +127,48 @@ struct FParticleEmitterInstance
 	// MeshRotation Payload 활성화 여부 (MeshRotation 모듈이 추가된 경우에만 true)
 	bool bMeshRotationActive = false;
 
+	// ============== SoA 레이아웃 ==============
+	/** SoA 레이아웃 사용 여부 (Init에서 RequiredModule 설정으로 결정, true면 ParticleData/ParticleIndices는 할당하지 않음) */
+	bool bUseSoALayout = false;
+
+	/** SoA 파티클 저장소 (bUseSoALayout일 때만 사용, 활성 파티클은 [0, ActiveParticles)에 빈틈없이 모여 있음) */
+	FParticleSoAData SoAData;
+
+	/**
+	 * Init 시점 0번 LOD 모듈 구성 해시 (모듈 클래스 이름 + Payload 크기를 순서대로)
+	 * Stride가 같아도 모듈 순서가 바뀌면 Payload 오프셋이 달라지므로, 파티클 바이트를 옮기기 전에 비교 (웜업 스냅샷)
+	 */
+	uint32 ModuleLayoutHash = 0;
+
+	/** 만들 때의 템플릿 풀 세대 (FParticleEmitterInstancePool, 모듈이 바뀐 뒤에는 풀로 돌아가지 않음) */
+	uint32 PoolGeneration = 0;
+
+	// ============== 렌더 데이터 풀 ==============
+	/**
+	 * 이 에미터 전용 렌더 데이터 (GetDynamicData가 처음 한 번만 만들고 매 프레임 다시 채움)
+	 * 컴포넌트의 DynamicEmitterDataArray는 이 포인터를 빌려갈 뿐 소유하지 않는다
+	 */
+	FDynamicEmitterDataBase* PooledDynamicData = nullptr;
+
+	// ============== 컬링/예산 ==============
+	/** 활성 파티클 AABB (크기만큼 확장, 시뮬레이션 직후 갱신). 파티클이 없으면 bHasParticleBounds = false */
+	FVector ParticleBoundsMin = FVector::Zero();
+	FVector ParticleBoundsMax = FVector::Zero();
+	bool bHasParticleBounds = false;
+
+	/** 이번 시뮬레이션에서 새로 만들 수 있는 파티클 수 (-1이면 제한 없음, FParticleSimulationManager가 예산으로 설정) */
+	int32 SpawnBudget = -1;
+
+	/** 이번 시뮬레이션에서 예산 때문에 만들지 못한 파티클 수 */
+	int32 NumThrottledSpawns = 0;
+
+	// ============== 충돌 (FParticleCollisionSolver) ==============
+	/** 쿼리 예산을 넘었을 때 다음 프레임에 검사를 이어갈 활성 인덱스 */
+	int32 CollisionCursor = 0;
+
+	/** 높이장 충돌 모드에서 쓰는 주변 지형 */
+	FParticleCollisionHeightField CollisionHeightField;
+
 	FParticleEmitterInstance()
 		: SpriteTemplate(nullptr)
 		, Component(nullptr)
@@ -176,6 +225,111 @@ struct FParticleEmitterInstance
 			IndexBuffer->Release();
 			IndexBuffer = nullptr;
 		}
+
+		delete PooledDynamicData;
+		PooledDynamicData = nullptr;
+	}
+
+	// ==================== 파티클 접근 (AoS/SoA 공통) ====================
+	// 모듈과 컴포넌트는 레이아웃에 상관없이 아래 함수로 활성 파티클(0 ~ ActiveParticles-1)에 접근
+
+	/** 파티클 메모리가 할당되어 있는지 (레이아웃별) */
+	bool HasParticleStorage() const
+	{
+		return bUseSoALayout ? SoAData.IsAllocated() : (ParticleData != nullptr && ParticleIndices != nullptr);
+	}
+
+	/** ActiveIndex번째 활성 파티클의 RelativeTime */
+	float GetParticleRelativeTime(int32 ActiveIndex) const
+	{
+		if (bUseSoALayout)
+		{
+			return SoAData.GetStream(FParticleSoAData::Stream_RelativeTime)[ActiveIndex];
+		}
+		return reinterpret_cast<const FBaseParticle*>(ParticleData + ParticleIndices[ActiveIndex] * ParticleStride)->RelativeTime;
+	}
+
+	/** ActiveIndex번째 활성 파티클의 위치 */
+	FVector GetParticleLocation(int32 ActiveIndex) const
+	{
+		if (bUseSoALayout)
+		{
+			return SoAData.GetLocation(ActiveIndex);
+		}
+		return reinterpret_cast<const FBaseParticle*>(ParticleData + ParticleIndices[ActiveIndex] * ParticleStride)->Location;
+	}
+
+	/** ActiveIndex번째 활성 파티클의 크기 */
+	FVector GetParticleSize(int32 ActiveIndex) const
+	{
+		if (bUseSoALayout)
+		{
+			return FVector(SoAData.GetStream(FParticleSoAData::Stream_SizeX)[ActiveIndex],
+				SoAData.GetStream(FParticleSoAData::Stream_SizeY)[ActiveIndex],
+				SoAData.GetStream(FParticleSoAData::Stream_SizeZ)[ActiveIndex]);
+		}
+		return reinterpret_cast<const FBaseParticle*>(ParticleData + ParticleIndices[ActiveIndex] * ParticleStride)->Size;
+	}
+
+	/**
+	 * 활성 파티클 AABB 갱신 (렌더러의 프러스텀 컬링용)
+	 * 스프라이트/메시가 위치에서 크기만큼 퍼지므로 가장 큰 크기 성분만큼 확장
+	 */
+	void UpdateParticleBounds()
+	{
+		bHasParticleBounds = false;
+		if (ActiveParticles <= 0 || !HasParticleStorage())
+		{
+			return;
+		}
+
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		float MaxExtent = 0.0f;
+		for (int32 i = 0; i < ActiveParticles; ++i)
+		{
+			const FVector Location = GetParticleLocation(i);
+			const FVector Size = GetParticleSize(i);
+
+			Min.X = std::min(Min.X, Location.X);
+			Min.Y = std::min(Min.Y, Location.Y);
+			Min.Z = std::min(Min.Z, Location.Z);
+			Max.X = std::max(Max.X, Location.X);
+			Max.Y = std::max(Max.Y, Location.Y);
+			Max.Z = std::max(Max.Z, Location.Z);
+			MaxExtent = std::max(MaxExtent, std::max(std::abs(Size.X), std::max(std::abs(Size.Y), std::abs(Size.Z))));
+		}
+
+		const FVector Extent(MaxExtent, MaxExtent, MaxExtent);
+		ParticleBoundsMin = Min - Extent;
+		ParticleBoundsMax = Max + Extent;
+		bHasParticleBounds = true;
+	}
+
+	/**
+	 * ActiveIndex번째 활성 파티클의 Payload 주소
+	 * @param Offset AoS 파티클 기준 오프셋 (모듈 Update에 넘어오는 Offset 그대로)
+	 */
+	uint8* GetParticlePayload(int32 ActiveIndex, int32 Offset) const
+	{
+		if (bUseSoALayout)
+		{
+			return SoAData.GetPayload(ActiveIndex) + (Offset - PayloadOffset);
+		}
+		return ParticleData + ParticleIndices[ActiveIndex] * ParticleStride + Offset;
+	}
+
+	/**
+	 * 파티클별 랜덤 시드용 고정 번호 (살아있는 동안 바뀌지 않음)
+	 * AoS는 메모리 슬롯, SoA는 제거 시 슬롯이 옮겨지므로 스폰 순번(Flags의 카운터)을 사용
+	 */
+	uint32 GetParticleSeedIndex(int32 ActiveIndex) const
+	{
+		if (bUseSoALayout)
+		{
+			return SoAData.GetFlags()[ActiveIndex] & STATE_CounterMask;
+		}
+		return ParticleIndices[ActiveIndex];
 	}
 
 	// ==================== 파티클 스폰 관련 함수 ====================
@@ -317,7 +471,7 @@ struct FParticleEmitterInstance
 	)
 	{
 		// ========== 안전성 체크 ==========
-		if (!CurrentLODLevel || !ParticleData || !ParticleIndices)
+		if (!CurrentLODLevel || !HasParticleStorage())
 		{
 			return;
 		}
@@ -342,13 +496,10 @@ struct FParticleEmitterInstance
 			// 절대 한계치 체크 (옵션)
 			// 에디터에서 설정한 PeakActiveParticles를 넘지 않도록 제한할 수 있음
 			// 현재는 제한 없이 무한 확장 가능
+			// 워커에서 호출되므로 템플릿은 읽기만 함 (PeakActiveParticles는 시뮬레이션 전에 게임 스레드에서 갱신됨)
 			if (SpriteTemplate)
 			{
-				// FIX ME: 사실 이렇게 매프레임 캐싱을 해버라면 캐싱의 의미가 없지만, PeakActiveParticles가 갱신되야 할 타이밍에 갱신이 안되서 이렇게 임시 조치를 함.
-				SpriteTemplate->CacheEmitterModuleInfo(); 
 				int32 AbsoluteLimit = SpriteTemplate->GetPeakActiveParticles();
-
-				//UE_LOG("PeakActiveParticles for Emitter: %d", AbsoluteLimit);
 				if (AbsoluteLimit > 0)
 				{
 					NewMax = FMath::Min(NewMax, AbsoluteLimit);
@@ -370,11 +521,13 @@ struct FParticleEmitterInstance
 				break;
 			}
 
-			// DECLARE_PARTICLE_PTR 매크로로 파티클 메모리 주소 계산
-			// - CurrentIndex = ParticleIndices[ActiveParticles]
-			// - ParticlePtr = ParticleData + (CurrentIndex * ParticleStride)
-			// - Particle = *((FBaseParticle*)ParticlePtr)
-			DECLARE_PARTICLE_PTR
+			// 파티클 메모리 주소 계산
+			// - AoS: DECLARE_PARTICLE_PTR와 같이 ParticleData + (ParticleIndices[ActiveParticles] * ParticleStride)
+			// - SoA: 스테이징 파티클에 AoS로 채운 뒤 PostSpawn 후에 스트림으로 흩어 넣음
+			uint8* ParticlePtr = bUseSoALayout
+				? SoAData.GetStagingParticle()
+				: ParticleData + (ParticleIndices[ActiveParticles] * ParticleStride);
+			FBaseParticle& Particle = *((FBaseParticle*)ParticlePtr);
 
 			// 이번 파티클의 스폰 시간 계산 (서브프레임 분산)
 			float SpawnTime = StartTime + (i * Increment);
@@ -405,6 +558,11 @@ struct FParticleEmitterInstance
 
 			// ========== 3단계: PostSpawn (서브프레임 보정 및 등록) ==========
 			PostSpawn(Particle, Interp, SpawnTime);
+
+			if (bUseSoALayout)
+			{
+				SoAData.StoreParticle(ActiveParticles - 1, ParticlePtr);
+			}
 		}
 	}
 
@@ -430,10 +588,15 @@ struct FParticleEmitterInstance
 		// 예: [0, 1, 2, 3, 4] 에서 2번을 죽이면 -> [0, 1, 4, 3] 이 되고 ActiveParticles = 4
 		// 이렇게 하면 중간에 빈 구멍이 안 생김 (메모리 효율)
 
-		if (Index < ActiveParticles - 1)
+		if (bUseSoALayout)
+		{
+			// SoA는 간접 인덱스 없이 마지막 파티클 데이터를 빈자리로 옮겨 [0, ActiveParticles)를 유지
+			SoAData.MoveParticle(ActiveParticles - 1, Index);
+		}
+		else if (Index < ActiveParticles - 1)
 		{
 			// 죽일 파티클의 인덱스와 마지막 파티클의 인덱스를 교환
-			uint16 Temp = ParticleIndices[Index];
+			uint32 Temp = ParticleIndices[Index];
 			ParticleIndices[Index] = ParticleIndices[ActiveParticles - 1];
 			ParticleIndices[ActiveParticles - 1] = Temp;
 		}
@@ -450,18 +613,50 @@ struct FParticleEmitterInstance
 	 *
 	 * @param DeltaTime - Time elapsed since last update (이전 프레임으로부터 경과 시간, 초 단위)
 	 *
-	 * @note Pass 1 & 2: 수명 관리 및 기본 물리 이동 (역순 순회로 안전한 Kill 처리)
+	 * @note Pass 1 & 2: 수명 관리 및 기본 물리 이동 (역순 순회로 안전한 Kill 처리, SoA는 TickSoA의 SIMD 커널)
 	 * @note Pass 3: 모듈 업데이트 실행 (모듈마다 모든 파티클을 한 번에 처리, O(M*N) 복잡도)
 	 * @note RelativeTime이 1.0 이상이면 자동으로 KillParticle 호출
 	 */
 	void Tick(float DeltaTime)
 	{
-		if (!ParticleData || !ParticleIndices || ActiveParticles <= 0)
+		if (!HasParticleStorage() || ActiveParticles <= 0)
 		{
 			return;
 		}
 
-		// --- Pass 1 & 2: 수명 관리 및 기본 물리 이동 ---
+		if (bUseSoALayout)
+		{
+			TickSoA(DeltaTime);
+		}
+		else
+		{
+			TickAoS(DeltaTime);
+		}
+
+		if (!CurrentLODLevel)
+		{
+			return;
+		}
+
+		// --- Pass 3: 모듈 업데이트 (파티클 루프 밖으로!) ---
+		// 모듈 하나가 "살아있는 모든 파티클"을 한 번에 처리 (Instruction Cache 효율 극대화)
+		// 각 모듈 내부에서 GetParticlePayload 등으로 다시 루프를 돔
+		for (int32 ModuleIndex = 0; ModuleIndex < CurrentLODLevel->UpdateModules.Num(); ModuleIndex++)
+		{
+		    UParticleModule* Module = CurrentLODLevel->UpdateModules[ModuleIndex];
+		    // LODValidity 체크: 현재 LOD에서 활성화된 모듈만 실행
+		    if (Module && Module->IsEnabled() && Module->IsUpdateModule() && Module->IsValidForLODLevel(CurrentLODLevelIndex))
+		    {
+		        Module->Update(this, PayloadOffset, DeltaTime);
+		    }
+		}
+	}
+
+	/**
+	 * Pass 1 & 2 (AoS): 파티클 하나씩 수명/위치/회전 갱신
+	 */
+	void TickAoS(float DeltaTime)
+	{
 		// BEGIN_UPDATE_LOOP 매크로 사용 (역순 순회로 안전한 Kill 처리)
 		BEGIN_UPDATE_LOOP
 
@@ -491,18 +686,29 @@ struct FParticleEmitterInstance
 		}
 
 		END_UPDATE_LOOP
+	}
 
-		// --- Pass 3: 모듈 업데이트 (파티클 루프 밖으로!) ---
-		// 모듈 하나가 "살아있는 모든 파티클"을 한 번에 처리 (Instruction Cache 효율 극대화)
-		// 각 모듈 내부에서 BEGIN_UPDATE_LOOP 매크로를 통해 다시 루프를 돔
-		for (int32 ModuleIndex = 0; ModuleIndex < CurrentLODLevel->UpdateModules.Num(); ModuleIndex++)
+	/**
+	 * Pass 1 & 2 (SoA): 스트림별 SIMD 커널로 수명/위치/회전 갱신
+	 * @note 죽은 파티클은 이동 전에 제거하므로 AoS와 결과가 같음 (수명은 Lifetime 역수를 곱하는 차이만 있음)
+	 */
+	void TickSoA(float DeltaTime)
+	{
+		SoAData.UpdateLifetime(ActiveParticles, DeltaTime);
+		ActiveParticles = SoAData.KillExpired(ActiveParticles);
+
+		SoAData.IntegrateLocation(ActiveParticles, DeltaTime);
+		SoAData.IntegrateRotation(ActiveParticles, DeltaTime);
+
+		// 메시 파티클 3D 회전은 Payload(파티클별 AoS 블록)에 있으므로 스칼라로 갱신
+		if (bMeshRotationActive && PayloadOffset > 0)
 		{
-		    UParticleModule* Module = CurrentLODLevel->UpdateModules[ModuleIndex];
-		    // LODValidity 체크: 현재 LOD에서 활성화된 모듈만 실행
-		    if (Module && Module->IsEnabled() && Module->IsUpdateModule() && Module->IsValidForLODLevel(CurrentLODLevelIndex))
-		    {
-		        Module->Update(this, PayloadOffset, DeltaTime);
-		    }
+			for (int32 i = 0; i < ActiveParticles; i++)
+			{
+				FMeshRotationPayloadData* MeshRotPayload =
+					reinterpret_cast<FMeshRotationPayloadData*>(SoAData.GetPayload(i));
+				MeshRotPayload->Rotation += MeshRotPayload->RotationRate * DeltaTime;
+			}
 		}
 	}
 
@@ -522,29 +728,40 @@ struct FParticleEmitterInstance
 			return false;
 		}
 
-		// Reallocate particle data (preserves existing data)
-		ParticleData = (uint8*)FMemory::Realloc(ParticleData, ParticleStride * NewMaxActiveParticles);
-		if (!ParticleData)
-		{
-			return false;
-		}
-
-		// Reallocate particle indices
-		if (ParticleIndices == nullptr)
+		if (bUseSoALayout)
 		{
-			// First allocation - clear max count
-			MaxActiveParticles = 0;
+			// SoA: 스트림별로 확장 (활성 파티클만 보존, 간접 인덱스 없음)
+			if (!SoAData.Reserve(NewMaxActiveParticles, ActiveParticles))
+			{
+				return false;
+			}
 		}
-		ParticleIndices = (uint16*)FMemory::Realloc(ParticleIndices, sizeof(uint16) * (NewMaxActiveParticles + 1));
-		if (!ParticleIndices)
+		else
 		{
-			return false;
-		}
+			// Reallocate particle data (preserves existing data)
+			ParticleData = (uint8*)FMemory::Realloc(ParticleData, ParticleStride * NewMaxActiveParticles);
+			if (!ParticleData)
+			{
+				return false;
+			}
 
-		// Fill in default 1:1 mapping for new indices
-		for (int32 i = MaxActiveParticles; i < NewMaxActiveParticles; i++)
-		{
-			ParticleIndices[i] = static_cast<uint16>(i);
+			// Reallocate particle indices
+			if (ParticleIndices == nullptr)
+			{
+				// First allocation - clear max count
+				MaxActiveParticles = 0;
+			}
+			ParticleIndices = (uint32*)FMemory::Realloc(ParticleIndices, sizeof(uint32) * (NewMaxActiveParticles + 1));
+			if (!ParticleIndices)
+			{
+				return false;
+			}
+
+			// Fill in default 1:1 mapping for new indices
+			for (int32 i = MaxActiveParticles; i < NewMaxActiveParticles; i++)
+			{
+				ParticleIndices[i] = static_cast<uint32>(i);
+			}
 		}
 
 		// ========== GPU 버퍼 재생성 (VertexBuffer, IndexBuffer) ==========
@@ -583,11 +800,8 @@ struct FParticleEmitterInstance
 					std::vector<FParticleSpriteVertex> InitialVertices;
 					InitialVertices.resize(MaxVertexCount);
 
-					HRESULT hr = D3D11RHI::CreateVertexBuffer<FParticleSpriteVertex>(Device, InitialVertices, &VertexBuffer);
-					if (FAILED(hr))
-					{
-						UE_LOG("Failed to resize particle sprite vertex buffer");
-					}
+					// 워커에서 호출될 수 있으므로 실패해도 로그를 남기지 않음 (버퍼가 없으면 렌더러가 그리지 않음)
+					D3D11RHI::CreateVertexBuffer<FParticleSpriteVertex>(Device, InitialVertices, &VertexBuffer);
 
 					// 2. Index Buffer 재생성 (각 파티클당 6개의 인덱스)
 					const int32 MaxIndexCount = NewMaxActiveParticles * 6;
@@ -618,11 +832,7 @@ struct FParticleEmitterInstance
 					D3D11_SUBRESOURCE_DATA IndexInitData = {};
 					IndexInitData.pSysMem = Indices.GetData();
 
-					hr = Device->CreateBuffer(&IndexBufferDesc, &IndexInitData, &IndexBuffer);
-					if (FAILED(hr))
-					{
-						UE_LOG("Failed to resize particle sprite index buffer");
-					}
+					Device->CreateBuffer(&IndexBufferDesc, &IndexInitData, &IndexBuffer);
 				}
 				else
 				{
@@ -695,10 +905,41 @@ struct FParticleEmitterInstance
 		// PayloadOffset 계산 (기본 파티클 뒤에 모듈 데이터가 시작됨)
 		PayloadOffset = ParticleSize;
 
+		// 메모리 레이아웃 결정 (SoA는 스트림 + 파티클별 Payload 블록)
+		bUseSoALayout = CurrentLODLevel && CurrentLODLevel->RequiredModule && CurrentLODLevel->RequiredModule->IsUseSoALayout();
+		if (bUseSoALayout)
+		{
+			SoAData.Init(ParticleStride, PayloadOffset);
+		}
+
+		ModuleLayoutHash = 2166136261u;	// FNV-1a
+		if (CurrentLODLevel)
+		{
+			auto HashBytes = [this](const void* Data, size_t Size)
+			{
+				const uint8* Bytes = static_cast<const uint8*>(Data);
+				for (size_t i = 0; i < Size; ++i)
+				{
+					ModuleLayoutHash = (ModuleLayoutHash ^ Bytes[i]) * 16777619u;
+				}
+			};
+			for (UParticleModule* Module : CurrentLODLevel->Modules)
+			{
+				if (!Module)
+				{
+					continue;
+				}
+				const char* ClassName = Module->GetClass()->Name ? Module->GetClass()->Name : "";
+				const uint32 ModuleBytes = Module->RequiredBytes(CurrentLODLevel->TypeDataModule);
+				HashBytes(ClassName, strlen(ClassName) + 1);
+				HashBytes(&ModuleBytes, sizeof(ModuleBytes));
+			}
+		}
+
 		// 첫 루프의 Duration 계산 (랜덤 범위 적용)
 		if (CurrentLODLevel && CurrentLODLevel->RequiredModule)
 		{
-			CurrentLoopDuration = CurrentLODLevel->RequiredModule->GetEmitterDuration();
+			CurrentLoopDuration = CurrentLODLevel->RequiredModule->GetEmitterDuration(RandomStream);
 		}
 		else
 		{
@@ -730,6 +971,51 @@ struct FParticleEmitterInstance
 		}
 	}
 
+	/**
+	 * 풀에서 꺼낸 인스턴스를 새 컴포넌트용으로 처음 상태로 되돌림 (FParticleEmitterInstancePool)
+	 * Init과 달리 Stride/레이아웃/파티클 메모리/GPU 버퍼는 그대로 두고 시뮬레이션 상태만 초기화한다.
+	 *
+	 * @param InComponent - 새 소유자 컴포넌트
+	 * @note 난수 시드는 호출 전에 RandomStream.Initialize로 설정 (첫 루프 Duration을 여기서 뽑음)
+	 */
+	virtual void Reuse(UParticleSystemComponent* InComponent)
+	{
+		Component = InComponent;
+
+		ActiveParticles = 0;
+		ParticleCounter = 0;
+		SpawnFraction = 0.0f;
+
+		EmitterTime = 0.0f;
+		LoopCount = 0;
+		bEmitterIsDone = false;
+
+		// 이전 컴포넌트가 바꿔 둔 LOD는 0번으로 (Stride는 Init에서 0번 LOD 기준으로 계산됨)
+		CurrentLODLevelIndex = 0;
+		CurrentLODLevel = (SpriteTemplate && SpriteTemplate->GetNumLODs() > 0) ? SpriteTemplate->GetLODLevel(0) : nullptr;
+
+		bHasParticleBounds = false;
+		SpawnBudget = -1;
+		NumThrottledSpawns = 0;
+		CollisionCursor = 0;
+		CollisionHeightField.bValid = false;
+
+		if (CurrentLODLevel && CurrentLODLevel->RequiredModule)
+		{
+			CurrentLoopDuration = CurrentLODLevel->RequiredModule->GetEmitterDuration(RandomStream);
+		}
+		else
+		{
+			CurrentLoopDuration = 1.0f;
+		}
+	}
+
+	/** 더 스폰하지 않고 남은 파티클도 없는지 (bAutoDeactivate 템플릿의 완료 판정) */
+	virtual bool IsComplete() const
+	{
+		return bEmitterIsDone && ActiveParticles <= 0;
+	}
+
 	// ============== Virtual Methods for Rendering ==============
 	/**
 	 * Check if dynamic data is required for rendering
@@ -750,7 +1036,7 @@ struct FParticleEmitterInstance
 	 * @return FDynamicEmitterDataBase* - The dynamic data, or nullptr if not required
 	 *
 	 * @note Subclasses should override this to return their specific data type
-	 * @note Caller is responsible for deleting the returned pointer
+	 * @note 반환값은 인스턴스가 소유하는 PooledDynamicData (호출자가 delete하지 말 것, 다음 호출 때 다시 채워짐)
 	 */
 	virtual FDynamicEmitterDataBase* GetDynamicData(bool bSelected)
 	{
@@ -769,7 +1055,7 @@ struct FParticleEmitterInstance
 	 */
 	virtual bool FillReplayData(FDynamicEmitterReplayDataBase& OutData)
 	{
-		if (ActiveParticles <= 0 || !ParticleData || !CurrentLODLevel)
+		if (ActiveParticles <= 0 || !HasParticleStorage() || !CurrentLODLevel)
 		{
 			return false;
 		}
@@ -778,20 +1064,22 @@ struct FParticleEmitterInstance
 		OutData.ActiveParticleCount = ActiveParticles;
 		OutData.ParticleStride = ParticleStride;
 
-		// Allocate and copy particle data to container
-		OutData.DataContainer.Allocate(MaxActiveParticles, ParticleStride);
-		FMemory::Memcpy(
-			OutData.DataContainer.ParticleData,
-			ParticleData,
-			MaxActiveParticles * ParticleStride
-		);
-
-		// Copy particle indices
-		FMemory::Memcpy(
-			OutData.DataContainer.ParticleIndices,
-			ParticleIndices,
-			MaxActiveParticles * sizeof(uint16)
-		);
+		if (bUseSoALayout)
+		{
+			// SoA: 활성 파티클만 AoS로 모아 렌더러에 전달 (컨테이너 인덱스는 1:1 그대로)
+			// 풀링된 블록은 부족할 때만 커지므로 매 프레임 할당하지 않음
+			OutData.DataContainer.Reserve(ActiveParticles, ParticleStride);
+			for (int32 i = 0; i < ActiveParticles; i++)
+			{
+				SoAData.LoadParticle(i, OutData.DataContainer.ParticleData + i * ParticleStride);
+			}
+		}
+		else
+		{
+			// AoS: 복사 없이 시뮬레이션 버퍼를 그대로 가리킴
+			// 시뮬레이션(UWorld::Tick)은 렌더링 전에 끝나므로 이번 프레임 렌더링 동안 버퍼 내용이 바뀌지 않는다
+			OutData.DataContainer.SetView(ParticleData, ParticleIndices, ActiveParticles, ParticleStride);
+		}
 
 		// Get scale from component transform
 		if (Component)
@@ -844,11 +1132,21 @@ struct FParticleEmitterInstance
 		int32 Size = sizeof(FParticleEmitterInstance);
 		int32 ActiveParticleDataSize = (ParticleData != nullptr) ? (ActiveParticles * ParticleStride) : 0;
 		int32 MaxActiveParticleDataSize = (ParticleData != nullptr) ? (MaxActiveParticles * ParticleStride) : 0;
-		int32 ActiveParticleIndexSize = (ParticleIndices != nullptr) ? (ActiveParticles * sizeof(uint16)) : 0;
-		int32 MaxActiveParticleIndexSize = (ParticleIndices != nullptr) ? (MaxActiveParticles * sizeof(uint16)) : 0;
+		int32 ActiveParticleIndexSize = (ParticleIndices != nullptr) ? (ActiveParticles * sizeof(uint32)) : 0;
+		int32 MaxActiveParticleIndexSize = (ParticleIndices != nullptr) ? (MaxActiveParticles * sizeof(uint32)) : 0;
 
-		OutNum = ActiveParticleDataSize + ActiveParticleIndexSize + Size;
-		OutMax = MaxActiveParticleDataSize + MaxActiveParticleIndexSize + Size;
+		OutNum = ActiveParticleDataSize + ActiveParticleIndexSize + GetSoAAllocatedSize(ActiveParticles) + Size;
+		OutMax = MaxActiveParticleDataSize + MaxActiveParticleIndexSize + GetSoAAllocatedSize(MaxActiveParticles) + Size;
+	}
+
+	/** SoA 저장소 중 NumParticles개가 차지하는 크기 (스트림 + Payload, SoA가 아니면 0) */
+	int32 GetSoAAllocatedSize(int32 NumParticles) const
+	{
+		if (!bUseSoALayout || !SoAData.IsAllocated())
+		{
+			return 0;
+		}
+		return NumParticles * static_cast<int32>(sizeof(float) * FParticleSoAData::Stream_Count + SoAData.GetPayloadStride());
 	}
 
 	// ============== LOD ==============
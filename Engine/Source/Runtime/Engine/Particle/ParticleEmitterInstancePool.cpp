@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "ParticleEmitterInstancePool.h"
+#include "ParticleEmitterInstance.h"
+
+FParticleEmitterInstancePoolCounters FParticleEmitterInstancePool::Counters;
+
+FParticleEmitterInstance* FParticleEmitterInstancePool::Acquire(int32 EmitterIndex, const UParticleEmitter* Emitter)
+{
+	if (EmitterIndex < 0 || EmitterIndex >= FreeLists.Num())
+	{
+		++Counters.Misses;
+		return nullptr;
+	}
+
+	TArray<FEntry>& FreeList = FreeLists[EmitterIndex];
+	while (!FreeList.IsEmpty())
+	{
+		const FEntry Entry = FreeList.Last();
+		FreeList.pop_back();
+		--Counters.PooledInstances;
+		Counters.PooledBytes -= Entry.Bytes;
+
+		// 에디터에서 에미터를 교체/재배치했거나 모듈 레이아웃이 바뀌기 전에 만든 인스턴스
+		if (Entry.Instance->SpriteTemplate != Emitter || Entry.Instance->PoolGeneration != Generation)
+		{
+			delete Entry.Instance;
+			++Counters.Discarded;
+			continue;
+		}
+
+		++Counters.Hits;
+		return Entry.Instance;
+	}
+
+	++Counters.Misses;
+	return nullptr;
+}
+
+void FParticleEmitterInstancePool::Release(int32 EmitterIndex, FParticleEmitterInstance* Instance)
+{
+	if (!Instance)
+	{
+		return;
+	}
+
+	// 모듈이 바뀌기 전 세대의 인스턴스는 Stride/Payload 위치가 달라 재사용할 수 없음
+	if (EmitterIndex < 0 || Instance->PoolGeneration != Generation)
+	{
+		delete Instance;
+		++Counters.Discarded;
+		return;
+	}
+
+	if (EmitterIndex >= FreeLists.Num())
+	{
+		FreeLists.resize(EmitterIndex + 1);
+	}
+
+	TArray<FEntry>& FreeList = FreeLists[EmitterIndex];
+	if (FreeList.Num() >= MaxPooledPerEmitter)
+	{
+		delete Instance;
+		++Counters.Discarded;
+		return;
+	}
+
+	// 풀에 있는 동안 삭제된 컴포넌트를 가리키지 않도록 끊어 둠 (Reuse에서 다시 설정)
+	Instance->Component = nullptr;
+
+	int32 AllocatedNum = 0;
+	int32 AllocatedMax = 0;
+	Instance->GetAllocatedSize(AllocatedNum, AllocatedMax);
+
+	FEntry Entry;
+	Entry.Instance = Instance;
+	Entry.Bytes = static_cast<uint32>(std::max(0, AllocatedMax));
+	FreeList.Add(Entry);
+
+	++Counters.Released;
+	++Counters.PooledInstances;
+	Counters.PooledBytes += Entry.Bytes;
+}
+
+void FParticleEmitterInstancePool::Flush()
+{
+	for (TArray<FEntry>& FreeList : FreeLists)
+	{
+		for (const FEntry& Entry : FreeList)
+		{
+			Discard(Entry);
+		}
+	}
+	FreeLists.Empty();
+}
+
+int32 FParticleEmitterInstancePool::GetNumPooled() const
+{
+	int32 NumPooled = 0;
+	for (const TArray<FEntry>& FreeList : FreeLists)
+	{
+		NumPooled += FreeList.Num();
+	}
+	return NumPooled;
+}
+
+void FParticleEmitterInstancePool::Discard(const FEntry& Entry)
+{
+	delete Entry.Instance;
+	++Counters.Discarded;
+	--Counters.PooledInstances;
+	Counters.PooledBytes -= Entry.Bytes;
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "ParticleTypes.h"
+
+class UParticleEmitter;
+struct FParticleEmitterInstance;
+
+/**
+ * @brief 에미터 인스턴스 풀 통계 (모든 템플릿/월드 합계, 게임 스레드 전용)
+ * @details Hits/Misses/Released/Discarded는 엔진 프레임 시작에 한 번 0으로 되돌리고 (여러 월드가 같은 풀을 씀),
+ *          각 월드의 시뮬레이션 단계가 그 시점까지의 값을 통계로 가져간다.
+ */
+struct FParticleEmitterInstancePoolCounters
+{
+	uint32 Hits = 0;				// 풀에서 꺼내 재사용한 인스턴스 수
+	uint32 Misses = 0;				// 풀이 비어 새로 만든 인스턴스 수
+	uint32 Released = 0;			// 풀로 돌려받은 인스턴스 수
+	uint32 Discarded = 0;			// 풀이 가득 찼거나 템플릿이 바뀌어 삭제한 인스턴스 수
+
+	uint32 PooledInstances = 0;		// 지금 풀에 들어 있는 인스턴스 수
+	uint64 PooledBytes = 0;			// 그 인스턴스들이 잡고 있는 파티클 메모리 (GetAllocatedSize 기준)
+
+	void ResetFrame()
+	{
+		Hits = 0;
+		Misses = 0;
+		Released = 0;
+		Discarded = 0;
+	}
+};
+
+/**
+ * @brief 파티클 템플릿 하나의 에미터 인스턴스 풀 (UParticleSystem 소유)
+ * @details 타격/총구 화염/발자국 같은 짧은 이펙트는 활성화마다 인스턴스를 new 하고 Init에서 파티클 메모리와
+ *          GPU 버퍼를 다시 만들었다. 다 쓴 인스턴스를 에미터 인덱스별로 모아 두었다가 같은 템플릿의 다음 컴포넌트가
+ *          Reuse로 상태만 되돌려 쓰므로, 파티클 버퍼(커진 크기 그대로)와 GPU 버퍼를 다시 할당하지 않는다.
+ *          - 에미터당 MaxPooledPerEmitter개까지만 보관하고 넘치면 삭제
+ *          - 모듈이 바뀌면 Stride/레이아웃이 달라지므로 Invalidate로 비우고 세대를 올린다.
+ *            인스턴스는 만들 때의 세대(FParticleEmitterInstance::PoolGeneration)를 기억하고, 세대가 다르면
+ *            (편집 전에 만들어져 다른 컴포넌트가 아직 쓰던 인스턴스) 풀에 넣지도 꺼내 주지도 않고 삭제한다.
+ */
+class FParticleEmitterInstancePool
+{
+public:
+	static constexpr int32 MaxPooledPerEmitter = 8;
+
+	FParticleEmitterInstancePool() = default;
+	~FParticleEmitterInstancePool() { Flush(); }
+
+	// 템플릿을 Duplicate 하면 풀은 원본에 남기고 빈 풀로 시작
+	FParticleEmitterInstancePool(const FParticleEmitterInstancePool&) {}
+	FParticleEmitterInstancePool& operator=(const FParticleEmitterInstancePool& Other)
+	{
+		if (this != &Other)
+		{
+			Flush();
+		}
+		return *this;
+	}
+
+	/**
+	 * EmitterIndex번 에미터용 인스턴스를 풀에서 꺼냄
+	 * @param Emitter - 지금 템플릿의 EmitterIndex번 에미터 (보관할 때와 다르면 그 인스턴스는 삭제)
+	 * @return 풀이 비었으면 nullptr (호출한 쪽에서 새로 만들고 Init)
+	 */
+	FParticleEmitterInstance* Acquire(int32 EmitterIndex, const UParticleEmitter* Emitter);
+
+	/** 다 쓴 인스턴스를 풀로 돌려줌 (파티클 상태는 Reuse에서 되돌리므로 그대로 둠, 가득 찼으면 삭제) */
+	void Release(int32 EmitterIndex, FParticleEmitterInstance* Instance);
+
+	/** 보관 중인 인스턴스를 모두 삭제 */
+	void Flush();
+
+	/** 템플릿 레이아웃이 바뀌었을 때: 비우고 세대를 올려 이전 세대 인스턴스가 다시 들어오지 못하게 함 */
+	void Invalidate()
+	{
+		Flush();
+		++Generation;
+	}
+
+	/** 새로 만든 인스턴스에 기록할 현재 세대 */
+	uint32 GetGeneration() const { return Generation; }
+
+	int32 GetNumPooled() const;
+
+	static FParticleEmitterInstancePoolCounters& GetCounters() { return Counters; }
+
+private:
+	struct FEntry
+	{
+		FParticleEmitterInstance* Instance = nullptr;
+		uint32 Bytes = 0;
+	};
+
+	void Discard(const FEntry& Entry);
+
+	// 에미터 인덱스별 빈 인스턴스 목록
+	TArray<TArray<FEntry>> FreeLists;
+
+	uint32 Generation = 0;
+
+	static FParticleEmitterInstancePoolCounters Counters;
+};
@@ -17,6 +17,7 @@
 #include "Beam/ParticleModuleBeamTarget.h"
 #include "Beam/ParticleModuleBeamNoise.h"
 #include "SubUV/ParticleModuleSubUV.h"
+#include "Collision/ParticleModuleCollision.h"
 
 UParticleLODLevel::UParticleLODLevel()
 	: Level(0)
@@ -196,6 +197,7 @@ static UParticleModule* CreateModuleByTypeName(const FString& TypeName)
 	if (TypeName == "UParticleModuleBeamTarget") return NewObject<UParticleModuleBeamTarget>();
 	if (TypeName == "UParticleModuleBeamNoise") return NewObject<UParticleModuleBeamNoise>();
 	if (TypeName == "UParticleModuleSubUV") return NewObject<UParticleModuleSubUV>();
+	if (TypeName == "UParticleModuleCollision") return NewObject<UParticleModuleCollision>();
 	return nullptr;
 }
 
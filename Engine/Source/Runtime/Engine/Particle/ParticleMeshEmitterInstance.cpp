@@ -102,12 +102,15 @@ FDynamicEmitterDataBase* FParticleMeshEmitterInstance::GetDynamicData(bool bSele
 	{
 		return nullptr;
 	}
-	// 2. dynamic data 생성
-	FDynamicMeshEmitterData* NewEmitterData = new FDynamicMeshEmitterData();
+	// 2. 풀링된 dynamic data 재사용 (처음 한 번만 생성)
+	if (!PooledDynamicData)
+	{
+		PooledDynamicData = new FDynamicMeshEmitterData();
+	}
+	FDynamicMeshEmitterData* NewEmitterData = static_cast<FDynamicMeshEmitterData*>(PooledDynamicData);
 	// 3. source data 채우기
 	if (!FillReplayData(NewEmitterData->Source))
 	{
-		delete NewEmitterData;
 		return nullptr;
 	}
 
@@ -139,8 +142,12 @@ bool FParticleMeshEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBase&
 	{
 		MeshData.MaterialInterface = CurrentLODLevel->RequiredModule->GetMaterial();
 
-		// 상속 구조상 RequiredModule 멤버가 있으므로 채워줌
-		MeshData.RequiredModule = CurrentLODLevel->RequiredModule->CreateRendererResource();
+		// 상속 구조상 RequiredModule 멤버가 있으므로 채워줌 (풀링된 데이터면 재사용)
+		if (!MeshData.RequiredModule)
+		{
+			MeshData.RequiredModule = new FParticleRequiredModule();
+		}
+		CurrentLODLevel->RequiredModule->FillRendererResource(*MeshData.RequiredModule);
 
 		// BlendMode (렌더러에서 블렌드 스테이트 분기용)
 		MeshData.BlendMode = CurrentLODLevel->RequiredModule->GetBlendMode();
@@ -178,6 +185,8 @@ FDynamicEmitterReplayDataBase* FParticleMeshEmitterInstance::GetReplayData()
 		delete NewData;
 		return nullptr;
 	}
+	// 스냅샷이어야 하므로 시뮬레이션 버퍼를 가리키는 뷰를 복사본으로 전환
+	NewData->DataContainer.MakeOwned(ParticleStride);
 	return NewData;
 
 }
@@ -192,11 +201,11 @@ void FParticleMeshEmitterInstance::GetAllocatedSize(int32& OutNum, int32& OutMax
 	int32 Size = sizeof(FParticleMeshEmitterInstance);
 	int32 ActiveParticleDataSize = (ParticleData != nullptr) ? (ActiveParticles * ParticleStride) : 0;
 	int32 MaxActiveParticleDataSize = (ParticleData != nullptr) ? (MaxActiveParticles * ParticleStride) : 0;
-	int32 ActiveParticleIndexSize = (ParticleIndices != nullptr) ? (ActiveParticles * sizeof(uint16)) : 0;
-	int32 MaxActiveParticleIndexSize = (ParticleIndices != nullptr) ? (MaxActiveParticles * sizeof(uint16)) : 0;
+	int32 ActiveParticleIndexSize = (ParticleIndices != nullptr) ? (ActiveParticles * sizeof(uint32)) : 0;
+	int32 MaxActiveParticleIndexSize = (ParticleIndices != nullptr) ? (MaxActiveParticles * sizeof(uint32)) : 0;
 
-	OutNum = Size + ActiveParticleDataSize + ActiveParticleIndexSize;
-	OutMax = Size + MaxActiveParticleDataSize + MaxActiveParticleIndexSize;
+	OutNum = Size + ActiveParticleDataSize + ActiveParticleIndexSize + GetSoAAllocatedSize(ActiveParticles);
+	OutMax = Size + MaxActiveParticleDataSize + MaxActiveParticleIndexSize + GetSoAAllocatedSize(MaxActiveParticles);
 }
 
 // ============== Resize ==============
@@ -234,10 +243,10 @@ bool FParticleMeshEmitterInstance::Resize(int32 NewMaxActiveParticles, bool bSet
 			BufferDesc.MiscFlags = 0;
 			BufferDesc.StructureByteStride = 0;
 
+			// 워커에서 호출될 수 있으므로 로그 없이 실패만 알림
 			HRESULT hr = Device->CreateBuffer(&BufferDesc, nullptr, &InstanceBuffer);
 			if (FAILED(hr))
 			{
-				UE_LOG("Failed to resize particle mesh instance buffer");
 				return false;
 			}
 		}
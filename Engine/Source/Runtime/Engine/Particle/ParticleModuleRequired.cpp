@@ -24,6 +24,7 @@ UParticleModuleRequired::UParticleModuleRequired()
 	, InterpolationMethod(EParticleSubUVInterpMethod::None)
 	, AxisLockOption(EParticleAxisLock::None)
 	, BlendMode(EParticleBlendMode::None)
+	, bUseSoALayout(false)
 {
 	// Required 모듈은 Spawn/Update에 참여하지 않음 (설정만 제공)
 	bSpawnModule = false;
@@ -33,14 +34,15 @@ UParticleModuleRequired::UParticleModuleRequired()
 
 /**
  * 실제 이미터 지속 시간 반환 (랜덤 범위 적용)
+ * @param RandomStream 에미터 인스턴스의 난수 스트림
  * @return 이미터 지속 시간
  */
-float UParticleModuleRequired::GetEmitterDuration() const
+float UParticleModuleRequired::GetEmitterDuration(FParticleRandomStream& RandomStream) const
 {
 	if (EmitterDurationLow > 0.0f && EmitterDurationLow < EmitterDuration)
 	{
 		// 랜덤 범위
-		float Alpha = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+		float Alpha = RandomStream.GetFraction();
 		return EmitterDurationLow + Alpha * (EmitterDuration - EmitterDurationLow);
 	}
 	return EmitterDuration;
@@ -64,15 +66,18 @@ int32 UParticleModuleRequired::GetTotalSubImages() const
 FParticleRequiredModule* UParticleModuleRequired::CreateRendererResource() const
 {
 	FParticleRequiredModule* FReqMod = new FParticleRequiredModule();
+	FillRendererResource(*FReqMod);
+	return FReqMod;
+}
 
+void UParticleModuleRequired::FillRendererResource(FParticleRequiredModule& OutResource) const
+{
 	// SubUV 프레임 개수
-	FReqMod->NumFrames = GetTotalSubImages();
+	OutResource.NumFrames = GetTotalSubImages();
 
 	// 알파 임계값 (현재 UParticleModuleRequired에 없으므로 기본값)
 	// TODO: 필요하면 UParticleModuleRequired에 AlphaThreshold 멤버 추가
-	FReqMod->AlphaThreshold = 0.0f;
-
-	return FReqMod;
+	OutResource.AlphaThreshold = 0.0f;
 }
 
 void UParticleModuleRequired::Serialize(bool bIsLoading, JSON& InOutHandle)
@@ -109,6 +114,7 @@ void UParticleModuleRequired::Serialize(bool bIsLoading, JSON& InOutHandle)
 		if (InOutHandle.hasKey("InterpolationMethod")) InterpolationMethod = static_cast<EParticleSubUVInterpMethod>(InOutHandle["InterpolationMethod"].ToInt());
 		if (InOutHandle.hasKey("AxisLockOption")) AxisLockOption = static_cast<EParticleAxisLock>(InOutHandle["AxisLockOption"].ToInt());
 		if (InOutHandle.hasKey("BlendMode")) BlendMode = static_cast<EParticleBlendMode>(InOutHandle["BlendMode"].ToInt());
+		if (InOutHandle.hasKey("bUseSoALayout")) bUseSoALayout = InOutHandle["bUseSoALayout"].ToBool();
 	}
 	else
 	{
@@ -139,6 +145,7 @@ void UParticleModuleRequired::Serialize(bool bIsLoading, JSON& InOutHandle)
 		InOutHandle["InterpolationMethod"] = static_cast<int32>(InterpolationMethod);
 		InOutHandle["AxisLockOption"] = static_cast<int32>(AxisLockOption);
 		InOutHandle["BlendMode"] = static_cast<int32>(BlendMode);
+		InOutHandle["bUseSoALayout"] = bUseSoALayout;
 	}
 }
 
@@ -169,4 +176,5 @@ void UParticleModuleRequired::DuplicateFrom(const UParticleModule* Source)
 	InterpolationMethod = SrcReq->InterpolationMethod;
 	AxisLockOption = SrcReq->AxisLockOption;
 	BlendMode = SrcReq->BlendMode;
+	bUseSoALayout = SrcReq->bUseSoALayout;
 }
@@ -45,6 +45,7 @@ struct FParticleRequiredModule
  * @param bKillOnCompleted 완료 시 파티클 제거
  * @param MaxDrawCount 최대 그리기 개수
  * @param EmitterNormalsMode 노멀 모드
+ * @param bUseSoALayout 파티클을 SoA 스트림으로 저장하고 SIMD 커널로 업데이트 (이미터 초기화 시 적용)
  */
 UCLASS()
 class UParticleModuleRequired :
@@ -65,7 +66,7 @@ public:
 	bool ModuleHasCurves() const override { return true; }
 
 	// Functions
-	float GetEmitterDuration() const;
+	float GetEmitterDuration(FParticleRandomStream& RandomStream) const;
 	int32 GetTotalSubImages() const;
 
 	/**
@@ -76,6 +77,12 @@ public:
 	 */
 	FParticleRequiredModule* CreateRendererResource() const;
 
+	/**
+	 * Fill an existing renderer resource (풀링된 렌더 데이터를 할당 없이 다시 채울 때 사용)
+	 * 기존 렌더러 리소스를 현재 값으로 채움
+	 */
+	void FillRendererResource(FParticleRequiredModule& OutResource) const;
+
 	// Getters
 	UMaterial* GetMaterial() const { return Material; }
 	float GetEmitterDurationValue() const { return EmitterDuration; }
@@ -94,6 +101,7 @@ public:
 	EParticleSubUVInterpMethod GetInterpolationMethod() const { return InterpolationMethod; }
 	EParticleAxisLock GetAxisLockOption() const { return AxisLockOption; }
 	EParticleBlendMode GetBlendMode() const { return BlendMode; }
+	bool IsUseSoALayout() const { return bUseSoALayout; }
 
 	// Setters
 	void SetMaterial(UMaterial* InMaterial) { Material = InMaterial; }
@@ -113,6 +121,7 @@ public:
 	void SetInterpolationMethod(EParticleSubUVInterpMethod InMethod) { InterpolationMethod = InMethod; }
 	void SetAxisLockOption(EParticleAxisLock InOption) { AxisLockOption = InOption; }
 	void SetBlendMode(EParticleBlendMode InMode) { BlendMode = InMode; }
+	void SetUseSoALayout(bool bInUseSoALayout) { bUseSoALayout = bInUseSoALayout; }
 
 protected:
 	UMaterial* Material = nullptr;
@@ -132,5 +141,6 @@ protected:
 	EParticleSubUVInterpMethod InterpolationMethod;
 	EParticleAxisLock AxisLockOption;
 	EParticleBlendMode BlendMode;
+	bool bUseSoALayout;
 };
 
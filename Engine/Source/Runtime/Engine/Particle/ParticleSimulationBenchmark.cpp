@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "ParticleSimulationBenchmark.h"
+#include "ParticleEmitterInstance.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 실행마다 같은 입력을 얻기 위한 고정 시드 LCG
+	struct FBenchmarkRandom
+	{
+		uint32 State = 0x9E3779B9u;
+
+		float NextUnit()
+		{
+			State = State * 1664525u + 1013904223u;
+			return static_cast<float>(State >> 8) / static_cast<float>(1u << 24);
+		}
+
+		float NextRange(float Min, float Max)
+		{
+			return Min + (Max - Min) * NextUnit();
+		}
+	};
+
+	// 모듈 없는 스프라이트 에미터와 같은 구성 (FBaseParticle만, 16바이트 정렬 Stride)
+	void SetupInstance(FParticleEmitterInstance& Instance, bool bUseSoALayout, int32 NumParticles)
+	{
+		Instance.ParticleSize = sizeof(FBaseParticle);
+		Instance.ParticleStride = (Instance.ParticleSize + 15) & ~15;
+		Instance.PayloadOffset = Instance.ParticleSize;
+		Instance.bUseSoALayout = bUseSoALayout;
+		if (bUseSoALayout)
+		{
+			Instance.SoAData.Init(Instance.ParticleStride, Instance.PayloadOffset);
+		}
+
+		// Component가 없으므로 GPU 버퍼는 만들지 않음
+		Instance.Resize(NumParticles);
+
+		// 1초 동안 죽지 않도록 수명 2~4초 (수명 검사 비용은 그대로 포함)
+		FBenchmarkRandom Random;
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			uint8* ParticlePtr = bUseSoALayout
+				? Instance.SoAData.GetStagingParticle()
+				: Instance.ParticleData + Instance.ParticleIndices[i] * Instance.ParticleStride;
+			FBaseParticle& Particle = *reinterpret_cast<FBaseParticle*>(ParticlePtr);
+
+			Particle = FBaseParticle();
+			Particle.Location = FVector(Random.NextRange(-100.0f, 100.0f), Random.NextRange(-100.0f, 100.0f), Random.NextRange(0.0f, 50.0f));
+			Particle.OldLocation = Particle.Location;
+			Particle.Velocity = FVector(Random.NextRange(-10.0f, 10.0f), Random.NextRange(-10.0f, 10.0f), Random.NextRange(0.0f, 30.0f));
+			Particle.BaseVelocity = Particle.Velocity;
+			Particle.Lifetime = Random.NextRange(2.0f, 4.0f);
+			Particle.RotationRate = Random.NextRange(-3.0f, 3.0f);
+			Particle.Flags = static_cast<int32>((i & STATE_CounterMask) | STATE_Particle_JustSpawned);
+
+			if (bUseSoALayout)
+			{
+				Instance.SoAData.StoreParticle(i, ParticlePtr);
+			}
+		}
+		Instance.ActiveParticles = NumParticles;
+		Instance.ParticleCounter = NumParticles;
+	}
+
+	double TickFrames(FParticleEmitterInstance& Instance, int32 NumFrames, float DeltaTime)
+	{
+		FScopeCycleCounter Counter;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Instance.Tick(DeltaTime);
+		}
+		return Counter.Finish();
+	}
+}
+
+void FParticleSimulationBenchmark::Run(int32 NumParticles, int32 NumFrames)
+{
+	if (NumParticles <= 0 || NumFrames <= 0)
+	{
+		return;
+	}
+
+	const float DeltaTime = 1.0f / 60.0f;
+
+	FParticleEmitterInstance AoSInstance;
+	FParticleEmitterInstance SoAInstance;
+	SetupInstance(AoSInstance, false, NumParticles);
+	SetupInstance(SoAInstance, true, NumParticles);
+
+	const double AoSMs = TickFrames(AoSInstance, NumFrames, DeltaTime);
+	const double SoAMs = TickFrames(SoAInstance, NumFrames, DeltaTime);
+
+	// 죽은 파티클이 없으므로 두 레이아웃의 i번째 파티클은 같은 파티클
+	float MaxLocationError = 0.0f;
+	const int32 NumCompared = std::min(AoSInstance.ActiveParticles, SoAInstance.ActiveParticles);
+	for (int32 i = 0; i < NumCompared; ++i)
+	{
+		const FVector Delta = AoSInstance.GetParticleLocation(i) - SoAInstance.GetParticleLocation(i);
+		MaxLocationError = std::max(MaxLocationError, std::max(std::abs(Delta.X), std::max(std::abs(Delta.Y), std::abs(Delta.Z))));
+	}
+
+	UE_LOG("[Bench] ParticleSim: %d particles, %d frames, stride %d bytes (AoS) / %d streams (SoA)",
+		NumParticles, NumFrames, AoSInstance.ParticleStride, static_cast<int32>(FParticleSoAData::Stream_Count));
+	UE_LOG("[Bench]   AoS : %.3f ms (%.3f ms/frame), %d alive", AoSMs, AoSMs / NumFrames, AoSInstance.ActiveParticles);
+	UE_LOG("[Bench]   SoA : %.3f ms (%.3f ms/frame), %d alive", SoAMs, SoAMs / NumFrames, SoAInstance.ActiveParticles);
+	UE_LOG("[Bench]   Speedup: x%.2f, max location error %.6f", SoAMs > 0.0 ? AoSMs / SoAMs : 0.0, MaxLocationError);
+}
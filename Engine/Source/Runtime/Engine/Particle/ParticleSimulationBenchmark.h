@@ -0,0 +1,12 @@
+#pragma once
+
+/**
+ * @brief 파티클 메모리 레이아웃(AoS vs SoA) 비교용 헤드리스 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details 컴포넌트 없이 FParticleEmitterInstance를 직접 만들어 같은 파티클로 채운 뒤 Tick 비용과 결과 차이를 로그로 남긴다.
+ */
+class FParticleSimulationBenchmark
+{
+public:
+	// 에미터당 NumParticles개 파티클을 NumFrames 프레임 동안 AoS/SoA로 Tick
+	static void Run(int32 NumParticles, int32 NumFrames);
+};
@@ -0,0 +1,500 @@
+#include "pch.h"
+#include "ParticleSimulationManager.h"
+#include "ParticleSystemComponent.h"
+#include "ParticleEmitterInstance.h"
+#include "ParticleSystem.h"
+#include "ParticleStats.h"
+#include "World.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+
+FParticleBudget FParticleSimulationManager::Budget;
+
+namespace
+{
+	// 풀 카운터는 모든 월드가 공유하며 엔진 Tick 시작에 한 번만 0으로 되돌림 (여기서는 읽기만)
+	void CollectPoolStats(FParticleSimulationStats& Stats)
+	{
+		FParticleEmitterInstancePoolCounters& Counters = FParticleEmitterInstancePool::GetCounters();
+		Stats.PoolHits = Counters.Hits;
+		Stats.PoolMisses = Counters.Misses;
+		Stats.PoolReleased = Counters.Released;
+		Stats.PoolDiscarded = Counters.Discarded;
+		Stats.PooledInstances = Counters.PooledInstances;
+		Stats.PooledBytes = Counters.PooledBytes;
+	}
+}
+
+FParticleSimulationManager::~FParticleSimulationManager()
+{
+	// 시뮬레이션 전에 월드가 사라지면 컴포넌트가 삭제된 매니저를 가리키지 않도록 끊어 둠
+	for (UParticleSystemComponent* Component : PendingComponents)
+	{
+		Component->PendingSimulation = nullptr;
+		Component->PendingSimulationDeltaTime = 0.0f;
+		Component->PendingSimulationSteps = 1;
+	}
+	for (UParticleSystemComponent* Component : CollisionEventComponents)
+	{
+		if (Component)
+		{
+			Component->PendingCollisionDispatch = nullptr;
+		}
+	}
+}
+
+void FParticleSimulationManager::QueueSimulation(UParticleSystemComponent* Component)
+{
+	if (!Component || Component->PendingSimulation == this)
+	{
+		return;
+	}
+
+	Component->PendingSimulation = this;
+	PendingComponents.Add(Component);
+}
+
+void FParticleSimulationManager::CancelSimulation(UParticleSystemComponent* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	// 이벤트 발행 중(Lua 콜백)에 삭제될 수 있으므로 순회 중인 목록에서 지우지 않고 비워 둠
+	if (Component->PendingCollisionDispatch == this)
+	{
+		std::replace(CollisionEventComponents.begin(), CollisionEventComponents.end(), Component, static_cast<UParticleSystemComponent*>(nullptr));
+		Component->PendingCollisionDispatch = nullptr;
+	}
+
+	if (Component->PendingSimulation != this)
+	{
+		return;
+	}
+
+	PendingComponents.Remove(Component);
+	Component->PendingSimulation = nullptr;
+	Component->PendingSimulationDeltaTime = 0.0f;
+	Component->PendingSimulationSteps = 1;
+}
+
+void FParticleSimulationManager::SortByPriority()
+{
+	// 화면에 보이는 시스템 먼저, 같으면 카메라에 가까운 순
+	PriorityOrder.SetNum(PendingComponents.Num());
+	for (int32 Index = 0; Index < PendingComponents.Num(); ++Index)
+	{
+		PriorityOrder[Index] = Index;
+	}
+	std::sort(PriorityOrder.begin(), PriorityOrder.end(), [this](int32 A, int32 B)
+	{
+		const UParticleSystemComponent* ComponentA = PendingComponents[A];
+		const UParticleSystemComponent* ComponentB = PendingComponents[B];
+		const bool bOffscreenA = ComponentA->IsOffscreenThrottled();
+		const bool bOffscreenB = ComponentB->IsOffscreenThrottled();
+		if (bOffscreenA != bOffscreenB)
+		{
+			return !bOffscreenA;
+		}
+		return ComponentA->GetSignificanceDistanceSquared() < ComponentB->GetSignificanceDistanceSquared();
+	});
+}
+
+void FParticleSimulationManager::StealLeastSignificant(FParticleSimulationStats& Stats)
+{
+	int32 NumInstances = 0;
+	bool bHasSuspended = false;
+	for (const UParticleSystemComponent* Component : PendingComponents)
+	{
+		NumInstances += Component->EmitterInstances.Num();
+		bHasSuspended |= Component->bSuspendedByInstanceCap;
+	}
+	Stats.ActiveEmitterInstances = static_cast<uint32>(NumInstances);
+
+	const bool bLimitInstances = Budget.MaxEmitterInstances > 0;
+	if (!bHasSuspended && (!bLimitInstances || NumInstances <= Budget.MaxEmitterInstances))
+	{
+		return;
+	}
+
+	SortByPriority();
+
+	// 1) 중요한 순서로 상한까지 채우고, 처음 넘치는 시스템부터는 모두 빼앗음
+	// (시스템의 에미터 일부만 남기면 이펙트가 깨지므로 시스템 단위로)
+	int32 RemainingInstances = bLimitInstances ? Budget.MaxEmitterInstances : INT_MAX;
+	for (int32 ComponentIndex : PriorityOrder)
+	{
+		UParticleSystemComponent* Component = PendingComponents[ComponentIndex];
+		if (Component->bSuspendedByInstanceCap)
+		{
+			continue;
+		}
+
+		const int32 NumComponentInstances = Component->EmitterInstances.Num();
+		if (NumComponentInstances <= RemainingInstances)
+		{
+			RemainingInstances -= NumComponentInstances;
+			continue;
+		}
+		RemainingInstances = 0;
+
+		Component->PendingSimulation = nullptr;
+		Component->PendingSimulationDeltaTime = 0.0f;
+		Component->PendingSimulationSteps = 1;
+		PendingComponents[ComponentIndex] = nullptr;
+		Stats.ActiveEmitterInstances -= static_cast<uint32>(NumComponentInstances);
+
+		// 일회성 이펙트는 나중에 재생하면 타이밍이 어긋나므로 버리고, 반복 이펙트는 활성 상태로 쉬게 함
+		if (Component->Template && Component->Template->bAutoDeactivate)
+		{
+			Component->ReleaseEmitterInstances();
+			++Stats.StolenSystems;
+		}
+		else
+		{
+			Component->SuspendEmitterInstances();
+			++Stats.SuspendedSystems;
+		}
+	}
+
+	// 2) 쉬고 있던 시스템은 남은 여유에 템플릿 에미터가 모두 들어갈 때만 중요한 순서로 다시 꺼냄
+	// (재개가 다른 시스템을 빼앗게 만들지 않음, 재개한 시스템은 다음 Tick부터 시뮬레이션)
+	for (int32 ComponentIndex : PriorityOrder)
+	{
+		UParticleSystemComponent* Component = PendingComponents[ComponentIndex];
+		if (!Component || !Component->bSuspendedByInstanceCap)
+		{
+			continue;
+		}
+
+		Component->PendingSimulation = nullptr;
+		Component->PendingSimulationDeltaTime = 0.0f;
+		Component->PendingSimulationSteps = 1;
+		PendingComponents[ComponentIndex] = nullptr;
+
+		const int32 NumTemplateEmitters = Component->Template ? Component->Template->GetNumEmitters() : 0;
+		if (NumTemplateEmitters <= RemainingInstances)
+		{
+			RemainingInstances -= NumTemplateEmitters;
+			Component->ResumeEmitterInstances();
+			++Stats.ResumedSystems;
+		}
+		else
+		{
+			++Stats.SuspendedSystems;
+		}
+	}
+
+	PendingComponents.erase(std::remove(PendingComponents.begin(), PendingComponents.end(), nullptr), PendingComponents.end());
+}
+
+void FParticleSimulationManager::AssignSpawnBudgets()
+{
+	const bool bLimitParticles = Budget.MaxLiveParticles > 0;
+	const bool bLimitEmitters = Budget.MaxActiveEmitters > 0;
+
+	if (bLimitParticles || bLimitEmitters)
+	{
+		SortByPriority();
+	}
+	else
+	{
+		PriorityOrder.SetNum(PendingComponents.Num());
+		for (int32 Index = 0; Index < PendingComponents.Num(); ++Index)
+		{
+			PriorityOrder[Index] = Index;
+		}
+	}
+
+	int32 RemainingParticles = Budget.MaxLiveParticles;
+	int32 RemainingEmitters = Budget.MaxActiveEmitters;
+
+	for (int32 ComponentIndex : PriorityOrder)
+	{
+		for (FParticleEmitterInstance* Instance : PendingComponents[ComponentIndex]->EmitterInstances)
+		{
+			if (!Instance)
+			{
+				continue;
+			}
+
+			Instance->SpawnBudget = -1;
+			Instance->NumThrottledSpawns = 0;
+
+			// 파티클도 없고 더 스폰하지도 않는 에미터는 예산을 쓰지 않음
+			if (Instance->ActiveParticles <= 0 && Instance->bEmitterIsDone)
+			{
+				continue;
+			}
+
+			int32 SpawnBudget = INT_MAX;
+			if (bLimitEmitters)
+			{
+				if (RemainingEmitters > 0)
+				{
+					--RemainingEmitters;
+				}
+				else
+				{
+					SpawnBudget = 0;
+				}
+			}
+			if (bLimitParticles)
+			{
+				// 살아 있는 파티클만 예산에서 빼고, 남은 양을 스폰 상한으로 (같은 프레임 스폰끼리는 예약하지 않음)
+				const int32 Available = std::max(0, RemainingParticles - Instance->ActiveParticles);
+				SpawnBudget = std::min(SpawnBudget, Available);
+				RemainingParticles = Available;
+			}
+
+			Instance->SpawnBudget = (SpawnBudget == INT_MAX) ? -1 : SpawnBudget;
+		}
+	}
+}
+
+void FParticleSimulationManager::Simulate()
+{
+	FParticleSimulationStats Stats;
+	Stats.OffscreenSystems = NumOffscreenSystems;
+	Stats.SkippedOffscreenSystems = NumSkippedOffscreenSystems;
+	Stats.MaxLiveParticles = static_cast<uint32>(std::max(0, Budget.MaxLiveParticles));
+	Stats.MaxActiveEmitters = static_cast<uint32>(std::max(0, Budget.MaxActiveEmitters));
+	Stats.MaxEmitterInstances = static_cast<uint32>(std::max(0, Budget.MaxEmitterInstances));
+	Stats.RestoredWarmupSystems = NumRestoredWarmups;
+	NumOffscreenSystems = 0;
+	NumSkippedOffscreenSystems = 0;
+	NumRestoredWarmups = 0;
+
+	if (PendingComponents.IsEmpty())
+	{
+		CollectPoolStats(Stats);
+		FParticleStatManager::GetInstance().UpdateSimulationStats(Stats);
+		return;
+	}
+
+	FScopeCycleCounter WallCounter;
+
+	// ========== 0단계: 인스턴스 상한 + 전역 예산 배분 (게임 스레드) ==========
+	StealLeastSignificant(Stats);
+	AssignSpawnBudgets();
+
+	// 워커는 템플릿을 읽기만 하므로 에디터에서 바뀐 스폰율/수명을 반영한 PeakActiveParticles는 여기서 템플릿마다 한 번 갱신
+	ActiveTemplates.Empty();
+	for (const UParticleSystemComponent* Component : PendingComponents)
+	{
+		if (Component->Template)
+		{
+			ActiveTemplates.Add(Component->Template);
+		}
+	}
+	std::sort(ActiveTemplates.begin(), ActiveTemplates.end());
+	ActiveTemplates.erase(std::unique(ActiveTemplates.begin(), ActiveTemplates.end()), ActiveTemplates.end());
+	for (UParticleSystem* Template : ActiveTemplates)
+	{
+		Template->RefreshPeakActiveParticles();
+	}
+
+	// ========== 1단계: (컴포넌트, 에미터) 작업으로 펼침 ==========
+	// 폭발처럼 에미터가 많은 시스템 하나도 에미터 단위로 여러 워커에 나뉜다
+	Tasks.Empty();
+	WarmupLeaders.Empty();
+	DeferredWarmups.Empty();
+	for (int32 ComponentIndex = 0; ComponentIndex < PendingComponents.Num(); ++ComponentIndex)
+	{
+		UParticleSystemComponent* Component = PendingComponents[ComponentIndex];
+		Component->PendingSimulation = nullptr;
+		Component->LastSimulationTimeMS = 0.0;
+
+		// 같은 템플릿 웜업은 하나만 시뮬레이션 (스트리밍으로 같은 이펙트가 한꺼번에 들어올 때 비용이 한 번만 듦)
+		if (Component->bCaptureWarmupSnapshot)
+		{
+			const bool bHasLeader = std::any_of(WarmupLeaders.begin(), WarmupLeaders.end(), [Component](const UParticleSystemComponent* Leader)
+			{
+				return Leader->Template == Component->Template;
+			});
+			if (bHasLeader)
+			{
+				DeferredWarmups.Add(Component);
+				continue;
+			}
+			WarmupLeaders.Add(Component);
+		}
+
+		// 빨리 감기 작업은 스텝 수만큼 비싸므로 가장 먼저 가져가게 함
+		const bool bFastForward = Component->PendingFastForwardTime > 0.0f;
+		for (FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (Instance)
+			{
+				Tasks.Add({ Instance, ComponentIndex, bFastForward ? INT_MAX : Instance->ActiveParticles });
+			}
+		}
+	}
+
+	// 비싼 에미터부터 가져가게 해서 큰 에미터 하나가 마지막에 남아 다른 스레드가 노는 것을 줄임
+	// (에미터끼리 독립이므로 실행 순서는 결과에 영향 없음)
+	std::sort(Tasks.begin(), Tasks.end(), [](const FEmitterTask& A, const FEmitterTask& B)
+	{
+		return A.Cost > B.Cost;
+	});
+
+	// ========== 2단계: 병렬 시뮬레이션 ==========
+	TaskTimesMS.SetNum(Tasks.Num());
+	ParallelFor(Tasks.Num(), [this](int32 TaskIndex)
+	{
+		const FEmitterTask& Task = Tasks[TaskIndex];
+		const UParticleSystemComponent* Component = PendingComponents[Task.ComponentIndex];
+
+		FScopeCycleCounter TaskCounter;
+
+		// 예약된 빨리 감기를 고정 스텝으로 먼저 처리
+		UParticleSystemComponent::FastForwardEmitter(Task.Instance, Component->PendingFastForwardTime, Component->FastForwardStepTime, Component->PendingSpawnLocation);
+
+		// 웜업 프레임의 DeltaTime은 웜업에 포함된 것으로 보고 건너뜀 (스냅샷이 정확히 WarmupTime 시점이 되도록)
+		if (!Component->bCaptureWarmupSnapshot)
+		{
+			// 화면 밖에서 밀린 시간처럼 길면 여러 스텝으로 나눠 시뮬레이션
+			const int32 NumSteps = std::max(1, Component->PendingSimulationSteps);
+			const float StepDeltaTime = Component->PendingSimulationDeltaTime / NumSteps;
+			for (int32 Step = 0; Step < NumSteps && StepDeltaTime > 0.0f; ++Step)
+			{
+				UParticleSystemComponent::SimulateEmitter(Task.Instance, StepDeltaTime, Component->PendingSpawnLocation);
+			}
+		}
+		Task.Instance->UpdateParticleBounds();
+		TaskTimesMS[TaskIndex] = TaskCounter.Finish();
+	});
+
+	// ========== 2.5단계: 충돌 (파티션 BVH 쿼리는 게임 스레드에서 한 번에) ==========
+	SolveCollisions(Stats);
+
+	// ========== 3단계: 동기화 지점 (시스템별 시간 집계 + 통계 발행) ==========
+	Stats.SimulatedSystems = static_cast<uint32>(PendingComponents.Num());
+	Stats.SimulatedEmitters = static_cast<uint32>(Tasks.Num());
+	Stats.NumThreads = FTaskScheduler::Get().IsInitialized() ? static_cast<uint32>(FTaskScheduler::Get().GetMaxConcurrency()) : 1;
+
+	for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+	{
+		const FEmitterTask& Task = Tasks[TaskIndex];
+		PendingComponents[Task.ComponentIndex]->LastSimulationTimeMS += TaskTimesMS[TaskIndex];
+		Stats.SimulatedParticles += static_cast<uint32>(Task.Instance->ActiveParticles);
+
+		if (Task.Instance->NumThrottledSpawns > 0)
+		{
+			++Stats.ThrottledEmitters;
+			Stats.ThrottledSpawns += static_cast<uint32>(Task.Instance->NumThrottledSpawns);
+		}
+	}
+
+	// 웜업 스냅샷 저장이 복사보다 먼저
+	for (UParticleSystemComponent* Component : PendingComponents)
+	{
+		if (Component->PendingFastForwardTime <= 0.0f || std::find(DeferredWarmups.begin(), DeferredWarmups.end(), Component) != DeferredWarmups.end())
+		{
+			continue;
+		}
+
+		if (Component->bCaptureWarmupSnapshot)
+		{
+			++Stats.WarmedUpSystems;
+			Stats.WarmupTimeMS += Component->LastSimulationTimeMS;
+		}
+		Component->FinishFastForward();
+	}
+
+	for (UParticleSystemComponent* Component : DeferredWarmups)
+	{
+		Component->PendingFastForwardTime = 0.0f;
+		Component->bCaptureWarmupSnapshot = false;
+		if (Component->Template && Component->Template->WarmupSnapshot.Apply(Component->Template->WarmupTime, Component->PendingSpawnLocation, Component->EmitterInstances))
+		{
+			Component->AccumulatedTime += Component->Template->WarmupTime;
+			Component->LastDynamicDataFrame = 0;
+			++Stats.RestoredWarmupSystems;
+		}
+		else
+		{
+			// 리더의 캡처가 맞지 않으면 다음 Tick에 직접 웜업
+			Component->bWarmupPending = true;
+		}
+	}
+
+	for (UParticleSystemComponent* Component : PendingComponents)
+	{
+		for (const FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (Instance && Instance->NumThrottledSpawns > 0)
+			{
+				++Stats.ThrottledSystems;
+				break;
+			}
+		}
+
+		Component->PendingSimulationDeltaTime = 0.0f;
+		Component->PendingSimulationSteps = 1;
+		Stats.TotalSystemTimeMS += Component->LastSimulationTimeMS;
+		Stats.MaxSystemTimeMS = std::max(Stats.MaxSystemTimeMS, Component->LastSimulationTimeMS);
+
+		// 끝난 일회성 시스템은 비활성화하고 인스턴스를 템플릿 풀로 (같은 이펙트의 다음 활성화가 재사용)
+		if (Component->Template && Component->Template->bAutoDeactivate && !Component->IsFastForwarding() && Component->IsSystemComplete())
+		{
+			Component->ReleaseEmitterInstances();
+			++Stats.CompletedSystems;
+		}
+	}
+
+	PendingComponents.Empty();
+
+	CollectPoolStats(Stats);
+	Stats.WallTimeMS = WallCounter.Finish();
+	FParticleStatManager::GetInstance().UpdateSimulationStats(Stats);
+
+	// 충돌 이벤트는 단계가 완전히 끝난 뒤 발행 (콜백이 컴포넌트를 만들거나 지워도 이번 단계 목록에 영향 없음)
+	for (int32 Index = 0; Index < CollisionEventComponents.Num(); ++Index)
+	{
+		UParticleSystemComponent* Component = CollisionEventComponents[Index];
+		if (Component)
+		{
+			Component->PendingCollisionDispatch = nullptr;
+			Component->DispatchCollisionEvents();
+		}
+	}
+	CollisionEventComponents.Empty();
+}
+
+void FParticleSimulationManager::SolveCollisions(FParticleSimulationStats& Stats)
+{
+	// 웜업 스냅샷을 복사만 하는 컴포넌트는 작업이 없으므로 여기서도 빠짐
+	for (const FEmitterTask& Task : Tasks)
+	{
+		const UParticleSystemComponent* Component = PendingComponents[Task.ComponentIndex];
+		const auto It = std::find(Component->EmitterInstances.begin(), Component->EmitterInstances.end(), Task.Instance);
+		CollisionSolver.AddEmitter(Task.Instance, static_cast<int32>(It - Component->EmitterInstances.begin()), Component->PendingSimulationDeltaTime);
+	}
+
+	if (CollisionSolver.GetNumEmitters() == 0)
+	{
+		return;
+	}
+
+	CollisionSolver.Solve(World ? World->GetPartitionManager() : nullptr, Stats);
+
+	for (int32 Index = 0; Index < CollisionSolver.GetNumEmitters(); ++Index)
+	{
+		const TArray<FParticleCollisionEvent>& Events = CollisionSolver.GetEvents(Index);
+		if (Events.IsEmpty())
+		{
+			continue;
+		}
+
+		UParticleSystemComponent* Component = CollisionSolver.GetInstance(Index)->Component;
+		Component->PendingCollisionEvents.Append(Events);
+		if (Component->PendingCollisionDispatch != this)
+		{
+			Component->PendingCollisionDispatch = this;
+			CollisionEventComponents.Add(Component);
+		}
+	}
+	CollisionSolver.Reset();
+}
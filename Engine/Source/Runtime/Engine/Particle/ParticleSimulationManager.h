@@ -0,0 +1,146 @@
+#pragma once
+#include "ParticleCollision.h"
+
+class UParticleSystem;
+class UParticleSystemComponent;
+class UWorld;
+struct FParticleEmitterInstance;
+struct FParticleSimulationStats;
+
+/**
+ * @brief 전역 파티클 예산 (0이면 제한 없음)
+ * @details 넘치면 우선순위가 낮은 시스템(화면 밖 → 카메라에서 먼 순)부터 새 스폰을 막는다.
+ *          이미 살아 있는 파티클은 건드리지 않으므로 수명이 다하면서 자연스럽게 예산 안으로 돌아온다.
+ *          MaxEmitterInstances는 월드 하나에서 동시에 시뮬레이션하는 에미터 인스턴스 상한으로, 넘치면 같은 순서로
+ *          가장 덜 중요한 시스템부터 통째로 인스턴스를 템플릿 풀로 빼앗아 온다.
+ *          - bAutoDeactivate(일회성) 시스템: 비활성화 (늦게 재생하면 타이밍이 어긋나므로 다시 시작하지 않음)
+ *          - 반복 시스템: bIsActive를 유지한 채 쉬게 하고(bSuspendedByInstanceCap), 이후 프레임에 남은 여유에
+ *            템플릿 에미터가 모두 들어가면 중요한 순서로 풀에서 다시 꺼내 처음부터 재생한다.
+ *            재개는 여유 안에서만 하므로 쉬는 시스템이 실행 중인 덜 중요한 시스템을 밀어내지는 않는다.
+ */
+struct FParticleBudget
+{
+	int32 MaxLiveParticles = 200000;
+	int32 MaxActiveEmitters = 1024;
+	int32 MaxEmitterInstances = 2048;
+};
+
+/**
+ * @brief 월드 하나의 파티클 시뮬레이션 단계 (UWorld 소유)
+ * @details 기존에는 파티클 컴포넌트가 액터 Tick 안에서 모든 에미터를 직렬로 스폰/업데이트했다.
+ *          이제 TickComponent는 LOD/누적 시간 같은 게임 스레드 작업과 스폰 위치 캡처만 하고 QueueSimulation으로 등록한다.
+ *          액터 Tick이 끝나면 UWorld::Tick이 Simulate를 호출하고, 등록된 컴포넌트의 에미터 인스턴스를
+ *          (컴포넌트, 에미터) 단위 작업으로 펼쳐 워커에서 병렬로 시뮬레이션한다.
+ *
+ * [스레드 안전성]
+ * - 에미터 인스턴스끼리는 쓰기 공유 상태가 없다 (모듈은 읽기 전용, 난수는 에미터별 FParticleRandomStream)
+ * - 템플릿 캐시(PeakActiveParticles)는 작업을 펼치기 전에 게임 스레드에서 갱신하고 워커는 읽기만 한다
+ * - 컴포넌트 상태(월드 위치, DeltaTime)는 등록 시점에 캡처하므로 워커는 컴포넌트를 쓰지 않는다
+ * - ParallelFor가 끝나는 지점이 동기화 지점: 이후 렌더러가 UpdateDynamicData로 결과를 가져간다
+ *
+ * [웜업/빨리 감기]
+ * FastForward로 예약된 시간은 같은 작업 안에서 고정 스텝으로 먼저 처리한다 (렌더 데이터는 만들지 않음).
+ * 같은 템플릿의 웜업이 한 프레임에 여러 개 몰리면 하나만 시뮬레이션하고, 나머지는 동기화 지점에서 그 스냅샷을 복사한다.
+ *
+ * [충돌]
+ * 파티션 BVH 쿼리는 게임 스레드 전용이므로 병렬 시뮬레이션이 끝난 뒤 FParticleCollisionSolver로 한 번에 처리하고,
+ * 모인 충돌 이벤트는 단계 마지막에 컴포넌트의 OnParticleCollide로 발행한다.
+ *
+ * [인스턴스 풀]
+ * 모든 에미터가 끝난 bAutoDeactivate 시스템과 MaxEmitterInstances를 넘겨 밀려난 시스템은
+ * 에미터 인스턴스를 템플릿의 FParticleEmitterInstancePool로 돌려준다 (밀려난 반복 시스템은 비활성화하지 않고 쉬게 함).
+ */
+class FParticleSimulationManager
+{
+public:
+	explicit FParticleSimulationManager(UWorld* InWorld) : World(InWorld) {}
+	~FParticleSimulationManager();
+
+	FParticleSimulationManager(const FParticleSimulationManager&) = delete;
+	FParticleSimulationManager& operator=(const FParticleSimulationManager&) = delete;
+
+	/**
+	 * @brief 이번 프레임 시뮬레이션 단계에 컴포넌트 등록
+	 * @details 같은 프레임에 두 번 등록되면 DeltaTime만 누적된다 (컴포넌트 쪽에서 처리).
+	 */
+	void QueueSimulation(UParticleSystemComponent* Component);
+
+	/** 등록 취소 (시뮬레이션 전에 컴포넌트가 삭제될 때) */
+	void CancelSimulation(UParticleSystemComponent* Component);
+
+	/**
+	 * @brief 등록된 컴포넌트의 모든 에미터를 병렬로 시뮬레이션하고 등록 목록을 비움
+	 * @details 반환 시점에 모든 에미터 시뮬레이션이 끝나 있으며, 시스템별 시간은 FParticleStatManager로 보낸다.
+	 */
+	void Simulate();
+
+	int32 GetNumPending() const { return PendingComponents.Num(); }
+
+	/** 화면 밖 시간 초과 시스템 기록 (TickComponent에서 호출, 통계용) */
+	void RecordOffscreenSystem(bool bSkipped)
+	{
+		++NumOffscreenSystems;
+		if (bSkipped)
+		{
+			++NumSkippedOffscreenSystems;
+		}
+	}
+
+	/** 템플릿 웜업 스냅샷으로 시뮬레이션 없이 웜업을 끝낸 시스템 기록 (통계용) */
+	void RecordWarmupRestored() { ++NumRestoredWarmups; }
+
+	/** 모든 월드가 공유하는 전역 예산 */
+	static void SetBudget(const FParticleBudget& InBudget) { Budget = InBudget; }
+	static const FParticleBudget& GetBudget() { return Budget; }
+
+private:
+	/** PendingComponents 인덱스를 중요한 순서(화면 안 → 카메라에 가까운 순)로 PriorityOrder에 정렬 */
+	void SortByPriority();
+
+	/**
+	 * @brief 등록된 시스템의 에미터 인스턴스 수가 MaxEmitterInstances를 넘으면 덜 중요한 시스템부터 빼앗음
+	 * @details 빼앗긴 시스템은 이번 단계에서 빠지고 인스턴스는 템플릿 풀로 돌아간다 (정책은 FParticleBudget 참고).
+	 *          쉬고 있는 시스템도 여기서 여유를 확인해 재개하거나 다시 등록 목록에서 뺀다.
+	 */
+	void StealLeastSignificant(FParticleSimulationStats& Stats);
+
+	/**
+	 * @brief 우선순위 순으로 에미터별 SpawnBudget 배분
+	 * @details 이번 프레임 시작 시점의 활성 파티클 수 기준이라 초과분은 한 프레임 스폰량 이내로 제한된다.
+	 */
+	void AssignSpawnBudgets();
+
+	/** 시뮬레이션이 끝난 에미터의 충돌 처리 후 이벤트를 컴포넌트에 모아 둠 */
+	void SolveCollisions(FParticleSimulationStats& Stats);
+
+	// 에미터 하나의 시뮬레이션 작업
+	struct FEmitterTask
+	{
+		FParticleEmitterInstance* Instance = nullptr;
+		int32 ComponentIndex = 0;	// PendingComponents 인덱스
+		int32 Cost = 0;				// 정렬용 예상 비용 (활성 파티클 수)
+	};
+
+	UWorld* World = nullptr;
+	TArray<UParticleSystemComponent*> PendingComponents;
+
+	// 프레임마다 재사용하는 작업/시간 배열
+	TArray<FEmitterTask> Tasks;
+	TArray<double> TaskTimesMS;
+	TArray<int32> PriorityOrder;
+	TArray<UParticleSystem*> ActiveTemplates;	// 이번 단계에 등록된 템플릿 (중복 제거)
+
+	// 이번 단계에서 웜업을 시뮬레이션하는 컴포넌트 (템플릿마다 하나) / 그 결과를 복사만 할 컴포넌트
+	TArray<UParticleSystemComponent*> WarmupLeaders;
+	TArray<UParticleSystemComponent*> DeferredWarmups;
+
+	// 시뮬레이션 뒤 충돌 단계 (쿼리/이벤트 버퍼 재사용)
+	FParticleCollisionSolver CollisionSolver;
+	TArray<UParticleSystemComponent*> CollisionEventComponents;	// 이벤트 발행을 기다리는 컴포넌트 (발행 전에 삭제되면 nullptr)
+
+	uint32 NumOffscreenSystems = 0;
+	uint32 NumSkippedOffscreenSystems = 0;
+	uint32 NumRestoredWarmups = 0;
+
+	static FParticleBudget Budget;
+};
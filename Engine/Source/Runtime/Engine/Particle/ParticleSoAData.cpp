@@ -0,0 +1,253 @@
+#include "pch.h"
+#include "ParticleSoAData.h"
+#include "ParticleTypes.h"
+#include <immintrin.h> // For SSE
+
+namespace
+{
+	constexpr size_t StreamAlignment = 16;
+
+	int32 AlignToSimdWidth(int32 Count)
+	{
+		return (Count + (FParticleSoAData::SimdWidth - 1)) & ~(FParticleSoAData::SimdWidth - 1);
+	}
+
+	// Dst += Src * DeltaTime (4개씩, 스트림은 16바이트 정렬 + 패딩)
+	void MultiplyAddStream(float* Dst, const float* Src, int32 PaddedNum, float DeltaTime)
+	{
+		const __m128 Dt = _mm_set1_ps(DeltaTime);
+		for (int32 i = 0; i < PaddedNum; i += FParticleSoAData::SimdWidth)
+		{
+			const __m128 Value = _mm_load_ps(Dst + i);
+			const __m128 Rate = _mm_load_ps(Src + i);
+			_mm_store_ps(Dst + i, _mm_add_ps(Value, _mm_mul_ps(Rate, Dt)));
+		}
+	}
+}
+
+void FParticleSoAData::Init(int32 InParticleStride, int32 InPayloadOffset)
+{
+	Free();
+
+	ParticleStride = InParticleStride;
+	PayloadOffset = InPayloadOffset;
+	PayloadStride = std::max(0, InParticleStride - InPayloadOffset);
+
+	StagingParticle = static_cast<uint8*>(_aligned_malloc(ParticleStride, StreamAlignment));
+	if (StagingParticle)
+	{
+		memset(StagingParticle, 0, ParticleStride);
+	}
+}
+
+bool FParticleSoAData::Reserve(int32 NewCapacity, int32 NumToKeep)
+{
+	NewCapacity = AlignToSimdWidth(NewCapacity);
+	if (NewCapacity <= Capacity)
+	{
+		return true;
+	}
+
+	// 패딩 구간도 커널이 읽으므로 0으로 채워 둠 (NaN/비정규화 수 방지)
+	const size_t StreamBytes = sizeof(float) * Stream_Count * NewCapacity;
+	float* NewStreams = static_cast<float*>(_aligned_malloc(StreamBytes, StreamAlignment));
+	if (!NewStreams)
+	{
+		return false;
+	}
+	memset(NewStreams, 0, StreamBytes);
+
+	uint8* NewPayloadData = nullptr;
+	if (PayloadStride > 0)
+	{
+		NewPayloadData = static_cast<uint8*>(_aligned_malloc(static_cast<size_t>(PayloadStride) * NewCapacity, StreamAlignment));
+		if (!NewPayloadData)
+		{
+			_aligned_free(NewStreams);
+			return false;
+		}
+	}
+
+	// 스트림마다 위치가 바뀌므로 Realloc 대신 스트림별로 복사
+	NumToKeep = std::min(NumToKeep, Capacity);
+	if (Streams && NumToKeep > 0)
+	{
+		for (int32 Stream = 0; Stream < Stream_Count; ++Stream)
+		{
+			memcpy(NewStreams + static_cast<size_t>(Stream) * NewCapacity, Streams + static_cast<size_t>(Stream) * Capacity, sizeof(float) * NumToKeep);
+		}
+		if (PayloadData && NewPayloadData)
+		{
+			memcpy(NewPayloadData, PayloadData, static_cast<size_t>(PayloadStride) * NumToKeep);
+		}
+	}
+
+	if (Streams)
+	{
+		_aligned_free(Streams);
+	}
+	if (PayloadData)
+	{
+		_aligned_free(PayloadData);
+	}
+
+	Streams = NewStreams;
+	PayloadData = NewPayloadData;
+	Capacity = NewCapacity;
+	return true;
+}
+
+void FParticleSoAData::Free()
+{
+	if (Streams)
+	{
+		_aligned_free(Streams);
+		Streams = nullptr;
+	}
+	if (PayloadData)
+	{
+		_aligned_free(PayloadData);
+		PayloadData = nullptr;
+	}
+	if (StagingParticle)
+	{
+		_aligned_free(StagingParticle);
+		StagingParticle = nullptr;
+	}
+	Capacity = 0;
+}
+
+void FParticleSoAData::StoreParticle(int32 Index, const uint8* ParticlePtr)
+{
+	const FBaseParticle& Particle = *reinterpret_cast<const FBaseParticle*>(ParticlePtr);
+
+	GetStream(Stream_LocationX)[Index] = Particle.Location.X;
+	GetStream(Stream_LocationY)[Index] = Particle.Location.Y;
+	GetStream(Stream_LocationZ)[Index] = Particle.Location.Z;
+	GetStream(Stream_OldLocationX)[Index] = Particle.OldLocation.X;
+	GetStream(Stream_OldLocationY)[Index] = Particle.OldLocation.Y;
+	GetStream(Stream_OldLocationZ)[Index] = Particle.OldLocation.Z;
+	GetStream(Stream_VelocityX)[Index] = Particle.Velocity.X;
+	GetStream(Stream_VelocityY)[Index] = Particle.Velocity.Y;
+	GetStream(Stream_VelocityZ)[Index] = Particle.Velocity.Z;
+	GetStream(Stream_BaseVelocityX)[Index] = Particle.BaseVelocity.X;
+	GetStream(Stream_BaseVelocityY)[Index] = Particle.BaseVelocity.Y;
+	GetStream(Stream_BaseVelocityZ)[Index] = Particle.BaseVelocity.Z;
+	GetStream(Stream_RelativeTime)[Index] = Particle.RelativeTime;
+	GetStream(Stream_OneOverLifetime)[Index] = 1.0f / Particle.Lifetime;
+	GetStream(Stream_Rotation)[Index] = Particle.Rotation;
+	GetStream(Stream_RotationRate)[Index] = Particle.RotationRate;
+	GetStream(Stream_SizeX)[Index] = Particle.Size.X;
+	GetStream(Stream_SizeY)[Index] = Particle.Size.Y;
+	GetStream(Stream_SizeZ)[Index] = Particle.Size.Z;
+	GetStream(Stream_ColorR)[Index] = Particle.Color.R;
+	GetStream(Stream_ColorG)[Index] = Particle.Color.G;
+	GetStream(Stream_ColorB)[Index] = Particle.Color.B;
+	GetStream(Stream_ColorA)[Index] = Particle.Color.A;
+	GetFlags()[Index] = static_cast<uint32>(Particle.Flags);
+
+	if (PayloadStride > 0)
+	{
+		memcpy(GetPayload(Index), ParticlePtr + PayloadOffset, PayloadStride);
+	}
+}
+
+void FParticleSoAData::LoadParticle(int32 Index, uint8* OutParticlePtr) const
+{
+	FBaseParticle& Particle = *reinterpret_cast<FBaseParticle*>(OutParticlePtr);
+
+	Particle.Location = FVector(GetStream(Stream_LocationX)[Index], GetStream(Stream_LocationY)[Index], GetStream(Stream_LocationZ)[Index]);
+	Particle.OldLocation = FVector(GetStream(Stream_OldLocationX)[Index], GetStream(Stream_OldLocationY)[Index], GetStream(Stream_OldLocationZ)[Index]);
+	Particle.Velocity = FVector(GetStream(Stream_VelocityX)[Index], GetStream(Stream_VelocityY)[Index], GetStream(Stream_VelocityZ)[Index]);
+	Particle.BaseVelocity = FVector(GetStream(Stream_BaseVelocityX)[Index], GetStream(Stream_BaseVelocityY)[Index], GetStream(Stream_BaseVelocityZ)[Index]);
+	Particle.RelativeTime = GetStream(Stream_RelativeTime)[Index];
+	Particle.Lifetime = 1.0f / GetStream(Stream_OneOverLifetime)[Index];
+	Particle.Rotation = GetStream(Stream_Rotation)[Index];
+	Particle.RotationRate = GetStream(Stream_RotationRate)[Index];
+	Particle.Size = FVector(GetStream(Stream_SizeX)[Index], GetStream(Stream_SizeY)[Index], GetStream(Stream_SizeZ)[Index]);
+	Particle.Color = FLinearColor(GetStream(Stream_ColorR)[Index], GetStream(Stream_ColorG)[Index], GetStream(Stream_ColorB)[Index], GetStream(Stream_ColorA)[Index]);
+	Particle.Flags = static_cast<int32>(GetFlags()[Index]);
+
+	if (PayloadStride > 0)
+	{
+		memcpy(OutParticlePtr + PayloadOffset, GetPayload(Index), PayloadStride);
+	}
+}
+
+void FParticleSoAData::MoveParticle(int32 From, int32 To)
+{
+	if (From == To)
+	{
+		return;
+	}
+
+	for (int32 Stream = 0; Stream < Stream_Count; ++Stream)
+	{
+		float* Data = Streams + static_cast<size_t>(Stream) * Capacity;
+		Data[To] = Data[From];
+	}
+
+	if (PayloadStride > 0)
+	{
+		memcpy(GetPayload(To), GetPayload(From), PayloadStride);
+	}
+}
+
+void FParticleSoAData::UpdateLifetime(int32 Num, float DeltaTime)
+{
+	const int32 PaddedNum = AlignToSimdWidth(Num);
+
+	// 플래그 비트 연산은 정수 그대로 (float 비트 패턴으로 AND)
+	uint32* Flags = GetFlags();
+	const __m128 KeepMask = _mm_castsi128_ps(_mm_set1_epi32(~static_cast<int32>(STATE_Particle_JustSpawned)));
+	for (int32 i = 0; i < PaddedNum; i += SimdWidth)
+	{
+		float* FlagPtr = reinterpret_cast<float*>(Flags + i);
+		_mm_store_ps(FlagPtr, _mm_and_ps(_mm_load_ps(FlagPtr), KeepMask));
+	}
+
+	MultiplyAddStream(GetStream(Stream_RelativeTime), GetStream(Stream_OneOverLifetime), PaddedNum, DeltaTime);
+}
+
+void FParticleSoAData::IntegrateLocation(int32 Num, float DeltaTime)
+{
+	const int32 PaddedNum = AlignToSimdWidth(Num);
+	MultiplyAddStream(GetStream(Stream_LocationX), GetStream(Stream_VelocityX), PaddedNum, DeltaTime);
+	MultiplyAddStream(GetStream(Stream_LocationY), GetStream(Stream_VelocityY), PaddedNum, DeltaTime);
+	MultiplyAddStream(GetStream(Stream_LocationZ), GetStream(Stream_VelocityZ), PaddedNum, DeltaTime);
+}
+
+void FParticleSoAData::IntegrateRotation(int32 Num, float DeltaTime)
+{
+	MultiplyAddStream(GetStream(Stream_Rotation), GetStream(Stream_RotationRate), AlignToSimdWidth(Num), DeltaTime);
+}
+
+int32 FParticleSoAData::KillExpired(int32 Num)
+{
+	const float* RelativeTime = GetStream(Stream_RelativeTime);
+	const __m128 One = _mm_set1_ps(1.0f);
+
+	// 뒤쪽 묶음부터: 제거된 자리는 이미 검사를 마친(살아있는) 마지막 파티클로 채워지므로 다시 볼 필요가 없다
+	for (int32 Block = AlignToSimdWidth(Num) - SimdWidth; Block >= 0; Block -= SimdWidth)
+	{
+		int32 Mask = _mm_movemask_ps(_mm_cmpge_ps(_mm_load_ps(RelativeTime + Block), One));
+		if (Mask == 0)
+		{
+			continue;
+		}
+
+		for (int32 Lane = SimdWidth - 1; Lane >= 0; --Lane)
+		{
+			const int32 Index = Block + Lane;
+			if ((Mask & (1 << Lane)) == 0 || Index >= Num)
+			{
+				continue;
+			}
+
+			MoveParticle(Num - 1, Index);
+			--Num;
+		}
+	}
+
+	return Num;
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include "Particle.h"
+
+/**
+ * @brief 파티클 SoA(Structure of Arrays) 저장소
+ * @details FBaseParticle의 필드를 스트림(float 배열)별로 나눠 저장하고, 모듈 Payload는 파티클마다 한 블록씩 따로 모아 둔다.
+ *          살아있는 파티클은 항상 [0, Num) 구간에 빈틈없이 모여 있어 (죽으면 마지막 파티클로 채움) 간접 인덱스가 필요 없고,
+ *          스트림 길이를 SIMD 폭의 배수로 패딩해 두어 커널이 나머지 처리 없이 4개씩 끝까지 돈다.
+ *
+ * [AoS와의 관계]
+ * Spawn 모듈은 FBaseParticle + Payload 한 덩어리를 기대하므로 스테이징 파티클(AoS 한 개)에 쓴 뒤 StoreParticle로 흩어 넣고,
+ * 렌더러에 넘길 때는 LoadParticle로 다시 AoS로 모은다.
+ */
+struct FParticleSoAData
+{
+	/** FBaseParticle 필드별 스트림 (Flags는 uint32 비트를 그대로 저장) */
+	enum EStream : int32
+	{
+		Stream_LocationX,
+		Stream_LocationY,
+		Stream_LocationZ,
+		Stream_OldLocationX,
+		Stream_OldLocationY,
+		Stream_OldLocationZ,
+		Stream_VelocityX,
+		Stream_VelocityY,
+		Stream_VelocityZ,
+		Stream_BaseVelocityX,
+		Stream_BaseVelocityY,
+		Stream_BaseVelocityZ,
+		Stream_RelativeTime,
+		Stream_OneOverLifetime,		// Lifetime 대신 역수를 저장해 수명 커널에서 나눗셈 제거
+		Stream_Rotation,
+		Stream_RotationRate,
+		Stream_SizeX,
+		Stream_SizeY,
+		Stream_SizeZ,
+		Stream_ColorR,
+		Stream_ColorG,
+		Stream_ColorB,
+		Stream_ColorA,
+		Stream_Flags,
+		Stream_Count
+	};
+
+	/** 커널 한 번에 처리하는 파티클 수 (SSE 128비트) */
+	static constexpr int32 SimdWidth = 4;
+
+	FParticleSoAData() = default;
+	~FParticleSoAData() { Free(); }
+	FParticleSoAData(const FParticleSoAData&) = delete;
+	FParticleSoAData& operator=(const FParticleSoAData&) = delete;
+
+	/**
+	 * @brief 파티클 구성 설정 (스트림은 비우고 스테이징 파티클만 할당)
+	 * @param InParticleStride AoS 파티클 하나의 크기 (FBaseParticle + Payload)
+	 * @param InPayloadOffset AoS 파티클 안에서 Payload가 시작되는 오프셋
+	 */
+	void Init(int32 InParticleStride, int32 InPayloadOffset);
+
+	/**
+	 * @brief 용량 확장 (앞쪽 NumToKeep개는 보존)
+	 * @return 할당 실패 시 false
+	 */
+	bool Reserve(int32 NewCapacity, int32 NumToKeep);
+
+	void Free();
+
+	bool IsAllocated() const { return Streams != nullptr; }
+	int32 GetCapacity() const { return Capacity; }
+	int32 GetPayloadStride() const { return PayloadStride; }
+
+	float* GetStream(EStream Stream) const { return Streams + static_cast<size_t>(Stream) * Capacity; }
+	uint32* GetFlags() const { return reinterpret_cast<uint32*>(GetStream(Stream_Flags)); }
+	uint8* GetPayload(int32 Index) const { return PayloadData + static_cast<size_t>(Index) * PayloadStride; }
+
+	/** Spawn 모듈이 채울 AoS 파티클 한 개 (ParticleStride 바이트) */
+	uint8* GetStagingParticle() const { return StagingParticle; }
+
+	/** AoS 파티클(FBaseParticle + Payload)을 Index 슬롯에 흩어 넣음 */
+	void StoreParticle(int32 Index, const uint8* ParticlePtr);
+
+	/** Index 슬롯을 AoS 파티클(FBaseParticle + Payload)로 모음 */
+	void LoadParticle(int32 Index, uint8* OutParticlePtr) const;
+
+	/** From 슬롯의 파티클을 To 슬롯으로 복사 (Swap-and-Pop 제거용) */
+	void MoveParticle(int32 From, int32 To);
+
+	FVector GetLocation(int32 Index) const
+	{
+		return FVector(GetStream(Stream_LocationX)[Index], GetStream(Stream_LocationY)[Index], GetStream(Stream_LocationZ)[Index]);
+	}
+
+	// ==================== SIMD 커널 ====================
+	// Num = 활성 파티클 수. 패딩 구간(Num ~ SIMD 폭 배수)도 함께 계산하지만 결과는 쓰이지 않는다.
+
+	/** "방금 생성됨" 플래그 클리어 + RelativeTime += DeltaTime / Lifetime */
+	void UpdateLifetime(int32 Num, float DeltaTime);
+
+	/** Location += Velocity * DeltaTime */
+	void IntegrateLocation(int32 Num, float DeltaTime);
+
+	/** Rotation += RotationRate * DeltaTime */
+	void IntegrateRotation(int32 Num, float DeltaTime);
+
+	/**
+	 * @brief RelativeTime >= 1인 파티클 제거 (역순 Swap-and-Pop, AoS의 KillParticle과 같은 순서)
+	 * @details 4개 단위 비교 마스크가 0이면 그 묶음은 건너뛴다.
+	 * @return 남은 활성 파티클 수
+	 */
+	int32 KillExpired(int32 Num);
+
+private:
+	float* Streams = nullptr;			// Stream_Count * Capacity 개 float, 16바이트 정렬
+	uint8* PayloadData = nullptr;		// Capacity * PayloadStride 바이트
+	uint8* StagingParticle = nullptr;	// ParticleStride 바이트
+	int32 Capacity = 0;
+	int32 ParticleStride = 0;
+	int32 PayloadOffset = 0;
+	int32 PayloadStride = 0;
+};
@@ -0,0 +1,316 @@
+#include "pch.h"
+#include "ParticleSort.h"
+#include "ParticleHelper.h"
+#include "SceneView.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+#include <immintrin.h> // For SSE
+
+namespace
+{
+	constexpr int32 SimdWidth = 4;
+	constexpr int32 RadixBuckets = 256;
+
+	int32 AlignToSimdWidth(int32 Num)
+	{
+		return (Num + (SimdWidth - 1)) & ~(SimdWidth - 1);
+	}
+}
+
+void FParticleSorter::Sort(EParticleSortMode SortMode, bool bLocalSpace,
+	int32 ParticleCount, const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices,
+	const FSceneView* View, const FMatrix& LocalToWorld, FParticleOrder* ParticleOrder)
+{
+	FScopeCycleCounter SortCounter;
+
+	Count = ParticleCount;
+	LastSortedCount = 0;
+	bLastSortParallel = false;
+
+	if (Count <= 0 || SortMode == EParticleSortMode::None || !ParticleData || !ParticleIndices || !ParticleOrder)
+	{
+		LastSortTimeMS = 0.0;
+		return;
+	}
+
+	// 큰 에미터만 구간으로 나눔 (작은 에미터는 작업 분배 비용이 정렬보다 큼)
+	bLastSortParallel = Count >= ParallelThreshold && FTaskScheduler::Get().IsInitialized();
+	NumChunks = bLastSortParallel ? (Count + ChunkSize - 1) / ChunkSize : 1;
+
+	const bool bDepthSort = (SortMode == EParticleSortMode::ViewProjDepth || SortMode == EParticleSortMode::DistanceToView);
+	if (bDepthSort)
+	{
+		if (!View)
+		{
+			LastSortTimeMS = SortCounter.Finish();
+			return;
+		}
+		const int32 NumKeyBytes = Count <= MaxCountFor16BitKeys ? 2 : 3;
+		BuildDepthKeys(SortMode, bLocalSpace, NumKeyBytes, ParticleData, ParticleStride, ParticleIndices, View, LocalToWorld);
+		RadixSort(NumKeyBytes);
+	}
+	else
+	{
+		BuildAgeKeys(SortMode, ParticleData, ParticleStride, ParticleIndices);
+		RadixSort(4);
+	}
+
+	// 정렬 결과를 FParticleOrder로 출력 (Z/C는 기존과 같은 값)
+	ParallelFor(NumChunks, [this, bDepthSort, ParticleOrder](int32 Chunk)
+	{
+		int32 Begin, End;
+		GetChunkRange(Chunk, Begin, End);
+		for (int32 i = Begin; i < End; ++i)
+		{
+			const uint32 ParticleIndex = Order[i];
+			ParticleOrder[i].ParticleIndex = static_cast<int32>(ParticleIndex);
+			if (bDepthSort)
+			{
+				ParticleOrder[i].Z = Depths[ParticleIndex];
+			}
+			else
+			{
+				// 나이 키는 ~C로 저장했고 정렬 중 Keys도 같이 옮겨지므로 Keys[i]가 Order[i]의 키
+				ParticleOrder[i].C = ~Keys[i];
+			}
+		}
+	});
+
+	LastSortedCount = Count;
+	LastSortTimeMS = SortCounter.Finish();
+}
+
+void FParticleSorter::BuildDepthKeys(EParticleSortMode SortMode, bool bLocalSpace, int32 NumKeyBytes,
+	const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices,
+	const FSceneView* View, const FMatrix& LocalToWorld)
+{
+	const int32 PaddedCount = AlignToSimdWidth(Count);
+	PositionX.SetNum(PaddedCount);
+	PositionY.SetNum(PaddedCount);
+	PositionZ.SetNum(PaddedCount);
+	Depths.SetNum(PaddedCount);
+	Keys.SetNum(PaddedCount);
+	ChunkMinDepth.SetNum(NumChunks);
+	ChunkMaxDepth.SetNum(NumChunks);
+
+	// 깊이 = X * A + Y * B + Z * C + D (ViewProjDepth: 클립 공간 W, 행 벡터 기준 4번째 열)
+	const bool bDistance = (SortMode == EParticleSortMode::DistanceToView);
+	const FMatrix ViewProj = View->GetViewProjectionMatrix();
+	const __m128 A = _mm_set1_ps(bDistance ? View->ViewLocation.X : ViewProj.M[0][3]);
+	const __m128 B = _mm_set1_ps(bDistance ? View->ViewLocation.Y : ViewProj.M[1][3]);
+	const __m128 C = _mm_set1_ps(bDistance ? View->ViewLocation.Z : ViewProj.M[2][3]);
+	const __m128 D = _mm_set1_ps(ViewProj.M[3][3]);
+
+	// ========== 1단계: 간접 인덱스로 위치를 SoA로 모으고 깊이 계산 ==========
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		int32 Begin, End;
+		GetChunkRange(Chunk, Begin, End);
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[i]);
+			const FVector Position = bLocalSpace ? LocalToWorld.TransformPosition(Particle.Location) : Particle.Location;
+			PositionX[i] = Position.X;
+			PositionY[i] = Position.Y;
+			PositionZ[i] = Position.Z;
+		}
+
+		// 마지막 구간의 패딩은 마지막 파티클 위치로 채워 Min/Max에 영향이 없게 함
+		const int32 SimdEnd = AlignToSimdWidth(End);
+		for (int32 i = End; i < SimdEnd; ++i)
+		{
+			PositionX[i] = PositionX[End - 1];
+			PositionY[i] = PositionY[End - 1];
+			PositionZ[i] = PositionZ[End - 1];
+		}
+
+		__m128 MinDepth = _mm_set1_ps(FLT_MAX);
+		__m128 MaxDepth = _mm_set1_ps(-FLT_MAX);
+		for (int32 i = Begin; i < SimdEnd; i += SimdWidth)
+		{
+			const __m128 X = _mm_loadu_ps(PositionX.GetData() + i);
+			const __m128 Y = _mm_loadu_ps(PositionY.GetData() + i);
+			const __m128 Z = _mm_loadu_ps(PositionZ.GetData() + i);
+
+			__m128 Depth;
+			if (bDistance)
+			{
+				const __m128 DX = _mm_sub_ps(X, A);
+				const __m128 DY = _mm_sub_ps(Y, B);
+				const __m128 DZ = _mm_sub_ps(Z, C);
+				Depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY)), _mm_mul_ps(DZ, DZ));
+			}
+			else
+			{
+				Depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, A), _mm_mul_ps(Y, B)), _mm_add_ps(_mm_mul_ps(Z, C), D));
+			}
+
+			_mm_storeu_ps(Depths.GetData() + i, Depth);
+			MinDepth = _mm_min_ps(MinDepth, Depth);
+			MaxDepth = _mm_max_ps(MaxDepth, Depth);
+		}
+
+		alignas(16) float MinLanes[SimdWidth];
+		alignas(16) float MaxLanes[SimdWidth];
+		_mm_store_ps(MinLanes, MinDepth);
+		_mm_store_ps(MaxLanes, MaxDepth);
+		ChunkMinDepth[Chunk] = std::min(std::min(MinLanes[0], MinLanes[1]), std::min(MinLanes[2], MinLanes[3]));
+		ChunkMaxDepth[Chunk] = std::max(std::max(MaxLanes[0], MaxLanes[1]), std::max(MaxLanes[2], MaxLanes[3]));
+	});
+
+	// ========== 2단계: [Min, Max]를 NumKeyBytes 바이트 정수로 양자화 ==========
+	float MinDepth = ChunkMinDepth[0];
+	float MaxDepth = ChunkMaxDepth[0];
+	for (int32 Chunk = 1; Chunk < NumChunks; ++Chunk)
+	{
+		MinDepth = std::min(MinDepth, ChunkMinDepth[Chunk]);
+		MaxDepth = std::max(MaxDepth, ChunkMaxDepth[Chunk]);
+	}
+
+	const int32 MaxKeyValue = (1 << (NumKeyBytes * 8)) - 1;
+	const float MaxDepthKey = static_cast<float>(MaxKeyValue);
+	const float Range = MaxDepth - MinDepth;
+	const __m128 Min = _mm_set1_ps(MinDepth);
+	const __m128 Scale = _mm_set1_ps(Range > 0.0f ? MaxDepthKey / Range : 0.0f);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 MaxKey = _mm_set1_ps(MaxDepthKey);
+	const __m128i MaxKeyInt = _mm_set1_epi32(MaxKeyValue);
+
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		int32 Begin, End;
+		GetChunkRange(Chunk, Begin, End);
+
+		const int32 SimdEnd = AlignToSimdWidth(End);
+		for (int32 i = Begin; i < SimdEnd; i += SimdWidth)
+		{
+			// NaN은 _mm_max_ps에서 0으로 떨어짐
+			__m128 Quantized = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(Depths.GetData() + i), Min), Scale);
+			Quantized = _mm_min_ps(_mm_max_ps(Quantized, Zero), MaxKey);
+
+			// 기수 정렬은 오름차순이므로 뒤집어서 먼 것(깊이 큰 것)이 앞에 오게 함
+			const __m128i Key = _mm_sub_epi32(MaxKeyInt, _mm_cvttps_epi32(Quantized));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Keys.GetData() + i), Key);
+		}
+	});
+}
+
+void FParticleSorter::BuildAgeKeys(EParticleSortMode SortMode, const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices)
+{
+	Keys.SetNum(Count);
+
+	const bool bOldestFirst = (SortMode == EParticleSortMode::Age_OldestFirst);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		int32 Begin, End;
+		GetChunkRange(Chunk, Begin, End);
+
+		for (int32 i = Begin; i < End; ++i)
+		{
+			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[i]);
+			const uint32 Counter = static_cast<uint32>(bOldestFirst ? (Particle.Flags & STATE_CounterMask) : ((~Particle.Flags) & STATE_CounterMask));
+
+			// C 내림차순 = ~C 오름차순
+			Keys[i] = ~Counter;
+		}
+	});
+}
+
+void FParticleSorter::RadixSort(int32 NumKeyBytes)
+{
+	Order.SetNum(Count);
+	OrderTemp.SetNum(Count);
+	KeysTemp.SetNum(Count);
+	ChunkHistograms.SetNum(NumChunks * RadixBuckets);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Order[i] = static_cast<uint32>(i);
+	}
+
+	uint32* SrcKeys = Keys.GetData();
+	uint32* DstKeys = KeysTemp.GetData();
+	uint32* SrcOrder = Order.GetData();
+	uint32* DstOrder = OrderTemp.GetData();
+
+	for (int32 Digit = 0; Digit < NumKeyBytes; ++Digit)
+	{
+		const uint32 Shift = static_cast<uint32>(Digit) * 8;
+
+		// ========== 구간별 히스토그램 ==========
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			int32 Begin, End;
+			GetChunkRange(Chunk, Begin, End);
+
+			uint32* Histogram = ChunkHistograms.GetData() + Chunk * RadixBuckets;
+			memset(Histogram, 0, sizeof(uint32) * RadixBuckets);
+			for (int32 i = Begin; i < End; ++i)
+			{
+				++Histogram[(SrcKeys[i] >> Shift) & 0xFF];
+			}
+		});
+
+		// ========== 버킷 → 구간 순서로 시작 위치 계산 (구간 순서를 지켜 안정 정렬 유지) ==========
+		uint32 Offset = 0;
+		bool bSingleBucket = false;
+		for (int32 Bucket = 0; Bucket < RadixBuckets; ++Bucket)
+		{
+			uint32 BucketTotal = 0;
+			for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+			{
+				uint32& Entry = ChunkHistograms[Chunk * RadixBuckets + Bucket];
+				const uint32 NumInChunk = Entry;
+				Entry = Offset;
+				Offset += NumInChunk;
+				BucketTotal += NumInChunk;
+			}
+			bSingleBucket |= (BucketTotal == static_cast<uint32>(Count));
+		}
+
+		// 모든 키의 이 자릿수가 같으면 분배해도 순서가 그대로이므로 건너뜀 (나이 키의 상위 바이트 등)
+		if (bSingleBucket)
+		{
+			continue;
+		}
+
+		// ========== 분배 ==========
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			int32 Begin, End;
+			GetChunkRange(Chunk, Begin, End);
+
+			uint32* Offsets = ChunkHistograms.GetData() + Chunk * RadixBuckets;
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const uint32 Destination = Offsets[(SrcKeys[i] >> Shift) & 0xFF]++;
+				DstKeys[Destination] = SrcKeys[i];
+				DstOrder[Destination] = SrcOrder[i];
+			}
+		});
+
+		std::swap(SrcKeys, DstKeys);
+		std::swap(SrcOrder, DstOrder);
+	}
+
+	// 홀수 번 분배했으면 결과가 임시 배열에 있으므로 배열을 맞바꿈 (복사 없음)
+	if (SrcOrder != Order.GetData())
+	{
+		std::swap(Keys, KeysTemp);
+		std::swap(Order, OrderTemp);
+	}
+}
+
+void FParticleSorter::GetChunkRange(int32 Chunk, int32& OutBegin, int32& OutEnd) const
+{
+	if (NumChunks <= 1)
+	{
+		OutBegin = 0;
+		OutEnd = Count;
+		return;
+	}
+
+	OutBegin = Chunk * ChunkSize;
+	OutEnd = std::min(Count, OutBegin + ChunkSize);
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "ParticleTypes.h"
+
+struct FParticleOrder;
+class FSceneView;
+
+/**
+ * @brief 스프라이트 파티클 정렬기 (LSD 기수 정렬)
+ * @details 기존에는 파티클마다 FParticleOrder를 만들고 float 비교 람다로 std::sort 했다.
+ *          이제 정렬 키를 정수로 양자화해 8비트 단위 LSD 기수 정렬을 한다.
+ *          - 깊이/거리 모드: 위치를 SoA로 모은 뒤 SSE로 깊이를 계산하고 [Min, Max] 범위를 정수 키로 양자화
+ *            (작은 에미터는 16비트 2패스, 키 충돌이 늘어나는 큰 에미터는 float 가수 정밀도와 같은 24비트 3패스)
+ *          - 나이 모드: 파티클 카운터를 그대로 32비트 키로 사용 (모든 원소가 같은 버킷인 자릿수 패스는 건너뜀)
+ *          - 파티클이 ParallelThreshold 이상이면 구간(Chunk)별로 키 계산/히스토그램/분배를 워커에 나눈다
+ *
+ * 에미터의 풀링된 렌더 데이터가 소유하므로 스크래치 버퍼는 프레임 사이에 재사용된다 (늘어날 때만 할당).
+ */
+class FParticleSorter
+{
+public:
+	/** 이 개수 이상이면 병렬로 정렬 */
+	static constexpr int32 ParallelThreshold = 8192;
+
+	/** 병렬 정렬 시 워커 하나가 맡는 구간 크기 */
+	static constexpr int32 ChunkSize = 4096;
+
+	/** 이 개수 이하이면 깊이 키를 16비트로, 넘으면 24비트로 양자화 */
+	static constexpr int32 MaxCountFor16BitKeys = 4096;
+
+	/**
+	 * @brief 파티클 정렬 (FDynamicSpriteEmitterDataBase::SortSpriteParticles와 같은 인자/결과)
+	 * @details 결과 순서는 기존 std::sort와 같다 (깊이/거리/나이 내림차순). 같은 키끼리는 원래 순서 유지.
+	 */
+	void Sort(EParticleSortMode SortMode, bool bLocalSpace,
+		int32 ParticleCount, const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices,
+		const FSceneView* View, const FMatrix& LocalToWorld, FParticleOrder* ParticleOrder);
+
+	/** 마지막 Sort에 걸린 시간 (키 계산 + 정렬 + 출력) */
+	double GetLastSortTimeMS() const { return LastSortTimeMS; }
+
+	/** 마지막 Sort가 정렬한 파티클 수 */
+	int32 GetLastSortedCount() const { return LastSortedCount; }
+
+	/** 마지막 Sort가 워커로 나뉘어 실행됐는지 */
+	bool WasLastSortParallel() const { return bLastSortParallel; }
+
+private:
+	/** 위치를 SoA로 모으고 NumKeyBytes 바이트 깊이 키 계산 */
+	void BuildDepthKeys(EParticleSortMode SortMode, bool bLocalSpace, int32 NumKeyBytes,
+		const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices,
+		const FSceneView* View, const FMatrix& LocalToWorld);
+
+	/** 파티클 카운터로 나이 키(32비트) 계산 */
+	void BuildAgeKeys(EParticleSortMode SortMode, const uint8* ParticleData, int32 ParticleStride, const uint32* ParticleIndices);
+
+	/** Keys 오름차순으로 Order를 안정 정렬 (NumKeyBytes개 자릿수) */
+	void RadixSort(int32 NumKeyBytes);
+
+	/** Count개를 NumChunks개 구간으로 나눴을 때 Chunk의 [Begin, End) */
+	void GetChunkRange(int32 Chunk, int32& OutBegin, int32& OutEnd) const;
+
+	int32 Count = 0;
+	int32 NumChunks = 1;
+
+	// 프레임마다 재사용하는 스크래치 (SIMD 폭 배수로 패딩)
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<float> Depths;
+	TArray<uint32> Keys;
+	TArray<uint32> KeysTemp;
+	TArray<uint32> Order;
+	TArray<uint32> OrderTemp;
+	TArray<uint32> ChunkHistograms;		// NumChunks * 256 (자릿수 패스마다 다시 채움)
+	TArray<float> ChunkMinDepth;
+	TArray<float> ChunkMaxDepth;
+
+	double LastSortTimeMS = 0.0;
+	int32 LastSortedCount = 0;
+	bool bLastSortParallel = false;
+};
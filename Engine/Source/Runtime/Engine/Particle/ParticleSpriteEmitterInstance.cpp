@@ -103,13 +103,16 @@ FDynamicEmitterDataBase* FParticleSpriteEmitterInstance::GetDynamicData(bool bSe
 		return nullptr;
 	}
 
-	// Allocate the dynamic data
-	FDynamicSpriteEmitterData* NewEmitterData = new FDynamicSpriteEmitterData();
+	// 풀링된 렌더 데이터 재사용 (처음 한 번만 할당)
+	if (!PooledDynamicData)
+	{
+		PooledDynamicData = new FDynamicSpriteEmitterData();
+	}
+	FDynamicSpriteEmitterData* NewEmitterData = static_cast<FDynamicSpriteEmitterData*>(PooledDynamicData);
 
 	// Fill in the source data (calls FillReplayData)
 	if (!FillReplayData(NewEmitterData->Source))
 	{
-		delete NewEmitterData;
 		return nullptr;
 	}
 
@@ -149,8 +152,12 @@ bool FParticleSpriteEmitterInstance::FillReplayData(FDynamicEmitterReplayDataBas
 		// Material (직접 할당)
 		SpriteData.MaterialInterface = RequiredModule->GetMaterial();
 
-		// RequiredModule (깊은 복사 - CreateRendererResource 사용)
-		SpriteData.RequiredModule = RequiredModule->CreateRendererResource();
+		// RequiredModule (깊은 복사 - 풀링된 데이터면 기존 것을 다시 채움)
+		if (!SpriteData.RequiredModule)
+		{
+			SpriteData.RequiredModule = new FParticleRequiredModule();
+		}
+		RequiredModule->FillRendererResource(*SpriteData.RequiredModule);
 
 		// BlendMode (렌더러에서 블렌드 스테이트 분기용)
 		SpriteData.BlendMode = RequiredModule->GetBlendMode();
@@ -215,6 +222,9 @@ FDynamicEmitterReplayDataBase* FParticleSpriteEmitterInstance::GetReplayData()
 		return nullptr;
 	}
 
+	// 리플레이는 이후 시뮬레이션과 무관한 스냅샷이어야 하므로 뷰를 복사본으로 전환
+	NewEmitterReplayData->DataContainer.MakeOwned(ParticleStride);
+
 	return NewEmitterReplayData;
 }
 
@@ -229,11 +239,11 @@ void FParticleSpriteEmitterInstance::GetAllocatedSize(int32& OutNum, int32& OutM
 	int32 Size = sizeof(FParticleSpriteEmitterInstance);
 	int32 ActiveParticleDataSize = (ParticleData != nullptr) ? (ActiveParticles * ParticleStride) : 0;
 	int32 MaxActiveParticleDataSize = (ParticleData != nullptr) ? (MaxActiveParticles * ParticleStride) : 0;
-	int32 ActiveParticleIndexSize = (ParticleIndices != nullptr) ? (ActiveParticles * sizeof(uint16)) : 0;
-	int32 MaxActiveParticleIndexSize = (ParticleIndices != nullptr) ? (MaxActiveParticles * sizeof(uint16)) : 0;
+	int32 ActiveParticleIndexSize = (ParticleIndices != nullptr) ? (ActiveParticles * sizeof(uint32)) : 0;
+	int32 MaxActiveParticleIndexSize = (ParticleIndices != nullptr) ? (MaxActiveParticles * sizeof(uint32)) : 0;
 
-	OutNum = ActiveParticleDataSize + ActiveParticleIndexSize + Size;
-	OutMax = MaxActiveParticleDataSize + MaxActiveParticleIndexSize + Size;
+	OutNum = ActiveParticleDataSize + ActiveParticleIndexSize + GetSoAAllocatedSize(ActiveParticles) + Size;
+	OutMax = MaxActiveParticleDataSize + MaxActiveParticleIndexSize + GetSoAAllocatedSize(MaxActiveParticles) + Size;
 }
 
 /**
@@ -31,6 +31,9 @@ UParticleSystem::UParticleSystem()
 
 void UParticleSystem::UpdateAllModuleLists()
 {
+	// 모듈 구성이 바뀌었을 수 있으므로 풀의 인스턴스는 버리고, 아직 살아 있는 이전 인스턴스도 돌아오지 못하게 함
+	InstancePool.Invalidate();
+
 	// 캐시 초기화
 	bHasGPUEmitter = false;
 	MaxDuration = 0.0f;
@@ -195,6 +198,21 @@ float UParticleSystem::GetLODDistance(int32 LODLevelIndex) const
 	return 0.0f;
 }
 
+/**
+ * 모든 이미터의 PeakActiveParticles 갱신
+ * 에디터에서 모듈 값을 바꿔도 알림이 없으므로 시뮬레이션 전에 게임 스레드에서 호출 (워커는 캐시된 값만 읽음)
+ */
+void UParticleSystem::RefreshPeakActiveParticles()
+{
+	for (UParticleEmitter* Emitter : Emitters)
+	{
+		if (Emitter)
+		{
+			Emitter->RefreshPeakActiveParticles();
+		}
+	}
+}
+
 UParticleEmitter* UParticleSystem::GetEmitter(int32 Index)
 {
 	if (Index >= 0 && Index < static_cast<int32>(Emitters.size()))
@@ -210,6 +228,10 @@ UParticleEmitter* UParticleSystem::GetEmitter(int32 Index)
  */
 void UParticleSystem::OnModuleChanged()
 {
+	// 모듈이 바뀌면 웜업 결과와 풀에 보관된 인스턴스의 레이아웃도 달라지므로 폐기
+	WarmupSnapshot.Reset();
+	InstancePool.Invalidate();
+
 	// TObjectIterator로 모든 PSC를 순회하여 이 Template을 사용하는 것 탐색
 	for (TObjectIterator<UParticleSystemComponent> It; It; ++It)
 	{
@@ -240,6 +262,11 @@ void UParticleSystem::Serialize(bool bIsLoading, JSON& InOutHandle)
 		if (InOutHandle.hasKey("Delay")) Delay = static_cast<float>(InOutHandle["Delay"].ToFloat());
 		if (InOutHandle.hasKey("bAutoDeactivate")) bAutoDeactivate = InOutHandle["bAutoDeactivate"].ToBool();
 		if (InOutHandle.hasKey("ThumbnailData")) ThumbnailData = InOutHandle["ThumbnailData"].ToString();
+		WarmupSnapshot.Reset();
+		if (InOutHandle.hasKey("WarmupSnapshot"))
+		{
+			WarmupSnapshot.Serialize(true, InOutHandle["WarmupSnapshot"]);
+		}
 		// LODDistances
 		LODDistances.clear();
 		if (InOutHandle.hasKey("LODDistances") && InOutHandle["LODDistances"].JSONType() == JSON::Class::Array)
@@ -282,6 +309,12 @@ void UParticleSystem::Serialize(bool bIsLoading, JSON& InOutHandle)
 		InOutHandle["Delay"] = Delay;
 		InOutHandle["bAutoDeactivate"] = bAutoDeactivate;
 		InOutHandle["ThumbnailData"] = ThumbnailData;
+		if (WarmupSnapshot.IsValid() && WarmupSnapshot.WarmupTime == WarmupTime)
+		{
+			JSON SnapshotJson = JSON::Make(JSON::Class::Object);
+			WarmupSnapshot.Serialize(false, SnapshotJson);
+			InOutHandle["WarmupSnapshot"] = SnapshotJson;
+		}
 		// LODDistances
 		JSON lodDistArray = JSON::Make(JSON::Class::Array);
 		for (float Dist : LODDistances)
@@ -316,6 +349,7 @@ void UParticleSystem::DuplicateFrom(const UParticleSystem* Source)
 	UpdateTime_Delta = Source->UpdateTime_Delta;
 	WarmupTime = Source->WarmupTime;
 	WarmupTickRate = Source->WarmupTickRate;
+	WarmupSnapshot = Source->WarmupSnapshot;
 	bUseFixedRelativeBoundingBox = Source->bUseFixedRelativeBoundingBox;
 	FixedRelativeBoundingBox = Source->FixedRelativeBoundingBox;
 	LODDistanceCheckTime = Source->LODDistanceCheckTime;
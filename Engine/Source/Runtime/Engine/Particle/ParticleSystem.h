@@ -1,5 +1,7 @@
 #pragma once
 #include "ParticleTypes.h"
+#include "ParticleWarmup.h"
+#include "ParticleEmitterInstancePool.h"
 #include "Source/Runtime/AssetManagement/ResourceBase.h"
 
 #include "UParticleSystem.generated.h"
@@ -15,7 +17,9 @@ struct ID3D11Device;
  * @param UpdateTime_FPS 업데이트 FPS (0 = 무제한)
  * @param UpdateTime_Delta 고정 델타 타임
  * @param WarmupTime 웜업 시간 (초)
- * @param WarmupTickRate 웜업 틱 레이트
+ * @param WarmupTickRate 웜업 틱 레이트 (초당 스텝 수, 0이면 DefaultWarmupTickRate)
+ * @param WarmupSnapshot 웜업 결과 캐시 (있으면 활성화 시 시뮬레이션 대신 복원)
+ * @param InstancePool 이 템플릿 컴포넌트들이 다 쓴 에미터 인스턴스 풀
  * @param bUseFixedRelativeBoundingBox 고정 바운딩 박스 사용
  * @param FixedRelativeBoundingBox 고정 바운딩 박스 크기
  * @param LODDistanceCheckTime LOD 거리 체크 시간
@@ -44,6 +48,15 @@ public:
 	float WarmupTime;
 	int32 WarmupTickRate;
 
+	/** WarmupTickRate가 0일 때 웜업 스텝 빈도 (정확도보다 속도가 중요해서 거칠게) */
+	static constexpr int32 DefaultWarmupTickRate = 15;
+
+	/** 처음 웜업을 시뮬레이션한 컴포넌트가 채우고, 이후 같은 템플릿 컴포넌트는 복사만 함 */
+	FParticleWarmupSnapshot WarmupSnapshot;
+
+	/** 컴포넌트가 인스턴스를 정리할 때 돌려주고, 다음 활성화 때 꺼내 씀 (모듈이 바뀌면 비움) */
+	FParticleEmitterInstancePool InstancePool;
+
 	// 바운딩 박스
 	bool bUseFixedRelativeBoundingBox;
 	FVector FixedRelativeBoundingBox;
@@ -81,6 +94,7 @@ public:
 
 	// Functions
 	void UpdateAllModuleLists();
+	void RefreshPeakActiveParticles();
 	bool ContainsEmitterType(EDynamicEmitterType EmitterType);
 	void BuildEmitters();
 	void SetupSoloing();
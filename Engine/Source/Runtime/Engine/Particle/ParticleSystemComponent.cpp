@@ -5,6 +5,7 @@
 #include "ParticleMeshEmitterInstance.h"
 #include "ParticleBeamEmitterInstance.h"
 #include "ParticleDataContainer.h"
+#include "ParticleSimulationManager.h"
 #include "ParticleSystem.h"
 #include "ParticleEmitter.h"
 #include "ParticleLODLevel.h"
@@ -46,22 +47,24 @@ UParticleSystemComponent::UParticleSystemComponent()
  */
 UParticleSystemComponent::~UParticleSystemComponent()
 {
+	// 시뮬레이션 단계 전에 삭제되면 등록 취소
+	if (PendingSimulation)
+	{
+		PendingSimulation->CancelSimulation(this);
+	}
+	if (PendingCollisionDispatch)
+	{
+		PendingCollisionDispatch->CancelSimulation(this);
+	}
+
 	// 모든 에미터 인스턴스 삭제
-	ClearEmitterInstances();
+	// (종료 시 템플릿이 먼저 삭제될 수 있어 풀로 돌려주지 않음, 끝난 시스템은 이미 ReleaseEmitterInstances로 반환됨)
+	ClearEmitterInstances(false);
 
 	// 렌더 데이터 메모리 정리
+	// (에미터 데이터는 각 인스턴스의 풀 소유라 ClearEmitterInstances에서 이미 해제됨)
 	if (CurrentDynamicData)
 	{
-		// FParticleDynamicData 내부의 모든 에미터 데이터 삭제
-		for (FDynamicEmitterDataBase* EmitterData : CurrentDynamicData->DynamicEmitterDataArray)
-		{
-			if (EmitterData)
-			{
-				delete EmitterData;
-			}
-		}
-		CurrentDynamicData->DynamicEmitterDataArray.clear();
-
 		// FParticleDynamicData 자체 삭제
 		delete CurrentDynamicData;
 		CurrentDynamicData = nullptr;
@@ -144,18 +147,80 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 		return;
 	}
 
-	// LOD 업데이트 (카메라 거리 기반)
-	UpdateLODLevel();
+	// LOD 업데이트 (카메라 거리 기반, Template->LODDistanceCheckTime 주기로만 거리 평가)
+	LODCheckCountdown -= DeltaTime;
+	if (LODCheckCountdown <= 0.0f || ForcedLODLevel >= 0)
+	{
+		UpdateLODLevel();
+		LODCheckCountdown = std::max(Template->LODDistanceCheckTime, 0.0f);
+	}
 
 	// 누적 시간 업데이트 (Burst 타이밍 계산용)
 	AccumulatedTime += DeltaTime;
 
-	// 모든 에미터 업데이트 (파티클 생성 + 업데이트)
-	UpdateEmitters(DeltaTime);
+	UWorld* World = GetOwner() ? GetOwner()->GetWorld() : nullptr;
+	FParticleSimulationManager* Simulation = World ? World->GetParticleSimulation() : nullptr;
+
+	// 인스턴스 상한 때문에 쉬는 중: 매니저가 여유를 확인하고 다시 꺼내 줄 때까지 등록만 함 (월드 밖이면 상한이 없으므로 바로 재개)
+	if (bSuspendedByInstanceCap)
+	{
+		if (Simulation)
+		{
+			Simulation->QueueSimulation(this);
+			return;
+		}
+		ResumeEmitterInstances();
+	}
+
+	// 새로 시작된 시스템 웜업 (템플릿 스냅샷 복원, 없으면 고정 스텝 빨리 감기 예약)
+	if (bWarmupPending && BeginWarmup() && Simulation)
+	{
+		Simulation->RecordWarmupRestored();
+	}
+
+	// 화면 밖 처리 (저빈도 시뮬레이션/중단) 및 다시 보일 때 빨리 감기
+	int32 NumSteps = 1;
+	const float SimulationDeltaTime = ComputeSimulationDeltaTime(DeltaTime, NumSteps);
+	if (Simulation && IsOffscreenThrottled())
+	{
+		Simulation->RecordOffscreenSystem(SimulationDeltaTime <= 0.0f);
+	}
+	if (SimulationDeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// 에미터 시뮬레이션은 액터 Tick이 끝난 뒤 월드의 파티클 시뮬레이션 단계에서 병렬로 수행
+	// 여기서는 워커가 컴포넌트를 읽지 않도록 필요한 값만 캡처해 등록
+	if (Simulation)
+	{
+		PendingSimulationDeltaTime += SimulationDeltaTime;
+		PendingSimulationSteps = std::max(PendingSimulationSteps, NumSteps);
+		PendingSpawnLocation = GetWorldLocation();
+		Simulation->QueueSimulation(this);
+	}
+	else
+	{
+		// 월드 밖에서 Tick되면 (프리뷰 등) 그 자리에서 직렬로 업데이트
+		Template->RefreshPeakActiveParticles();
+		const float StepDeltaTime = SimulationDeltaTime / NumSteps;
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			UpdateEmitters(StepDeltaTime);
+		}
+
+		for (FParticleEmitterInstance* Instance : EmitterInstances)
+		{
+			if (Instance)
+			{
+				Instance->UpdateParticleBounds();
+			}
+		}
+	}
 
 	// ========== 렌더 데이터 수집 (게임 스레드 → 렌더 스레드) ==========
 	// 렌더 팀원이 UpdateDynamicData()를 호출해서 렌더 데이터를 가져감
-	// 여기서는 파티클 로직 업데이트만 수행
+	// 시뮬레이션 단계가 끝난(동기화 지점) 뒤에 렌더링되므로 항상 이번 프레임 결과를 가져감
 }
 
 // ============== System Control (시스템 제어) ==============
@@ -247,15 +312,26 @@ void UParticleSystemComponent::ResetParticles()
 			Instance->LoopCount = 0;
 			Instance->bEmitterIsDone = false;
 
+			// 난수 스트림을 처음 시드로 되돌려 리셋할 때마다 같은 결과를 재생
+			Instance->RandomStream.Reset();
+
 			// 첫 루프의 Duration 재계산
 			if (Instance->CurrentLODLevel && Instance->CurrentLODLevel->RequiredModule)
 			{
-				Instance->CurrentLoopDuration = Instance->CurrentLODLevel->RequiredModule->GetEmitterDuration();
+				Instance->CurrentLoopDuration = Instance->CurrentLODLevel->RequiredModule->GetEmitterDuration(Instance->RandomStream);
 			}
 		}
 	}
 
 	AccumulatedTime = 0.0f;  // 누적 시간 초기화
+
+	// 처음부터 다시 시작하므로 웜업도 다시 (예약된 빨리 감기는 취소)
+	bWarmupPending = Template && Template->WarmupTime > 0.0f;
+	PendingFastForwardTime = 0.0f;
+	bCaptureWarmupSnapshot = false;
+
+	// 같은 프레임에 다시 그려지더라도 리셋된 상태로 다시 모으도록 무효화
+	LastDynamicDataFrame = 0;
 }
 
 /**
@@ -275,7 +351,11 @@ void UParticleSystemComponent::UpdateInstances(bool bEmptyInstances)
 	if (bEmptyInstances)
 	{
 		// 완전히 파괴 후 재생성
-		ClearEmitterInstances();
+		// 모듈 구성이 바뀌었을 수 있으므로 풀에 보관된 인스턴스도 버림 (Stride/레이아웃이 다름)
+		// 같은 템플릿의 다른 컴포넌트가 쓰던 이전 레이아웃 인스턴스는 모듈 변경 시점(UpdateAllModuleLists/OnModuleChanged)에
+		// 올라간 풀 세대로 걸러짐
+		ClearEmitterInstances(false);
+		Template->InstancePool.Flush();
 	}
 	else
 	{
@@ -316,132 +396,257 @@ void UParticleSystemComponent::InitializeEmitters()
 
 void UParticleSystemComponent::UpdateEmitters(float DeltaTime)
 {
+	// 스폰 위치는 모든 에미터가 같으므로 한 번만 계산
+	const FVector SpawnLocation = GetWorldLocation();
+
 	// Update each emitter instance
 	// 모든 에미터 인스턴스 업데이트
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
 	{
-		// 에미터 인스턴스나 LOD 레벨이 없으면 스킵
-		if (!Instance || !Instance->CurrentLODLevel)
+		SimulateEmitter(Instance, DeltaTime, SpawnLocation);
+	}
+}
+
+/**
+ * 에미터 인스턴스 하나의 시뮬레이션 (시간/루프 → 스폰 → 업데이트)
+ * @note 워커 스레드에서 호출될 수 있으므로 컴포넌트 상태를 읽지 않고, 필요한 값은 인자로 받는다.
+ *       쓰는 상태는 Instance 자신뿐이다 (모듈은 읽기만 하고 난수는 Instance->RandomStream 사용).
+ */
+void UParticleSystemComponent::SimulateEmitter(FParticleEmitterInstance* Instance, float DeltaTime, const FVector& SpawnLocation)
+{
+	// 에미터 인스턴스나 LOD 레벨이 없으면 스킵
+	if (!Instance || !Instance->CurrentLODLevel)
+	{
+		return;
+	}
+
+	// LOD 레벨 또는 에미터가 비활성화되어 있으면 스킵
+	if (!Instance->CurrentLODLevel->bEnabled)
+	{
+		return;
+	}
+
+	// 에미터 자체의 활성화 상태 체크
+	if (Instance->SpriteTemplate && !Instance->SpriteTemplate->bIsEnabled)
+	{
+		return;
+	}
+
+	// ========== 0단계: 에미터 시간 업데이트 및 루프 처리 ==========
+
+	UParticleModuleRequired* RequiredModule = Instance->CurrentLODLevel->RequiredModule;
+
+	// 이전 프레임 시간 저장 (Burst 계산용)
+	float OldEmitterTime = Instance->EmitterTime;
+
+	// 에미터 시간 업데이트
+	Instance->EmitterTime += DeltaTime;
+
+	// 루프 경계 체크 및 처리
+	if (RequiredModule && Instance->CurrentLoopDuration > 0.0f)
+	{
+		int32 EmitterLoops = RequiredModule->GetEmitterLoops();
+
+		// 현재 루프의 Duration을 초과했는지 체크
+		while (Instance->EmitterTime >= Instance->CurrentLoopDuration)
 		{
-			continue;
+			// 루프 완료 처리
+			Instance->LoopCount++;
+
+			// 유한 루프이고 모든 루프가 완료됨
+			if (EmitterLoops > 0 && Instance->LoopCount >= EmitterLoops)
+			{
+				Instance->bEmitterIsDone = true;
+				break;
+			}
+			else
+			{
+				Instance->bEmitterIsDone = false;
+			}
+
+			// 다음 루프 시작 - 시간 조정
+			Instance->EmitterTime -= Instance->CurrentLoopDuration;
+			OldEmitterTime = 0.0f;  // 새 루프의 시작
+
+			// bDurationRecalcEachLoop가 true면 다음 루프의 Duration 재계산
+			if (RequiredModule->IsDurationRecalcEachLoop())
+			{
+				Instance->CurrentLoopDuration = RequiredModule->GetEmitterDuration(Instance->RandomStream);
+			}
+
+			// SpawnFraction 리셋 (새 루프 시작)
+			Instance->SpawnFraction = 0.0f;
 		}
+	}
+
+	// ========== 1단계: 파티클 생성 (Spawning) ==========
 
-		// LOD 레벨 또는 에미터가 비활성화되어 있으면 스킵
-		if (!Instance->CurrentLODLevel->bEnabled)
+	// 현재 LOD 레벨의 스폰 모듈 가져오기
+	UParticleModuleSpawn* SpawnModule = Instance->CurrentLODLevel->SpawnModule;
+	// LODValidity 체크: 현재 LOD에서 SpawnModule이 활성화되어 있어야 파티클 생성
+	if (SpawnModule && !Instance->bEmitterIsDone && SpawnModule->IsValidForLODLevel(Instance->CurrentLODLevelIndex))
+	{
+		// 이번 프레임에 생성할 파티클 개수 계산
+		int32 SpawnNumber = 0;      // 실제 생성할 개수
+		float SpawnRate = 0.0f;     // 초당 생성률 (디버깅/통계용)
+
+		// ----------------------------------------------------------------
+		// [방법 1] SpawnRate 기반 생성 (연속적 생성)
+		// ----------------------------------------------------------------
+		bool bShouldSpawn = SpawnModule->GetSpawnAmount(
+			DeltaTime,                     // DeltaTime (경과 시간)
+			SpawnNumber,                   // OutNumber (출력: 생성할 개수)
+			SpawnRate,                     // OutRate (출력: 초당 생성률)
+			Instance->SpawnFraction,       // InOutSpawnFraction (입출력: 소수점 누적값)
+			Instance->RandomStream         // RandomStream (에미터별 난수 스트림)
+		);
+
+		// [방법 2] Burst 기반 생성 (특정 시간에 대량 생성)
+		if (SpawnModule->bProcessBurstList)
 		{
-			continue;
+			// 에미터별 시간으로 Burst 체크 (루프 내 상대 시간 사용)
+			int32 BurstCount = SpawnModule->GetBurstCount(
+				OldEmitterTime,                    // OldTime (이전 시간)
+				Instance->EmitterTime,             // NewTime (현재 시간)
+				Instance->CurrentLoopDuration,     // Duration (현재 루프의 Duration)
+				Instance->RandomStream             // RandomStream (에미터별 난수 스트림)
+			);
+			SpawnNumber += BurstCount;
 		}
 
-		// 에미터 자체의 활성화 상태 체크
-		if (Instance->SpriteTemplate && !Instance->SpriteTemplate->bIsEnabled)
+		// 전역 예산 적용 (FParticleSimulationManager가 우선순위 순으로 배분, -1이면 제한 없음)
+		if (Instance->SpawnBudget >= 0 && SpawnNumber > Instance->SpawnBudget)
 		{
-			continue;
+			Instance->NumThrottledSpawns += SpawnNumber - Instance->SpawnBudget;
+			SpawnNumber = Instance->SpawnBudget;
+		}
+		if (Instance->SpawnBudget >= 0)
+		{
+			Instance->SpawnBudget -= SpawnNumber;
 		}
 
-		// ========== 0단계: 에미터 시간 업데이트 및 루프 처리 ==========
+		// 실제 파티클 생성 수행
+		if (SpawnNumber > 0)
+		{
+			FVector InitialVelocity = FVector::Zero();
+			float Increment = (SpawnNumber > 1) ? (DeltaTime / SpawnNumber) : 0.0f;
+
+			Instance->SpawnParticles(
+				SpawnNumber,
+				0.0f,
+				Increment,
+				SpawnLocation,
+				InitialVelocity
+			);
+		}
+	}
 
-		UParticleModuleRequired* RequiredModule = Instance->CurrentLODLevel->RequiredModule;
+	// ========== 2단계: 파티클 업데이트 (Update) ==========
 
-		// 이전 프레임 시간 저장 (Burst 계산용)
-		float OldEmitterTime = Instance->EmitterTime;
+	// 기존에 살아있는 파티클들 업데이트
+	// - 수명 체크 (RelativeTime >= 1.0이면 제거)
+	// - 물리 시뮬레이션 (위치, 회전 업데이트)
+	// - 모듈 업데이트 (Color, Size, Velocity 등)
+	Instance->Tick(DeltaTime);
+}
 
-		// 에미터 시간 업데이트
-		Instance->EmitterTime += DeltaTime;
+void UParticleSystemComponent::FastForwardEmitter(FParticleEmitterInstance* Instance, float Time, float StepTime, const FVector& SpawnLocation)
+{
+	if (Time <= 0.0f)
+	{
+		return;
+	}
 
-		// 루프 경계 체크 및 처리
-		if (RequiredModule && Instance->CurrentLoopDuration > 0.0f)
-		{
-			int32 EmitterLoops = RequiredModule->GetEmitterLoops();
+	// 마지막 자투리 스텝 대신 전체를 같은 길이로 나눔 (부동소수 오차로 스텝이 하나 더 생기지 않도록 여유를 둠)
+	const int32 NumSteps = StepTime > 0.0f ? std::max(1, static_cast<int32>(std::ceil(Time / StepTime - 1.0e-3f))) : 1;
+	const float Step = Time / static_cast<float>(NumSteps);
+	for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+	{
+		SimulateEmitter(Instance, Step, SpawnLocation);
+	}
+}
 
-			// 현재 루프의 Duration을 초과했는지 체크
-			while (Instance->EmitterTime >= Instance->CurrentLoopDuration)
-			{
-				// 루프 완료 처리
-				Instance->LoopCount++;
+// ============== Warm-up / Fast-forward ==============
 
-				// 유한 루프이고 모든 루프가 완료됨
-				if (EmitterLoops > 0 && Instance->LoopCount >= EmitterLoops)
-				{
-					Instance->bEmitterIsDone = true;
-					break;
-				}
-				else
-				{
-					Instance->bEmitterIsDone = false;
-				}
+void UParticleSystemComponent::FastForward(float Time, int32 TickRate)
+{
+	if (Time <= 0.0f || !Template)
+	{
+		return;
+	}
 
-				// 다음 루프 시작 - 시간 조정
-				Instance->EmitterTime -= Instance->CurrentLoopDuration;
-				OldEmitterTime = 0.0f;  // 새 루프의 시작
+	const int32 StepsPerSecond = TickRate > 0 ? TickRate : UParticleSystem::DefaultWarmupTickRate;
+	FastForwardStepTime = 1.0f / static_cast<float>(StepsPerSecond);
+	PendingFastForwardTime += Time;
+	PendingSpawnLocation = GetWorldLocation();
 
-				// bDurationRecalcEachLoop가 true면 다음 루프의 Duration 재계산
-				if (RequiredModule->IsDurationRecalcEachLoop())
-				{
-					Instance->CurrentLoopDuration = RequiredModule->GetEmitterDuration();
-				}
+	// 월드의 시뮬레이션 단계에서 다른 시스템과 함께 워커로 처리
+	UWorld* World = GetOwner() ? GetOwner()->GetWorld() : nullptr;
+	FParticleSimulationManager* Simulation = World ? World->GetParticleSimulation() : nullptr;
+	if (Simulation)
+	{
+		Simulation->QueueSimulation(this);
+		return;
+	}
 
-				// SpawnFraction 리셋 (새 루프 시작)
-				Instance->SpawnFraction = 0.0f;
-			}
+	// 월드 밖이면 (프리뷰 등) 바로 실행
+	Template->RefreshPeakActiveParticles();
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (Instance)
+		{
+			FastForwardEmitter(Instance, PendingFastForwardTime, FastForwardStepTime, PendingSpawnLocation);
+			Instance->UpdateParticleBounds();
 		}
+	}
+	FinishFastForward();
+}
 
-		// ========== 1단계: 파티클 생성 (Spawning) ==========
+bool UParticleSystemComponent::BeginWarmup()
+{
+	bWarmupPending = false;
+	if (!Template || Template->WarmupTime <= 0.0f)
+	{
+		return false;
+	}
 
-		// 현재 LOD 레벨의 스폰 모듈 가져오기
-		UParticleModuleSpawn* SpawnModule = Instance->CurrentLODLevel->SpawnModule;
-		// LODValidity 체크: 현재 LOD에서 SpawnModule이 활성화되어 있어야 파티클 생성
-		if (SpawnModule && !Instance->bEmitterIsDone && SpawnModule->IsValidForLODLevel(Instance->CurrentLODLevelIndex))
-		{
-			// 이번 프레임에 생성할 파티클 개수 계산
-			int32 SpawnNumber = 0;      // 실제 생성할 개수
-			float SpawnRate = 0.0f;     // 초당 생성률 (디버깅/통계용)
-
-			// ----------------------------------------------------------------
-			// [방법 1] SpawnRate 기반 생성 (연속적 생성)
-			// ----------------------------------------------------------------
-			bool bShouldSpawn = SpawnModule->GetSpawnAmount(
-				DeltaTime,                     // DeltaTime (경과 시간)
-				SpawnNumber,                   // OutNumber (출력: 생성할 개수)
-				SpawnRate,                     // OutRate (출력: 초당 생성률)
-				Instance->SpawnFraction        // InOutSpawnFraction (입출력: 소수점 누적값)
-			);
+	// 같은 템플릿이 이미 웜업한 결과가 있으면 복사만 함 (시뮬레이션 비용 없음)
+	if (Template->WarmupSnapshot.Apply(Template->WarmupTime, GetWorldLocation(), EmitterInstances))
+	{
+		AccumulatedTime += Template->WarmupTime;
+		LastDynamicDataFrame = 0;
+		return true;
+	}
 
-			// [방법 2] Burst 기반 생성 (특정 시간에 대량 생성)
-			if (SpawnModule->bProcessBurstList)
-			{
-				// 에미터별 시간으로 Burst 체크 (루프 내 상대 시간 사용)
-				int32 BurstCount = SpawnModule->GetBurstCount(
-					OldEmitterTime,                    // OldTime (이전 시간)
-					Instance->EmitterTime,             // NewTime (현재 시간)
-					Instance->CurrentLoopDuration      // Duration (현재 루프의 Duration)
-				);
-				SpawnNumber += BurstCount;
-			}
+	bCaptureWarmupSnapshot = true;
+	FastForward(Template->WarmupTime, Template->WarmupTickRate);
+	return false;
+}
 
-			// 실제 파티클 생성 수행
-			if (SpawnNumber > 0)
-			{
-				FVector SpawnLocation = GetWorldLocation();
-				FVector InitialVelocity = FVector::Zero();
-				float Increment = (SpawnNumber > 1) ? (DeltaTime / SpawnNumber) : 0.0f;
-
-				Instance->SpawnParticles(
-					SpawnNumber,
-					0.0f,
-					Increment,
-					SpawnLocation,
-					InitialVelocity
-				);
-			}
-		}
+void UParticleSystemComponent::FinishFastForward()
+{
+	AccumulatedTime += PendingFastForwardTime;
+	PendingFastForwardTime = 0.0f;
 
-		// ========== 2단계: 파티클 업데이트 (Update) ==========
+	if (bCaptureWarmupSnapshot && Template)
+	{
+		Template->WarmupSnapshot.Capture(Template->WarmupTime, PendingSpawnLocation, EmitterInstances);
+	}
+	bCaptureWarmupSnapshot = false;
+
+	// 같은 프레임에 이미 렌더 데이터를 모았더라도 빨리 감긴 상태로 다시 모음
+	LastDynamicDataFrame = 0;
+}
 
-		// 기존에 살아있는 파티클들 업데이트
-		// - 수명 체크 (RelativeTime >= 1.0이면 제거)
-		// - 물리 시뮬레이션 (위치, 회전 업데이트)
-		// - 모듈 업데이트 (Color, Size, Velocity 등)
-		Instance->Tick(DeltaTime);
+void UParticleSystemComponent::DispatchCollisionEvents()
+{
+	// 콜백 안에서 다음 이벤트가 쌓이거나 컴포넌트가 다시 등록돼도 이번 목록만 발행
+	TArray<FParticleCollisionEvent> Events;
+	Events.swap(PendingCollisionEvents);
+
+	for (const FParticleCollisionEvent& Event : Events)
+	{
+		OnParticleCollide.Broadcast(this, Event);
 	}
 }
 
@@ -452,7 +657,7 @@ void UParticleSystemComponent::UpdateEmitters(float DeltaTime)
  * @note 렌더 팀원이 렌더 커맨드에서 호출
  * @note GetCurrentDynamicData()로 결과를 가져가면 됨
  */
-void UParticleSystemComponent::UpdateDynamicData()
+void UParticleSystemComponent::UpdateDynamicData(uint64 FrameNumber)
 {
 	// ========== 1단계: FParticleDynamicData 생성/재사용 ==========
 
@@ -461,19 +666,16 @@ void UParticleSystemComponent::UpdateDynamicData()
 	{
 		CurrentDynamicData = new FParticleDynamicData();
 	}
-
-	// ========== 2단계: 이전 프레임 렌더 데이터 정리 ==========
-
-	// 이전 프레임의 에미터 데이터들 삭제
-	for (FDynamicEmitterDataBase* EmitterData : CurrentDynamicData->DynamicEmitterDataArray)
+	else if (FrameNumber != 0 && FrameNumber == LastDynamicDataFrame)
 	{
-		if (EmitterData)
-		{
-			delete EmitterData;  // GetDynamicData()로 new 했던 메모리 해제
-		}
+		// 이번 프레임에 이미 수집함 (그림자 패스 → 파티클 패스, 여러 뷰포트)
+		return;
 	}
+	LastDynamicDataFrame = FrameNumber;
+
+	// ========== 2단계: 이전 프레임 렌더 데이터 정리 ==========
 
-	// 배열 비우기 (포인터만 제거, 위에서 메모리는 이미 해제함)
+	// 배열 비우기 (포인터만 제거, 에미터 데이터는 각 인스턴스가 소유하고 다음 GetDynamicData에서 다시 채움)
 	CurrentDynamicData->DynamicEmitterDataArray.clear();
 
 	// ========== 3단계: 새 렌더 데이터 수집 ==========
@@ -516,7 +718,7 @@ void UParticleSystemComponent::UpdateDynamicData()
 			continue;
 		}
 
-		// 렌더 스레드용 데이터 생성 (파티클 데이터 스냅샷)
+		// 렌더 스레드용 데이터 채우기 (인스턴스의 풀링된 데이터, 파티클 버퍼는 복사 없이 참조)
 		// bSelected = false (에디터에서 선택 안 됨)
 		FDynamicEmitterDataBase* NewEmitterData = Instance->GetDynamicData(false);
 
@@ -555,8 +757,21 @@ void UParticleSystemComponent::CreateEmitterInstances()
 			continue;  // 유효하지 않으면 스킵
 		}
 
+		// 에미터별 난수 시드 (Init/Reuse에서 첫 루프 Duration을 뽑으므로 먼저 설정)
+		// 컴포넌트 UUID와 에미터 인덱스로만 정해지므로 어느 스레드에서 시뮬레이션해도 같은 순서의 값을 얻음
+		const uint32 Seed = UUID * 0x9E3779B9u ^ static_cast<uint32>(i + 1) * 0x85EBCA6Bu;
+
+		// 템플릿 풀에 같은 에미터로 만든 인스턴스가 있으면 메모리/GPU 버퍼를 그대로 재사용
+		FParticleEmitterInstance* NewInstance = Template->InstancePool.Acquire(i, Emitter);
+		if (NewInstance)
+		{
+			NewInstance->RandomStream.Initialize(Seed);
+			NewInstance->Reuse(this);
+			EmitterInstances.Add(NewInstance);
+			continue;
+		}
+
 		// TypeDataModule 타입에 따라 에미터 인스턴스 생성
-		FParticleEmitterInstance* NewInstance = nullptr;
 
 		UParticleLODLevel* LODLevel = Emitter->GetLODLevel(0);
 		if (LODLevel && LODLevel->TypeDataModule)
@@ -578,26 +793,46 @@ void UParticleSystemComponent::CreateEmitterInstances()
 			NewInstance = new FParticleSpriteEmitterInstance();
 		}
 
+		NewInstance->RandomStream.Initialize(Seed);
+
 		// 에미터 인스턴스 초기화
 		// - Emitter: 설계도 (어떻게 동작할지 정의)
 		// - this: 이 컴포넌트 (월드 위치, 회전 등 제공)
 		NewInstance->Init(Emitter, this);
+		NewInstance->PoolGeneration = Template->InstancePool.GetGeneration();
 
 		// 에미터 인스턴스 배열에 추가
 		EmitterInstances.Add(NewInstance);
 	}
+
+	// 새 인스턴스는 다음 Tick에 웜업
+	bWarmupPending = Template->WarmupTime > 0.0f;
+	PendingFastForwardTime = 0.0f;
+	bCaptureWarmupSnapshot = false;
+	bSuspendedByInstanceCap = false;
 }
 
 /**
- * 모든 에미터 인스턴스 삭제
- * 메모리 정리를 위해 동적 할당된 에미터 인스턴스들을 삭제
+ * 모든 에미터 인스턴스 정리
+ * 템플릿 풀로 돌려주거나 (다음 활성화 때 재사용) 동적 할당된 에미터 인스턴스들을 삭제
  */
-void UParticleSystemComponent::ClearEmitterInstances()
+void UParticleSystemComponent::ClearEmitterInstances(bool bReleaseToPool)
 {
-	// 모든 에미터 인스턴스 순회하며 삭제
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
 	{
-		if (Instance)
+		if (!Instance)
+		{
+			continue;
+		}
+
+		if (bReleaseToPool && Template)
+		{
+			// null 에미터를 건너뛰고 만들었으므로 배열 인덱스가 아니라 템플릿에서의 위치로 보관
+			const auto It = std::find(Template->Emitters.begin(), Template->Emitters.end(), Instance->SpriteTemplate);
+			const int32 EmitterIndex = (It != Template->Emitters.end()) ? static_cast<int32>(It - Template->Emitters.begin()) : INDEX_NONE;
+			Template->InstancePool.Release(EmitterIndex, Instance);
+		}
+		else
 		{
 			delete Instance;  // 동적 할당 해제
 		}
@@ -605,6 +840,72 @@ void UParticleSystemComponent::ClearEmitterInstances()
 
 	// 배열 비우기
 	EmitterInstances.clear();
+
+	// 렌더 데이터는 방금 정리한 인스턴스의 풀을 가리키므로 같이 비우고 다시 모으게 함
+	if (CurrentDynamicData)
+	{
+		CurrentDynamicData->DynamicEmitterDataArray.clear();
+	}
+	LastDynamicDataFrame = 0;
+}
+
+void UParticleSystemComponent::ReleaseEmitterInstances()
+{
+	DeactivateSystem();
+	ClearEmitterInstances();
+
+	// 다시 활성화하면 새 인스턴스로 처음부터 시작하므로 남은 빨리 감기/웜업 예약은 버림
+	bWarmupPending = false;
+	PendingFastForwardTime = 0.0f;
+	bCaptureWarmupSnapshot = false;
+	OffscreenPendingTime = 0.0f;
+	bSuspendedByInstanceCap = false;
+}
+
+void UParticleSystemComponent::SuspendEmitterInstances()
+{
+	ClearEmitterInstances();
+
+	// 재개하면 새 인스턴스로 처음부터 시작하므로 남은 빨리 감기/웜업 예약은 버림 (재개할 때 CreateEmitterInstances가 다시 예약)
+	bWarmupPending = false;
+	PendingFastForwardTime = 0.0f;
+	bCaptureWarmupSnapshot = false;
+	OffscreenPendingTime = 0.0f;
+	bSuspendedByInstanceCap = true;
+}
+
+void UParticleSystemComponent::ResumeEmitterInstances()
+{
+	CreateEmitterInstances();
+
+	// 풀에서 꺼낸 인스턴스는 LOD 0으로 시작하므로 쉬는 동안 유지한 LOD를 다시 적용
+	if (CurrentLODLevel > 0)
+	{
+		for (FParticleEmitterInstance* Instance : EmitterInstances)
+		{
+			if (Instance)
+			{
+				Instance->SetLODLevel(CurrentLODLevel);
+			}
+		}
+	}
+}
+
+bool UParticleSystemComponent::IsSystemComplete() const
+{
+	if (EmitterInstances.IsEmpty())
+	{
+		return false;
+	}
+
+	for (const FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (Instance && !Instance->IsComplete())
+		{
+			return false;
+		}
+	}
+	return true;
 }
 
 // ============== Serialize/Duplicate ==============
@@ -665,6 +966,27 @@ void UParticleSystemComponent::DuplicateSubObjects()
 	// (원본의 인스턴스를 복사하지 않고 Template에서 새로 생성)
 	EmitterInstances.clear();
 	CurrentDynamicData = nullptr;
+	LastDynamicDataFrame = 0;
+
+	// 원본의 시뮬레이션 등록 상태는 복제하지 않음
+	PendingSimulation = nullptr;
+	PendingSimulationDeltaTime = 0.0f;
+	PendingSimulationSteps = 1;
+	LastSimulationTimeMS = 0.0;
+	PendingCollisionEvents.Empty();
+	PendingCollisionDispatch = nullptr;
+	OnParticleCollide.Clear();
+
+	// 컬링 상태도 새로 시작
+	bRenderedSinceLastTick = false;
+	TimeSinceRendered = 0.0f;
+	OffscreenPendingTime = 0.0f;
+	LODCheckCountdown = 0.0f;
+
+	// 웜업은 복제본이 인스턴스를 새로 만들 때 다시 예약됨
+	bWarmupPending = false;
+	PendingFastForwardTime = 0.0f;
+	bCaptureWarmupSnapshot = false;
 
 	// 에디터 전용 컴포넌트는 복제하지 않음 (OnRegister에서 재생성)
 	SpriteComponent = nullptr;
@@ -1138,6 +1460,7 @@ void UParticleSystemComponent::UpdateLODLevel()
 	// 거리 제곱 계산
 	FVector Delta = CameraLocation - ParticleLocation;
 	float DistanceSquared = Delta.X * Delta.X + Delta.Y * Delta.Y + Delta.Z * Delta.Z;
+	LastViewDistanceSquared = DistanceSquared;
 
 	// LOD 레벨 결정
 	int32 NewLODLevel = DetermineLODLevelFromDistance(DistanceSquared);
@@ -1165,6 +1488,9 @@ void UParticleSystemComponent::SetForcedLODLevel(int32 LODLevel)
 {
 	ForcedLODLevel = LODLevel;
 
+	// 강제 LOD가 풀리면 다음 Tick에 바로 거리 평가
+	LODCheckCountdown = 0.0f;
+
 	// 즉시 LOD 업데이트
 	if (ForcedLODLevel >= 0)
 	{
@@ -1213,31 +1539,26 @@ void UParticleSystemComponent::GetBoundingBox(FVector& OutMin, FVector& OutMax)
 			continue;
 		}
 
-		// 직접 멤버 접근
-		const uint8* ParticleDataPtr = Instance->ParticleData;
-		int32 Stride = Instance->ParticleStride;
-		int32 NumActiveParticles = Instance->ActiveParticles;
-
-		if (!ParticleDataPtr)
+		// AoS/SoA 레이아웃 공통 접근
+		if (!Instance->HasParticleStorage())
 		{
 			continue;
 		}
 
+		int32 NumActiveParticles = Instance->ActiveParticles;
 		for (int32 i = 0; i < NumActiveParticles; ++i)
 		{
-			const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(ParticleDataPtr + i * Stride);
-			if (Particle)
-			{
-				OutMin.X = std::min(OutMin.X, Particle->Location.X);
-				OutMin.Y = std::min(OutMin.Y, Particle->Location.Y);
-				OutMin.Z = std::min(OutMin.Z, Particle->Location.Z);
+			const FVector Location = Instance->GetParticleLocation(i);
 
-				OutMax.X = std::max(OutMax.X, Particle->Location.X);
-				OutMax.Y = std::max(OutMax.Y, Particle->Location.Y);
-				OutMax.Z = std::max(OutMax.Z, Particle->Location.Z);
+			OutMin.X = std::min(OutMin.X, Location.X);
+			OutMin.Y = std::min(OutMin.Y, Location.Y);
+			OutMin.Z = std::min(OutMin.Z, Location.Z);
 
-				bHasAnyParticles = true;
-			}
+			OutMax.X = std::max(OutMax.X, Location.X);
+			OutMax.Y = std::max(OutMax.Y, Location.Y);
+			OutMax.Z = std::max(OutMax.Z, Location.Z);
+
+			bHasAnyParticles = true;
 		}
 	}
 
@@ -1250,6 +1571,96 @@ void UParticleSystemComponent::GetBoundingBox(FVector& OutMin, FVector& OutMax)
 	}
 }
 
+/**
+ * 프러스텀 컬링용 바운드
+ * 시뮬레이션 직후 에미터별로 갱신된 AABB를 합친다 (렌더 패스마다 파티클을 다시 순회하지 않음)
+ */
+void UParticleSystemComponent::GetCullingBounds(FVector& OutMin, FVector& OutMax) const
+{
+	if (Template && Template->bUseFixedRelativeBoundingBox)
+	{
+		GetBoundingBox(OutMin, OutMax);
+		return;
+	}
+
+	// 컴포넌트 위치는 항상 포함 (아직 스폰 전인 에미터도 여기서 파티클이 나오므로 다시 보이는 것을 감지해야 함)
+	const FVector Center = GetWorldLocation();
+	OutMin = Center - FVector(10.0f, 10.0f, 10.0f);
+	OutMax = Center + FVector(10.0f, 10.0f, 10.0f);
+
+	for (const FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance || !Instance->bHasParticleBounds)
+		{
+			continue;
+		}
+
+		OutMin.X = std::min(OutMin.X, Instance->ParticleBoundsMin.X);
+		OutMin.Y = std::min(OutMin.Y, Instance->ParticleBoundsMin.Y);
+		OutMin.Z = std::min(OutMin.Z, Instance->ParticleBoundsMin.Z);
+
+		OutMax.X = std::max(OutMax.X, Instance->ParticleBoundsMax.X);
+		OutMax.Y = std::max(OutMax.Y, Instance->ParticleBoundsMax.Y);
+		OutMax.Z = std::max(OutMax.Z, Instance->ParticleBoundsMax.Z);
+	}
+}
+
+/**
+ * 화면 밖 처리와 빨리 감기를 반영한 이번 Tick의 시뮬레이션 시간
+ * - 화면 밖 OffscreenTimeout 초과: 시간을 쌓아 두고 Suspend면 건너뜀, ReducedRate면 1/OffscreenTickRate마다 한 번에 시뮬레이션
+ * - 다시 보임: 쌓인 시간(최대 MaxFastForwardTime)을 이번 Tick에 더해 MaxSimulationStep 단위로 나눠 빨리 감기
+ */
+float UParticleSystemComponent::ComputeSimulationDeltaTime(float DeltaTime, int32& OutNumSteps)
+{
+	OutNumSteps = 1;
+
+	// 렌더러는 Tick 이후에 MarkRendered를 부르므로 지난 프레임 가시성이 반영됨
+	if (bRenderedSinceLastTick)
+	{
+		TimeSinceRendered = 0.0f;
+	}
+	else
+	{
+		TimeSinceRendered += DeltaTime;
+	}
+	bRenderedSinceLastTick = false;
+
+	if (IsOffscreenThrottled())
+	{
+		OffscreenPendingTime += DeltaTime;
+		if (OffscreenMode == EParticleOffscreenMode::Suspend)
+		{
+			return 0.0f;
+		}
+
+		// 저빈도 시뮬레이션은 한 스텝으로 (정확도보다 비용 절감이 목적)
+		const float Interval = OffscreenTickRate > 0.0f ? 1.0f / OffscreenTickRate : FLT_MAX;
+		if (OffscreenPendingTime < Interval)
+		{
+			return 0.0f;
+		}
+
+		const float PendingTime = OffscreenPendingTime;
+		OffscreenPendingTime = 0.0f;
+		return PendingTime;
+	}
+
+	if (OffscreenPendingTime <= 0.0f)
+	{
+		return DeltaTime;
+	}
+
+	// 다시 보임: 밀린 시간 빨리 감기 (너무 오래 밀린 시간은 버림)
+	const float FastForwardTime = DeltaTime + std::min(OffscreenPendingTime, std::max(MaxFastForwardTime, 0.0f));
+	OffscreenPendingTime = 0.0f;
+
+	if (MaxSimulationStep > 0.0f)
+	{
+		OutNumSteps = std::max(1, static_cast<int32>(std::ceil(FastForwardTime / MaxSimulationStep)));
+	}
+	return FastForwardTime;
+}
+
 /**
  * 바운딩 스피어 반지름 계산
  */
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Source/Runtime/Engine/Components/PrimitiveComponent.h"
+#include "ParticleTypes.h"
+#include "ParticleCollision.h"
+#include "Source/Runtime/Core/Misc/Delegates.h"
 #include "UParticleSystemComponent.generated.h"
 
 // Forward declarations
@@ -10,6 +13,7 @@ class UGizmoArrowComponent;
 struct FParticleEmitterInstance;
 struct FDynamicEmitterDataBase;
 struct FParticleDynamicData;
+class FParticleSimulationManager;
 
 /**
  * Component that manages and renders a particle system
@@ -128,6 +132,38 @@ public:
 	 */
 	void UpdateEmitters(float DeltaTime);
 
+	/**
+	 * Simulate a single emitter instance (spawn + update)
+	 * 에미터 인스턴스 하나 시뮬레이션 (FParticleSimulationManager가 워커에서 호출)
+	 *
+	 * @param Instance - Emitter instance to simulate
+	 * @param DeltaTime - Time elapsed since last update
+	 * @param SpawnLocation - Component world location captured on the game thread
+	 */
+	static void SimulateEmitter(FParticleEmitterInstance* Instance, float DeltaTime, const FVector& SpawnLocation);
+
+	/**
+	 * Time초를 StepTime 간격 고정 스텝으로 나눠 SimulateEmitter 반복 (웜업/빨리 감기용, 워커에서 호출 가능)
+	 * 같은 Time/StepTime이면 프레임 레이트와 상관없이 항상 같은 결과
+	 */
+	static void FastForwardEmitter(FParticleEmitterInstance* Instance, float Time, float StepTime, const FVector& SpawnLocation);
+
+	/** 마지막 시뮬레이션 단계에서 이 시스템의 에미터들을 시뮬레이션한 시간 합 (ms) */
+	double GetLastSimulationTimeMS() const { return LastSimulationTimeMS; }
+
+	// ============== Warm-up / Fast-forward ==============
+	/**
+	 * 고정 스텝으로 Time초 빨리 감기 (렌더 데이터는 만들지 않음)
+	 * 월드의 시뮬레이션 단계에서 워커가 처리하며, 월드 밖이면 바로 실행
+	 *
+	 * @param Time - 진행할 시간 (초)
+	 * @param TickRate - 초당 스텝 수 (0이면 UParticleSystem::DefaultWarmupTickRate)
+	 */
+	void FastForward(float Time, int32 TickRate = 0);
+
+	/** 웜업/빨리 감기가 아직 끝나지 않았는지 */
+	bool IsFastForwarding() const { return bWarmupPending || PendingFastForwardTime > 0.0f; }
+
 	// ============== LOD ==============
 	/**
 	 * 카메라 거리에 따른 LOD 레벨 결정
@@ -157,14 +193,52 @@ public:
 	/** LOD 전환 히스테리시스 비율 (0.0~1.0, 기본 0.1 = 10%) */
 	float LODHysteresisRatio = 0.1f;
 
+	/** 마지막 LOD 평가 때의 카메라 거리 제곱 (예산 우선순위에도 사용) */
+	float GetSignificanceDistanceSquared() const { return LastViewDistanceSquared; }
+
+	// ============== Visibility Culling ==============
+	/** 화면 밖에 이 시간(초) 이상 머물면 OffscreenMode 적용 */
+	float OffscreenTimeout = 2.0f;
+
+	/** 화면 밖 시스템 처리 방식 */
+	EParticleOffscreenMode OffscreenMode = EParticleOffscreenMode::ReducedRate;
+
+	/** ReducedRate일 때 초당 시뮬레이션 횟수 */
+	float OffscreenTickRate = 4.0f;
+
+	/** 다시 보일 때 빨리 감을 최대 시간 (초, 그 이상 밀린 시간은 버림) */
+	float MaxFastForwardTime = 2.0f;
+
+	/** 밀린 시간을 한 번에 시뮬레이션할 때 나누는 스텝 최대 길이 (초) */
+	float MaxSimulationStep = 1.0f / 30.0f;
+
+	/** 렌더러가 이번 프레임 프러스텀 안에서 그렸음을 알림 */
+	void MarkRendered() { bRenderedSinceLastTick = true; }
+
+	/** 마지막으로 프러스텀 안에서 그려진 뒤 지난 시간 (초) */
+	float GetTimeSinceRendered() const { return TimeSinceRendered; }
+
+	/** 화면 밖 시간 초과로 시뮬레이션이 줄었거나 멈춘 상태인지 */
+	bool IsOffscreenThrottled() const
+	{
+		return OffscreenMode != EParticleOffscreenMode::FullRate && TimeSinceRendered >= OffscreenTimeout;
+	}
+
+	/**
+	 * 프러스텀 컬링용 바운드 (시뮬레이션 때 에미터별로 갱신된 AABB를 합침)
+	 * GetBoundingBox와 달리 파티클을 다시 순회하지 않고, 파티클 크기만큼 확장되어 있음
+	 */
+	void GetCullingBounds(FVector& OutMin, FVector& OutMax) const;
+
 	// ============== Rendering Data ==============
 	/**
 	 * Update dynamic render data for all emitters
 	 * 모든 에미터의 동적 렌더 데이터 업데이트 (렌더쪽에서 호출)
 	 *
+	 * @param FrameNumber - 렌더러 프레임 번호. 같은 프레임에 다시 호출되면 (그림자/파티클 패스, 여러 뷰) 이미 모은 데이터를 그대로 씀
 	 * @note Called by render thread to get latest particle data
 	 */
-	void UpdateDynamicData();
+	void UpdateDynamicData(uint64 FrameNumber);
 
 	/**
 	 * Get current dynamic data for rendering
@@ -188,11 +262,107 @@ protected:
 	/**
 	 * Clear all emitter instances
 	 * 모든 에미터 인스턴스 정리 (내부 헬퍼)
+	 *
+	 * @param bReleaseToPool - true면 Template->InstancePool로 돌려주고, false면 삭제 (템플릿 구성이 바뀌었을 때)
+	 */
+	void ClearEmitterInstances(bool bReleaseToPool = true);
+
+	/**
+	 * 비활성화하고 에미터 인스턴스를 템플릿 풀로 반환 (FParticleSimulationManager가 호출)
+	 * 끝난 bAutoDeactivate 시스템, 인스턴스 상한 때문에 밀려난 일회성 시스템에 사용. 다시 ActivateSystem하면 풀에서 꺼내 씀
+	 */
+	void ReleaseEmitterInstances();
+
+	/**
+	 * 인스턴스 상한 때문에 밀려난 반복 시스템: 활성 상태는 유지한 채 인스턴스만 템플릿 풀로 반환
+	 * (FParticleSimulationManager가 호출, 상한에 여유가 생기면 ResumeEmitterInstances로 다시 꺼냄)
 	 */
-	void ClearEmitterInstances();
+	void SuspendEmitterInstances();
+
+	/** 쉬고 있던 시스템의 인스턴스를 풀에서 다시 꺼내 처음부터 시작 (현재 LOD 유지) */
+	void ResumeEmitterInstances();
+
+	/** SuspendEmitterInstances로 쉬는 중 (bIsActive는 그대로, Tick은 매니저에 등록만 함) */
+	bool bSuspendedByInstanceCap = false;
+
+	/** 모든 에미터가 스폰을 마치고 파티클도 남지 않았는지 */
+	bool IsSystemComplete() const;
 
 	FParticleDynamicData* CurrentDynamicData;
 
+	/** CurrentDynamicData를 마지막으로 채운 렌더러 프레임 (에미터 구성이 바뀌면 0으로 무효화) */
+	uint64 LastDynamicDataFrame = 0;
+
+	// ============== Simulation Phase ==============
+	// TickComponent에서 캡처해 FParticleSimulationManager가 시뮬레이션할 때 쓰는 값
+	friend class FParticleSimulationManager;
+
+	/** 시뮬레이션을 기다리는 매니저 (등록되지 않았으면 nullptr) */
+	FParticleSimulationManager* PendingSimulation = nullptr;
+
+	/** 다음 시뮬레이션 단계에서 진행할 시간 (등록 후 여러 번 Tick되면 누적) */
+	float PendingSimulationDeltaTime = 0.0f;
+
+	/** 등록 시점의 월드 위치 (워커가 컴포넌트 트랜스폼을 읽지 않도록 캡처) */
+	FVector PendingSpawnLocation;
+
+	double LastSimulationTimeMS = 0.0;
+
+	/** PendingSimulationDeltaTime을 몇 스텝으로 나눠 시뮬레이션할지 (빨리 감기/저빈도 시뮬레이션 때 1보다 큼) */
+	int32 PendingSimulationSteps = 1;
+
+	/** 충돌 단계에서 모은 이벤트 (시뮬레이션 단계 마지막에 OnParticleCollide로 발행) */
+	TArray<FParticleCollisionEvent> PendingCollisionEvents;
+
+	/** 이벤트 발행을 기다리는 매니저 (발행 전에 삭제되면 목록에서 빼야 함) */
+	FParticleSimulationManager* PendingCollisionDispatch = nullptr;
+
+	/** PendingCollisionEvents를 비우면서 OnParticleCollide 발행 */
+	void DispatchCollisionEvents();
+
+	// ============== Culling State ==============
+	/** 지난 Tick 이후 렌더러가 MarkRendered를 호출했는지 */
+	bool bRenderedSinceLastTick = false;
+
+	float TimeSinceRendered = 0.0f;
+
+	/** 화면 밖이라 아직 시뮬레이션하지 않은 시간 (초) */
+	float OffscreenPendingTime = 0.0f;
+
+	/** 다음 LOD 거리 평가까지 남은 시간 (Template->LODDistanceCheckTime 주기) */
+	float LODCheckCountdown = 0.0f;
+
+	float LastViewDistanceSquared = 0.0f;
+
+	/**
+	 * 화면 밖 처리와 빨리 감기를 반영해 이번 Tick에 시뮬레이션할 시간 계산
+	 * @param OutNumSteps - 반환 시간을 나눌 스텝 수
+	 * @return 시뮬레이션할 시간 (0이면 이번 Tick은 건너뜀)
+	 */
+	float ComputeSimulationDeltaTime(float DeltaTime, int32& OutNumSteps);
+
+	// ============== Warm-up State ==============
+	/** 에미터가 새로 시작돼 다음 Tick에 Template->WarmupTime만큼 웜업해야 함 */
+	bool bWarmupPending = false;
+
+	/** 다음 시뮬레이션 단계에서 고정 스텝으로 진행할 시간 (PendingSimulationDeltaTime보다 먼저 처리) */
+	float PendingFastForwardTime = 0.0f;
+
+	/** 빨리 감기 스텝 길이 (초) */
+	float FastForwardStepTime = 0.0f;
+
+	/** 이번 빨리 감기가 끝나면 결과를 Template->WarmupSnapshot에 저장 */
+	bool bCaptureWarmupSnapshot = false;
+
+	/**
+	 * 웜업 시작: 템플릿 스냅샷이 맞으면 복원만 하고, 아니면 고정 스텝 빨리 감기를 예약
+	 * @return 스냅샷으로 끝났으면 true
+	 */
+	bool BeginWarmup();
+
+	/** 빨리 감기가 끝난 뒤 게임 스레드 정리 (웜업이면 템플릿 스냅샷 저장) */
+	void FinishFastForward();
+
 	/** Editor-only sprite component for visualization (not serialized, PIE excluded) */
 	UBillboardComponent* SpriteComponent = nullptr;
 
@@ -220,4 +390,11 @@ public:
 	 * @return Sphere radius
 	 */
 	float GetBoundingSphereRadius() const;
+
+	// ============== Collision Events ==============
+	/**
+	 * 충돌 모듈의 bGenerateEvents가 켜진 에미터의 파티클이 충돌할 때 (월드 Tick의 시뮬레이션 단계 끝에서 게임 스레드로 발행)
+	 * Lua 스크립트는 같은 액터의 OnParticleCollision 함수로 받는다.
+	 */
+	DECLARE_DELEGATE(OnParticleCollide, UParticleSystemComponent*, const FParticleCollisionEvent&);
 };
@@ -77,6 +77,37 @@ enum class EParticleSortMode : uint8
 	Age_NewestFirst     // 나이순 (최신 것 먼저)
 };
 
+// 화면 밖에 일정 시간 머문 파티클 시스템의 처리 방식
+enum class EParticleOffscreenMode : uint8
+{
+	FullRate,           // 화면 밖이어도 매 프레임 시뮬레이션
+	ReducedRate,        // 낮은 빈도로 모아서 시뮬레이션
+	Suspend             // 시뮬레이션 중단 (다시 보이면 밀린 시간을 빨리 감기)
+};
+
+// 파티클이 지형/메시에 닿았을 때의 반응
+enum class EParticleCollisionResponse : uint8
+{
+	Bounce,             // 반사 (Restitution/Friction 적용)
+	Stick,              // 접촉 지점에 고정
+	Kill                // 즉시 제거
+};
+
+// MaxCollisions에 도달한 파티클 처리
+enum class EParticleCollisionComplete : uint8
+{
+	Kill,               // 제거
+	Freeze,             // 그 자리에 고정
+	HaltCollisions      // 더 이상 충돌 검사 안 함 (그대로 통과)
+};
+
+// 충돌 판정 대상
+enum class EParticleCollisionMode : uint8
+{
+	SceneBVH,           // 파티션 BVH에 세그먼트 쿼리 (정확, 에미터별 쿼리 예산)
+	HeightField         // 에미터 주변을 한 번 샘플링한 높이장 (대량 파티클용, 쿼리 없음)
+};
+
 // SubUV 보간 방식
 enum class EParticleSubUVInterpMethod : uint8
 {
@@ -163,6 +194,44 @@ struct FParticleBurst
 	}
 };
 
+/**
+ * @brief 에미터 인스턴스별 난수 스트림 (LCG)
+ * @details 전역 rand()는 호출 순서에 따라 값이 정해지므로, 에미터를 워커에서 병렬로 시뮬레이션하면
+ *          어느 스레드가 먼저 도느냐에 따라 결과가 달라진다. 에미터마다 시드가 고정된 스트림을 두어
+ *          스케줄링과 무관하게 같은 순서의 값을 얻는다.
+ */
+struct FParticleRandomStream
+{
+	uint32 InitialSeed = 0;
+	uint32 Seed = 0;
+
+	void Initialize(uint32 InSeed)
+	{
+		InitialSeed = InSeed;
+		Seed = InSeed;
+	}
+
+	/** 처음 시드로 되돌림 (시스템 리셋 시 같은 순서를 다시 재생) */
+	void Reset()
+	{
+		Seed = InitialSeed;
+	}
+
+	/** [0, 1) 범위의 난수 */
+	float GetFraction()
+	{
+		Seed = Seed * 196314165u + 907633515u;
+		// 상위 24비트만 사용 (하위 비트는 주기가 짧음)
+		return static_cast<float>(Seed >> 8) * (1.0f / 16777216.0f);
+	}
+
+	/** [0, Max) 범위의 정수 난수 (Max <= 0이면 0) */
+	int32 RandHelper(int32 Max)
+	{
+		return Max > 0 ? std::min(static_cast<int32>(GetFraction() * static_cast<float>(Max)), Max - 1) : 0;
+	}
+};
+
 /**
  * @brief 간단한 Float 분포 (Distribution)
  * @details Min~Max 범위의 랜덤 값 또는 상수 값 제공
@@ -198,14 +267,13 @@ struct FFloatDistribution
 	{
 	}
 
-	float GetValue() const
+	float GetValue(FParticleRandomStream& RandomStream) const
 	{
 		if (bIsUniform)
 		{
 			return Min;
 		}
-		// 간단한 랜덤 (나중에 더 나은 랜덤으로 교체 가능)
-		float Alpha = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+		float Alpha = RandomStream.GetFraction();
 		return Min + Alpha * (Max - Min);
 	}
 };
@@ -245,15 +313,15 @@ struct FVectorDistribution
 	{
 	}
 
-	FVector GetValue() const
+	FVector GetValue(FParticleRandomStream& RandomStream) const
 	{
 		if (bIsUniform)
 		{
 			return Min;
 		}
-		float AlphaX = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-		float AlphaY = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-		float AlphaZ = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+		float AlphaX = RandomStream.GetFraction();
+		float AlphaY = RandomStream.GetFraction();
+		float AlphaZ = RandomStream.GetFraction();
 		return {
 			Min.X + AlphaX * (Max.X - Min.X),
 			Min.Y + AlphaY * (Max.Y - Min.Y),
@@ -297,13 +365,13 @@ struct FColorDistribution
 	{
 	}
 
-	FLinearColor GetValue() const
+	FLinearColor GetValue(FParticleRandomStream& RandomStream) const
 	{
 		if (bIsUniform)
 		{
 			return Min;
 		}
-		float Alpha = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+		float Alpha = RandomStream.GetFraction();
 		return FLinearColor(
 			Min.R + Alpha * (Max.R - Min.R),
 			Min.G + Alpha * (Max.G - Min.G),
@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "ParticleWarmup.h"
+#include "ParticleEmitterInstance.h"
+#include "ParticleModuleRequired.h"
+#include "JsonSerializer.h"
+#include "Source/Runtime/Core/Misc/Base64.h"
+
+namespace
+{
+	bool IsLocalSpaceEmitter(const FParticleEmitterInstance* Instance)
+	{
+		return Instance->CurrentLODLevel && Instance->CurrentLODLevel->RequiredModule
+			&& Instance->CurrentLODLevel->RequiredModule->IsUseLocalSpace();
+	}
+}
+
+void FParticleWarmupSnapshot::Capture(float InWarmupTime, const FVector& Location, const TArray<FParticleEmitterInstance*>& Instances)
+{
+	Reset();
+	WarmupTime = InWarmupTime;
+	CaptureLocation = Location;
+
+	Emitters.SetNum(Instances.Num());
+	for (int32 EmitterIndex = 0; EmitterIndex < Instances.Num(); ++EmitterIndex)
+	{
+		const FParticleEmitterInstance* Instance = Instances[EmitterIndex];
+		FParticleEmitterWarmState& State = Emitters[EmitterIndex];
+		if (!Instance)
+		{
+			continue;
+		}
+
+		State.ParticleStride = Instance->ParticleStride;
+		State.PayloadOffset = Instance->PayloadOffset;
+		State.ModuleLayoutHash = Instance->ModuleLayoutHash;
+		State.bUseSoALayout = Instance->bUseSoALayout;
+		State.ParticleCounter = Instance->ParticleCounter;
+		State.SpawnFraction = Instance->SpawnFraction;
+		State.EmitterTime = Instance->EmitterTime;
+		State.LoopCount = Instance->LoopCount;
+		State.CurrentLoopDuration = Instance->CurrentLoopDuration;
+		State.bEmitterIsDone = Instance->bEmitterIsDone;
+
+		const int32 NumParticles = Instance->HasParticleStorage() ? Instance->ActiveParticles : 0;
+		State.ActiveParticles = NumParticles;
+		State.Particles.SetNum(NumParticles * Instance->ParticleStride);
+
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			uint8* Dst = State.Particles.GetData() + static_cast<size_t>(i) * Instance->ParticleStride;
+			if (Instance->bUseSoALayout)
+			{
+				Instance->SoAData.LoadParticle(i, Dst);
+			}
+			else
+			{
+				memcpy(Dst, Instance->ParticleData + Instance->ParticleIndices[i] * Instance->ParticleStride, Instance->ParticleStride);
+			}
+		}
+	}
+}
+
+bool FParticleWarmupSnapshot::Apply(float InWarmupTime, const FVector& Location, const TArray<FParticleEmitterInstance*>& Instances)
+{
+	if (!IsValid() || WarmupTime != InWarmupTime || Emitters.Num() != Instances.Num())
+	{
+		return false;
+	}
+
+	// 하나라도 맞지 않으면 일부만 복원된 상태가 되지 않도록 먼저 전부 검사
+	for (int32 EmitterIndex = 0; EmitterIndex < Instances.Num(); ++EmitterIndex)
+	{
+		const FParticleEmitterInstance* Instance = Instances[EmitterIndex];
+		const FParticleEmitterWarmState& State = Emitters[EmitterIndex];
+		if (!Instance)
+		{
+			continue;
+		}
+		// 모듈 편집이나 예전 버전에서 저장된 스냅샷이면 Payload 위치가 달라 복사하면 안 되므로 버림
+		if (State.ParticleStride != Instance->ParticleStride
+			|| State.PayloadOffset != Instance->PayloadOffset
+			|| State.ModuleLayoutHash != Instance->ModuleLayoutHash
+			|| State.bUseSoALayout != Instance->bUseSoALayout
+			|| State.Particles.Num() != State.ActiveParticles * State.ParticleStride)
+		{
+			Reset();
+			return false;
+		}
+	}
+
+	for (int32 EmitterIndex = 0; EmitterIndex < Instances.Num(); ++EmitterIndex)
+	{
+		FParticleEmitterInstance* Instance = Instances[EmitterIndex];
+		const FParticleEmitterWarmState& State = Emitters[EmitterIndex];
+		if (!Instance)
+		{
+			continue;
+		}
+
+		Instance->ActiveParticles = 0;
+		if (State.ActiveParticles > Instance->MaxActiveParticles)
+		{
+			Instance->Resize(State.ActiveParticles);
+		}
+
+		// 월드 공간 파티클은 캡처 위치 기준이므로 이 컴포넌트 위치로 옮김
+		const FVector Offset = IsLocalSpaceEmitter(Instance) ? FVector::Zero() : Location - CaptureLocation;
+		const int32 NumParticles = Instance->HasParticleStorage() ? std::min(State.ActiveParticles, Instance->MaxActiveParticles) : 0;
+
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			uint8* ParticlePtr = Instance->bUseSoALayout
+				? Instance->SoAData.GetStagingParticle()
+				: Instance->ParticleData + Instance->ParticleIndices[i] * Instance->ParticleStride;
+
+			memcpy(ParticlePtr, State.Particles.GetData() + static_cast<size_t>(i) * State.ParticleStride, State.ParticleStride);
+
+			FBaseParticle& Particle = *reinterpret_cast<FBaseParticle*>(ParticlePtr);
+			Particle.Location += Offset;
+			Particle.OldLocation += Offset;
+
+			if (Instance->bUseSoALayout)
+			{
+				Instance->SoAData.StoreParticle(i, ParticlePtr);
+			}
+		}
+
+		Instance->ActiveParticles = NumParticles;
+		Instance->ParticleCounter = State.ParticleCounter;
+		Instance->SpawnFraction = State.SpawnFraction;
+		Instance->EmitterTime = State.EmitterTime;
+		Instance->LoopCount = State.LoopCount;
+		Instance->CurrentLoopDuration = State.CurrentLoopDuration;
+		Instance->bEmitterIsDone = State.bEmitterIsDone;
+		Instance->UpdateParticleBounds();
+	}
+
+	return true;
+}
+
+void FParticleWarmupSnapshot::Serialize(bool bIsLoading, JSON& InOutHandle)
+{
+	if (bIsLoading)
+	{
+		Reset();
+		if (InOutHandle.hasKey("WarmupTime")) WarmupTime = static_cast<float>(InOutHandle["WarmupTime"].ToFloat());
+		FJsonSerializer::ReadVector(InOutHandle, "CaptureLocation", CaptureLocation, FVector::Zero(), false);
+
+		if (InOutHandle.hasKey("Emitters") && InOutHandle["Emitters"].JSONType() == JSON::Class::Array)
+		{
+			for (size_t i = 0; i < InOutHandle["Emitters"].size(); ++i)
+			{
+				JSON EmitterJson = InOutHandle["Emitters"][static_cast<int>(i)];
+				FParticleEmitterWarmState State;
+				if (EmitterJson.hasKey("ParticleStride")) State.ParticleStride = static_cast<int32>(EmitterJson["ParticleStride"].ToInt());
+				if (EmitterJson.hasKey("PayloadOffset")) State.PayloadOffset = static_cast<int32>(EmitterJson["PayloadOffset"].ToInt());
+				if (EmitterJson.hasKey("ModuleLayoutHash")) State.ModuleLayoutHash = static_cast<uint32>(EmitterJson["ModuleLayoutHash"].ToInt());
+				if (EmitterJson.hasKey("bUseSoALayout")) State.bUseSoALayout = EmitterJson["bUseSoALayout"].ToBool();
+				if (EmitterJson.hasKey("ActiveParticles")) State.ActiveParticles = static_cast<int32>(EmitterJson["ActiveParticles"].ToInt());
+				if (EmitterJson.hasKey("ParticleCounter")) State.ParticleCounter = static_cast<uint32>(EmitterJson["ParticleCounter"].ToInt());
+				if (EmitterJson.hasKey("SpawnFraction")) State.SpawnFraction = static_cast<float>(EmitterJson["SpawnFraction"].ToFloat());
+				if (EmitterJson.hasKey("EmitterTime")) State.EmitterTime = static_cast<float>(EmitterJson["EmitterTime"].ToFloat());
+				if (EmitterJson.hasKey("LoopCount")) State.LoopCount = static_cast<int32>(EmitterJson["LoopCount"].ToInt());
+				if (EmitterJson.hasKey("CurrentLoopDuration")) State.CurrentLoopDuration = static_cast<float>(EmitterJson["CurrentLoopDuration"].ToFloat());
+				if (EmitterJson.hasKey("bEmitterIsDone")) State.bEmitterIsDone = EmitterJson["bEmitterIsDone"].ToBool();
+				if (EmitterJson.hasKey("Particles"))
+				{
+					const std::vector<uint8_t> Bytes = FBase64::Decode(EmitterJson["Particles"].ToString());
+					State.Particles.assign(Bytes.begin(), Bytes.end());
+				}
+				Emitters.Add(State);
+			}
+		}
+	}
+	else
+	{
+		InOutHandle["WarmupTime"] = WarmupTime;
+		InOutHandle["CaptureLocation"] = FJsonSerializer::VectorToJson(CaptureLocation);
+
+		JSON EmittersArray = JSON::Make(JSON::Class::Array);
+		for (const FParticleEmitterWarmState& State : Emitters)
+		{
+			JSON EmitterJson = JSON::Make(JSON::Class::Object);
+			EmitterJson["ParticleStride"] = State.ParticleStride;
+			EmitterJson["PayloadOffset"] = State.PayloadOffset;
+			EmitterJson["ModuleLayoutHash"] = static_cast<int32>(State.ModuleLayoutHash);
+			EmitterJson["bUseSoALayout"] = State.bUseSoALayout;
+			EmitterJson["ActiveParticles"] = State.ActiveParticles;
+			EmitterJson["ParticleCounter"] = static_cast<int32>(State.ParticleCounter);
+			EmitterJson["SpawnFraction"] = State.SpawnFraction;
+			EmitterJson["EmitterTime"] = State.EmitterTime;
+			EmitterJson["LoopCount"] = State.LoopCount;
+			EmitterJson["CurrentLoopDuration"] = State.CurrentLoopDuration;
+			EmitterJson["bEmitterIsDone"] = State.bEmitterIsDone;
+			EmitterJson["Particles"] = FBase64::Encode(State.Particles.GetData(), State.Particles.Num());
+			EmittersArray.append(EmitterJson);
+		}
+		InOutHandle["Emitters"] = EmittersArray;
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "ParticleTypes.h"
+
+struct FParticleEmitterInstance;
+
+/**
+ * @brief 웜업이 끝난 에미터 하나의 상태 (파티클 + 시간/루프/스폰 누적값)
+ * @details 파티클은 레이아웃(AoS/SoA)과 무관하게 활성 순서대로 ParticleStride 간격의 AoS로 저장한다.
+ */
+struct FParticleEmitterWarmState
+{
+	// 파티클 바이트 레이아웃 (Apply할 때 인스턴스와 모두 같아야 함)
+	int32 ParticleStride = 0;
+	int32 PayloadOffset = 0;
+	uint32 ModuleLayoutHash = 0;
+	bool bUseSoALayout = false;
+
+	int32 ActiveParticles = 0;
+	uint32 ParticleCounter = 0;
+	float SpawnFraction = 0.0f;
+	float EmitterTime = 0.0f;
+	int32 LoopCount = 0;
+	float CurrentLoopDuration = 0.0f;
+	bool bEmitterIsDone = false;
+	TArray<uint8> Particles;
+};
+
+/**
+ * @brief 파티클 시스템 웜업 스냅샷 (UParticleSystem 소유, .psys에 Base64로 함께 저장)
+ * @details WarmupTime만큼 시뮬레이션한 결과를 저장해 두고, 활성화할 때 시뮬레이션 대신 복사해
+ *          연기/불 같은 상시 이펙트가 프레임 비용 없이 정상 상태에서 시작하게 한다.
+ *          - 월드 공간 에미터의 파티클 위치는 CaptureLocation 기준으로 저장하고, 복원할 때 컴포넌트 위치만큼 옮긴다
+ *          - 난수 스트림은 복원하지 않으므로 복원 이후 스폰은 인스턴스마다 달라진다
+ *          - 에미터 수/WarmupTime/파티클 레이아웃(Stride, PayloadOffset, 모듈 구성 해시, SoA 여부)이 다르면 무효
+ *            레이아웃이 다르면 Apply가 스냅샷을 비워 다음 웜업이 다시 캡처한다 (모듈이 바뀌면 UParticleSystem::OnModuleChanged에서도 비움)
+ */
+struct FParticleWarmupSnapshot
+{
+	float WarmupTime = 0.0f;
+	FVector CaptureLocation = FVector::Zero();
+	TArray<FParticleEmitterWarmState> Emitters;
+
+	bool IsValid() const { return WarmupTime > 0.0f && !Emitters.IsEmpty(); }
+
+	void Reset()
+	{
+		WarmupTime = 0.0f;
+		CaptureLocation = FVector::Zero();
+		Emitters.Empty();
+	}
+
+	/** 웜업이 끝난 에미터 인스턴스 상태 저장 */
+	void Capture(float InWarmupTime, const FVector& Location, const TArray<FParticleEmitterInstance*>& Instances);
+
+	/**
+	 * 에미터 인스턴스에 복원
+	 * @return 에미터 구성이 맞지 않으면 인스턴스는 바꾸지 않고 false (레이아웃이 다르면 스냅샷도 비움)
+	 */
+	bool Apply(float InWarmupTime, const FVector& Location, const TArray<FParticleEmitterInstance*>& Instances);
+
+	void Serialize(bool bIsLoading, JSON& InOutHandle);
+};
@@ -32,7 +32,7 @@ void UParticleModuleMeshRotation::Spawn(FParticleEmitterInstance* Owner, int32 O
 		reinterpret_cast<FMeshRotationPayloadData*>(reinterpret_cast<uint8*>(ParticleBase) + Offset);
 
 	// 3D 회전 설정 (Degrees → Radians)
-	FVector RotationDegrees = StartRotation.GetValue();
+	FVector RotationDegrees = StartRotation.GetValue(Owner->RandomStream);
 	PayloadData->Rotation = FVector(
 		DegreesToRadians(RotationDegrees.X),
 		DegreesToRadians(RotationDegrees.Y),
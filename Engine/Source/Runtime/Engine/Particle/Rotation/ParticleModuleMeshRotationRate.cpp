@@ -33,7 +33,7 @@ void UParticleModuleMeshRotationRate::Spawn(FParticleEmitterInstance* Owner, int
 		reinterpret_cast<FMeshRotationPayloadData*>(reinterpret_cast<uint8*>(ParticleBase) + Offset);
 
 	// 3D 회전 속도 설정 (Degrees/sec → Radians/sec)
-	FVector RateDegrees = StartRotationRate.GetValue();
+	FVector RateDegrees = StartRotationRate.GetValue(Owner->RandomStream);
 	PayloadData->RotationRate = FVector(
 		DegreesToRadians(RateDegrees.X),
 		DegreesToRadians(RateDegrees.Y),
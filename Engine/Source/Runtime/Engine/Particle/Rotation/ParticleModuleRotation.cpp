@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleRotation.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleRotation::UParticleModuleRotation()
 	: StartRotation(0.0f)
@@ -17,7 +18,7 @@ void UParticleModuleRotation::Spawn(FParticleEmitterInstance* Owner, int32 Offse
 	}
 
 	// Degrees → Radians 변환 후 적용
-	float RotationDegrees = StartRotation.GetValue();
+	float RotationDegrees = StartRotation.GetValue(Owner->RandomStream);
 	ParticleBase->Rotation = DegreesToRadians(RotationDegrees);
 }
 
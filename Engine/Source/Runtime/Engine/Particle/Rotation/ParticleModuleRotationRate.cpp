@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleRotationRate.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleRotationRate::UParticleModuleRotationRate()
 	: StartRotationRate(0.0f)
@@ -17,7 +18,7 @@ void UParticleModuleRotationRate::Spawn(FParticleEmitterInstance* Owner, int32 O
 	}
 
 	// Degrees/sec → Radians/sec 변환 후 적용
-	float RateDegrees = StartRotationRate.GetValue();
+	float RateDegrees = StartRotationRate.GetValue(Owner->RandomStream);
 	ParticleBase->RotationRate = DegreesToRadians(RateDegrees);
 }
 
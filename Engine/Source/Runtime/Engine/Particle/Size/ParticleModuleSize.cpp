@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleSize.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleSize::UParticleModuleSize()
 	: StartSize(FVector(1.0f, 1.0f, 1.0f))
@@ -17,7 +18,7 @@ void UParticleModuleSize::Spawn(FParticleEmitterInstance* Owner, int32 Offset, f
 	}
 
 	// 파티클 크기 설정
-	ParticleBase->Size = StartSize.GetValue();
+	ParticleBase->Size = StartSize.GetValue(Owner->RandomStream);
 }
 
 void UParticleModuleSize::Serialize(bool bIsLoading, JSON& InOutHandle)
@@ -46,9 +46,10 @@ UParticleModuleSpawn::UParticleModuleSpawn()
  * @param InOutSpawnFraction [입출력] 소수점 누적값
  *                           - 입력: 이전 프레임까지의 누적 소수점
  *                           - 출력: 이번 프레임 후 남은 소수점
+ * @param RandomStream 에미터 인스턴스의 난수 스트림
  * @return 파티클을 1개 이상 생성해야 하면 true
  */
-bool UParticleModuleSpawn::GetSpawnAmount(float DeltaTime, int32& OutNumber, float& OutRate, float& InOutSpawnFraction)
+bool UParticleModuleSpawn::GetSpawnAmount(float DeltaTime, int32& OutNumber, float& OutRate, float& InOutSpawnFraction, FParticleRandomStream& RandomStream)
 {
 	// ========== 1단계: 출력값 초기화 ==========
 	OutNumber = 0;
@@ -63,7 +64,7 @@ bool UParticleModuleSpawn::GetSpawnAmount(float DeltaTime, int32& OutNumber, flo
 	// ========== 2단계: 현재 생성률 계산 ==========
 	// Rate와 RateScale 모두 Distribution이므로 매번 다른 값이 나올 수 있음
 	// 예: Rate(Min=20, Max=40) * RateScale(1.0) → 20~40 사이 랜덤
-	float CurrentRate = Rate.GetValue() * RateScale.GetValue();
+	float CurrentRate = Rate.GetValue(RandomStream) * RateScale.GetValue(RandomStream);
 
 	// 생성률이 0 이하면 생성 안 함
 	if (CurrentRate <= 0.0f)
@@ -98,9 +99,10 @@ bool UParticleModuleSpawn::GetSpawnAmount(float DeltaTime, int32& OutNumber, flo
  * @param OldTime 이전 시간 (AccumulatedTime - DeltaTime)
  * @param NewTime 현재 시간 (AccumulatedTime)
  * @param Duration 이미터 지속 시간 (루프 계산용)
+ * @param RandomStream 에미터 인스턴스의 난수 스트림
  * @return 버스트로 생성할 파티클 수
  */
-int32 UParticleModuleSpawn::GetBurstCount(float OldTime, float NewTime, float Duration)
+int32 UParticleModuleSpawn::GetBurstCount(float OldTime, float NewTime, float Duration, FParticleRandomStream& RandomStream)
 {
 	if (!bProcessBurstList || BurstList.empty())
 	{
@@ -114,7 +116,7 @@ int32 UParticleModuleSpawn::GetBurstCount(float OldTime, float NewTime, float Du
 	}
 
 	int32 TotalBurst = 0;
-	float Scale = BurstScale.GetValue();
+	float Scale = BurstScale.GetValue(RandomStream);
 
 	// 루핑 이미터를 위해 시간을 Duration 내로 wrap
 	float WrappedOldTime = fmod(OldTime, Duration);
@@ -157,7 +159,7 @@ int32 UParticleModuleSpawn::GetBurstCount(float OldTime, float NewTime, float Du
 			if (Burst.CountLow >= 0 && Burst.CountLow < Burst.Count)
 			{
 				int32 Range = Burst.Count - Burst.CountLow;
-				Count = Burst.CountLow + (rand() % (Range + 1));
+				Count = Burst.CountLow + RandomStream.RandHelper(Range + 1);
 			}
 
 			// 스케일 적용
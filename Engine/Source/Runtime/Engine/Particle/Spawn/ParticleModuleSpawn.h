@@ -90,9 +90,10 @@ public:
 	 * @param InOutSpawnFraction [입출력] 소수점 누적값 (EmitterInstance에서 관리)
 	 *                           - 입력: 이전 프레임까지의 누적 소수점
 	 *                           - 출력: 이번 프레임 후 남은 소수점
+	 * @param RandomStream 에미터 인스턴스의 난수 스트림 (Rate 분포 샘플링)
 	 * @return 파티클을 1개 이상 생성해야 하면 true
 	 */
-	bool GetSpawnAmount(float DeltaTime, int32& OutNumber, float& OutRate, float& InOutSpawnFraction);
+	bool GetSpawnAmount(float DeltaTime, int32& OutNumber, float& OutRate, float& InOutSpawnFraction, FParticleRandomStream& RandomStream);
 
 	/**
 	 * @brief Burst 기반으로 이번 프레임에 생성할 파티클 수 계산
@@ -106,7 +107,8 @@ public:
 	 * @param OldTime 이전 프레임 시간 (AccumulatedTime - DeltaTime)
 	 * @param NewTime 현재 프레임 시간 (AccumulatedTime)
 	 * @param Duration 이미터 총 지속 시간 (루프 계산용)
+	 * @param RandomStream 에미터 인스턴스의 난수 스트림 (BurstScale/CountLow 범위 샘플링)
 	 * @return 이번 프레임에 버스트로 생성할 파티클 총 개수
 	 */
-	int32 GetBurstCount(float OldTime, float NewTime, float Duration);
+	int32 GetBurstCount(float OldTime, float NewTime, float Duration, FParticleRandomStream& RandomStream);
 };
@@ -46,7 +46,7 @@ void UParticleModuleSubUV::Spawn(FParticleEmitterInstance* Owner, int32 Offset,
 				if (CurrentMethod == EParticleSubUVInterpMethod::Random || 
 					CurrentMethod == EParticleSubUVInterpMethod::RandomBlend)
 				{
-					SubUVData->ImageIndex = static_cast<float>(rand() % TotalFrames);
+					SubUVData->ImageIndex = static_cast<float>(Owner->RandomStream.RandHelper(TotalFrames));
 				}
 				else
 				{
@@ -100,11 +100,11 @@ void UParticleModuleSubUV::Update(FParticleEmitterInstance* Owner, int32 Offset,
 	// 각 파티클 업데이트
 	for (int32 i = Owner->ActiveParticles - 1; i >= 0; i--)
 	{
-		const int32 CurrentIndex = Owner->ParticleIndices[i];
-		uint8* ParticlePtr = Owner->ParticleData + (CurrentIndex * Owner->ParticleStride);
-		FBaseParticle& Particle = *reinterpret_cast<FBaseParticle*>(ParticlePtr);
-		
-		FSubUVPayloadData* SubUVData = reinterpret_cast<FSubUVPayloadData*>(ParticlePtr + Offset);
+		// AoS/SoA 레이아웃 공통 접근 (CurrentIndex는 랜덤 시드용 고정 번호)
+		const int32 CurrentIndex = static_cast<int32>(Owner->GetParticleSeedIndex(i));
+		const float RelativeTime = Owner->GetParticleRelativeTime(i);
+
+		FSubUVPayloadData* SubUVData = reinterpret_cast<FSubUVPayloadData*>(Owner->GetParticlePayload(i, Offset));
 
 		if (bUseRealTime)
 		{
@@ -124,7 +124,7 @@ void UParticleModuleSubUV::Update(FParticleEmitterInstance* Owner, int32 Offset,
 			case EParticleSubUVInterpMethod::Linear:
 				// 블렌딩 없이 주어진 순서대로 전환, 마지막 프레임 후 첫 프레임으로 순환
 				{
-					float FrameProgress = Particle.RelativeTime * TotalFrames;
+					float FrameProgress = RelativeTime * TotalFrames;
 					SubUVData->ImageIndex = fmodf(floorf(FrameProgress), static_cast<float>(TotalFrames));
 				}
 				break;
@@ -133,7 +133,7 @@ void UParticleModuleSubUV::Update(FParticleEmitterInstance* Owner, int32 Offset,
 				// 현재와 다음 서브 이미지를 블렌딩하여 전환
 				// 소수부가 두 텍스처 간의 알파 블렌딩 가중치로 사용됨
 				{
-					float FrameProgress = Particle.RelativeTime * TotalFrames;
+					float FrameProgress = RelativeTime * TotalFrames;
 					// TotalFrames를 넘으면 순환
 					SubUVData->ImageIndex = fmodf(FrameProgress, static_cast<float>(TotalFrames));
 				}
@@ -144,7 +144,7 @@ void UParticleModuleSubUV::Update(FParticleEmitterInstance* Owner, int32 Offset,
 				{
 					int32 Changes = RandomImageChanges > 0 ? RandomImageChanges : 1;
 					// 현재 어느 변경 구간에 있는지 계산
-					int32 CurrentChangeIndex = static_cast<int32>(Particle.RelativeTime * Changes);
+					int32 CurrentChangeIndex = static_cast<int32>(RelativeTime * Changes);
 					
 					// 해당 구간의 시드로 랜덤 프레임 결정 (같은 구간에서는 같은 프레임)
 					// CurrentIndex를 시드로 사용하여 각 파티클마다 다른 시퀀스 보장
@@ -164,10 +164,10 @@ void UParticleModuleSubUV::Update(FParticleEmitterInstance* Owner, int32 Offset,
 					int32 Changes = RandomImageChanges > 0 ? RandomImageChanges : 1;
 					
 					// 현재 변경 구간 인덱스
-					int32 CurrentChangeIndex = static_cast<int32>(Particle.RelativeTime * Changes);
+					int32 CurrentChangeIndex = static_cast<int32>(RelativeTime * Changes);
 					
 					// 현재 구간 내에서의 진행도 (0.0 ~ 1.0)
-					float ProgressInChange = fmodf(Particle.RelativeTime * Changes, 1.0f);
+					float ProgressInChange = fmodf(RelativeTime * Changes, 1.0f);
 					
 					// 현재 프레임 결정 (CurrentIndex 기반 시드로 일관성 유지)
 					uint32 SeedCurrent = static_cast<uint32>(CurrentIndex + CurrentChangeIndex * 10000);
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ParticleModuleVelocity.h"
+#include "ParticleEmitterInstance.h"
 
 UParticleModuleVelocity::UParticleModuleVelocity()
 	: StartVelocity(FVector::Zero())
@@ -19,10 +20,10 @@ void UParticleModuleVelocity::Spawn(FParticleEmitterInstance* Owner, int32 Offse
 	}
 
 	// 기본 속도 설정
-	FVector Velocity = StartVelocity.GetValue();
+	FVector Velocity = StartVelocity.GetValue(Owner->RandomStream);
 
 	// 방사형 속도 추가
-	float RadialVelocity = StartVelocityRadial.GetValue();
+	float RadialVelocity = StartVelocityRadial.GetValue(Owner->RandomStream);
 	if (RadialVelocity != 0.0f)
 	{
 		// 파티클 위치를 정규화하여 방향으로 사용
@@ -9,10 +9,14 @@
 #include "Collision.h"
 #include "Vector.h"
 #include "OBB.h"
+#include "BoundingSphere.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
 
 #include "StaticMeshComponent.h"
+#include "StaticMesh.h"
+#include "MeshBVH.h"
+#include "TaskScheduler.h"
 
 namespace {
     inline bool RayAABB_IntersectT(const FRay& ray, const FAABB& box, float& outTMin, float& outTMax)
@@ -66,8 +70,10 @@ void FBVHierarchy::Clear()
     StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
     Nodes = TArray<FLBVHNode>();
+    TraceData = TArray<FPrimitiveTraceData>();
     Bounds = FAABB();
     bPendingRebuild = false;
+    bTraceDataDirty = true;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
@@ -274,6 +280,7 @@ void FBVHierarchy::BuildLBVH()
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
+    bTraceDataDirty = true;
 
     if (N == 0)
     {
@@ -576,3 +583,824 @@ TArray<UPrimitiveComponent*> FBVHierarchy::QueryIntersectedComponents(const FBou
         [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::Intersects(compBound, inBound); }
     );
 }
+
+// ===== Batch ray query =====
+
+namespace
+{
+    constexpr int32 RayPacketSize = 8;
+    constexpr int32 MaxTraversalDepth = 64;
+
+    inline float SafeInverse(float V)
+    {
+        return std::abs(V) > 1e-8f ? 1.0f / V : (V >= 0.0f ? 1e30f : -1e30f);
+    }
+}
+
+// 패킷 내 레이를 SoA로 보관해 노드 슬랩 테스트를 레인 단위 루프로 처리 (컴파일러 자동 벡터화 대상)
+struct FBVHierarchy::FRayPacket
+{
+    float OriginX[RayPacketSize], OriginY[RayPacketSize], OriginZ[RayPacketSize];
+    float InvDirX[RayPacketSize], InvDirY[RayPacketSize], InvDirZ[RayPacketSize];
+    float TMax[RayPacketSize];
+    int32 Count = 0;
+
+    // 레인 하나에 대한 슬랩 테스트
+    bool IntersectLane(int32 Lane, const FAABB& Box, float& OutEntry) const
+    {
+        float T1 = (Box.Min.X - OriginX[Lane]) * InvDirX[Lane];
+        float T2 = (Box.Max.X - OriginX[Lane]) * InvDirX[Lane];
+        float TNear = std::min(T1, T2);
+        float TFar = std::max(T1, T2);
+
+        T1 = (Box.Min.Y - OriginY[Lane]) * InvDirY[Lane];
+        T2 = (Box.Max.Y - OriginY[Lane]) * InvDirY[Lane];
+        TNear = std::max(TNear, std::min(T1, T2));
+        TFar = std::min(TFar, std::max(T1, T2));
+
+        T1 = (Box.Min.Z - OriginZ[Lane]) * InvDirZ[Lane];
+        T2 = (Box.Max.Z - OriginZ[Lane]) * InvDirZ[Lane];
+        TNear = std::max(TNear, std::min(T1, T2));
+        TFar = std::min(TFar, std::max(T1, T2));
+
+        TNear = std::max(TNear, 0.0f);
+        TFar = std::min(TFar, TMax[Lane]);
+        OutEntry = TNear;
+        return TNear <= TFar;
+    }
+
+    // 활성 레인 전체에 대한 슬랩 테스트, 맞은 레인 마스크와 최소 진입 거리를 반환
+    uint32 Intersect(uint32 ActiveMask, const FAABB& Box, float& OutMinEntry) const
+    {
+        uint32 HitMask = 0;
+        float MinEntry = std::numeric_limits<float>::max();
+        for (int32 Lane = 0; Lane < Count; ++Lane)
+        {
+            float Entry;
+            if ((ActiveMask & (1u << Lane)) && IntersectLane(Lane, Box, Entry))
+            {
+                HitMask |= (1u << Lane);
+                MinEntry = std::min(MinEntry, Entry);
+            }
+        }
+        OutMinEntry = MinEntry;
+        return HitMask;
+    }
+};
+
+void FBVHierarchy::PrepareTraceData()
+{
+    if (!bTraceDataDirty)
+    {
+        return;
+    }
+
+    // 메시 BVH 캐시(ResourceManager)는 스레드 안전하지 않으므로 병렬 순회 전에 게임 스레드에서 미리 확보
+    const int32 N = StaticMeshComponentArray.Num();
+    TraceData.SetNum(N);
+    for (int32 i = 0; i < N; ++i)
+    {
+        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
+        FPrimitiveTraceData& Data = TraceData[i];
+        Data = FPrimitiveTraceData();
+        if (!Component)
+        {
+            continue;
+        }
+
+        const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+        Data.Bounds = Cached ? *Cached : Component->GetWorldAABB();
+        Data.Component = Component;
+        Data.Owner = Component->GetOwner();
+
+        if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+        {
+            UStaticMesh* MeshRes = StaticMeshComponent->GetStaticMesh();
+            FStaticMesh* StaticMesh = MeshRes ? MeshRes->GetStaticMeshAsset() : nullptr;
+            if (StaticMesh)
+            {
+                Data.Mesh = StaticMesh;
+                Data.MeshBVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshRes->GetAssetPathFileName(), StaticMesh);
+                Data.WorldToLocal = StaticMeshComponent->GetWorldMatrix().InverseAffine();
+            }
+        }
+    }
+    bTraceDataDirty = false;
+}
+
+bool FBVHierarchy::TracePrimitive(int32 PrimitiveIndex, const FBVHRayQuery& Query, float EntryT, float MaxT, bool bAnyHit,
+    float& OutT, int32& OutTriangleIndex) const
+{
+    const FPrimitiveTraceData& Data = TraceData[PrimitiveIndex];
+    if (!Data.Owner || Data.Owner == Query.IgnoreActor)
+    {
+        return false;
+    }
+    if (Query.bIgnoreHiddenInEditor && Data.Owner->GetActorHiddenInEditor())
+    {
+        return false;
+    }
+
+    if (Data.MeshBVH)
+    {
+        // 아핀 변환은 레이 매개변수 t를 보존하므로 로컬 방향을 정규화하지 않으면 로컬 t가 곧 월드 거리
+        const FRay LocalRay{ Data.WorldToLocal.TransformPosition(Query.Origin), Data.WorldToLocal.TransformVector(Query.Direction) };
+        return Data.MeshBVH->IntersectRayClosest(LocalRay, Data.Mesh->Vertices, Data.Mesh->Indices,
+            MaxT, bAnyHit, OutT, OutTriangleIndex);
+    }
+
+    if (Query.bUseBoundsForNonMesh && !Data.Mesh)
+    {
+        OutT = EntryT;
+        OutTriangleIndex = INDEX_NONE;
+        return true;
+    }
+    return false;
+}
+
+FVector FBVHierarchy::ComputeHitNormal(int32 PrimitiveIndex, const FBVHRayQuery& Query, int32 TriangleIndex, const FVector& HitLocation) const
+{
+    const FPrimitiveTraceData& Data = TraceData[PrimitiveIndex];
+    FVector Normal = Query.Direction * -1.0f;
+
+    if (Data.Mesh && TriangleIndex != INDEX_NONE)
+    {
+        const FVector& A = Data.Mesh->Vertices[Data.Mesh->Indices[3 * TriangleIndex + 0]].pos;
+        const FVector& B = Data.Mesh->Vertices[Data.Mesh->Indices[3 * TriangleIndex + 1]].pos;
+        const FVector& C = Data.Mesh->Vertices[Data.Mesh->Indices[3 * TriangleIndex + 2]].pos;
+        const FVector LocalNormal = FVector::Cross(B - A, C - A);
+
+        // 법선은 WorldToLocal의 전치로 변환 (비균등 스케일에서도 면에 수직 유지)
+        const FMatrix& W = Data.WorldToLocal;
+        const FVector WorldNormal(
+            W.M[0][0] * LocalNormal.X + W.M[0][1] * LocalNormal.Y + W.M[0][2] * LocalNormal.Z,
+            W.M[1][0] * LocalNormal.X + W.M[1][1] * LocalNormal.Y + W.M[1][2] * LocalNormal.Z,
+            W.M[2][0] * LocalNormal.X + W.M[2][1] * LocalNormal.Y + W.M[2][2] * LocalNormal.Z);
+        if (WorldNormal.SizeSquared() > 1e-12f)
+        {
+            Normal = WorldNormal.GetNormalized();
+        }
+    }
+    else
+    {
+        // AABB 판정: 히트 지점에서 가장 가까운 면
+        const FVector Center = Data.Bounds.GetCenter();
+        const FVector Extent = Data.Bounds.GetHalfExtent();
+        const FVector Local = HitLocation - Center;
+        const float DX = Extent.X - std::abs(Local.X);
+        const float DY = Extent.Y - std::abs(Local.Y);
+        const float DZ = Extent.Z - std::abs(Local.Z);
+        if (DX <= DY && DX <= DZ)
+        {
+            Normal = FVector(Local.X >= 0.0f ? 1.0f : -1.0f, 0.0f, 0.0f);
+        }
+        else if (DY <= DZ)
+        {
+            Normal = FVector(0.0f, Local.Y >= 0.0f ? 1.0f : -1.0f, 0.0f);
+        }
+        else
+        {
+            Normal = FVector(0.0f, 0.0f, Local.Z >= 0.0f ? 1.0f : -1.0f);
+        }
+    }
+
+    // 뒷면으로 맞은 경우에도 레이가 들어온 쪽을 향하게
+    if (FVector::Dot(Normal, Query.Direction) > 0.0f)
+    {
+        Normal = Normal * -1.0f;
+    }
+    return Normal;
+}
+
+void FBVHierarchy::TraceRayPacket(const TArray<FBVHRayQuery>& Queries, const int32* QueryIndices, int32 Count,
+    EBVHRayQueryMode Mode, TArray<FBVHRayHit>& OutHits) const
+{
+    const bool bAnyHit = (Mode == EBVHRayQueryMode::AnyHit);
+
+    FRayPacket Packet;
+    Packet.Count = Count;
+    for (int32 Lane = 0; Lane < Count; ++Lane)
+    {
+        const FBVHRayQuery& Query = Queries[QueryIndices[Lane]];
+        Packet.OriginX[Lane] = Query.Origin.X;
+        Packet.OriginY[Lane] = Query.Origin.Y;
+        Packet.OriginZ[Lane] = Query.Origin.Z;
+        Packet.InvDirX[Lane] = SafeInverse(Query.Direction.X);
+        Packet.InvDirY[Lane] = SafeInverse(Query.Direction.Y);
+        Packet.InvDirZ[Lane] = SafeInverse(Query.Direction.Z);
+        Packet.TMax[Lane] = Query.MaxDistance > 0.0f ? Query.MaxDistance : 0.0f;
+    }
+
+    uint32 ActiveMask = (Count >= 32) ? ~0u : ((1u << Count) - 1u);
+
+    // 법선은 레인마다 최종 히트에서 한 번만 계산
+    int32 HitPrimitive[RayPacketSize];
+    for (int32 Lane = 0; Lane < Count; ++Lane)
+    {
+        HitPrimitive[Lane] = INDEX_NONE;
+    }
+
+    struct FStackEntry
+    {
+        int32 NodeIndex;
+        uint32 Mask;
+    };
+    FStackEntry Stack[MaxTraversalDepth];
+    int32 StackSize = 0;
+
+    float RootEntry;
+    const uint32 RootMask = Packet.Intersect(ActiveMask, Nodes[0].Bounds, RootEntry);
+    if (RootMask == 0)
+    {
+        return;
+    }
+    Stack[StackSize++] = { 0, RootMask };
+
+    while (StackSize > 0 && ActiveMask != 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        const FLBVHNode& Node = Nodes[Entry.NodeIndex];
+
+        // 푸시 이후 TMax가 줄었을 수 있으므로 다시 판정
+        float NodeEntry;
+        const uint32 NodeMask = Packet.Intersect(Entry.Mask & ActiveMask, Node.Bounds, NodeEntry);
+        if (NodeMask == 0)
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                const int32 PrimitiveIndex = Node.First + i;
+                const FPrimitiveTraceData& Data = TraceData[PrimitiveIndex];
+                if (!Data.Owner)
+                {
+                    continue;
+                }
+
+                for (int32 Lane = 0; Lane < Count; ++Lane)
+                {
+                    const uint32 Bit = 1u << Lane;
+                    float PrimEntry;
+                    if (!(NodeMask & ActiveMask & Bit) || !Packet.IntersectLane(Lane, Data.Bounds, PrimEntry))
+                    {
+                        continue;
+                    }
+
+                    const int32 QueryIndex = QueryIndices[Lane];
+                    const FBVHRayQuery& Query = Queries[QueryIndex];
+                    float HitT;
+                    int32 HitTriangle;
+                    if (TracePrimitive(PrimitiveIndex, Query, PrimEntry, Packet.TMax[Lane], bAnyHit, HitT, HitTriangle)
+                        && HitT <= Packet.TMax[Lane])
+                    {
+                        Packet.TMax[Lane] = HitT;
+
+                        FBVHRayHit& Hit = OutHits[QueryIndex];
+                        Hit.Component = StaticMeshComponentArray[PrimitiveIndex];
+                        Hit.Distance = HitT;
+                        Hit.TriangleIndex = HitTriangle;
+                        Hit.Location = Query.Origin + Query.Direction * HitT;
+                        HitPrimitive[Lane] = PrimitiveIndex;
+
+                        if (bAnyHit)
+                        {
+                            ActiveMask &= ~Bit;
+                        }
+                    }
+                }
+            }
+            continue;
+        }
+
+        // 내부 노드: 패킷 기준으로 가까운 자식을 먼저 방문
+        float LeftEntry = 0.0f, RightEntry = 0.0f;
+        const uint32 LeftMask = (Node.Left >= 0) ? Packet.Intersect(NodeMask, Nodes[Node.Left].Bounds, LeftEntry) : 0;
+        const uint32 RightMask = (Node.Right >= 0) ? Packet.Intersect(NodeMask, Nodes[Node.Right].Bounds, RightEntry) : 0;
+
+        if (StackSize + 2 > MaxTraversalDepth)
+        {
+            continue;
+        }
+        if (LeftMask && RightMask)
+        {
+            if (LeftEntry <= RightEntry)
+            {
+                Stack[StackSize++] = { Node.Right, RightMask };
+                Stack[StackSize++] = { Node.Left, LeftMask };
+            }
+            else
+            {
+                Stack[StackSize++] = { Node.Left, LeftMask };
+                Stack[StackSize++] = { Node.Right, RightMask };
+            }
+        }
+        else if (LeftMask)
+        {
+            Stack[StackSize++] = { Node.Left, LeftMask };
+        }
+        else if (RightMask)
+        {
+            Stack[StackSize++] = { Node.Right, RightMask };
+        }
+    }
+
+    for (int32 Lane = 0; Lane < Count; ++Lane)
+    {
+        if (HitPrimitive[Lane] != INDEX_NONE)
+        {
+            FBVHRayHit& Hit = OutHits[QueryIndices[Lane]];
+            Hit.Normal = ComputeHitNormal(HitPrimitive[Lane], Queries[QueryIndices[Lane]], Hit.TriangleIndex, Hit.Location);
+        }
+    }
+}
+
+void FBVHierarchy::QueryRayBatch(const TArray<FBVHRayQuery>& Queries, OUT TArray<FBVHRayHit>& OutHits,
+    EBVHRayQueryMode Mode, bool bParallel)
+{
+    const int32 NumQueries = Queries.Num();
+    OutHits.SetNum(NumQueries);
+    for (FBVHRayHit& Hit : OutHits)
+    {
+        Hit = FBVHRayHit();
+    }
+
+    if (NumQueries == 0 || Nodes.empty())
+    {
+        return;
+    }
+
+    PrepareTraceData();
+
+    // 방향 옥탄트 + 원점 모턴 코드로 정렬해 비슷한 경로를 밟는 레이끼리 패킷을 구성
+    const FVector Min = Bounds.Min;
+    const FVector Extent = Bounds.GetHalfExtent();
+    const auto Quantize = [](float Value, float MinValue, float ExtHalf)
+        {
+            const float Normalized = ExtHalf > 0.0f ? std::clamp((Value - MinValue) / (ExtHalf * 2.0f), 0.0f, 1.0f) : 0.5f;
+            return static_cast<uint32>(Normalized * 1023.0f);
+        };
+
+    RayOrderScratch.SetNum(NumQueries);
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        const FBVHRayQuery& Query = Queries[i];
+        const uint64 Octant = (Query.Direction.X < 0.0f ? 1u : 0u)
+            | (Query.Direction.Y < 0.0f ? 2u : 0u)
+            | (Query.Direction.Z < 0.0f ? 4u : 0u);
+        const uint32 Code = Morton3D(
+            Quantize(Query.Origin.X, Min.X, Extent.X),
+            Quantize(Query.Origin.Y, Min.Y, Extent.Y),
+            Quantize(Query.Origin.Z, Min.Z, Extent.Z));
+        RayOrderScratch[i] = { (Octant << 32) | Code, i };
+    }
+    std::sort(RayOrderScratch.begin(), RayOrderScratch.end(),
+        [](const auto& LHS, const auto& RHS) { return LHS.first < RHS.first; });
+
+    const int32 NumPackets = (NumQueries + RayPacketSize - 1) / RayPacketSize;
+    const auto TracePacket = [&](int32 PacketIndex)
+        {
+            int32 QueryIndices[RayPacketSize];
+            const int32 First = PacketIndex * RayPacketSize;
+            const int32 Count = std::min(RayPacketSize, NumQueries - First);
+            for (int32 Lane = 0; Lane < Count; ++Lane)
+            {
+                QueryIndices[Lane] = RayOrderScratch[First + Lane].second;
+            }
+            TraceRayPacket(Queries, QueryIndices, Count, Mode, OutHits);
+        };
+
+    if (bParallel)
+    {
+        // 패킷마다 결과 슬롯이 겹치지 않으므로 동기화 없이 병렬 실행
+        ParallelFor(NumPackets, TracePacket, 4);
+    }
+    else
+    {
+        for (int32 PacketIndex = 0; PacketIndex < NumPackets; ++PacketIndex)
+        {
+            TracePacket(PacketIndex);
+        }
+    }
+}
+
+// ===== Shape overlap / sweep =====
+
+namespace
+{
+    // 부풀린 박스에 대한 슬랩 판정 (InvDir는 SafeInverse 결과)
+    inline bool IntersectSlab(const FVector& Origin, const FVector& InvDir, const FVector& Min, const FVector& Max,
+        float MaxT, float& OutEntry)
+    {
+        float TMin = 0.0f;
+        float TMax = MaxT;
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            float T1 = (Min[Axis] - Origin[Axis]) * InvDir[Axis];
+            float T2 = (Max[Axis] - Origin[Axis]) * InvDir[Axis];
+            if (T1 > T2) std::swap(T1, T2);
+            TMin = std::max(TMin, T1);
+            TMax = std::min(TMax, T2);
+        }
+        OutEntry = TMin;
+        return TMin <= TMax;
+    }
+}
+
+// 쿼리마다 한 번만 계산하는 형상 데이터 (캡슐 축 선분, OBB 축, 월드 AABB 반크기)
+struct FBVHierarchy::FPreparedShape
+{
+    EBVHShapeType Type;
+    FVector Center;
+    float Radius = 0.0f;
+    FVector P0, P1;
+    FOBB Box;
+    FVector BoundsHalf;
+
+    explicit FPreparedShape(const FBVHCollisionShape& Shape)
+        : Type(Shape.Type)
+        , Center(Shape.Center)
+    {
+        switch (Type)
+        {
+        case EBVHShapeType::Sphere:
+            Radius = Shape.HalfExtent.X;
+            BoundsHalf = FVector(Radius, Radius, Radius);
+            break;
+        case EBVHShapeType::Capsule:
+        {
+            Radius = Shape.HalfExtent.X;
+            const FVector Axis = Shape.Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f));
+            const FVector Half = Axis * std::max(0.0f, Shape.HalfExtent.Z - Radius);
+            P0 = Center - Half;
+            P1 = Center + Half;
+            BoundsHalf = FVector(std::abs(Half.X) + Radius, std::abs(Half.Y) + Radius, std::abs(Half.Z) + Radius);
+            break;
+        }
+        case EBVHShapeType::Box:
+        {
+            Box.Center = Center;
+            Box.HalfExtent = Shape.HalfExtent;
+            Box.Axes[0] = Shape.Rotation.RotateVector(FVector(1.0f, 0.0f, 0.0f));
+            Box.Axes[1] = Shape.Rotation.RotateVector(FVector(0.0f, 1.0f, 0.0f));
+            Box.Axes[2] = Shape.Rotation.RotateVector(FVector(0.0f, 0.0f, 1.0f));
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                BoundsHalf[Axis] = std::abs(Box.Axes[0][Axis]) * Box.HalfExtent.X
+                    + std::abs(Box.Axes[1][Axis]) * Box.HalfExtent.Y
+                    + std::abs(Box.Axes[2][Axis]) * Box.HalfExtent.Z;
+            }
+            break;
+        }
+        }
+    }
+
+    FAABB GetBounds() const
+    {
+        return FAABB(Center - BoundsHalf, Center + BoundsHalf);
+    }
+
+    bool Overlaps(const FAABB& Bound) const
+    {
+        switch (Type)
+        {
+        case EBVHShapeType::Sphere:
+            return Collision::Intersects(Bound, FBoundingSphere(Center, Radius));
+        case EBVHShapeType::Capsule:
+            return Collision::OverlapCapsuleAABB(P0, P1, Radius, Bound);
+        case EBVHShapeType::Box:
+            return Collision::OverlapOBBAABB(Box, Bound);
+        }
+        return false;
+    }
+
+    bool Sweep(const FVector& Dir, float MaxDistance, const FAABB& Bound, float& OutT, FVector& OutNormal, FVector& OutLocation) const
+    {
+        if (Type == EBVHShapeType::Box)
+        {
+            if (!Collision::SweepOBBAABB(Box, Dir, MaxDistance, Bound, OutT, OutNormal))
+            {
+                return false;
+            }
+
+            // 법선 반대쪽으로 가장 튀어나온 OBB 지점을 프리미티브 박스 위로 투영
+            FVector Support = Center + Dir * OutT;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                const float Sign = FVector::Dot(Box.Axes[Axis], OutNormal) > 0.0f ? -1.0f : 1.0f;
+                Support = Support + Box.Axes[Axis] * (Box.HalfExtent[Axis] * Sign);
+            }
+            OutLocation = FVector(
+                std::clamp(Support.X, Bound.Min.X, Bound.Max.X),
+                std::clamp(Support.Y, Bound.Min.Y, Bound.Max.Y),
+                std::clamp(Support.Z, Bound.Min.Z, Bound.Max.Z));
+            return true;
+        }
+
+        FVector Core;
+        if (Type == EBVHShapeType::Sphere)
+        {
+            if (!Collision::SweepSphereAABB(Center, Radius, Dir, MaxDistance, Bound, OutT))
+            {
+                return false;
+            }
+            Core = Center + Dir * OutT;
+        }
+        else
+        {
+            if (!Collision::SweepCapsuleAABB(P0, P1, Radius, Dir, MaxDistance, Bound, OutT))
+            {
+                return false;
+            }
+            const FVector Offset = Dir * OutT;
+            float SegmentT = 0.0f;
+            Collision::SegmentAABBDistanceSquared(P0 + Offset, P1 + Offset, Bound, &SegmentT);
+            Core = P0 + Offset + (P1 - P0) * SegmentT;
+        }
+
+        // 접촉 시점 형상 중심(축)에서 가장 가까운 박스 위 지점
+        OutLocation = FVector(
+            std::clamp(Core.X, Bound.Min.X, Bound.Max.X),
+            std::clamp(Core.Y, Bound.Min.Y, Bound.Max.Y),
+            std::clamp(Core.Z, Bound.Min.Z, Bound.Max.Z));
+        const FVector Delta = Core - OutLocation;
+        const float Length2 = Delta.SizeSquared();
+        OutNormal = Length2 > 1e-12f ? Delta / std::sqrt(Length2) : Dir * -1.0f;
+        return true;
+    }
+};
+
+bool FBVHierarchy::PassesShapeFilter(const FPrimitiveTraceData& Data, const FBVHShapeQuery& Query) const
+{
+    if (!Data.Owner || Data.Owner == Query.IgnoreActor)
+    {
+        return false;
+    }
+    const uint32 Channel = Data.Component->IsSimulatingPhysics() ? ECollisionGroup::Dynamic : ECollisionGroup::Ground;
+    if ((Channel & Query.ChannelMask) == 0)
+    {
+        return false;
+    }
+    if (Query.bIgnoreHiddenInEditor && Data.Owner->GetActorHiddenInEditor())
+    {
+        return false;
+    }
+    return true;
+}
+
+int32 FBVHierarchy::OverlapShapeInternal(const FBVHShapeQuery& Query, UPrimitiveComponent** OutComponents, int32 MaxResults) const
+{
+    if (Nodes.empty() || MaxResults <= 0)
+    {
+        return 0;
+    }
+
+    const FPreparedShape Shape(Query.Shape);
+    const FAABB ShapeBounds = Shape.GetBounds();
+
+    int32 Stack[MaxTraversalDepth];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    int32 NumResults = 0;
+    while (StackSize > 0)
+    {
+        const FLBVHNode& Node = Nodes[Stack[--StackSize]];
+        if (!Node.Bounds.Intersects(ShapeBounds))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                const int32 PrimitiveIndex = Node.First + i;
+                const FPrimitiveTraceData& Data = TraceData[PrimitiveIndex];
+                if (!PassesShapeFilter(Data, Query) || !Data.Bounds.Intersects(ShapeBounds) || !Shape.Overlaps(Data.Bounds))
+                {
+                    continue;
+                }
+
+                OutComponents[NumResults++] = StaticMeshComponentArray[PrimitiveIndex];
+                if (NumResults >= MaxResults)
+                {
+                    return NumResults;
+                }
+            }
+            continue;
+        }
+
+        if (StackSize + 2 > MaxTraversalDepth)
+        {
+            continue;
+        }
+        if (Node.Left >= 0) Stack[StackSize++] = Node.Left;
+        if (Node.Right >= 0) Stack[StackSize++] = Node.Right;
+    }
+    return NumResults;
+}
+
+void FBVHierarchy::SweepShapeInternal(const FBVHShapeQuery& Query, FBVHSweepHit& OutHit) const
+{
+    OutHit = FBVHSweepHit();
+    if (Nodes.empty())
+    {
+        return;
+    }
+
+    const FPreparedShape Shape(Query.Shape);
+    const FVector& Origin = Query.Shape.Center;
+    const FVector& Dir = Query.Direction;
+    const FVector InvDir(SafeInverse(Dir.X), SafeInverse(Dir.Y), SafeInverse(Dir.Z));
+    const FVector Half = Shape.BoundsHalf;
+    float BestT = std::max(Query.Distance, 0.0f);
+
+    // 노드를 형상 AABB만큼 부풀려 중심 레이로 판정 (보수적), 가까운 노드부터 방문
+    const auto EnterBound = [&](const FAABB& Bound, float& OutEntry)
+        {
+            return IntersectSlab(Origin, InvDir, Bound.Min - Half, Bound.Max + Half, BestT, OutEntry);
+        };
+
+    struct FStackEntry
+    {
+        int32 NodeIndex;
+        float Entry;
+    };
+    FStackEntry Stack[MaxTraversalDepth];
+    int32 StackSize = 0;
+
+    float RootEntry;
+    if (!EnterBound(Nodes[0].Bounds, RootEntry))
+    {
+        return;
+    }
+    Stack[StackSize++] = { 0, RootEntry };
+
+    while (StackSize > 0)
+    {
+        const FStackEntry Entry = Stack[--StackSize];
+        if (Entry.Entry > BestT)
+        {
+            continue;
+        }
+
+        const FLBVHNode& Node = Nodes[Entry.NodeIndex];
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                const int32 PrimitiveIndex = Node.First + i;
+                const FPrimitiveTraceData& Data = TraceData[PrimitiveIndex];
+                float PrimEntry;
+                if (!PassesShapeFilter(Data, Query) || !EnterBound(Data.Bounds, PrimEntry))
+                {
+                    continue;
+                }
+
+                float HitT;
+                FVector HitNormal, HitLocation;
+                if (Shape.Sweep(Dir, BestT, Data.Bounds, HitT, HitNormal, HitLocation)
+                    && (!OutHit.IsValidHit() || HitT < OutHit.Distance))
+                {
+                    BestT = HitT;
+                    OutHit.Component = StaticMeshComponentArray[PrimitiveIndex];
+                    OutHit.Distance = HitT;
+                    OutHit.Location = HitLocation;
+                    OutHit.Normal = HitNormal;
+                    OutHit.bStartPenetrating = (HitT <= 0.0f);
+                }
+            }
+            continue;
+        }
+
+        float LeftEntry = 0.0f, RightEntry = 0.0f;
+        const bool bLeft = Node.Left >= 0 && EnterBound(Nodes[Node.Left].Bounds, LeftEntry);
+        const bool bRight = Node.Right >= 0 && EnterBound(Nodes[Node.Right].Bounds, RightEntry);
+
+        if (StackSize + 2 > MaxTraversalDepth)
+        {
+            continue;
+        }
+        if (bLeft && bRight)
+        {
+            if (LeftEntry <= RightEntry)
+            {
+                Stack[StackSize++] = { Node.Right, RightEntry };
+                Stack[StackSize++] = { Node.Left, LeftEntry };
+            }
+            else
+            {
+                Stack[StackSize++] = { Node.Left, LeftEntry };
+                Stack[StackSize++] = { Node.Right, RightEntry };
+            }
+        }
+        else if (bLeft)
+        {
+            Stack[StackSize++] = { Node.Left, LeftEntry };
+        }
+        else if (bRight)
+        {
+            Stack[StackSize++] = { Node.Right, RightEntry };
+        }
+    }
+}
+
+int32 FBVHierarchy::OverlapShape(const FBVHShapeQuery& Query, UPrimitiveComponent** OutComponents, int32 MaxResults)
+{
+    if (Nodes.empty() || !OutComponents)
+    {
+        return 0;
+    }
+
+    PrepareTraceData();
+    return OverlapShapeInternal(Query, OutComponents, MaxResults);
+}
+
+bool FBVHierarchy::SweepShape(const FBVHShapeQuery& Query, OUT FBVHSweepHit& OutHit)
+{
+    OutHit = FBVHSweepHit();
+    if (Nodes.empty())
+    {
+        return false;
+    }
+
+    PrepareTraceData();
+    SweepShapeInternal(Query, OutHit);
+    return OutHit.IsValidHit();
+}
+
+void FBVHierarchy::OverlapShapeBatch(const TArray<FBVHShapeQuery>& Queries, int32 MaxResultsPerQuery,
+    OUT TArray<UPrimitiveComponent*>& OutComponents, OUT TArray<int32>& OutCounts, bool bParallel)
+{
+    const int32 NumQueries = Queries.Num();
+    MaxResultsPerQuery = std::max(0, MaxResultsPerQuery);
+    OutCounts.SetNum(NumQueries);
+    OutComponents.SetNum(NumQueries * MaxResultsPerQuery);
+    for (int32& Count : OutCounts)
+    {
+        Count = 0;
+    }
+
+    if (NumQueries == 0 || MaxResultsPerQuery == 0 || Nodes.empty())
+    {
+        return;
+    }
+
+    PrepareTraceData();
+
+    // 쿼리마다 출력 구간이 겹치지 않으므로 동기화 없이 병렬 실행
+    const auto RunQuery = [&](int32 QueryIndex)
+        {
+            OutCounts[QueryIndex] = OverlapShapeInternal(Queries[QueryIndex],
+                OutComponents.GetData() + QueryIndex * MaxResultsPerQuery, MaxResultsPerQuery);
+        };
+
+    if (bParallel)
+    {
+        ParallelFor(NumQueries, RunQuery, 16);
+    }
+    else
+    {
+        for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+        {
+            RunQuery(QueryIndex);
+        }
+    }
+}
+
+void FBVHierarchy::SweepShapeBatch(const TArray<FBVHShapeQuery>& Queries, OUT TArray<FBVHSweepHit>& OutHits, bool bParallel)
+{
+    const int32 NumQueries = Queries.Num();
+    OutHits.SetNum(NumQueries);
+    for (FBVHSweepHit& Hit : OutHits)
+    {
+        Hit = FBVHSweepHit();
+    }
+
+    if (NumQueries == 0 || Nodes.empty())
+    {
+        return;
+    }
+
+    PrepareTraceData();
+
+    const auto RunQuery = [&](int32 QueryIndex)
+        {
+            SweepShapeInternal(Queries[QueryIndex], OutHits[QueryIndex]);
+        };
+
+    if (bParallel)
+    {
+        ParallelFor(NumQueries, RunQuery, 16);
+    }
+    else
+    {
+        for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+        {
+            RunQuery(QueryIndex);
+        }
+    }
+}
@@ -6,6 +6,165 @@ class UPrimitiveComponent;
 class AActor;
 struct FOBB;
 struct FBoundingSphere;
+struct FStaticMesh;
+class FMeshBVH;
+
+/**
+ * @brief 배치 레이 쿼리 판정 방식
+ * - ClosestHit: 레이마다 가장 가까운 히트 (프로젝타일, 피킹)
+ * - AnyHit: 처음 발견한 히트에서 즉시 종료 (가시성/시야 판정)
+ */
+enum class EBVHRayQueryMode : uint8
+{
+    ClosestHit,
+    AnyHit
+};
+
+/**
+ * @brief 배치 레이/세그먼트 쿼리 한 건
+ */
+struct FBVHRayQuery
+{
+    FVector Origin;
+    FVector Direction;                                        // Normalized
+    float MaxDistance = std::numeric_limits<float>::max();    // 세그먼트 길이 (레이는 기본값 유지)
+    const AActor* IgnoreActor = nullptr;                      // 자기 자신 제외용 (시야 판정 등)
+    bool bIgnoreHiddenInEditor = true;
+    bool bUseBoundsForNonMesh = false;                        // 스태틱 메시가 아닌 프리미티브를 AABB로 판정
+
+    static FBVHRayQuery MakeRay(const FVector& InOrigin, const FVector& InDirection, const AActor* InIgnoreActor = nullptr)
+    {
+        FBVHRayQuery Query;
+        Query.Origin = InOrigin;
+        Query.Direction = InDirection.GetSafeNormal();
+        Query.IgnoreActor = InIgnoreActor;
+        return Query;
+    }
+
+    static FBVHRayQuery MakeSegment(const FVector& InStart, const FVector& InEnd, const AActor* InIgnoreActor = nullptr)
+    {
+        FBVHRayQuery Query;
+        const FVector Delta = InEnd - InStart;
+        Query.Origin = InStart;
+        Query.MaxDistance = Delta.Size();
+        Query.Direction = Query.MaxDistance > 0.0f ? Delta / Query.MaxDistance : FVector(1.0f, 0.0f, 0.0f);
+        Query.IgnoreActor = InIgnoreActor;
+        return Query;
+    }
+};
+
+/**
+ * @brief 배치 레이 쿼리 결과 한 건 (입력 쿼리와 같은 인덱스)
+ */
+struct FBVHRayHit
+{
+    UPrimitiveComponent* Component = nullptr;
+    float Distance = std::numeric_limits<float>::max();       // 월드 공간 거리
+    int32 TriangleIndex = INDEX_NONE;                         // AABB 판정으로 맞은 경우 INDEX_NONE
+    FVector Location;
+    FVector Normal;                                           // 맞은 면의 월드 법선 (레이 쪽을 향하도록 뒤집음)
+
+    bool IsValidHit() const { return Component != nullptr; }
+};
+
+/**
+ * @brief 엔진 BVH 형상 쿼리용 충돌 형상 (UE의 FCollisionShape 대응)
+ * - Sphere: HalfExtent.X = 반지름
+ * - Capsule: HalfExtent.X = 반지름, HalfExtent.Z = 반구를 포함한 절반 높이 (축은 Rotation 기준 로컬 Z)
+ * - Box: HalfExtent = 로컬 절반 크기 (Rotation으로 회전된 OBB)
+ */
+enum class EBVHShapeType : uint8
+{
+    Sphere,
+    Capsule,
+    Box
+};
+
+struct FBVHCollisionShape
+{
+    EBVHShapeType Type = EBVHShapeType::Sphere;
+    FVector Center;
+    FQuat Rotation;
+    FVector HalfExtent;
+
+    static FBVHCollisionShape MakeSphere(const FVector& InCenter, float InRadius)
+    {
+        FBVHCollisionShape Shape;
+        Shape.Type = EBVHShapeType::Sphere;
+        Shape.Center = InCenter;
+        Shape.HalfExtent = FVector(InRadius, InRadius, InRadius);
+        return Shape;
+    }
+
+    static FBVHCollisionShape MakeCapsule(const FVector& InCenter, float InRadius, float InHalfHeight, const FQuat& InRotation = FQuat::Identity())
+    {
+        FBVHCollisionShape Shape;
+        Shape.Type = EBVHShapeType::Capsule;
+        Shape.Center = InCenter;
+        Shape.Rotation = InRotation;
+        Shape.HalfExtent = FVector(InRadius, InRadius, std::max(InHalfHeight, InRadius));
+        return Shape;
+    }
+
+    static FBVHCollisionShape MakeBox(const FVector& InCenter, const FVector& InHalfExtent, const FQuat& InRotation = FQuat::Identity())
+    {
+        FBVHCollisionShape Shape;
+        Shape.Type = EBVHShapeType::Box;
+        Shape.Center = InCenter;
+        Shape.Rotation = InRotation;
+        Shape.HalfExtent = InHalfExtent;
+        return Shape;
+    }
+};
+
+/**
+ * @brief 형상 오버랩/스윕 쿼리 한 건
+ * @details 프리미티브는 리빌드 시점의 월드 AABB로 판정한다 (트리거/AI 감지 등 브로드 페이즈 용도).
+ * 채널은 PhysX 필터와 같은 ECollisionGroup 값을 쓴다 (쿼리 시점에 물리 시뮬레이션 중이면 Dynamic, 아니면 Ground).
+ */
+struct FBVHShapeQuery
+{
+    FBVHCollisionShape Shape;
+    FVector Direction;                                        // 스윕 방향 (Normalized), 오버랩에서는 무시
+    float Distance = 0.0f;                                    // 스윕 거리
+    uint32 ChannelMask = 0xFFFFFFFFu;                         // ECollisionGroup 마스크
+    const AActor* IgnoreActor = nullptr;                      // 자기 자신 제외용
+    bool bIgnoreHiddenInEditor = true;
+
+    static FBVHShapeQuery MakeOverlap(const FBVHCollisionShape& InShape, const AActor* InIgnoreActor = nullptr)
+    {
+        FBVHShapeQuery Query;
+        Query.Shape = InShape;
+        Query.IgnoreActor = InIgnoreActor;
+        return Query;
+    }
+
+    // InShape.Center를 시작 위치로 보고 End까지 이동
+    static FBVHShapeQuery MakeSweep(const FBVHCollisionShape& InShape, const FVector& End, const AActor* InIgnoreActor = nullptr)
+    {
+        FBVHShapeQuery Query;
+        const FVector Delta = End - InShape.Center;
+        Query.Shape = InShape;
+        Query.Distance = Delta.Size();
+        Query.Direction = Query.Distance > 0.0f ? Delta / Query.Distance : FVector(1.0f, 0.0f, 0.0f);
+        Query.IgnoreActor = InIgnoreActor;
+        return Query;
+    }
+};
+
+/**
+ * @brief 스윕 결과 한 건 (배치 쿼리에서는 입력 쿼리와 같은 인덱스)
+ */
+struct FBVHSweepHit
+{
+    UPrimitiveComponent* Component = nullptr;
+    float Distance = std::numeric_limits<float>::max();       // 첫 접촉까지의 이동 거리
+    FVector Location;                                         // 접촉 지점 (프리미티브 AABB 위)
+    FVector Normal;                                           // 접촉면 법선 (프리미티브 -> 형상 방향)
+    bool bStartPenetrating = false;                           // 시작 위치에서 이미 겹쳐 있었는지
+
+    bool IsValidHit() const { return Component != nullptr; }
+};
 
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
@@ -32,12 +191,31 @@ public:
 
     void FlushRebuild();
 
+    // BVH에 등록된 컴포넌트인지 (쿼리 결과에 없으면 범위 밖이라고 믿어도 되는지 판단할 때 사용)
+    bool Contains(UPrimitiveComponent* InComponent) const { return StaticMeshComponentBounds.Contains(InComponent); }
+
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
+
+    // 여러 레이를 한 번에 처리 (공간적으로 가까운 레이끼리 패킷으로 묶어 순회, 패킷 단위로 워커 병렬 실행)
+    // 게임 스레드에서만 호출할 것 (내부 스크래치 버퍼 재사용)
+    void QueryRayBatch(const TArray<FBVHRayQuery>& Queries, OUT TArray<FBVHRayHit>& OutHits,
+        EBVHRayQueryMode Mode = EBVHRayQueryMode::ClosestHit, bool bParallel = true);
     void QueryFrustum(const FFrustum& InFrustum);
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
+    // 형상 오버랩: 호출자가 준 버퍼에 최대 MaxResults개까지 기록하고 기록한 개수 반환 (힙 할당 없음)
+    int32 OverlapShape(const FBVHShapeQuery& Query, UPrimitiveComponent** OutComponents, int32 MaxResults);
+    // 형상 스윕: 가장 먼저 닿는 프리미티브
+    bool SweepShape(const FBVHShapeQuery& Query, OUT FBVHSweepHit& OutHit);
+
+    // 배치 형태: 쿼리 i의 결과는 OutComponents[i * MaxResultsPerQuery]부터 OutCounts[i]개
+    // 출력 배열을 재사용하면 정상 상태에서 할당이 일어나지 않음, 게임 스레드에서만 호출할 것
+    void OverlapShapeBatch(const TArray<FBVHShapeQuery>& Queries, int32 MaxResultsPerQuery,
+        OUT TArray<UPrimitiveComponent*>& OutComponents, OUT TArray<int32>& OutCounts, bool bParallel = true);
+    void SweepShapeBatch(const TArray<FBVHShapeQuery>& Queries, OUT TArray<FBVHSweepHit>& OutHits, bool bParallel = true);
+
     void DebugDraw(URenderer* Renderer) const;
 
     // Debug/Stats
@@ -63,6 +241,33 @@ private:
     };
     void BuildLBVH();
 
+    // === Batch ray query data ===
+    // 리빌드 시점의 프리미티브별 판정 데이터 (StaticMeshComponentArray와 같은 인덱스)
+    // 채널(물리 시뮬레이션 여부)은 리빌드 없이 바뀌므로 숨김 여부처럼 쿼리 시점에 Component에서 읽음
+    struct FPrimitiveTraceData
+    {
+        FAABB Bounds;
+        UPrimitiveComponent* Component = nullptr;
+        AActor* Owner = nullptr;
+        const FMeshBVH* MeshBVH = nullptr;
+        const FStaticMesh* Mesh = nullptr;
+        FMatrix WorldToLocal;
+    };
+    struct FRayPacket;
+
+    void PrepareTraceData();
+    void TraceRayPacket(const TArray<FBVHRayQuery>& Queries, const int32* QueryIndices, int32 Count,
+        EBVHRayQueryMode Mode, TArray<FBVHRayHit>& OutHits) const;
+    bool TracePrimitive(int32 PrimitiveIndex, const FBVHRayQuery& Query, float EntryT, float MaxT, bool bAnyHit,
+        float& OutT, int32& OutTriangleIndex) const;
+    FVector ComputeHitNormal(int32 PrimitiveIndex, const FBVHRayQuery& Query, int32 TriangleIndex, const FVector& HitLocation) const;
+
+    // === Shape query ===
+    struct FPreparedShape;
+    bool PassesShapeFilter(const FPrimitiveTraceData& Data, const FBVHShapeQuery& Query) const;
+    int32 OverlapShapeInternal(const FBVHShapeQuery& Query, UPrimitiveComponent** OutComponents, int32 MaxResults) const;
+    void SweepShapeInternal(const FBVHShapeQuery& Query, FBVHSweepHit& OutHit) const;
+
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
     TArray<UPrimitiveComponent*> QueryIntersectedComponentsGeneric(const BoundType& InBound
@@ -83,4 +288,8 @@ private:
     TArray<FLBVHNode> Nodes;
 
     bool bPendingRebuild = false;
+
+    TArray<FPrimitiveTraceData> TraceData;
+    bool bTraceDataDirty = true;
+    TArray<std::pair<uint64, int32>> RayOrderScratch;
 };
@@ -97,6 +97,132 @@ bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
 
 	return false;
 }
+
+namespace
+{
+	// 역방향 벡터를 미리 계산한 슬랩 테스트 (배치 쿼리 전용, const 경로)
+	inline bool RaySlab(const FVector& Origin, const FVector& InvDir, const FAABB& Box, float MaxT, float& OutEntry)
+	{
+		float TMin = 0.0f;
+		float TMax = MaxT;
+		for (int Axis = 0; Axis < 3; ++Axis)
+		{
+			float T1 = (Box.Min[Axis] - Origin[Axis]) * InvDir[Axis];
+			float T2 = (Box.Max[Axis] - Origin[Axis]) * InvDir[Axis];
+			if (T1 > T2) std::swap(T1, T2);
+			TMin = T1 > TMin ? T1 : TMin;
+			TMax = T2 < TMax ? T2 : TMax;
+			if (TMin > TMax) return false;
+		}
+		OutEntry = TMin;
+		return true;
+	}
+}
+
+bool FMeshBVH::IntersectRayClosest(const FRay& InLocalRay,
+	const TArray<FNormalVertex>& InVertices,
+	const TArray<uint32>& InIndices,
+	float InMaxDistance,
+	bool bAnyHit,
+	float& OutHitDistance,
+	int32& OutTriangleIndex) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	// 축에 평행한 레이는 큰 값으로 대체 (0 * inf = NaN 방지)
+	const auto SafeInv = [](float V) { return std::abs(V) > 1e-8f ? 1.0f / V : (V >= 0.0f ? 1e30f : -1e30f); };
+	const FVector InvDir(SafeInv(InLocalRay.Direction.X), SafeInv(InLocalRay.Direction.Y), SafeInv(InLocalRay.Direction.Z));
+
+	float BestT = InMaxDistance;
+	int32 BestTriangle = INDEX_NONE;
+
+	float RootEntry;
+	if (!RaySlab(InLocalRay.Origin, InvDir, Nodes[0].Bounds, BestT, RootEntry))
+	{
+		return false;
+	}
+
+	// 중간값 분할이라 깊이는 log2(삼각형 수)를 넘지 않는다
+	constexpr int32 MaxStackDepth = 64;
+	FStackItem Stack[MaxStackDepth];
+	int32 StackSize = 0;
+	Stack[StackSize++] = { 0, RootEntry };
+
+	while (StackSize > 0)
+	{
+		const FStackItem Current = Stack[--StackSize];
+		if (Current.EntryDistance > BestT)
+		{
+			continue;
+		}
+
+		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
+		if (Node.IsLeaf())
+		{
+			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			{
+				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
+				const FVector& A = InVertices[InIndices[3 * TriangleID + 0]].pos;
+				const FVector& B = InVertices[InIndices[3 * TriangleID + 1]].pos;
+				const FVector& C = InVertices[InIndices[3 * TriangleID + 2]].pos;
+
+				float HitT = 0.0f;
+				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT) && HitT < BestT)
+				{
+					BestT = HitT;
+					BestTriangle = static_cast<int32>(TriangleID);
+					if (bAnyHit)
+					{
+						OutHitDistance = BestT;
+						OutTriangleIndex = BestTriangle;
+						return true;
+					}
+				}
+			}
+			continue;
+		}
+
+		float LeftEntry = 0.0f, RightEntry = 0.0f;
+		const bool bHitLeft = Node.Left >= 0 && RaySlab(InLocalRay.Origin, InvDir, Nodes[Node.Left].Bounds, BestT, LeftEntry);
+		const bool bHitRight = Node.Right >= 0 && RaySlab(InLocalRay.Origin, InvDir, Nodes[Node.Right].Bounds, BestT, RightEntry);
+
+		// 가까운 자식을 나중에 넣어 먼저 꺼내도록 한다
+		if (bHitLeft && bHitRight && StackSize + 2 <= MaxStackDepth)
+		{
+			if (LeftEntry < RightEntry)
+			{
+				Stack[StackSize++] = { Node.Right, RightEntry };
+				Stack[StackSize++] = { Node.Left, LeftEntry };
+			}
+			else
+			{
+				Stack[StackSize++] = { Node.Left, LeftEntry };
+				Stack[StackSize++] = { Node.Right, RightEntry };
+			}
+		}
+		else if (bHitLeft && StackSize < MaxStackDepth)
+		{
+			Stack[StackSize++] = { Node.Left, LeftEntry };
+		}
+		else if (bHitRight && StackSize < MaxStackDepth)
+		{
+			Stack[StackSize++] = { Node.Right, RightEntry };
+		}
+	}
+
+	if (BestTriangle == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutHitDistance = BestT;
+	OutTriangleIndex = BestTriangle;
+	return true;
+}
+
 //bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
 //{
 //	if (Nodes.Num() == 0)
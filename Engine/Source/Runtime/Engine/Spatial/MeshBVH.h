@@ -25,6 +25,11 @@ public:
 
 	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
 
+	// 배치 쿼리용: MaxDistance 이내에서 가장 가까운(bAnyHit이면 아무) 삼각형을 찾고 삼각형 번호까지 반환
+	// 힙 대신 고정 크기 스택을 사용하므로 여러 워커 스레드에서 동시에 호출해도 할당이 없다.
+	bool IntersectRayClosest(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices,
+		float InMaxDistance, bool bAnyHit, float& OutHitDistance, int32& OutTriangleIndex) const;
+
 
 private:
 	// Helper 함수들
@@ -1,6 +1,10 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
 #include "Frustum.h"
+#include "VertexData.h"
+#include "OcclusionStats.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
 
 // NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
 // static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
@@ -225,4 +229,673 @@ void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>
 		LastState[id] = occluded ? 0 : 1;
 		OutVisibleFlags[id] = occluded ? 0 : 1;
 	}
-}
\ No newline at end of file
+}
+
+// ===== Masked(Hierarchical) depth buffer =====
+
+namespace
+{
+	// 깊이 버퍼 가로 해상도 (세로는 뷰 종횡비로 결정)
+	constexpr int OcclusionBufferWidth = 320;
+	constexpr int OcclusionBufferMaxHeight = 512;
+
+	inline float HorizontalMin(__m128 V)
+	{
+		V = _mm_min_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		V = _mm_min_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(V);
+	}
+
+	inline float HorizontalMax(__m128 V)
+	{
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(V);
+	}
+
+	// 행벡터 변환: (x, y, z, 1) * M
+	inline __m128 TransformPointSIMD(const FVector& P, const FMatrix& M)
+	{
+		__m128 R = _mm_mul_ps(_mm_set1_ps(P.X), M.Rows[0]);
+		R = _mm_add_ps(R, _mm_mul_ps(_mm_set1_ps(P.Y), M.Rows[1]));
+		R = _mm_add_ps(R, _mm_mul_ps(_mm_set1_ps(P.Z), M.Rows[2]));
+		return _mm_add_ps(R, M.Rows[3]);
+	}
+
+	// 클립 공간 삼각형을 근평면(z >= 0, D3D)으로 클리핑 (Sutherland-Hodgman, 결과 최대 4정점)
+	int ClipTriangleNear(const FVector4 In[3], FVector4 Out[4])
+	{
+		int Count = 0;
+		for (int i = 0; i < 3; ++i)
+		{
+			const FVector4& A = In[i];
+			const FVector4& B = In[(i + 1) % 3];
+			const bool bAInside = A.Z >= 0.0f;
+			const bool bBInside = B.Z >= 0.0f;
+
+			if (bAInside)
+			{
+				Out[Count++] = A;
+			}
+			if (bAInside != bBInside)
+			{
+				const float T = A.Z / (A.Z - B.Z);
+				Out[Count++] = FVector4(
+					A.X + (B.X - A.X) * T,
+					A.Y + (B.Y - A.Y) * T,
+					0.0f,
+					A.W + (B.W - A.W) * T);
+			}
+		}
+		return Count;
+	}
+
+	// 화면 공간 정점 3개로 엣지 함수/깊이 평면 셋업, 픽셀 중심을 하나도 덮지 않으면 false
+	bool SetupScreenTriangle(float X0, float Y0, float Z0, float X1, float Y1, float Z1, float X2, float Y2, float Z2,
+	                         int GridW, int GridH, FOccluderTriangle& Out)
+	{
+		float Area = (X1 - X0) * (Y2 - Y0) - (X2 - X0) * (Y1 - Y0);
+		if (std::fabs(Area) < 1e-6f)
+		{
+			return false;
+		}
+
+		// 감김 방향과 무관하게 내부가 E >= 0 이 되도록 정렬 (오클루더는 양면 모두 그림)
+		if (Area < 0.0f)
+		{
+			std::swap(X1, X2);
+			std::swap(Y1, Y2);
+			std::swap(Z1, Z2);
+			Area = -Area;
+		}
+
+		// 먼 평면 밖 삼각형은 깊이 버퍼에 영향 없음
+		if (std::min(Z0, std::min(Z1, Z2)) > 1.0f)
+		{
+			return false;
+		}
+
+		// 픽셀 중심 (px + 0.5)이 들어오는 범위
+		Out.MinPX = std::max(0, int(std::ceil(std::min(X0, std::min(X1, X2)) - 0.5f)));
+		Out.MinPY = std::max(0, int(std::ceil(std::min(Y0, std::min(Y1, Y2)) - 0.5f)));
+		Out.MaxPX = std::min(GridW - 1, int(std::floor(std::max(X0, std::max(X1, X2)) - 0.5f)));
+		Out.MaxPY = std::min(GridH - 1, int(std::floor(std::max(Y0, std::max(Y1, Y2)) - 0.5f)));
+		if (Out.MinPX > Out.MaxPX || Out.MinPY > Out.MaxPY)
+		{
+			return false;
+		}
+
+		const float Xs[3] = { X0, X1, X2 };
+		const float Ys[3] = { Y0, Y1, Y2 };
+		for (int Edge = 0; Edge < 3; ++Edge)
+		{
+			const int Next = (Edge + 1) % 3;
+			Out.A[Edge] = Ys[Edge] - Ys[Next];
+			Out.B[Edge] = Xs[Next] - Xs[Edge];
+			Out.C[Edge] = -(Out.A[Edge] * Xs[Edge] + Out.B[Edge] * Ys[Edge]);
+		}
+
+		// NDC z/w는 화면 공간에서 선형이므로 평면식으로 보간
+		const float InvArea = 1.0f / Area;
+		Out.DzDx = ((Z1 - Z0) * (Y2 - Y0) - (Z2 - Z0) * (Y1 - Y0)) * InvArea;
+		Out.DzDy = ((Z2 - Z0) * (X1 - X0) - (Z1 - Z0) * (X2 - X0)) * InvArea;
+		Out.ZC = Z0 - Out.DzDx * X0 - Out.DzDy * Y0;
+		return true;
+	}
+
+	// 빈 크기 (가로는 4픽셀 정렬 → 한 SIMD 묶음이 두 빈에 걸치지 않음)
+	void GetBinSize(int GridW, int GridH, int NumBinsX, int NumBinsY, int& OutBinW, int& OutBinH)
+	{
+		OutBinW = ((GridW + NumBinsX - 1) / NumBinsX + 3) & ~3;
+		OutBinH = (GridH + NumBinsY - 1) / NumBinsY;
+	}
+}
+
+void FOcclusionGrid::AllocateLevels()
+{
+	BuildLevels.clear();
+	LevelWidths.clear();
+	LevelHeights.clear();
+
+	int W = Width, H = Height;
+	LevelWidths.push_back(W);
+	LevelHeights.push_back(H);
+	while (W > 1 || H > 1)
+	{
+		// 올림 분할: 홀수 크기에서도 마지막 행/열이 상위 레벨에서 누락되지 않음
+		W = (W + 1) >> 1;
+		H = (H + 1) >> 1;
+		LevelWidths.push_back(W);
+		LevelHeights.push_back(H);
+		BuildLevels.emplace_back(size_t(W) * H, 1.0f);
+	}
+}
+
+void FOcclusionGrid::BuildHZB()
+{
+	for (int Mip = 1; Mip < GetNumLevels(); ++Mip)
+	{
+		const TArray<float>& Src = GetLevel(Mip - 1);
+		const int SW = LevelWidths[Mip - 1];
+		const int SH = LevelHeights[Mip - 1];
+
+		TArray<float>& Dst = BuildLevels[Mip - 1];
+		const int DW = LevelWidths[Mip];
+		const int DH = LevelHeights[Mip];
+
+		for (int y = 0; y < DH; ++y)
+		{
+			for (int x = 0; x < DW; ++x)
+			{
+				const int sx = x * 2, sy = y * 2;
+				const float a = SampleSafe(Src, SW, SH, sx + 0, sy + 0);
+				const float b = SampleSafe(Src, SW, SH, sx + 1, sy + 0);
+				const float c = SampleSafe(Src, SW, SH, sx + 0, sy + 1);
+				const float d = SampleSafe(Src, SW, SH, sx + 1, sy + 1);
+				Dst[size_t(y) * DW + x] = std::max(std::max(a, b), std::max(c, d));
+			}
+		}
+	}
+}
+
+bool FOcclusionGrid::IsRectOccluded(int MinPX, int MinPY, int MaxPX, int MaxPY, float MinZ) const
+{
+	MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
+	MaxPX = std::min(Width - 1, MaxPX); MaxPY = std::min(Height - 1, MaxPY);
+	if (MinPX > MaxPX || MinPY > MaxPY)
+	{
+		return false;
+	}
+
+	// 사각형이 2x2 텍셀 이하로 들어오는 가장 낮은 레벨 선택
+	int Mip = 0;
+	while (Mip < GetNumLevels() - 1 &&
+	       (((MaxPX >> Mip) - (MinPX >> Mip)) > 1 || ((MaxPY >> Mip) - (MinPY >> Mip)) > 1))
+	{
+		++Mip;
+	}
+
+	// 거친 레벨에서 실패하면 한 단계 아래(최대 4x4 텍셀)에서 재확인
+	for (int Level = Mip; Level >= std::max(0, Mip - 1); --Level)
+	{
+		const TArray<float>& L = GetLevel(Level);
+		const int W = LevelWidths[Level];
+		bool bOccluded = true;
+		for (int ty = MinPY >> Level; ty <= (MaxPY >> Level) && bOccluded; ++ty)
+		{
+			const float* Row = &L[size_t(ty) * W];
+			for (int tx = MinPX >> Level; tx <= (MaxPX >> Level); ++tx)
+			{
+				// MAX 피라미드: 텍셀 안의 가장 먼 오클루더 깊이도 오클루디보다 가까워야 가림
+				if (Row[tx] >= MinZ)
+				{
+					bOccluded = false;
+					break;
+				}
+			}
+		}
+		if (bOccluded)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FOcclusionGrid::RasterizeTriangle(const FOccluderTriangle& Tri, int BinMinX, int BinMinY, int BinMaxX, int BinMaxY)
+{
+	const int MinX = std::max(Tri.MinPX, BinMinX) & ~3;   // 빈 경계가 4정렬이므로 빈 밖으로 나가지 않음
+	const int MaxX = std::min(Tri.MaxPX, BinMaxX);
+	const int MinY = std::max(Tri.MinPY, BinMinY);
+	const int MaxY = std::min(Tri.MaxPY, BinMaxY);
+	if (MinX > MaxX || MinY > MaxY)
+	{
+		return;
+	}
+
+	const __m128 LaneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 A0 = _mm_set1_ps(Tri.A[0]), A1 = _mm_set1_ps(Tri.A[1]), A2 = _mm_set1_ps(Tri.A[2]);
+	const __m128 DzDx = _mm_set1_ps(Tri.DzDx);
+
+	for (int y = MinY; y <= MaxY; ++y)
+	{
+		const float Py = float(y) + 0.5f;
+		const __m128 RowE0 = _mm_set1_ps(Tri.B[0] * Py + Tri.C[0]);
+		const __m128 RowE1 = _mm_set1_ps(Tri.B[1] * Py + Tri.C[1]);
+		const __m128 RowE2 = _mm_set1_ps(Tri.B[2] * Py + Tri.C[2]);
+		const __m128 RowZ = _mm_set1_ps(Tri.ZC + Tri.DzDy * Py);
+
+		float* Row = &Depth[size_t(y) * Width];
+		for (int x = MinX; x <= MaxX; x += 4)
+		{
+			const __m128 Px = _mm_add_ps(_mm_set1_ps(float(x)), LaneOffset);
+
+			const __m128 E0 = _mm_add_ps(_mm_mul_ps(A0, Px), RowE0);
+			const __m128 E1 = _mm_add_ps(_mm_mul_ps(A1, Px), RowE1);
+			const __m128 E2 = _mm_add_ps(_mm_mul_ps(A2, Px), RowE2);
+			const __m128 Inside = _mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_and_ps(_mm_cmpge_ps(E1, Zero), _mm_cmpge_ps(E2, Zero)));
+			if (_mm_movemask_ps(Inside) == 0)
+			{
+				continue;
+			}
+
+			const __m128 Z = _mm_add_ps(_mm_mul_ps(DzDx, Px), RowZ);
+			const __m128 Old = _mm_loadu_ps(Row + x);
+			const __m128 New = _mm_min_ps(Old, Z);
+			_mm_storeu_ps(Row + x, _mm_or_ps(_mm_and_ps(Inside, New), _mm_andnot_ps(Inside, Old)));
+		}
+	}
+}
+
+void FOcclusionCullingManagerCPU::ProjectAABB(const FAABB& Bound, const FMatrix& ViewProj, float GridW, float GridH, FOccludeeRect& OutRect)
+{
+	OutRect.bCrossesNear = false;
+	OutRect.bOffscreen = false;
+
+	// 축별 항을 미리 계산해 두면 8코너는 덧셈만으로 구성된다
+	const __m128 XMin = _mm_mul_ps(_mm_set1_ps(Bound.Min.X), ViewProj.Rows[0]);
+	const __m128 XMax = _mm_mul_ps(_mm_set1_ps(Bound.Max.X), ViewProj.Rows[0]);
+	const __m128 YMin = _mm_mul_ps(_mm_set1_ps(Bound.Min.Y), ViewProj.Rows[1]);
+	const __m128 YMax = _mm_mul_ps(_mm_set1_ps(Bound.Max.Y), ViewProj.Rows[1]);
+	const __m128 ZMin = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Bound.Min.Z), ViewProj.Rows[2]), ViewProj.Rows[3]);
+	const __m128 ZMax = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Bound.Max.Z), ViewProj.Rows[2]), ViewProj.Rows[3]);
+
+	__m128 Corners[8] = {
+		_mm_add_ps(_mm_add_ps(XMin, YMin), ZMin), _mm_add_ps(_mm_add_ps(XMax, YMin), ZMin),
+		_mm_add_ps(_mm_add_ps(XMin, YMax), ZMin), _mm_add_ps(_mm_add_ps(XMax, YMax), ZMin),
+		_mm_add_ps(_mm_add_ps(XMin, YMin), ZMax), _mm_add_ps(_mm_add_ps(XMax, YMin), ZMax),
+		_mm_add_ps(_mm_add_ps(XMin, YMax), ZMax), _mm_add_ps(_mm_add_ps(XMax, YMax), ZMax),
+	};
+
+	// AoS → SoA (4코너씩): X, Y, Z, W
+	_MM_TRANSPOSE4_PS(Corners[0], Corners[1], Corners[2], Corners[3]);
+	_MM_TRANSPOSE4_PS(Corners[4], Corners[5], Corners[6], Corners[7]);
+
+	const __m128 MinW = _mm_min_ps(Corners[3], Corners[7]);
+	const __m128 MaxW = _mm_max_ps(Corners[3], Corners[7]);
+	const float Epsilon = 1e-4f;
+	if (HorizontalMax(MaxW) <= Epsilon)
+	{
+		OutRect.bOffscreen = true;   // 전부 카메라 뒤
+		return;
+	}
+	if (HorizontalMin(MinW) <= Epsilon)
+	{
+		OutRect.bCrossesNear = true; // 투영 불가, 보수적으로 보임 처리
+		return;
+	}
+
+	const __m128 InvW0 = _mm_div_ps(_mm_set1_ps(1.0f), Corners[3]);
+	const __m128 InvW1 = _mm_div_ps(_mm_set1_ps(1.0f), Corners[7]);
+	const __m128 NdcX0 = _mm_mul_ps(Corners[0], InvW0), NdcX1 = _mm_mul_ps(Corners[4], InvW1);
+	const __m128 NdcY0 = _mm_mul_ps(Corners[1], InvW0), NdcY1 = _mm_mul_ps(Corners[5], InvW1);
+	const __m128 NdcZ0 = _mm_mul_ps(Corners[2], InvW0), NdcZ1 = _mm_mul_ps(Corners[6], InvW1);
+
+	const float MinNdcX = HorizontalMin(_mm_min_ps(NdcX0, NdcX1));
+	const float MaxNdcX = HorizontalMax(_mm_max_ps(NdcX0, NdcX1));
+	const float MinNdcY = HorizontalMin(_mm_min_ps(NdcY0, NdcY1));
+	const float MaxNdcY = HorizontalMax(_mm_max_ps(NdcY0, NdcY1));
+	const float MinNdcZ = HorizontalMin(_mm_min_ps(NdcZ0, NdcZ1));
+	const float MaxNdcZ = HorizontalMax(_mm_max_ps(NdcZ0, NdcZ1));
+
+	// NDC → 픽셀 (화면 Y는 아래로 증가)
+	OutRect.MinX = (MinNdcX * 0.5f + 0.5f) * GridW;
+	OutRect.MaxX = (MaxNdcX * 0.5f + 0.5f) * GridW;
+	OutRect.MinY = (0.5f - MaxNdcY * 0.5f) * GridH;
+	OutRect.MaxY = (0.5f - MinNdcY * 0.5f) * GridH;
+	OutRect.MinZ = MinNdcZ;
+
+	if (OutRect.MaxX < 0.0f || OutRect.MaxY < 0.0f || OutRect.MinX > GridW || OutRect.MinY > GridH ||
+	    MaxNdcZ < 0.0f || MinNdcZ > 1.0f)
+	{
+		OutRect.bOffscreen = true;
+	}
+}
+
+void FOcclusionCullingManagerCPU::ComputeBinRect(int BinIndex, int& OutMinX, int& OutMinY, int& OutMaxX, int& OutMaxY) const
+{
+	int BinW, BinH;
+	GetBinSize(Grid.GetWidth(), Grid.GetHeight(), NumBinsX, NumBinsY, BinW, BinH);
+
+	const int BinX = BinIndex % NumBinsX;
+	const int BinY = BinIndex / NumBinsX;
+	OutMinX = BinX * BinW;
+	OutMinY = BinY * BinH;
+	OutMaxX = std::min(Grid.GetWidth(), OutMinX + BinW) - 1;
+	OutMaxY = std::min(Grid.GetHeight(), OutMinY + BinH) - 1;
+}
+
+void FOcclusionCullingManagerCPU::SetupOccluderTriangles(const FOccluderMeshDesc& Occluder, const FMatrix& ViewProj, int32 ThreadIndex)
+{
+	FThreadTriangleBuffer& Buffer = ThreadBuffers[ThreadIndex];
+
+	const FMatrix WorldViewProj = Occluder.WorldMatrix * ViewProj;
+
+	// 1) 정점 → 클립 공간 (SSE)
+	Buffer.ClipVertices.SetNum(static_cast<int32>(Occluder.NumVertices));
+	for (uint32 i = 0; i < Occluder.NumVertices; ++i)
+	{
+		Buffer.ClipVertices[i].SimdData = TransformPointSIMD(Occluder.Vertices[i].pos, WorldViewProj);
+	}
+
+	const int GridW = Grid.GetWidth();
+	const int GridH = Grid.GetHeight();
+	int BinW, BinH;
+	GetBinSize(GridW, GridH, NumBinsX, NumBinsY, BinW, BinH);
+
+	auto EmitTriangle = [&](const float* SX, const float* SY, const float* SZ, int I0, int I1, int I2)
+	{
+		FOccluderTriangle Tri;
+		if (!SetupScreenTriangle(SX[I0], SY[I0], SZ[I0], SX[I1], SY[I1], SZ[I1], SX[I2], SY[I2], SZ[I2], GridW, GridH, Tri))
+		{
+			return;
+		}
+
+		const uint32 TriIndex = static_cast<uint32>(Buffer.Triangles.Num());
+		Buffer.Triangles.Add(Tri);
+
+		// 삼각형이 걸치는 빈마다 등록
+		for (int BinY = Tri.MinPY / BinH; BinY <= std::min(NumBinsY - 1, Tri.MaxPY / BinH); ++BinY)
+		{
+			for (int BinX = Tri.MinPX / BinW; BinX <= std::min(NumBinsX - 1, Tri.MaxPX / BinW); ++BinX)
+			{
+				Buffer.BinTriangles[BinY * NumBinsX + BinX].Add(TriIndex);
+			}
+		}
+	};
+
+	// 2) 삼각형별 근평면 클리핑 → 화면 투영 → 셋업
+	const uint32 NumTriangles = Occluder.NumIndices / 3;
+	for (uint32 t = 0; t < NumTriangles; ++t)
+	{
+		const uint32 I0 = Occluder.Indices[t * 3 + 0];
+		const uint32 I1 = Occluder.Indices[t * 3 + 1];
+		const uint32 I2 = Occluder.Indices[t * 3 + 2];
+		if (I0 >= Occluder.NumVertices || I1 >= Occluder.NumVertices || I2 >= Occluder.NumVertices)
+		{
+			continue;
+		}
+
+		const FVector4 Clip[3] = { Buffer.ClipVertices[I0], Buffer.ClipVertices[I1], Buffer.ClipVertices[I2] };
+
+		// 세 정점이 모두 같은 화면 밖 평면 바깥이면 조기 제외
+		if ((Clip[0].X > Clip[0].W && Clip[1].X > Clip[1].W && Clip[2].X > Clip[2].W) ||
+			(Clip[0].X < -Clip[0].W && Clip[1].X < -Clip[1].W && Clip[2].X < -Clip[2].W) ||
+			(Clip[0].Y > Clip[0].W && Clip[1].Y > Clip[1].W && Clip[2].Y > Clip[2].W) ||
+			(Clip[0].Y < -Clip[0].W && Clip[1].Y < -Clip[1].W && Clip[2].Y < -Clip[2].W))
+		{
+			continue;
+		}
+
+		FVector4 Poly[4];
+		int NumPoly = 3;
+		if (Clip[0].Z < 0.0f || Clip[1].Z < 0.0f || Clip[2].Z < 0.0f)
+		{
+			NumPoly = ClipTriangleNear(Clip, Poly);
+			if (NumPoly < 3)
+			{
+				continue;
+			}
+		}
+		else
+		{
+			Poly[0] = Clip[0]; Poly[1] = Clip[1]; Poly[2] = Clip[2];
+		}
+
+		float SX[4], SY[4], SZ[4];
+		bool bValid = true;
+		for (int k = 0; k < NumPoly; ++k)
+		{
+			if (Poly[k].W <= 1e-6f)
+			{
+				bValid = false;
+				break;
+			}
+			const float InvW = 1.0f / Poly[k].W;
+			SX[k] = (Poly[k].X * InvW * 0.5f + 0.5f) * GridW;
+			SY[k] = (0.5f - Poly[k].Y * InvW * 0.5f) * GridH;
+			SZ[k] = Poly[k].Z * InvW;
+		}
+		if (!bValid)
+		{
+			continue;
+		}
+
+		// 클리핑 결과 다각형은 팬으로 분할
+		for (int k = 1; k + 1 < NumPoly; ++k)
+		{
+			EmitTriangle(SX, SY, SZ, 0, k, k + 1);
+		}
+	}
+}
+
+void FOcclusionCullingManagerCPU::CullView(const FMatrix& ViewProj, int ViewW, int ViewH,
+                                           const TArray<FAABB>& OccludeeBounds,
+                                           const TArray<FOccluderMeshDesc>& OccluderCandidates,
+                                           TArray<uint8_t>& OutVisibleFlags,
+                                           FOcclusionStats* OutStats)
+{
+	FOcclusionStats Stats;
+	FScopeCycleCounter SetupCounter;
+
+	// --- 0. 깊이 버퍼 준비 (크기가 같으면 재할당 없이 Clear) ---
+	const int DesiredW = OcclusionBufferWidth;
+	const int DesiredH = std::clamp(int(float(OcclusionBufferWidth) * float(ViewH) / float(std::max(1, ViewW))), 16, OcclusionBufferMaxHeight);
+	if (Grid.GetWidth() != DesiredW || Grid.GetHeight() != DesiredH)
+	{
+		Grid.Initialize(DesiredW, DesiredH);
+	}
+	else
+	{
+		Grid.Clear();
+	}
+
+	const int GridW = Grid.GetWidth();
+	const int GridH = Grid.GetHeight();
+	const int32 NumOccludees = OccludeeBounds.Num();
+
+	Stats.DepthBufferWidth = static_cast<uint32>(GridW);
+	Stats.DepthBufferHeight = static_cast<uint32>(GridH);
+	Stats.TotalOccludees = static_cast<uint32>(NumOccludees);
+
+	// --- 1. 오클루디 AABB 투영 (SIMD, 병렬) ---
+	OccludeeRects.SetNum(NumOccludees);
+	ParallelFor(NumOccludees, [&](int32 Index)
+	{
+		ProjectAABB(OccludeeBounds[Index], ViewProj, float(GridW), float(GridH), OccludeeRects[Index]);
+	}, 64);
+
+	// --- 2. 오클루더 선택: 저폴리 + 화면 면적 순 ---
+	const float InvScreenArea = 1.0f / float(GridW * GridH);
+	auto GetScreenCoverage = [&](const FOccludeeRect& Rect) -> float
+	{
+		if (Rect.bCrossesNear)
+		{
+			return 1.0f; // 근평면에 걸친 큰 메시(벽 등)는 가장 유력한 오클루더
+		}
+		const float W = std::clamp(Rect.MaxX, 0.0f, float(GridW)) - std::clamp(Rect.MinX, 0.0f, float(GridW));
+		const float H = std::clamp(Rect.MaxY, 0.0f, float(GridH)) - std::clamp(Rect.MinY, 0.0f, float(GridH));
+		return std::max(0.0f, W) * std::max(0.0f, H) * InvScreenArea;
+	};
+
+	SelectedOccluders.Empty();
+	for (int32 i = 0; i < OccluderCandidates.Num(); ++i)
+	{
+		const FOccluderMeshDesc& Candidate = OccluderCandidates[i];
+		const uint32 NumTriangles = Candidate.NumIndices / 3;
+		if (NumTriangles == 0 || NumTriangles > static_cast<uint32>(Settings.MaxTrianglesPerOccluder) || !Candidate.Vertices)
+		{
+			continue;
+		}
+		if (Candidate.OccludeeIndex < 0 || Candidate.OccludeeIndex >= NumOccludees)
+		{
+			continue;
+		}
+
+		Stats.OccluderCandidates++;
+
+		const FOccludeeRect& Rect = OccludeeRects[Candidate.OccludeeIndex];
+		if (Rect.bOffscreen || GetScreenCoverage(Rect) < Settings.MinOccluderScreenArea)
+		{
+			continue;
+		}
+		SelectedOccluders.Add(i);
+	}
+
+	std::sort(SelectedOccluders.begin(), SelectedOccluders.end(), [&](int32 A, int32 B)
+	{
+		const float CoverageA = GetScreenCoverage(OccludeeRects[OccluderCandidates[A].OccludeeIndex]);
+		const float CoverageB = GetScreenCoverage(OccludeeRects[OccluderCandidates[B].OccludeeIndex]);
+		return CoverageA != CoverageB ? CoverageA > CoverageB : A < B;
+	});
+
+	// 개수 및 삼각형 예산 적용
+	int32 NumSelected = 0;
+	uint32 TriangleBudget = static_cast<uint32>(Settings.MaxOccluderTriangles);
+	for (int32 i = 0; i < SelectedOccluders.Num() && NumSelected < Settings.MaxOccluders; ++i)
+	{
+		const uint32 NumTriangles = OccluderCandidates[SelectedOccluders[i]].NumIndices / 3;
+		if (NumTriangles > TriangleBudget)
+		{
+			continue;
+		}
+		TriangleBudget -= NumTriangles;
+		Stats.OccluderTriangles += NumTriangles;
+		SelectedOccluders[NumSelected++] = SelectedOccluders[i];
+	}
+	SelectedOccluders.SetNum(NumSelected);
+	Stats.OccluderCount = static_cast<uint32>(NumSelected);
+
+	// --- 3. 삼각형 셋업 (오클루더 단위 병렬, 스레드 로컬 빈 리스트) ---
+	const int32 NumBins = NumBinsX * NumBinsY;
+	const int32 NumThreads = FTaskScheduler::Get().GetMaxConcurrency();
+	if (ThreadBuffers.Num() < NumThreads)
+	{
+		ThreadBuffers.SetNum(NumThreads);
+	}
+	for (FThreadTriangleBuffer& Buffer : ThreadBuffers)
+	{
+		Buffer.Triangles.Empty();
+		Buffer.BinTriangles.SetNum(NumBins);
+		for (TArray<uint32>& BinList : Buffer.BinTriangles)
+		{
+			BinList.Empty();
+		}
+	}
+
+	ParallelFor(NumSelected, [&](int32 Index)
+	{
+		SetupOccluderTriangles(OccluderCandidates[SelectedOccluders[Index]], ViewProj, FTaskScheduler::GetCurrentThreadIndex());
+	});
+
+	for (const FThreadTriangleBuffer& Buffer : ThreadBuffers)
+	{
+		Stats.RasterizedTriangles += static_cast<uint32>(Buffer.Triangles.Num());
+	}
+	Stats.SetupTimeMS = SetupCounter.Finish();
+
+	// --- 4. 빈 단위 래스터화 (빈끼리 픽셀이 겹치지 않으므로 락 없이 병렬) + HZB ---
+	FScopeCycleCounter RasterCounter;
+	if (Stats.RasterizedTriangles > 0)
+	{
+		ParallelFor(NumBins, [&](int32 BinIndex)
+		{
+			int BinMinX, BinMinY, BinMaxX, BinMaxY;
+			ComputeBinRect(BinIndex, BinMinX, BinMinY, BinMaxX, BinMaxY);
+			if (BinMinX > BinMaxX || BinMinY > BinMaxY)
+			{
+				return;
+			}
+
+			for (const FThreadTriangleBuffer& Buffer : ThreadBuffers)
+			{
+				for (uint32 TriIndex : Buffer.BinTriangles[BinIndex])
+				{
+					Grid.RasterizeTriangle(Buffer.Triangles[TriIndex], BinMinX, BinMinY, BinMaxX, BinMaxY);
+				}
+			}
+		});
+	}
+	Grid.BuildHZB();
+	Stats.RasterTimeMS = RasterCounter.Finish();
+
+	// --- 5. 오클루디 테스트 (병렬) ---
+	FScopeCycleCounter TestCounter;
+	bHasOccluderDepth = Stats.RasterizedTriangles > 0;
+	TestProjectedOccludees(NumOccludees, OutVisibleFlags, Stats);
+	Stats.TestTimeMS = TestCounter.Finish();
+
+	if (OutStats)
+	{
+		Stats.CalculateStats();
+		*OutStats = Stats;
+	}
+}
+
+void FOcclusionCullingManagerCPU::TestOccludees(const FMatrix& ViewProj, const TArray<FAABB>& OccludeeBounds,
+                                                TArray<uint8_t>& OutVisibleFlags, FOcclusionStats* OutStats)
+{
+	FOcclusionStats Stats;
+	FScopeCycleCounter TestCounter;
+
+	const int32 NumOccludees = OccludeeBounds.Num();
+	const float GridW = float(Grid.GetWidth());
+	const float GridH = float(Grid.GetHeight());
+
+	OccludeeRects.SetNum(NumOccludees);
+	ParallelFor(NumOccludees, [&](int32 Index)
+	{
+		ProjectAABB(OccludeeBounds[Index], ViewProj, GridW, GridH, OccludeeRects[Index]);
+	}, 64);
+
+	Stats.TotalOccludees = static_cast<uint32>(NumOccludees);
+	TestProjectedOccludees(NumOccludees, OutVisibleFlags, Stats);
+	Stats.TestTimeMS = TestCounter.Finish();
+
+	if (OutStats)
+	{
+		Stats.CalculateStats();
+		*OutStats = Stats;
+	}
+}
+
+void FOcclusionCullingManagerCPU::TestProjectedOccludees(int32 NumOccludees, TArray<uint8_t>& OutVisibleFlags, FOcclusionStats& InOutStats) const
+{
+	OutVisibleFlags.assign(size_t(NumOccludees), 1);
+	ParallelFor(NumOccludees, [&](int32 Index)
+	{
+		const FOccludeeRect& Rect = OccludeeRects[Index];
+		if (Rect.bOffscreen)
+		{
+			OutVisibleFlags[Index] = 0;
+			return;
+		}
+		if (Rect.bCrossesNear || !bHasOccluderDepth)
+		{
+			return;
+		}
+
+		// 실루엣 경계 픽셀의 부분 가림을 감안해 1픽셀 팽창
+		const int MinPX = int(std::floor(Rect.MinX)) - 1;
+		const int MinPY = int(std::floor(Rect.MinY)) - 1;
+		const int MaxPX = int(std::floor(Rect.MaxX)) + 1;
+		const int MaxPY = int(std::floor(Rect.MaxY)) + 1;
+		if (Grid.IsRectOccluded(MinPX, MinPY, MaxPX, MaxPY, Rect.MinZ - Settings.DepthBias))
+		{
+			OutVisibleFlags[Index] = 0;
+		}
+	}, 64);
+
+	for (int32 i = 0; i < NumOccludees; ++i)
+	{
+		if (OccludeeRects[i].bOffscreen)
+		{
+			InOutStats.OffscreenPrimitives++;
+		}
+		else if (OutVisibleFlags[i] == 0)
+		{
+			InOutStats.OccludedPrimitives++;
+		}
+	}
+}
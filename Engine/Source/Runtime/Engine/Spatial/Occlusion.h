@@ -4,6 +4,8 @@ struct FVector;
 struct FVector4;
 struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
 struct FAABB; // AABB
+struct FNormalVertex;
+struct FOcclusionStats;
 
 struct FCandidateDrawable
 {
@@ -24,24 +26,70 @@ struct FOcclusionRect
     uint32_t ActorIndex;
 };
 
+// 오클루더 메시 입력 (저폴리 스태틱 메시, 로컬 정점 + 월드 행렬)
+struct FOccluderMeshDesc
+{
+    const FNormalVertex* Vertices = nullptr;
+    uint32 NumVertices = 0;
+    const uint32* Indices = nullptr;
+    uint32 NumIndices = 0;
+    FMatrix WorldMatrix;
+    int32 OccludeeIndex = -1;   // 화면 크기 판정에 사용할 오클루디(AABB) 인덱스
+};
+
+// 셋업이 끝난 화면 공간 삼각형 (엣지 함수 + 깊이 평면)
+// 엣지: E(x, y) = A*x + B*y + C >= 0 이면 내부 / 깊이: Z(x, y) = ZC + DzDx*x + DzDy*y (NDC z/w)
+struct FOccluderTriangle
+{
+    float A[3], B[3], C[3];
+    float ZC, DzDx, DzDy;
+    int MinPX, MinPY, MaxPX, MaxPY;   // 화면에 클램프된 픽셀 범위 (inclusive)
+};
+
+// 오클루디 AABB의 화면 투영 결과
+struct FOccludeeRect
+{
+    float MinX, MinY, MaxX, MaxY;   // 픽셀 좌표
+    float MinZ;                     // 가장 가까운 NDC 깊이
+    bool bCrossesNear;              // 근평면에 걸쳐 있음 → 판정 불가(보임 처리)
+    bool bOffscreen;                // 화면 밖 / 카메라 뒤
+};
+
+// 오클루전 컬링 튜닝 값
+struct FOcclusionCullingSettings
+{
+    int32 MaxOccluders = 32;                // 프레임당 최대 오클루더 수
+    int32 MaxTrianglesPerOccluder = 2048;   // 이보다 무거운 메시는 오클루더로 쓰지 않음 (저폴리만)
+    int32 MaxOccluderTriangles = 32768;     // 프레임당 오클루더 삼각형 예산
+    float MinOccluderScreenArea = 0.01f;    // 화면 면적 비율이 이보다 작으면 오클루더 제외
+    float DepthBias = 1e-5f;                // 가림 판정 바이어스 (NDC)
+};
+
 // 저해상도 깊이맵 + HZB(min) - CPU 전용
 class FOcclusionGrid
 {
 public:
     void Initialize(int InWidth, int InHeight)
     {
-        Width = InWidth; Height = InHeight;
+        // SIMD 래스터라이저가 4픽셀 단위로 읽고 쓰므로 가로는 4의 배수로 맞춘다
+        Width = (std::max(4, InWidth) + 3) & ~3;
+        Height = std::max(1, InHeight);
         // 교체: 1.0f (Far)
         Depth.assign(size_t(Width * Height), 1.0f);
-        BuildLevels.clear();
+        AllocateLevels();
     }
     void Clear()
     {
-        // Clear 도 동일하게 1.0f로
+        // Clear 도 동일하게 1.0f로 (상위 레벨은 BuildHZB에서 덮어쓰므로 유지)
         std::fill(Depth.begin(), Depth.end(), 1.0f);
-        BuildLevels.clear();
     }
 
+    /**
+     * @brief 셋업된 삼각형을 빈(Bin) 영역으로 잘라 SSE로 래스터화 (픽셀 중심 샘플, min 깊이 누적)
+     * @note 빈 경계가 4픽셀 정렬이므로 서로 다른 빈을 여러 스레드가 동시에 그려도 쓰기가 겹치지 않는다.
+     */
+    void RasterizeTriangle(const FOccluderTriangle& Tri, int BinMinX, int BinMinY, int BinMaxX, int BinMaxY);
+
     /*
         왜 R.MaxZ를 쓰는데 min 누적을 하나?
 
@@ -66,32 +114,16 @@ public:
         }
     }
 
-    void BuildHZB()
-    {
-        BuildLevels.clear();
-        BuildLevels.push_back(Depth); // level 0
+    // MAX 피라미드: 레벨0은 Depth 자체, 상위 레벨은 미리 할당된 버퍼에 덮어쓴다 (프레임당 할당/복사 없음)
+    void BuildHZB();
 
-        int W = Width, H = Height;
-        while (W > 1 || H > 1)
-        {
-            int NW = std::max(1, W >> 1);
-            int NH = std::max(1, H >> 1);
-            TArray<float> Next(size_t(NW * NH), +FLT_MAX);
-
-            for (int y = 0; y < NH; ++y)
-                for (int x = 0; x < NW; ++x)
-                {
-                    int sx = x * 2, sy = y * 2;
-                    float a = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 0);
-                    float b = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 0);
-                    float c = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 1);
-                    float d = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 1);
-                    Next[size_t(y) * NW + x] = std::max(std::max(a, b), std::max(c, d));
-                }
-            BuildLevels.push_back(std::move(Next));
-            W = NW; H = NH;
-        }
-    }
+    int GetNumLevels() const { return 1 + int(BuildLevels.size()); }
+    int GetLevelWidth(int Mip) const { return LevelWidths[size_t(Mip)]; }
+    int GetLevelHeight(int Mip) const { return LevelHeights[size_t(Mip)]; }
+    const TArray<float>& GetLevel(int Mip) const { return Mip == 0 ? Depth : BuildLevels[size_t(Mip - 1)]; }
+
+    // 레벨0 픽셀 사각형(inclusive)이 전부 MinZ보다 가까운 깊이로 덮였는지 HZB로 판정
+    bool IsRectOccluded(int MinPX, int MinPY, int MaxPX, int MaxPY, float MinZ) const;
 
     int ChooseMip(float RectW01, float RectH01) const
     {
@@ -99,15 +131,15 @@ public:
         float pxH = RectH01 * Height;
         float s = std::max(pxW, pxH);
         int mip = int(std::floor(std::log2(std::max(1.0f, s))));
-        mip = std::max(0, std::min(mip, int(BuildLevels.size() - 1)));
+        mip = std::max(0, std::min(mip, GetNumLevels() - 1));
         return mip;
     }
 
     float SampleMaxRect(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
     {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        int W = std::max(1, Width >> Mip);
-        int H = std::max(1, Height >> Mip);
+        const TArray<float>& L = GetLevel(Mip);
+        int W = GetLevelWidth(Mip);
+        int H = GetLevelHeight(Mip);
 
         auto ToPx = [&](float u, float v)->std::pair<int, int> {
             int x = int(u * W + 0.5f);
@@ -135,9 +167,9 @@ public:
     // FOcclusionGrid 내부에 추가
     float SampleMaxRectAdaptive(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
     {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        const int W = std::max(1, Width >> Mip);
-        const int H = std::max(1, Height >> Mip);
+        const TArray<float>& L = GetLevel(Mip);
+        const int W = GetLevelWidth(Mip);
+        const int H = GetLevelHeight(Mip);
 
         auto ToPx = [&](float u, float v)->std::pair<int, int> {
             int x = int(u * W + 0.5f);
@@ -170,7 +202,7 @@ public:
     // FOcclusionGrid 내부에 추가 (레벨0 정밀 검사)
     bool FullyOccludedAtLevel0(float MinX01, float MinY01, float MaxX01, float MaxY01, float MinZ, float eps2) const
     {
-        const TArray<float>& L0 = BuildLevels[0];
+        const TArray<float>& L0 = Depth;
         const int W = Width, H = Height;
 
         int x0 = std::max(0, std::min(W - 1, int(MinX01 * W)));
@@ -203,6 +235,8 @@ public:
 
 
 private:
+    void AllocateLevels();
+
     static float SampleSafe(const TArray<float>& L, int W, int H, int X, int Y)
     {
         X = std::max(0, std::min(W - 1, X));
@@ -213,7 +247,9 @@ private:
 private:
     int Width = 0, Height = 0;
     TArray<float> Depth;                     // level 0
-    TArray<TArray<float>> BuildLevels;  // [0..N-1], min chain
+    TArray<TArray<float>> BuildLevels;  // [1..N-1], max chain (level0은 Depth)
+    TArray<int> LevelWidths;            // [0..N-1]
+    TArray<int> LevelHeights;           // [0..N-1]
 
 
 };
@@ -225,6 +261,37 @@ public:
     void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
     void Shutdown() {}
 
+    /**
+     * @brief 한 뷰에 대한 메시 오클루더 기반 가시성 판정
+     * @details 오클루디 AABB를 SIMD로 투영 → 화면 크기 순으로 오클루더 선택
+     *          → 삼각형 셋업(스레드 병렬) + 화면 빈 단위 래스터화(빈 병렬) → HZB → 오클루디 테스트(병렬)
+     * @param ViewProj 행벡터 기준 View * Projection
+     * @param ViewW/ViewH 뷰 크기 (깊이 버퍼 종횡비 결정)
+     * @param OccludeeBounds 테스트할 월드 AABB 목록
+     * @param OccluderCandidates 오클루더 후보 메시 (OccludeeIndex로 AABB와 연결)
+     * @param OutVisibleFlags OccludeeBounds와 같은 크기, 1 = 보임 / 0 = 가려짐 또는 화면 밖
+     * @param OutStats 통계 (선택)
+     */
+    void CullView(const FMatrix& ViewProj, int ViewW, int ViewH,
+                  const TArray<FAABB>& OccludeeBounds,
+                  const TArray<FOccluderMeshDesc>& OccluderCandidates,
+                  TArray<uint8_t>& OutVisibleFlags,
+                  FOcclusionStats* OutStats = nullptr);
+
+    /**
+     * @brief 마지막 CullView의 깊이 버퍼를 그대로 사용해 일부 AABB만 다시 판정
+     * @details 카메라가 정지한 프레임에서 이동/신규 프리미티브만 재검사할 때 사용 (ViewProj는 마지막 CullView와 같아야 함)
+     */
+    void TestOccludees(const FMatrix& ViewProj, const TArray<FAABB>& OccludeeBounds,
+                       TArray<uint8_t>& OutVisibleFlags, FOcclusionStats* OutStats = nullptr);
+
+    // 마지막 CullView에서 선택된 오클루더 (OccluderCandidates 인덱스)
+    const TArray<int32>& GetSelectedOccluders() const { return SelectedOccluders; }
+    // 마지막 CullView/TestOccludees에서 Index번 오클루디가 화면 밖으로 판정되었는지
+    bool IsOccludeeOffscreen(int32 Index) const { return OccludeeRects[Index].bOffscreen; }
+
+    FOcclusionCullingSettings& GetSettings() { return Settings; }
+
     // 1) 오클루더로 저해상도 Depth 채우기
     void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
 
@@ -237,6 +304,15 @@ public:
     const FOcclusionGrid& GetGrid() const { return Grid; }
 
 private:
+    // 8코너를 SSE로 한 번에 투영해 화면 픽셀 사각형 + 최소 깊이 계산
+    static void ProjectAABB(const FAABB& Bound, const FMatrix& ViewProj, float GridW, float GridH, FOccludeeRect& OutRect);
+
+    // 오클루더 하나의 삼각형을 근평면 클리핑 후 셋업하여 스레드 로컬 버퍼에 추가
+    void SetupOccluderTriangles(const FOccluderMeshDesc& Occluder, const FMatrix& ViewProj, int32 ThreadIndex);
+
+    // OccludeeRects[0, Num)을 현재 HZB로 판정, 통계의 Occluded/Offscreen 수 누적
+    void TestProjectedOccludees(int32 NumOccludees, TArray<uint8_t>& OutVisibleFlags, FOcclusionStats& InOutStats) const;
+
     // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
     static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
 
@@ -249,8 +325,26 @@ private:
         Out[3] = In[0] * M.M[0][3] + In[1] * M.M[1][3] + In[2] * M.M[2][3] + In[3] * M.M[3][3];
     }
 
+    // 스레드별 셋업 결과 (재사용 버퍼)
+    struct FThreadTriangleBuffer
+    {
+        TArray<FVector4> ClipVertices;
+        TArray<FOccluderTriangle> Triangles;
+        TArray<TArray<uint32>> BinTriangles;   // 빈별 Triangles 인덱스
+    };
+
+    // 빈 분할 (가로는 4픽셀 정렬)
+    static constexpr int NumBinsX = 4;
+    static constexpr int NumBinsY = 4;
+    void ComputeBinRect(int BinIndex, int& OutMinX, int& OutMinY, int& OutMaxX, int& OutMaxY) const;
+
 private:
     FOcclusionGrid Grid;
+    FOcclusionCullingSettings Settings;
+    TArray<FThreadTriangleBuffer> ThreadBuffers;
+    TArray<FOccludeeRect> OccludeeRects;
+    TArray<int32> SelectedOccluders;
+    bool bHasOccluderDepth = false;      // 마지막 CullView에서 래스터화된 삼각형이 있었는지
     TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
     TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
     TArray<uint8_t> LastState;       // 0=occluded, 1=visible
@@ -0,0 +1,268 @@
+#include "pch.h"
+#include "SpatialQueryBenchmark.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "PrimitiveComponent.h"
+#include "Actor.h"
+#include "Picking.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+#include "OBB.h"
+#include "BoundingSphere.h"
+#include "World.h"
+#include "PxPhysicsAPI.h"
+
+namespace
+{
+	// 실행마다 같은 입력을 얻기 위한 고정 시드 LCG
+	struct FBenchmarkRandom
+	{
+		uint32 State = 0x9E3779B9u;
+
+		float NextUnit()
+		{
+			State = State * 1664525u + 1013904223u;
+			return static_cast<float>(State >> 8) / static_cast<float>(1u << 24);
+		}
+
+		FVector NextPointIn(const FAABB& Box)
+		{
+			return FVector(
+				Box.Min.X + (Box.Max.X - Box.Min.X) * NextUnit(),
+				Box.Min.Y + (Box.Max.Y - Box.Min.Y) * NextUnit(),
+				Box.Min.Z + (Box.Max.Z - Box.Min.Z) * NextUnit());
+		}
+	};
+
+	// 엔진 형상과 같은 PhysX 지오메트리/포즈 (PhysX 캡슐은 X축 정렬, 반구를 뺀 절반 높이)
+	physx::PxGeometryHolder MakePxGeometry(const FBVHCollisionShape& Shape)
+	{
+		switch (Shape.Type)
+		{
+		case EBVHShapeType::Capsule:
+			return physx::PxGeometryHolder(physx::PxCapsuleGeometry(Shape.HalfExtent.X, std::max(Shape.HalfExtent.Z - Shape.HalfExtent.X, 0.001f)));
+		case EBVHShapeType::Box:
+			return physx::PxGeometryHolder(physx::PxBoxGeometry(Shape.HalfExtent.X, Shape.HalfExtent.Y, Shape.HalfExtent.Z));
+		default:
+			return physx::PxGeometryHolder(physx::PxSphereGeometry(Shape.HalfExtent.X));
+		}
+	}
+
+	physx::PxTransform MakePxPose(const FBVHCollisionShape& Shape)
+	{
+		physx::PxQuat Rotation(Shape.Rotation.X, Shape.Rotation.Y, Shape.Rotation.Z, Shape.Rotation.W);
+		if (Shape.Type == EBVHShapeType::Capsule)
+		{
+			Rotation = Rotation * physx::PxQuat(physx::PxHalfPi, physx::PxVec3(0.0f, 1.0f, 0.0f));
+		}
+		return physx::PxTransform(physx::PxVec3(Shape.Center.X, Shape.Center.Y, Shape.Center.Z), Rotation);
+	}
+}
+
+void FSpatialQueryBenchmark::RunRayBatch(UWorld* World, int32 NumRays)
+{
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || BVH->TotalNodeCount() == 0)
+	{
+		UE_LOG("[Bench] RayBatch: No BVH in current world");
+		return;
+	}
+
+	FBenchmarkRandom Random;
+	const FAABB& Box = BVH->GetBounds();
+	TArray<FBVHRayQuery> Queries;
+	Queries.Reserve(NumRays);
+	for (int32 i = 0; i < NumRays; ++i)
+	{
+		Queries.Add(FBVHRayQuery::MakeSegment(Random.NextPointIn(Box), Random.NextPointIn(Box)));
+	}
+
+	// 첫 배치 호출에서 메시 BVH 준비 비용이 측정에 섞이지 않도록 한 번 미리 실행
+	TArray<FBVHRayHit> Hits;
+	BVH->QueryRayBatch(Queries, Hits, EBVHRayQueryMode::ClosestHit, false);
+
+	// 1) 기존 단일 레이 API 반복
+	TArray<AActor*> SingleHits;
+	SingleHits.SetNum(NumRays);
+	FScopeCycleCounter SingleCounter;
+	for (int32 i = 0; i < NumRays; ++i)
+	{
+		const FRay Ray{ Queries[i].Origin, Queries[i].Direction };
+		float BestT = Queries[i].MaxDistance;
+		Partition->RayQueryClosest(Ray, SingleHits[i], BestT);
+	}
+	const double SingleMs = SingleCounter.Finish();
+
+	// 2) 배치 Closest (단일 스레드)
+	FScopeCycleCounter SerialCounter;
+	BVH->QueryRayBatch(Queries, Hits, EBVHRayQueryMode::ClosestHit, false);
+	const double SerialMs = SerialCounter.Finish();
+
+	// 3) 배치 Closest (병렬)
+	FScopeCycleCounter ParallelCounter;
+	BVH->QueryRayBatch(Queries, Hits, EBVHRayQueryMode::ClosestHit, true);
+	const double ParallelMs = ParallelCounter.Finish();
+
+	int32 NumHits = 0;
+	int32 NumAgree = 0;
+	for (int32 i = 0; i < NumRays; ++i)
+	{
+		AActor* BatchActor = Hits[i].IsValidHit() ? Hits[i].Component->GetOwner() : nullptr;
+		NumHits += BatchActor ? 1 : 0;
+		NumAgree += (BatchActor == SingleHits[i]) ? 1 : 0;
+	}
+
+	// 4) 배치 Any (병렬, 가시성 판정 용도)
+	FScopeCycleCounter AnyCounter;
+	BVH->QueryRayBatch(Queries, Hits, EBVHRayQueryMode::AnyHit, true);
+	const double AnyMs = AnyCounter.Finish();
+
+	UE_LOG("[Bench] RayBatch: %d rays, %d primitives, %d workers", NumRays, BVH->TotalActorCount(), FTaskScheduler::Get().GetWorkerCount());
+	UE_LOG("[Bench]   Single-ray loop   : %.3f ms", SingleMs);
+	UE_LOG("[Bench]   Batch closest (1T): %.3f ms", SerialMs);
+	UE_LOG("[Bench]   Batch closest (MT): %.3f ms (x%.2f vs single)", ParallelMs, ParallelMs > 0.0 ? SingleMs / ParallelMs : 0.0);
+	UE_LOG("[Bench]   Batch any     (MT): %.3f ms", AnyMs);
+	UE_LOG("[Bench]   Hits: %d, agree with single-ray: %d/%d", NumHits, NumAgree, NumRays);
+}
+
+void FSpatialQueryBenchmark::RunShapeQueries(UWorld* World, int32 NumQueries)
+{
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || BVH->TotalNodeCount() == 0)
+	{
+		UE_LOG("[Bench] ShapeQuery: No BVH in current world");
+		return;
+	}
+
+	// 구/캡슐/박스를 번갈아 생성, 크기는 월드 바운드의 2% 정도
+	FBenchmarkRandom Random;
+	const FAABB& Box = BVH->GetBounds();
+	const FVector Extent = Box.GetHalfExtent();
+	const float Scale = std::max(0.01f, std::max(Extent.X, std::max(Extent.Y, Extent.Z)) * 0.02f);
+
+	TArray<FBVHShapeQuery> Queries;
+	Queries.Reserve(NumQueries);
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FVector Start = Random.NextPointIn(Box);
+		const FVector End = Random.NextPointIn(Box);
+		FBVHCollisionShape Shape;
+		switch (i % 3)
+		{
+		case 0: Shape = FBVHCollisionShape::MakeSphere(Start, Scale); break;
+		case 1: Shape = FBVHCollisionShape::MakeCapsule(Start, Scale * 0.5f, Scale * 1.5f); break;
+		default: Shape = FBVHCollisionShape::MakeBox(Start, FVector(Scale, Scale * 0.5f, Scale * 0.75f)); break;
+		}
+		Queries.Add(FBVHShapeQuery::MakeSweep(Shape, End));
+	}
+
+	constexpr int32 MaxResultsPerQuery = 64;
+	UPrimitiveComponent* OverlapBuffer[MaxResultsPerQuery];
+	TArray<UPrimitiveComponent*> BatchComponents;
+	TArray<int32> BatchCounts;
+	TArray<FBVHSweepHit> BatchHits;
+
+	// 트레이스 데이터 준비 비용이 측정에 섞이지 않도록 한 번 미리 실행
+	BVH->OverlapShapeBatch(Queries, MaxResultsPerQuery, BatchComponents, BatchCounts, false);
+
+	// 1) 기존 API (구/박스만 해당, 쿼리마다 TArray/TSet 할당)
+	int32 LegacyHits = 0;
+	FScopeCycleCounter LegacyCounter;
+	for (const FBVHShapeQuery& Query : Queries)
+	{
+		const FBVHCollisionShape& Shape = Query.Shape;
+		if (Shape.Type == EBVHShapeType::Sphere)
+		{
+			LegacyHits += BVH->QueryIntersectedComponents(FBoundingSphere(Shape.Center, Shape.HalfExtent.X)).Num();
+		}
+		else if (Shape.Type == EBVHShapeType::Box)
+		{
+			const FVector Axes[3] = { FVector(1, 0, 0), FVector(0, 1, 0), FVector(0, 0, 1) };
+			LegacyHits += BVH->QueryIntersectedComponents(FOBB(Shape.Center, Shape.HalfExtent, Axes)).Num();
+		}
+	}
+	const double LegacyMs = LegacyCounter.Finish();
+
+	// 2) 형상 오버랩 단일 호출 반복
+	int32 OverlapHits = 0;
+	FScopeCycleCounter OverlapCounter;
+	for (const FBVHShapeQuery& Query : Queries)
+	{
+		OverlapHits += BVH->OverlapShape(Query, OverlapBuffer, MaxResultsPerQuery);
+	}
+	const double OverlapMs = OverlapCounter.Finish();
+
+	// 3) 형상 오버랩 배치 (병렬)
+	FScopeCycleCounter OverlapBatchCounter;
+	BVH->OverlapShapeBatch(Queries, MaxResultsPerQuery, BatchComponents, BatchCounts, true);
+	const double OverlapBatchMs = OverlapBatchCounter.Finish();
+
+	// 4) 형상 스윕 단일 호출 반복
+	int32 SweepHits = 0;
+	FBVHSweepHit SweepHit;
+	FScopeCycleCounter SweepCounter;
+	for (const FBVHShapeQuery& Query : Queries)
+	{
+		SweepHits += BVH->SweepShape(Query, SweepHit) ? 1 : 0;
+	}
+	const double SweepMs = SweepCounter.Finish();
+
+	// 5) 형상 스윕 배치 (병렬)
+	FScopeCycleCounter SweepBatchCounter;
+	BVH->SweepShapeBatch(Queries, BatchHits, true);
+	const double SweepBatchMs = SweepBatchCounter.Finish();
+
+	UE_LOG("[Bench] ShapeQuery: %d queries (sphere/capsule/box), %d primitives, %d workers", NumQueries, BVH->TotalActorCount(), FTaskScheduler::Get().GetWorkerCount());
+	UE_LOG("[Bench]   Legacy QueryIntersected (sphere/box): %.3f ms, hits %d", LegacyMs, LegacyHits);
+	UE_LOG("[Bench]   Overlap single loop : %.3f ms, hits %d", OverlapMs, OverlapHits);
+	UE_LOG("[Bench]   Overlap batch  (MT) : %.3f ms", OverlapBatchMs);
+	UE_LOG("[Bench]   Sweep single loop   : %.3f ms, hits %d", SweepMs, SweepHits);
+	UE_LOG("[Bench]   Sweep batch    (MT) : %.3f ms", SweepBatchMs);
+
+	// 6) 같은 형상으로 PhysX 씬 쿼리 (물리 바디가 있는 프리미티브만 대상이므로 히트 수는 참고용)
+	physx::PxScene* Scene = World->GetPhysicsScene();
+	if (!Scene)
+	{
+		UE_LOG("[Bench]   PhysX: no physics scene in this world (run in PIE to compare)");
+		return;
+	}
+
+	physx::PxOverlapHit TouchBuffer[MaxResultsPerQuery];
+	const physx::PxQueryFilterData OverlapFilter(physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC | physx::PxQueryFlag::eNO_BLOCK);
+	const physx::PxQueryFilterData SweepFilter(physx::PxQueryFlag::eSTATIC | physx::PxQueryFlag::eDYNAMIC);
+
+	Scene->lockRead();
+
+	int32 PhysXOverlapHits = 0;
+	FScopeCycleCounter PhysXOverlapCounter;
+	for (const FBVHShapeQuery& Query : Queries)
+	{
+		const physx::PxGeometryHolder Geometry = MakePxGeometry(Query.Shape);
+		physx::PxOverlapBuffer Buffer(TouchBuffer, MaxResultsPerQuery);
+		Scene->overlap(Geometry.any(), MakePxPose(Query.Shape), Buffer, OverlapFilter);
+		PhysXOverlapHits += static_cast<int32>(Buffer.getNbTouches());
+	}
+	const double PhysXOverlapMs = PhysXOverlapCounter.Finish();
+
+	int32 PhysXSweepHits = 0;
+	FScopeCycleCounter PhysXSweepCounter;
+	for (const FBVHShapeQuery& Query : Queries)
+	{
+		const physx::PxGeometryHolder Geometry = MakePxGeometry(Query.Shape);
+		physx::PxSweepBuffer Buffer;
+		const physx::PxVec3 Direction(Query.Direction.X, Query.Direction.Y, Query.Direction.Z);
+		if (Scene->sweep(Geometry.any(), MakePxPose(Query.Shape), Direction, std::max(Query.Distance, 0.001f),
+			Buffer, physx::PxHitFlag::eDEFAULT, SweepFilter) && Buffer.hasBlock)
+		{
+			++PhysXSweepHits;
+		}
+	}
+	const double PhysXSweepMs = PhysXSweepCounter.Finish();
+
+	Scene->unlockRead();
+
+	UE_LOG("[Bench]   PhysX overlap loop  : %.3f ms, hits %d", PhysXOverlapMs, PhysXOverlapHits);
+	UE_LOG("[Bench]   PhysX sweep loop    : %.3f ms, hits %d", PhysXSweepMs, PhysXSweepHits);
+}
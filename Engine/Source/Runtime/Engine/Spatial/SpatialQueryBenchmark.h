@@ -0,0 +1,17 @@
+#pragma once
+
+class UWorld;
+
+/**
+ * @brief 공간 쿼리 성능 비교용 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details 현재 월드의 파티션 BVH를 대상으로 결정적(고정 시드) 입력을 생성해 비교 결과를 로그로 남긴다.
+ */
+class FSpatialQueryBenchmark
+{
+public:
+	// 단일 레이 API(RayQueryClosest) 반복 호출 vs 배치 쿼리(단일 스레드/병렬, Closest/Any)
+	static void RunRayBatch(UWorld* World, int32 NumRays);
+
+	// 구/캡슐/박스 오버랩·스윕: 기존 QueryIntersectedComponents vs 엔진 BVH 형상 쿼리(단일/배치) vs PhysX 씬 쿼리
+	static void RunShapeQueries(UWorld* World, int32 NumQueries);
+};
@@ -12,6 +12,11 @@ class FBVHierarchy;
 struct FRay;
 struct FAABB;
 struct FFrustum;
+struct FBVHRayQuery;
+struct FBVHRayHit;
+struct FBVHShapeQuery;
+struct FBVHSweepHit;
+enum class EBVHRayQueryMode : uint8;
 
 class UWorldPartitionManager : public UObject
 {
@@ -35,10 +40,32 @@ public:
 
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
 
+	/**
+	 * @brief 가시성 변경 리비전 (등록/제거/트랜스폼 변경마다 증가)
+	 * @details 모든 파티션 매니저가 공유하는 전역 카운터에서 발급되므로 다른 월드의 리비전과 겹치지 않는다.
+	 */
+	uint64 GetVisibilityRevision() const { return VisibilityRevision; }
+	/**
+	 * @brief SinceRevision 이후 가시성에 영향을 준 컴포넌트 목록 (중복 가능)
+	 * @return 변경 기록이 잘려 추적할 수 없으면 false (전체 재컬링 필요)
+	 */
+	bool GetVisibilityChangesSince(uint64 SinceRevision, OUT TArray<UPrimitiveComponent*>& OutComponents) const;
+	// BVH 반영을 기다리는 컴포넌트인지 (true면 BVH 쿼리 결과가 이 컴포넌트의 현재 위치와 다를 수 있음)
+	bool IsPendingUpdate(UPrimitiveComponent* Component) const { return ComponentDirtySet.Contains(Component); }
+
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
+	// 여러 레이/세그먼트를 한 번에 처리 (AI 시야, 프로젝타일 트레이스 등), OutHits는 Queries와 같은 인덱스
+	void RayQueryBatch(const TArray<FBVHRayQuery>& Queries, OUT TArray<FBVHRayHit>& OutHits, EBVHRayQueryMode Mode);
 	void FrustumQuery(FFrustum InFrustum);
 
+	// 구/캡슐/박스 형상 쿼리 (PhysX 바디가 없는 프리미티브도 포함, 결과 버퍼는 호출자 소유)
+	int32 OverlapShape(const FBVHShapeQuery& Query, UPrimitiveComponent** OutComponents, int32 MaxResults);
+	bool SweepShape(const FBVHShapeQuery& Query, OUT FBVHSweepHit& OutHit);
+	void OverlapShapeBatch(const TArray<FBVHShapeQuery>& Queries, int32 MaxResultsPerQuery,
+		OUT TArray<UPrimitiveComponent*>& OutComponents, OUT TArray<int32>& OutCounts);
+	void SweepShapeBatch(const TArray<FBVHShapeQuery>& Queries, OUT TArray<FBVHSweepHit>& OutHits);
+
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
 	/** BVH 게터 */
@@ -53,9 +80,18 @@ private:
 	//재시작시 필요 
 	void ClearSceneOctree();
 	void ClearBVHierarchy();
+
+	// 뷰별 가시성 캐시(FSceneViewState)의 증분 무효화를 위한 변경 기록
+	void RecordVisibilityChange(UPrimitiveComponent* Component);
 	
 	TQueue<UPrimitiveComponent*> ComponentDirtyQueue; // 추가 혹은 갱신이 필요한 요소의 대기 큐
 	TSet<UPrimitiveComponent*> ComponentDirtySet;     // 더티 큐 중복 추가를 막기 위한 Set
 	FOctree* SceneOctree = nullptr;
 	FBVHierarchy* BVH = nullptr;
+
+	// 가시성 변경 기록 (리비전 오름차순), 가득 차면 앞쪽 절반을 버리고 BaseRevision을 올림
+	static constexpr int32 MaxVisibilityChangeLog = 4096;
+	TArray<std::pair<uint64, UPrimitiveComponent*>> VisibilityChangeLog;
+	uint64 VisibilityRevision = 0;
+	uint64 VisibilityLogBaseRevision = 0; // 이 리비전 이후의 변경만 기록에 남아 있음
 };
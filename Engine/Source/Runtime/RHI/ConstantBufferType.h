@@ -17,10 +17,20 @@ struct ViewProjBufferType // b1 고유번호 고정
     FMatrix InvProj;
 };
 
-struct DecalBufferType
+// 클러스터 데칼 패스 (b6 in PS), 데칼 클러스터 그리드 (라이트 컬링이 꺼진 Unlit 뷰에서도 쓰므로 b11과 별도)
+struct FDecalClusterBufferType
 {
-    FMatrix DecalMatrix;
-    float Opacity;
+    uint32 TileSize;
+    uint32 TileCountX;
+    uint32 TileCountY;
+    uint32 ClusterCountZ;
+    uint32 ViewportStartX;
+    uint32 ViewportStartY;
+    float ClusterDepthScale;  // Slice = log2(ViewZ) * Scale + Bias
+    float ClusterDepthBias;
+    FVector2D ViewportSize;
+    uint32 DecalCount;
+    uint32 Padding;
 };
 
 // Fireball material parameters (b6 in PS)
@@ -271,7 +281,10 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint32 Padding[2];
+    uint32 ClusterCountZ;     // 깊이 슬라이스 개수
+    float ClusterDepthScale;  // Slice = log2(ViewZ) * Scale + Bias
+    float ClusterDepthBias;
+    uint32 Padding[3];
 };
 
 struct FPointLightShadowBufferType
@@ -357,7 +370,7 @@ constexpr bool ClothBufferTypeIsPS = false;
 //매크로를 인자로 받고 그 매크로 함수에 버퍼 전달
 #define CONSTANT_BUFFER_LIST_SMALL(MACRO) \
 MACRO(ModelBufferType)              \
-MACRO(DecalBufferType)              \
+MACRO(FDecalClusterBufferType)      \
 MACRO(FireballBufferType)           \
 MACRO(PostProcessBufferType)        \
 MACRO(FogBufferType)                \
@@ -406,7 +419,7 @@ CONSTANT_BUFFER_INFO(FDepthOfFieldBufferType, 2, false, true)
 CONSTANT_BUFFER_INFO(ColorBufferType, 3, true, true)   // b3 color
 CONSTANT_BUFFER_INFO(FPixelConstBufferType, 4, true, true) // GOURAUD에도 사용되므로 VS도 true
 CONSTANT_BUFFER_INFO(FSkinningBuffer, 5, true, false) // b5, VS Only (GPU Skinning)
-CONSTANT_BUFFER_INFO(DecalBufferType, 6, true, true)
+CONSTANT_BUFFER_INFO(FDecalClusterBufferType, 6, false, true)  // b6, PS only (ClusteredDecal_PS.hlsl)
 CONSTANT_BUFFER_INFO(FireballBufferType, 6, false, true)
 CONSTANT_BUFFER_INFO(CameraBufferType, 7, true, true)  // b7, VS+PS (UberLit.hlsl과 일치)
 CONSTANT_BUFFER_INFO(FLightBufferType, 8, true, true)
@@ -0,0 +1,85 @@
+#include "pch.h"
+#include "ConstantUploadRing.h"
+
+void FUploadRingAllocator::Initialize(uint32 InCapacity, uint32 InAlignment)
+{
+	assert(InAlignment > 0 && (InAlignment & (InAlignment - 1)) == 0);
+
+	Capacity = InCapacity;
+	Alignment = InAlignment;
+	PendingFrames.Empty();
+	Discard();
+}
+
+uint32 FUploadRingAllocator::Allocate(uint32 Size, bool& bOutNeedsDiscard)
+{
+	bOutNeedsDiscard = false;
+
+	const uint32 AlignedSize = AlignSize(std::max(Size, 1u));
+	if (AlignedSize > Capacity)
+	{
+		OverflowBytes += AlignedSize;
+		return InvalidOffset;
+	}
+
+	// 끝에 남은 공간이 모자라면 처음으로 감음 (남은 공간은 이번 프레임이 쓴 것으로 침)
+	uint32 Offset = Head;
+	uint32 Padding = 0;
+	if (Head + AlignedSize > Capacity)
+	{
+		Padding = Capacity - Head;
+		Offset = 0;
+	}
+
+	// GPU가 아직 읽는 영역과 겹치면 실패 (이번 프레임에 바인딩한 오프셋을 지키려고 비우지 않음)
+	if (LiveBytes + Padding + AlignedSize > Capacity)
+	{
+		OverflowBytes += AlignedSize;
+		return InvalidOffset;
+	}
+
+	// 새 링의 첫 매핑만 DISCARD
+	bOutNeedsDiscard = bDiscardPending;
+	bDiscardPending = false;
+
+	Head = Offset + AlignedSize;
+	LiveBytes += Padding + AlignedSize;
+	FrameBytes += Padding + AlignedSize;
+	return Offset;
+}
+
+void FUploadRingAllocator::EndFrame(uint64 Fence)
+{
+	if (FrameBytes > 0)
+	{
+		PendingFrames.Add({ Fence, FrameBytes });
+		FrameBytes = 0;
+	}
+	OverflowBytes = 0;
+}
+
+void FUploadRingAllocator::ReleaseCompleted(uint64 CompletedFence)
+{
+	int32 NumReleased = 0;
+	while (NumReleased < PendingFrames.Num() && PendingFrames[NumReleased].Fence <= CompletedFence)
+	{
+		LiveBytes -= PendingFrames[NumReleased].Bytes;
+		++NumReleased;
+	}
+
+	if (NumReleased > 0)
+	{
+		PendingFrames.erase(PendingFrames.begin(), PendingFrames.begin() + NumReleased);
+	}
+}
+
+void FUploadRingAllocator::Discard()
+{
+	PendingFrames.Empty();
+	Head = 0;
+	LiveBytes = 0;
+	FrameBytes = 0;
+	OverflowBytes = 0;
+	++Generation;
+	bDiscardPending = true;
+}
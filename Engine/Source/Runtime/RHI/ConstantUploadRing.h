@@ -0,0 +1,162 @@
+#pragma once
+
+// 한 프레임 동안의 상수 버퍼 업로드 통계 (D3D11RHI가 프레임마다 확정)
+struct FConstantUploadStats
+{
+	uint32 NumUpdates = 0;			// SetAndUpdateConstantBuffer 호출 수
+	uint32 NumMaps = 0;				// Map 호출 수 (전체)
+	uint32 NumDiscardMaps = 0;		// 그중 WRITE_DISCARD (버퍼 리네이밍)
+	uint32 NumSkippedUploads = 0;	// 직전과 같은 내용이라 Map 없이 다시 바인딩만 한 횟수
+	uint32 NumRingAllocations = 0;	// 업로드 링에서 받은 할당 수
+	uint64 RingBytes = 0;			// 업로드 링에 쓴 바이트 (정렬 포함)
+	uint32 NumFenceWaits = 0;		// 링을 재사용하려고 GPU를 기다린 횟수
+	uint32 NumRingFallbacks = 0;	// 링이 가득 차 타입별 전용 버퍼로 올린 횟수 (프레임 끝에 링을 키움)
+	uint32 NumBatchMaps = 0;		// 패스 하나의 상수를 한 번에 쓴 Map 수 (PrepareConstantUploads)
+	uint32 RingCapacity = 0;		// 현재 링 크기 (바이트)
+
+	void Reset() { *this = FConstantUploadStats(); }
+};
+
+/**
+ * @brief 프레임 단위 펜스로 회수되는 선형 업로드 링의 할당 로직 (디바이스 없이 동작)
+ * @details 큰 동적 버퍼 하나를 앞에서부터 잘라 쓰고, 프레임이 끝나면 그 프레임이 쓴 영역을 펜스 값과 묶어 둔다.
+ * GPU가 펜스를 지나면 ReleaseCompleted로 영역을 돌려받아 끝에서 처음으로 감아 다시 쓴다.
+ * 할당은 GPU가 읽는 영역과 겹치지 않으므로 WRITE_NO_OVERWRITE로 매핑할 수 있다.
+ * 공간이 모자라도 프레임 중간에는 링을 비우지 않는다 (DISCARD로 리네이밍하면 이번 프레임에 이미 바인딩한
+ * 오프셋이 새 버퍼를 가리키게 됨). InvalidOffset을 돌려주고 모자란 양을 기록해 두면, 호출 측이 전용 버퍼로
+ * 대신 올리고 프레임 끝에 더 큰 링으로 바꾼다. WRITE_DISCARD는 새로 만든 링의 첫 매핑에만 쓴다.
+ */
+class FUploadRingAllocator
+{
+public:
+	static constexpr uint32 InvalidOffset = UINT32_MAX;
+
+	FUploadRingAllocator() = default;
+	FUploadRingAllocator(uint32 InCapacity, uint32 InAlignment) { Initialize(InCapacity, InAlignment); }
+
+	// InAlignment는 2의 거듭제곱 (상수 버퍼 오프셋 바인딩은 256바이트)
+	void Initialize(uint32 InCapacity, uint32 InAlignment);
+
+	/**
+	 * @brief Size 바이트를 정렬해 할당
+	 * @param bOutNeedsDiscard true면 새 링의 첫 할당이므로 WRITE_DISCARD로 매핑해야 함
+	 * @return 링 안의 바이트 오프셋, GPU가 읽는 영역과 겹치거나 용량보다 크면 InvalidOffset (모자란 양은 GetOverflowBytes)
+	 */
+	uint32 Allocate(uint32 Size, bool& bOutNeedsDiscard);
+
+	// 이번 프레임에 할당한 영역을 Fence 값과 묶어 닫음 (Fence는 단조 증가, 모자란 양도 0으로)
+	void EndFrame(uint64 Fence);
+
+	// 이번 프레임에 할당하지 못한 바이트 (정렬 포함, 프레임 끝에 링을 키울 크기 계산용)
+	uint32 GetOverflowBytes() const { return OverflowBytes; }
+
+	// GPU가 CompletedFence까지 끝낸 프레임의 영역을 돌려받음
+	void ReleaseCompleted(uint64 CompletedFence);
+
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 GetUsedBytes() const { return LiveBytes; }
+	int32 GetNumPendingFrames() const { return PendingFrames.Num(); }
+
+	// Initialize로 링을 새로 만들 때마다 증가 (이전 세대의 오프셋은 더 이상 같은 데이터를 가리키지 않음)
+	uint64 GetGeneration() const { return Generation; }
+
+	uint32 AlignSize(uint32 Size) const { return (Size + Alignment - 1) & ~(Alignment - 1); }
+
+private:
+	// 진행 중인 프레임 전체를 잊고 처음부터 (새 버퍼의 첫 WRITE_DISCARD와 짝)
+	void Discard();
+
+	struct FPendingFrame
+	{
+		uint64 Fence;
+		uint32 Bytes;	// 감기 패딩 포함
+	};
+
+	uint32 Capacity = 0;
+	uint32 Alignment = 256;
+	uint32 Head = 0;		// 다음 할당 위치
+	uint32 LiveBytes = 0;	// GPU가 아직 읽을 수 있는 바이트 (진행 중 프레임 + 현재 프레임)
+	uint32 FrameBytes = 0;	// 현재 프레임이 쓴 바이트
+	uint32 OverflowBytes = 0;	// 현재 프레임에 할당하지 못한 바이트
+	uint64 Generation = 0;
+	bool bDiscardPending = true;	// 처음 매핑은 항상 DISCARD
+
+	TArray<FPendingFrame> PendingFrames;	// 오래된 순
+};
+
+/**
+ * @brief 업로드 링의 프레임 펜스 진행과 회수 순서 (디바이스 없이 동작)
+ * @details 펜스 쿼리 NumSlots개를 프레임마다 돌려 쓴다. 프레임 번호가 곧 펜스 값이며 슬롯은 프레임 % NumSlots.
+ * 호출 측은 프레임 끝에 GetCurrentSlot()의 쿼리를 발행한 뒤 EndFrame을 부르고, 쿼리 조회는 PollFence로 넘긴다.
+ * 다음 프레임이 재사용할 슬롯의 프레임은 끝날 때까지 기다려야 하므로 그때만 bMustWait로 묻는다.
+ */
+class FUploadFenceTracker
+{
+public:
+	explicit FUploadFenceTracker(uint32 InNumSlots) : NumSlots(InNumSlots) {}
+
+	uint64 GetCurrentFrame() const { return CurrentFrame; }
+	uint64 GetCompletedFrame() const { return CompletedFrame; }
+	uint32 GetCurrentSlot() const { return static_cast<uint32>(CurrentFrame % NumSlots); }
+
+	/**
+	 * @brief 현재 프레임을 Ring에서 닫고, GPU가 끝낸 프레임을 앞에서부터 확인해 영역을 돌려받음
+	 * @param PollFence bool(uint32 Slot, bool bMustWait): 슬롯의 펜스가 끝났으면 true (bMustWait면 끝날 때까지 기다림)
+	 */
+	template<typename PollFuncType>
+	void EndFrame(FUploadRingAllocator& Ring, PollFuncType&& PollFence)
+	{
+		Ring.EndFrame(CurrentFrame);
+		++CurrentFrame;
+
+		while (CompletedFrame + 1 < CurrentFrame)
+		{
+			const uint64 Frame = CompletedFrame + 1;
+			const bool bMustWait = (CurrentFrame - Frame) >= NumSlots;	// 다음 프레임이 이 슬롯을 재사용함
+			if (!PollFence(static_cast<uint32>(Frame % NumSlots), bMustWait))
+			{
+				break;
+			}
+			CompletedFrame = Frame;
+		}
+
+		Ring.ReleaseCompleted(CompletedFrame);
+	}
+
+private:
+	uint32 NumSlots;
+	uint64 CurrentFrame = 1;	// 현재 기록 중인 프레임 (펜스 값)
+	uint64 CompletedFrame = 0;	// GPU가 끝낸 마지막 프레임
+};
+
+/**
+ * @brief 상수 버퍼 하나에 마지막으로 올린 내용과 위치
+ * @details 같은 내용을 다시 올리면 Map 없이 이전 위치를 다시 바인딩한다.
+ * 링 경로로 올린 경우 링 세대와 프레임이 같을 때만 그 위치가 유효하다.
+ */
+struct FConstantBufferShadow
+{
+	TArray<uint8> Data;
+	bool bValid = false;	// Data가 마지막 업로드 내용과 같은지
+	uint32 RingOffset = FUploadRingAllocator::InvalidOffset;	// InvalidOffset이면 전용 버퍼에 있음
+	uint64 RingGeneration = 0;
+	uint64 RingFrame = 0;
+
+	bool Matches(const void* InData, uint32 Size) const
+	{
+		return bValid && static_cast<uint32>(Data.Num()) == Size && std::memcmp(Data.data(), InData, Size) == 0;
+	}
+
+	void Store(const void* InData, uint32 Size)
+	{
+		Data.SetNum(Size);
+		std::memcpy(Data.data(), InData, Size);
+		bValid = true;
+	}
+
+	void Invalidate()
+	{
+		bValid = false;
+		RingOffset = FUploadRingAllocator::InvalidOffset;
+	}
+};
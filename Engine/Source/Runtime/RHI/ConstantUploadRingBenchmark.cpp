@@ -0,0 +1,166 @@
+#include "pch.h"
+#include "ConstantUploadRingBenchmark.h"
+#include "ConstantUploadRing.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	constexpr uint32 NumFenceSlots = 3;	// D3D11RHI::NumUploadFramesInFlight와 같은 수
+
+	// 펜스 쿼리 슬롯과 GPU 진행을 흉내 냄 (슬롯마다 마지막으로 발행한 프레임)
+	struct FFakeGPUFences
+	{
+		uint64 SlotFrames[NumFenceSlots] = {};
+		uint64 CompletedFrame = 0;
+		uint32 NumWaits = 0;
+
+		// D3D11RHI의 GetData 조회와 같은 규칙: 끝났으면 true, 기다려야 하면 GPU가 그 프레임까지 따라잡게 함
+		bool Poll(uint32 Slot, bool bMustWait)
+		{
+			if (SlotFrames[Slot] <= CompletedFrame)
+			{
+				return true;
+			}
+			if (bMustWait)
+			{
+				++NumWaits;
+				CompletedFrame = SlotFrames[Slot];
+				return true;
+			}
+			return false;
+		}
+	};
+
+	// D3D11RHI::EndConstantUploadFrame과 같은 순서: 현재 슬롯에 펜스 발행 → 프레임 닫기 → 완료 프레임 회수
+	void EndFrame(FUploadFenceTracker& Fences, FUploadRingAllocator& Ring, FFakeGPUFences& GPU)
+	{
+		GPU.SlotFrames[Fences.GetCurrentSlot()] = Fences.GetCurrentFrame();
+		Fences.EndFrame(Ring, [&GPU](uint32 Slot, bool bMustWait)
+		{
+			return GPU.Poll(Slot, bMustWait);
+		});
+	}
+
+	struct FCheckLog
+	{
+		int32 NumChecks = 0;
+		int32 NumFailed = 0;
+
+		void Check(bool bCondition, const char* Description)
+		{
+			++NumChecks;
+			if (!bCondition)
+			{
+				++NumFailed;
+				UE_LOG("[Bench]   FAIL: %s", Description);
+			}
+		}
+	};
+
+	// 1KB 링, 256바이트 정렬에서 할당 → 넘침 → 프레임 닫기 → 회수 → 감기 → 슬롯 재사용 대기 → 재초기화 순으로 확인
+	void RunScenario(FCheckLog& Log)
+	{
+		constexpr uint32 InvalidOffset = FUploadRingAllocator::InvalidOffset;
+
+		FUploadRingAllocator Ring(1024, 256);
+		FUploadFenceTracker Fences(NumFenceSlots);
+		FFakeGPUFences GPU;
+		bool bNeedsDiscard = false;
+
+		// 프레임 1: 정렬된 할당과 첫 매핑 DISCARD
+		uint32 Offset = Ring.Allocate(16, bNeedsDiscard);
+		Log.Check(Offset == 0 && bNeedsDiscard, "first allocation starts at 0 and needs WRITE_DISCARD");
+		Offset = Ring.Allocate(300, bNeedsDiscard);
+		Log.Check(Offset == 256 && !bNeedsDiscard, "second allocation is aligned to 256 without DISCARD");
+		Log.Check(Ring.GetUsedBytes() == 768, "used bytes include alignment");
+
+		// 끝에서 감으면 이번 프레임 영역과 겹침 → 실패하고 모자란 양만 기록
+		Offset = Ring.Allocate(512, bNeedsDiscard);
+		Log.Check(Offset == InvalidOffset && Ring.GetOverflowBytes() == 512, "overflow inside a frame fails instead of discarding the ring");
+		Offset = Ring.Allocate(2048, bNeedsDiscard);
+		Log.Check(Offset == InvalidOffset && Ring.GetOverflowBytes() == 2560, "allocation larger than the ring fails");
+		Log.Check(Ring.GetUsedBytes() == 768, "failed allocations do not consume space");
+
+		EndFrame(Fences, Ring, GPU);
+		Log.Check(Ring.GetNumPendingFrames() == 1 && Ring.GetOverflowBytes() == 0, "EndFrame closes the frame and clears overflow");
+		Log.Check(Fences.GetCompletedFrame() == 0 && Ring.GetUsedBytes() == 768, "unfinished frame keeps its bytes");
+
+		// 프레임 2: 남은 끝 공간은 쓰고, 감으면 GPU가 읽는 프레임 1 영역과 겹치므로 실패
+		Offset = Ring.Allocate(256, bNeedsDiscard);
+		Log.Check(Offset == 768, "allocation fills the tail of the ring");
+		Offset = Ring.Allocate(16, bNeedsDiscard);
+		Log.Check(Offset == InvalidOffset, "wrap does not overwrite a frame the GPU may still read");
+
+		GPU.CompletedFrame = 1;
+		EndFrame(Fences, Ring, GPU);
+		Log.Check(Fences.GetCompletedFrame() == 1 && Ring.GetUsedBytes() == 256, "ReleaseCompleted returns the finished frame's bytes");
+		Log.Check(Ring.GetNumPendingFrames() == 1, "only the unfinished frame stays pending");
+
+		// 프레임 3: 회수한 앞부분으로 감음
+		Offset = Ring.Allocate(16, bNeedsDiscard);
+		Log.Check(Offset == 0 && !bNeedsDiscard, "allocation wraps to the reclaimed start without DISCARD");
+		EndFrame(Fences, Ring, GPU);
+
+		// 프레임 4: GPU가 멈춰 있으면 다음 프레임이 재사용할 슬롯(프레임 2)만 기다림
+		EndFrame(Fences, Ring, GPU);
+		Log.Check(GPU.NumWaits == 1 && Fences.GetCompletedFrame() == 2, "tracker waits only for the slot the next frame reuses");
+		Log.Check(Ring.GetUsedBytes() == 256 && Ring.GetNumPendingFrames() == 1, "waited frame is reclaimed, later frame stays pending");
+
+		// 링 교체(확장): 세대가 바뀌고 첫 할당은 다시 DISCARD
+		const uint64 Generation = Ring.GetGeneration();
+		Ring.Initialize(2048, 256);
+		Offset = Ring.Allocate(16, bNeedsDiscard);
+		Log.Check(Ring.GetGeneration() == Generation + 1 && Offset == 0 && bNeedsDiscard, "reinitialized ring starts a new generation with DISCARD");
+		Log.Check(Ring.GetNumPendingFrames() == 0 && Ring.GetUsedBytes() == 256, "reinitialized ring forgets old frames");
+	}
+}
+
+void FConstantUploadRingBenchmark::Run(int32 NumFrames, int32 NumAllocsPerFrame)
+{
+	FCheckLog Log;
+	RunScenario(Log);
+	UE_LOG("[Bench] UploadRing: %d/%d checks passed", Log.NumChecks - Log.NumFailed, Log.NumChecks);
+
+	if (NumFrames <= 0 || NumAllocsPerFrame <= 0)
+	{
+		return;
+	}
+
+	// GPU가 2프레임 늦게 따라오는 정상 상태에서 할당 + 프레임 회수 비용
+	FUploadRingAllocator Ring(4 * 1024 * 1024, 256);
+	FUploadFenceTracker Fences(NumFenceSlots);
+	FFakeGPUFences GPU;
+
+	uint32 RandomState = 0x9E3779B9u;
+	uint32 NumFailed = 0;
+	uint64 NumBytes = 0;
+	bool bNeedsDiscard = false;
+
+	FScopeCycleCounter Counter;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Index = 0; Index < NumAllocsPerFrame; ++Index)
+		{
+			RandomState = RandomState * 1664525u + 1013904223u;
+			const uint32 Size = 16 + (RandomState >> 8) % 1009;	// 16 ~ 1024 바이트 (상수 버퍼 크기 분포)
+			if (Ring.Allocate(Size, bNeedsDiscard) == FUploadRingAllocator::InvalidOffset)
+			{
+				++NumFailed;
+			}
+			else
+			{
+				NumBytes += Ring.AlignSize(Size);
+			}
+		}
+
+		const uint64 CurrentFrame = Fences.GetCurrentFrame();
+		GPU.CompletedFrame = CurrentFrame > 2 ? CurrentFrame - 2 : 0;
+		EndFrame(Fences, Ring, GPU);
+	}
+	const double ElapsedMs = Counter.Finish();
+
+	const double NumAllocs = static_cast<double>(NumFrames) * NumAllocsPerFrame;
+	UE_LOG("[Bench]   %d frames x %d allocs: %.3f ms (%.1f ns/alloc), %.1f KB/frame, %u failed, %u fence waits",
+		NumFrames, NumAllocsPerFrame, ElapsedMs, ElapsedMs * 1.0e6 / NumAllocs,
+		static_cast<double>(NumBytes) / NumFrames / 1024.0, NumFailed, GPU.NumWaits);
+}
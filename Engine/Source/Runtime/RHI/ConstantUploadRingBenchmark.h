@@ -0,0 +1,13 @@
+#pragma once
+
+/**
+ * @brief 상수 버퍼 업로드 링의 할당/펜스 회수 검증과 할당 비용 측정 (디바이스 없이 실행, 콘솔 BENCH 명령에서 호출)
+ * @details FUploadRingAllocator와 FUploadFenceTracker에 GPU 진행을 흉내 낸 가짜 펜스를 붙여
+ * 할당 정렬, 감기, 진행 중 영역 보호(넘침), 프레임 닫기, 완료 프레임 회수, 쿼리 슬롯 재사용 대기를 확인한다.
+ */
+class FConstantUploadRingBenchmark
+{
+public:
+	// 시나리오 검증 결과를 기록한 뒤, NumFrames 프레임 동안 프레임당 NumAllocsPerFrame번 할당하는 비용 측정
+	static void Run(int32 NumFrames, int32 NumAllocsPerFrame);
+};
@@ -3,9 +3,11 @@
 #include "Canvas.h"
 #include "Color.h"
 #include <DirectXTex.h>
+#include <d3d11_1.h>
 #include <filesystem>
 #include <cmath>
 #include <cstdint>
+#include <thread>
 
 void D3D11RHI::Initialize(HWND hWindow)
 {
@@ -16,6 +18,10 @@ void D3D11RHI::Initialize(HWND hWindow)
     CreateRasterizerState();
     CreateBlendState();
     CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+    // UV 스크롤 (PS b5, 데칼): 엔진 틱이 갱신하므로 0으로 시작
+    CreateConstantBuffer(&UVScrollCB, sizeof(FVector4));
+    UpdateUVScrollConstantBuffers(FVector2D(0.0f, 0.0f), 0.0f);
+    CreateConstantUploadRing();
 
 	CreateDepthStencilState();
 	CreateSamplerState();
@@ -62,6 +68,8 @@ void D3D11RHI::Release()
 
     // 상수버퍼
     CONSTANT_BUFFER_LIST(RELEASE_CONSTANT_BUFFER);
+    if (UVScrollCB) { UVScrollCB->Release(); UVScrollCB = nullptr; }
+    ReleaseConstantUploadRing();
 
     // 상태 객체
     if (DepthStencilState) { DepthStencilState->Release(); DepthStencilState = nullptr; }
@@ -349,6 +357,23 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* Device, const FSkeletalMeshDat
     return Device->CreateBuffer(&IndexBufferDesc, &InitData, OutBuffer);
 }
 
+HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* Device, const TArray<uint32>& Indices, ID3D11Buffer** OutBuffer)
+{
+    if (Indices.empty())
+        return E_FAIL;
+
+    D3D11_BUFFER_DESC IndexBufferDesc = {};
+    IndexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    IndexBufferDesc.ByteWidth = static_cast<UINT>(sizeof(uint32) * Indices.size());
+    IndexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+    IndexBufferDesc.CPUAccessFlags = 0;
+
+    D3D11_SUBRESOURCE_DATA InitData = {};
+    InitData.pSysMem = Indices.data();
+
+    return Device->CreateBuffer(&IndexBufferDesc, &InitData, OutBuffer);
+}
+
 void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool bIsVS, bool bIsPS)
 {
     if (bIsVS)
@@ -361,6 +386,233 @@ void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool
     }
 }
 
+void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, const FConstantBufferShadow& Shadow, uint32 BindSize, uint32 Slot, bool bIsVS, bool bIsPS)
+{
+    if (Shadow.RingOffset != FUploadRingAllocator::InvalidOffset && IsRingShadowBindable(Shadow))
+    {
+        BindConstantRingRange(Shadow.RingOffset, BindSize, Slot, bIsVS, bIsPS);
+        return;
+    }
+    ConstantBufferSet(ConstantBuffer, Slot, bIsVS, bIsPS);
+}
+
+void D3D11RHI::ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, FConstantBufferShadow& Shadow, const void* pData, size_t DataSize, uint32 BindSize,
+    uint32 Slot, bool bIsVS, bool bIsPS, bool bSkipIfUnchanged)
+{
+    ++FrameUploadStats.NumUpdates;
+    const uint32 Size = static_cast<uint32>(DataSize);
+
+    // 배치로 미리 올려 둔 위치는 이번 갱신 하나에만 유효
+    const uint32 PreparedOffset = PreparedConstantOffset;
+    PreparedConstantOffset = FUploadRingAllocator::InvalidOffset;
+
+    // 직전과 같은 내용이고 그 위치가 아직 유효하면 다시 바인딩만 함 (드로우마다 같은 값을 올리는 경우가 많음)
+    const bool bRingShadow = Shadow.RingOffset != FUploadRingAllocator::InvalidOffset;
+    if (bSkipIfUnchanged && Shadow.Matches(pData, Size) && (!bRingShadow || IsRingShadowBindable(Shadow)))
+    {
+        ++FrameUploadStats.NumSkippedUploads;
+        ConstantBufferSet(ConstantBuffer, Shadow, BindSize, Slot, bIsVS, bIsPS);
+        return;
+    }
+
+    // 1) 업로드 링: 큰 버퍼 하나를 잘라 쓰고 오프셋으로 바인딩 (패스 배치로 이미 썼으면 바인딩만)
+    if (ConstantUploadRingBuffer)
+    {
+        uint32 Offset = PreparedOffset;
+        if (Offset != FUploadRingAllocator::InvalidOffset)
+        {
+            ++FrameUploadStats.NumRingAllocations;
+        }
+        else
+        {
+            Offset = UploadToConstantRing(pData, Size, BindSize);
+        }
+
+        if (Offset != FUploadRingAllocator::InvalidOffset)
+        {
+            Shadow.RingOffset = Offset;
+            Shadow.RingGeneration = ConstantUploadRing.GetGeneration();
+            Shadow.RingFrame = UploadFences.GetCurrentFrame();
+            if (bSkipIfUnchanged)
+            {
+                Shadow.Store(pData, Size);
+            }
+            else
+            {
+                Shadow.bValid = false;
+            }
+            BindConstantRingRange(Offset, BindSize, Slot, bIsVS, bIsPS);
+            return;
+        }
+
+        // 이번 프레임에 링이 가득 참: 이미 바인딩한 링 오프셋을 지키려고 비우지 않고 전용 버퍼로 (프레임 끝에 링을 키움)
+        ++FrameUploadStats.NumRingFallbacks;
+    }
+
+    // 2) 타입별 전용 버퍼 (오프셋 바인딩 미지원 또는 링이 가득 참)
+    ConstantBufferUpdate(ConstantBuffer, const_cast<void*>(pData), DataSize);
+    Shadow.RingOffset = FUploadRingAllocator::InvalidOffset;
+    if (bSkipIfUnchanged)
+    {
+        Shadow.Store(pData, Size);
+    }
+    else
+    {
+        Shadow.bValid = false;
+    }
+    ConstantBufferSet(ConstantBuffer, Slot, bIsVS, bIsPS);
+}
+
+uint32 D3D11RHI::UploadToConstantRing(const void* pData, uint32 DataSize, uint32 BindSize)
+{
+    bool bNeedsDiscard = false;
+    const uint32 Offset = ConstantUploadRing.Allocate(BindSize, bNeedsDiscard);
+    if (Offset == FUploadRingAllocator::InvalidOffset)
+    {
+        return FUploadRingAllocator::InvalidOffset;
+    }
+
+    // 새 링의 첫 매핑만 DISCARD, 그 외에는 GPU가 읽는 영역과 겹치지 않으므로 NO_OVERWRITE
+    D3D11_MAPPED_SUBRESOURCE MSR;
+    const D3D11_MAP MapType = bNeedsDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (FAILED(DeviceContext->Map(ConstantUploadRingBuffer, 0, MapType, 0, &MSR)))
+    {
+        return FUploadRingAllocator::InvalidOffset;
+    }
+    memcpy(static_cast<uint8*>(MSR.pData) + Offset, pData, DataSize);
+    DeviceContext->Unmap(ConstantUploadRingBuffer, 0);
+
+    ++FrameUploadStats.NumMaps;
+    FrameUploadStats.NumDiscardMaps += bNeedsDiscard ? 1 : 0;
+    ++FrameUploadStats.NumRingAllocations;
+    FrameUploadStats.RingBytes += ConstantUploadRing.AlignSize(BindSize);
+    return Offset;
+}
+
+uint8* D3D11RHI::BeginConstantUploadBatch(uint32 TotalBytes, uint32& OutBaseOffset)
+{
+    OutBaseOffset = FUploadRingAllocator::InvalidOffset;
+    if (!ConstantUploadRingBuffer || TotalBytes == 0)
+    {
+        return nullptr;
+    }
+
+    bool bNeedsDiscard = false;
+    const uint32 Offset = ConstantUploadRing.Allocate(TotalBytes, bNeedsDiscard);
+    if (Offset == FUploadRingAllocator::InvalidOffset)
+    {
+        return nullptr;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE MSR;
+    const D3D11_MAP MapType = bNeedsDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (FAILED(DeviceContext->Map(ConstantUploadRingBuffer, 0, MapType, 0, &MSR)))
+    {
+        return nullptr;
+    }
+
+    ++FrameUploadStats.NumMaps;
+    ++FrameUploadStats.NumBatchMaps;
+    FrameUploadStats.NumDiscardMaps += bNeedsDiscard ? 1 : 0;
+    FrameUploadStats.RingBytes += ConstantUploadRing.AlignSize(TotalBytes);
+
+    OutBaseOffset = Offset;
+    return static_cast<uint8*>(MSR.pData) + Offset;
+}
+
+void D3D11RHI::EndConstantUploadBatch()
+{
+    DeviceContext->Unmap(ConstantUploadRingBuffer, 0);
+}
+
+void D3D11RHI::BindConstantRingRange(uint32 Offset, uint32 BindSize, uint32 Slot, bool bIsVS, bool bIsPS)
+{
+    // 오프셋/크기는 16바이트 상수 단위, 둘 다 16 상수(256바이트)의 배수
+    const UINT FirstConstant = Offset / 16;
+    const UINT NumConstants = ConstantUploadRing.AlignSize(BindSize) / 16;
+    if (bIsVS)
+    {
+        DeviceContext1->VSSetConstantBuffers1(Slot, 1, &ConstantUploadRingBuffer, &FirstConstant, &NumConstants);
+    }
+    if (bIsPS)
+    {
+        DeviceContext1->PSSetConstantBuffers1(Slot, 1, &ConstantUploadRingBuffer, &FirstConstant, &NumConstants);
+    }
+}
+
+bool D3D11RHI::IsRingShadowBindable(const FConstantBufferShadow& Shadow) const
+{
+    // 다른 프레임의 위치는 펜스 회수 후 덮어써졌을 수 있고, 링을 비우면(DISCARD) 세대가 바뀜
+    return ConstantUploadRingBuffer
+        && Shadow.RingGeneration == ConstantUploadRing.GetGeneration()
+        && Shadow.RingFrame == UploadFences.GetCurrentFrame();
+}
+
+void D3D11RHI::EndConstantUploadFrame()
+{
+    CurrentUploadStats = FrameUploadStats;
+    CurrentUploadStats.RingCapacity = ConstantUploadRing.GetCapacity();
+    FrameUploadStats.Reset();
+    PreparedConstantOffset = FUploadRingAllocator::InvalidOffset;
+
+    if (!ConstantUploadRingBuffer)
+    {
+        return;
+    }
+
+    // 이번 프레임의 펜스를 발행하고, 끝난 프레임의 영역을 돌려받음 (순서는 FUploadFenceTracker, 여기서는 쿼리 조회만)
+    const uint32 OverflowBytes = ConstantUploadRing.GetOverflowBytes();
+    DeviceContext->End(UploadFenceQueries[UploadFences.GetCurrentSlot()]);
+    UploadFences.EndFrame(ConstantUploadRing, [this](uint32 Slot, bool bMustWait)
+    {
+        BOOL bDone = FALSE;
+        HRESULT hr = DeviceContext->GetData(UploadFenceQueries[Slot], &bDone, sizeof(BOOL), D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        if (hr != S_OK && bMustWait)
+        {
+            ++FrameUploadStats.NumFenceWaits;
+            while ((hr = DeviceContext->GetData(UploadFenceQueries[Slot], &bDone, sizeof(BOOL), 0)) == S_FALSE)
+            {
+                std::this_thread::yield();
+            }
+        }
+        return hr == S_OK;
+    });
+
+    if (OverflowBytes > 0)
+    {
+        GrowConstantUploadRing(OverflowBytes);
+    }
+}
+
+void D3D11RHI::GrowConstantUploadRing(uint32 OverflowBytes)
+{
+    const uint32 Capacity = ConstantUploadRing.GetCapacity();
+    if (Capacity >= MaxConstantUploadRingSize)
+    {
+        return;
+    }
+
+    uint32 NewCapacity = Capacity * 2;
+    while (NewCapacity < Capacity + OverflowBytes && NewCapacity < MaxConstantUploadRingSize)
+    {
+        NewCapacity *= 2;
+    }
+    NewCapacity = std::min(NewCapacity, MaxConstantUploadRingSize);
+
+    // 실패하면 이전 링을 그대로 쓰고 넘치는 갱신은 계속 전용 버퍼로
+    ID3D11Buffer* NewBuffer = CreateConstantUploadRingBuffer(NewCapacity);
+    if (!NewBuffer)
+    {
+        return;
+    }
+
+    // 이전 버퍼는 GPU가 진행 중인 프레임을 다 읽을 때까지 런타임이 유지함, 새 링은 세대가 바뀌어 이전 오프셋을 다시 쓰지 않음
+    ConstantUploadRingBuffer->Release();
+    ConstantUploadRingBuffer = NewBuffer;
+    ConstantUploadRing.Initialize(NewCapacity, ConstantBufferOffsetAlignment);
+    UE_LOG("ConstantUploadRing: grown to %u KB", NewCapacity / 1024);
+}
+
 
 void D3D11RHI::IASetPrimitiveTopology()
 {
@@ -540,6 +792,8 @@ void D3D11RHI::Present()
     }
 
     SwapChain->Present(0, 0); // vsync on
+
+    EndConstantUploadFrame();
 }
 
 void D3D11RHI::CreateDeviceAndSwapChain(HWND hWindow)
@@ -719,6 +973,12 @@ void D3D11RHI::CreateIdBuffer()
     Desc.Format = DXGI_FORMAT_R32_UINT;
     Device->CreateRenderTargetView(IdBuffer, &Desc, &IdBufferRTV);
 
+    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc{};
+    SRVDesc.Format = DXGI_FORMAT_R32_UINT;
+    SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+    SRVDesc.Texture2D.MipLevels = 1;
+    Device->CreateShaderResourceView(IdBuffer, &SRVDesc, &IdBufferSRV);
+
     TextureDesc = {};
 
     TextureDesc.Format = DXGI_FORMAT_R32_UINT;
@@ -811,6 +1071,68 @@ void D3D11RHI::UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeS
     }
 }
 
+void D3D11RHI::CreateConstantUploadRing()
+{
+    // 오프셋 바인딩(*SetConstantBuffers1)과 동적 상수 버퍼 NO_OVERWRITE가 모두 되어야 링을 사용
+    D3D11_FEATURE_DATA_D3D11_OPTIONS Options = {};
+    if (FAILED(Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options)))
+        || !Options.ConstantBufferOffsetting || !Options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+        UE_LOG("ConstantUploadRing: constant buffer offsetting not supported, using per-type buffers");
+        return;
+    }
+    if (FAILED(DeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DeviceContext1))))
+    {
+        return;
+    }
+
+    ConstantUploadRingBuffer = CreateConstantUploadRingBuffer(ConstantUploadRingSize);
+    if (!ConstantUploadRingBuffer)
+    {
+        ReleaseConstantUploadRing();
+        return;
+    }
+
+    D3D11_QUERY_DESC QueryDesc{};
+    QueryDesc.Query = D3D11_QUERY_EVENT;
+    for (ID3D11Query*& Query : UploadFenceQueries)
+    {
+        if (FAILED(Device->CreateQuery(&QueryDesc, &Query)))
+        {
+            ReleaseConstantUploadRing();
+            return;
+        }
+    }
+
+    ConstantUploadRing.Initialize(ConstantUploadRingSize, ConstantBufferOffsetAlignment);
+}
+
+ID3D11Buffer* D3D11RHI::CreateConstantUploadRingBuffer(uint32 Size)
+{
+    D3D11_BUFFER_DESC BufferDesc{};
+    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    BufferDesc.ByteWidth = Size;
+    BufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Buffer* Buffer = nullptr;
+    if (FAILED(Device->CreateBuffer(&BufferDesc, nullptr, &Buffer)))
+    {
+        return nullptr;
+    }
+    return Buffer;
+}
+
+void D3D11RHI::ReleaseConstantUploadRing()
+{
+    for (ID3D11Query*& Query : UploadFenceQueries)
+    {
+        if (Query) { Query->Release(); Query = nullptr; }
+    }
+    if (ConstantUploadRingBuffer) { ConstantUploadRingBuffer->Release(); ConstantUploadRingBuffer = nullptr; }
+    if (DeviceContext1) { DeviceContext1->Release(); DeviceContext1 = nullptr; }
+}
+
 void D3D11RHI::ReleaseSamplerState()
 {
     if (DefaultSamplerState)
@@ -961,6 +1283,11 @@ void D3D11RHI::ReleaseIdBuffer()
         IdBufferRTV->Release();
         IdBufferRTV = nullptr;
     }
+    if (IdBufferSRV)
+    {
+        IdBufferSRV->Release();
+        IdBufferSRV = nullptr;
+    }
     if (IdStagingBuffer)
     {
         IdStagingBuffer->Release();
@@ -3,10 +3,12 @@
 #include "ResourceManager.h"
 #include "VertexData.h"
 #include "ConstantBufferType.h"
+#include "ConstantUploadRing.h"
 
 
 #define DECLARE_CONSTANT_BUFFER(TYPE)\
-ID3D11Buffer* TYPE##Buffer{};
+ID3D11Buffer* TYPE##Buffer{};\
+FConstantBufferShadow TYPE##Shadow;
 #define CREATE_CONSTANT_BUFFER(TYPE)\
 CreateConstantBuffer(&TYPE##Buffer, sizeof(TYPE));
 #define RELEASE_CONSTANT_BUFFER(TYPE)\
@@ -17,36 +19,39 @@ CreateConstantBuffer(&TYPE##Buffer, sizeof(TYPE));
 	void UpdateConstantBuffer(const TYPE& Data)	\
 	{\
 		ConstantBufferUpdate(TYPE##Buffer, Data);\
+		TYPE##Shadow.Invalidate();\
 	}
 #define DECLARE_SET_CONSTANT_BUFFER_FUNC(TYPE) \
 	void SetConstantBuffer(const TYPE& Data)\
 	{\
-		ConstantBufferSet(TYPE##Buffer, TYPE##Slot, TYPE##IsVS, TYPE##IsPS);	\
+		ConstantBufferSet(TYPE##Buffer, TYPE##Shadow, sizeof(TYPE), TYPE##Slot, TYPE##IsVS, TYPE##IsPS);	\
 	}
 #define DECLARE_SET_UPDATE_CONSTANT_BUFFER_FUNC(TYPE) \
 	void SetAndUpdateConstantBuffer(const TYPE& Data)	\
 	{\
-		ConstantBufferSetUpdate(TYPE##Buffer, Data, TYPE##Slot, TYPE##IsVS, TYPE##IsPS);	\
+		ConstantBufferSetUpdate(TYPE##Buffer, TYPE##Shadow, &Data, sizeof(TYPE), sizeof(TYPE), TYPE##Slot, TYPE##IsVS, TYPE##IsPS, true);	\
 	}
 
 #define DECLARE_UPDATE_CONSTANT_BUFFER_FUNC_POINTER(TYPE) \
 	void UpdateConstantBuffer_Pointer_##TYPE(void* pData, size_t DataSize) \
 	{ \
 		ConstantBufferUpdate(TYPE##Buffer, pData, DataSize); \
+		TYPE##Shadow.Invalidate(); \
 	}
 
 #define DECLARE_SET_CONSTANT_BUFFER_FUNC_POINTER(TYPE) \
 	void SetConstantBuffer_Pointer_##TYPE(void* pData, size_t DataSize) \
 	{ \
-		ConstantBufferSet(TYPE##Buffer, TYPE##Slot, TYPE##IsVS, TYPE##IsPS); \
+		ConstantBufferSet(TYPE##Buffer, TYPE##Shadow, sizeof(TYPE), TYPE##Slot, TYPE##IsVS, TYPE##IsPS); \
 	}
 
 #define DECLARE_SET_UPDATE_CONSTANT_BUFFER_FUNC_POINTER(TYPE) \
 	void SetAndUpdateConstantBuffer_Pointer_##TYPE(void* pData, size_t DataSize) \
 	{ \
-		ConstantBufferSetUpdate(TYPE##Buffer, pData, DataSize, TYPE##Slot, TYPE##IsVS, TYPE##IsPS); \
+		ConstantBufferSetUpdate(TYPE##Buffer, TYPE##Shadow, pData, DataSize, sizeof(TYPE), TYPE##Slot, TYPE##IsVS, TYPE##IsPS, false); \
 	}
 
+struct ID3D11DeviceContext1;
 struct ID2D1Factory;
 struct IDWriteFactory;
 struct ID2D1RenderTarget;
@@ -109,6 +114,9 @@ public:
 
 	static HRESULT CreateIndexBuffer(ID3D11Device* Device, const FSkeletalMeshData* Mesh, ID3D11Buffer** OutBuffer);
 
+	// LOD 등 메시 구조체 없이 인덱스 배열만 있는 경우
+	static HRESULT CreateIndexBuffer(ID3D11Device* Device, const TArray<uint32>& Indices, ID3D11Buffer** OutBuffer);
+
 	CONSTANT_BUFFER_LIST_SMALL(DECLARE_UPDATE_CONSTANT_BUFFER_FUNC)
 	CONSTANT_BUFFER_LIST_SMALL(DECLARE_SET_CONSTANT_BUFFER_FUNC)
 	CONSTANT_BUFFER_LIST_SMALL(DECLARE_SET_UPDATE_CONSTANT_BUFFER_FUNC)
@@ -137,6 +145,8 @@ public:
 		D3D11_MAPPED_SUBRESOURCE MSR;
 
 		DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
+		++FrameUploadStats.NumMaps;
+		++FrameUploadStats.NumDiscardMaps;
 		memcpy(MSR.pData, &Data, sizeof(T));
 		DeviceContext->Unmap(ConstantBuffer, 0);
 	}
@@ -144,22 +154,39 @@ public:
 	{
 		D3D11_MAPPED_SUBRESOURCE MSR;
 		DeviceContext->Map(ConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MSR);
+		++FrameUploadStats.NumMaps;
+		++FrameUploadStats.NumDiscardMaps;
 		memcpy(MSR.pData, pData, DataSize); // pData 포인터에서 DataSize만큼 복사
 		DeviceContext->Unmap(ConstantBuffer, 0);
 	}
-	template <typename T>
-	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, T& Data, const uint32 Slot, const bool bIsVS, const bool bIsPS)
-	{
-		ConstantBufferUpdate(ConstantBuffer, Data);
-		ConstantBufferSet(ConstantBuffer, Slot, bIsVS, bIsPS);
-	}
-	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, void* pData, size_t DataSize, const uint32 Slot, const bool bIsVS, const bool bIsPS)
-	{
-		ConstantBufferUpdate(ConstantBuffer, pData, DataSize); // void* 버전 호출
-		ConstantBufferSet(ConstantBuffer, Slot, bIsVS, bIsPS);
-	}
+	/**
+	 * @brief 상수 버퍼 갱신 + 바인딩
+	 * @details 업로드 링이 있으면 링에서 BindSize만큼 잘라 NO_OVERWRITE로 쓰고 오프셋으로 바인딩한다.
+	 * 없으면 타입별 전용 버퍼를 DISCARD로 갱신한다. bSkipIfUnchanged면 직전과 같은 내용일 때 Map 없이 다시 바인딩만 한다.
+	 */
+	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, FConstantBufferShadow& Shadow, const void* pData, size_t DataSize, uint32 BindSize,
+		uint32 Slot, bool bIsVS, bool bIsPS, bool bSkipIfUnchanged);
 	void ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool bIsVS, bool bIsPS);
+	// 마지막 업로드 위치(링 또는 전용 버퍼)를 바인딩
+	void ConstantBufferSet(ID3D11Buffer* ConstantBuffer, const FConstantBufferShadow& Shadow, uint32 BindSize, uint32 Slot, bool bIsVS, bool bIsPS);
+
+	// 지난 프레임의 상수 버퍼 업로드 통계
+	const FConstantUploadStats& GetConstantUploadStats() const { return CurrentUploadStats; }
+	bool IsConstantUploadRingEnabled() const { return ConstantUploadRingBuffer != nullptr; }
+
+	/**
+	 * @brief 패스 하나의 상수를 한 번에 쓰도록 링에서 TotalBytes를 연속으로 잡고 NO_OVERWRITE로 매핑
+	 * @details 매핑 중에는 드로우할 수 없으므로 모두 쓴 뒤 EndConstantUploadBatch로 닫고 나서 실행한다.
+	 * @return 잡은 영역의 시작 주소 (OutBaseOffset은 링 안의 오프셋), 링이 없거나 모자라면 nullptr
+	 */
+	uint8* BeginConstantUploadBatch(uint32 TotalBytes, uint32& OutBaseOffset);
+	void EndConstantUploadBatch();
+	// 다음 ConstantBufferSetUpdate가 링에 새로 쓰지 않고 이미 올려 둔 Offset을 바인딩하게 함 (배치 업로드 소비)
+	void SetPreparedConstantUpload(uint32 Offset) { PreparedConstantOffset = Offset; }
+	uint32 GetConstantUploadAlignedSize(uint32 BindSize) const { return ConstantUploadRing.AlignSize(BindSize); }
     void UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec);
+	// 마지막으로 갱신한 UV 스크롤 값을 PS b5에 다시 바인딩 (다른 패스가 슬롯을 바꿨을 수 있음)
+	void PSSetUVScrollConstantBuffer() { DeviceContext->PSSetConstantBuffers(5, 1, &UVScrollCB); }
 
 	void IASetPrimitiveTopology();
 	void RSSetState(ERasterizerMode ViewMode);
@@ -209,6 +236,7 @@ public:
 	ID3D11ShaderResourceView* GetCurrentSourceSRV() const;
 
 	ID3D11Texture2D* GetIdBuffer() const { return IdBuffer; }
+	ID3D11ShaderResourceView* GetIdBufferSRV() const { return IdBufferSRV; }
 	ID3D11Texture2D* GetIdStagingBuffer() const { return IdStagingBuffer; }
 
 	void OMSetCustomRenderTargets(UINT NumRTVs, ID3D11RenderTargetView** RTVs, ID3D11DepthStencilView* DSV);
@@ -261,6 +289,8 @@ private:
 	void CreateDepthStencilState();
 	void CreateSamplerState();
 	void CreateD2DResources(); // Direct2D Factory, RenderTarget, DWrite Factory 생성
+	void CreateConstantUploadRing(); // D3D11.1 오프셋 바인딩을 지원하면 상수 버퍼 업로드 링 생성
+	ID3D11Buffer* CreateConstantUploadRingBuffer(uint32 Size);
 
 	// release
 	void ReleaseSamplerState();
@@ -270,6 +300,17 @@ private:
 	void ReleaseIdBuffer();
 	void ReleaseDeviceAndSwapChain();
 	void ReleaseD2DResources(); // Direct2D 리소스 해제
+	void ReleaseConstantUploadRing();
+
+	// 업로드 링에 데이터를 쓰고 오프셋 반환 (실패 시 InvalidOffset)
+	uint32 UploadToConstantRing(const void* pData, uint32 DataSize, uint32 BindSize);
+	void BindConstantRingRange(uint32 Offset, uint32 BindSize, uint32 Slot, bool bIsVS, bool bIsPS);
+	// 이 링 위치가 아직 같은 데이터를 가리키는지 (같은 세대, 같은 프레임)
+	bool IsRingShadowBindable(const FConstantBufferShadow& Shadow) const;
+	// 프레임 펜스를 넣고 GPU가 끝낸 프레임의 링 영역을 회수 (Present 후)
+	void EndConstantUploadFrame();
+	// 이번 프레임에 링이 OverflowBytes만큼 모자랐으면 다음 프레임부터 쓸 더 큰 링으로 교체 (프레임 사이에만 호출)
+	void GrowConstantUploadRing(uint32 OverflowBytes);
 
 	// FSwapGuard 클래스가 D3D11RHI의 private 멤버에 접근할 수 있도록 허용
 	friend class FSwapGuard;
@@ -310,6 +351,7 @@ private:
 	ID3D11Texture2D* IdStagingBuffer{};
 
 	ID3D11RenderTargetView* IdBufferRTV{};
+	ID3D11ShaderResourceView* IdBufferSRV{};	// 데칼 패스가 수신 비트를 읽음
 	ID3D11RenderTargetView* BackBufferRTV{};
 	ID3D11DepthStencilView* DepthStencilView{};
 
@@ -330,6 +372,21 @@ private:
 	CONSTANT_BUFFER_LIST(DECLARE_CONSTANT_BUFFER)
 	ID3D11Buffer* UVScrollCB{};
 
+	// 상수 버퍼 업로드 링 (프레임 단위 펜스로 회수, 오프셋 바인딩 미지원 시 nullptr)
+	static constexpr uint32 ConstantUploadRingSize = 4 * 1024 * 1024;
+	static constexpr uint32 MaxConstantUploadRingSize = 32 * 1024 * 1024;
+	static constexpr uint32 ConstantBufferOffsetAlignment = 256;	// 16 상수 단위
+	static constexpr uint32 NumUploadFramesInFlight = 3;
+	ID3D11DeviceContext1* DeviceContext1 = nullptr;
+	ID3D11Buffer* ConstantUploadRingBuffer = nullptr;
+	ID3D11Query* UploadFenceQueries[NumUploadFramesInFlight] = {};
+	FUploadRingAllocator ConstantUploadRing;
+	FUploadFenceTracker UploadFences{ NumUploadFramesInFlight };	// 프레임 번호 = 펜스 값, 슬롯 = UploadFenceQueries 인덱스
+	uint32 PreparedConstantOffset = FUploadRingAllocator::InvalidOffset;	// SetPreparedConstantUpload로 받은 위치 (한 번 쓰면 비움)
+
+	FConstantUploadStats FrameUploadStats;
+	FConstantUploadStats CurrentUploadStats;
+
 	ID3D11SamplerState* DefaultSamplerState = nullptr;
 	ID3D11SamplerState* LinearClampSamplerState = nullptr;
 	ID3D11SamplerState* PointClampSamplerState = nullptr;
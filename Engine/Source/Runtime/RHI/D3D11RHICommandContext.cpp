@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "D3D11RHICommandContext.h"
+#include "D3D11RHI.h"
+
+namespace
+{
+	// 식별자 → 바인딩 크기 (D3D11RHI가 링에서 잘라 쓰는 크기와 같음)
+	uint32 GetConstantBufferBindSize(ERHIConstantBuffer Buffer)
+	{
+#define RHI_CONSTANT_BUFFER_SIZE_CASE(TYPE) \
+	case ERHIConstantBuffer::TYPE: \
+		return sizeof(TYPE);
+
+		switch (Buffer)
+		{
+		CONSTANT_BUFFER_LIST(RHI_CONSTANT_BUFFER_SIZE_CASE)
+		default:
+			return 0;
+		}
+
+#undef RHI_CONSTANT_BUFFER_SIZE_CASE
+	}
+}
+
+void FD3D11RHICommandContext::SetShaders(const FRHICmdSetShaders& Cmd)
+{
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	DeviceContext->IASetInputLayout(Cmd.InputLayout);
+	DeviceContext->VSSetShader(Cmd.VertexShader, nullptr, 0);
+	DeviceContext->PSSetShader(Cmd.PixelShader, nullptr, 0);
+}
+
+void FD3D11RHICommandContext::SetVertexShader(const FRHICmdSetVertexShader& Cmd)
+{
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	DeviceContext->IASetInputLayout(Cmd.InputLayout);
+	DeviceContext->VSSetShader(Cmd.VertexShader, nullptr, 0);
+}
+
+void FD3D11RHICommandContext::SetPixelResources(const FRHICmdSetPixelResources& Cmd)
+{
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	if (Cmd.NumSRVs > 0)
+	{
+		DeviceContext->PSSetShaderResources(0, Cmd.NumSRVs, Cmd.SRVs);
+	}
+	if (Cmd.NumSamplers > 0)
+	{
+		DeviceContext->PSSetSamplers(0, Cmd.NumSamplers, Cmd.Samplers);
+	}
+}
+
+void FD3D11RHICommandContext::SetStreams(const FRHICmdSetStreams& Cmd)
+{
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	UINT Stride = Cmd.Stride;
+	UINT Offset = 0;
+	DeviceContext->IASetVertexBuffers(0, 1, &Cmd.VertexBuffer, &Stride, &Offset);
+	DeviceContext->IASetIndexBuffer(Cmd.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	DeviceContext->IASetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(Cmd.Topology));
+}
+
+void FD3D11RHICommandContext::SetVertexStream(const FRHICmdSetVertexStream& Cmd)
+{
+	UINT Stride = Cmd.Stride;
+	UINT Offset = 0;
+	RHIDevice->GetDeviceContext()->IASetVertexBuffers(Cmd.Slot, 1, &Cmd.Buffer, &Stride, &Offset);
+}
+
+void FD3D11RHICommandContext::SetVSResource(const FRHICmdSetVSResource& Cmd)
+{
+	RHIDevice->GetDeviceContext()->VSSetShaderResources(Cmd.Slot, 1, &Cmd.SRV);
+}
+
+void FD3D11RHICommandContext::UpdateConstantBuffer(ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize)
+{
+	// 미리 올려 둔 위치가 있으면 다음 갱신이 Map 없이 그 위치를 바인딩
+	if (NextPreparedOffset < PreparedOffsets.Num())
+	{
+		RHIDevice->SetPreparedConstantUpload(PreparedOffsets[NextPreparedOffset++]);
+	}
+
+	// 식별자 → D3D11RHI의 타입별 SetAndUpdateConstantBuffer (CONSTANT_BUFFER_LIST에서 생성)
+#define RHI_SET_UPDATE_CONSTANT_BUFFER_CASE(TYPE) \
+	case ERHIConstantBuffer::TYPE: \
+		RHIDevice->SetAndUpdateConstantBuffer(*static_cast<const TYPE*>(Data)); \
+		break;
+#define RHI_SET_UPDATE_CONSTANT_BUFFER_POINTER_CASE(TYPE) \
+	case ERHIConstantBuffer::TYPE: \
+		RHIDevice->SetAndUpdateConstantBuffer_Pointer_##TYPE(const_cast<void*>(Data), std::min<size_t>(DataSize, sizeof(TYPE))); \
+		break;
+
+	switch (Buffer)
+	{
+	CONSTANT_BUFFER_LIST_SMALL(RHI_SET_UPDATE_CONSTANT_BUFFER_CASE)
+	CONSTANT_BUFFER_LIST_LARGE(RHI_SET_UPDATE_CONSTANT_BUFFER_POINTER_CASE)
+	default:
+		break;
+	}
+
+#undef RHI_SET_UPDATE_CONSTANT_BUFFER_CASE
+#undef RHI_SET_UPDATE_CONSTANT_BUFFER_POINTER_CASE
+}
+
+void FD3D11RHICommandContext::SetDepthStencilState(const FRHICmdSetDepthStencilState& Cmd)
+{
+	RHIDevice->OMSetDepthStencilState(static_cast<EComparisonFunc>(Cmd.ComparisonFunc));
+}
+
+void FD3D11RHICommandContext::SetRasterizerState(const FRHICmdSetRasterizerState& Cmd)
+{
+	RHIDevice->RSSetState(static_cast<ERasterizerMode>(Cmd.RasterizerMode));
+}
+
+void FD3D11RHICommandContext::SetBlendState(const FRHICmdSetBlendState& Cmd)
+{
+	RHIDevice->OMSetBlendState(Cmd.bEnableBlend != 0, Cmd.bAccumulate != 0);
+}
+
+void FD3D11RHICommandContext::DrawIndexed(const FRHICmdDrawIndexed& Cmd)
+{
+	RHIDevice->GetDeviceContext()->DrawIndexed(Cmd.IndexCount, Cmd.StartIndex, Cmd.BaseVertex);
+}
+
+void FD3D11RHICommandContext::DrawIndexedInstanced(const FRHICmdDrawIndexedInstanced& Cmd)
+{
+	RHIDevice->GetDeviceContext()->DrawIndexedInstanced(Cmd.IndexCount, Cmd.InstanceCount, Cmd.StartIndex, Cmd.BaseVertex, Cmd.StartInstance);
+}
+
+void FD3D11RHICommandContext::PrepareConstantUploads(const FRHICommandList* Lists, int32 NumLists)
+{
+	PreparedOffsets.Empty();
+	NextPreparedOffset = 0;
+
+	uint32 TotalBytes = 0;
+	for (int32 ListIndex = 0; ListIndex < NumLists; ++ListIndex)
+	{
+		Lists[ListIndex].ForEachConstantBufferUpdate([this, &TotalBytes](ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize)
+		{
+			TotalBytes += RHIDevice->GetConstantUploadAlignedSize(GetConstantBufferBindSize(Buffer));
+		});
+	}
+
+	// 링이 없거나 이번 프레임에 남은 공간이 모자라면 명령마다 기존 경로로 올림 (링 → 전용 버퍼)
+	uint32 BaseOffset = 0;
+	uint8* Dest = RHIDevice->BeginConstantUploadBatch(TotalBytes, BaseOffset);
+	if (!Dest)
+	{
+		return;
+	}
+
+	uint32 Cursor = 0;
+	for (int32 ListIndex = 0; ListIndex < NumLists; ++ListIndex)
+	{
+		Lists[ListIndex].ForEachConstantBufferUpdate([this, Dest, BaseOffset, &Cursor](ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize)
+		{
+			const uint32 BindSize = GetConstantBufferBindSize(Buffer);
+			std::memcpy(Dest + Cursor, Data, std::min(DataSize, BindSize));
+			PreparedOffsets.Add(BaseOffset + Cursor);
+			Cursor += RHIDevice->GetConstantUploadAlignedSize(BindSize);
+		});
+	}
+
+	RHIDevice->EndConstantUploadBatch();
+}
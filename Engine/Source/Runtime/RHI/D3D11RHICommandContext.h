@@ -0,0 +1,37 @@
+#pragma once
+#include "RHICommandList.h"
+
+class D3D11RHI;
+
+/**
+ * @brief 명령 스트림을 D3D11 즉시 컨텍스트로 실행하는 백엔드
+ * @details 상수 버퍼는 D3D11RHI가 가진 타입별 버퍼/슬롯(CONSTANT_BUFFER_INFO)으로 갱신·바인딩한다.
+ * 업로드 링이 있으면 PrepareConstantUploads에서 패스 전체의 상수를 링의 연속 영역에 한 번의 NO_OVERWRITE Map으로 쓰고,
+ * 실행 중에는 명령 순서대로 그 오프셋을 바인딩만 한다 (드로우마다 Map하지 않음).
+ */
+class FD3D11RHICommandContext : public IRHICommandContext
+{
+public:
+	explicit FD3D11RHICommandContext(D3D11RHI* InRHIDevice) : RHIDevice(InRHIDevice) {}
+
+	void SetShaders(const FRHICmdSetShaders& Cmd) override;
+	void SetVertexShader(const FRHICmdSetVertexShader& Cmd) override;
+	void SetPixelResources(const FRHICmdSetPixelResources& Cmd) override;
+	void SetStreams(const FRHICmdSetStreams& Cmd) override;
+	void SetVertexStream(const FRHICmdSetVertexStream& Cmd) override;
+	void SetVSResource(const FRHICmdSetVSResource& Cmd) override;
+	void UpdateConstantBuffer(ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize) override;
+	void SetDepthStencilState(const FRHICmdSetDepthStencilState& Cmd) override;
+	void SetRasterizerState(const FRHICmdSetRasterizerState& Cmd) override;
+	void SetBlendState(const FRHICmdSetBlendState& Cmd) override;
+	void DrawIndexed(const FRHICmdDrawIndexed& Cmd) override;
+	void DrawIndexedInstanced(const FRHICmdDrawIndexedInstanced& Cmd) override;
+	void PrepareConstantUploads(const FRHICommandList* Lists, int32 NumLists) override;
+
+private:
+	D3D11RHI* RHIDevice = nullptr;
+
+	// PrepareConstantUploads가 미리 쓴 링 오프셋 (상수 버퍼 갱신 명령 순서, 링이 모자라면 비어 있음)
+	TArray<uint32> PreparedOffsets;
+	int32 NextPreparedOffset = 0;
+};
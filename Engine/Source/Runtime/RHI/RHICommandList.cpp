@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "RHICommandList.h"
+
+void FRHICommandList::SetPixelResources(uint32 NumSRVs, ID3D11ShaderResourceView* const* SRVs, uint32 NumSamplers, ID3D11SamplerState* const* Samplers)
+{
+	FRHICmdSetPixelResources& Cmd = Alloc<FRHICmdSetPixelResources>(ERHICommandType::SetPixelResources);
+	Cmd.NumSRVs = std::min(NumSRVs, FRHICmdSetPixelResources::MaxSlots);
+	Cmd.NumSamplers = std::min(NumSamplers, FRHICmdSetPixelResources::MaxSlots);
+	for (uint32 Slot = 0; Slot < FRHICmdSetPixelResources::MaxSlots; ++Slot)
+	{
+		Cmd.SRVs[Slot] = Slot < Cmd.NumSRVs ? SRVs[Slot] : nullptr;
+		Cmd.Samplers[Slot] = Slot < Cmd.NumSamplers ? Samplers[Slot] : nullptr;
+	}
+}
+
+uint8* FRHICommandList::Grow(uint32 Size)
+{
+	const uint32 Required = UsedBytes + Size;
+	if (Required > static_cast<uint32>(Data.Num()))
+	{
+		// 2배씩 키워 기록 중 재할당 횟수를 줄임 (용량은 Reset 후에도 유지)
+		uint32 NewSize = std::max(static_cast<uint32>(Data.Num()) * 2, 64u * 1024u);
+		while (NewSize < Required)
+		{
+			NewSize *= 2;
+		}
+		Data.SetNum(NewSize);
+	}
+
+	uint8* Base = Data.data() + UsedBytes;
+	UsedBytes = Required;
+	return Base;
+}
+
+void FRHICommandList::Execute(IRHICommandContext& Context) const
+{
+	const uint8* It = Data.data();
+	const uint8* End = It + UsedBytes;
+
+	while (It < End)
+	{
+		const FHeader& Header = *reinterpret_cast<const FHeader*>(It);
+		const uint8* Payload = It + HeaderSize;
+
+		switch (Header.Type)
+		{
+		case ERHICommandType::SetShaders:
+			Context.SetShaders(*reinterpret_cast<const FRHICmdSetShaders*>(Payload));
+			break;
+		case ERHICommandType::SetVertexShader:
+			Context.SetVertexShader(*reinterpret_cast<const FRHICmdSetVertexShader*>(Payload));
+			break;
+		case ERHICommandType::SetPixelResources:
+			Context.SetPixelResources(*reinterpret_cast<const FRHICmdSetPixelResources*>(Payload));
+			break;
+		case ERHICommandType::SetStreams:
+			Context.SetStreams(*reinterpret_cast<const FRHICmdSetStreams*>(Payload));
+			break;
+		case ERHICommandType::SetVertexStream:
+			Context.SetVertexStream(*reinterpret_cast<const FRHICmdSetVertexStream*>(Payload));
+			break;
+		case ERHICommandType::SetVSResource:
+			Context.SetVSResource(*reinterpret_cast<const FRHICmdSetVSResource*>(Payload));
+			break;
+		case ERHICommandType::UpdateConstantBuffer:
+		{
+			const FRHICmdUpdateConstantBuffer& Cmd = *reinterpret_cast<const FRHICmdUpdateConstantBuffer*>(Payload);
+			const uint8* CmdData = Payload + AlignUp(sizeof(FRHICmdUpdateConstantBuffer));
+			Context.UpdateConstantBuffer(Cmd.Buffer, CmdData, Cmd.DataSize);
+			break;
+		}
+		case ERHICommandType::UpdateConstantBufferPointer:
+		{
+			const FRHICmdUpdateConstantBufferPointer& Cmd = *reinterpret_cast<const FRHICmdUpdateConstantBufferPointer*>(Payload);
+			Context.UpdateConstantBuffer(Cmd.Buffer, Cmd.Data, Cmd.DataSize);
+			break;
+		}
+		case ERHICommandType::SetDepthStencilState:
+			Context.SetDepthStencilState(*reinterpret_cast<const FRHICmdSetDepthStencilState*>(Payload));
+			break;
+		case ERHICommandType::SetRasterizerState:
+			Context.SetRasterizerState(*reinterpret_cast<const FRHICmdSetRasterizerState*>(Payload));
+			break;
+		case ERHICommandType::SetBlendState:
+			Context.SetBlendState(*reinterpret_cast<const FRHICmdSetBlendState*>(Payload));
+			break;
+		case ERHICommandType::DrawIndexed:
+			Context.DrawIndexed(*reinterpret_cast<const FRHICmdDrawIndexed*>(Payload));
+			break;
+		case ERHICommandType::DrawIndexedInstanced:
+			Context.DrawIndexedInstanced(*reinterpret_cast<const FRHICmdDrawIndexedInstanced*>(Payload));
+			break;
+		}
+
+		It += Header.Size;
+	}
+}
+
+// ─────────────── Null 백엔드
+
+void FNullRHICommandContext::UpdateConstantBuffer(ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize)
+{
+	++Stats.NumCommands;
+	++Stats.NumConstantBufferUpdates;
+	Stats.ConstantBufferBytes += DataSize;
+}
+
+void FNullRHICommandContext::DrawIndexed(const FRHICmdDrawIndexed& Cmd)
+{
+	++Stats.NumCommands;
+	++Stats.NumDraws;
+	Stats.NumIndices += Cmd.IndexCount;
+}
+
+void FNullRHICommandContext::DrawIndexedInstanced(const FRHICmdDrawIndexedInstanced& Cmd)
+{
+	++Stats.NumCommands;
+	++Stats.NumDraws;
+	Stats.NumIndices += static_cast<uint64>(Cmd.IndexCount) * Cmd.InstanceCount;
+}
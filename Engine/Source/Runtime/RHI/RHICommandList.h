@@ -0,0 +1,374 @@
+#pragma once
+#include "ConstantBufferType.h"
+
+// 명령 스트림은 백엔드 핸들을 비교/전달만 하고 역참조하지 않음 (Null 백엔드는 가짜 포인터로도 실행 가능)
+struct ID3D11Buffer;
+struct ID3D11InputLayout;
+struct ID3D11VertexShader;
+struct ID3D11PixelShader;
+struct ID3D11ShaderResourceView;
+struct ID3D11SamplerState;
+
+// 상수 버퍼 식별자 (CONSTANT_BUFFER_LIST와 1:1, 백엔드가 실제 버퍼/슬롯으로 변환)
+#define DECLARE_RHI_CONSTANT_BUFFER_ID(TYPE) TYPE,
+enum class ERHIConstantBuffer : uint8
+{
+	CONSTANT_BUFFER_LIST(DECLARE_RHI_CONSTANT_BUFFER_ID)
+	Count
+};
+#undef DECLARE_RHI_CONSTANT_BUFFER_ID
+
+// 상수 버퍼 구조체 타입 → 식별자 (기록 시점에 컴파일 타임으로 결정)
+template<typename T>
+struct TRHIConstantBufferId;
+
+#define DECLARE_RHI_CONSTANT_BUFFER_TRAITS(TYPE) \
+template<> struct TRHIConstantBufferId<TYPE> { static constexpr ERHIConstantBuffer Value = ERHIConstantBuffer::TYPE; };
+CONSTANT_BUFFER_LIST(DECLARE_RHI_CONSTANT_BUFFER_TRAITS)
+#undef DECLARE_RHI_CONSTANT_BUFFER_TRAITS
+
+enum class ERHICommandType : uint8
+{
+	SetShaders,						// IL + VS + PS
+	SetVertexShader,				// IL + VS (PS 유지, 섀도우 깊이 패스)
+	SetPixelResources,				// PS SRV + 샘플러
+	SetStreams,						// 슬롯 0 VB + IB + 토폴로지
+	SetVertexStream,				// 추가 정점 스트림 (슬롯 1 인스턴스 버퍼)
+	SetVSResource,					// VS SRV 하나 (클로스)
+	UpdateConstantBuffer,			// 데이터를 명령 스트림에 복사
+	UpdateConstantBufferPointer,	// 실행 시점까지 유효한 외부 데이터 참조 (스키닝 행렬 등 큰 버퍼)
+	SetDepthStencilState,
+	SetRasterizerState,
+	SetBlendState,
+	DrawIndexed,
+	DrawIndexedInstanced,
+};
+
+struct FRHICmdSetShaders
+{
+	ID3D11InputLayout* InputLayout;
+	ID3D11VertexShader* VertexShader;
+	ID3D11PixelShader* PixelShader;
+};
+
+struct FRHICmdSetVertexShader
+{
+	ID3D11InputLayout* InputLayout;
+	ID3D11VertexShader* VertexShader;
+};
+
+struct FRHICmdSetPixelResources
+{
+	static constexpr uint32 MaxSlots = 4;
+
+	uint32 NumSRVs;
+	uint32 NumSamplers;
+	ID3D11ShaderResourceView* SRVs[MaxSlots];	// 슬롯 0부터
+	ID3D11SamplerState* Samplers[MaxSlots];		// 슬롯 0부터
+};
+
+struct FRHICmdSetStreams
+{
+	ID3D11Buffer* VertexBuffer;
+	ID3D11Buffer* IndexBuffer;	// R32_UINT
+	uint32 Stride;
+	uint32 Topology;			// D3D11_PRIMITIVE_TOPOLOGY
+};
+
+struct FRHICmdSetVertexStream
+{
+	ID3D11Buffer* Buffer;
+	uint32 Slot;
+	uint32 Stride;
+};
+
+struct FRHICmdSetVSResource
+{
+	ID3D11ShaderResourceView* SRV;
+	uint32 Slot;
+};
+
+struct FRHICmdUpdateConstantBuffer
+{
+	ERHIConstantBuffer Buffer;
+	uint32 DataSize;	// 명령 바로 뒤(16바이트 정렬)에 데이터가 이어짐
+};
+
+struct FRHICmdUpdateConstantBufferPointer
+{
+	ERHIConstantBuffer Buffer;
+	uint32 DataSize;
+	const void* Data;
+};
+
+struct FRHICmdSetDepthStencilState
+{
+	uint32 ComparisonFunc;	// EComparisonFunc
+};
+
+struct FRHICmdSetRasterizerState
+{
+	uint32 RasterizerMode;	// ERasterizerMode
+};
+
+struct FRHICmdSetBlendState
+{
+	uint32 bEnableBlend;	// D3D11RHI::OMSetBlendState의 bIsBlendMode
+	uint32 bAccumulate;		// 가산 블렌드
+};
+
+struct FRHICmdDrawIndexed
+{
+	uint32 IndexCount;
+	uint32 StartIndex;
+	int32 BaseVertex;
+};
+
+struct FRHICmdDrawIndexedInstanced
+{
+	uint32 IndexCount;
+	uint32 InstanceCount;
+	uint32 StartIndex;
+	int32 BaseVertex;
+	uint32 StartInstance;
+};
+
+class FRHICommandList;
+
+/**
+ * @brief 명령 스트림을 실제로 수행하는 백엔드 인터페이스
+ * @details FD3D11RHICommandContext는 디바이스 컨텍스트로, FNullRHICommandContext는 디바이스 없이 실행한다.
+ * 실행은 항상 한 스레드(렌더 스레드)에서 기록 순서대로 이루어진다.
+ */
+class IRHICommandContext
+{
+public:
+	virtual ~IRHICommandContext() = default;
+
+	virtual void SetShaders(const FRHICmdSetShaders& Cmd) = 0;
+	virtual void SetVertexShader(const FRHICmdSetVertexShader& Cmd) = 0;
+	virtual void SetPixelResources(const FRHICmdSetPixelResources& Cmd) = 0;
+	virtual void SetStreams(const FRHICmdSetStreams& Cmd) = 0;
+	virtual void SetVertexStream(const FRHICmdSetVertexStream& Cmd) = 0;
+	virtual void SetVSResource(const FRHICmdSetVSResource& Cmd) = 0;
+	virtual void UpdateConstantBuffer(ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize) = 0;
+	virtual void SetDepthStencilState(const FRHICmdSetDepthStencilState& Cmd) = 0;
+	virtual void SetRasterizerState(const FRHICmdSetRasterizerState& Cmd) = 0;
+	virtual void SetBlendState(const FRHICmdSetBlendState& Cmd) = 0;
+	virtual void DrawIndexed(const FRHICmdDrawIndexed& Cmd) = 0;
+	virtual void DrawIndexedInstanced(const FRHICmdDrawIndexedInstanced& Cmd) = 0;
+
+	/**
+	 * @brief 한 패스의 목록들을 실행하기 직전에 한 번 호출
+	 * @details 백엔드가 패스 전체의 상수 버퍼 내용을 미리 한 번에 올려 둘 수 있다 (기본은 아무것도 하지 않음).
+	 */
+	virtual void PrepareConstantUploads(const FRHICommandList* Lists, int32 NumLists) {}
+};
+
+/**
+ * @brief 타입이 정해진 렌더 명령을 선형 버퍼에 기록하는 명령 목록
+ * @details 명령은 [헤더 16B][명령 구조체][추가 데이터] 형태로 16바이트 정렬되어 이어 붙는다.
+ * 한 목록은 한 스레드만 기록하며, 버퍼 용량은 Reset 후에도 유지되어 프레임마다 재할당하지 않는다.
+ * 여러 스레드가 각자 목록을 기록한 뒤, 렌더 스레드가 목록 순서대로 Execute한다.
+ */
+class FRHICommandList
+{
+public:
+	void Reset()
+	{
+		UsedBytes = 0;
+		NumCommands = 0;
+	}
+
+	void SetShaders(ID3D11InputLayout* InputLayout, ID3D11VertexShader* VertexShader, ID3D11PixelShader* PixelShader)
+	{
+		Alloc<FRHICmdSetShaders>(ERHICommandType::SetShaders) = { InputLayout, VertexShader, PixelShader };
+	}
+
+	void SetVertexShader(ID3D11InputLayout* InputLayout, ID3D11VertexShader* VertexShader)
+	{
+		Alloc<FRHICmdSetVertexShader>(ERHICommandType::SetVertexShader) = { InputLayout, VertexShader };
+	}
+
+	void SetPixelResources(uint32 NumSRVs, ID3D11ShaderResourceView* const* SRVs, uint32 NumSamplers, ID3D11SamplerState* const* Samplers);
+
+	void SetStreams(ID3D11Buffer* VertexBuffer, ID3D11Buffer* IndexBuffer, uint32 Stride, uint32 Topology)
+	{
+		Alloc<FRHICmdSetStreams>(ERHICommandType::SetStreams) = { VertexBuffer, IndexBuffer, Stride, Topology };
+	}
+
+	void SetVertexStream(uint32 Slot, ID3D11Buffer* Buffer, uint32 Stride)
+	{
+		Alloc<FRHICmdSetVertexStream>(ERHICommandType::SetVertexStream) = { Buffer, Slot, Stride };
+	}
+
+	void SetVSResource(uint32 Slot, ID3D11ShaderResourceView* SRV)
+	{
+		Alloc<FRHICmdSetVSResource>(ERHICommandType::SetVSResource) = { SRV, Slot };
+	}
+
+	// 상수 버퍼 내용을 명령 스트림에 복사 (D3D11RHI::SetAndUpdateConstantBuffer에 대응)
+	template<typename T>
+	void SetAndUpdateConstantBuffer(const T& Data)
+	{
+		void* Dest = nullptr;
+		FRHICmdUpdateConstantBuffer& Cmd = Alloc<FRHICmdUpdateConstantBuffer>(ERHICommandType::UpdateConstantBuffer, sizeof(T), &Dest);
+		Cmd.Buffer = TRHIConstantBufferId<T>::Value;
+		Cmd.DataSize = sizeof(T);
+		std::memcpy(Dest, &Data, sizeof(T));
+	}
+
+	// 실행 시점까지 유효한 데이터를 참조만 함 (복사 비용이 큰 스키닝 행렬 등)
+	template<typename T>
+	void SetAndUpdateConstantBufferPointer(const void* Data, uint32 DataSize)
+	{
+		Alloc<FRHICmdUpdateConstantBufferPointer>(ERHICommandType::UpdateConstantBufferPointer) = { TRHIConstantBufferId<T>::Value, DataSize, Data };
+	}
+
+	void SetDepthStencilState(uint32 ComparisonFunc)
+	{
+		Alloc<FRHICmdSetDepthStencilState>(ERHICommandType::SetDepthStencilState) = { ComparisonFunc };
+	}
+
+	void SetRasterizerState(uint32 RasterizerMode)
+	{
+		Alloc<FRHICmdSetRasterizerState>(ERHICommandType::SetRasterizerState) = { RasterizerMode };
+	}
+
+	void SetBlendState(bool bEnableBlend, bool bAccumulate)
+	{
+		Alloc<FRHICmdSetBlendState>(ERHICommandType::SetBlendState) = { bEnableBlend ? 1u : 0u, bAccumulate ? 1u : 0u };
+	}
+
+	void DrawIndexed(uint32 IndexCount, uint32 StartIndex, int32 BaseVertex)
+	{
+		Alloc<FRHICmdDrawIndexed>(ERHICommandType::DrawIndexed) = { IndexCount, StartIndex, BaseVertex };
+	}
+
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 InstanceCount, uint32 StartIndex, int32 BaseVertex, uint32 StartInstance)
+	{
+		Alloc<FRHICmdDrawIndexedInstanced>(ERHICommandType::DrawIndexedInstanced) = { IndexCount, InstanceCount, StartIndex, BaseVertex, StartInstance };
+	}
+
+	// 기록된 명령을 순서대로 Context에 전달
+	void Execute(IRHICommandContext& Context) const;
+
+	// 기록된 상수 버퍼 갱신만 순서대로 Visit(Buffer, Data, DataSize)로 전달 (실행 전에 업로드를 모을 때)
+	template<typename FunctionType>
+	void ForEachConstantBufferUpdate(FunctionType&& Visit) const
+	{
+		const uint8* It = Data.data();
+		const uint8* End = It + UsedBytes;
+
+		while (It < End)
+		{
+			const FHeader& Header = *reinterpret_cast<const FHeader*>(It);
+			const uint8* Payload = It + HeaderSize;
+
+			if (Header.Type == ERHICommandType::UpdateConstantBuffer)
+			{
+				const FRHICmdUpdateConstantBuffer& Cmd = *reinterpret_cast<const FRHICmdUpdateConstantBuffer*>(Payload);
+				Visit(Cmd.Buffer, static_cast<const void*>(Payload + AlignUp(sizeof(FRHICmdUpdateConstantBuffer))), Cmd.DataSize);
+			}
+			else if (Header.Type == ERHICommandType::UpdateConstantBufferPointer)
+			{
+				const FRHICmdUpdateConstantBufferPointer& Cmd = *reinterpret_cast<const FRHICmdUpdateConstantBufferPointer*>(Payload);
+				Visit(Cmd.Buffer, Cmd.Data, Cmd.DataSize);
+			}
+
+			It += Header.Size;
+		}
+	}
+
+	uint32 GetNumCommands() const { return NumCommands; }
+	uint32 GetUsedBytes() const { return UsedBytes; }
+	bool IsEmpty() const { return NumCommands == 0; }
+
+private:
+	struct FHeader
+	{
+		ERHICommandType Type;
+		uint32 Size;	// 헤더 포함 전체 크기 (다음 명령까지의 거리)
+	};
+	static constexpr uint32 Alignment = 16;
+	static constexpr uint32 HeaderSize = 16;
+	static_assert(sizeof(FHeader) <= HeaderSize, "FHeader must fit in HeaderSize");
+
+	static constexpr uint32 AlignUp(uint32 Value) { return (Value + Alignment - 1) & ~(Alignment - 1); }
+
+	// 명령 하나의 공간을 확보하고 헤더를 기록 (반환한 참조는 다음 Alloc 전까지 유효)
+	template<typename TCmd>
+	TCmd& Alloc(ERHICommandType Type, uint32 ExtraBytes = 0, void** OutExtraData = nullptr)
+	{
+		static_assert(std::is_trivially_copyable_v<TCmd>, "RHI commands must be trivially copyable");
+		const uint32 CmdOffset = HeaderSize;
+		const uint32 ExtraOffset = CmdOffset + AlignUp(sizeof(TCmd));
+		const uint32 Size = AlignUp(ExtraOffset + ExtraBytes);
+
+		uint8* Base = Grow(Size);
+		++NumCommands;
+
+		FHeader* Header = reinterpret_cast<FHeader*>(Base);
+		Header->Type = Type;
+		Header->Size = Size;
+		if (OutExtraData)
+		{
+			*OutExtraData = Base + ExtraOffset;
+		}
+		return *reinterpret_cast<TCmd*>(Base + CmdOffset);
+	}
+
+	// 버퍼 끝에 Size 바이트를 확보하고 시작 주소를 반환
+	uint8* Grow(uint32 Size);
+
+	TArray<uint8> Data;
+	uint32 UsedBytes = 0;
+	uint32 NumCommands = 0;
+};
+
+// Null 백엔드가 실행한 명령 통계 (헤드리스 벤치마크 검증용)
+struct FNullRHIStats
+{
+	uint32 NumCommands = 0;
+	uint32 NumStateCommands = 0;
+	uint32 NumConstantBufferUpdates = 0;
+	uint64 ConstantBufferBytes = 0;
+	uint32 NumDraws = 0;
+	uint64 NumIndices = 0;
+
+	void Reset() { *this = FNullRHIStats(); }
+};
+
+/**
+ * @brief 디바이스 없이 명령 스트림을 실행하는 백엔드
+ * @details GPU가 없는 빌드 에이전트에서 프록시 수집 → 배치 생성 → 명령 기록/실행까지의 CPU 비용을 측정하기 위함.
+ * 각 명령은 통계만 갱신하고 핸들은 역참조하지 않는다.
+ */
+class FNullRHICommandContext : public IRHICommandContext
+{
+public:
+	void SetShaders(const FRHICmdSetShaders& Cmd) override { CountState(); }
+	void SetVertexShader(const FRHICmdSetVertexShader& Cmd) override { CountState(); }
+	void SetPixelResources(const FRHICmdSetPixelResources& Cmd) override { CountState(); }
+	void SetStreams(const FRHICmdSetStreams& Cmd) override { CountState(); }
+	void SetVertexStream(const FRHICmdSetVertexStream& Cmd) override { CountState(); }
+	void SetVSResource(const FRHICmdSetVSResource& Cmd) override { CountState(); }
+	void UpdateConstantBuffer(ERHIConstantBuffer Buffer, const void* Data, uint32 DataSize) override;
+	void SetDepthStencilState(const FRHICmdSetDepthStencilState& Cmd) override { CountState(); }
+	void SetRasterizerState(const FRHICmdSetRasterizerState& Cmd) override { CountState(); }
+	void SetBlendState(const FRHICmdSetBlendState& Cmd) override { CountState(); }
+	void DrawIndexed(const FRHICmdDrawIndexed& Cmd) override;
+	void DrawIndexedInstanced(const FRHICmdDrawIndexedInstanced& Cmd) override;
+
+	const FNullRHIStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+private:
+	void CountState()
+	{
+		++Stats.NumCommands;
+		++Stats.NumStateCommands;
+	}
+
+	FNullRHIStats Stats;
+};
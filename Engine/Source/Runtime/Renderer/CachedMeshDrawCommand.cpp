@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "CachedMeshDrawCommand.h"
+#include "PrimitiveComponent.h"
+#include "Material.h"
+
+namespace
+{
+	// 0은 "아직 만들지 않음"과 구분하기 위해 사용하지 않음
+	uint64 GMeshDrawCommandGlobalRevision = 1;
+}
+
+bool FCachedMeshDrawCommandList::IsUpToDate(const void* InMeshAsset, ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer,
+	const UPrimitiveComponent* Component, uint32 NumSections) const
+{
+	if (MeshAsset != InMeshAsset || VertexBuffer != InVertexBuffer || IndexBuffer != InIndexBuffer
+		|| SectionMaterials.Num() != static_cast<int32>(NumSections))
+	{
+		return false;
+	}
+
+	for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		UMaterialInterface* Material = Component->GetMaterial(SectionIndex);
+		if (SectionMaterials[SectionIndex] != Material)
+		{
+			return false;
+		}
+		if (SectionShaders[SectionIndex] != (Material ? Material->GetShader() : nullptr))
+		{
+			return false;
+		}
+		if (SectionMaterialRevisions[SectionIndex] != (Material ? Material->GetDrawStateRevision() : 0))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FCachedMeshDrawCommandList::RecordInputs(const void* InMeshAsset, ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer,
+	const UPrimitiveComponent* Component, uint32 NumSections)
+{
+	MeshAsset = InMeshAsset;
+	VertexBuffer = InVertexBuffer;
+	IndexBuffer = InIndexBuffer;
+
+	SectionMaterials.SetNum(static_cast<int32>(NumSections));
+	SectionShaders.SetNum(static_cast<int32>(NumSections));
+	SectionMaterialRevisions.SetNum(static_cast<int32>(NumSections));
+	for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		UMaterialInterface* Material = Component->GetMaterial(SectionIndex);
+		SectionMaterials[SectionIndex] = Material;
+		SectionShaders[SectionIndex] = Material ? Material->GetShader() : nullptr;
+		SectionMaterialRevisions[SectionIndex] = Material ? Material->GetDrawStateRevision() : 0;
+	}
+}
+
+FCachedMeshDrawCommandList* FCachedMeshDrawCommandSet::Find(uint64 ViewMacroKey)
+{
+	for (FCachedMeshDrawCommandList& List : Lists)
+	{
+		if (List.ViewMacroKey == ViewMacroKey && List.GlobalRevision == GMeshDrawCommandGlobalRevision)
+		{
+			return &List;
+		}
+	}
+	return nullptr;
+}
+
+FCachedMeshDrawCommandList& FCachedMeshDrawCommandSet::Allocate(uint64 ViewMacroKey)
+{
+	FCachedMeshDrawCommandList* Target = nullptr;
+
+	// 같은 키(무효화된 목록)나 전역 리비전이 지난 슬롯을 우선 재사용
+	for (FCachedMeshDrawCommandList& List : Lists)
+	{
+		if (List.ViewMacroKey == ViewMacroKey || List.GlobalRevision != GMeshDrawCommandGlobalRevision)
+		{
+			Target = &List;
+			break;
+		}
+	}
+
+	if (!Target)
+	{
+		if (Lists.Num() < MaxViewMacroSets)
+		{
+			Target = &Lists.emplace_back();
+		}
+		else
+		{
+			Target = &Lists[NextEvictIndex];
+			NextEvictIndex = (NextEvictIndex + 1) % MaxViewMacroSets;
+		}
+	}
+
+	Target->Reset();
+	Target->ViewMacroKey = ViewMacroKey;
+	Target->GlobalRevision = GMeshDrawCommandGlobalRevision;
+	return *Target;
+}
+
+void FCachedMeshDrawCommandSet::Invalidate()
+{
+	Lists.Empty();
+	NextEvictIndex = 0;
+}
+
+void FCachedMeshDrawCommandSet::AppendTo(const FCachedMeshDrawCommandList& List, const FMatrix& WorldMatrix, uint32 ObjectID, TArray<FMeshBatchElement>& OutMeshBatchElements)
+{
+	for (const FMeshBatchElement& Command : List.Commands)
+	{
+		FMeshBatchElement& BatchElement = OutMeshBatchElements.emplace_back(Command);
+		BatchElement.WorldMatrix = WorldMatrix;
+		BatchElement.ObjectID = ObjectID;
+	}
+}
+
+void FCachedMeshDrawCommandSet::InvalidateAll()
+{
+	++GMeshDrawCommandGlobalRevision;
+}
+
+uint64 FCachedMeshDrawCommandSet::GetGlobalRevision()
+{
+	return GMeshDrawCommandGlobalRevision;
+}
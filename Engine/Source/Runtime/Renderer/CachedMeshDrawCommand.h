@@ -0,0 +1,90 @@
+#pragma once
+#include "MeshBatchElement.h"
+
+class UShader;
+class UMaterialInterface;
+class UPrimitiveComponent;
+
+/**
+ * @brief 한 뷰 모드 매크로 조합에 대해 캐시된 프리미티브의 드로우 커맨드 목록
+ * @details 유효성 검사를 위해 만들 때 사용한 입력(메시 에셋, 버퍼, 섹션별 머티리얼/셰이더/머티리얼 리비전)을 함께 기록한다.
+ * 입력 포인터는 비교용으로만 사용한다.
+ */
+struct FCachedMeshDrawCommandList
+{
+	uint64 ViewMacroKey = 0;
+	uint64 GlobalRevision = 0;
+
+	const void* MeshAsset = nullptr;
+	ID3D11Buffer* VertexBuffer = nullptr;
+	ID3D11Buffer* IndexBuffer = nullptr;
+
+	// 섹션별 입력 (GetMaterial 결과, 기본 머티리얼로 대체하기 전 값)
+	TArray<UMaterialInterface*> SectionMaterials;
+	TArray<UShader*> SectionShaders;
+	TArray<uint32> SectionMaterialRevisions;	// UMaterialInterface::GetDrawStateRevision
+
+	// 셰이더 변형, 머티리얼, 버퍼, 드로우 범위까지 채워진 배치 (WorldMatrix/ObjectID는 AppendTo에서 갱신)
+	TArray<FMeshBatchElement> Commands;
+
+	/**
+	 * @brief 기록된 입력이 현재 컴포넌트 상태와 같은지 검사
+	 * @param NumSections 검사할 머티리얼 섹션 수 (GetMaterial(0..NumSections-1))
+	 */
+	bool IsUpToDate(const void* InMeshAsset, ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer,
+		const UPrimitiveComponent* Component, uint32 NumSections) const;
+
+	// 이번에 만들 커맨드의 입력을 기록
+	void RecordInputs(const void* InMeshAsset, ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer,
+		const UPrimitiveComponent* Component, uint32 NumSections);
+
+	void Reset()
+	{
+		MeshAsset = nullptr;
+		VertexBuffer = nullptr;
+		IndexBuffer = nullptr;
+		SectionMaterials.Empty();
+		SectionShaders.Empty();
+		SectionMaterialRevisions.Empty();
+		Commands.Empty();
+	}
+};
+
+/**
+ * @brief 프리미티브 컴포넌트가 소유하는 캐시된 드로우 커맨드 집합
+ * @details CollectMeshBatches가 매 프레임 섹션마다 수행하던
+ * 뷰 매크로 복사 + 머티리얼 매크로 결합 + GetOrCompileShaderVariant(키 해시) + FMeshBatchElement 채우기를
+ * 메시/머티리얼/뷰 모드가 바뀔 때만 수행하고, 평소에는 캐시된 커맨드를 복사하며 월드 행렬과 ObjectID만 갱신한다.
+ *
+ * 무효화:
+ * - 메시 에셋/버퍼, 섹션별 머티리얼/셰이더 포인터가 기록과 다르면 다시 만든다 (컴포넌트가 매 프레임 비교)
+ * - 머티리얼 리로드, 셰이더/매크로 변경처럼 포인터가 같아도 결과가 달라지는 변경은 그 머티리얼의
+ *   리비전(UMaterialInterface::GetDrawStateRevision)이 바뀌므로, 그 머티리얼을 쓰는 목록만 다시 만든다
+ * - 셰이더 핫 리로드는 어느 변형이 바뀌었는지 추적하지 않으므로 InvalidateAll()로 전역 리비전을 올린다
+ * - 에디터 뷰포트마다 뷰 모드가 다를 수 있으므로 뷰 매크로 키별로 MaxViewMacroSets개까지 보관한다
+ *   (뷰포트마다 고른 메시 LOD가 다를 수 있으므로 컴포넌트는 LOD 번호도 키에 섞는다)
+ */
+class FCachedMeshDrawCommandSet
+{
+public:
+	static constexpr int32 MaxViewMacroSets = 8;
+
+	// 전역 리비전까지 일치하는 목록을 찾음, 없으면 nullptr
+	FCachedMeshDrawCommandList* Find(uint64 ViewMacroKey);
+
+	// 새로 채울 목록을 비워서 반환 (가득 차면 가장 오래된 슬롯을 재사용)
+	FCachedMeshDrawCommandList& Allocate(uint64 ViewMacroKey);
+
+	void Invalidate();
+
+	// 캐시된 커맨드를 출력 배열에 추가하면서 인스턴스 데이터만 갱신
+	static void AppendTo(const FCachedMeshDrawCommandList& List, const FMatrix& WorldMatrix, uint32 ObjectID, TArray<FMeshBatchElement>& OutMeshBatchElements);
+
+	// 셰이더 핫 리로드 시 호출 (머티리얼 변경은 머티리얼 리비전으로 처리)
+	static void InvalidateAll();
+	static uint64 GetGlobalRevision();
+
+private:
+	TArray<FCachedMeshDrawCommandList> Lists;
+	int32 NextEvictIndex = 0;
+};
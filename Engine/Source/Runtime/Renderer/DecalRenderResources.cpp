@@ -0,0 +1,311 @@
+#include "pch.h"
+#include "DecalRenderResources.h"
+#include "D3D11RHI.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "SceneView.h"
+#include "CachedMeshDrawCommand.h"
+
+static_assert(sizeof(FDecalRenderResources::FDecalInfo) == 80, "FDecalInfo must match ClusteredDecal_PS.hlsl");
+
+FDecalRenderResources::FDecalRenderResources(D3D11RHI* InRHIDevice)
+	: RHIDevice(InRHIDevice)
+{
+}
+
+FDecalRenderResources::~FDecalRenderResources()
+{
+	for (FAtlasSlice& Slice : Slices)
+	{
+		ReleaseSlice(Slice);
+		if (Slice.RTV)
+		{
+			Slice.RTV->Release();
+			Slice.RTV = nullptr;
+		}
+	}
+	Slices.Empty();
+	SliceByTexture.Empty();
+
+	if (AtlasSRV)
+	{
+		AtlasSRV->Release();
+		AtlasSRV = nullptr;
+	}
+	if (AtlasTexture)
+	{
+		AtlasTexture->Release();
+		AtlasTexture = nullptr;
+	}
+	if (DecalInfoSRV)
+	{
+		DecalInfoSRV->Release();
+		DecalInfoSRV = nullptr;
+	}
+	if (DecalInfoBuffer)
+	{
+		DecalInfoBuffer->Release();
+		DecalInfoBuffer = nullptr;
+	}
+}
+
+void FDecalRenderResources::BeginPass()
+{
+	++PassCounter;
+	NumUploadsThisPass = 0;
+}
+
+int32 FDecalRenderResources::GetTextureSlice(UTexture* Texture)
+{
+	ID3D11ShaderResourceView* SourceSRV = Texture ? Texture->GetShaderResourceView() : nullptr;
+	if (!SourceSRV || (!AtlasTexture && !CreateAtlas()))
+	{
+		return -1;
+	}
+
+	if (const int32* Found = SliceByTexture.Find(Texture))
+	{
+		FAtlasSlice& Slice = Slices[*Found];
+		// 텍스처가 다시 로드되어 SRV가 바뀌었으면 같은 슬라이스에 재업로드
+		if (Slice.SourceSRV != SourceSRV)
+		{
+			Slice.SourceSRV->Release();
+			Slice.SourceSRV = SourceSRV;
+			Slice.SourceSRV->AddRef();
+			PendingUploads.Add(*Found);
+		}
+		Slice.LastUsedPass = PassCounter;
+		return *Found;
+	}
+
+	// 빈 슬라이스, 없으면 이번 패스에 쓰지 않은 슬라이스 중 가장 오래 안 쓴 것
+	int32 Victim = -1;
+	for (int32 i = 0; i < Slices.Num(); ++i)
+	{
+		const FAtlasSlice& Slice = Slices[i];
+		if (!Slice.Texture)
+		{
+			Victim = i;
+			break;
+		}
+		if (Slice.LastUsedPass != PassCounter && (Victim < 0 || Slice.LastUsedPass < Slices[Victim].LastUsedPass))
+		{
+			Victim = i;
+		}
+	}
+	if (Victim < 0)
+	{
+		return -1;
+	}
+
+	FAtlasSlice& Slice = Slices[Victim];
+	if (Slice.Texture)
+	{
+		SliceByTexture.Remove(Slice.Texture);
+		ReleaseSlice(Slice);
+	}
+	Slice.Texture = Texture;
+	Slice.SourceSRV = SourceSRV;
+	Slice.SourceSRV->AddRef();
+	Slice.LastUsedPass = PassCounter;
+	SliceByTexture.Add(Texture, Victim);
+	PendingUploads.Add(Victim);
+	return Victim;
+}
+
+bool FDecalRenderResources::FlushTextureUploads()
+{
+	if (PendingUploads.IsEmpty())
+	{
+		return false;
+	}
+
+	if (!FullScreenVS)
+	{
+		FullScreenVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+		BlitPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/Blit_PS.hlsl");
+	}
+	if (!FullScreenVS || !FullScreenVS->GetVertexShader() || !BlitPS || !BlitPS->GetPixelShader())
+	{
+		UE_LOG("FDecalRenderResources: Blit 셰이더 없음, 데칼 텍스처 업로드 실패");
+		PendingUploads.Empty();
+		return false;
+	}
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+
+	// 아틀라스가 SRV로 바인딩되어 있으면 RTV로 쓸 수 없으므로 먼저 해제
+	ID3D11ShaderResourceView* NullSRV = nullptr;
+	Context->PSSetShaderResources(0, 1, &NullSRV);
+
+	D3D11_VIEWPORT Viewport = {};
+	Viewport.Width = static_cast<float>(AtlasSize);
+	Viewport.Height = static_cast<float>(AtlasSize);
+	Viewport.MaxDepth = 1.0f;
+	Context->RSSetViewports(1, &Viewport);
+
+	FViewportConstants AtlasConstants;
+	AtlasConstants.ViewportRect = FVector4(0.0f, 0.0f, static_cast<float>(AtlasSize), static_cast<float>(AtlasSize));
+	AtlasConstants.ScreenSize = FVector4(static_cast<float>(AtlasSize), static_cast<float>(AtlasSize), 1.0f / AtlasSize, 1.0f / AtlasSize);
+	RHIDevice->SetAndUpdateConstantBuffer(AtlasConstants);
+
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::Always);
+	RHIDevice->OMSetBlendState(false);
+	RHIDevice->PrepareShader(FullScreenVS, BlitPS);
+
+	ID3D11SamplerState* LinearClampSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::LinearClamp);
+	Context->PSSetSamplers(0, 1, &LinearClampSampler);
+
+	for (int32 SliceIndex : PendingUploads)
+	{
+		FAtlasSlice& Slice = Slices[SliceIndex];
+		if (!Slice.SourceSRV || !Slice.RTV)
+		{
+			continue;
+		}
+
+		Context->OMSetRenderTargets(1, &Slice.RTV, nullptr);
+		Context->PSSetShaderResources(0, 1, &Slice.SourceSRV);
+		RHIDevice->DrawFullScreenQuad();
+		++NumUploadsThisPass;
+	}
+	PendingUploads.Empty();
+
+	Context->PSSetShaderResources(0, 1, &NullSRV);
+	Context->OMSetRenderTargets(0, nullptr, nullptr);
+	Context->GenerateMips(AtlasSRV);
+	RHIDevice->PSSetDefaultSampler(0);
+	return true;
+}
+
+void FDecalRenderResources::UpdateDecalInfos(const TArray<FDecalInfo>& DecalInfos)
+{
+	const UINT Count = static_cast<UINT>(DecalInfos.Num());
+	if (Count == 0)
+	{
+		return;
+	}
+
+	if (!DecalInfoBuffer || DecalInfoCapacity < Count)
+	{
+		if (DecalInfoSRV)
+		{
+			DecalInfoSRV->Release();
+			DecalInfoSRV = nullptr;
+		}
+		if (DecalInfoBuffer)
+		{
+			DecalInfoBuffer->Release();
+			DecalInfoBuffer = nullptr;
+		}
+
+		const UINT NewCapacity = std::max(Count + Count / 2, 64u);
+		if (FAILED(RHIDevice->CreateStructuredBuffer(sizeof(FDecalInfo), NewCapacity, nullptr, &DecalInfoBuffer)))
+		{
+			DecalInfoCapacity = 0;
+			return;
+		}
+		RHIDevice->CreateStructuredBufferSRV(DecalInfoBuffer, &DecalInfoSRV);
+		DecalInfoCapacity = NewCapacity;
+	}
+
+	RHIDevice->UpdateStructuredBuffer(DecalInfoBuffer, DecalInfos.data(), Count * sizeof(FDecalInfo));
+}
+
+bool FDecalRenderResources::GetShaders(const FSceneView* View, ID3D11VertexShader*& OutVertexShader, ID3D11PixelShader*& OutPixelShader)
+{
+	// 핫 리로드 시 변형이 다시 컴파일되어 포인터가 바뀌므로 리비전이 바뀌면 캐시를 비움
+	const uint64 Revision = FCachedMeshDrawCommandSet::GetGlobalRevision();
+	if (Revision != ShaderRevision)
+	{
+		DecalPixelShaders.Empty();
+		ShaderRevision = Revision;
+	}
+
+	if (!FullScreenVS)
+	{
+		FullScreenVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+		BlitPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/Blit_PS.hlsl");
+	}
+
+	ID3D11PixelShader** CachedPS = DecalPixelShaders.Find(View->ViewShaderMacroKey);
+	if (!CachedPS)
+	{
+		TArray<FShaderMacro> Macros = View->ViewShaderMacros;
+		DecalPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Effects/ClusteredDecal_PS.hlsl", Macros);
+		DecalPixelShaders.Add(View->ViewShaderMacroKey, DecalPS ? DecalPS->GetPixelShader(Macros) : nullptr);
+		CachedPS = DecalPixelShaders.Find(View->ViewShaderMacroKey);
+	}
+
+	OutVertexShader = FullScreenVS ? FullScreenVS->GetVertexShader() : nullptr;
+	OutPixelShader = *CachedPS;
+	return OutVertexShader && OutPixelShader;
+}
+
+bool FDecalRenderResources::CreateAtlas()
+{
+	if (!Slices.IsEmpty())
+	{
+		// 이전 생성이 실패했으면 매 프레임 다시 시도하지 않음
+		return false;
+	}
+	Slices.SetNum(AtlasSliceCount);
+
+	ID3D11Device* Device = RHIDevice->GetDevice();
+
+	D3D11_TEXTURE2D_DESC TextureDesc = {};
+	TextureDesc.Width = AtlasSize;
+	TextureDesc.Height = AtlasSize;
+	TextureDesc.MipLevels = 0;	// 전체 밉 체인
+	TextureDesc.ArraySize = AtlasSliceCount;
+	TextureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+	TextureDesc.SampleDesc.Count = 1;
+	TextureDesc.Usage = D3D11_USAGE_DEFAULT;
+	TextureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+	TextureDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
+	if (FAILED(Device->CreateTexture2D(&TextureDesc, nullptr, &AtlasTexture)))
+	{
+		UE_LOG("FDecalRenderResources: 데칼 아틀라스 생성 실패");
+		AtlasTexture = nullptr;
+		return false;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+	SRVDesc.Format = TextureDesc.Format;
+	SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+	SRVDesc.Texture2DArray.MostDetailedMip = 0;
+	SRVDesc.Texture2DArray.MipLevels = static_cast<UINT>(-1);
+	SRVDesc.Texture2DArray.FirstArraySlice = 0;
+	SRVDesc.Texture2DArray.ArraySize = AtlasSliceCount;
+	Device->CreateShaderResourceView(AtlasTexture, &SRVDesc, &AtlasSRV);
+
+	for (UINT i = 0; i < AtlasSliceCount; ++i)
+	{
+		D3D11_RENDER_TARGET_VIEW_DESC RTVDesc = {};
+		RTVDesc.Format = TextureDesc.Format;
+		RTVDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DARRAY;
+		RTVDesc.Texture2DArray.MipSlice = 0;
+		RTVDesc.Texture2DArray.FirstArraySlice = i;
+		RTVDesc.Texture2DArray.ArraySize = 1;
+		Device->CreateRenderTargetView(AtlasTexture, &RTVDesc, &Slices[i].RTV);
+	}
+
+	if (!AtlasSRV)
+	{
+		AtlasTexture->Release();
+		AtlasTexture = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FDecalRenderResources::ReleaseSlice(FAtlasSlice& Slice)
+{
+	if (Slice.SourceSRV)
+	{
+		Slice.SourceSRV->Release();
+		Slice.SourceSRV = nullptr;
+	}
+	Slice.Texture = nullptr;
+	Slice.LastUsedPass = 0;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+class D3D11RHI;
+class UShader;
+class UTexture;
+class FSceneView;
+
+/**
+ * @brief 클러스터 데칼 패스가 프레임 간 유지하는 GPU 리소스 (URenderer 소유)
+ * @details 데칼 텍스처를 Texture2DArray 아틀라스의 슬라이스로 모아 두고,
+ *          데칼별 투영 행렬/불투명도/슬라이스를 Structured Buffer로 올려 화면 공간 패스 한 번에 모든 데칼을 적용한다.
+ */
+class FDecalRenderResources
+{
+public:
+	// 아틀라스 슬라이스 크기와 개수 (데칼 텍스처는 슬라이스 크기로 리샘플)
+	static constexpr UINT AtlasSize = 512;
+	static constexpr UINT AtlasSliceCount = 32;
+
+	// GPU 데칼 정보 (ClusteredDecal_PS.hlsl의 FDecalInfo와 일치)
+	struct FDecalInfo
+	{
+		FMatrix DecalMatrix;	// 월드 -> 데칼 투영 (UDecalComponent::GetDecalProjectionMatrix)
+		float Opacity;
+		uint32 TextureSlice;
+		float Padding[2];
+	};
+
+	explicit FDecalRenderResources(D3D11RHI* InRHIDevice);
+	~FDecalRenderResources();
+
+	/**
+	 * @brief 데칼 패스 시작 시 (뷰마다) 호출
+	 * @details 이번 패스에서 쓰는 슬라이스는 교체 대상에서 빠진다.
+	 */
+	void BeginPass();
+
+	/**
+	 * @brief 텍스처가 들어 있는 아틀라스 슬라이스
+	 * @return 처음 쓰는 텍스처면 가장 오래 안 쓴 슬라이스를 배정하고 업로드를 예약, 이번 패스 텍스처로 가득 차면 -1
+	 */
+	int32 GetTextureSlice(UTexture* Texture);
+
+	/**
+	 * @brief 예약된 업로드를 아틀라스 슬라이스로 복사하고 밉맵 생성
+	 * @return 업로드가 있었으면 true (렌더 타겟/뷰포트/b10/셰이더가 바뀌므로 호출한 쪽에서 복구)
+	 */
+	bool FlushTextureUploads();
+
+	// 데칼 정보 업로드 (부족하면 버퍼를 키움)
+	void UpdateDecalInfos(const TArray<FDecalInfo>& DecalInfos);
+
+	/**
+	 * @brief 뷰 매크로(조명 모델)에 맞는 데칼 패스 셰이더
+	 * @details 매크로 키별로 캐시하고, 셰이더 핫 리로드/머티리얼 변경 리비전이 바뀌면 다시 찾는다.
+	 */
+	bool GetShaders(const FSceneView* View, ID3D11VertexShader*& OutVertexShader, ID3D11PixelShader*& OutPixelShader);
+
+	ID3D11ShaderResourceView* GetAtlasSRV() const { return AtlasSRV; }
+	ID3D11ShaderResourceView* GetDecalInfoSRV() const { return DecalInfoSRV; }
+
+	// 통계
+	uint32 GetNumUsedSlices() const { return static_cast<uint32>(SliceByTexture.Num()); }
+	uint32 GetNumUploadsThisPass() const { return NumUploadsThisPass; }
+
+private:
+	// 아틀라스 슬라이스 하나에 들어 있는 텍스처
+	struct FAtlasSlice
+	{
+		UTexture* Texture = nullptr;
+		ID3D11ShaderResourceView* SourceSRV = nullptr;	// 업로드한 원본 SRV (AddRef, 텍스처가 다시 로드되면 재업로드)
+		ID3D11RenderTargetView* RTV = nullptr;
+		uint64 LastUsedPass = 0;
+	};
+
+	bool CreateAtlas();
+	void ReleaseSlice(FAtlasSlice& Slice);
+
+	D3D11RHI* RHIDevice = nullptr;
+
+	// Texture2DArray 아틀라스 (처음 데칼을 그릴 때 생성)
+	ID3D11Texture2D* AtlasTexture = nullptr;
+	ID3D11ShaderResourceView* AtlasSRV = nullptr;
+	TArray<FAtlasSlice> Slices;
+	TMap<UTexture*, int32> SliceByTexture;
+	TArray<int32> PendingUploads;
+	uint64 PassCounter = 0;
+	uint32 NumUploadsThisPass = 0;
+
+	// 데칼 정보 Structured Buffer
+	ID3D11Buffer* DecalInfoBuffer = nullptr;
+	ID3D11ShaderResourceView* DecalInfoSRV = nullptr;
+	UINT DecalInfoCapacity = 0;
+
+	// 셰이더 (매크로 키별 픽셀 셰이더)
+	UShader* FullScreenVS = nullptr;
+	UShader* BlitPS = nullptr;
+	UShader* DecalPS = nullptr;
+	TMap<uint64, ID3D11PixelShader*> DecalPixelShaders;
+	uint64 ShaderRevision = 0;
+};
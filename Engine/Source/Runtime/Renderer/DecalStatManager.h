@@ -25,7 +25,11 @@ public:
 	{
 		TotalDecalCount = 0;
 		VisibleDecalCount = 0;
-		AffectedMeshCount = 0;
+		BinnedDecalCount = 0;
+		ClusterEntryCount = 0;
+		DecalClusterCount = 0;
+		AtlasSliceCount = 0;
+		AtlasUploadCount = 0;
 		DecalPassTimeMS = 0.0;
 	}
 
@@ -37,8 +41,20 @@ public:
 	/** @return 그릴 데칼 수 (Frustum Culling 통과) */
 	uint32_t GetVisibleDecalCount() const { return VisibleDecalCount; }
 
-	/** @return 데칼과 충돌한 메시 수 (그릴 실제 메시 수) */
-	uint32_t GetAffectedMeshCount() const { return AffectedMeshCount; }
+	/** @return 클러스터에 배치된 데칼 수 (화면 안, 아틀라스 배정 성공) */
+	uint32_t GetBinnedDecalCount() const { return BinnedDecalCount; }
+
+	/** @return 클러스터별 데칼 항목 수의 합 */
+	uint32_t GetClusterEntryCount() const { return ClusterEntryCount; }
+
+	/** @return 데칼이 하나 이상 있는 클러스터 수 */
+	uint32_t GetDecalClusterCount() const { return DecalClusterCount; }
+
+	/** @return 데칼 텍스처 아틀라스에서 사용 중인 슬라이스 수 */
+	uint32_t GetAtlasSliceCount() const { return AtlasSliceCount; }
+
+	/** @return 이번 프레임에 아틀라스로 새로 올린 텍스처 수 */
+	uint32_t GetAtlasUploadCount() const { return AtlasUploadCount; }
 
 	/** @return 데칼 전체 소요 시간 (ms) */
 	double GetDecalPassTimeMS() const { return DecalPassTimeMS; }
@@ -56,19 +72,6 @@ public:
 		return DecalPassTimeMS / static_cast<double>(VisibleDecalCount);
 	}
 
-	/**
-	 * @brief 데칼-메시 쌍 하나를 그리는 데(Draw Call) 걸리는 평균 시간 (ms)을 계산하여 반환합니다.
-	 * @return (전체 소요 시간) / (데칼과 충돌한 메시 수)
-	 */
-	double GetAverageTimePerDrawMS() const // 또는 GetAverageTimePerAffectedMeshMS()
-	{
-		if (AffectedMeshCount == 0)
-		{
-			return 0.0;
-		}
-		return DecalPassTimeMS / static_cast<double>(AffectedMeshCount);
-	}
-
 	// --- Setters / Incrementers ---
 
 	// NOTE: 추후 데칼 생성/소멸 시 호출하여 실제 컴포넌트 수만큼만 표시
@@ -78,8 +81,20 @@ public:
 	/** @brief 그릴 데칼 수를 더합니다. (Gather 단계 이후 호출) */
 	void AddVisibleDecalCount(uint32_t InCount) { VisibleDecalCount += InCount; }
 
-	/** @brief 데칼이 메시에 그려질 때마다 호출하여 카운트를 1 증가시킵니다. */
-	void IncrementAffectedMeshCount() { ++AffectedMeshCount; }
+	/** @brief 뷰 하나의 데칼 클러스터 배치 결과를 더합니다. */
+	void AddClusterBinning(uint32_t InBinnedDecals, uint32_t InClusterEntries, uint32_t InDecalClusters)
+	{
+		BinnedDecalCount += InBinnedDecals;
+		ClusterEntryCount += InClusterEntries;
+		DecalClusterCount += InDecalClusters;
+	}
+
+	/** @brief 데칼 텍스처 아틀라스 상태를 기록합니다. (사용 슬라이스는 최신 값, 업로드는 누적) */
+	void AddAtlasUsage(uint32_t InUsedSlices, uint32_t InUploads)
+	{
+		AtlasSliceCount = InUsedSlices;
+		AtlasUploadCount += InUploads;
+	}
 
 	// NOTE: 추후 Scoped Timer 같은 타이머에서 시간을 기록할 수 있도록 참조자로 반환
 	/** @brief 데칼 패스의 전체 소요 시간을 직접 기록할 수 있도록 변수의 참조를 반환합니다. */
@@ -99,6 +114,10 @@ private:
 	// 매 프레임 초기화되는 데이터
 	uint32_t TotalDecalCount = 0;
 	uint32_t VisibleDecalCount = 0;
-	uint32_t AffectedMeshCount = 0;
+	uint32_t BinnedDecalCount = 0;
+	uint32_t ClusterEntryCount = 0;
+	uint32_t DecalClusterCount = 0;
+	uint32_t AtlasSliceCount = 0;
+	uint32_t AtlasUploadCount = 0;
 	double DecalPassTimeMS = 0.0;
 };
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+#include "UEContainer.h"
+
+// DrawMeshBatches가 다시 바인딩하는 상태 변경 횟수 (DrawMeshBatches의 캐시 비교 조건과 동일)
+struct FMeshDrawStateChanges
+{
+	uint32 ShaderChanges = 0;	// VS/PS (+ InputLayout)
+	uint32 MaterialChanges = 0;	// 머티리얼 또는 인스턴스 SRV (텍스처, 샘플러, 재질 CBuffer)
+	uint32 BufferChanges = 0;	// VB/IB/스트라이드/토폴로지
+
+	uint32 Total() const { return ShaderChanges + MaterialChanges + BufferChanges; }
+};
+
+// 메시 드로우 정렬 통계 (한 프레임, 모든 뷰 합계)
+// 수집 순서 그대로 그렸을 때 대비 정렬로 줄인 상태 변경 수를 추적
+struct FDrawSortStats
+{
+	uint32 SortedLists = 0;           // 정렬한 배치 목록 수 (뷰 × 패스)
+	uint32 SortedDraws = 0;           // 정렬한 배치 수
+
+	FMeshDrawStateChanges UnsortedChanges;	// 수집 순서로 그렸을 때
+	FMeshDrawStateChanges SortedChanges;	// 정렬된 순서로 실제 그린 상태 변경
+
+	// 줄인 상태 변경 수와 비율 (%)
+	uint32 SavedStateChanges = 0;
+	float SavedPercentage = 0.0f;
+
+	// 비용 (CPU, ms): 키 생성 + 기수 정렬
+	double SortTimeMS = 0.0;
+
+	// 자동 인스턴싱
+	uint32 InstancedDraws = 0;        // 합쳐진 인스턴스드 드로우 수
+	uint32 InstancedBatches = 0;      // 인스턴스드 드로우로 합쳐진 배치 수
+	uint32 DrawCallsSaved = 0;        // 줄인 드로우 콜 (+ 오브젝트별 상수 버퍼 갱신) 수
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		*this = FDrawSortStats();
+	}
+
+	// 파생 통계 계산
+	void CalculateStats()
+	{
+		const uint32 Unsorted = UnsortedChanges.Total();
+		const uint32 Sorted = SortedChanges.Total();
+
+		SavedStateChanges = Unsorted > Sorted ? Unsorted - Sorted : 0;
+		SavedPercentage = Unsorted > 0 ? static_cast<float>(SavedStateChanges) / static_cast<float>(Unsorted) * 100.0f : 0.0f;
+		DrawCallsSaved = InstancedBatches - InstancedDraws;
+	}
+};
+
+// 메시 드로우 정렬 통계 전역 매니저 (싱글톤)
+// 한 프레임에 여러 뷰포트가 정렬 결과를 누적하고, 오버레이는 지난 프레임의 합계를 표시
+class FDrawSortStatManager
+{
+public:
+	static FDrawSortStatManager& GetInstance()
+	{
+		static FDrawSortStatManager Instance;
+		return Instance;
+	}
+
+	// 프레임 시작 시 호출 (URenderer::BeginFrame): 지난 프레임 누적값을 확정하고 새로 누적 시작
+	void BeginFrame()
+	{
+		FrameStats.CalculateStats();
+		CurrentStats = FrameStats;
+		FrameStats.Reset();
+	}
+
+	// 배치 목록 하나의 정렬 결과 누적
+	void AddSortResult(uint32 NumDraws, const FMeshDrawStateChanges& Unsorted, const FMeshDrawStateChanges& Sorted, double SortTimeMS)
+	{
+		++FrameStats.SortedLists;
+		FrameStats.SortedDraws += NumDraws;
+		FrameStats.UnsortedChanges.ShaderChanges += Unsorted.ShaderChanges;
+		FrameStats.UnsortedChanges.MaterialChanges += Unsorted.MaterialChanges;
+		FrameStats.UnsortedChanges.BufferChanges += Unsorted.BufferChanges;
+		FrameStats.SortedChanges.ShaderChanges += Sorted.ShaderChanges;
+		FrameStats.SortedChanges.MaterialChanges += Sorted.MaterialChanges;
+		FrameStats.SortedChanges.BufferChanges += Sorted.BufferChanges;
+		FrameStats.SortTimeMS += SortTimeMS;
+	}
+
+	// 자동 인스턴싱 결과 누적
+	void AddInstancingResult(uint32 MergedDraws, uint32 MergedBatches)
+	{
+		FrameStats.InstancedDraws += MergedDraws;
+		FrameStats.InstancedBatches += MergedBatches;
+	}
+
+	// 통계 조회 (지난 프레임)
+	const FDrawSortStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+		FrameStats.Reset();
+	}
+
+private:
+	FDrawSortStatManager() = default;
+	~FDrawSortStatManager() = default;
+	FDrawSortStatManager(const FDrawSortStatManager&) = delete;
+	FDrawSortStatManager& operator=(const FDrawSortStatManager&) = delete;
+
+	FDrawSortStats CurrentStats;
+	FDrawSortStats FrameStats;
+};
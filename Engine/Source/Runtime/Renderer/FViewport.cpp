@@ -1,14 +1,22 @@
 ﻿#include "pch.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
+#include "SceneViewState.h"
 
 FViewport::FViewport()
 {
+	ViewState = new FSceneViewState();
 }
 
 FViewport::~FViewport()
 {
 	Cleanup();
+
+	if (ViewState)
+	{
+		delete ViewState;
+		ViewState = nullptr;
+	}
 }
 
 bool FViewport::Initialize(float InStartX, float InStartY, float InSizeX, float InSizeY, ID3D11Device* Device)
@@ -4,6 +4,7 @@
 #include <d3d11.h>
 
 class FViewportClient;
+class FSceneViewState;
 
 /**
  * @brief 뷰포트 클래스 - UE의 FViewport를 모방
@@ -29,6 +30,9 @@ public:
     // ViewportClient 설정
     void SetViewportClient(FViewportClient* InClient) { ViewportClient = InClient; }
     FViewportClient* GetViewportClient() const { return ViewportClient; }
+
+    // 프레임 간 유지되는 뷰 상태 (가시성 캐시 등)
+    FSceneViewState* GetViewState() const { return ViewState; }
     
     // 접근자
     uint32 GetSizeX() const { return SizeX; }
@@ -62,6 +66,8 @@ private:
     // ViewportClient
     FViewportClient* ViewportClient = nullptr;
 
+    FSceneViewState* ViewState = nullptr;
+
     FVector2D ViewportMousePosition{};
 };
 
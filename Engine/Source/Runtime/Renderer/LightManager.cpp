@@ -15,20 +15,23 @@ FLightManager::~FLightManager()
 }
 void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D, uint32 InAtlasSizeCube, uint32 InCubeArrayCount)
 {
-	// Check if owning world is a preview world and adjust shadow atlas sizes accordingly
+	// 미리보기 월드는 작은 메모리 예산 안에서 아틀라스 크기를 정함
+	// (큐브 그림자를 끄는 대신 해상도/슬라이스 수를 줄이고, 요청별 해상도는 아틀라스 할당기가 예산에 맞춰 낮춤)
 	if (OwningWorld && OwningWorld->IsPreviewWorld())
 	{
-		// For preview worlds, use minimal shadow resources to save memory (~900+ MB savings)
-		InShadowAtlasSize2D = 512;  // Reduce from 8192 to 512 (256 MB -> ~1 MB)
-		InAtlasSizeCube = 0;         // Disable cube shadows entirely
-		InCubeArrayCount = 0;        // No point light shadows
-		UE_LOG("FLightManager: Initializing for preview world with minimal shadow resources");
+		FShadowAtlasAllocator::FitAtlasSizesToBudget(PreviewShadowMemoryBudgetMB, InShadowAtlasSize2D, InAtlasSizeCube, InCubeArrayCount);
+		UE_LOG("FLightManager: Preview world shadow budget %.1f MB (Atlas2D %u, Cube %u x %u)",
+			PreviewShadowMemoryBudgetMB, InShadowAtlasSize2D, InAtlasSizeCube, InCubeArrayCount);
 	}
 
 	// Set shadow atlas sizes from parameters
 	ShadowAtlasSize2D = InShadowAtlasSize2D;
 	AtlasSizeCube = InAtlasSizeCube;
 	CubeArrayCount = InCubeArrayCount;
+	ShadowAtlasAllocator.Initialize(ShadowAtlasSize2D);
+
+	// 아틀라스가 새로 만들어질 수 있으므로 캐시된 그림자 뎁스는 버림
+	ShadowDepthCache.Invalidate();
 
 	// --- 1. Structured Buffers (t17, t18) ---
 	if (!PointLightBuffer)
@@ -98,7 +101,7 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	}
 
 	// --- 3. Cube Map Atlas (t8) ---
-	// Skip cube shadow creation if CubeArrayCount is 0 (for preview worlds)
+	// Skip cube shadow creation if CubeArrayCount is 0 (budget too small for cube shadows)
 	if (!ShadowAtlasTextureCube && CubeArrayCount > 0 && AtlasSizeCube > 0)
 	{
 		// 3.1. 큐브맵 배열 리소스 생성 (TextureCubeArray)
@@ -243,6 +246,7 @@ void FLightManager::Release()
 	}
 	
 	// 2D Atlas Release
+	ShadowDepthCache.Invalidate();
 	if (ShadowAtlasSRV2D) { ShadowAtlasSRV2D->Release(); ShadowAtlasSRV2D = nullptr; }
 	if (ShadowAtlasDSV2D) { ShadowAtlasDSV2D->Release(); ShadowAtlasDSV2D = nullptr; }
 	if (ShadowAtlasTexture2D) { ShadowAtlasTexture2D->Release(); ShadowAtlasTexture2D = nullptr; }
@@ -481,6 +485,7 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+	ShadowDepthCache.Invalidate();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -535,111 +540,29 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 }
 
 // 단순한 아틀라스 로직
-void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
+void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FSceneView* View)
 {
-	// 요청 정렬 (가장 큰 것부터)
-	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
-
-	// 동적 패킹(Shelf Algorithm)
-	uint32 CurrentAtlasX = 0;
-	uint32 CurrentAtlasY = 0;
-	uint32 CurrentShelfMaxHeight = 0;
-
-	for (FShadowRenderRequest& Request : InOutRequests2D)
-	{
-		if (CurrentAtlasX + Request.Size > ShadowAtlasSize2D)
-		{
-			CurrentAtlasY += CurrentShelfMaxHeight;
-			CurrentAtlasX = 0;
-			CurrentShelfMaxHeight = 0;
-		}
-		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
-		{
-			Request.Size = 0; // 꽉 참 (렌더링 실패)
-			// UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다."); // 로그 비활성화
-			continue;
-		}
-
-		Request.AtlasViewportOffset = FVector2D((float)CurrentAtlasX, (float)CurrentAtlasY);
-
-		// Pass 2 데이터 (UV) 저장
-		Request.AtlasScaleOffset = FVector4(
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleX
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleY
-			CurrentAtlasX / (float)ShadowAtlasSize2D,   // OffsetX
-			CurrentAtlasY / (float)ShadowAtlasSize2D    // OffsetY
-		);
-
-		CurrentAtlasX += Request.Size;
-		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
-	}
+	// 화면 점유율로 요청별 해상도를 정하고 스카이라인 패킹 (예산 초과 시 중요도가 낮은 요청부터 낮추거나 뺌)
+	ShadowAtlasAllocator.Allocate(InOutRequests2D, View, ShadowAtlasUsage);
 }
 
-void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
+void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube, const FSceneView* View)
 {
 	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
-	if (CubeArrayCount == 0)
+	if (CubeArrayCount == 0 || AtlasSizeCube == 0)
 	{
 		for (FShadowRenderRequest& Request : InOutRequestsCube)
 		{
 			Request.Size = 0; // 할당 불가
 			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
 		}
+		ShadowAtlasUsage.CubeSlices = 0;
+		ShadowAtlasUsage.UsedCubeSlices = 0;
 		return;
 	}
 
-	int AllocatorCube_CurrentSliceIndex = 0;
-
-	ULightComponent* CurrentLightOwner = nullptr; // 현재 처리 중인 라이트 추적용
-	bool bCurrentLightFailed = false; // 현재 라이트가 슬라이스 할당에 실패했는지 여부
-	// 로컬 변수 대신 FLightManager의 멤버 변수 AllocatorCube_CurrentSliceIndex 사용
-
-	// 요청 리스트 순회 (각 라이트당 6개의 요청이 들어옴)
-	for (FShadowRenderRequest& Request : InOutRequestsCube)
-	{
-		// 유효하지 않은 요청은 건너뜀 (예: Size가 0인 경우)
-		if (Request.Size == 0)
-		{
-			Request.AssignedSliceIndex = -1; // 실패 상태 명시
-			continue;
-		}
-
-		// 라이트가 변경되었는지 확인
-		if (Request.LightOwner != CurrentLightOwner)
-		{
-			// 첫 라이트가 아니면서 이전 라이트가 성공적으로 할당되었을 경우, 다음 슬라이스로 이동
-			if (CurrentLightOwner != nullptr && !bCurrentLightFailed)
-			{
-				AllocatorCube_CurrentSliceIndex++; // 다음 슬라이스 인덱스로 증가 (멤버 변수 사용)
-			}
-
-			CurrentLightOwner = Request.LightOwner; // 현재 라이트 갱신
-
-			// 새 라이트가 슬라이스 개수 제한을 초과하는지 확인
-			if (AllocatorCube_CurrentSliceIndex >= static_cast<int32>(CubeArrayCount))
-			{
-				bCurrentLightFailed = true; // 이 라이트는 할당 불가
-			}
-			else
-			{
-				bCurrentLightFailed = false; // 이 라이트는 할당 가능
-			}
-		}
-
-		// 현재 라이트가 할당 실패 상태인지 확인
-		if (bCurrentLightFailed)
-		{
-			Request.Size = 0; // 할당 실패 처리
-			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
-		}
-		else
-		{
-			// --- [핵심 수정] ---
-			// 성공: 현재 슬라이스 인덱스를 'AssignedSliceIndex' 멤버에 기록
-			Request.AssignedSliceIndex = AllocatorCube_CurrentSliceIndex;
-			// OriginalSubViewIndex는 건드리지 않음
-		}
-	}
+	// 화면 점유율 순으로 슬라이스 배정, 계속 선택된 라이트는 지난 슬라이스 유지
+	ShadowCubeSliceAllocator.Allocate(InOutRequestsCube, View, CubeArrayCount, ShadowAtlasUsage);
 }
 
 void FLightManager::ClearAllLightList()
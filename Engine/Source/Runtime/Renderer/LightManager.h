@@ -1,4 +1,7 @@
 ﻿#pragma once
+#include "ShadowDepthCache.h"
+#include "ShadowAtlasAllocator.h"
+#include "ShadowStats.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -121,10 +124,14 @@ struct FSpotLightInfo
 
 // Forward declare UWorld
 class UWorld;
+class FSceneView;
 
 class FLightManager
 {
 public:
+    // 미리보기 월드(에셋 뷰어 등)의 그림자 아틀라스 메모리 예산
+    static constexpr float PreviewShadowMemoryBudgetMB = 8.0f;
+
     FLightManager() = default;
     ~FLightManager();
 
@@ -155,8 +162,14 @@ public:
     void ClearAllDepthStencilView(D3D11RHI* RHIDevice);
     ID3D11RenderTargetView* GetVSMShadowAtlasRTV2D() const { return VSMShadowAtlasRTV2D; }
 
-    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
-    void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
+    // 화면 점유율(View 기준)로 해상도를 정해 2D 아틀라스에 배치 / 점광원에 큐브맵 슬라이스 배정
+    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FSceneView* View);
+    void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube, const FSceneView* View);
+    // 마지막 할당 결과 (아틀라스 사용률, 낮춘/뺀 요청 수)
+    const FShadowAtlasUsage& GetShadowAtlasUsage() const { return ShadowAtlasUsage; }
+
+    // 그림자 캐스터 컬링/뎁스 캐시 (이 매니저의 아틀라스 내용을 추적)
+    FShadowDepthCache& GetShadowDepthCache() { return ShadowDepthCache; }
 
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
@@ -203,6 +216,14 @@ private:
     ID3D11RenderTargetView* VSMShadowAtlasRTV2D = nullptr;
     ID3D11ShaderResourceView* VSMShadowAtlasSRV2D = nullptr; // t10
 
+    // 아틀라스에 그려둔 그림자 뎁스가 아직 유효한지 추적
+    FShadowDepthCache ShadowDepthCache;
+
+    // 아틀라스 할당 (프레임 간 배치 유지를 위해 상태를 가짐)
+    FShadowAtlasAllocator ShadowAtlasAllocator;
+    FShadowCubeSliceAllocator ShadowCubeSliceAllocator;
+    FShadowAtlasUsage ShadowAtlasUsage;
+
     // --- 섀도우 데이터 캐시 (CPU) ---
     // Key: 라이트, Value: 2D 섀도우 데이터 배열 (CSM의 경우 여러 개)
     TMap<ULightComponent*, TArray<FShadowMapData>> ShadowDataCache2D;
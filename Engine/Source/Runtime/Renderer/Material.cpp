@@ -6,6 +6,17 @@
 
 IMPLEMENT_CLASS(UMaterial)
 
+namespace
+{
+	// 모든 머티리얼이 공유하는 리비전 카운터 (MID가 부모와 큰 쪽을 반환해도 변경마다 이전에 없던 값이 되도록)
+	uint32 GMaterialDrawStateRevision = 0;
+}
+
+void UMaterialInterface::MarkDrawStateDirty()
+{
+	DrawStateRevision = ++GMaterialDrawStateRevision;
+}
+
 UMaterial::UMaterial()
 {
 	// 배열 크기를 미리 할당 (Enum 값 사용)
@@ -43,6 +54,9 @@ void UMaterial::Load(const FString& InFilePath, ID3D11Device* InDevice)
 			Shader = Default->GetShader();
 		}
 	}
+
+	// 이 머티리얼로 캐시된 드로우 커맨드가 이전 셰이더를 들고 있지 않도록
+	MarkDrawStateDirty();
 }
 
 void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -63,6 +77,7 @@ void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 void UMaterial::SetShader(UShader* InShaderResource)
 {
 	Shader = InShaderResource;
+	MarkDrawStateDirty();
 }
 
 void UMaterial::SetShaderByName(const FString& InShaderName)
@@ -88,6 +103,9 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 	}
 
 	ShaderMacros = InShaderMacro;
+
+	// 머티리얼 매크로는 셰이더 변형 키에 포함되므로 이 머티리얼의 캐시된 드로우 커맨드를 다시 만들어야 함
+	MarkDrawStateDirty();
 }
 
 UTexture* UMaterial::GetTexture(EMaterialTextureSlot Slot) const
@@ -219,6 +237,7 @@ void UMaterialInstanceDynamic::Serialize(const bool bInIsLoading, JSON& InOutHan
 			this->ParentMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
 			UE_LOG("UMID::Serialize: Failed to load parent %s. Using default.", ParentPath.c_str());
 		}
+		MarkDrawStateDirty();
 
 		// 2. 오버라이드 데이터 로드
 		JSON OverridesJson;
@@ -493,6 +512,12 @@ const FMaterialInfo& UMaterialInstanceDynamic::GetMaterialInfo() const
 	return CachedMaterialInfo;
 }
 
+uint32 UMaterialInstanceDynamic::GetDrawStateRevision() const
+{
+	const uint32 ParentRevision = ParentMaterial ? ParentMaterial->GetDrawStateRevision() : 0;
+	return std::max(DrawStateRevision, ParentRevision);
+}
+
 const TArray<FShaderMacro> UMaterialInstanceDynamic::GetShaderMacros() const
 {
 	if (ParentMaterial)
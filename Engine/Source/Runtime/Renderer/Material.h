@@ -26,6 +26,15 @@ public:
 	virtual bool HasTexture(EMaterialTextureSlot Slot) const = 0;
 	virtual const FMaterialInfo& GetMaterialInfo() const = 0;
 	virtual const TArray<FShaderMacro> GetShaderMacros() const = 0;
+
+	// 캐시된 드로우 커맨드가 섹션별로 기록해 두고 비교하는 값 (포인터가 같아도 셰이더/매크로가 바뀌면 달라짐)
+	virtual uint32 GetDrawStateRevision() const { return DrawStateRevision; }
+
+protected:
+	// 이 머티리얼로 만든 드로우 커맨드만 다시 만들게 함 (모든 머티리얼에서 유일하게 증가하는 값으로 갱신)
+	void MarkDrawStateDirty();
+
+	uint32 DrawStateRevision = 0;
 };
 
 
@@ -92,6 +101,7 @@ public:
 	UMaterialInterface* GetParentMaterial() const { return ParentMaterial; }
 	
 	const TArray<FShaderMacro> GetShaderMacros() const override;	// 이 인스턴스에 덮어쓴 매크로가 없다면 부모의 매크로를, 있다면 덮어쓴 매크로를 반환합니다.
+	uint32 GetDrawStateRevision() const override;	// 부모가 바뀌어도 캐시가 다시 만들어지도록 부모 리비전과 큰 쪽을 반환합니다.
 
 	const TMap<EMaterialTextureSlot, UTexture*>& GetOverriddenTextures() const { return OverriddenTextures; }	// 덮어쓴 텍스처 맵 반환 (저장 시 사용)
 	void SetTextureParameterValue(EMaterialTextureSlot Slot, UTexture* Value);	// 텍스처 파라미터 값을 런타임에 변경하는 함수 (실시간 수정 시 사용)
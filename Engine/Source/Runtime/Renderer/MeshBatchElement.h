@@ -54,6 +54,14 @@ struct FMeshBatchElement
 	// 인스턴스 버퍼의 스트라이드
 	uint32 InstanceStride = 0;
 
+	// 인스턴스 버퍼에서 읽기 시작할 위치 (DrawIndexedInstanced의 StartInstanceLocation)
+	uint32 StartInstance = 0;
+
+	// 자동 인스턴싱용 셰이더 변형 (MESH_INSTANCING), nullptr이면 인스턴싱 대상이 아님
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+
 	//Cloth GPU Skinning을 위한 데이터
 	bool bClothEnabled = false;
 	uint32 ClothMode = 0;
@@ -67,7 +75,9 @@ struct FMeshBatchElement
 	FMatrix WorldMatrix;
 
 	// 피킹(Picking) 등에 사용될 고유 ID입니다.
+	// 불투명 패스에서 데칼을 받는 메시는 DecalReceiverIDBit를 더해 ID 버퍼에 기록합니다. (피킹 시 마스킹)
 	uint32 ObjectID = 0;
+	static constexpr uint32 DecalReceiverIDBit = 0x80000000u;
 
 	// 빌보드나 데칼처럼 머티리얼이 아닌 컴포넌트 인스턴스가
 	// 직접 텍스처를 지정해야 할 때 사용합니다.
@@ -0,0 +1,371 @@
+#include "pch.h"
+#include "MeshDrawCommandRecorder.h"
+#include "Material.h"
+#include "Texture.h"
+#include "TaskScheduler.h"
+
+namespace
+{
+	// 스키닝 행렬 상수 버퍼 크기 (셰이더 배열 크기를 넘는 본은 잘라냄)
+	uint32 GetSkinningDataSize(const FMeshBatchElement& Batch)
+	{
+		const size_t MatrixDataSize = Batch.SkinningMatrices->Num() * sizeof(FMatrix);
+		return static_cast<uint32>(std::min(MatrixDataSize, sizeof(FSkinningBuffer)));	// 16384
+	}
+
+	// 클로스 바인딩 (VS b6 CB, t8 SRV)
+	void RecordClothState(FRHICommandList& CommandList, const FMeshBatchElement& Batch)
+	{
+		if (Batch.bClothEnabled && Batch.ClothSRV)
+		{
+			CommandList.SetAndUpdateConstantBuffer(ClothBufferType(1u, Batch.ClothMode, Batch.ClothBaseVertexIndex));
+			CommandList.SetVSResource(8, Batch.ClothSRV);
+		}
+		else
+		{
+			CommandList.SetVSResource(8, nullptr);
+			CommandList.SetAndUpdateConstantBuffer(ClothBufferType(0u, 0u, 0u));
+		}
+	}
+}
+
+int32 FMeshDrawCommandRecorder::PrepareLists(int32 NumDraws, bool bAllowParallel)
+{
+	int32 NumLists = 1;
+	FTaskScheduler& Scheduler = FTaskScheduler::Get();
+	if (bAllowParallel && Scheduler.IsInitialized())
+	{
+		NumLists = std::clamp(NumDraws / MinDrawsPerList, 1, Scheduler.GetMaxConcurrency());
+	}
+
+	if (CommandLists.Num() < NumLists)
+	{
+		CommandLists.SetNum(NumLists);
+	}
+	for (int32 ListIndex = 0; ListIndex < NumLists; ++ListIndex)
+	{
+		CommandLists[ListIndex].Reset();
+	}
+
+	NumUsedLists = NumLists;
+	return NumLists;
+}
+
+void FMeshDrawCommandRecorder::ResolveMaterialBindings(const TArray<FMeshBatchElement>& InMeshBatches)
+{
+	MaterialBindings.Empty();
+
+	UMaterialInterface* LastMaterial = nullptr;
+	for (const FMeshBatchElement& Batch : InMeshBatches)
+	{
+		// 같은 머티리얼이 이어지는 경우가 대부분이라 직전 머티리얼은 해시 조회 없이 건너뜀
+		if (!Batch.Material || Batch.Material == LastMaterial)
+		{
+			continue;
+		}
+		LastMaterial = Batch.Material;
+		if (MaterialBindings.Contains(Batch.Material))
+		{
+			continue;
+		}
+
+		FMeshDrawMaterialBinding& Binding = MaterialBindings[Batch.Material];
+		const FMaterialInfo& MaterialInfo = Batch.Material->GetMaterialInfo();
+		Binding.PixelConst.Material = MaterialInfo;
+		Binding.PixelConst.bHasMaterial = true;
+
+		if (!MaterialInfo.DiffuseTextureFileName.empty())
+		{
+			if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Diffuse))
+			{
+				Binding.DiffuseTextureSRV = TextureData->GetShaderResourceView();
+				Binding.PixelConst.bHasDiffuseTexture = (Binding.DiffuseTextureSRV != nullptr);
+			}
+		}
+		if (!MaterialInfo.NormalTextureFileName.empty())
+		{
+			if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Normal))
+			{
+				Binding.NormalTextureSRV = TextureData->GetShaderResourceView();
+				Binding.PixelConst.bHasNormalTexture = (Binding.NormalTextureSRV != nullptr);
+			}
+		}
+	}
+}
+
+void FMeshDrawCommandRecorder::RecordMeshBatches(const TArray<FMeshBatchElement>& InMeshBatches, const TArray<uint32>* InDrawOrder, const FMeshDrawRecordParams& Params, bool bAllowParallel)
+{
+	const int32 NumDraws = InDrawOrder ? InDrawOrder->Num() : InMeshBatches.Num();
+	const int32 NumLists = PrepareLists(NumDraws, bAllowParallel);
+	ResolveMaterialBindings(InMeshBatches);
+
+	ParallelFor(NumLists, [&](int32 ListIndex)
+	{
+		const int32 Begin = static_cast<int32>(static_cast<int64>(NumDraws) * ListIndex / NumLists);
+		const int32 End = static_cast<int32>(static_cast<int64>(NumDraws) * (ListIndex + 1) / NumLists);
+		RecordMeshBatchRange(CommandLists[ListIndex], InMeshBatches, InDrawOrder, Begin, End, Params, MaterialBindings);
+	});
+}
+
+void FMeshDrawCommandRecorder::RecordShadowBatches(const TArray<FMeshBatchElement>& InShadowBatches, const FShadowDrawRecordParams& Params, bool bAllowParallel)
+{
+	const int32 NumDraws = InShadowBatches.Num();
+	const int32 NumLists = PrepareLists(NumDraws, bAllowParallel);
+
+	ParallelFor(NumLists, [&](int32 ListIndex)
+	{
+		const int32 Begin = static_cast<int32>(static_cast<int64>(NumDraws) * ListIndex / NumLists);
+		const int32 End = static_cast<int32>(static_cast<int64>(NumDraws) * (ListIndex + 1) / NumLists);
+		RecordShadowBatchRange(CommandLists[ListIndex], InShadowBatches, Begin, End, Params);
+	});
+}
+
+void FMeshDrawCommandRecorder::RecordParticleEmitters(const TArray<FMeshBatchElement>& InParticleBatches, const TArray<FParticleEmitterDrawRange>& InEmitters,
+	const FMeshDrawRecordParams& Params, bool bAllowParallel)
+{
+	// 목록 수는 드로우 수로 정하되 에미터 수를 넘지 않음 (에미터 도중에는 나누지 않음)
+	const int32 NumEmitters = InEmitters.Num();
+	const int32 NumLists = PrepareLists(std::min(InParticleBatches.Num(), NumEmitters * MinDrawsPerList), bAllowParallel);
+	ResolveMaterialBindings(InParticleBatches);
+
+	ParallelFor(NumLists, [&](int32 ListIndex)
+	{
+		FRHICommandList& CommandList = CommandLists[ListIndex];
+		const int32 Begin = static_cast<int32>(static_cast<int64>(NumEmitters) * ListIndex / NumLists);
+		const int32 End = static_cast<int32>(static_cast<int64>(NumEmitters) * (ListIndex + 1) / NumLists);
+		for (int32 EmitterIndex = Begin; EmitterIndex < End; ++EmitterIndex)
+		{
+			const FParticleEmitterDrawRange& Emitter = InEmitters[EmitterIndex];
+			CommandList.SetBlendState(Emitter.bEnableBlend, Emitter.bAdditive);
+			CommandList.SetDepthStencilState(Emitter.DepthComparisonFunc);
+			if (Emitter.bHasSubUV)
+			{
+				CommandList.SetAndUpdateConstantBuffer(Emitter.SubUV);
+			}
+			RecordMeshBatchRange(CommandList, InParticleBatches, nullptr, Emitter.FirstBatch, Emitter.FirstBatch + Emitter.NumBatches, Params, MaterialBindings);
+		}
+	});
+}
+
+void FMeshDrawCommandRecorder::Execute(IRHICommandContext& Context) const
+{
+	Context.PrepareConstantUploads(CommandLists.data(), NumUsedLists);
+	for (int32 ListIndex = 0; ListIndex < NumUsedLists; ++ListIndex)
+	{
+		CommandLists[ListIndex].Execute(Context);
+	}
+}
+
+uint32 FMeshDrawCommandRecorder::GetNumRecordedCommands() const
+{
+	uint32 NumCommands = 0;
+	for (int32 ListIndex = 0; ListIndex < NumUsedLists; ++ListIndex)
+	{
+		NumCommands += CommandLists[ListIndex].GetNumCommands();
+	}
+	return NumCommands;
+}
+
+uint32 FMeshDrawCommandRecorder::GetNumRecordedBytes() const
+{
+	uint32 NumBytes = 0;
+	for (int32 ListIndex = 0; ListIndex < NumUsedLists; ++ListIndex)
+	{
+		NumBytes += CommandLists[ListIndex].GetUsedBytes();
+	}
+	return NumBytes;
+}
+
+void FMeshDrawCommandRecorder::RecordMeshBatchRange(FRHICommandList& CommandList, const TArray<FMeshBatchElement>& InMeshBatches, const TArray<uint32>* InDrawOrder,
+	int32 Begin, int32 End, const FMeshDrawRecordParams& Params, const TMap<UMaterialInterface*, FMeshDrawMaterialBinding>& MaterialBindings)
+{
+	// PS 리소스 초기화 (구간마다 기록해 이전 구간의 머티리얼 상태를 물려받지 않음)
+	ID3D11ShaderResourceView* NullSRVs[2] = { nullptr, nullptr };
+	ID3D11SamplerState* NullSamplers[2] = { nullptr, nullptr };
+	CommandList.SetPixelResources(2, NullSRVs, 2, NullSamplers);
+	CommandList.SetAndUpdateConstantBuffer(FPixelConstBufferType{});
+
+	// 구간별 상태 캐시
+	ID3D11VertexShader* CurrentVertexShader = nullptr;
+	ID3D11PixelShader* CurrentPixelShader = nullptr;
+	UMaterialInterface* CurrentMaterial = nullptr;
+	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr;
+	ID3D11Buffer* CurrentVertexBuffer = nullptr;
+	ID3D11Buffer* CurrentIndexBuffer = nullptr;
+	uint32 CurrentVertexStride = 0;
+	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+	for (int32 DrawIndex = Begin; DrawIndex < End; ++DrawIndex)
+	{
+		const FMeshBatchElement& Batch = InDrawOrder ? InMeshBatches[(*InDrawOrder)[DrawIndex]] : InMeshBatches[DrawIndex];
+
+		// 셰이더나 버퍼, 스트라이드 정보가 없으면 그릴 수 없음
+		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
+		{
+			continue;
+		}
+
+		// 1. 셰이더 상태 변경
+		if (Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
+		{
+			CommandList.SetShaders(Batch.InputLayout, Batch.VertexShader, Batch.PixelShader);
+			CurrentVertexShader = Batch.VertexShader;
+			CurrentPixelShader = Batch.PixelShader;
+		}
+
+		// 2. 픽셀 상태 (텍스처, 샘플러, 재질 CBuffer): 머티리얼 또는 인스턴스 SRV가 바뀌면 다시 바인딩
+		if (Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
+		{
+			ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr; // t0
+			ID3D11ShaderResourceView* NormalTextureSRV = nullptr;  // t1
+			FPixelConstBufferType PixelConst{};
+
+			// 머티리얼 상태는 미리 해석한 값만 읽음 (워커에서 머티리얼을 호출하지 않음)
+			const FMeshDrawMaterialBinding* Binding = Batch.Material ? MaterialBindings.Find(Batch.Material) : nullptr;
+			if (Binding)
+			{
+				PixelConst = Binding->PixelConst;
+				DiffuseTextureSRV = Binding->DiffuseTextureSRV;
+				NormalTextureSRV = Binding->NormalTextureSRV;
+			}
+			else
+			{
+				PixelConst.Material = FMaterialInfo();
+				PixelConst.bHasMaterial = false;
+				PixelConst.bHasDiffuseTexture = false;
+				PixelConst.bHasNormalTexture = false;
+			}
+
+			// 인스턴스 텍스처(빌보드)가 머티리얼 텍스처보다 우선
+			if (Batch.InstanceShaderResourceView)
+			{
+				DiffuseTextureSRV = Batch.InstanceShaderResourceView;
+				NormalTextureSRV = nullptr;
+				PixelConst.bHasDiffuseTexture = true;
+				PixelConst.bHasNormalTexture = false;
+			}
+
+			ID3D11ShaderResourceView* Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
+			ID3D11SamplerState* Samplers[4] = { Params.DefaultSampler, Params.DefaultSampler, Params.ShadowSampler, Params.VSMSampler };
+			CommandList.SetPixelResources(2, Srvs, 4, Samplers);
+			CommandList.SetAndUpdateConstantBuffer(PixelConst);
+
+			CurrentMaterial = Batch.Material;
+			CurrentInstanceSRV = Batch.InstanceShaderResourceView;
+		}
+
+		// 3. IA 상태 변경
+		if (Batch.VertexBuffer != CurrentVertexBuffer ||
+			Batch.IndexBuffer != CurrentIndexBuffer ||
+			Batch.VertexStride != CurrentVertexStride ||
+			Batch.PrimitiveTopology != CurrentTopology)
+		{
+			CommandList.SetStreams(Batch.VertexBuffer, Batch.IndexBuffer, Batch.VertexStride, static_cast<uint32>(Batch.PrimitiveTopology));
+
+			CurrentVertexBuffer = Batch.VertexBuffer;
+			CurrentIndexBuffer = Batch.IndexBuffer;
+			CurrentVertexStride = Batch.VertexStride;
+			CurrentTopology = Batch.PrimitiveTopology;
+		}
+
+		// 4. 오브젝트별 상수 버퍼 (매번 변경)
+		CommandList.SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
+		CommandList.SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+
+		// 스키닝 행렬은 실행 시점까지 컴포넌트가 들고 있으므로 복사하지 않고 참조
+		if (Batch.SkinningMatrices)
+		{
+			CommandList.SetAndUpdateConstantBufferPointer<FSkinningBuffer>(Batch.SkinningMatrices->GetData(), GetSkinningDataSize(Batch));
+		}
+
+		RecordClothState(CommandList, Batch);
+
+		// 5. Sky 전용 렌더링 상태 (깊이 테스트 Always, 컬링 끔, b9 상수 버퍼)
+		if (Batch.bIsSky)
+		{
+			CommandList.SetDepthStencilState(static_cast<uint32>(EComparisonFunc::Always));
+			CommandList.SetRasterizerState(static_cast<uint32>(ERasterizerMode::Solid_NoCull));
+			if (Batch.SkyParams)
+			{
+				CommandList.SetAndUpdateConstantBuffer(*Batch.SkyParams);
+			}
+		}
+
+		// 6. 인스턴스 버퍼가 있으면 DrawIndexedInstanced (자동 인스턴싱은 공유 인스턴스 버퍼의 중간부터 읽음)
+		if (Batch.InstanceBuffer != nullptr && Batch.InstanceCount > 0)
+		{
+			CommandList.SetVertexStream(1, Batch.InstanceBuffer, Batch.InstanceStride);
+			CommandList.DrawIndexedInstanced(Batch.IndexCount, Batch.InstanceCount, Batch.StartIndex, Batch.BaseVertexIndex, Batch.StartInstance);
+		}
+		else
+		{
+			CommandList.DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		}
+
+		// Sky 렌더링 후 상태 복원
+		if (Batch.bIsSky)
+		{
+			CommandList.SetDepthStencilState(static_cast<uint32>(EComparisonFunc::LessEqual));
+			CommandList.SetRasterizerState(static_cast<uint32>(ERasterizerMode::Solid));
+		}
+	}
+}
+
+void FMeshDrawCommandRecorder::RecordShadowBatchRange(FRHICommandList& CommandList, const TArray<FMeshBatchElement>& InShadowBatches,
+	int32 Begin, int32 End, const FShadowDrawRecordParams& Params)
+{
+	ID3D11Buffer* CurrentVertexBuffer = nullptr;
+	ID3D11Buffer* CurrentIndexBuffer = nullptr;
+	uint32 CurrentVertexStride = 0;
+	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+	for (int32 BatchIndex = Begin; BatchIndex < End; ++BatchIndex)
+	{
+		const FMeshBatchElement& Batch = InShadowBatches[BatchIndex];
+
+		RecordClothState(CommandList, Batch);
+
+		// Mesh Particle인지 확인 (InstanceBuffer가 있고 InstanceCount > 0이면 Mesh Particle)
+		const bool bIsMeshParticle = (Batch.InstanceBuffer != nullptr && Batch.InstanceCount > 0);
+		if (bIsMeshParticle)
+		{
+			CommandList.SetVertexShader(Params.ParticleMeshInputLayout, Params.ParticleMeshVertexShader);
+		}
+		else if (Batch.SkinningMatrices)
+		{
+			CommandList.SetVertexShader(Params.SkinningInputLayout, Params.SkinningVertexShader);
+			CommandList.SetAndUpdateConstantBufferPointer<FSkinningBuffer>(Batch.SkinningMatrices->GetData(), GetSkinningDataSize(Batch));
+		}
+		else
+		{
+			CommandList.SetVertexShader(Params.DefaultInputLayout, Params.DefaultVertexShader);
+		}
+
+		// IA 상태 변경
+		if (Batch.VertexBuffer != CurrentVertexBuffer ||
+			Batch.IndexBuffer != CurrentIndexBuffer ||
+			Batch.VertexStride != CurrentVertexStride ||
+			Batch.PrimitiveTopology != CurrentTopology)
+		{
+			CommandList.SetStreams(Batch.VertexBuffer, Batch.IndexBuffer, Batch.VertexStride, static_cast<uint32>(Batch.PrimitiveTopology));
+
+			CurrentVertexBuffer = Batch.VertexBuffer;
+			CurrentIndexBuffer = Batch.IndexBuffer;
+			CurrentVertexStride = Batch.VertexStride;
+			CurrentTopology = Batch.PrimitiveTopology;
+		}
+
+		// 오브젝트별 World 행렬 (VS에서 필요)
+		CommandList.SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
+
+		if (bIsMeshParticle)
+		{
+			CommandList.SetVertexStream(1, Batch.InstanceBuffer, Batch.InstanceStride);
+			CommandList.DrawIndexedInstanced(Batch.IndexCount, Batch.InstanceCount, Batch.StartIndex, Batch.BaseVertexIndex, 0);
+		}
+		else
+		{
+			CommandList.DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+		}
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "MeshBatchElement.h"
+#include "RHICommandList.h"
+
+// 메시 패스 기록에 필요한, 프레임 동안 바뀌지 않는 리소스
+struct FMeshDrawRecordParams
+{
+	ID3D11SamplerState* DefaultSampler = nullptr;
+	ID3D11SamplerState* ShadowSampler = nullptr;	// Shadow PCF
+	ID3D11SamplerState* VSMSampler = nullptr;
+};
+
+// 섀도우 깊이 패스의 VS 변형 (PS는 패스 시작 시 한 번 설정)
+struct FShadowDrawRecordParams
+{
+	ID3D11InputLayout* DefaultInputLayout = nullptr;
+	ID3D11VertexShader* DefaultVertexShader = nullptr;
+	ID3D11InputLayout* SkinningInputLayout = nullptr;
+	ID3D11VertexShader* SkinningVertexShader = nullptr;
+	ID3D11InputLayout* ParticleMeshInputLayout = nullptr;
+	ID3D11VertexShader* ParticleMeshVertexShader = nullptr;
+};
+
+// 머티리얼 하나의 픽셀 상태 (기록 전에 렌더 스레드에서 해석, 워커 스레드는 읽기만 함)
+struct FMeshDrawMaterialBinding
+{
+	FPixelConstBufferType PixelConst{};
+	ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr;	// t0
+	ID3D11ShaderResourceView* NormalTextureSRV = nullptr;	// t1
+};
+
+// 파티클 에미터 하나의 배치 구간과 에미터 단위 고정 상태 (구간 앞에 기록)
+struct FParticleEmitterDrawRange
+{
+	int32 FirstBatch = 0;
+	int32 NumBatches = 0;
+
+	bool bEnableBlend = false;
+	bool bAdditive = false;
+	uint32 DepthComparisonFunc = 0;	// EComparisonFunc
+
+	// 스프라이트 에미터만 b6 SubUV 파라미터를 갱신
+	bool bHasSubUV = false;
+	FParticleSubUVBufferType SubUV{};
+};
+
+/**
+ * @brief 메시 배치 목록을 여러 FRHICommandList에 병렬로 기록하고 렌더 스레드에서 순서대로 실행
+ * @details 그리기 순서를 연속 구간으로 나눠 구간마다 목록 하나를 워커 스레드가 기록한다.
+ * 구간은 자체 상태 캐시로 시작하며, 시작 시 기본 픽셀 상태를 다시 기록해 단일 루프와 같은 결과를 낸다.
+ * 기록 중에는 D3D11 디바이스 컨텍스트를 건드리지 않으므로 워커에서 안전하다.
+ * 머티리얼 정보와 텍스처 SRV는 분배 전에 렌더 스레드에서 머티리얼별로 한 번 해석한다.
+ * (UMaterialInstanceDynamic::GetMaterialInfo는 더티 캐시를 지연 갱신하므로 워커에서 호출하면 안 됨)
+ *
+ * URenderer가 소유하며, 목록 버퍼는 프레임 간 재사용된다. Record → Execute는 한 패스 안에서 짝을 이뤄 호출해야 함
+ */
+class FMeshDrawCommandRecorder
+{
+public:
+	// 목록 하나가 맡을 최소 드로우 수 (이보다 적으면 병렬 기록 이득보다 분배 비용이 큼)
+	static constexpr int32 MinDrawsPerList = 128;
+
+	/**
+	 * @brief 메시 배치를 그리기 순서대로 기록
+	 * @param InDrawOrder nullptr이면 수집 순서로 기록
+	 * @param bAllowParallel false면 목록 하나에 단일 스레드로 기록 (벤치마크 비교용)
+	 */
+	void RecordMeshBatches(const TArray<FMeshBatchElement>& InMeshBatches, const TArray<uint32>* InDrawOrder, const FMeshDrawRecordParams& Params, bool bAllowParallel = true);
+
+	// 섀도우 깊이 패스의 배치를 기록 (라이트 ViewProj와 PS는 호출 측에서 먼저 설정)
+	void RecordShadowBatches(const TArray<FMeshBatchElement>& InShadowBatches, const FShadowDrawRecordParams& Params, bool bAllowParallel = true);
+
+	/**
+	 * @brief 파티클 패스의 에미터들을 수집 순서대로 기록
+	 * @details 에미터마다 블렌드/깊이/SubUV 상태와 기본 픽셀 상태를 처음부터 기록하므로 에미터 경계에서 목록을 나눈다.
+	 */
+	void RecordParticleEmitters(const TArray<FMeshBatchElement>& InParticleBatches, const TArray<FParticleEmitterDrawRange>& InEmitters,
+		const FMeshDrawRecordParams& Params, bool bAllowParallel = true);
+
+	// 기록한 목록을 순서대로 실행
+	void Execute(IRHICommandContext& Context) const;
+
+	// 직전 기록 결과 (통계/벤치마크용)
+	int32 GetNumUsedLists() const { return NumUsedLists; }
+	uint32 GetNumRecordedCommands() const;
+	uint32 GetNumRecordedBytes() const;
+
+	/**
+	 * @brief 구간 하나를 목록에 기록 (워커 스레드에서 호출됨)
+	 * @param MaterialBindings 구간의 모든 머티리얼이 들어 있는 해석 결과 (ResolveMaterialBindings)
+	 */
+	static void RecordMeshBatchRange(FRHICommandList& CommandList, const TArray<FMeshBatchElement>& InMeshBatches, const TArray<uint32>* InDrawOrder,
+		int32 Begin, int32 End, const FMeshDrawRecordParams& Params, const TMap<UMaterialInterface*, FMeshDrawMaterialBinding>& MaterialBindings);
+	static void RecordShadowBatchRange(FRHICommandList& CommandList, const TArray<FMeshBatchElement>& InShadowBatches,
+		int32 Begin, int32 End, const FShadowDrawRecordParams& Params);
+
+private:
+	// NumDraws에 맞춰 사용할 목록 수를 정하고 목록을 비움
+	int32 PrepareLists(int32 NumDraws, bool bAllowParallel);
+
+	// 배치들이 쓰는 머티리얼의 픽셀 상태를 렌더 스레드에서 해석 (MID 캐시 갱신도 여기서 일어남)
+	void ResolveMaterialBindings(const TArray<FMeshBatchElement>& InMeshBatches);
+
+	TArray<FRHICommandList> CommandLists;
+	int32 NumUsedLists = 0;
+
+	// 직전 기록의 머티리얼별 픽셀 상태 (기록 중에는 읽기 전용)
+	TMap<UMaterialInterface*, FMeshDrawMaterialBinding> MaterialBindings;
+};
@@ -0,0 +1,171 @@
+#include "pch.h"
+#include "MeshDrawSort.h"
+
+namespace
+{
+	// 포인터 → NumBits 비트 ID (피보나치 해싱, 상위 비트 사용)
+	inline uint64 HashToBits(uint64 Value, uint32 NumBits)
+	{
+		return (Value * 0x9E3779B97F4A7C15ull) >> (64 - NumBits);
+	}
+
+	inline uint64 PointerBits(const void* Pointer)
+	{
+		return static_cast<uint64>(reinterpret_cast<uintptr_t>(Pointer));
+	}
+
+	inline uint64 MakePipelineId(const FMeshBatchElement& Batch)
+	{
+		return HashToBits(PointerBits(Batch.VertexShader) ^ (PointerBits(Batch.PixelShader) * 31ull), 12);
+	}
+
+	inline uint64 MakeMaterialId(const FMeshBatchElement& Batch)
+	{
+		return HashToBits(PointerBits(Batch.Material) ^ (PointerBits(Batch.InstanceShaderResourceView) * 31ull), 16);
+	}
+
+	inline uint64 MakeMeshId(const FMeshBatchElement& Batch)
+	{
+		return HashToBits(PointerBits(Batch.VertexBuffer) ^ (PointerBits(Batch.IndexBuffer) * 31ull), 16);
+	}
+
+	// 카메라 거리의 float 비트 상위 20비트 (부호 비트 제외, 지수 8 + 가수 상위 11)
+	inline uint64 QuantizeDepth(const FMeshBatchElement& Batch, const FVector& ViewLocation)
+	{
+		const FVector Origin(Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2]);
+		const float Distance = (Origin - ViewLocation).Size();
+
+		uint32 Bits;
+		std::memcpy(&Bits, &Distance, sizeof(Bits));
+		return (Bits & 0x7FFFFFFFu) >> 11;
+	}
+
+	inline bool IsDrawable(const FMeshBatchElement& Batch)
+	{
+		return Batch.VertexShader && Batch.PixelShader && Batch.VertexBuffer && Batch.IndexBuffer && Batch.VertexStride != 0;
+	}
+}
+
+uint64 FMeshDrawSorter::MakeSortKey(const FMeshBatchElement& Batch, const FVector& ViewLocation)
+{
+	const uint64 Pipeline = MakePipelineId(Batch);
+	const uint64 Material = MakeMaterialId(Batch);
+	const uint64 Mesh = MakeMeshId(Batch);
+	const uint64 Depth = QuantizeDepth(Batch, ViewLocation);
+
+	return (Pipeline << 52) | (Material << 36) | (Mesh << 20) | Depth;
+}
+
+void FMeshDrawSorter::RadixSort(TArray<FMeshDrawSortEntry>& InOutEntries, TArray<FMeshDrawSortEntry>& Scratch)
+{
+	const int32 Num = InOutEntries.Num();
+	if (Num <= 1)
+	{
+		return;
+	}
+
+	Scratch.SetNum(Num);
+
+	// 8비트 자릿수 8개의 히스토그램을 한 번의 순회로 계산
+	uint32 Histograms[8][256] = {};
+	for (const FMeshDrawSortEntry& Entry : InOutEntries)
+	{
+		uint64 Key = Entry.Key;
+		for (int32 Pass = 0; Pass < 8; ++Pass)
+		{
+			++Histograms[Pass][Key & 0xFF];
+			Key >>= 8;
+		}
+	}
+
+	FMeshDrawSortEntry* Source = InOutEntries.data();
+	FMeshDrawSortEntry* Dest = Scratch.data();
+
+	for (int32 Pass = 0; Pass < 8; ++Pass)
+	{
+		uint32* Histogram = Histograms[Pass];
+		const uint32 Shift = Pass * 8;
+
+		// 모든 키의 자릿수가 같으면 이 패스는 순서를 바꾸지 않으므로 건너뜀
+		if (Histogram[(Source[0].Key >> Shift) & 0xFF] == static_cast<uint32>(Num))
+		{
+			continue;
+		}
+
+		// 누적 합으로 각 버킷의 시작 위치 계산
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+		{
+			const uint32 Count = Histogram[Bucket];
+			Histogram[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint32 Bucket = static_cast<uint32>((Source[i].Key >> Shift) & 0xFF);
+			Dest[Histogram[Bucket]++] = Source[i];
+		}
+
+		std::swap(Source, Dest);
+	}
+
+	// 홀수 번 스왑했다면 결과가 Scratch에 있음
+	if (Source != InOutEntries.data())
+	{
+		std::memcpy(InOutEntries.data(), Source, sizeof(FMeshDrawSortEntry) * Num);
+	}
+}
+
+const TArray<uint32>& FMeshDrawSorter::Sort(const TArray<FMeshBatchElement>& InMeshBatches, const FVector& ViewLocation)
+{
+	const int32 Num = InMeshBatches.Num();
+
+	Entries.SetNum(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Entries[i].Key = MakeSortKey(InMeshBatches[i], ViewLocation);
+		Entries[i].Index = static_cast<uint32>(i);
+	}
+
+	RadixSort(Entries, Scratch);
+
+	DrawOrder.SetNum(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		DrawOrder[i] = Entries[i].Index;
+	}
+	return DrawOrder;
+}
+
+FMeshDrawStateChanges FMeshDrawSorter::CountStateChanges(const TArray<FMeshBatchElement>& InMeshBatches, const TArray<uint32>* InDrawOrder)
+{
+	FMeshDrawStateChanges Changes;
+	const FMeshBatchElement* Current = nullptr;
+
+	const int32 Num = InMeshBatches.Num();
+	for (int32 DrawIndex = 0; DrawIndex < Num; ++DrawIndex)
+	{
+		const FMeshBatchElement& Batch = InDrawOrder ? InMeshBatches[(*InDrawOrder)[DrawIndex]] : InMeshBatches[DrawIndex];
+		if (!IsDrawable(Batch))
+		{
+			continue;
+		}
+
+		if (!Current || Batch.VertexShader != Current->VertexShader || Batch.PixelShader != Current->PixelShader)
+		{
+			++Changes.ShaderChanges;
+		}
+		if (!Current || Batch.Material != Current->Material || Batch.InstanceShaderResourceView != Current->InstanceShaderResourceView)
+		{
+			++Changes.MaterialChanges;
+		}
+		if (!Current || Batch.VertexBuffer != Current->VertexBuffer || Batch.IndexBuffer != Current->IndexBuffer
+			|| Batch.VertexStride != Current->VertexStride || Batch.PrimitiveTopology != Current->PrimitiveTopology)
+		{
+			++Changes.BufferChanges;
+		}
+		Current = &Batch;
+	}
+	return Changes;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "MeshBatchElement.h"
+#include "DrawSortStats.h"
+
+// 정렬 대상 (키, 원본 배열 인덱스) 쌍
+struct FMeshDrawSortEntry
+{
+	uint64 Key;
+	uint32 Index;
+};
+
+/**
+ * @brief FMeshBatchElement 목록의 64비트 정렬 키 생성과 LSD 기수 정렬
+ * @details 기존 TArray::Sort()는 포인터 필드를 차례로 비교하는 operator<로 ~150바이트 원소 자체를 이동시켰다.
+ * 여기서는 원소마다 64비트 키를 한 번 만들고 16바이트 (키, 인덱스) 쌍만 기수 정렬한 뒤,
+ * DrawMeshBatches가 정렬된 인덱스 목록을 따라 원본 배열을 순회한다.
+ *
+ * 키 구성 (상위 비트가 우선, 상태 우선 + 같은 상태 안에서 앞 → 뒤):
+ * [63:52] 파이프라인(VS/PS) 12 | [51:36] 머티리얼(+인스턴스 SRV) 16 | [35:20] 메시(VB/IB) 16 | [19:0] 깊이 20
+ * 불투명 메시 패스 전용이다. 반투명(파티클)은 이미터 단위로 블렌드 상태가 바뀌어 이 정렬을 쓰지 않는다.
+ *
+ * ID는 포인터를 해시해 비트 수만큼 자른 값이라 드물게 충돌할 수 있다.
+ * 충돌은 같은 그룹으로 묶이지 않아 상태 변경이 조금 늘어날 뿐이며,
+ * DrawMeshBatches는 여전히 실제 포인터를 비교해 바인딩하므로 결과 이미지에는 영향이 없다.
+ * 깊이는 카메라에서 오브젝트 원점까지 거리의 float 비트 상위 20비트 (양수 float는 비트 순서 = 크기 순서).
+ */
+class FMeshDrawSorter
+{
+public:
+	/**
+	 * @brief 배치 목록의 그리기 순서를 계산
+	 * @return InMeshBatches 인덱스의 그리기 순서, 다음 Sort 호출 전까지 유효
+	 */
+	const TArray<uint32>& Sort(const TArray<FMeshBatchElement>& InMeshBatches, const FVector& ViewLocation);
+
+	static uint64 MakeSortKey(const FMeshBatchElement& Batch, const FVector& ViewLocation);
+
+	// 키 오름차순 안정 정렬 (InOutEntries와 같은 크기의 Scratch를 임시 버퍼로 사용)
+	static void RadixSort(TArray<FMeshDrawSortEntry>& InOutEntries, TArray<FMeshDrawSortEntry>& Scratch);
+
+	/**
+	 * @brief 주어진 순서로 그릴 때 DrawMeshBatches가 수행할 상태 변경 횟수
+	 * @param InDrawOrder nullptr이면 수집 순서
+	 */
+	static FMeshDrawStateChanges CountStateChanges(const TArray<FMeshBatchElement>& InMeshBatches, const TArray<uint32>* InDrawOrder);
+
+private:
+	TArray<FMeshDrawSortEntry> Entries;
+	TArray<FMeshDrawSortEntry> Scratch;
+	TArray<uint32> DrawOrder;
+};
@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "MeshDrawSortBenchmark.h"
+#include "MeshDrawSort.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 실행마다 같은 입력을 얻기 위한 고정 시드 LCG
+	struct FBenchmarkRandom
+	{
+		uint32 State = 0x9E3779B9u;
+
+		uint32 NextUInt()
+		{
+			State = State * 1664525u + 1013904223u;
+			return State >> 8;
+		}
+
+		float NextUnit()
+		{
+			return static_cast<float>(NextUInt()) / static_cast<float>(1u << 24);
+		}
+	};
+
+	// 비교에만 쓰이는 가짜 포인터 (역참조하지 않음, 16바이트 정렬된 주소처럼 보이게 함)
+	template<typename T>
+	T* FakePointer(uint32 Base, uint32 Id)
+	{
+		return reinterpret_cast<T*>(static_cast<uintptr_t>(Base + (Id + 1) * 0x40));
+	}
+
+	void LogStateChanges(const char* Label, const FMeshDrawStateChanges& Changes)
+	{
+		UE_LOG("[Bench]   %-17s: Shader %u, Material %u, Buffer %u (Total %u)",
+			Label, Changes.ShaderChanges, Changes.MaterialChanges, Changes.BufferChanges, Changes.Total());
+	}
+}
+
+void FMeshDrawSortBenchmark::Run(int32 NumDraws)
+{
+	if (NumDraws <= 0)
+	{
+		return;
+	}
+
+	// 일반적인 씬 분포: 셰이더 변형 32개, 머티리얼 512개(각 셰이더에 고정), 메시 2048개(각각 머티리얼 1개에 대응)
+	constexpr uint32 NumShaders = 32;
+	constexpr uint32 NumMaterials = 512;
+	constexpr uint32 NumMeshes = 2048;
+
+	FBenchmarkRandom Random;
+	TArray<FMeshBatchElement> Batches;
+	Batches.SetNum(NumDraws);
+	for (FMeshBatchElement& Batch : Batches)
+	{
+		const uint32 MeshId = Random.NextUInt() % NumMeshes;
+		const uint32 MaterialId = MeshId % NumMaterials;
+		const uint32 ShaderId = MaterialId % NumShaders;
+
+		Batch.VertexShader = FakePointer<ID3D11VertexShader>(0x10000000u, ShaderId);
+		Batch.PixelShader = FakePointer<ID3D11PixelShader>(0x20000000u, ShaderId);
+		Batch.InputLayout = FakePointer<ID3D11InputLayout>(0x30000000u, ShaderId);
+		Batch.Material = FakePointer<UMaterialInterface>(0x40000000u, MaterialId);
+		Batch.VertexBuffer = FakePointer<ID3D11Buffer>(0x50000000u, MeshId);
+		Batch.IndexBuffer = FakePointer<ID3D11Buffer>(0x60000000u, MeshId);
+		Batch.VertexStride = 64;
+		Batch.IndexCount = 36;
+		Batch.WorldMatrix = FMatrix::Identity();
+		Batch.WorldMatrix.M[3][0] = (Random.NextUnit() - 0.5f) * 2000.0f;
+		Batch.WorldMatrix.M[3][1] = (Random.NextUnit() - 0.5f) * 2000.0f;
+		Batch.WorldMatrix.M[3][2] = Random.NextUnit() * 200.0f;
+	}
+	const FVector ViewLocation(0.0f, 0.0f, 100.0f);
+
+	// 1) 기존: operator<로 원소 자체를 정렬 (매 프레임 수집 목록을 정렬하던 방식)
+	TArray<FMeshBatchElement> LegacySorted = Batches;
+	FScopeCycleCounter LegacyCounter;
+	LegacySorted.Sort();
+	const double LegacyMs = LegacyCounter.Finish();
+
+	// 2) 64비트 키 + LSD 기수 정렬 (첫 호출의 버퍼 할당이 섞이지 않도록 한 번 미리 실행)
+	FMeshDrawSorter Sorter;
+	Sorter.Sort(Batches, ViewLocation);
+
+	FScopeCycleCounter RadixCounter;
+	const TArray<uint32>& RadixOrder = Sorter.Sort(Batches, ViewLocation);
+	const double RadixMs = RadixCounter.Finish();
+
+	// 3) 같은 키 + std::sort (기수 정렬 자체의 이득 확인 및 결과 검증용)
+	TArray<FMeshDrawSortEntry> Entries;
+	Entries.SetNum(NumDraws);
+	FScopeCycleCounter ComparisonCounter;
+	for (int32 i = 0; i < NumDraws; ++i)
+	{
+		Entries[i].Key = FMeshDrawSorter::MakeSortKey(Batches[i], ViewLocation);
+		Entries[i].Index = static_cast<uint32>(i);
+	}
+	std::stable_sort(Entries.begin(), Entries.end(), [](const FMeshDrawSortEntry& A, const FMeshDrawSortEntry& B)
+	{
+		return A.Key < B.Key;
+	});
+	const double ComparisonMs = ComparisonCounter.Finish();
+
+	// 두 정렬 모두 안정 정렬이므로 인덱스 순서까지 같아야 함
+	int32 NumMismatch = 0;
+	for (int32 i = 0; i < NumDraws; ++i)
+	{
+		NumMismatch += (Entries[i].Index != RadixOrder[i]) ? 1 : 0;
+	}
+
+	const FMeshDrawStateChanges Unsorted = FMeshDrawSorter::CountStateChanges(Batches, nullptr);
+	const FMeshDrawStateChanges Legacy = FMeshDrawSorter::CountStateChanges(LegacySorted, nullptr);
+	const FMeshDrawStateChanges Radix = FMeshDrawSorter::CountStateChanges(Batches, &RadixOrder);
+
+	UE_LOG("[Bench] DrawSort: %d draws (%u shaders, %u materials, %u meshes)", NumDraws, NumShaders, NumMaterials, NumMeshes);
+	UE_LOG("[Bench]   Legacy Sort()     : %.3f ms", LegacyMs);
+	UE_LOG("[Bench]   Key + radix sort  : %.3f ms (x%.2f vs legacy)", RadixMs, RadixMs > 0.0 ? LegacyMs / RadixMs : 0.0);
+	UE_LOG("[Bench]   Key + std::sort   : %.3f ms", ComparisonMs);
+	UE_LOG("[Bench]   Radix order mismatch: %d", NumMismatch);
+	LogStateChanges("Unsorted", Unsorted);
+	LogStateChanges("Legacy sorted", Legacy);
+	LogStateChanges("Radix sorted", Radix);
+	UE_LOG("[Bench]   State changes saved vs unsorted: %u", Unsorted.Total() > Radix.Total() ? Unsorted.Total() - Radix.Total() : 0);
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+/**
+ * @brief 드로우 정렬 성능 비교용 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details 결정적(고정 시드)으로 만든 가짜 배치 목록을 대상으로 하며 GPU 리소스를 만들거나 역참조하지 않는다.
+ */
+class FMeshDrawSortBenchmark
+{
+public:
+	// 기존 TArray::Sort(operator<) vs 64비트 키 + 기수 정렬 vs 64비트 키 + std::sort, 상태 변경 수 비교
+	static void Run(int32 NumDraws);
+};
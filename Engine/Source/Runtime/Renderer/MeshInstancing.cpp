@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "MeshInstancing.h"
+#include "D3D11RHI.h"
+
+FMeshDrawInstancer::~FMeshDrawInstancer()
+{
+	if (InstanceBuffer)
+	{
+		InstanceBuffer->Release();
+		InstanceBuffer = nullptr;
+	}
+}
+
+bool FMeshDrawInstancer::CanInstance(const FMeshBatchElement& Batch)
+{
+	if (!Batch.InstancedVertexShader || !Batch.InstancedPixelShader || !Batch.InstancedInputLayout)
+	{
+		return false;
+	}
+	if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
+	{
+		return false;
+	}
+	if (Batch.InstanceBuffer || Batch.SkinningMatrices || Batch.bClothEnabled || Batch.bIsSky)
+	{
+		return false;
+	}
+
+	// 인스턴스별 오버라이드는 인스턴스 버퍼에 담지 않으므로 기존 경로로 그림
+	const FLinearColor& Color = Batch.InstanceColor;
+	if (Batch.InstanceShaderResourceView || Color.R != 1.0f || Color.G != 1.0f || Color.B != 1.0f || Color.A != 1.0f)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool FMeshDrawInstancer::CanMerge(const FMeshBatchElement& A, const FMeshBatchElement& B)
+{
+	return A.VertexShader == B.VertexShader
+		&& A.PixelShader == B.PixelShader
+		&& A.InstancedVertexShader == B.InstancedVertexShader
+		&& A.InstancedPixelShader == B.InstancedPixelShader
+		&& A.Material == B.Material
+		&& A.VertexBuffer == B.VertexBuffer
+		&& A.IndexBuffer == B.IndexBuffer
+		&& A.VertexStride == B.VertexStride
+		&& A.PrimitiveTopology == B.PrimitiveTopology
+		&& A.IndexCount == B.IndexCount
+		&& A.StartIndex == B.StartIndex
+		&& A.BaseVertexIndex == B.BaseVertexIndex;
+}
+
+const TArray<uint32>& FMeshDrawInstancer::BuildInstancedDraws(D3D11RHI* RHIDevice, TArray<FMeshBatchElement>& InOutMeshBatches, const TArray<uint32>& InDrawOrder)
+{
+	InstancedDrawOrder.Empty();
+	PendingInstances.Empty();
+	MergedRuns.Empty();
+	LastMergedDraws = 0;
+	LastMergedInstances = 0;
+
+	const int32 NumDraws = InDrawOrder.Num();
+	int32 RunBegin = 0;
+	while (RunBegin < NumDraws)
+	{
+		const uint32 FirstIndex = InDrawOrder[RunBegin];
+		const FMeshBatchElement& First = InOutMeshBatches[FirstIndex];
+
+		// 같은 메시/머티리얼/셰이더로 이어지는 구간 찾기
+		int32 RunEnd = RunBegin + 1;
+		if (CanInstance(First))
+		{
+			while (RunEnd < NumDraws)
+			{
+				const FMeshBatchElement& Next = InOutMeshBatches[InDrawOrder[RunEnd]];
+				if (!CanInstance(Next) || !CanMerge(First, Next))
+				{
+					break;
+				}
+				++RunEnd;
+			}
+		}
+
+		const int32 RunLength = RunEnd - RunBegin;
+		if (RunLength < MinInstancesToMerge)
+		{
+			InstancedDrawOrder.Add(FirstIndex);
+			RunBegin = RunEnd;
+			continue;
+		}
+
+		// 구간의 인스턴스 데이터 기록 (배치 수정은 업로드가 성공한 뒤에)
+		const uint32 LocalStart = static_cast<uint32>(PendingInstances.Num());
+		for (int32 DrawIndex = RunBegin; DrawIndex < RunEnd; ++DrawIndex)
+		{
+			const FMeshBatchElement& Batch = InOutMeshBatches[InDrawOrder[DrawIndex]];
+			const FMatrix InverseTranspose = Batch.WorldMatrix.InverseAffine().Transpose();
+
+			FMeshInstanceData& Instance = PendingInstances.emplace_back();
+			Instance.WorldMatrix = Batch.WorldMatrix;
+			Instance.WorldInverseTranspose[0] = InverseTranspose.VRows[0];
+			Instance.WorldInverseTranspose[1] = InverseTranspose.VRows[1];
+			Instance.WorldInverseTranspose[2] = InverseTranspose.VRows[2];
+			Instance.ObjectID = Batch.ObjectID;
+		}
+
+		MergedRuns.Add({ FirstIndex, static_cast<uint32>(RunLength), LocalStart });
+		InstancedDrawOrder.Add(FirstIndex);
+		RunBegin = RunEnd;
+	}
+
+	if (MergedRuns.IsEmpty())
+	{
+		return InstancedDrawOrder;
+	}
+
+	// 버퍼를 준비하지 못하면 합치지 않은 원래 순서로 그림 (배치는 아직 수정하지 않았음)
+	const uint32 BaseInstance = UploadInstances(RHIDevice);
+	if (BaseInstance == UINT32_MAX)
+	{
+		return InDrawOrder;
+	}
+
+	// 구간의 첫 배치를 인스턴스드 드로우로 변환
+	for (const FInstancedRun& Run : MergedRuns)
+	{
+		FMeshBatchElement& Merged = InOutMeshBatches[Run.BatchIndex];
+		Merged.VertexShader = Merged.InstancedVertexShader;
+		Merged.PixelShader = Merged.InstancedPixelShader;
+		Merged.InputLayout = Merged.InstancedInputLayout;
+		Merged.InstanceBuffer = InstanceBuffer;
+		Merged.InstanceCount = Run.NumInstances;
+		Merged.InstanceStride = sizeof(FMeshInstanceData);
+		Merged.StartInstance = BaseInstance + Run.LocalStart;
+
+		++LastMergedDraws;
+		LastMergedInstances += Run.NumInstances;
+	}
+	return InstancedDrawOrder;
+}
+
+uint32 FMeshDrawInstancer::UploadInstances(D3D11RHI* RHIDevice)
+{
+	const uint32 NumInstances = static_cast<uint32>(PendingInstances.Num());
+	D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+
+	// 한 목록이 버퍼보다 크면 2배씩 키워 다시 만듦 (이전 드로우가 참조하는 버퍼는 D3D 런타임이 GPU 사용 후 해제)
+	if (NumInstances > InstanceCapacity)
+	{
+		uint32 NewCapacity = std::max(InstanceCapacity, 4096u);
+		while (NewCapacity < NumInstances)
+		{
+			NewCapacity *= 2;
+		}
+
+		if (InstanceBuffer)
+		{
+			InstanceBuffer->Release();
+			InstanceBuffer = nullptr;
+		}
+
+		D3D11_BUFFER_DESC BufferDesc = {};
+		BufferDesc.ByteWidth = sizeof(FMeshInstanceData) * NewCapacity;
+		BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+		BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		HRESULT hr = RHIDevice->GetDevice()->CreateBuffer(&BufferDesc, nullptr, &InstanceBuffer);
+		if (FAILED(hr))
+		{
+			UE_LOG("FMeshDrawInstancer: Failed to create instance buffer (%u instances)", NewCapacity);
+			InstanceCapacity = 0;
+			return UINT32_MAX;
+		}
+
+		InstanceCapacity = NewCapacity;
+		InstanceWriteOffset = 0;
+		MapType = D3D11_MAP_WRITE_DISCARD;
+	}
+	// 남은 공간이 부족하면 처음부터 다시 씀 (GPU가 읽는 중인 이전 내용은 DISCARD로 보호)
+	else if (InstanceWriteOffset + NumInstances > InstanceCapacity)
+	{
+		InstanceWriteOffset = 0;
+		MapType = D3D11_MAP_WRITE_DISCARD;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (FAILED(RHIDevice->GetDeviceContext()->Map(InstanceBuffer, 0, MapType, 0, &Mapped)))
+	{
+		return UINT32_MAX;
+	}
+
+	FMeshInstanceData* Dest = static_cast<FMeshInstanceData*>(Mapped.pData) + InstanceWriteOffset;
+	std::memcpy(Dest, PendingInstances.data(), sizeof(FMeshInstanceData) * NumInstances);
+	RHIDevice->GetDeviceContext()->Unmap(InstanceBuffer, 0);
+
+	const uint32 BaseInstance = InstanceWriteOffset;
+	InstanceWriteOffset += NumInstances;
+	return BaseInstance;
+}
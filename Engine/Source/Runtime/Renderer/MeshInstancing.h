@@ -0,0 +1,79 @@
+#pragma once
+#include "MeshBatchElement.h"
+
+class D3D11RHI;
+
+/**
+ * @brief 자동 인스턴싱 드로우의 인스턴스 정점 (슬롯 1, 128 bytes)
+ * @details UberLit.hlsl의 MESH_INSTANCING 입력 및 ResourceManager의 "#MESH_INSTANCING" InputLayout과 정확히 일치해야 함
+ */
+struct FMeshInstanceData
+{
+	FMatrix WorldMatrix;				// offset 0  : INSTANCE_WORLD 0~3
+	FVector4 WorldInverseTranspose[3];	// offset 64 : INSTANCE_NORMAL 0~2 (노멀 변환용 3x3의 행)
+	uint32 ObjectID = 0;				// offset 112: INSTANCE_ID (피킹)
+	uint32 Padding[3] = {};
+};
+static_assert(sizeof(FMeshInstanceData) == 128, "FMeshInstanceData must match the MESH_INSTANCING input layout");
+
+/**
+ * @brief 정렬된 드로우 목록에서 연속된 동일 메시/머티리얼 배치를 인스턴스드 드로우 하나로 합치는 단계
+ * @details 정렬(FMeshDrawSorter) 직후, DrawMeshBatches 직전에 실행한다.
+ * VB/IB/섹션 범위/머티리얼/셰이더가 같은 연속 배치를 찾아 첫 배치를 인스턴스드 셰이더 변형으로 바꾸고,
+ * 각 배치의 월드 행렬과 ObjectID는 프레임 간 재사용하는 동적 인스턴스 버퍼에 기록한다.
+ *
+ * 다음 배치는 합치지 않고 기존 경로로 그린다:
+ * - 인스턴스드 셰이더 변형이 없는 배치 (UberLit 이외의 셰이더, 스키닝, 빌보드 등)
+ * - 인스턴스별 오버라이드가 있는 배치 (InstanceColor, InstanceShaderResourceView)
+ * - 스키닝 행렬, 클로스, Sky, 이미 인스턴스 버퍼를 쓰는 배치 (메시 파티클)
+ *
+ * URenderer가 소유하며, 인스턴스 버퍼는 NO_OVERWRITE로 이어 쓰다가 가득 차면 DISCARD로 처음부터 다시 쓴다.
+ */
+class FMeshDrawInstancer
+{
+public:
+	// 이보다 짧은 연속 구간은 합치지 않음
+	static constexpr int32 MinInstancesToMerge = 2;
+
+	~FMeshDrawInstancer();
+
+	/**
+	 * @brief 정렬된 그리기 순서에서 합칠 수 있는 구간을 인스턴스드 드로우로 바꾼다
+	 * @param InOutMeshBatches 합쳐진 구간의 첫 배치가 인스턴스드 드로우로 수정됨
+	 * @return 합쳐진 나머지 배치를 뺀 그리기 순서, 다음 호출 전까지 유효
+	 */
+	const TArray<uint32>& BuildInstancedDraws(D3D11RHI* RHIDevice, TArray<FMeshBatchElement>& InOutMeshBatches, const TArray<uint32>& InDrawOrder);
+
+	// 인스턴싱 가능한 배치인지 (인스턴스드 셰이더 변형이 있고 인스턴스별 오버라이드가 없음)
+	static bool CanInstance(const FMeshBatchElement& Batch);
+
+	// 두 배치를 한 인스턴스드 드로우로 그릴 수 있는지
+	static bool CanMerge(const FMeshBatchElement& A, const FMeshBatchElement& B);
+
+	// 직전 BuildInstancedDraws 결과
+	uint32 GetLastMergedDraws() const { return LastMergedDraws; }
+	uint32 GetLastMergedInstances() const { return LastMergedInstances; }
+
+private:
+	// 인스턴스 데이터를 버퍼에 올리고 첫 인스턴스 위치를 반환 (실패 시 UINT32_MAX)
+	uint32 UploadInstances(D3D11RHI* RHIDevice);
+
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	uint32 InstanceCapacity = 0;
+	uint32 InstanceWriteOffset = 0;
+
+	TArray<FMeshInstanceData> PendingInstances;
+	TArray<uint32> InstancedDrawOrder;
+
+	// 인스턴스드 드로우로 바꿀 구간 (업로드 위치가 정해진 뒤 첫 배치에 적용)
+	struct FInstancedRun
+	{
+		uint32 BatchIndex;
+		uint32 NumInstances;
+		uint32 LocalStart;
+	};
+	TArray<FInstancedRun> MergedRuns;
+
+	uint32 LastMergedDraws = 0;
+	uint32 LastMergedInstances = 0;
+};
@@ -0,0 +1,112 @@
+#pragma once
+#include "UEContainer.h"
+
+// 통계용 LOD 단계 수 (VertexData.h의 MaxMeshLODCount와 같음, 헤더 의존 없이 오버레이에서 쓰기 위해 따로 둠)
+constexpr int32 MeshLODStatSlots = 4;
+
+// 컴포넌트 하나가 마지막으로 고른 LOD
+struct FMeshLODSelection
+{
+	int32 LODIndex = -1;			// -1: LOD를 고르지 않음 (메시 없음 등)
+	uint32 NumTriangles = 0;		// 고른 LOD의 삼각형 수
+	uint32 NumBaseTriangles = 0;	// LOD0 삼각형 수
+};
+
+// 메시 LOD 통계 (한 프레임, 모든 뷰의 불투명 패스 합계)
+struct FMeshLODStats
+{
+	uint32 NumMeshes = 0;
+	uint32 MeshesPerLOD[MeshLODStatSlots] = {};
+	uint32 TrianglesPerLOD[MeshLODStatSlots] = {};
+
+	// LOD0으로 그렸을 때 대비 실제로 그린 삼각형
+	uint64 DrawnTriangles = 0;
+	uint64 BaseTriangles = 0;
+	uint64 SavedTriangles = 0;
+	float SavedPercentage = 0.0f;
+
+	// CPU 스키닝 (LOD0 정점 수 대비 실제로 스키닝한 정점 수와 시간)
+	uint32 SkinnedMeshes = 0;
+	uint64 SkinnedVertices = 0;
+	uint64 BaseSkinnedVertices = 0;
+	double SkinningTimeMS = 0.0;
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		*this = FMeshLODStats();
+	}
+
+	// 파생 통계 계산
+	void CalculateStats()
+	{
+		SavedTriangles = BaseTriangles > DrawnTriangles ? BaseTriangles - DrawnTriangles : 0;
+		SavedPercentage = BaseTriangles > 0 ? static_cast<float>(SavedTriangles) / static_cast<float>(BaseTriangles) * 100.0f : 0.0f;
+	}
+};
+
+// 메시 LOD 통계 전역 매니저 (싱글톤)
+// 한 프레임에 여러 뷰포트가 선택 결과를 누적하고, 오버레이는 지난 프레임의 합계를 표시
+class FMeshLODStatManager
+{
+public:
+	static FMeshLODStatManager& GetInstance()
+	{
+		static FMeshLODStatManager Instance;
+		return Instance;
+	}
+
+	// 프레임 시작 시 호출 (URenderer::BeginFrame): 지난 프레임 누적값을 확정하고 새로 누적 시작
+	void BeginFrame()
+	{
+		FrameStats.CalculateStats();
+		CurrentStats = FrameStats;
+		FrameStats.Reset();
+	}
+
+	// 불투명 패스에서 그린 메시 하나의 LOD 선택 누적
+	void AddSelection(const FMeshLODSelection& Selection)
+	{
+		if (Selection.LODIndex < 0)
+		{
+			return;
+		}
+		const int32 Slot = Selection.LODIndex < MeshLODStatSlots ? Selection.LODIndex : MeshLODStatSlots - 1;
+		++FrameStats.NumMeshes;
+		++FrameStats.MeshesPerLOD[Slot];
+		FrameStats.TrianglesPerLOD[Slot] += Selection.NumTriangles;
+		FrameStats.DrawnTriangles += Selection.NumTriangles;
+		FrameStats.BaseTriangles += Selection.NumBaseTriangles;
+	}
+
+	// CPU 스키닝 한 번 누적
+	void AddCPUSkinning(uint32 NumVertices, uint32 NumBaseVertices, double SkinningTimeMS)
+	{
+		++FrameStats.SkinnedMeshes;
+		FrameStats.SkinnedVertices += NumVertices;
+		FrameStats.BaseSkinnedVertices += NumBaseVertices;
+		FrameStats.SkinningTimeMS += SkinningTimeMS;
+	}
+
+	// 통계 조회 (지난 프레임)
+	const FMeshLODStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+		FrameStats.Reset();
+	}
+
+private:
+	FMeshLODStatManager() = default;
+	~FMeshLODStatManager() = default;
+	FMeshLODStatManager(const FMeshLODStatManager&) = delete;
+	FMeshLODStatManager& operator=(const FMeshLODStatManager&) = delete;
+
+	FMeshLODStats CurrentStats;
+	FMeshLODStats FrameStats;
+};
@@ -0,0 +1,110 @@
+#pragma once
+#include "UEContainer.h"
+
+// CPU 소프트웨어 오클루전 컬링 통계
+// 오클루더 래스터화 비용과 가려진 프리미티브 수를 추적
+struct FOcclusionStats
+{
+	// 깊이 버퍼 해상도
+	uint32 DepthBufferWidth = 0;
+	uint32 DepthBufferHeight = 0;
+
+	// 오클루더 (깊이 버퍼에 그려진 저폴리 메시)
+	uint32 OccluderCandidates = 0;    // 조건(삼각형 수)을 만족한 후보 수
+	uint32 OccluderCount = 0;         // 화면 크기로 선택된 오클루더 수
+	uint32 OccluderTriangles = 0;     // 선택된 오클루더의 전체 삼각형 수
+	uint32 RasterizedTriangles = 0;   // 클리핑/면적 검사를 통과해 래스터화된 삼각형 수
+
+	// 오클루디 (AABB 테스트 대상)
+	uint32 TotalOccludees = 0;
+	uint32 OccludedPrimitives = 0;    // 깊이 버퍼에 가려진 프리미티브 수
+	uint32 OffscreenPrimitives = 0;   // 화면 밖(뒤/먼 평면 밖)으로 판정된 프리미티브 수
+	uint32 VisiblePrimitives = 0;
+
+	// 컬링 효율 (가려짐 + 화면 밖 비율, %)
+	float CulledPercentage = 0.0f;
+
+	// 뷰별 가시성 캐시 (카메라 정지 시 지난 결과 재사용)
+	bool bReusedVisibility = false;   // 이번 프레임이 캐시 재사용(증분 판정)이었는지
+	uint32 CachedPrimitives = 0;      // 캐시된 결과를 그대로 사용한 프리미티브 수
+	uint32 RetestedPrimitives = 0;    // 이동/신규/스키닝으로 다시 판정한 프리미티브 수
+
+	// 비용 (CPU, ms)
+	double SetupTimeMS = 0.0;         // 오클루디 투영 + 오클루더 선택/삼각형 셋업
+	double RasterTimeMS = 0.0;        // 빈 단위 삼각형 래스터화 + HZB 생성
+	double TestTimeMS = 0.0;          // 오클루디 AABB 테스트
+	double TotalTimeMS = 0.0;
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		DepthBufferWidth = 0;
+		DepthBufferHeight = 0;
+		OccluderCandidates = 0;
+		OccluderCount = 0;
+		OccluderTriangles = 0;
+		RasterizedTriangles = 0;
+		TotalOccludees = 0;
+		OccludedPrimitives = 0;
+		OffscreenPrimitives = 0;
+		VisiblePrimitives = 0;
+		CulledPercentage = 0.0f;
+		bReusedVisibility = false;
+		CachedPrimitives = 0;
+		RetestedPrimitives = 0;
+		SetupTimeMS = 0.0;
+		RasterTimeMS = 0.0;
+		TestTimeMS = 0.0;
+		TotalTimeMS = 0.0;
+	}
+
+	// 파생 통계 계산
+	void CalculateStats()
+	{
+		VisiblePrimitives = TotalOccludees - OccludedPrimitives - OffscreenPrimitives;
+		TotalTimeMS = SetupTimeMS + RasterTimeMS + TestTimeMS;
+
+		if (TotalOccludees > 0)
+		{
+			CulledPercentage = static_cast<float>(OccludedPrimitives + OffscreenPrimitives) / static_cast<float>(TotalOccludees) * 100.0f;
+		}
+	}
+};
+
+// 오클루전 컬링 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FOcclusionStatManager
+{
+public:
+	static FOcclusionStatManager& GetInstance()
+	{
+		static FOcclusionStatManager Instance;
+		return Instance;
+	}
+
+	// 통계 업데이트
+	void UpdateStats(const FOcclusionStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	// 통계 조회
+	const FOcclusionStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 통계 리셋
+	void ResetStats()
+	{
+		CurrentStats.Reset();
+	}
+
+private:
+	FOcclusionStatManager() = default;
+	~FOcclusionStatManager() = default;
+	FOcclusionStatManager(const FOcclusionStatManager&) = delete;
+	FOcclusionStatManager& operator=(const FOcclusionStatManager&) = delete;
+
+	FOcclusionStats CurrentStats;
+};
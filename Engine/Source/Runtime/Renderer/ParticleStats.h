@@ -34,6 +34,20 @@ struct FParticleStats
 	double AverageTimePerSystem = 0.0;      // 시스템당 평균 시간
 	double AverageTimePerEmitter = 0.0;     // 에미터당 평균 시간
 	double AverageTimePerParticle = 0.0;    // 파티클당 평균 시간
+
+	// 정렬 통계 (스프라이트 에미터, 뷰마다 정렬하므로 뷰 수만큼 누적)
+	uint32 SortedEmitters = 0;              // 정렬을 수행한 에미터 수
+	uint32 SortedParticles = 0;             // 정렬한 파티클 수
+	double SortTimeMS = 0.0;                // 에미터 정렬 시간 합
+	double MaxEmitterSortTimeMS = 0.0;      // 가장 오래 걸린 에미터 정렬 시간
+
+	// 정점/인스턴스 생성 통계 (FParticleVertexGenerator, 그림자 패스에서 먼저 만든 메시 인스턴스는 제외)
+	uint32 VertexGenerationJobs = 0;        // 병렬 기록 작업 수
+	uint64 VertexGenerationBytes = 0;       // 업로드 메모리에 기록한 바이트 수
+	double VertexGenerationTimeMS = 0.0;    // 준비(정렬) + 맵 + 기록 + 언맵 시간
+
+	// 컬링 통계
+	uint32 FrustumCulledSystems = 0;        // 프러스텀 밖이라 그리지 않은 파티클 시스템 수 (뷰마다 누적)
 	
 	// 메모리 통계
 	uint64 VertexBufferMemoryBytes = 0;     // 정점 버퍼 메모리 사용량
@@ -61,6 +75,14 @@ struct FParticleStats
 		AverageTimePerSystem = 0.0;
 		AverageTimePerEmitter = 0.0;
 		AverageTimePerParticle = 0.0;
+		SortedEmitters = 0;
+		SortedParticles = 0;
+		SortTimeMS = 0.0;
+		MaxEmitterSortTimeMS = 0.0;
+		VertexGenerationJobs = 0;
+		VertexGenerationBytes = 0;
+		VertexGenerationTimeMS = 0.0;
+		FrustumCulledSystems = 0;
 		VertexBufferMemoryBytes = 0;
 		IndexBufferMemoryBytes = 0;
 		InstanceBufferMemoryBytes = 0;
@@ -98,6 +120,65 @@ struct FParticleStats
 	}
 };
 
+// 파티클 시뮬레이션 통계
+// FParticleSimulationManager가 시뮬레이션 단계마다 갱신 (렌더 통계와 갱신 시점이 달라 따로 보관)
+struct FParticleSimulationStats
+{
+	uint32 SimulatedSystems = 0;            // 시뮬레이션한 파티클 시스템 수
+	uint32 SimulatedEmitters = 0;           // 시뮬레이션한 에미터 수 (병렬 작업 단위)
+	uint32 SimulatedParticles = 0;          // 시뮬레이션 후 활성 파티클 수
+	uint32 NumThreads = 0;                  // 시뮬레이션에 참여할 수 있는 스레드 수 (게임 스레드 포함)
+
+	double WallTimeMS = 0.0;                // 시뮬레이션 단계 전체 경과 시간 (동기화 포함)
+	double TotalSystemTimeMS = 0.0;         // 시스템별 시뮬레이션 시간 합 (직렬로 돌렸다면 걸렸을 시간)
+	double MaxSystemTimeMS = 0.0;           // 가장 오래 걸린 시스템의 시간
+
+	// 화면 밖 처리
+	uint32 OffscreenSystems = 0;            // 화면 밖 시간 초과로 시뮬레이션이 줄어든 시스템 수
+	uint32 SkippedOffscreenSystems = 0;     // 그중 이번 프레임 시뮬레이션을 건너뛴 시스템 수
+
+	// 전역 예산 (FParticleBudget)
+	uint32 MaxLiveParticles = 0;            // 예산: 최대 활성 파티클 수 (0이면 제한 없음)
+	uint32 MaxActiveEmitters = 0;           // 예산: 최대 활성 에미터 수 (0이면 제한 없음)
+	uint32 ThrottledSystems = 0;            // 예산 때문에 스폰이 줄어든 시스템 수
+	uint32 ThrottledEmitters = 0;           // 예산 때문에 스폰이 줄어든 에미터 수
+	uint32 ThrottledSpawns = 0;             // 예산 때문에 만들지 못한 파티클 수
+
+	// 웜업
+	uint32 WarmedUpSystems = 0;             // 웜업을 시뮬레이션한 시스템 수 (템플릿마다 하나)
+	uint32 RestoredWarmupSystems = 0;       // 템플릿 스냅샷 복사로 웜업을 끝낸 시스템 수
+	double WarmupTimeMS = 0.0;              // 웜업 시뮬레이션 시간 합 (워커 시간, 시스템 시간에 포함)
+
+	// 충돌 (FParticleCollisionSolver)
+	uint32 CollisionEmitters = 0;           // 충돌을 처리한 에미터 수
+	uint32 CollisionQueries = 0;            // BVH 배치에 넣은 쿼리 수 (세그먼트 + 높이장 격자점)
+	uint32 DeferredCollisionQueries = 0;    // 쿼리 예산을 넘어 다음 프레임으로 미룬 파티클 수
+	uint32 CollisionHits = 0;               // 충돌한 파티클 수
+	uint32 CollisionEvents = 0;             // 발행한 충돌 이벤트 수
+	uint32 HeightFieldRebuilds = 0;         // 다시 샘플링한 높이장 수
+	double CollisionTimeMS = 0.0;           // 충돌 단계 시간 (게임 스레드, 경과 시간에 포함)
+
+	// 에미터 인스턴스 풀 (FParticleEmitterInstancePool, 모든 템플릿 합계)
+	uint32 MaxEmitterInstances = 0;         // 예산: 동시에 시뮬레이션할 에미터 인스턴스 상한 (0이면 제한 없음)
+	uint32 ActiveEmitterInstances = 0;      // 이번 단계에 등록된 시스템의 에미터 인스턴스 수 (빼앗긴 시스템 제외)
+	uint32 StolenSystems = 0;               // 인스턴스 상한 때문에 비활성화하고 인스턴스를 빼앗은 일회성 시스템 수
+	uint32 SuspendedSystems = 0;            // 인스턴스 상한 때문에 쉬고 있는 반복 시스템 수 (이번 단계에 밀려난 시스템 포함)
+	uint32 ResumedSystems = 0;              // 여유가 생겨 풀에서 인스턴스를 다시 꺼낸 시스템 수
+	uint32 CompletedSystems = 0;            // 끝나서 인스턴스를 풀로 돌려준 bAutoDeactivate 시스템 수
+	uint32 PoolHits = 0;                    // 풀에서 꺼내 재사용한 인스턴스 수
+	uint32 PoolMisses = 0;                  // 풀이 비어 새로 만든 인스턴스 수
+	uint32 PoolReleased = 0;                // 풀로 돌려받은 인스턴스 수
+	uint32 PoolDiscarded = 0;               // 풀이 가득 찼거나 템플릿이 바뀌어 삭제한 인스턴스 수
+	uint32 PooledInstances = 0;             // 풀에 보관 중인 인스턴스 수
+	uint64 PooledBytes = 0;                 // 보관 중인 인스턴스의 파티클 메모리
+
+	// 병렬화로 얻은 배율 (시스템 시간 합 / 경과 시간)
+	double GetParallelSpeedup() const
+	{
+		return WallTimeMS > 0.0 ? TotalSystemTimeMS / WallTimeMS : 0.0;
+	}
+};
+
 // 파티클 통계 전역 매니저 (싱글톤)
 // UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
 class FParticleStatManager
@@ -120,11 +201,24 @@ public:
 	{
 		return CurrentStats;
 	}
+
+	// 시뮬레이션 통계 업데이트 (마지막으로 시뮬레이션한 월드 기준)
+	void UpdateSimulationStats(const FParticleSimulationStats& InStats)
+	{
+		SimulationStats = InStats;
+	}
+
+	// 시뮬레이션 통계 조회
+	const FParticleSimulationStats& GetSimulationStats() const
+	{
+		return SimulationStats;
+	}
 	
 	// 통계 리셋
 	void ResetStats()
 	{
 		CurrentStats.Reset();
+		SimulationStats = FParticleSimulationStats();
 	}
 	
 	// 프레임 시작 시 통계 초기화
@@ -140,4 +234,5 @@ private:
 	FParticleStatManager& operator=(const FParticleStatManager&) = delete;
 	
 	FParticleStats CurrentStats;
+	FParticleSimulationStats SimulationStats;
 };
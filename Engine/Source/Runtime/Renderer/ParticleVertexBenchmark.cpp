@@ -0,0 +1,216 @@
+#include "pch.h"
+#include "ParticleVertexBenchmark.h"
+#include "ParticleVertexGenerator.h"
+#include "Particle.h"
+#include "ParticleModuleSubUV.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	// 실행마다 같은 입력을 얻기 위한 고정 시드 LCG
+	struct FBenchmarkRandom
+	{
+		uint32 State = 0x9E3779B9u;
+
+		float NextUnit()
+		{
+			State = State * 1664525u + 1013904223u;
+			return static_cast<float>(State >> 8) / static_cast<float>(1u << 24);
+		}
+
+		float NextRange(float Min, float Max)
+		{
+			return Min + (Max - Min) * NextUnit();
+		}
+	};
+
+	// 4x4 SubUV 아틀라스를 쓰는 스프라이트 에미터 하나의 파티클 버퍼 (FBaseParticle + SubUV Payload)
+	struct FBenchmarkEmitter
+	{
+		TArray<uint8> ParticleData;
+		TArray<uint32> ParticleIndices;
+		FDynamicSpriteEmitterData EmitterData;
+	};
+
+	void SetupEmitter(FBenchmarkEmitter& Emitter, int32 NumParticles, FBenchmarkRandom& Random)
+	{
+		const int32 SubUVOffset = sizeof(FBaseParticle);
+		const int32 Stride = (SubUVOffset + static_cast<int32>(sizeof(FSubUVPayloadData)) + 15) & ~15;
+
+		Emitter.ParticleData.SetNum(NumParticles * Stride);
+		Emitter.ParticleIndices.SetNum(NumParticles);
+		for (int32 i = 0; i < NumParticles; ++i)
+		{
+			// 활성 순서와 저장 순서가 다른 상황을 흉내 내도록 역순 인덱스
+			Emitter.ParticleIndices[i] = static_cast<uint32>(NumParticles - 1 - i);
+
+			uint8* ParticlePtr = Emitter.ParticleData.GetData() + i * Stride;
+			FBaseParticle& Particle = *reinterpret_cast<FBaseParticle*>(ParticlePtr);
+			Particle = FBaseParticle();
+			Particle.Location = FVector(Random.NextRange(-1000.0f, 1000.0f), Random.NextRange(-1000.0f, 1000.0f), Random.NextRange(0.0f, 500.0f));
+			Particle.OldLocation = Particle.Location - FVector(0.0f, 0.0f, 1.0f);
+			Particle.Size = FVector(Random.NextRange(5.0f, 20.0f), Random.NextRange(5.0f, 20.0f), 1.0f);
+			Particle.Rotation = Random.NextRange(-3.0f, 3.0f);
+			Particle.RelativeTime = Random.NextUnit();
+			Particle.Color = FLinearColor(Random.NextUnit(), Random.NextUnit(), Random.NextUnit(), 1.0f);
+
+			reinterpret_cast<FSubUVPayloadData*>(ParticlePtr + SubUVOffset)->ImageIndex = Random.NextRange(0.0f, 15.9f);
+		}
+
+		FDynamicSpriteEmitterReplayDataBase& Source = Emitter.EmitterData.Source;
+		Source.eEmitterType = EDynamicEmitterType::Sprite;
+		Source.ActiveParticleCount = NumParticles;
+		Source.ParticleStride = Stride;
+		Source.SortMode = EParticleSortMode::None;
+		Source.SubUVDataOffset = SubUVOffset;
+		Source.SubImages_Horizontal = 4;
+		Source.SubImages_Vertical = 4;
+		Source.DataContainer.SetView(Emitter.ParticleData.GetData(), Emitter.ParticleIndices.GetData(), NumParticles, Stride);
+		Emitter.EmitterData.Init(false);
+	}
+
+	// 변경 전 GetDynamicMeshElementsEmitter와 같은 방식 (파티클마다 정점 4개 Add + 인덱스 6개 Add 후 memcpy)
+	void GenerateLegacy(const FDynamicSpriteEmitterData& EmitterData, void* Dest)
+	{
+		const FDynamicSpriteEmitterReplayDataBase& SourceData = EmitterData.Source;
+		const int32 ParticleCount = SourceData.ActiveParticleCount;
+		const uint8* ParticleData = SourceData.DataContainer.ParticleData;
+		const uint32* ParticleIndices = SourceData.DataContainer.ParticleIndices;
+		const int32 ParticleStride = SourceData.ParticleStride;
+
+		TArray<FParticleOrder> ParticleOrder;
+		ParticleOrder.SetNum(ParticleCount, FParticleOrder(0, 0.0f));
+		for (int32 i = 0; i < ParticleCount; ++i)
+		{
+			ParticleOrder[i].ParticleIndex = i;
+		}
+
+		TArray<FParticleSpriteVertex> Vertices;
+		Vertices.reserve(ParticleCount * 4);
+		TArray<uint32> Indices;
+		Indices.reserve(ParticleCount * 6);
+
+		const FVector2D UVs[4] = { FVector2D(0.0f, 0.0f), FVector2D(1.0f, 0.0f), FVector2D(0.0f, 1.0f), FVector2D(1.0f, 1.0f) };
+		for (int32 ParticleIndex = 0; ParticleIndex < ParticleCount; ++ParticleIndex)
+		{
+			const int32 SortedParticleIndex = ParticleOrder[ParticleIndex].ParticleIndex;
+			const uint8* ParticlePtr = ParticleData + ParticleIndices[SortedParticleIndex] * ParticleStride;
+			const FBaseParticle& Particle = *reinterpret_cast<const FBaseParticle*>(ParticlePtr);
+			const float SubImageIndex = reinterpret_cast<const FSubUVPayloadData*>(ParticlePtr + SourceData.SubUVDataOffset)->ImageIndex;
+
+			for (int32 CornerIndex = 0; CornerIndex < 4; ++CornerIndex)
+			{
+				FParticleSpriteVertex Vertex;
+				Vertex.Position = Particle.Location;
+				Vertex.OldPosition = Particle.OldLocation;
+				Vertex.RelativeTime = Particle.RelativeTime;
+				Vertex.ParticleId = static_cast<float>(SortedParticleIndex);
+				Vertex.Size = FVector2D(Particle.Size.X, Particle.Size.Y);
+				Vertex.Rotation = Particle.Rotation;
+				Vertex.SubImageIndex = SubImageIndex;
+				Vertex.Color = Particle.Color;
+				Vertex.TexCoord = UVs[CornerIndex];
+				Vertices.Add(Vertex);
+			}
+
+			const uint32 BaseVertexIndex = static_cast<uint32>(ParticleIndex * 4);
+			Indices.Add(BaseVertexIndex + 0);
+			Indices.Add(BaseVertexIndex + 1);
+			Indices.Add(BaseVertexIndex + 2);
+			Indices.Add(BaseVertexIndex + 2);
+			Indices.Add(BaseVertexIndex + 1);
+			Indices.Add(BaseVertexIndex + 3);
+		}
+
+		memcpy(Dest, Vertices.GetData(), Vertices.Num() * sizeof(FParticleSpriteVertex));
+	}
+}
+
+void FParticleVertexBenchmark::Run(int32 NumSprites, int32 NumEmitters, int32 NumFrames)
+{
+	if (NumSprites <= 0 || NumEmitters <= 0 || NumFrames <= 0)
+	{
+		return;
+	}
+
+	NumEmitters = std::min(NumEmitters, NumSprites);
+	const int32 QuadBytes = static_cast<int32>(sizeof(FParticleSpriteVertex)) * 4;
+
+	// 에미터 구성 + 업로드 버퍼 안의 에미터별 시작 위치 (쿼드 288바이트라 모든 시작 위치가 16바이트 정렬)
+	TArray<std::unique_ptr<FBenchmarkEmitter>> Emitters;
+	TArray<FParticleRenderDataDest> Dests;
+	TArray<size_t> Offsets;
+	FBenchmarkRandom Random;
+	size_t TotalBytes = 0;
+	for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; ++EmitterIndex)
+	{
+		const int32 NumParticles = NumSprites / NumEmitters + (EmitterIndex < NumSprites % NumEmitters ? 1 : 0);
+		Emitters.Add(std::make_unique<FBenchmarkEmitter>());
+		SetupEmitter(*Emitters.Last(), NumParticles, Random);
+		Offsets.Add(TotalBytes);
+		TotalBytes += static_cast<size_t>(NumParticles) * QuadBytes;
+	}
+
+	uint8* LegacyBuffer = static_cast<uint8*>(_aligned_malloc(TotalBytes, 16));
+	uint8* DirectBuffer = static_cast<uint8*>(_aligned_malloc(TotalBytes, 16));
+	if (!LegacyBuffer || !DirectBuffer)
+	{
+		_aligned_free(LegacyBuffer);
+		_aligned_free(DirectBuffer);
+		return;
+	}
+
+	for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; ++EmitterIndex)
+	{
+		FParticleRenderDataDest Dest;
+		Dest.VertexData = DirectBuffer + Offsets[EmitterIndex];
+		Dests.Add(Dest);
+	}
+
+	// 1. 기존 방식: 에미터마다 TArray 생성 후 memcpy
+	FScopeCycleCounter LegacyCounter;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; ++EmitterIndex)
+		{
+			GenerateLegacy(Emitters[EmitterIndex]->EmitterData, LegacyBuffer + Offsets[EmitterIndex]);
+		}
+	}
+	const double LegacyMs = LegacyCounter.Finish();
+
+	// 2. 직접 기록 (SSE 쿼드 확장 + 스트리밍 저장), 단일 스레드 / 병렬
+	FParticleVertexGenerator Generator;
+	for (const std::unique_ptr<FBenchmarkEmitter>& Emitter : Emitters)
+	{
+		Generator.AddEmitter(&Emitter->EmitterData);
+	}
+
+	FScopeCycleCounter SerialCounter;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Generator.GenerateInto(nullptr, Dests, false);
+	}
+	const double SerialMs = SerialCounter.Finish();
+
+	memset(DirectBuffer, 0, TotalBytes);
+
+	FScopeCycleCounter ParallelCounter;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Generator.GenerateInto(nullptr, Dests, true);
+	}
+	const double ParallelMs = ParallelCounter.Finish();
+
+	// SubUV 인덱스가 범위 안이므로 두 방식의 결과는 바이트 단위로 같아야 함
+	const bool bIdentical = memcmp(LegacyBuffer, DirectBuffer, TotalBytes) == 0;
+
+	UE_LOG("[Bench] ParticleVertex: %d sprites in %d emitters, %d frames, %.2f MB/frame, %d jobs",
+		NumSprites, NumEmitters, NumFrames, static_cast<double>(TotalBytes) / (1024.0 * 1024.0), Generator.GetNumJobs());
+	UE_LOG("[Bench]   Legacy (TArray + memcpy) : %.3f ms (%.3f ms/frame)", LegacyMs, LegacyMs / NumFrames);
+	UE_LOG("[Bench]   Direct (serial)          : %.3f ms (%.3f ms/frame), x%.2f", SerialMs, SerialMs / NumFrames, SerialMs > 0.0 ? LegacyMs / SerialMs : 0.0);
+	UE_LOG("[Bench]   Direct (parallel)        : %.3f ms (%.3f ms/frame), x%.2f", ParallelMs, ParallelMs / NumFrames, ParallelMs > 0.0 ? LegacyMs / ParallelMs : 0.0);
+	UE_LOG("[Bench]   Output: %s", bIdentical ? "identical" : "MISMATCH");
+
+	_aligned_free(LegacyBuffer);
+	_aligned_free(DirectBuffer);
+}
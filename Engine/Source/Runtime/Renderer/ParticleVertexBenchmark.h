@@ -0,0 +1,13 @@
+#pragma once
+
+/**
+ * @brief 파티클 정점 생성 비교용 헤드리스 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details GPU 버퍼 대신 16바이트 정렬 CPU 메모리를 업로드 버퍼처럼 사용하며, 정렬 없는 스프라이트 에미터를 고정 시드로 만든다.
+ */
+class FParticleVertexBenchmark
+{
+public:
+	// NumSprites개를 NumEmitters개 에미터에 나눠 NumFrames 프레임 동안 생성
+	// 기존 TArray + memcpy vs 직접 기록(단일 스레드) vs 직접 기록(병렬), 결과 바이트 비교
+	static void Run(int32 NumSprites, int32 NumEmitters, int32 NumFrames);
+};
@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "ParticleVertexGenerator.h"
+#include "ParticleStats.h"
+#include "TaskScheduler.h"
+#include "PlatformTime.h"
+
+void FParticleVertexGenerator::Reset()
+{
+	Entries.Empty();
+	Jobs.Empty();
+	GeneratedBytes = 0;
+}
+
+void FParticleVertexGenerator::AddEmitter(const FDynamicEmitterDataBase* EmitterData)
+{
+	if (!EmitterData)
+	{
+		return;
+	}
+
+	// 메시 인스턴스처럼 뷰와 무관한 결과는 그림자 패스에서 만든 것을 그대로 사용
+	if (!EmitterData->IsRenderDataViewDependent() && EmitterData->HasGeneratedRenderData())
+	{
+		return;
+	}
+
+	FEmitterEntry Entry;
+	Entry.EmitterData = EmitterData;
+	Entries.Add(Entry);
+}
+
+void FParticleVertexGenerator::BuildJobs(const FSceneView* View)
+{
+	Jobs.Empty();
+	GeneratedBytes = 0;
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		FEmitterEntry& Entry = Entries[EntryIndex];
+		Entry.NumItems = Entry.EmitterData->PrepareRenderData(View);
+		if (Entry.NumItems <= 0)
+		{
+			Entry.NumItems = 0;
+			Entry.EmitterData->MarkRenderDataGenerated(0);
+			continue;
+		}
+
+		// 기록 위치는 항목 인덱스 * 항목 크기로 정해지므로 구간만 나누면 작업끼리 겹치지 않음
+		for (int32 Begin = 0; Begin < Entry.NumItems; Begin += JobSize)
+		{
+			FJob Job;
+			Job.EntryIndex = EntryIndex;
+			Job.Begin = Begin;
+			Job.End = std::min(Begin + JobSize, Entry.NumItems);
+			Jobs.Add(Job);
+		}
+		GeneratedBytes += static_cast<uint64>(Entry.NumItems) * Entry.EmitterData->GetRenderDataItemBytes();
+	}
+}
+
+void FParticleVertexGenerator::RunJobs(bool bAllowParallel) const
+{
+	auto RunJob = [this](int32 JobIndex)
+	{
+		const FJob& Job = Jobs[JobIndex];
+		const FEmitterEntry& Entry = Entries[Job.EntryIndex];
+		Entry.EmitterData->WriteRenderData(Entry.Dest, Job.Begin, Job.End);
+	};
+
+	if (bAllowParallel)
+	{
+		ParallelFor(Jobs.Num(), RunJob);
+	}
+	else
+	{
+		for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+		{
+			RunJob(JobIndex);
+		}
+	}
+}
+
+void FParticleVertexGenerator::Generate(const FSceneView* View, FParticleStats* OutStats, bool bAllowParallel)
+{
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	FScopeCycleCounter GenerateCounter;
+
+	// 1. 준비 + 작업 구성
+	BuildJobs(View);
+
+	// 2. 맵 (디바이스 컨텍스트는 렌더 스레드에서만 사용), 실패한 에미터의 작업은 빈 구간으로 만듦
+	for (FEmitterEntry& Entry : Entries)
+	{
+		if (Entry.NumItems > 0 && !Entry.EmitterData->MapRenderData(Entry.Dest))
+		{
+			Entry.NumItems = 0;
+		}
+	}
+	for (FJob& Job : Jobs)
+	{
+		if (Entries[Job.EntryIndex].NumItems == 0)
+		{
+			Job.End = Job.Begin;
+		}
+	}
+
+	// 3. 기록
+	RunJobs(bAllowParallel);
+
+	// 4. 언맵 후 GetDynamicMeshElementsEmitter가 결과를 쓰도록 표시
+	for (FEmitterEntry& Entry : Entries)
+	{
+		if (Entry.NumItems > 0)
+		{
+			Entry.EmitterData->UnmapRenderData();
+		}
+		Entry.EmitterData->MarkRenderDataGenerated(Entry.NumItems);
+	}
+
+	const double ElapsedMS = GenerateCounter.Finish();
+	if (OutStats)
+	{
+		OutStats->VertexGenerationJobs += static_cast<uint32>(Jobs.Num());
+		OutStats->VertexGenerationBytes += GeneratedBytes;
+		OutStats->VertexGenerationTimeMS += ElapsedMS;
+	}
+}
+
+int32 FParticleVertexGenerator::GenerateInto(const FSceneView* View, const TArray<FParticleRenderDataDest>& Dests, bool bAllowParallel)
+{
+	BuildJobs(View);
+
+	int32 NumItems = 0;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		Entries[EntryIndex].Dest = Dests[EntryIndex];
+		NumItems += Entries[EntryIndex].NumItems;
+	}
+
+	RunJobs(bAllowParallel);
+	return NumItems;
+}
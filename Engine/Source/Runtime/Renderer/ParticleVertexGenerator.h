@@ -0,0 +1,69 @@
+#pragma once
+#include "DynamicEmitterDataBase.h"
+
+struct FParticleStats;
+
+/**
+ * @brief 보이는 모든 파티클 에미터의 정점/인스턴스를 한 번에 병렬 생성
+ * @details 기존에는 GetDynamicMeshElementsEmitter가 에미터 하나씩 TArray에 정점을 만들고 memcpy로 올렸다.
+ * 여기서는 패스 시작 시 에미터를 모아
+ * 1. 준비: 에미터별 정렬 (렌더 스레드, 큰 에미터는 정렬기 내부에서 병렬)
+ * 2. 맵: 에미터 업로드 버퍼를 WRITE_DISCARD로 맵하고, 파티클을 JobSize개씩 나눈 작업의 기록 위치를 미리 계산
+ * 3. 기록: 모든 에미터의 작업을 한 번의 ParallelFor로 처리하며 워커가 맵한 메모리에 바로 기록
+ * 4. 언맵: 렌더 스레드에서 모든 버퍼 언맵
+ * 순서로 처리한다. 이후 GetDynamicMeshElementsEmitter는 배치만 만든다.
+ *
+ * URenderer가 소유하며, 작업 목록은 프레임 간 재사용된다. Reset → AddEmitter → Generate 순서로 한 패스 안에서 호출
+ */
+class FParticleVertexGenerator
+{
+public:
+	// 작업 하나가 맡을 파티클 수 (스프라이트 2048개 = 576KB 기록)
+	static constexpr int32 JobSize = 2048;
+
+	void Reset();
+
+	/** 생성할 에미터 등록 (뷰와 무관한 결과를 이미 만들었으면 건너뜀) */
+	void AddEmitter(const FDynamicEmitterDataBase* EmitterData);
+
+	/**
+	 * @brief 등록된 에미터의 정점/인스턴스 생성
+	 * @param OutStats nullptr이 아니면 생성 시간/작업 수/기록 바이트 누적
+	 * @param bAllowParallel false면 호출 스레드에서 순서대로 기록 (벤치마크 비교용)
+	 */
+	void Generate(const FSceneView* View, FParticleStats* OutStats = nullptr, bool bAllowParallel = true);
+
+	/**
+	 * @brief 맵 대신 호출 측이 준 메모리에 기록 (벤치마크용, Dests는 에미터 등록 순서)
+	 * @return 기록한 항목 수 합
+	 */
+	int32 GenerateInto(const FSceneView* View, const TArray<FParticleRenderDataDest>& Dests, bool bAllowParallel = true);
+
+	// 직전 Generate 결과 (통계/벤치마크용)
+	int32 GetNumJobs() const { return Jobs.Num(); }
+	uint64 GetGeneratedBytes() const { return GeneratedBytes; }
+
+private:
+	struct FEmitterEntry
+	{
+		const FDynamicEmitterDataBase* EmitterData = nullptr;
+		FParticleRenderDataDest Dest;
+		int32 NumItems = 0;
+	};
+
+	// 에미터 하나의 [Begin, End) 항목 구간
+	struct FJob
+	{
+		int32 EntryIndex = 0;
+		int32 Begin = 0;
+		int32 End = 0;
+	};
+
+	/** 에미터 준비 후 작업 목록 구성 (NumItems가 0인 에미터는 제외) */
+	void BuildJobs(const FSceneView* View);
+	void RunJobs(bool bAllowParallel) const;
+
+	TArray<FEmitterEntry> Entries;
+	TArray<FJob> Jobs;
+	uint64 GeneratedBytes = 0;
+};
@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "RHICommandListBenchmark.h"
+#include "MeshDrawCommandRecorder.h"
+#include "MeshDrawSort.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
+
+namespace
+{
+	// 실행마다 같은 입력을 얻기 위한 고정 시드 LCG
+	struct FBenchmarkRandom
+	{
+		uint32 State = 0x9E3779B9u;
+
+		uint32 NextUInt()
+		{
+			State = State * 1664525u + 1013904223u;
+			return State >> 8;
+		}
+	};
+
+	// 비교/전달에만 쓰이는 가짜 포인터 (Null 백엔드는 역참조하지 않음)
+	template<typename T>
+	T* FakePointer(uint32 Base, uint32 Id)
+	{
+		return reinterpret_cast<T*>(static_cast<uintptr_t>(Base + (Id + 1) * 0x40));
+	}
+
+	// 기록 + Null 실행 한 번의 결과
+	struct FRecordResult
+	{
+		double RecordMs = 0.0;
+		double ExecuteMs = 0.0;
+		int32 NumLists = 0;
+		uint32 NumBytes = 0;
+		FNullRHIStats Stats;
+	};
+
+	FRecordResult RecordAndExecute(FMeshDrawCommandRecorder& Recorder, const TArray<FMeshBatchElement>& Batches, const TArray<uint32>& DrawOrder,
+		const FMeshDrawRecordParams& Params, bool bAllowParallel)
+	{
+		FRecordResult Result;
+		FNullRHICommandContext NullContext;
+
+		FScopeCycleCounter RecordCounter;
+		Recorder.RecordMeshBatches(Batches, &DrawOrder, Params, bAllowParallel);
+		Result.RecordMs = RecordCounter.Finish();
+
+		FScopeCycleCounter ExecuteCounter;
+		Recorder.Execute(NullContext);
+		Result.ExecuteMs = ExecuteCounter.Finish();
+
+		Result.NumLists = Recorder.GetNumUsedLists();
+		Result.NumBytes = Recorder.GetNumRecordedBytes();
+		Result.Stats = NullContext.GetStats();
+		return Result;
+	}
+
+	void LogResult(const char* Label, const FRecordResult& Result)
+	{
+		UE_LOG("[Bench]   %-15s: record %.3f ms, execute %.3f ms, %d list(s), %u KB, %u cmds (%u state, %u cb, %u draws)",
+			Label, Result.RecordMs, Result.ExecuteMs, Result.NumLists, Result.NumBytes / 1024,
+			Result.Stats.NumCommands, Result.Stats.NumStateCommands, Result.Stats.NumConstantBufferUpdates, Result.Stats.NumDraws);
+	}
+
+	void CompareAndLog(const TArray<FMeshBatchElement>& Batches, const TArray<uint32>& DrawOrder, const FMeshDrawRecordParams& Params)
+	{
+		// 첫 호출의 버퍼 할당이 섞이지 않도록 한 번씩 미리 실행
+		FMeshDrawCommandRecorder Recorder;
+		RecordAndExecute(Recorder, Batches, DrawOrder, Params, false);
+		RecordAndExecute(Recorder, Batches, DrawOrder, Params, true);
+
+		const FRecordResult Single = RecordAndExecute(Recorder, Batches, DrawOrder, Params, false);
+		const FRecordResult Parallel = RecordAndExecute(Recorder, Batches, DrawOrder, Params, true);
+
+		// 구간 분할은 구간 시작 상태만 다시 기록하므로 드로우/인덱스 수는 같아야 함
+		const bool bMatch = Single.Stats.NumDraws == Parallel.Stats.NumDraws && Single.Stats.NumIndices == Parallel.Stats.NumIndices;
+
+		LogResult("Single list", Single);
+		LogResult("Parallel lists", Parallel);
+		UE_LOG("[Bench]   Record speedup: x%.2f, draw count match: %s",
+			Parallel.RecordMs > 0.0 ? Single.RecordMs / Parallel.RecordMs : 0.0, bMatch ? "yes" : "NO");
+	}
+}
+
+void FRHICommandListBenchmark::Run(int32 NumDraws)
+{
+	if (NumDraws <= 0)
+	{
+		return;
+	}
+
+	// FMeshDrawSortBenchmark와 같은 분포 (머티리얼 대신 인스턴스 SRV로 픽셀 상태 변경을 흉내냄)
+	constexpr uint32 NumShaders = 32;
+	constexpr uint32 NumMaterials = 512;
+	constexpr uint32 NumMeshes = 2048;
+
+	FBenchmarkRandom Random;
+	TArray<FMeshBatchElement> Batches;
+	Batches.SetNum(NumDraws);
+	for (FMeshBatchElement& Batch : Batches)
+	{
+		const uint32 MeshId = Random.NextUInt() % NumMeshes;
+		const uint32 MaterialId = MeshId % NumMaterials;
+		const uint32 ShaderId = MaterialId % NumShaders;
+
+		Batch.VertexShader = FakePointer<ID3D11VertexShader>(0x10000000u, ShaderId);
+		Batch.PixelShader = FakePointer<ID3D11PixelShader>(0x20000000u, ShaderId);
+		Batch.InputLayout = FakePointer<ID3D11InputLayout>(0x30000000u, ShaderId);
+		Batch.InstanceShaderResourceView = FakePointer<ID3D11ShaderResourceView>(0x40000000u, MaterialId);
+		Batch.VertexBuffer = FakePointer<ID3D11Buffer>(0x50000000u, MeshId);
+		Batch.IndexBuffer = FakePointer<ID3D11Buffer>(0x60000000u, MeshId);
+		Batch.VertexStride = 64;
+		Batch.IndexCount = 36;
+		Batch.ObjectID = MeshId;
+		Batch.WorldMatrix = FMatrix::Identity();
+		Batch.WorldMatrix.M[3][0] = static_cast<float>(Random.NextUInt() % 2000);
+		Batch.WorldMatrix.M[3][1] = static_cast<float>(Random.NextUInt() % 2000);
+	}
+
+	// 실제 패스와 같이 정렬된 순서로 기록
+	FMeshDrawSorter Sorter;
+	const TArray<uint32>& DrawOrder = Sorter.Sort(Batches, FVector(0.0f, 0.0f, 100.0f));
+
+	FMeshDrawRecordParams Params;
+	Params.DefaultSampler = FakePointer<ID3D11SamplerState>(0x70000000u, 0);
+	Params.ShadowSampler = FakePointer<ID3D11SamplerState>(0x70000000u, 1);
+	Params.VSMSampler = FakePointer<ID3D11SamplerState>(0x70000000u, 2);
+
+	UE_LOG("[Bench] RHICommandList: %d draws (%u shaders, %u materials, %u meshes), %d threads",
+		NumDraws, NumShaders, NumMaterials, NumMeshes, FTaskScheduler::Get().GetMaxConcurrency());
+	CompareAndLog(Batches, DrawOrder, Params);
+}
+
+void FRHICommandListBenchmark::RunScenePass(const TArray<FMeshBatchElement>& Batches, const TArray<uint32>& DrawOrder, const FMeshDrawRecordParams& Params)
+{
+	if (DrawOrder.IsEmpty())
+	{
+		UE_LOG("[Bench] RHICommandList (scene): opaque pass has no draws");
+		return;
+	}
+
+	UE_LOG("[Bench] RHICommandList (scene opaque pass): %d batches, %d draws after instancing, %d threads",
+		Batches.Num(), DrawOrder.Num(), FTaskScheduler::Get().GetMaxConcurrency());
+	CompareAndLog(Batches, DrawOrder, Params);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+struct FMeshBatchElement;
+struct FMeshDrawRecordParams;
+
+/**
+ * @brief 명령 목록 기록/실행 비용 측정용 헤드리스 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details 기록한 목록을 FNullRHICommandContext로 실행하므로 GPU 리소스를 만들거나 역참조하지 않는다.
+ * - Run: 가짜 배치 (디바이스/씬 없이 실행 가능)
+ * - RunScenePass: 다음 프레임 불투명 패스의 실제 배치와 그리기 순서 (머티리얼/스키닝/자동 인스턴싱 결과 포함)
+ */
+class FRHICommandListBenchmark
+{
+public:
+	// 단일 목록 기록 vs 병렬 기록, Null 백엔드 실행 비용과 두 결과의 드로우 수 일치 여부 비교
+	static void Run(int32 NumDraws);
+
+	// 다음에 그려지는 불투명 패스로 같은 비교를 하도록 요청 (BENCH RHICMD SCENE)
+	static void RequestScenePass() { bScenePassRequested = true; }
+
+	// 요청이 있었으면 지우고 true (FSceneRenderer::RenderOpaquePass가 그리기 직전에 확인)
+	static bool ConsumeScenePassRequest()
+	{
+		const bool bRequested = bScenePassRequested;
+		bScenePassRequested = false;
+		return bRequested;
+	}
+
+	// 실제 패스의 입력으로 단일 vs 병렬 기록과 Null 실행 비용 비교 (실제 패스의 기록/실행에는 영향 없음)
+	static void RunScenePass(const TArray<FMeshBatchElement>& Batches, const TArray<uint32>& DrawOrder, const FMeshDrawRecordParams& Params);
+
+private:
+	static inline bool bScenePassRequested = false;
+};
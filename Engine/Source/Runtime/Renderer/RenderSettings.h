@@ -41,6 +41,10 @@ public:
     void SetSkinningMode(ESkinningMode In) { SkinningMode = In; }
     ESkinningMode GetSkinningMode() const { return SkinningMode; }
 
+    // 메시 LOD 강제 (-1: 화면 크기로 자동 선택, 0~: 해당 LOD 고정, 메시의 LOD 수를 넘으면 가장 낮은 LOD)
+    void SetForcedLOD(int32 In) { ForcedLOD = In; }
+    int32 GetForcedLOD() const { return ForcedLOD; }
+
     // Background Color (for preview windows)
     void SetBackgroundColor(float R, float G, float B) { BackgroundColor[0] = R; BackgroundColor[1] = G; BackgroundColor[2] = B; }
     const float* GetBackgroundColor() const { return BackgroundColor; }
@@ -63,6 +67,9 @@ private:
 	// SkinningMode
 	ESkinningMode SkinningMode = ESkinningMode::GPU;
 
+    // 메시 LOD 강제 (-1: 자동)
+    int32 ForcedLOD = -1;
+
     // Background Color (for preview windows)
     float BackgroundColor[3] = { 0.0f, 0.0f, 0.0f };  // 기본값: 검은색
 };
@@ -29,7 +29,16 @@
 #include "EditorEngine.h"
 #include "DecalComponent.h"
 #include "DecalStatManager.h"
+#include "ShadowStats.h"
+#include "MeshLODStats.h"
 #include "SceneRenderer.h"
+#include "SceneProxyCollector.h"
+#include "MeshDrawSort.h"
+#include "MeshInstancing.h"
+#include "MeshDrawCommandRecorder.h"
+#include "D3D11RHICommandContext.h"
+#include "DecalRenderResources.h"
+#include "ParticleVertexGenerator.h"
 #include "SceneView.h"
 #include "GPUProfiler.h"
 #include "StatsOverlayD2D.h"
@@ -42,6 +51,14 @@ URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 	InitializePrimitiveBatch();
 	GPUTimer = new FGPUTimer(InDevice->GetDevice(), InDevice->GetDeviceContext());
 	UStatsOverlayD2D::Get().SetGPUTimer(GPUTimer);
+	OcclusionCuller = new FOcclusionCullingManagerCPU();
+	SceneProxyCollector = new FSceneProxyCollector();
+	MeshDrawSorter = new FMeshDrawSorter();
+	MeshDrawInstancer = new FMeshDrawInstancer();
+	MeshDrawCommandRecorder = new FMeshDrawCommandRecorder();
+	RHICommandContext = new FD3D11RHICommandContext(InDevice);
+	DecalRenderResources = new FDecalRenderResources(InDevice);
+	ParticleVertexGenerator = new FParticleVertexGenerator();
 }
 
 URenderer::~URenderer()
@@ -64,6 +81,54 @@ URenderer::~URenderer()
 		delete GPUTimer;
 		GPUTimer = nullptr;
 	}
+
+	if (OcclusionCuller)
+	{
+		delete OcclusionCuller;
+		OcclusionCuller = nullptr;
+	}
+
+	if (SceneProxyCollector)
+	{
+		delete SceneProxyCollector;
+		SceneProxyCollector = nullptr;
+	}
+
+	if (MeshDrawSorter)
+	{
+		delete MeshDrawSorter;
+		MeshDrawSorter = nullptr;
+	}
+
+	if (MeshDrawInstancer)
+	{
+		delete MeshDrawInstancer;
+		MeshDrawInstancer = nullptr;
+	}
+
+	if (MeshDrawCommandRecorder)
+	{
+		delete MeshDrawCommandRecorder;
+		MeshDrawCommandRecorder = nullptr;
+	}
+
+	if (RHICommandContext)
+	{
+		delete RHICommandContext;
+		RHICommandContext = nullptr;
+	}
+
+	if (DecalRenderResources)
+	{
+		delete DecalRenderResources;
+		DecalRenderResources = nullptr;
+	}
+
+	if (ParticleVertexGenerator)
+	{
+		delete ParticleVertexGenerator;
+		ParticleVertexGenerator = nullptr;
+	}
 }
 
 void URenderer::BeginFrame()
@@ -81,6 +146,14 @@ void URenderer::BeginFrame()
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
 
+	// 지난 프레임의 월드 프록시 수집 결과 무효화
+	SceneProxyCollector->BeginFrame();
+
+	// 지난 프레임에 누적된 드로우 정렬 통계 확정
+	FDrawSortStatManager::GetInstance().BeginFrame();
+	FShadowStatManager::GetInstance().BeginFrame();
+	FMeshLODStatManager::GetInstance().BeginFrame();
+
 	RHIDevice->ClearAllBuffer();
 }
 
@@ -97,6 +170,12 @@ void URenderer::EndFrame()
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	// 뷰포트에 묶인 영속 상태를 연결 (가시성 캐시가 프레임을 넘어 유지되도록)
+	if (!View->ViewState && Viewport)
+	{
+		View->ViewState = Viewport->GetViewState();
+	}
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
 	FSceneRenderer SceneRenderer(World, View, this);
 
@@ -136,6 +215,8 @@ UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) con
 		DeviceContext->Unmap(RHIDevice->GetIdStagingBuffer(), 0);
 	}
 
+	// 데칼 수신 표시 비트는 ID가 아님
+	PickedId &= ~FMeshBatchElement::DecalReceiverIDBit;
 	if (PickedId == 0)
 		return nullptr;
 	return Cast<UPrimitiveComponent>(GUObjectArray[PickedId]);
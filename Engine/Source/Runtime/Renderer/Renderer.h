@@ -14,6 +14,14 @@ class UPrimitiveComponent;
 class UCameraComponent;
 class FSceneView;
 class FGPUTimer;
+class FOcclusionCullingManagerCPU;
+class FSceneProxyCollector;
+class FMeshDrawSorter;
+class FMeshDrawInstancer;
+class FMeshDrawCommandRecorder;
+class FD3D11RHICommandContext;
+class FDecalRenderResources;
+class FParticleVertexGenerator;
 
 struct FMaterialSlot;
 
@@ -59,6 +67,30 @@ public:
 
 	FGPUTimer* GetGPUTimer() const { return GPUTimer; }
 
+	// 뷰마다 재사용하는 CPU 소프트웨어 오클루전 컬러 (깊이 버퍼/스레드 버퍼를 프레임 간 유지)
+	FOcclusionCullingManagerCPU* GetOcclusionCuller() const { return OcclusionCuller; }
+
+	// 월드 단위 프록시 수집 결과를 같은 프레임의 뷰포트끼리 공유 (BeginFrame마다 무효화)
+	FSceneProxyCollector* GetSceneProxyCollector() const { return SceneProxyCollector; }
+
+	// 뷰마다 재사용하는 드로우 정렬기 (정렬 키/인덱스 버퍼를 프레임 간 유지)
+	FMeshDrawSorter* GetMeshDrawSorter() const { return MeshDrawSorter; }
+
+	// 정렬된 배치의 자동 인스턴싱 (인스턴스 버퍼를 프레임 간 유지)
+	FMeshDrawInstancer* GetMeshDrawInstancer() const { return MeshDrawInstancer; }
+
+	// 메시/섀도우 드로우를 병렬로 기록하는 명령 목록 (버퍼를 프레임 간 유지)
+	FMeshDrawCommandRecorder* GetMeshDrawCommandRecorder() const { return MeshDrawCommandRecorder; }
+
+	// 기록한 명령 목록을 D3D11 디바이스 컨텍스트로 실행하는 백엔드
+	FD3D11RHICommandContext* GetRHICommandContext() const { return RHICommandContext; }
+
+	// 클러스터 데칼 패스의 텍스처 아틀라스/데칼 정보 버퍼 (프레임 간 유지)
+	FDecalRenderResources* GetDecalRenderResources() const { return DecalRenderResources; }
+
+	// 파티클 에미터 정점/인스턴스 병렬 생성기 (작업 목록을 프레임 간 유지)
+	FParticleVertexGenerator* GetParticleVertexGenerator() const { return ParticleVertexGenerator; }
+
 private:
 	D3D11RHI* RHIDevice;    // NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
 
@@ -95,5 +127,21 @@ private:
 	ACameraActor* CurrentCamera = nullptr;
 
 	FGPUTimer* GPUTimer = nullptr;
+
+	FOcclusionCullingManagerCPU* OcclusionCuller = nullptr;
+
+	FSceneProxyCollector* SceneProxyCollector = nullptr;
+
+	FMeshDrawSorter* MeshDrawSorter = nullptr;
+
+	FMeshDrawInstancer* MeshDrawInstancer = nullptr;
+
+	FMeshDrawCommandRecorder* MeshDrawCommandRecorder = nullptr;
+
+	FD3D11RHICommandContext* RHICommandContext = nullptr;
+
+	FDecalRenderResources* DecalRenderResources = nullptr;
+
+	FParticleVertexGenerator* ParticleVertexGenerator = nullptr;
 };
 
@@ -0,0 +1,446 @@
+#include "pch.h"
+#include "Scene.h"
+#include "World.h"
+#include "RenderSettings.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "SkinnedMeshComponent.h"
+#include "BillboardComponent.h"
+#include "DecalComponent.h"
+#include "LineComponent.h"
+#include "ParticleSystemComponent.h"
+#include "HeightFogComponent.h"
+#include "DirectionalLightComponent.h"
+#include "AmbientLightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+#include "Gizmo/GizmoArrowComponent.h"
+#include "WorldPartitionManager.h"
+
+namespace
+{
+	// 그림자 플래그가 있는 컴포넌트 (메시/라이트)만 CastShadow를 채움
+	template<typename T>
+	uint8 GetCastShadowFlag(T* Component)
+	{
+		if constexpr (std::is_base_of_v<UMeshComponent, T> || std::is_base_of_v<ULightComponentBase, T>)
+		{
+			return Component->IsCastShadows() ? FSceneProxyFlags::CastShadow : 0;
+		}
+		else
+		{
+			return 0;
+		}
+	}
+
+	/**
+	 * @brief 레코드의 플래그를 이번 프레임 상태로 갱신 (기존 액터 순회의 가시성 조건과 동일)
+	 * @return 갱신 전 플래그
+	 */
+	template<typename TProxy>
+	uint8 RefreshFlags(TProxy& Proxy)
+	{
+		const uint8 PreviousFlags = Proxy.Flags;
+
+		uint8 Flags = 0;
+		if (Proxy.Owner->IsActorVisible() && Proxy.Owner->IsActorActive() && Proxy.Component->IsVisible())
+		{
+			Flags |= FSceneProxyFlags::Visible;
+		}
+		if (Proxy.Component->IsEditable())
+		{
+			Flags |= FSceneProxyFlags::Editable;
+		}
+		Flags |= GetCastShadowFlag(Proxy.Component);
+
+		Proxy.Flags = Flags;
+		return PreviousFlags;
+	}
+
+	// 메시 레코드만 바운드를 함께 전달
+	template<typename T>
+	void AddBounds(const TSceneMeshProxy<T>& Proxy, TArray<FAABB>* OutBounds)
+	{
+		if (OutBounds)
+		{
+			OutBounds->Add(Proxy.Bounds);
+		}
+	}
+
+	template<typename T>
+	void AddBounds(const TSceneProxy<T>& Proxy, TArray<FAABB>* OutBounds)
+	{
+	}
+
+	template<typename TProxy>
+	void RefreshAllFlags(TArray<TProxy>& InProxies)
+	{
+		for (TProxy& Proxy : InProxies)
+		{
+			RefreshFlags(Proxy);
+		}
+	}
+
+	/**
+	 * @brief 레벨 프리미티브 배열을 훑어 보이는 것만 목록에 추가
+	 * @details 에디터 보조 컴포넌트(!Editable)는 타입과 무관하게 EditorPrimitives로 보낸다.
+	 * 에디터 보조가 추가된 뒤 SetEditability(false)가 호출되므로 분류 시점이 아닌 프레임마다 확인한다.
+	 * @param OutList nullptr이면 일반 컴포넌트는 버림 (ShowFlag 꺼짐 또는 그릴 목록 없음)
+	 * @param OutBounds OutList와 같은 인덱스로 레코드의 바운드를 추가할 배열 (메시 레코드만)
+	 */
+	template<typename TProxy, typename TList>
+	void GatherPrimitives(const TArray<TProxy>& InProxies, TList* OutList, TArray<UPrimitiveComponent*>* OutEditorPrimitives,
+		TArray<FAABB>* OutBounds = nullptr)
+	{
+		// 배열 전체가 어느 목록에도 들어가지 않으면 건너뜀
+		if (!OutList && !OutEditorPrimitives)
+		{
+			return;
+		}
+
+		for (const TProxy& Proxy : InProxies)
+		{
+			if (!(Proxy.Flags & FSceneProxyFlags::Visible))
+			{
+				continue;
+			}
+
+			if (!(Proxy.Flags & FSceneProxyFlags::Editable))
+			{
+				if (OutEditorPrimitives)
+				{
+					OutEditorPrimitives->Add(Proxy.Component);
+				}
+			}
+			else if (OutList)
+			{
+				OutList->Add(Proxy.Component);
+				AddBounds(Proxy, OutBounds);
+			}
+		}
+	}
+
+	// 라이트/전역 효과 배열을 훑어 보이는 것만 목록에 추가하고, 그림자를 드리우는 라이트 수를 반환
+	template<typename T>
+	uint32 GatherLights(const TArray<TSceneProxy<T>>& InProxies, TArray<T*>& OutList)
+	{
+		uint32 NumShadowCasters = 0;
+		for (const TSceneProxy<T>& Proxy : InProxies)
+		{
+			if (!(Proxy.Flags & FSceneProxyFlags::Visible))
+			{
+				continue;
+			}
+
+			OutList.Add(Proxy.Component);
+			if (Proxy.Flags & FSceneProxyFlags::CastShadow)
+			{
+				++NumShadowCasters;
+			}
+		}
+		return NumShadowCasters;
+	}
+}
+
+FScene::FScene(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+void FScene::GatherProxies(FWorldSceneProxies& OutSceneProxies)
+{
+	if (SyncedRevision != UWorld::GetSceneStructureRevision())
+	{
+		SyncStructure();
+	}
+
+	// 레코드 플래그를 이번 프레임 상태로 갱신한 뒤, 아래 수집은 레코드만 읽음
+	UpdateMeshBounds();
+	RefreshAllFlags(Billboards);
+	RefreshAllFlags(Decals);
+	RefreshAllFlags(Lines);
+	RefreshAllFlags(Particles);
+	RefreshAllFlags(OtherPrimitives);
+	RefreshAllFlags(EditorGizmos);
+	RefreshAllFlags(EditorLines);
+	RefreshAllFlags(DirectionalLights);
+	RefreshAllFlags(AmbientLights);
+	RefreshAllFlags(PointLights);
+	RefreshAllFlags(SpotLights);
+	RefreshAllFlags(Fogs);
+
+	FVisibleRenderProxySet& Proxies = OutSceneProxies.Proxies;
+	FSceneLocals& SceneLocals = OutSceneProxies.SceneLocals;
+	FSceneGlobals& SceneGlobals = OutSceneProxies.SceneGlobals;
+
+	const URenderSettings& RenderSettings = World->GetRenderSettings();
+	const bool bDrawStaticMeshes = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
+	const bool bDrawSkeletalMeshes = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
+	const bool bDrawDecals = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
+	const bool bDrawFog = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
+	const bool bDrawLight = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Lighting);
+	const bool bUseBillboard = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
+	const bool bUseIcon = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_EditorIcon);
+	const bool bDrawParticles = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Particles);
+
+	// --- 에디터 액터 (기즈모 → 오버레이, 그리드 → 에디터 라인) ---
+	for (const TSceneProxy<UGizmoArrowComponent>& Proxy : EditorGizmos)
+	{
+		if (Proxy.Flags & FSceneProxyFlags::Visible)
+		{
+			Proxies.OverlayPrimitives.Add(Proxy.Component);
+		}
+	}
+	for (const TSceneProxy<ULineComponent>& Proxy : EditorLines)
+	{
+		if (Proxy.Flags & FSceneProxyFlags::Visible)
+		{
+			Proxies.EditorLines.Add(Proxy.Component);
+		}
+	}
+
+	// --- 레벨 프리미티브 ---
+	TArray<UPrimitiveComponent*>* EditorPrimitives = bUseIcon ? &Proxies.EditorPrimitives : nullptr;
+	GatherPrimitives(StaticMeshes, bDrawStaticMeshes ? &Proxies.Meshes : nullptr, EditorPrimitives, &Proxies.MeshBounds);
+	GatherPrimitives(SkinnedMeshes, bDrawSkeletalMeshes ? &Proxies.SkinnedMeshes : nullptr, EditorPrimitives, &Proxies.SkinnedMeshBounds);
+	GatherPrimitives(Billboards, bUseBillboard ? &Proxies.Billboards : nullptr, EditorPrimitives);
+	GatherPrimitives(Decals, bDrawDecals ? &Proxies.Decals : nullptr, EditorPrimitives);
+	GatherPrimitives(Lines, &Proxies.EditorLines, EditorPrimitives);
+	GatherPrimitives(Particles, bDrawParticles ? &Proxies.Particles : nullptr, EditorPrimitives);
+	GatherPrimitives(OtherPrimitives, static_cast<TArray<UPrimitiveComponent*>*>(nullptr), EditorPrimitives);
+
+	// --- 라이트/전역 효과 (그림자 드리우는 라이트 수도 같은 순회에서 셈) ---
+	if (bDrawFog)
+	{
+		for (const TSceneProxy<UHeightFogComponent>& Proxy : Fogs)
+		{
+			if (Proxy.Flags & FSceneProxyFlags::Visible)
+			{
+				SceneGlobals.Fogs.Add(Proxy.Component);
+			}
+		}
+	}
+	if (bDrawLight)
+	{
+		OutSceneProxies.NumShadowCastingDirectionalLights = GatherLights(DirectionalLights, SceneGlobals.DirectionalLights);
+		GatherLights(AmbientLights, SceneGlobals.AmbientLights);
+		OutSceneProxies.NumShadowCastingPointLights = GatherLights(PointLights, SceneLocals.PointLights);
+		OutSceneProxies.NumShadowCastingSpotLights = GatherLights(SpotLights, SceneLocals.SpotLights);
+	}
+}
+
+void FScene::UpdateMeshBounds()
+{
+	NumBoundsUpdated = 0;
+	bool bUpdateAll = false;
+
+	auto UpdateBounds = [this](auto& Proxy)
+	{
+		Proxy.Bounds = Proxy.Component->GetWorldAABB();
+		++NumBoundsUpdated;
+	};
+
+	// 변경 기록을 가져올 수 없으면 (파티션 없음, 기록이 잘림) 전부 다시 계산
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	ChangedComponents.Empty();
+	if (!Partition || !Partition->GetVisibilityChangesSince(BoundsRevision, ChangedComponents))
+	{
+		bUpdateAll = true;
+	}
+
+	// 플래그 갱신과 함께, 에디터 보조 여부가 바뀐 레코드는 바운드를 다시 계산 (보조 컴포넌트는 변경 기록에 남지 않음)
+	for (TSceneMeshProxy<UMeshComponent>& Proxy : StaticMeshes)
+	{
+		const uint8 PreviousFlags = RefreshFlags(Proxy);
+		if (bUpdateAll || ((PreviousFlags ^ Proxy.Flags) & FSceneProxyFlags::Editable))
+		{
+			UpdateBounds(Proxy);
+		}
+	}
+	for (TSceneMeshProxy<USkinnedMeshComponent>& Proxy : SkinnedMeshes)
+	{
+		const uint8 PreviousFlags = RefreshFlags(Proxy);
+		if (bUpdateAll || ((PreviousFlags ^ Proxy.Flags) & FSceneProxyFlags::Editable))
+		{
+			UpdateBounds(Proxy);
+		}
+	}
+
+	// 이동/메시 교체된 컴포넌트만 (기록에 중복이 있을 수 있음)
+	if (!bUpdateAll)
+	{
+		for (UPrimitiveComponent* Component : ChangedComponents)
+		{
+			const int32* RecordIndex = MeshRecordIndices.Find(Component);
+			if (!RecordIndex)
+			{
+				continue;
+			}
+			if (*RecordIndex >= 0)
+			{
+				UpdateBounds(StaticMeshes[*RecordIndex]);
+			}
+			else
+			{
+				UpdateBounds(SkinnedMeshes[-*RecordIndex - 1]);
+			}
+		}
+	}
+
+	BoundsRevision = Partition ? Partition->GetVisibilityRevision() : 0;
+}
+
+int32 FScene::GetNumProxies() const
+{
+	return StaticMeshes.Num() + SkinnedMeshes.Num() + Billboards.Num() + Decals.Num() + Lines.Num()
+		+ Particles.Num() + OtherPrimitives.Num() + EditorGizmos.Num() + EditorLines.Num()
+		+ DirectionalLights.Num() + AmbientLights.Num() + PointLights.Num() + SpotLights.Num() + Fogs.Num();
+}
+
+void FScene::SyncStructure()
+{
+	// 배열 용량은 유지한 채 다시 채움
+	Empty();
+
+	// 에디터 액터 (Gizmo, Grid 등)
+	for (AActor* EditorActor : World->GetEditorActors())
+	{
+		if (!EditorActor)
+		{
+			continue;
+		}
+		for (USceneComponent* Component : EditorActor->GetSceneComponents())
+		{
+			AddComponent(Component, EditorActor, true);
+		}
+	}
+
+	// 레벨 액터
+	for (AActor* Actor : World->GetActors())
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+		for (USceneComponent* Component : Actor->GetSceneComponents())
+		{
+			AddComponent(Component, Actor, false);
+		}
+	}
+
+	SyncedRevision = UWorld::GetSceneStructureRevision();
+	++NumSyncs;
+}
+
+void FScene::AddComponent(USceneComponent* Component, AActor* Owner, bool bIsEditorActor)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	// 에디터 액터는 기즈모 화살표와 그리드 라인만 그림
+	if (bIsEditorActor)
+	{
+		if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
+		{
+			EditorGizmos.Add({ GizmoComponent, Owner });
+		}
+		else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
+		{
+			EditorLines.Add({ LineComponent, Owner });
+		}
+		return;
+	}
+
+	if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+	{
+		if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
+		{
+			if (MeshComponent->IsA(UStaticMeshComponent::StaticClass()))
+			{
+				// 바운드와 플래그를 분류할 때 채워, 다음 갱신에서 에디터 보조 여부 변경을 알아챌 수 있게 함
+				TSceneMeshProxy<UMeshComponent>& Proxy = StaticMeshes.emplace_back();
+				Proxy.Component = MeshComponent;
+				Proxy.Owner = Owner;
+				Proxy.Bounds = MeshComponent->GetWorldAABB();
+				RefreshFlags(Proxy);
+				MeshRecordIndices.Add(MeshComponent, StaticMeshes.Num() - 1);
+			}
+			else if (USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(MeshComponent))
+			{
+				TSceneMeshProxy<USkinnedMeshComponent>& Proxy = SkinnedMeshes.emplace_back();
+				Proxy.Component = SkinnedMeshComponent;
+				Proxy.Owner = Owner;
+				Proxy.Bounds = SkinnedMeshComponent->GetWorldAABB();
+				RefreshFlags(Proxy);
+				MeshRecordIndices.Add(SkinnedMeshComponent, -SkinnedMeshes.Num());
+			}
+			else
+			{
+				OtherPrimitives.Add({ PrimitiveComponent, Owner });
+			}
+		}
+		else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent))
+		{
+			Billboards.Add({ BillboardComponent, Owner });
+		}
+		else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent))
+		{
+			Decals.Add({ DecalComponent, Owner });
+		}
+		else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
+		{
+			Lines.Add({ LineComponent, Owner });
+		}
+		else if (UParticleSystemComponent* ParticleComponent = Cast<UParticleSystemComponent>(PrimitiveComponent))
+		{
+			Particles.Add({ ParticleComponent, Owner });
+		}
+		else
+		{
+			OtherPrimitives.Add({ PrimitiveComponent, Owner });
+		}
+		return;
+	}
+
+	if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component))
+	{
+		Fogs.Add({ FogComponent, Owner });
+	}
+	else if (UDirectionalLightComponent* DirectionalLight = Cast<UDirectionalLightComponent>(Component))
+	{
+		DirectionalLights.Add({ DirectionalLight, Owner });
+	}
+	else if (UAmbientLightComponent* AmbientLight = Cast<UAmbientLightComponent>(Component))
+	{
+		AmbientLights.Add({ AmbientLight, Owner });
+	}
+	else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(Component))
+	{
+		SpotLights.Add({ SpotLight, Owner });
+	}
+	else if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Component))
+	{
+		PointLights.Add({ PointLight, Owner });
+	}
+}
+
+void FScene::Empty()
+{
+	MeshRecordIndices.Empty();
+	StaticMeshes.Empty();
+	SkinnedMeshes.Empty();
+	Billboards.Empty();
+	Decals.Empty();
+	Lines.Empty();
+	Particles.Empty();
+	OtherPrimitives.Empty();
+	EditorGizmos.Empty();
+	EditorLines.Empty();
+	DirectionalLights.Empty();
+	AmbientLights.Empty();
+	PointLights.Empty();
+	SpotLights.Empty();
+	Fogs.Empty();
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "SceneProxyCollector.h"
+#include "AABB.h"
+
+class AActor;
+class USceneComponent;
+class UGizmoArrowComponent;
+
+// FScene 레코드의 상태 플래그 (GatherProxies가 프레임마다 한 번 갱신)
+struct FSceneProxyFlags
+{
+	static constexpr uint8 Visible = 1 << 0;		// 액터(보임 + 활성)와 컴포넌트가 모두 보임
+	static constexpr uint8 Editable = 1 << 1;		// false면 에디터 보조 컴포넌트 (아이콘, 방향 기즈모)
+	static constexpr uint8 CastShadow = 1 << 2;		// 메시/라이트가 그림자를 드리움
+};
+
+/**
+ * @brief FScene에 등록된 컴포넌트 하나의 레코드
+ * @details 타입은 등록 시 한 번만 분류해 배열로 나누므로 매 프레임 Cast<>하지 않는다.
+ * 소유 액터를 함께 들고 있어 프레임마다 액터 가시성을 확인할 때 GetOwner()를 거치지 않는다.
+ */
+template<typename T>
+struct TSceneProxy
+{
+	T* Component = nullptr;
+	AActor* Owner = nullptr;
+	uint8 Flags = 0;	// FSceneProxyFlags
+};
+
+/**
+ * @brief 월드 바운드를 함께 보관하는 메시 레코드
+ * @details 바운드는 분류할 때 계산하고, 이후에는 파티션 매니저의 가시성 변경 기록(이동/메시 교체)에 있는
+ * 컴포넌트와 에디터 보조 여부가 바뀐 컴포넌트만 다시 계산한다 (에디터 보조 컴포넌트는 변경 기록에 남지 않음).
+ * 수집 결과의 MeshBounds/SkinnedMeshBounds로 전달되어 오클루전 컬링이 컴포넌트마다 GetWorldAABB를 호출하지 않는다.
+ */
+template<typename T>
+struct TSceneMeshProxy
+{
+	T* Component = nullptr;
+	AActor* Owner = nullptr;
+	uint8 Flags = 0;	// FSceneProxyFlags
+	FAABB Bounds;
+};
+
+/**
+ * @brief 월드 하나의 렌더 대상 컴포넌트를 타입별 연속 배열로 유지하는 리테인드 씬
+ * @details 기존에는 매 프레임 모든 액터 → 모든 씬 컴포넌트를 순회하며 컴포넌트마다 최대 8번 Cast<>로 분류했다.
+ * FScene은 액터/컴포넌트 구성이 바뀔 때(UWorld::GetSceneStructureRevision)만 다시 분류하고,
+ * 프레임마다 타입별 배열을 훑으며 가시성/에디터 여부/ShowFlag 같은 값싼 플래그만 확인한다.
+ *
+ * 컴포넌트 단위 등록 콜백 대신 리비전으로 동기화하는 이유:
+ * - CREATE_EDITOR_COMPONENT로 만든 에디터 보조 컴포넌트(아이콘, 방향 기즈모)는 RegisterComponent를 거치지 않음
+ * - 그리드/기즈모 같은 에디터 액터는 EditorActors에 추가되기 전에 컴포넌트가 등록됨
+ * - 레벨에 속하지 않은 액터(에디터 카메라 등)의 컴포넌트는 그리지 않아야 함
+ * 따라서 레벨/에디터 액터 목록을 기준으로 분류하되, 구성이 바뀌지 않은 프레임에는 순회를 생략한다.
+ *
+ * 레코드는 상태 플래그(FSceneProxyFlags)를, 메시 레코드는 월드 바운드도 함께 보관한다.
+ * 플래그는 수집 시작에 배열마다 한 번 갱신하고, 이후 분류/라이트 집계는 레코드만 읽는다.
+ *
+ * UWorld가 소유하며, 보관하는 포인터는 다음 Sync 전까지만 유효하다 (구성이 바뀌면 GatherProxies가 먼저 Sync한다).
+ */
+class FScene
+{
+public:
+	explicit FScene(UWorld* InWorld);
+
+	/**
+	 * @brief 이번 프레임에 그릴 프록시를 뷰와 무관한 목록으로 수집
+	 * @details 구성이 바뀌었으면 먼저 다시 분류한다. OutSceneProxies의 목록은 비워진 상태로 전달되어야 함
+	 */
+	void GatherProxies(FWorldSceneProxies& OutSceneProxies);
+
+	// 등록된 레코드 수 (통계/디버그용)
+	int32 GetNumProxies() const;
+
+	// 다시 분류한 횟수 (구성이 바뀌지 않으면 늘지 않음)
+	uint64 GetNumSyncs() const { return NumSyncs; }
+
+	// 지난 GatherProxies에서 바운드를 다시 계산한 메시 레코드 수 (통계/벤치마크용)
+	int32 GetNumBoundsUpdated() const { return NumBoundsUpdated; }
+
+	// 다음 GatherProxies가 다시 분류하도록 표시 (BENCH SCENEGATHER에서 분류 비용 측정용)
+	void InvalidateStructure() { SyncedRevision = 0; }
+
+private:
+	// 레벨/에디터 액터를 순회해 타입별 배열을 다시 채움
+	void SyncStructure();
+	void AddComponent(USceneComponent* Component, AActor* Owner, bool bIsEditorActor);
+	void Empty();
+
+	// 메시 레코드의 플래그를 갱신하고, 가시성 변경 기록으로 움직인 레코드의 바운드를 갱신 (기록이 잘렸으면 전부)
+	void UpdateMeshBounds();
+
+	UWorld* World = nullptr;
+	uint64 SyncedRevision = 0;
+	uint64 NumSyncs = 0;
+
+	// 바운드가 반영된 파티션 가시성 리비전 (UWorldPartitionManager::GetVisibilityRevision)
+	uint64 BoundsRevision = 0;
+	int32 NumBoundsUpdated = 0;
+
+	// 변경 기록의 컴포넌트 → 메시 레코드 위치 (Index >= 0: StaticMeshes, < 0: SkinnedMeshes[-Index - 1])
+	TMap<UPrimitiveComponent*, int32> MeshRecordIndices;
+	TArray<UPrimitiveComponent*> ChangedComponents;
+
+	// --- 레벨 액터의 프리미티브 (에디터 보조 여부는 프레임마다 확인) ---
+	TArray<TSceneMeshProxy<UMeshComponent>> StaticMeshes;
+	TArray<TSceneMeshProxy<USkinnedMeshComponent>> SkinnedMeshes;
+	TArray<TSceneProxy<UBillboardComponent>> Billboards;
+	TArray<TSceneProxy<UDecalComponent>> Decals;
+	TArray<TSceneProxy<ULineComponent>> Lines;
+	TArray<TSceneProxy<UParticleSystemComponent>> Particles;
+	TArray<TSceneProxy<UPrimitiveComponent>> OtherPrimitives;	// 에디터 보조일 때만 그려짐 (아이콘 등)
+
+	// --- 에디터 액터 (그리드, 기즈모) ---
+	TArray<TSceneProxy<UGizmoArrowComponent>> EditorGizmos;
+	TArray<TSceneProxy<ULineComponent>> EditorLines;
+
+	// --- 라이트/전역 효과 ---
+	TArray<TSceneProxy<UDirectionalLightComponent>> DirectionalLights;
+	TArray<TSceneProxy<UAmbientLightComponent>> AmbientLights;
+	TArray<TSceneProxy<UPointLightComponent>> PointLights;
+	TArray<TSceneProxy<USpotLightComponent>> SpotLights;
+	TArray<TSceneProxy<UHeightFogComponent>> Fogs;
+};
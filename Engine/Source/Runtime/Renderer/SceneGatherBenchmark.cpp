@@ -0,0 +1,167 @@
+#include "pch.h"
+#include "SceneGatherBenchmark.h"
+#include "Scene.h"
+#include "World.h"
+#include "Actor.h"
+#include "PlatformTime.h"
+#include "PrimitiveComponent.h"
+#include "StaticMeshComponent.h"
+#include "SkinnedMeshComponent.h"
+#include "BillboardComponent.h"
+#include "DecalComponent.h"
+#include "LineComponent.h"
+#include "ParticleSystemComponent.h"
+#include "HeightFogComponent.h"
+#include "DirectionalLightComponent.h"
+#include "AmbientLightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+
+namespace
+{
+	void ResetSceneProxies(FWorldSceneProxies& SceneProxies)
+	{
+		SceneProxies.Proxies.Empty();
+		SceneProxies.SceneLocals.Empty();
+		SceneProxies.SceneGlobals.Empty();
+		SceneProxies.NumShadowCastingDirectionalLights = 0;
+		SceneProxies.NumShadowCastingPointLights = 0;
+		SceneProxies.NumShadowCastingSpotLights = 0;
+	}
+
+	// 변경 전 방식: 매 프레임 모든 레벨 액터 → 모든 씬 컴포넌트를 Cast<>로 분류하고, 메시는 뷰마다 GetWorldAABB를 다시 계산
+	void GatherLegacy(UWorld* World, FWorldSceneProxies& OutSceneProxies)
+	{
+		FVisibleRenderProxySet& Proxies = OutSceneProxies.Proxies;
+		for (AActor* Actor : World->GetActors())
+		{
+			if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
+			{
+				continue;
+			}
+
+			for (USceneComponent* Component : Actor->GetSceneComponents())
+			{
+				if (!Component || !Component->IsVisible())
+				{
+					continue;
+				}
+
+				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+				{
+					if (!PrimitiveComponent->IsEditable())
+					{
+						Proxies.EditorPrimitives.Add(PrimitiveComponent);
+					}
+					else if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
+					{
+						if (USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(MeshComponent))
+						{
+							Proxies.SkinnedMeshes.Add(SkinnedMeshComponent);
+							Proxies.SkinnedMeshBounds.Add(SkinnedMeshComponent->GetWorldAABB());
+						}
+						else
+						{
+							Proxies.Meshes.Add(MeshComponent);
+							Proxies.MeshBounds.Add(MeshComponent->GetWorldAABB());
+						}
+					}
+					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent))
+					{
+						Proxies.Billboards.Add(BillboardComponent);
+					}
+					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent))
+					{
+						Proxies.Decals.Add(DecalComponent);
+					}
+					else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
+					{
+						Proxies.EditorLines.Add(LineComponent);
+					}
+					else if (UParticleSystemComponent* ParticleComponent = Cast<UParticleSystemComponent>(PrimitiveComponent))
+					{
+						Proxies.Particles.Add(ParticleComponent);
+					}
+				}
+				else if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component))
+				{
+					OutSceneProxies.SceneGlobals.Fogs.Add(FogComponent);
+				}
+				else if (UDirectionalLightComponent* DirectionalLight = Cast<UDirectionalLightComponent>(Component))
+				{
+					OutSceneProxies.SceneGlobals.DirectionalLights.Add(DirectionalLight);
+				}
+				else if (UAmbientLightComponent* AmbientLight = Cast<UAmbientLightComponent>(Component))
+				{
+					OutSceneProxies.SceneGlobals.AmbientLights.Add(AmbientLight);
+				}
+				else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(Component))
+				{
+					OutSceneProxies.SceneLocals.SpotLights.Add(SpotLight);
+				}
+				else if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(Component))
+				{
+					OutSceneProxies.SceneLocals.PointLights.Add(PointLight);
+				}
+			}
+		}
+	}
+}
+
+void FSceneGatherBenchmark::Run(UWorld* World, int32 NumIterations)
+{
+	FScene* Scene = World ? World->GetScene() : nullptr;
+	if (!Scene || NumIterations <= 0)
+	{
+		UE_LOG("[Bench] SceneGather: no world scene");
+		return;
+	}
+
+	FWorldSceneProxies SceneProxies;
+
+	// 배열 용량 확보 + 구성 동기화
+	ResetSceneProxies(SceneProxies);
+	Scene->GatherProxies(SceneProxies);
+
+	// 1. 변경 전 방식
+	double LegacyMs = 0.0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		ResetSceneProxies(SceneProxies);
+		FScopeCycleCounter Counter;
+		GatherLegacy(World, SceneProxies);
+		LegacyMs += Counter.Finish();
+	}
+	const int32 NumLegacyMeshes = SceneProxies.Proxies.Meshes.Num() + SceneProxies.Proxies.SkinnedMeshes.Num();
+
+	// 2. 매번 다시 분류 (액터/컴포넌트가 추가·삭제된 프레임)
+	double ResyncMs = 0.0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		ResetSceneProxies(SceneProxies);
+		Scene->InvalidateStructure();
+		FScopeCycleCounter Counter;
+		Scene->GatherProxies(SceneProxies);
+		ResyncMs += Counter.Finish();
+	}
+
+	// 3. 구성 변경 없음 (평소 프레임: 플래그 갱신 + 움직인 메시 바운드만 갱신)
+	double SteadyMs = 0.0;
+	int32 NumBoundsUpdated = 0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		ResetSceneProxies(SceneProxies);
+		FScopeCycleCounter Counter;
+		Scene->GatherProxies(SceneProxies);
+		SteadyMs += Counter.Finish();
+		NumBoundsUpdated = Scene->GetNumBoundsUpdated();
+	}
+	const int32 NumMeshes = SceneProxies.Proxies.Meshes.Num() + SceneProxies.Proxies.SkinnedMeshes.Num();
+
+	UE_LOG("[Bench] SceneGather: %d actors, %d records, %d iterations",
+		World->GetActors().Num(), Scene->GetNumProxies(), NumIterations);
+	UE_LOG("[Bench]   Legacy actor walk: %.4f ms/gather (%d meshes)", LegacyMs / NumIterations, NumLegacyMeshes);
+	UE_LOG("[Bench]   FScene resync    : %.4f ms/gather", ResyncMs / NumIterations);
+	UE_LOG("[Bench]   FScene steady    : %.4f ms/gather (%d meshes, %d bounds updated), speedup vs legacy: x%.2f",
+		SteadyMs / NumIterations, NumMeshes, NumBoundsUpdated, SteadyMs > 0.0 ? LegacyMs / SteadyMs : 0.0);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+class UWorld;
+
+/**
+ * @brief FScene 프록시 수집 비용 측정용 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details 현재 월드를 그대로 사용하며, 월드 상태는 바꾸지 않는다 (분류 무효화는 다음 수집에서 다시 채워짐).
+ */
+class FSceneGatherBenchmark
+{
+public:
+	// 변경 전 방식(액터 → 컴포넌트 순회 + Cast 분류 + 메시 GetWorldAABB) vs 재분류 포함 수집 vs 구성 변경 없는 수집
+	static void Run(UWorld* World, int32 NumIterations);
+};
@@ -0,0 +1,52 @@
+#include "pch.h"
+#include "SceneProxyCollector.h"
+#include "Scene.h"
+#include "World.h"
+#include "RenderSettings.h"
+
+void FSceneProxyCollector::BeginFrame()
+{
+	++FrameNumber;
+
+	// 지난 프레임에 그려지지 않은 월드(닫힌 프리뷰 창, 끝난 PIE 등)의 항목 제거
+	for (auto It = WorldSceneProxies.begin(); It != WorldSceneProxies.end();)
+	{
+		if (It->second.FrameNumber + 1 < FrameNumber)
+		{
+			It = WorldSceneProxies.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+}
+
+const FWorldSceneProxies& FSceneProxyCollector::GetSceneProxies(UWorld* World)
+{
+	FWorldSceneProxies& SceneProxies = WorldSceneProxies[World];
+
+	const uint64 StructureRevision = UWorld::GetSceneStructureRevision();
+	const EEngineShowFlags ShowFlags = World->GetRenderSettings().GetShowFlags();
+
+	if (SceneProxies.FrameNumber == FrameNumber
+		&& SceneProxies.StructureRevision == StructureRevision
+		&& SceneProxies.ShowFlags == ShowFlags)
+	{
+		return SceneProxies;
+	}
+
+	// 배열 용량은 유지한 채 다시 수집 (매 프레임 재할당 방지)
+	SceneProxies.Proxies.Empty();
+	SceneProxies.SceneLocals.Empty();
+	SceneProxies.SceneGlobals.Empty();
+	SceneProxies.NumShadowCastingDirectionalLights = 0;
+	SceneProxies.NumShadowCastingPointLights = 0;
+	SceneProxies.NumShadowCastingSpotLights = 0;
+	World->GetScene()->GatherProxies(SceneProxies);
+
+	SceneProxies.FrameNumber = FrameNumber;
+	SceneProxies.StructureRevision = StructureRevision;
+	SceneProxies.ShowFlags = ShowFlags;
+	return SceneProxies;
+}
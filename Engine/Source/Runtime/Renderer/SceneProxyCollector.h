@@ -0,0 +1,139 @@
+#pragma once
+#include "Enums.h" // EEngineShowFlags
+#include "AABB.h"
+
+class UWorld;
+class UPrimitiveComponent;
+class UDecalComponent;
+class UHeightFogComponent;
+class UAmbientLightComponent;
+class UDirectionalLightComponent;
+class UPointLightComponent;
+class USpotLightComponent;
+class UMeshComponent;
+class USkinnedMeshComponent;
+class UBillboardComponent;
+class UTextRenderComponent;
+class UParticleSystemComponent;
+class ULineComponent;
+
+// 렌더링할 대상들의 집합을 담는 구조체
+struct FVisibleRenderProxySet
+{
+	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
+	TArray<UMeshComponent*> Meshes;
+	TArray<USkinnedMeshComponent*> SkinnedMeshes;
+	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
+	TArray<UDecalComponent*> Decals;
+	TArray<UTextRenderComponent*> Texts;
+
+	// Meshes/SkinnedMeshes와 같은 인덱스의 월드 바운드 (FScene 레코드에서 복사, 오클루전 컬링용)
+	TArray<FAABB> MeshBounds;
+	TArray<FAABB> SkinnedMeshBounds;
+
+	// --- Type 2: In-Scene Editor (PP X, Depth-Test O) ---
+	TArray<ULineComponent*> EditorLines;	// 그리드
+	TArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
+
+	// --- Type 3: Overlay (PP X, Depth-Test X) ---
+	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
+
+	TArray<UParticleSystemComponent*> Particles;
+
+	void Empty()
+	{
+		Meshes.Empty();
+		SkinnedMeshes.Empty();
+		Billboards.Empty();
+		Decals.Empty();
+		Texts.Empty();
+		MeshBounds.Empty();
+		SkinnedMeshBounds.Empty();
+		EditorLines.Empty();
+		EditorPrimitives.Empty();
+		OverlayPrimitives.Empty();
+		Particles.Empty();
+	}
+};
+
+struct FSceneLocals
+{
+	TArray<UPointLightComponent*> PointLights;
+	TArray<USpotLightComponent*> SpotLights;
+
+	void Empty()
+	{
+		PointLights.Empty();
+		SpotLights.Empty();
+	}
+};
+
+// NOTE: 추후 UWorld로 이동해서 등록/해지 방식으로 변경?
+// 전역 효과 및 설정을 담는 구조체
+struct FSceneGlobals
+{
+	TArray<UDirectionalLightComponent*> DirectionalLights;
+	TArray<UAmbientLightComponent*> AmbientLights;
+	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
+
+	void Empty()
+	{
+		DirectionalLights.Empty();
+		AmbientLights.Empty();
+		Fogs.Empty();
+	}
+};
+
+/**
+ * @brief 월드 하나를 순회해 분류한 렌더 프록시 목록 (뷰와 무관한 부분)
+ * @details 컬링/정렬/배치 생성처럼 뷰에 의존하는 처리는 이 목록을 복사한 뒤 FSceneRenderer가 뷰마다 수행한다.
+ */
+struct FWorldSceneProxies
+{
+	FVisibleRenderProxySet Proxies;
+	FSceneLocals SceneLocals;
+	FSceneGlobals SceneGlobals;
+
+	// 그림자를 드리우는 라이트 수 (수집하면서 함께 셈, 라이트 통계용)
+	uint32 NumShadowCastingDirectionalLights = 0;
+	uint32 NumShadowCastingPointLights = 0;
+	uint32 NumShadowCastingSpotLights = 0;
+
+	// --- 캐시 키 (모두 같을 때만 재사용) ---
+	uint64 FrameNumber = 0;
+	uint64 StructureRevision = 0;	// UWorld::GetSceneStructureRevision
+	EEngineShowFlags ShowFlags = EEngineShowFlags::None;
+};
+
+/**
+ * @brief 월드 단위 렌더 프록시 수집기
+ * @details 에디터는 한 프레임에 뷰포트 여러 개(4분할 + 스켈레탈/파티클/피직스 에셋 프리뷰)를 그린다.
+ * 월드의 FScene(타입별 리테인드 배열)에서 보이는 프록시를 고르는 일은 뷰와 무관하므로 월드마다 프레임당 한 번만 수행하고,
+ * 같은 프레임에 같은 월드를 그리는 나머지 뷰는 그 결과를 공유한다.
+ *
+ * 무효화 조건:
+ * - 프레임이 바뀜 (URenderer::BeginFrame)
+ * - 액터/컴포넌트 추가·삭제 (UI에서 뷰포트 사이에 삭제되어도 해제된 포인터를 넘기지 않도록)
+ * - 월드 ShowFlags 변경 (뷰포트 툴바에서 뷰포트 사이에 바뀔 수 있음)
+ * 컴포넌트 가시성 토글은 포인터 수명과 무관하므로 키에 넣지 않는다 (다음 프레임에 반영).
+ *
+ * URenderer가 소유하며, 키로 쓰는 UWorld 포인터는 비교용으로만 사용하고 역참조하지 않는다.
+ */
+class FSceneProxyCollector
+{
+public:
+	// 프레임 번호를 올리고, 지난 프레임에 그려지지 않은 월드의 항목을 정리
+	void BeginFrame();
+
+	/**
+	 * @brief 이번 프레임의 월드 프록시 목록을 반환 (없거나 무효하면 새로 수집)
+	 * @return 다음 BeginFrame 또는 같은 월드에 대한 다음 호출 전까지 유효한 참조
+	 */
+	const FWorldSceneProxies& GetSceneProxies(UWorld* World);
+
+	uint64 GetFrameNumber() const { return FrameNumber; }
+
+private:
+	TMap<UWorld*, FWorldSceneProxies> WorldSceneProxies;
+	uint64 FrameNumber = 1;
+};
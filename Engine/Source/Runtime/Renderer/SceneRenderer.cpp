@@ -22,6 +22,7 @@
 #include "BVHierarchy.h"
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
+#include "StaticMesh.h"
 #include "DecalStatManager.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
@@ -37,16 +38,25 @@
 #include "SpotLightComponent.h"
 #include "SwapGuard.h"
 #include "MeshBatchElement.h"
+#include "MeshDrawCommandRecorder.h"
+#include "D3D11RHICommandContext.h"
+#include "RHICommandListBenchmark.h"
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
 #include "../RHI/ConstantBufferType.h"
 #include <chrono>
 #include "TileLightCuller.h"
+#include "DecalRenderResources.h"
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
 #include "ParticleStats.h"
+#include "OcclusionStats.h"
+#include "DrawSortStats.h"
+#include "MeshDrawSort.h"
+#include "MeshLODStats.h"
+#include "SceneViewState.h"
 #include "PlatformTime.h"
 #include "PostProcessing/VignettePass.h"
 #include "FbxLoader.h"
@@ -56,6 +66,7 @@
 #include "DynamicEmitterDataBase.h"
 #include "DynamicEmitterReplayDataBase.h"
 #include "ParticleEmitterInstance.h"
+#include "ParticleVertexGenerator.h"
 #include "VertexData.h"
 #include "SkySphereActor.h"
 #include "SkySphereComponent.h"
@@ -109,6 +120,9 @@ void FSceneRenderer::Render()
 	RenderShadowMaps();
 	TIME_PROFILE_END(ShadowMapPass)
 
+	// 화면에서 가려진 메시도 그림자는 드리울 수 있으므로 섀도우 패스 이후에 오클루전 컬링
+	PerformOcclusionCulling();
+
 	// ViewMode에 따라 렌더링 경로 결정
 	if (View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Phong ||
 		View->RenderSettings->GetViewMode() == EViewMode::VMI_Lit_Gouraud ||
@@ -257,9 +271,9 @@ void FSceneRenderer::RenderLitPath()
 
 	// Base Pass
 	RenderOpaquePass(View->RenderSettings->GetViewMode());
+	RenderDecalPass();	// 씬 깊이로 불투명 표면에만 적용 (그리드/파티클보다 먼저)
 	RenderGridLinesPass();
 	RenderParticlesPass();
-	RenderDecalPass();
 }
 
 void FSceneRenderer::RenderSkyPass()
@@ -375,36 +389,92 @@ void FSceneRenderer::RenderShadowMaps()
 
 	GPU_EVENT_TIMER(RHIDevice->GetDeviceContext(), "ShadowMaps", OwnerRenderer->GetGPUTimer());
 
-	// 2. 그림자 캐스터(Caster) 메시 수집
+	// 지난 호출 이후 움직인 캐스터를 가져와 캐시된 그림자 뎁스의 유효성 판단에 사용
+	FShadowDepthCache& ShadowCache = LightManager->GetShadowDepthCache();
+	ShadowCache.BeginFrame(World->GetPartitionManager());
+
+	// 2. 그림자 캐스터(Caster) 메시 수집 (요청별 컬링을 위해 캐스터마다 배치 범위와 바운드를 함께 기록)
 	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TArray<FShadowCaster> ShadowCasters;
+	auto AddShadowCaster = [&](UPrimitiveComponent* Component, uint32 FirstBatch, int32 LODIndex, bool bHasBounds, bool bDynamic)
+	{
+		const uint32 NumBatches = static_cast<uint32>(ShadowMeshBatches.Num()) - FirstBatch;
+		if (NumBatches == 0)
+		{
+			return;
+		}
+
+		FShadowCaster Caster;
+		Caster.Component = Component;
+		Caster.FirstBatch = FirstBatch;
+		Caster.NumBatches = NumBatches;
+		Caster.LODIndex = LODIndex;
+		Caster.bHasBounds = bHasBounds;
+		Caster.bDynamic = bDynamic;
+		if (bHasBounds)
+		{
+			Caster.Bounds = Component->GetWorldAABB();
+			Caster.bInBVH = ShadowCache.IsTrackedByBVH(Component);
+		}
+		ShadowCasters.Add(Caster);
+	};
+
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
+			const uint32 FirstBatch = static_cast<uint32>(ShadowMeshBatches.Num());
 			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			AddShadowCaster(MeshComponent, FirstBatch, MeshComponent->GetLastLODSelection().LODIndex, true, false);
 		}
 	}
 	for (UMeshComponent* MeshComponent : Proxies.SkinnedMeshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
+			// 애니메이션으로 위치가 그대로여도 모양이 바뀌므로 캐시하지 않음
+			const uint32 FirstBatch = static_cast<uint32>(ShadowMeshBatches.Num());
 			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			AddShadowCaster(MeshComponent, FirstBatch, MeshComponent->GetLastLODSelection().LODIndex, true, true);
 		}
 	}
 
-	// 파티클 메시 배치 수집
+	// 파티클 메시 에미터의 인스턴스를 한 번에 병렬 생성 (뷰와 무관하므로 파티클 패스에서 재사용)
+	FParticleVertexGenerator* ParticleVertexGenerator = OwnerRenderer->GetParticleVertexGenerator();
+	ParticleVertexGenerator->Reset();
 	for (UParticleSystemComponent* ParticleComponent : Proxies.Particles)
 	{
 		if (!ParticleComponent || !ParticleComponent->IsVisible())
 			continue;
 
-		// 파티클 동적 데이터 업데이트
-		ParticleComponent->UpdateDynamicData();
+		// 파티클 동적 데이터 업데이트 (프레임당 한 번만 수집, 이후 패스는 재사용)
+		ParticleComponent->UpdateDynamicData(OwnerRenderer->GetSceneProxyCollector()->GetFrameNumber());
 		FParticleDynamicData* DynamicData = ParticleComponent->GetCurrentDynamicData();
 
 		if (!DynamicData)
 			continue;
 
+		for (FDynamicEmitterDataBase* EmitterData : DynamicData->DynamicEmitterDataArray)
+		{
+			if (EmitterData && EmitterData->GetSource().eEmitterType == EDynamicEmitterType::Mesh)
+			{
+				ParticleVertexGenerator->AddEmitter(EmitterData);
+			}
+		}
+	}
+	ParticleVertexGenerator->Generate(View);
+
+	// 파티클 메시 배치 수집
+	for (UParticleSystemComponent* ParticleComponent : Proxies.Particles)
+	{
+		if (!ParticleComponent || !ParticleComponent->IsVisible())
+			continue;
+
+		FParticleDynamicData* DynamicData = ParticleComponent->GetCurrentDynamicData();
+		if (!DynamicData)
+			continue;
+
+		const uint32 FirstBatch = static_cast<uint32>(ShadowMeshBatches.Num());
 		for (FDynamicEmitterDataBase* EmitterData : DynamicData->DynamicEmitterDataArray)
 		{
 			if (!EmitterData || EmitterData->GetSource().eEmitterType != EDynamicEmitterType::Mesh)
@@ -413,6 +483,8 @@ void FSceneRenderer::RenderShadowMaps()
 			// 메시 배치 수집
 			EmitterData->GetDynamicMeshElementsEmitter(ShadowMeshBatches, View);
 		}
+		// 파티클은 바운드가 없으므로 컬링하지 않고 매 프레임 다시 그림
+		AddShadowCaster(ParticleComponent, FirstBatch, -1, false, true);
 	}
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
@@ -490,10 +562,46 @@ void FSceneRenderer::RenderShadowMaps()
 		return;
 	}
 
-	// 2D 아틀라스 할당
-	LightManager->AllocateAtlasRegions2D(Requests2D);
+	// 2D 아틀라스 할당 (이 뷰에서의 화면 점유율로 라이트별 해상도 결정)
+	LightManager->AllocateAtlasRegions2D(Requests2D, View);
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
-	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
+	LightManager->AllocateAtlasCubeSlices(RequestsCube, View); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
+	FShadowStatManager::GetInstance().SetAtlasUsage(LightManager->GetShadowAtlasUsage());
+
+	// 요청별 캐스터 컬링 (할당 뒤에 해야 캐시 키에 아틀라스 위치가 들어감)
+	const uint32 ShadowAAMode = static_cast<uint32>(World->GetRenderSettings().GetShadowAATechnique());
+	auto CullShadowRequest = [&](const FShadowRenderRequest& Request, TArray<uint32>& OutCasterIndices, FShadowViewKey& OutKey)
+	{
+		// 점/스팟 라이트는 BVH 구 쿼리로 범위 밖 캐스터를 먼저 거르고, 방향광은 캐스케이드 절두체만 검사
+		const bool bDirectional = Cast<UDirectionalLightComponent>(Request.LightOwner) != nullptr;
+		const TSet<UPrimitiveComponent*>* InRangeCasters = bDirectional ? nullptr : ShadowCache.QueryCastersInRange(Request);
+		ShadowCache.CullCasters(Request, bDirectional, ShadowCasters, InRangeCasters, OutCasterIndices, OutKey);
+		OutKey.AAMode = ShadowAAMode;
+	};
+	auto CountCasterBatches = [&](const TArray<uint32>& CasterIndices)
+	{
+		uint32 NumBatches = 0;
+		for (uint32 CasterIndex : CasterIndices)
+		{
+			NumBatches += ShadowCasters[CasterIndex].NumBatches;
+		}
+		return NumBatches;
+	};
+	TArray<FMeshBatchElement> CulledShadowBatches;
+	auto GatherCulledBatches = [&](const TArray<uint32>& CasterIndices)
+	{
+		CulledShadowBatches.Empty();
+		for (uint32 CasterIndex : CasterIndices)
+		{
+			const FShadowCaster& Caster = ShadowCasters[CasterIndex];
+			for (uint32 BatchIndex = 0; BatchIndex < Caster.NumBatches; ++BatchIndex)
+			{
+				CulledShadowBatches.Add(ShadowMeshBatches[Caster.FirstBatch + BatchIndex]);
+			}
+		}
+	};
+	const uint32 TotalShadowBatches = static_cast<uint32>(ShadowMeshBatches.Num());
+	FShadowStatManager& ShadowStatManager = FShadowStatManager::GetInstance();
 
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) ---
 	{
@@ -503,6 +611,17 @@ void FSceneRenderer::RenderShadowMaps()
 		ID3D11DepthStencilView* DefaultDSV = RHIDevice->GetSceneDSV();
 		if (AtlasDSV2D && AtlasTotalSize2D > 0)
 		{
+			// 아틀라스는 통째로 지우고 다시 그리므로, 모든 요청이 지난번과 같을 때만 그대로 사용
+			TArray<TArray<uint32>> CasterIndices2D;
+			TArray<FShadowViewKey> Keys2D;
+			CasterIndices2D.SetNum(Requests2D.Num());
+			Keys2D.SetNum(Requests2D.Num());
+			for (int32 RequestIndex = 0; RequestIndex < Requests2D.Num(); ++RequestIndex)
+			{
+				CullShadowRequest(Requests2D[RequestIndex], CasterIndices2D[RequestIndex], Keys2D[RequestIndex]);
+			}
+			const bool bAtlas2DCached = ShadowCache.IsAtlas2DCached(Keys2D);
+
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 
@@ -516,7 +635,10 @@ void FSceneRenderer::RenderShadowMaps()
 			case EShadowAATechnique::VSM:
 				{
 					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					if (!bAtlas2DCached)
+					{
+						RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
+					}
 					break;
 				}
 			default:
@@ -524,19 +646,30 @@ void FSceneRenderer::RenderShadowMaps()
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			if (!bAtlas2DCached)
+			{
+				RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
+			}
 
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
-			for (FShadowRenderRequest& Request : Requests2D)
+			for (int32 RequestIndex = 0; RequestIndex < Requests2D.Num(); ++RequestIndex)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+				FShadowRenderRequest& Request = Requests2D[RequestIndex];
+				const uint32 NumCasterBatches = CountCasterBatches(CasterIndices2D[RequestIndex]);
+				ShadowStatManager.AddShadowView(NumCasterBatches, TotalShadowBatches - NumCasterBatches, bAtlas2DCached);
+
+				if (!bAtlas2DCached && Request.Size > 0)
+				{
+					// 뷰포트 설정
+					D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+					RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+					// 뎁스 패스 렌더링 (이 라이트에 닿는 캐스터만)
+					GatherCulledBatches(CasterIndices2D[RequestIndex]);
+					RenderShadowDepthPass(Request, CulledShadowBatches);
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -551,6 +684,10 @@ void FSceneRenderer::RenderShadowMaps()
 				LightManager->SetShadowMapData(Request.LightOwner, Request.SubViewIndex, Data);
 				// vsm srv unbind
 			}
+			if (!bAtlas2DCached)
+			{
+				ShadowCache.StoreAtlas2D(Keys2D);
+			}
 			ID3D11RenderTargetView* NullRTV[1] = { nullptr };
 			RHIDevice->OMSetCustomRenderTargets(1, NullRTV, DefaultDSV);
 		}
@@ -571,6 +708,8 @@ void FSceneRenderer::RenderShadowMaps()
 			RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
 			// 이제 RequestsCube 배열을 직접 순회
+			TArray<uint32> CasterIndicesCube;
+			FShadowViewKey KeyCube;
 			for (FShadowRenderRequest& Request : RequestsCube) // 레퍼런스 유지
 			{
 				// 슬라이스 할당 실패는 FLightManager::Allocate... 함수가 처리 (Size=0 설정)
@@ -590,13 +729,27 @@ void FSceneRenderer::RenderShadowMaps()
 				int32 SliceIndex = Request.AssignedSliceIndex;   // FLightManager가 할당한 값
 				int32 FaceIndex = Request.SubViewIndex; // 원본 면 인덱스
 
-				// 2.3. 면 렌더링 (기존 로직 유지)
+				// 2.3. 면 렌더링 (면마다 캐스터를 컬링하고, 지난번과 같으면 그대로 사용)
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
+					CullShadowRequest(Request, CasterIndicesCube, KeyCube);
+					KeyCube.SliceIndex = SliceIndex;
+					KeyCube.FaceIndex = FaceIndex;
+
+					const bool bFaceCached = ShadowCache.IsCubeFaceCached(KeyCube);
+					const uint32 NumCasterBatches = CountCasterBatches(CasterIndicesCube);
+					ShadowStatManager.AddShadowView(NumCasterBatches, TotalShadowBatches - NumCasterBatches, bFaceCached);
+					if (bFaceCached)
+					{
+						continue;
+					}
+
 					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
 					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					GatherCulledBatches(CasterIndicesCube);
+					RenderShadowDepthPass(Request, CulledShadowBatches);
+					ShadowCache.StoreCubeFace(KeyCube);
 				}
 			}
 		}
@@ -663,101 +816,18 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	ViewProjBufferType ViewProjBuffer = ViewProjBufferType(ShadowRequest.ViewMatrix, ShadowRequest.ProjectionMatrix, WorldLocation, FMatrix::Identity());	// NOTE: 그림자 맵 셰이더에는 역행렬이 필요 없으므로 Identity를 전달함
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(ViewProjBuffer));
 
-	// 4. (DrawMeshBatches와 유사하게) 배치 순회하며 그리기
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	UINT CurrentVertexStride = 0;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
-
-	for (const FMeshBatchElement& Batch : InShadowBatches)
-	{
-		// Cloth binding (VS) for shadow depth pass
-		if (Batch.bClothEnabled && Batch.ClothSRV)
-		{
-			RHIDevice->SetAndUpdateConstantBuffer(ClothBufferType(1u, Batch.ClothMode, Batch.ClothBaseVertexIndex));
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(8, 1, &Batch.ClothSRV);
-		}
-		else
-		{
-			ID3D11ShaderResourceView* NullSRV[1] = { nullptr };
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(8, 1, NullSRV);
-			RHIDevice->SetAndUpdateConstantBuffer(ClothBufferType(0u, 0u, 0u));
-		}
-		// Mesh Particle인지 확인 (InstanceBuffer가 있고 InstanceCount > 0이면 Mesh Particle)
-		bool bIsMeshParticle = (Batch.InstanceBuffer != nullptr && Batch.InstanceCount > 0);
-
-		if (bIsMeshParticle)
-		{
-			// Mesh Particle용 셰이더 설정
-			RHIDevice->GetDeviceContext()->IASetInputLayout(ParticleMeshShaderVariant->InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(ParticleMeshShaderVariant->VertexShader, nullptr, 0);
-		}
-		else if (Batch.SkinningMatrices)
-		{
-			TIME_PROFILE(SKINNING_CPU_TASK)
-			RHIDevice->GetDeviceContext()->IASetInputLayout(SkinningShaderVariant->InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(SkinningShaderVariant->VertexShader, nullptr, 0);
-
-			void* pMatrixData = (void*)Batch.SkinningMatrices->GetData();
-			size_t MatrixDataSize = Batch.SkinningMatrices->Num() * sizeof(FMatrix);
-
-			constexpr size_t MaxCBufferSize = sizeof(FSkinningBuffer); // 16384
-			if (MatrixDataSize > MaxCBufferSize)
-			{
-				MatrixDataSize = MaxCBufferSize;
-			}
-
-			RHIDevice->SetAndUpdateConstantBuffer_Pointer_FSkinningBuffer(pMatrixData, MatrixDataSize);
-		}
-		else
-		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(ShaderVariant->InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(ShaderVariant->VertexShader, nullptr, 0);
-		}
-
-		// IA 상태 변경
-		if (Batch.VertexBuffer != CurrentVertexBuffer ||
-			Batch.IndexBuffer != CurrentIndexBuffer ||
-			Batch.VertexStride != CurrentVertexStride ||
-			Batch.PrimitiveTopology != CurrentTopology)
-		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-			CurrentVertexBuffer = Batch.VertexBuffer;
-			CurrentIndexBuffer = Batch.IndexBuffer;	
-			CurrentVertexStride = Batch.VertexStride;
-			CurrentTopology = Batch.PrimitiveTopology;
-		}
-
-		// 오브젝트별 World 행렬 설정 (VS에서 필요)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-
-		// Mesh Particle의 경우 인스턴스 버퍼 바인딩 및 DrawIndexedInstanced 호출
-		if (bIsMeshParticle)
-		{
-			UINT InstanceStride = Batch.InstanceStride;
-			UINT InstanceOffset = 0;
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(1, 1, &Batch.InstanceBuffer, &InstanceStride, &InstanceOffset);
-
-			// 인스턴스드 드로우 콜
-			RHIDevice->GetDeviceContext()->DrawIndexedInstanced(
-				Batch.IndexCount,
-				Batch.InstanceCount,
-				Batch.StartIndex,
-				Batch.BaseVertexIndex,
-				0 // StartInstanceLocation
-			);
-		}
-		else
-		{
-			// 일반 드로우 콜
-			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
-		}
-	}
+	// 4. (DrawMeshBatches와 유사하게) 배치를 명령 목록에 기록한 뒤 실행
+	FShadowDrawRecordParams RecordParams;
+	RecordParams.DefaultInputLayout = ShaderVariant->InputLayout;
+	RecordParams.DefaultVertexShader = ShaderVariant->VertexShader;
+	RecordParams.SkinningInputLayout = SkinningShaderVariant->InputLayout;
+	RecordParams.SkinningVertexShader = SkinningShaderVariant->VertexShader;
+	RecordParams.ParticleMeshInputLayout = ParticleMeshShaderVariant->InputLayout;
+	RecordParams.ParticleMeshVertexShader = ParticleMeshShaderVariant->VertexShader;
+
+	FMeshDrawCommandRecorder* CommandRecorder = OwnerRenderer->GetMeshDrawCommandRecorder();
+	CommandRecorder->RecordShadowBatches(InShadowBatches, RecordParams);
+	CommandRecorder->Execute(*OwnerRenderer->GetRHICommandContext());
 }
 
 //====================================================================================
@@ -846,181 +916,256 @@ void FSceneRenderer::GatherVisibleProxies()
 	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
 	//PerformFrustumCulling();
 
-	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
-	const bool bDrawSkeletalMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
-	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
-	const bool bDrawFog = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
-	const bool bDrawLight = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Lighting);
-	const bool bUseAntiAliasing = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_FXAA);
-	const bool bUseBillboard = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
-	const bool bUseIcon = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_EditorIcon);
-	const bool bDrawParticles = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Particles);
-
-	// Helper lambda to collect components from an actor
-	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
-		{
-			if (!Actor || !Actor->IsActorVisible() || !Actor->IsActorActive())
-			{
-				return;
-			}
+	// 월드의 리테인드 씬(FScene)에서 보이는 프록시를 고르는 일은 월드당 프레임마다 한 번만 수행하고, 같은 월드를 그리는 뷰끼리 공유
+	// 오클루전 컬링 등 뷰별 처리가 목록을 줄이므로 포인터 배열만 복사해 사용
+	const FWorldSceneProxies& SceneProxies = OwnerRenderer->GetSceneProxyCollector()->GetSceneProxies(World);
+	Proxies = SceneProxies.Proxies;
+	SceneLocals = SceneProxies.SceneLocals;
+	SceneGlobals = SceneProxies.SceneGlobals;
 
-			for (USceneComponent* Component : Actor->GetSceneComponents())
-			{
-				if (!Component || !Component->IsVisible())
-				{
-					continue;
-				}
+	// 라이트 통계 업데이트
+	FLightStats LightStats;
+	LightStats.TotalPointLights = SceneLocals.PointLights.Num();
+	LightStats.TotalSpotLights = SceneLocals.SpotLights.Num();
+	LightStats.TotalDirectionalLights = SceneGlobals.DirectionalLights.Num();
+	LightStats.TotalAmbientLights = SceneGlobals.AmbientLights.Num();
+	LightStats.CalculateTotal();
+	FLightStatManager::GetInstance().UpdateStats(LightStats);
 
-				// 엔진 에디터 액터 컴포넌트
-				if (bIsEditorActor)
-				{
-					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
-					{
-						Proxies.OverlayPrimitives.Add(GizmoComponent);
-					}
-					else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
+	// 쉐도우 통계 업데이트 (그림자 드리우는 라이트 수는 FScene이 수집하면서 셈)
+	FShadowStats ShadowStats;
+	ShadowStats.ShadowCastingPointLights = SceneProxies.NumShadowCastingPointLights;
+	ShadowStats.ShadowCastingSpotLights = SceneProxies.NumShadowCastingSpotLights;
+	ShadowStats.ShadowCastingDirectionalLights = SceneProxies.NumShadowCastingDirectionalLights;
 
-					continue;
-				}
+	// 쉐도우 맵 아틀라스 정보
+	FLightManager* LightManager = World->GetLightManager();
+	if (LightManager)
+	{
+		ShadowStats.ShadowAtlas2DSize = static_cast<uint32>(LightManager->GetShadowAtlasSize2D());
+		ShadowStats.ShadowAtlasCubeSize = LightManager->GetShadowCubeArraySize();
+		ShadowStats.ShadowCubeArrayCount = LightManager->GetShadowCubeArrayCount();
+		ShadowStats.Calculate2DAtlasMemory();
+		ShadowStats.CalculateCubeAtlasMemory();
+	}
 
-				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component); PrimitiveComponent)
-				{
-					// 에디터 보조 컴포넌트 (빌보드 등)
-					if (!PrimitiveComponent->IsEditable())
-					{
-						if (bUseIcon)
-						{
-							Proxies.EditorPrimitives.Add(PrimitiveComponent);
-						}
-						continue;
-					}
+	ShadowStats.CalculateTotal();
+	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+}
 
-					// 일반 컴포넌트
-					if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
-					{
-						// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
-						if (MeshComponent->IsA(UStaticMeshComponent::StaticClass()))
-						{
-							if (bDrawStaticMeshes) { Proxies.Meshes.Add(MeshComponent); }
-						}
-						else if (USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(MeshComponent))
-						{
-						    if (bDrawSkeletalMeshes) { Proxies.SkinnedMeshes.Add(SkinnedMeshComponent); }
-						}
-					}
-					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
-					{
-						Proxies.Billboards.Add(BillboardComponent);
-					}
-					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
-					{
-						Proxies.Decals.Add(DecalComponent);
-					}
-					else if (ULineComponent* LineComponent = Cast<ULineComponent>(PrimitiveComponent))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
-					else if (UParticleSystemComponent* ParticleComponent = Cast<UParticleSystemComponent>(PrimitiveComponent))
-					{
-						if (bDrawParticles)
-						{
-							Proxies.Particles.Add(ParticleComponent);
-						}
-					}
-				}
-				else
-				{
-					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
-					{
-						SceneGlobals.Fogs.Add(FogComponent);
-					}
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	FSceneViewState* ViewState = View->ViewState;
+	if (!World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Culling))
+	{
+		// 꺼져 있던 동안의 변경은 추적하지 않으므로 다시 켜지면 전체 컬링부터 시작
+		if (ViewState)
+		{
+			ViewState->InvalidateVisibility();
+		}
+		return;
+	}
 
-					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.DirectionalLights.Add(LightComponent);
-					}
+	// 뷰 상태가 있으면 뷰 전용 컬러를 사용해 깊이 버퍼를 다음 프레임까지 유지
+	FOcclusionCullingManagerCPU* OcclusionCuller = ViewState ? ViewState->GetOcclusionCuller() : OwnerRenderer->GetOcclusionCuller();
+	if (!OcclusionCuller || (Proxies.Meshes.IsEmpty() && Proxies.SkinnedMeshes.IsEmpty()))
+	{
+		return;
+	}
 
-					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.AmbientLights.Add(LightComponent);
-					}
+	const FMatrix ViewProj = View->GetViewProjectionMatrix();
+	const int ViewWidth = static_cast<int>(View->ViewRect.Width());
+	const int ViewHeight = static_cast<int>(View->ViewRect.Height());
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
 
-					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
-						{
-							SceneLocals.SpotLights.Add(SpotLightComponent);
-						}
-						else
-						{
-							SceneLocals.PointLights.Add(LightComponent);
-						}
-					}
-				}
-			}
-		};
+	const int32 NumMeshes = Proxies.Meshes.Num();
+	const int32 NumOccludees = NumMeshes + Proxies.SkinnedMeshes.Num();
+	TArray<uint8_t> VisibleFlags;
+	FOcclusionStats OcclusionStats;
 
-	// Collect from Editor Actors (Gizmo, Grid, etc.)
-	for (AActor* EditorActor : World->GetEditorActors())
+	// 0. 카메라가 정지해 있으면 지난 컬링 결과를 재사용 (그 사이 변경된 컴포넌트만 캐시에서 제거)
+	TArray<UPrimitiveComponent*> ChangedComponents;
+	bool bReuseVisibility = ViewState && Partition
+		&& ViewState->CanReuseVisibility(World, ViewProj, ViewWidth, ViewHeight)
+		&& Partition->GetVisibilityChangesSince(ViewState->GetVisibilityRevision(), ChangedComponents);
+	if (bReuseVisibility)
 	{
-		CollectComponentsFromActor(EditorActor, true);
+		for (UPrimitiveComponent* ChangedComponent : ChangedComponents)
+		{
+			// 오클루더가 움직였으면 깊이 버퍼 자체가 무효
+			if (ViewState->IsOccluder(ChangedComponent))
+			{
+				bReuseVisibility = false;
+				break;
+			}
+			ViewState->ForgetVisibility(ChangedComponent);
+		}
 	}
 
-	// Collect from Level Actors (including their Gizmo components)
-	for (AActor* Actor : World->GetActors())
+	if (bReuseVisibility)
 	{
-		CollectComponentsFromActor(Actor, false);
-	}
+		FScopeCycleCounter CacheCounter;
 
-	// 라이트 통계 업데이트
-	FLightStats LightStats;
-	LightStats.TotalPointLights = SceneLocals.PointLights.Num();
-	LightStats.TotalSpotLights = SceneLocals.SpotLights.Num();
-	LightStats.TotalDirectionalLights = SceneGlobals.DirectionalLights.Num();
-	LightStats.TotalAmbientLights = SceneGlobals.AmbientLights.Num();
-	LightStats.CalculateTotal();
-	FLightStatManager::GetInstance().UpdateStats(LightStats);
+		// 1. 캐시 조회, 캐시에 없는 메시(이동/신규)와 스키닝 메시(애니메이션으로 바운드가 매 프레임 변함)만 재판정 목록에 추가
+		TArray<FAABB> RetestBounds;
+		TArray<int32> RetestIndices;
+		uint32 NumCachedOccluded = 0;
+		uint32 NumCachedOffscreen = 0;
+		int32 NumVisibleOccluders = 0;
+		VisibleFlags.assign(size_t(NumOccludees), 1);
 
-	// 쉐도우 통계 업데이트
-	FShadowStats ShadowStats;
-	for (UPointLightComponent* Light : SceneLocals.PointLights)
-	{
-		if (Light && Light->IsCastShadows())
+		for (int32 i = 0; i < NumMeshes; ++i)
 		{
-			ShadowStats.ShadowCastingPointLights++;
+			UMeshComponent* MeshComponent = Proxies.Meshes[i];
+			if (ViewState->IsOccluder(MeshComponent))
+			{
+				++NumVisibleOccluders;
+			}
+
+			const ECachedVisibility* CachedVisibility = ViewState->FindVisibility(MeshComponent);
+			if (!CachedVisibility)
+			{
+				RetestIndices.Add(i);
+				RetestBounds.Add(Proxies.MeshBounds[i]);
+				continue;
+			}
+
+			if (*CachedVisibility == ECachedVisibility::Occluded)
+			{
+				VisibleFlags[i] = 0;
+				++NumCachedOccluded;
+			}
+			else if (*CachedVisibility == ECachedVisibility::Offscreen)
+			{
+				VisibleFlags[i] = 0;
+				++NumCachedOffscreen;
+			}
+		}
+
+		// 숨겨진 오클루더가 있으면 깊이 버퍼가 더 이상 씬과 맞지 않음
+		bReuseVisibility = NumVisibleOccluders == ViewState->GetNumOccluders();
+		if (bReuseVisibility)
+		{
+			for (int32 i = 0; i < Proxies.SkinnedMeshes.Num(); ++i)
+			{
+				RetestIndices.Add(NumMeshes + i);
+				RetestBounds.Add(Proxies.SkinnedMeshBounds[i]);
+			}
+
+			// 2. 지난 깊이 버퍼로 재판정 후 스태틱 메시 결과를 캐시에 기록
+			TArray<uint8_t> RetestFlags;
+			FOcclusionStats RetestStats;
+			OcclusionCuller->TestOccludees(ViewProj, RetestBounds, RetestFlags, &RetestStats);
+
+			for (int32 k = 0; k < RetestIndices.Num(); ++k)
+			{
+				const int32 OccludeeIndex = RetestIndices[k];
+				VisibleFlags[OccludeeIndex] = RetestFlags[k];
+				if (OccludeeIndex < NumMeshes)
+				{
+					ViewState->SetVisibility(Proxies.Meshes[OccludeeIndex],
+						RetestFlags[k] ? ECachedVisibility::Visible
+						: (OcclusionCuller->IsOccludeeOffscreen(k) ? ECachedVisibility::Offscreen : ECachedVisibility::Occluded));
+				}
+			}
+			ViewState->SetVisibilityRevision(Partition->GetVisibilityRevision());
+
+			// 오클루더/깊이 버퍼 정보는 마지막 전체 컬링 기준
+			OcclusionStats = ViewState->GetOcclusionStats();
+			OcclusionStats.bReusedVisibility = true;
+			OcclusionStats.CachedPrimitives = static_cast<uint32>(NumOccludees - RetestIndices.Num());
+			OcclusionStats.RetestedPrimitives = static_cast<uint32>(RetestIndices.Num());
+			OcclusionStats.TotalOccludees = static_cast<uint32>(NumOccludees);
+			OcclusionStats.OccludedPrimitives = NumCachedOccluded + RetestStats.OccludedPrimitives;
+			OcclusionStats.OffscreenPrimitives = NumCachedOffscreen + RetestStats.OffscreenPrimitives;
+			OcclusionStats.SetupTimeMS = 0.0;
+			OcclusionStats.RasterTimeMS = 0.0;
+			OcclusionStats.TestTimeMS = CacheCounter.Finish();
+			OcclusionStats.CalculateStats();
 		}
 	}
-	for (USpotLightComponent* Light : SceneLocals.SpotLights)
+
+	if (!bReuseVisibility)
 	{
-		if (Light && Light->IsCastShadows())
+		// 1. 오클루디(모든 메시의 월드 AABB) + 오클루더 후보(스태틱 메시) 수집
+		TArray<FAABB> OccludeeBounds;
+		TArray<FOccluderMeshDesc> OccluderCandidates;
+		OccludeeBounds.Reserve(NumOccludees);
+
+		for (int32 i = 0; i < NumMeshes; ++i)
 		{
-			ShadowStats.ShadowCastingSpotLights++;
+			UMeshComponent* MeshComponent = Proxies.Meshes[i];
+			OccludeeBounds.Add(Proxies.MeshBounds[i]);
+
+			UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent);
+			UStaticMesh* StaticMesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+			FStaticMesh* StaticMeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+			if (!StaticMeshAsset || StaticMeshAsset->Vertices.IsEmpty() || StaticMeshAsset->Indices.IsEmpty())
+			{
+				continue;
+			}
+
+			FOccluderMeshDesc Occluder;
+			Occluder.Vertices = StaticMeshAsset->Vertices.GetData();
+			Occluder.NumVertices = static_cast<uint32>(StaticMeshAsset->Vertices.Num());
+			Occluder.Indices = StaticMeshAsset->Indices.GetData();
+			Occluder.NumIndices = static_cast<uint32>(StaticMeshAsset->Indices.Num());
+			Occluder.WorldMatrix = StaticMeshComponent->GetWorldMatrix();
+			Occluder.OccludeeIndex = OccludeeBounds.Num() - 1;
+			OccluderCandidates.Add(Occluder);
+		}
+		OccludeeBounds.insert(OccludeeBounds.end(), Proxies.SkinnedMeshBounds.begin(), Proxies.SkinnedMeshBounds.end());
+
+		// 2. 래스터화 + 테스트
+		OcclusionCuller->CullView(ViewProj, ViewWidth, ViewHeight,
+			OccludeeBounds, OccluderCandidates, VisibleFlags, &OcclusionStats);
+
+		// 3. 다음 프레임 재사용을 위해 스태틱 메시 결과와 사용된 오클루더를 기록
+		if (ViewState)
+		{
+			ViewState->BeginVisibilityCache(World, ViewProj, ViewWidth, ViewHeight);
+			for (int32 i = 0; i < NumMeshes; ++i)
+			{
+				ViewState->SetVisibility(Proxies.Meshes[i],
+					VisibleFlags[i] ? ECachedVisibility::Visible
+					: (OcclusionCuller->IsOccludeeOffscreen(i) ? ECachedVisibility::Offscreen : ECachedVisibility::Occluded));
+			}
+			for (int32 CandidateIndex : OcclusionCuller->GetSelectedOccluders())
+			{
+				ViewState->AddOccluder(Proxies.Meshes[OccluderCandidates[CandidateIndex].OccludeeIndex]);
+			}
+			ViewState->SetVisibilityRevision(Partition ? Partition->GetVisibilityRevision() : 0);
+			ViewState->SetOcclusionStats(OcclusionStats);
 		}
 	}
-	for (UDirectionalLightComponent* Light : SceneGlobals.DirectionalLights)
+
+	// 4. 가려진 메시를 수집 목록에서 제거 (정렬 순서 유지)
+	int32 FlagIndex = 0;
+	int32 WriteIndex = 0;
+	for (int32 i = 0; i < Proxies.Meshes.Num(); ++i, ++FlagIndex)
 	{
-		if (Light && Light->IsCastShadows())
+		if (VisibleFlags[FlagIndex])
 		{
-			ShadowStats.ShadowCastingDirectionalLights++;
+			Proxies.MeshBounds[WriteIndex] = Proxies.MeshBounds[i];
+			Proxies.Meshes[WriteIndex++] = Proxies.Meshes[i];
 		}
 	}
+	Proxies.Meshes.SetNum(WriteIndex);
+	Proxies.MeshBounds.SetNum(WriteIndex);
 
-	// 쉐도우 맵 아틀라스 정보
-	FLightManager* LightManager = World->GetLightManager();
-	if (LightManager)
+	WriteIndex = 0;
+	for (int32 i = 0; i < Proxies.SkinnedMeshes.Num(); ++i, ++FlagIndex)
 	{
-		ShadowStats.ShadowAtlas2DSize = static_cast<uint32>(LightManager->GetShadowAtlasSize2D());
-		ShadowStats.ShadowAtlasCubeSize = LightManager->GetShadowCubeArraySize();
-		ShadowStats.ShadowCubeArrayCount = LightManager->GetShadowCubeArrayCount();
-		ShadowStats.Calculate2DAtlasMemory();
-		ShadowStats.CalculateCubeAtlasMemory();
+		if (VisibleFlags[FlagIndex])
+		{
+			Proxies.SkinnedMeshBounds[WriteIndex] = Proxies.SkinnedMeshBounds[i];
+			Proxies.SkinnedMeshes[WriteIndex++] = Proxies.SkinnedMeshes[i];
+		}
 	}
+	Proxies.SkinnedMeshes.SetNum(WriteIndex);
+	Proxies.SkinnedMeshBounds.SetNum(WriteIndex);
 
-	ShadowStats.CalculateTotal();
-	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+	FOcclusionStatManager::GetInstance().UpdateStats(OcclusionStats);
 }
 
 void FSceneRenderer::PerformTileLightCulling()
@@ -1036,7 +1181,7 @@ void FSceneRenderer::PerformTileLightCulling()
 	UINT ViewportWidth = static_cast<UINT>(View->ViewRect.Width());
 	UINT ViewportHeight = static_cast<UINT>(View->ViewRect.Height());
 
-	// 타일 컬링이 활성화된 경우에만 컬링 수행
+	// 타일 컬링이 활성화된 경우에만 클러스터(타일 x 깊이 슬라이스) 컬링 수행
 	if (bTileCullingEnabled)
 	{
 		// PointLight와 SpotLight 정보 수집
@@ -1068,6 +1213,9 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.ClusterCountZ = TileLightCuller->GetClusterCountZ();
+	TileCullingBuffer.ClusterDepthScale = TileLightCuller->GetDepthSliceScale();
+	TileCullingBuffer.ClusterDepthBias = TileLightCuller->GetDepthSliceBias();
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
@@ -1112,13 +1260,40 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 	// --- 1. 수집 (Collect) ---
 	MeshBatchElements.Empty();
 	SkinnedMeshBatchElements.Empty();
+
+	// 데칼은 화면 공간에서 씬 깊이로 적용하므로 받을 메시를 ID 버퍼의 비트로 표시
+	// (예전 메시별 데칼 패스와 같이 편집 가능한 컴포넌트 + 보이는 액터만, 기즈모/빌보드 등은 제외)
+	auto MarkDecalReceiver = [](const UMeshComponent* MeshComponent, TArray<FMeshBatchElement>& Batches, int32 FirstBatch)
+	{
+		const AActor* Owner = MeshComponent->GetOwner();
+		if (!MeshComponent->IsEditable() || !Owner || !Owner->IsActorVisible())
+		{
+			return;
+		}
+		for (int32 Index = FirstBatch; Index < Batches.Num(); ++Index)
+		{
+			if (Batches[Index].ObjectID != 0)
+			{
+				Batches[Index].ObjectID |= FMeshBatchElement::DecalReceiverIDBit;
+			}
+		}
+	};
+
+	// LOD 통계는 불투명 패스에서만 집계 (그림자 패스도 같은 뷰로 LOD를 고르므로 중복 집계 방지)
+	FMeshLODStatManager& LODStatManager = FMeshLODStatManager::GetInstance();
 	for (USkinnedMeshComponent* SkinnedMeshComponent : Proxies.SkinnedMeshes)
 	{
+		const int32 FirstBatch = SkinnedMeshBatchElements.Num();
 		SkinnedMeshComponent->CollectMeshBatches(SkinnedMeshBatchElements, View);
+		MarkDecalReceiver(SkinnedMeshComponent, SkinnedMeshBatchElements, FirstBatch);
+		LODStatManager.AddSelection(SkinnedMeshComponent->GetLastLODSelection());
 	}
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
+		const int32 FirstBatch = MeshBatchElements.Num();
 		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
+		MarkDecalReceiver(MeshComponent, MeshBatchElements, FirstBatch);
+		LODStatManager.AddSelection(MeshComponent->GetLastLODSelection());
 	}
 
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
@@ -1132,16 +1307,27 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 		//TextRenderComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
 
-	// --- 2. 정렬 (Sort) ---
-	SkinnedMeshBatchElements.Sort();
-	MeshBatchElements.Sort();
-
-	// --- 3. 그리기 (Draw) ---
+	// --- 2. 정렬 (Sort) + 3. 그리기 (Draw) ---
+	// 정렬 결과(인덱스 목록)는 정렬기 버퍼를 공유하므로 목록마다 정렬 직후 그린다
 	{
 		GPU_EVENT_TIMER(RHIDevice->GetDeviceContext(), "SKINNING_GPU_TASK", OwnerRenderer->GetGPUTimer());
-		DrawMeshBatches(SkinnedMeshBatchElements, true);
+		const TArray<uint32>& SkinnedDrawOrder = SortMeshBatches(SkinnedMeshBatchElements);
+		DrawMeshBatches(SkinnedMeshBatchElements, true, &SkinnedDrawOrder);
 	}
-	DrawMeshBatches(MeshBatchElements, true);
+	const TArray<uint32>& DrawOrder = SortMeshBatches(MeshBatchElements);
+
+	// --- 4. 자동 인스턴싱: 정렬로 이웃하게 된 동일 메시/머티리얼 배치를 인스턴스드 드로우로 합침 ---
+	FMeshDrawInstancer* Instancer = OwnerRenderer->GetMeshDrawInstancer();
+	const TArray<uint32>& InstancedDrawOrder = Instancer->BuildInstancedDraws(RHIDevice, MeshBatchElements, DrawOrder);
+	FDrawSortStatManager::GetInstance().AddInstancingResult(Instancer->GetLastMergedDraws(), Instancer->GetLastMergedInstances());
+
+	// BENCH RHICMD SCENE: 이번 프레임의 실제 입력으로 기록/실행 비용 측정
+	if (FRHICommandListBenchmark::ConsumeScenePassRequest())
+	{
+		FRHICommandListBenchmark::RunScenePass(MeshBatchElements, InstancedDrawOrder, GetMeshDrawRecordParams());
+	}
+
+	DrawMeshBatches(MeshBatchElements, true, &InstancedDrawOrder);
 }
 
 void FSceneRenderer::RenderParticlesPass()
@@ -1161,20 +1347,53 @@ void FSceneRenderer::RenderParticlesPass()
 	// 셰이더 경로
 	FString ShaderPath = "Shaders/Materials/UberLit.hlsl";
 
-	// 파티클 메시 배치 수집
-	TArray<FMeshBatchElement> ParticleBatchElements;
+	// 시뮬레이션 때 갱신된 파티클 바운드로 프러스텀 컬링
+	const FFrustum ViewFrustum = CreateFrustumFromViewProjection(View->GetViewProjectionMatrix());
+
+	// 1. 보이는 파티클 시스템 수집 + 에미터 등록
+	FParticleVertexGenerator* ParticleVertexGenerator = OwnerRenderer->GetParticleVertexGenerator();
+	ParticleVertexGenerator->Reset();
+
+	TArray<FParticleDynamicData*> VisibleDynamicData;
+	VisibleDynamicData.reserve(Proxies.Particles.Num());
 	for (UParticleSystemComponent* ParticleComponent : Proxies.Particles)
 	{
 		if (!ParticleComponent || !ParticleComponent->IsVisible())
 			continue;
 
-		// 파티클 동적 데이터 업데이트
-		ParticleComponent->UpdateDynamicData();
+		FVector BoundsMin, BoundsMax;
+		ParticleComponent->GetCullingBounds(BoundsMin, BoundsMax);
+		if (!IsAABBVisible(ViewFrustum, FAABB(BoundsMin, BoundsMax)))
+		{
+			ParticleStats.FrustumCulledSystems++;
+			continue;
+		}
+
+		// 화면 밖 시간 측정용 (오래 안 보이면 시뮬레이션을 줄이거나 멈춤)
+		ParticleComponent->MarkRendered();
+
+		// 파티클 동적 데이터 업데이트 (그림자 패스에서 이미 수집했으면 재사용)
+		ParticleComponent->UpdateDynamicData(OwnerRenderer->GetSceneProxyCollector()->GetFrameNumber());
 		FParticleDynamicData* DynamicData = ParticleComponent->GetCurrentDynamicData();
 
 		if (!DynamicData)
 			continue;
 
+		VisibleDynamicData.Add(DynamicData);
+		for (FDynamicEmitterDataBase* EmitterData : DynamicData->DynamicEmitterDataArray)
+		{
+			ParticleVertexGenerator->AddEmitter(EmitterData);
+		}
+	}
+
+	// 2. 모든 에미터의 정점/인스턴스를 업로드 메모리에 병렬 기록
+	ParticleVertexGenerator->Generate(View, &ParticleStats);
+
+	// 3. 에미터별 배치와 상태 수집 (그리기는 패스 전체를 명령 목록에 한 번에 기록)
+	TArray<FMeshBatchElement> ParticleBatchElements;
+	TArray<FParticleEmitterDrawRange> EmitterRanges;
+	for (FParticleDynamicData* DynamicData : VisibleDynamicData)
+	{
 		// 파티클 시스템 카운트 증가
 		ParticleStats.VisibleParticleSystems++;
 		ParticleStats.TotalEmitters += static_cast<uint32>(DynamicData->DynamicEmitterDataArray.Num());
@@ -1191,16 +1410,20 @@ void FSceneRenderer::RenderParticlesPass()
 
 			const FDynamicSpriteEmitterReplayDataBase& SpriteReplayData = static_cast<const FDynamicSpriteEmitterReplayDataBase&>(ReplayData);
 			EParticleBlendMode BlendMode = SpriteReplayData.BlendMode;
+			FParticleEmitterDrawRange EmitterRange;
 			switch (BlendMode)
 			{
 			case EParticleBlendMode::None:
-				RHIDevice->OMSetBlendState(false, false);
+				EmitterRange.bEnableBlend = false;
+				EmitterRange.bAdditive = false;
 				break;
 			case EParticleBlendMode::Translucent:
-				RHIDevice->OMSetBlendState(true, false);
+				EmitterRange.bEnableBlend = true;
+				EmitterRange.bAdditive = false;
 				break;
 			case EParticleBlendMode::Additive:
-				RHIDevice->OMSetBlendState(true, true);
+				EmitterRange.bEnableBlend = true;
+				EmitterRange.bAdditive = true;
 				break;
 			default:
 				assert(false && "Unknown Particle Blend Mode!");
@@ -1218,7 +1441,7 @@ void FSceneRenderer::RenderParticlesPass()
 				ParticleShaderMacros = View->ViewShaderMacros; // 메시 파티클은 뷰 모드 매크로도 포함
 				ParticleShaderMacros.push_back(FShaderMacro{ "PARTICLE_MESH", "1" });
 
-				RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+				EmitterRange.DepthComparisonFunc = static_cast<uint32>(EComparisonFunc::LessEqual);
 
 				// 메시 파티클 통계
 				ParticleStats.MeshEmitters++;
@@ -1229,7 +1452,7 @@ void FSceneRenderer::RenderParticlesPass()
 				//ParticleShaderMacros = View->ViewShaderMacros;
 				ParticleShaderMacros.push_back(FShaderMacro{ "PARTICLE_BEAM", "1" });
 
-				RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
+				EmitterRange.DepthComparisonFunc = static_cast<uint32>(EComparisonFunc::LessEqualReadOnly);
 
 				// 빔 파티클 통계 (스프라이트 카테고리로 집계)
 				ParticleStats.SpriteEmitters++;
@@ -1238,13 +1461,13 @@ void FSceneRenderer::RenderParticlesPass()
 			{
 				ParticleShaderMacros.push_back(FShaderMacro{ "PARTICLE", "1" });
 
-				RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
+				EmitterRange.DepthComparisonFunc = static_cast<uint32>(EComparisonFunc::LessEqualReadOnly);
 
 				// 스프라이트 파티클 통계
 				ParticleStats.SpriteEmitters++;
 
-				// SubUV 상수 버퍼 업데이트 (Sprite Particle만 해당)
-				FParticleSubUVBufferType SubUVBuffer;
+				// SubUV 상수 버퍼 (Sprite Particle만 해당)
+				FParticleSubUVBufferType& SubUVBuffer = EmitterRange.SubUV;
 				SubUVBuffer.SubImages_Horizontal = SpriteReplayData.SubImages_Horizontal;
 				SubUVBuffer.SubImages_Vertical = SpriteReplayData.SubImages_Vertical;
 
@@ -1262,8 +1485,8 @@ void FSceneRenderer::RenderParticlesPass()
 				SubUVBuffer.bInterpolateUV = bInterpolateUV ? 1 : 0;
 				SubUVBuffer.Padding = 0;
 
-				// 상수 버퍼 업데이트 (b6 슬롯)
-				RHIDevice->SetAndUpdateConstantBuffer(SubUVBuffer);
+				// 에미터 구간 앞에 b6 슬롯 갱신을 기록
+				EmitterRange.bHasSubUV = true;
 			}
 
 			// 파티클용 셰이더 로드
@@ -1279,9 +1502,15 @@ void FSceneRenderer::RenderParticlesPass()
 			// 메시 배치 수집 전 배치 카운트 저장
 			int32 BatchCountBefore = ParticleBatchElements.Num();
 
-			// 메시 배치 수집
+			// 메시 배치 수집 (정점/인스턴스는 위에서 이미 기록됨)
 			EmitterData->GetDynamicMeshElementsEmitter(ParticleBatchElements, View);
 
+			// 수집된 배치가 없으면 (그릴 파티클 없음 / 맵 실패) 다음 에미터로
+			if (ParticleBatchElements.Num() == BatchCountBefore)
+			{
+				continue;
+			}
+
 			// 마지막으로 추가된 배치의 버퍼 메모리 사용량 집계: 메시 배치가 여러 개일 수 있으므로 마지막 배치만 확인
 			FMeshBatchElement& LastBatchElement = ParticleBatchElements.Last();
 			D3D11_BUFFER_DESC BufferDesc;
@@ -1320,13 +1549,16 @@ void FSceneRenderer::RenderParticlesPass()
 			else
 			{
 				ParticleStats.TotalInsertedVertices += ReplayData.ActiveParticleCount * 4;
-			}
-
 
-			// 수집된 파티클이 없으면 다음 에미터로
-			if (ParticleBatchElements.IsEmpty())
-			{
-				continue;
+				// 에미터별 정렬 시간 집계
+				const FDynamicSpriteEmitterDataBase* SpriteEmitterData = static_cast<const FDynamicSpriteEmitterDataBase*>(EmitterData);
+				if (SpriteEmitterData->GetLastSortedCount() > 0)
+				{
+					ParticleStats.SortedEmitters++;
+					ParticleStats.SortedParticles += static_cast<uint32>(SpriteEmitterData->GetLastSortedCount());
+					ParticleStats.SortTimeMS += SpriteEmitterData->GetLastSortTimeMS();
+					ParticleStats.MaxEmitterSortTimeMS = std::max(ParticleStats.MaxEmitterSortTimeMS, SpriteEmitterData->GetLastSortTimeMS());
+				}
 			}
 
 			// 이 에미터가 렌더링되었으므로 카운트 증가
@@ -1359,10 +1591,20 @@ void FSceneRenderer::RenderParticlesPass()
 				}
 			}
 
-			DrawMeshBatches(ParticleBatchElements, true);
+			EmitterRange.FirstBatch = BatchCountBefore;
+			EmitterRange.NumBatches = BatchCountAfter - BatchCountBefore;
+			EmitterRanges.Add(EmitterRange);
 		}
 	}
 
+	// 4. 에미터 상태 + 배치를 워커 스레드에서 기록하고 순서대로 실행
+	if (!EmitterRanges.IsEmpty())
+	{
+		FMeshDrawCommandRecorder* CommandRecorder = OwnerRenderer->GetMeshDrawCommandRecorder();
+		CommandRecorder->RecordParticleEmitters(ParticleBatchElements, EmitterRanges, GetMeshDrawRecordParams());
+		CommandRecorder->Execute(*OwnerRenderer->GetRHICommandContext());
+	}
+
 	// CPU 렌더링 시간 측정 종료
 	auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
 	std::chrono::duration<double, std::milli> CpuDuration = CpuTimeEnd - CpuTimeStart;
@@ -1393,35 +1635,32 @@ void FSceneRenderer::RenderDecalPass()
 	if (View->RenderSettings->GetViewMode() == EViewMode::VMI_WorldNormal)
 		return;
 
-	GPU_EVENT_TIMER(RHIDevice->GetDeviceContext(), "DecalPass", OwnerRenderer->GetGPUTimer());
-
-	UWorldPartitionManager* Partition = World->GetPartitionManager();
-	if (!Partition)
+	FDecalRenderResources* DecalResources = OwnerRenderer->GetDecalRenderResources();
+	if (!TileLightCuller || !DecalResources)
 		return;
 
-	const FBVHierarchy* BVH = Partition->GetBVH();
-	if (!BVH)
-		return;
+	GPU_EVENT_TIMER(RHIDevice->GetDeviceContext(), "DecalPass", OwnerRenderer->GetGPUTimer());
 
 	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
 	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
 
-	// ViewMode에 따라 조명 모델 매크로 설정
-	FString ShaderPath = "Shaders/Effects/Decal.hlsl";
-
-	// ViewMode에 따른 Decal 셰이더 로드
-	UShader* DecalShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath, View->ViewShaderMacros);
-	FShaderVariant* ShaderVariant = DecalShader->GetOrCompileShaderVariant(View->ViewShaderMacros);
-	if (!DecalShader || !ShaderVariant)
+	ID3D11VertexShader* DecalVS = nullptr;
+	ID3D11PixelShader* DecalPS = nullptr;
+	if (!DecalResources->GetShaders(View, DecalVS, DecalPS))
 	{
-		UE_LOG("RenderDecalPass: Failed to load Decal shader with ViewMode macros!");
+		UE_LOG("RenderDecalPass: Failed to load ClusteredDecal shader with ViewMode macros!");
 		return;
 	}
 
-	// 데칼 렌더 설정
-	RHIDevice->RSSetState(ERasterizerMode::Decal);
-	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
-	RHIDevice->OMSetBlendState(true);
+	FScopeCycleCounter DecalCounter;
+
+	// 1. 데칼 정보와 경계 구 수집 (수신 메시와 무관하게 데칼 수에 비례, 배열 순서 = 합성 순서)
+	DecalResources->BeginPass();
+
+	TArray<FDecalRenderResources::FDecalInfo> DecalInfos;
+	TArray<FTileLightCuller::FClusterSphere> DecalSpheres;
+	DecalInfos.Reserve(Proxies.Decals.Num());
+	DecalSpheres.Reserve(Proxies.Decals.Num());
 
 	for (UDecalComponent* Decal : Proxies.Decals)
 	{
@@ -1430,64 +1669,111 @@ void FSceneRenderer::RenderDecalPass()
 			continue;
 		}
 
-		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		// 아틀라스가 이번 패스의 텍스처로 가득 차면 나머지 데칼은 건너뜀
+		const int32 TextureSlice = DecalResources->GetTextureSlice(Decal->GetDecalTexture());
+		if (TextureSlice < 0)
+		{
+			continue;
+		}
 
-		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
-		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		FDecalRenderResources::FDecalInfo& Info = DecalInfos.emplace_back();
+		Info.DecalMatrix = Decal->GetDecalProjectionMatrix();
+		Info.Opacity = Decal->GetOpacity();
+		Info.TextureSlice = static_cast<uint32>(TextureSlice);
+		Info.Padding[0] = Info.Padding[1] = 0.0f;
 
-		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
-		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
-		// 임시로 PrimitiveComponent가 아닌 UStaticMeshComponent를 받도록 함
-		for (UPrimitiveComponent* SMC : IntersectedStaticMeshComponents)
-		{
-			// 기즈모에 데칼 입히면 안되므로 에디팅이 안되는 Component는 데칼 그리지 않음
-			if (!SMC || !SMC->IsEditable())
-				continue;
+		const FAABB DecalBounds = Decal->GetWorldAABB();
+		DecalSpheres.Add({ DecalBounds.GetCenter(), DecalBounds.GetHalfExtent().Size() });
+	}
 
-			AActor* Owner = SMC->GetOwner();
-			if (!Owner || !Owner->IsActorVisible())
-				continue;
+	if (DecalInfos.IsEmpty())
+	{
+		FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += DecalCounter.Finish();
+		return;
+	}
 
-			FDecalStatManager::GetInstance().IncrementAffectedMeshCount();
-			TargetPrimitives.push_back(SMC);
-		}
+	// 2. 라이트와 같은 클러스터 그리드에 배치
+	const UINT ViewportWidth = static_cast<UINT>(View->ViewRect.Width());
+	const UINT ViewportHeight = static_cast<UINT>(View->ViewRect.Height());
+	TileLightCuller->CullDecals(DecalSpheres, View->ViewMatrix, View->ProjectionMatrix, View->NearClip, View->FarClip, ViewportWidth, ViewportHeight);
+	DecalResources->UpdateDecalInfos(DecalInfos);
 
-		// --- 데칼 렌더 시간 측정 시작 ---
-		auto CpuTimeStart = std::chrono::high_resolution_clock::now();
+	FDecalStatManager::GetInstance().AddClusterBinning(TileLightCuller->GetNumBinnedDecals(), TileLightCuller->GetNumDecalClusterEntries(), TileLightCuller->GetNumDecalLitClusters());
 
-		// 데칼 전용 상수 버퍼 설정
-		const FMatrix DecalMatrix = Decal->GetDecalProjectionMatrix();
-		RHIDevice->SetAndUpdateConstantBuffer(DecalBufferType(DecalMatrix, Decal->GetOpacity()));
+	// 3. 처음 쓰는 텍스처를 아틀라스로 복사 (렌더 타겟/뷰포트가 바뀌므로 뷰 상태 복구)
+	if (DecalResources->FlushTextureUploads())
+	{
+		D3D11_VIEWPORT Vp = {};
+		Vp.TopLeftX = (float)View->ViewRect.MinX;
+		Vp.TopLeftY = (float)View->ViewRect.MinY;
+		Vp.Width = (float)View->ViewRect.Width();
+		Vp.Height = (float)View->ViewRect.Height();
+		Vp.MinDepth = 0.0f;
+		Vp.MaxDepth = 1.0f;
+		RHIDevice->GetDeviceContext()->RSSetViewports(1, &Vp);
 
-		// 3. TargetPrimitive 순회하며 수집 후 렌더링
-		MeshBatchElements.Empty();
-		for (UPrimitiveComponent* Target : TargetPrimitives)
-		{
-			Target->CollectMeshBatches(MeshBatchElements, View);
-		}
-		for (FMeshBatchElement& BatchElement : MeshBatchElements)
-		{
-			BatchElement.InstanceShaderResourceView = Decal->GetDecalTexture()->GetShaderResourceView();
-			BatchElement.Material = Decal->GetMaterial(0);
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.VertexStride = sizeof(FVertexDynamic);
-		}
-		DrawMeshBatches(MeshBatchElements, true);
+		FViewportConstants ViewConstData;
+		ViewConstData.ViewportRect = FVector4(Vp.TopLeftX, Vp.TopLeftY, Vp.Width, Vp.Height);
+		ViewConstData.ScreenSize.X = static_cast<float>(RHIDevice->GetViewportWidth());
+		ViewConstData.ScreenSize.Y = static_cast<float>(RHIDevice->GetViewportHeight());
+		ViewConstData.ScreenSize.Z = 1.0f / RHIDevice->GetViewportWidth();
+		ViewConstData.ScreenSize.W = 1.0f / RHIDevice->GetViewportHeight();
+		RHIDevice->SetAndUpdateConstantBuffer((FViewportConstants)ViewConstData);
+	}
+	FDecalStatManager::GetInstance().AddAtlasUsage(DecalResources->GetNumUsedSlices(), DecalResources->GetNumUploadsThisPass());
 
-		// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
-		auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
-		std::chrono::duration<double, std::milli> CpuTimeMs = CpuTimeEnd - CpuTimeStart;
-		FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += CpuTimeMs.count(); // CPU 소요 시간 저장
+	ID3D11ShaderResourceView* DecalIndexSRV = TileLightCuller->GetDecalIndexBufferSRV();
+	ID3D11ShaderResourceView* DepthSRV = RHIDevice->GetSRV(RHI_SRV_Index::SceneDepth);
+	if (!DecalIndexSRV || !DepthSRV || !RHIDevice->GetIdBufferSRV() || !DecalResources->GetDecalInfoSRV() || !DecalResources->GetAtlasSRV())
+	{
+		RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
+		FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += DecalCounter.Finish();
+		return;
 	}
 
-	// 상태 복구
+	// 4. 화면 공간 패스 한 번으로 모든 데칼 적용 (깊이를 읽으므로 깊이 버퍼 없이 Scene Color에만 그림)
+	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithoutDepth);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::Always);
+	RHIDevice->OMSetBlendState(true);
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
+
+	FDecalClusterBufferType DecalClusterBuffer = {};
+	DecalClusterBuffer.TileSize = TileLightCuller->GetTileSize();
+	DecalClusterBuffer.TileCountX = TileLightCuller->GetTileCountX();
+	DecalClusterBuffer.TileCountY = TileLightCuller->GetTileCountY();
+	DecalClusterBuffer.ClusterCountZ = TileLightCuller->GetClusterCountZ();
+	DecalClusterBuffer.ViewportStartX = View->ViewRect.MinX;
+	DecalClusterBuffer.ViewportStartY = View->ViewRect.MinY;
+	DecalClusterBuffer.ClusterDepthScale = TileLightCuller->GetDepthSliceScale();
+	DecalClusterBuffer.ClusterDepthBias = TileLightCuller->GetDepthSliceBias();
+	DecalClusterBuffer.ViewportSize = FVector2D(static_cast<float>(ViewportWidth), static_cast<float>(ViewportHeight));
+	DecalClusterBuffer.DecalCount = static_cast<uint32>(DecalInfos.Num());
+	RHIDevice->SetAndUpdateConstantBuffer(DecalClusterBuffer);
+	RHIDevice->PSSetUVScrollConstantBuffer();
+
+	ID3D11DeviceContext* Context = RHIDevice->GetDeviceContext();
+	ID3D11ShaderResourceView* TextureSRVs[3] = { DecalResources->GetAtlasSRV(), DepthSRV, RHIDevice->GetIdBufferSRV() };
+	ID3D11ShaderResourceView* ClusterSRVs[2] = { DecalIndexSRV, DecalResources->GetDecalInfoSRV() };
+	Context->PSSetShaderResources(0, 3, TextureSRVs);
+	Context->PSSetShaderResources(6, 2, ClusterSRVs);
+	// UV 스크롤로 0~1을 벗어난 좌표는 슬라이스 안에서 반복되도록 Wrap 샘플러 사용
+	RHIDevice->PSSetDefaultSampler(0);
+
+	Context->IASetInputLayout(nullptr);
+	Context->VSSetShader(DecalVS, nullptr, 0);
+	Context->PSSetShader(DecalPS, nullptr, 0);
+	RHIDevice->DrawFullScreenQuad();
+
+	// 상태 복구 (깊이/ID SRV를 풀어야 깊이 버퍼와 ID 타겟을 다시 바인딩할 수 있음)
+	ID3D11ShaderResourceView* NullSRVs[3] = { nullptr, nullptr, nullptr };
+	Context->PSSetShaderResources(0, 3, NullSRVs);
+	Context->PSSetShaderResources(6, 2, NullSRVs);
+	RHIDevice->PSSetDefaultSampler(0);
+	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 	RHIDevice->OMSetBlendState(false);
+
+	FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += DecalCounter.Finish();
 }
 
 void FSceneRenderer::RenderPostProcessingPasses()
@@ -1823,231 +2109,34 @@ void FSceneRenderer::RenderCanvasOverlays()
 	Canvas.Flush();
 }
 
-// 수집한 Batch 그리기
-void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+const TArray<uint32>& FSceneRenderer::SortMeshBatches(const TArray<FMeshBatchElement>& InMeshBatches)
 {
-	if (InMeshBatches.IsEmpty()) return;
-
-	// RHI 상태 초기 설정 (Opaque Pass 기본값)
-	//RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
+	FMeshDrawSorter* Sorter = OwnerRenderer->GetMeshDrawSorter();
 
-	// PS 리소스 초기화
-	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, nullSRVs);
-	ID3D11SamplerState* nullSamplers[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 2, nullSamplers);
-	FPixelConstBufferType DefaultPixelConst{};
-	RHIDevice->SetAndUpdateConstantBuffer(DefaultPixelConst);
-
-	// 현재 GPU 상태 캐싱용 변수 (UStaticMesh* 대신 실제 GPU 리소스로 변경)
-	ID3D11VertexShader* CurrentVertexShader = nullptr;
-	ID3D11PixelShader* CurrentPixelShader = nullptr;
-	UMaterialInterface* CurrentMaterial = nullptr;
-	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr; // [추가] Instance SRV 캐시
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	UINT CurrentVertexStride = 0;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
-
-	// 기본 샘플러 미리 가져오기 (루프 내 반복 호출 방지)
-	ID3D11SamplerState* DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
-	// Shadow PCF용 샘플러 추가
-	ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
-	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
+	FScopeCycleCounter SortCounter;
+	const TArray<uint32>& DrawOrder = Sorter->Sort(InMeshBatches, View->ViewLocation);
+	const double SortTimeMS = SortCounter.Finish();
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	if (!InMeshBatches.IsEmpty() && UStatsOverlayD2D::Get().IsDrawSortVisible())
 	{
-		// --- 필수 요소 유효성 검사 ---
-		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
-		{
-			// 셰이더나 버퍼, 스트라이드 정보가 없으면 그릴 수 없음
-			//UE_LOG("[%s] 머티리얼에 셰더가 컴파일에 실패했거나 없습니다!", Batch.Material->GetFilePath().c_str());	// NOTE: 로그가 매 프레임 떠서 셰이더 컴파일 에러 로그를 볼 수 없어서 주석 처리
-			continue;
-		}
-
-		// 1. 셰이더 상태 변경
-		if (Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
-		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(Batch.InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(Batch.VertexShader, nullptr, 0);
-
-			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
-
-			CurrentVertexShader = Batch.VertexShader;
-			CurrentPixelShader = Batch.PixelShader;
-		}
-
-		// --- 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (캐싱됨) ---
-		//
-		// 'Material' 또는 'Instance SRV' 둘 중 하나라도 바뀌면
-		// 모든 픽셀 리소스를 다시 바인딩해야 합니다.
-		if ( Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
-		{
-			ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr; // t0
-			ID3D11ShaderResourceView* NormalTextureSRV = nullptr;  // t1
-			FPixelConstBufferType PixelConst{};
-
-			if (Batch.Material)
-			{
-				PixelConst.Material = Batch.Material->GetMaterialInfo();
-				PixelConst.bHasMaterial = true;
-			}
-			else
-			{
-				FMaterialInfo DefaultMaterialInfo;
-				PixelConst.Material = DefaultMaterialInfo;
-				PixelConst.bHasMaterial = false;
-				PixelConst.bHasDiffuseTexture = false;
-				PixelConst.bHasNormalTexture = false;
-			}
-
-			// 1순위: 인스턴스 텍스처 (빌보드)
-			if (Batch.InstanceShaderResourceView)
-			{
-				DiffuseTextureSRV = Batch.InstanceShaderResourceView;
-				PixelConst.bHasDiffuseTexture = true;
-				PixelConst.bHasNormalTexture = false;
-			}
-			// 2순위: 머티리얼 텍스처 (스태틱 메시)
-			else if (Batch.Material)
-			{
-				const FMaterialInfo& MaterialInfo = Batch.Material->GetMaterialInfo();
-				if (!MaterialInfo.DiffuseTextureFileName.empty())
-				{
-					if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Diffuse))
-					{
-						DiffuseTextureSRV = TextureData->GetShaderResourceView();
-						PixelConst.bHasDiffuseTexture = (DiffuseTextureSRV != nullptr);
-					}
-				}
-				if (!MaterialInfo.NormalTextureFileName.empty())
-				{
-					if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Normal))
-					{
-						NormalTextureSRV = TextureData->GetShaderResourceView();
-						PixelConst.bHasNormalTexture = (NormalTextureSRV != nullptr);
-					}
-				}
-			}
-
-			// --- RHI 상태 업데이트 ---
-			// 1. 텍스처(SRV) 바인딩
-			ID3D11ShaderResourceView* Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
-			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, Srvs);
-
-			// 2. 샘플러 바인딩
-			ID3D11SamplerState* Samplers[4] = { DefaultSampler, DefaultSampler, ShadowSampler, VSMSampler };
-		 RHIDevice->GetDeviceContext()->PSSetSamplers(0, 4, Samplers);
-
-			// 3. 재질 CBuffer 바인딩
-			RHIDevice->SetAndUpdateConstantBuffer(PixelConst);
-
-			// --- 캐시 업데이트 ---
-			CurrentMaterial = Batch.Material;
-			CurrentInstanceSRV = Batch.InstanceShaderResourceView;
-		}
-
-		// 3. IA (Input Assembler) 상태 변경
-		if (Batch.VertexBuffer != CurrentVertexBuffer ||
-			Batch.IndexBuffer != CurrentIndexBuffer ||
-			Batch.VertexStride != CurrentVertexStride ||
-			Batch.PrimitiveTopology != CurrentTopology)
-		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-
-			// Vertex/Index 버퍼 바인딩
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-			// 토폴로지 설정 (이전 코드의 5번에서 이동하여 최적화)
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-			// 현재 IA 상태 캐싱
-			CurrentVertexBuffer = Batch.VertexBuffer;
-			CurrentIndexBuffer = Batch.IndexBuffer;
-			CurrentVertexStride = Batch.VertexStride;
-			CurrentTopology = Batch.PrimitiveTopology;
-		}
-
-		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
-
-		if (Batch.SkinningMatrices)
-		{
-			TIME_PROFILE(SKINNING_CPU_TASK)
-
-			void* pMatrixData = (void*)Batch.SkinningMatrices->GetData();
-			size_t MatrixDataSize = Batch.SkinningMatrices->Num() * sizeof(FMatrix);
-
-			constexpr size_t MaxCBufferSize = sizeof(FSkinningBuffer); // 16384
-			if (MatrixDataSize > MaxCBufferSize)
-			{
-				MatrixDataSize = MaxCBufferSize;
-			}
-
-			RHIDevice->SetAndUpdateConstantBuffer_Pointer_FSkinningBuffer(pMatrixData, MatrixDataSize);
-		}
-
-		// Cloth binding (VS b6 for CB, t8 for SRV)
-		if (Batch.bClothEnabled && Batch.ClothSRV)
-		{
-			RHIDevice->SetAndUpdateConstantBuffer(ClothBufferType(1u, Batch.ClothMode, Batch.ClothBaseVertexIndex));
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(8, 1, &Batch.ClothSRV);
-		}
-		else
-		{
-			ID3D11ShaderResourceView* NullSRV[1] = { nullptr };
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(8, 1, NullSRV);
-			RHIDevice->SetAndUpdateConstantBuffer(ClothBufferType(0u, 0u, 0u));
-		}
+		// 수집 순서 대비 줄인 상태 변경 수 (포인터 비교만 하는 순회 두 번, 통계를 볼 때만)
+		const FMeshDrawStateChanges UnsortedChanges = FMeshDrawSorter::CountStateChanges(InMeshBatches, nullptr);
+		const FMeshDrawStateChanges SortedChanges = FMeshDrawSorter::CountStateChanges(InMeshBatches, &DrawOrder);
+		FDrawSortStatManager::GetInstance().AddSortResult(static_cast<uint32>(InMeshBatches.Num()), UnsortedChanges, SortedChanges, SortTimeMS);
+	}
 
-		// 5. Sky 전용 렌더링 상태 설정
-		if (Batch.bIsSky)
-		{
-			// 깊이 테스트 비활성화 (Sky는 항상 가장 뒤에 렌더링)
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::Always);
-			// Backface Culling 비활성화 (Inside-Facing Sphere)
-			RHIDevice->RSSetState(ERasterizerMode::Solid_NoCull);
-			// Sky 상수 버퍼 (b9) 설정
-			if (Batch.SkyParams)
-			{
-				RHIDevice->SetAndUpdateConstantBuffer(*Batch.SkyParams);
-			}
-		}
+	return DrawOrder;
+}
 
-		// 6. 인스턴스 버퍼가 있으면 DrawIndexedInstanced 사용
-		if (Batch.InstanceBuffer != nullptr && Batch.InstanceCount > 0)
-		{
-			// 인스턴스 버퍼를 슬롯 1에 바인딩 (메시 정점은 슬롯 0)
-			UINT InstanceStride = Batch.InstanceStride;
-			UINT InstanceOffset = 0;
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(1, 1, &Batch.InstanceBuffer, &InstanceStride, &InstanceOffset);
-
-			// 인스턴스드 드로우 콜
-			RHIDevice->GetDeviceContext()->DrawIndexedInstanced(
-				Batch.IndexCount,
-				Batch.InstanceCount,
-				Batch.StartIndex,
-				Batch.BaseVertexIndex,
-				0 // StartInstanceLocation
-			);
-		}
-		else
-		{
-			// 일반 드로우 콜
-			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
-		}
+// 수집한 Batch 그리기
+void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<uint32>* InDrawOrder)
+{
+	if (InMeshBatches.IsEmpty()) return;
 
-		// Sky 렌더링 후 상태 복원
-		if (Batch.bIsSky)
-		{
-			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
-			RHIDevice->RSSetState(ERasterizerMode::Solid);
-		}
-	}
+	// 정렬된 순서(인덱스 목록)가 있으면 그 순서로, 없으면 수집 순서로 워커 스레드에서 기록한 뒤 순서대로 실행
+	FMeshDrawCommandRecorder* CommandRecorder = OwnerRenderer->GetMeshDrawCommandRecorder();
+	CommandRecorder->RecordMeshBatches(InMeshBatches, InDrawOrder, GetMeshDrawRecordParams());
+	CommandRecorder->Execute(*OwnerRenderer->GetRHICommandContext());
 
 	// 루프 종료 후 리스트 비우기 (옵션)
 	if (bClearListAfterDraw)
@@ -2056,6 +2145,16 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	}
 }
 
+FMeshDrawRecordParams FSceneRenderer::GetMeshDrawRecordParams() const
+{
+	FMeshDrawRecordParams RecordParams;
+	RecordParams.DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
+	// Shadow PCF용 샘플러 추가
+	RecordParams.ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
+	RecordParams.VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
+	return RecordParams;
+}
+
 void FSceneRenderer::RenderGridLinesPass()
 {
 	RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTarget);
@@ -1,5 +1,7 @@
 #pragma once
 #include "Frustum.h"
+#include "SceneProxyCollector.h"
+#include "MeshInstancing.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -22,6 +24,7 @@ class UDirectionalLightComponent;
 class UPointLightComponent;
 class USpotLightComponent;
 struct FMeshBatchElement;
+struct FMeshDrawRecordParams;
 class UMeshComponent;
 class USkinnedMeshComponent;
 class UBillboardComponent;
@@ -35,41 +38,6 @@ class FGPUTimer;
 
 struct FCandidateDrawable;
 
-// 렌더링할 대상들의 집합을 담는 구조체
-struct FVisibleRenderProxySet
-{
-	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
-	TArray<UMeshComponent*> Meshes;
-	TArray<USkinnedMeshComponent*> SkinnedMeshes;
-	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
-	TArray<UDecalComponent*> Decals;
-	TArray<UTextRenderComponent*> Texts;
-
-	// --- Type 2: In-Scene Editor (PP X, Depth-Test O) ---
-	TArray<ULineComponent*> EditorLines;	// 그리드
-	TArray<UPrimitiveComponent*> EditorPrimitives; // 빛 기즈모, *에디터 아이콘 빌보드*
-
-	// --- Type 3: Overlay (PP X, Depth-Test X) ---
-	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
-
-	TArray<UParticleSystemComponent*> Particles;
-};
-
-struct FSceneLocals
-{
-	TArray<UPointLightComponent*> PointLights;
-	TArray<USpotLightComponent*> SpotLights;
-};
-
-// NOTE: 추후 UWorld로 이동해서 등록/해지 방식으로 변경?
-// 전역 효과 및 설정을 담는 구조체
-struct FSceneGlobals
-{
-	TArray<UDirectionalLightComponent*> DirectionalLights;
-	TArray<UAmbientLightComponent*> AmbientLights;
-	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
-};
-
 /**
  * @class FSceneRenderer
  * @brief 한 프레임의 특정 뷰(View)에 대한 씬 렌더링을 총괄하는 임시(transient) 클래스.
@@ -101,9 +69,12 @@ private:
 	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
 	void PerformFrustumCulling();
 
-	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
+	/** @brief 월드 단위로 공유되는 프록시 목록(FSceneProxyCollector)을 이 뷰의 렌더링 대상으로 가져옵니다. */
 	void GatherVisibleProxies();
 
+	/** @brief 저폴리 오클루더를 CPU 깊이 버퍼에 래스터화하여 가려진 메시를 수집 목록에서 제거합니다. */
+	void PerformOcclusionCulling();
+
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
@@ -113,7 +84,21 @@ private:
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
-	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	/**
+	 * @brief 배치 목록을 64비트 정렬 키로 기수 정렬하고 그리기 순서를 반환합니다.
+	 * @details 상태 변경 수 비교(DrawSort 통계)는 stat drawsort가 켜져 있을 때만 계산합니다.
+	 * @return InMeshBatches 인덱스 목록, 다음 정렬 전까지 유효 (URenderer의 정렬기 버퍼)
+	 */
+	const TArray<uint32>& SortMeshBatches(const TArray<FMeshBatchElement>& InMeshBatches);
+
+	/**
+	 * @brief 수집한 배치를 그립니다.
+	 * @param InDrawOrder SortMeshBatches가 반환한 그리기 순서 (nullptr이면 수집 순서)
+	 */
+	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, const TArray<uint32>* InDrawOrder = nullptr);
+
+	// 메시 배치 기록에 쓰는 샘플러 (기록 중 RHIDevice에 접근하지 않도록 미리 가져옴)
+	FMeshDrawRecordParams GetMeshDrawRecordParams() const;
 
 	void RenderGridLinesPass();
 
@@ -3,6 +3,7 @@
 #include "CameraActor.h"
 #include "FViewport.h"
 #include "Frustum.h"
+#include "Shader.h"
 
 FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InRenderSettings)
 	: RenderSettings(InRenderSettings)
@@ -42,6 +43,7 @@ FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InR
 	);
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderMacroKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings)
@@ -80,6 +82,7 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 	ProjectionMode = InCamera->GetProjectionMode();
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewShaderMacroKey = UShader::GenerateShaderKey(ViewShaderMacros);
 }
 
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
@@ -9,6 +9,7 @@
 class ACameraActor;
 class UCameraComponent;
 class FViewport;
+class FSceneViewState;
 struct FPostProcessModifier;
 
 /**
@@ -72,6 +73,7 @@ public:
     // 렌더링 설정
     ECameraProjectionMode ProjectionMode = ECameraProjectionMode::Perspective;
     TArray<FShaderMacro> ViewShaderMacros;
+    uint64 ViewShaderMacroKey = 0;  // UShader::GenerateShaderKey(ViewShaderMacros), 캐시된 드로우 커맨드의 키
     float NearClip = 0.0f;
     float FarClip = 0.0f;
     float FieldOfView = 0.0f;
@@ -80,4 +82,7 @@ public:
     float OrthoZoom = 0.1f;  // Orthographic 줌 레벨 (픽셀당 월드 유닛)
 
     TArray<FPostProcessModifier> Modifiers;
+
+    // 프레임 간 유지되는 뷰 상태 (FViewport 소유, 없으면 캐시 없이 매 프레임 컬링)
+    FSceneViewState* ViewState = nullptr;
 };
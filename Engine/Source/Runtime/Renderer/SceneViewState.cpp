@@ -0,0 +1,68 @@
+#include "pch.h"
+#include "SceneViewState.h"
+#include "Occlusion.h"
+
+FSceneViewState::FSceneViewState()
+{
+	OcclusionCuller = new FOcclusionCullingManagerCPU();
+}
+
+FSceneViewState::~FSceneViewState()
+{
+	if (OcclusionCuller)
+	{
+		delete OcclusionCuller;
+		OcclusionCuller = nullptr;
+	}
+}
+
+bool FSceneViewState::CanReuseVisibility(const UWorld* InWorld, const FMatrix& InViewProj, int32 InViewWidth, int32 InViewHeight) const
+{
+	if (!bVisibilityValid || CachedWorld != InWorld
+		|| CachedViewWidth != InViewWidth || CachedViewHeight != InViewHeight)
+	{
+		return false;
+	}
+
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Col = 0; Col < 4; ++Col)
+		{
+			if (std::fabs(InViewProj.M[Row][Col] - CachedViewProj.M[Row][Col]) > CameraMoveThreshold)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void FSceneViewState::BeginVisibilityCache(const UWorld* InWorld, const FMatrix& InViewProj, int32 InViewWidth, int32 InViewHeight)
+{
+	CachedVisibility.Empty();
+	CachedOccluders.Empty();
+
+	bVisibilityValid = true;
+	CachedWorld = InWorld;
+	CachedViewProj = InViewProj;
+	CachedViewWidth = InViewWidth;
+	CachedViewHeight = InViewHeight;
+}
+
+void FSceneViewState::InvalidateVisibility()
+{
+	bVisibilityValid = false;
+	CachedWorld = nullptr;
+	CachedVisibility.Empty();
+	CachedOccluders.Empty();
+}
+
+void FSceneViewState::SetMeshLOD(UPrimitiveComponent* Component, int32 LODIndex)
+{
+	if (CachedMeshLODs.Num() >= MaxCachedMeshLODs && !CachedMeshLODs.Find(Component))
+	{
+		// 비운 직후 한 프레임은 히스테리시스 없이 화면 크기만으로 고름
+		CachedMeshLODs.Empty();
+	}
+	CachedMeshLODs.Add(Component, LODIndex);
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Vector.h" // FMatrix
+#include "OcclusionStats.h"
+
+class UWorld;
+class UPrimitiveComponent;
+class FOcclusionCullingManagerCPU;
+
+// 캐시된 프리미티브 가시성 (오클루전 컬링 결과)
+enum class ECachedVisibility : uint8
+{
+	Visible,
+	Occluded,
+	Offscreen,
+};
+
+/**
+ * @brief 프레임 간 유지되는 뷰별 상태 (UE의 FSceneViewState 대응)
+ * @details FSceneView는 매 프레임 스택에 생성되므로, 프레임을 넘어 유지되어야 하는 데이터는
+ * FViewport가 소유한 이 객체에 둔다.
+ *
+ * 가시성 캐시:
+ * 카메라가 정지해 있으면 마지막 깊이 버퍼와 컬링 결과를 재사용하고,
+ * UWorldPartitionManager의 변경 기록에 남은 컴포넌트만 다시 판정한다.
+ * 카메라가 임계값 이상 움직였거나, 월드가 바뀌었거나, 오클루더가 움직이면 전체 재컬링한다.
+ */
+class FSceneViewState
+{
+public:
+	FSceneViewState();
+	~FSceneViewState();
+
+	FSceneViewState(const FSceneViewState&) = delete;
+	FSceneViewState& operator=(const FSceneViewState&) = delete;
+
+	// 이 뷰 전용 오클루전 컬러 (깊이 버퍼가 다음 프레임까지 유지됨)
+	FOcclusionCullingManagerCPU* GetOcclusionCuller() const { return OcclusionCuller; }
+
+	/**
+	 * @brief 마지막 전체 컬링 결과를 이번 프레임에 재사용할 수 있는지
+	 * @details 같은 월드, 같은 뷰 크기이고 ViewProj 행렬 원소 차이가 CameraMoveThreshold 이하일 때만 true
+	 */
+	bool CanReuseVisibility(const UWorld* InWorld, const FMatrix& InViewProj, int32 InViewWidth, int32 InViewHeight) const;
+
+	// 전체 컬링 직후 호출, 기존 캐시를 버리고 이번 컬링의 기준 정보를 기록
+	void BeginVisibilityCache(const UWorld* InWorld, const FMatrix& InViewProj, int32 InViewWidth, int32 InViewHeight);
+	void InvalidateVisibility();
+
+	// 가시성 변경 기록을 어디까지 반영했는지 (UWorldPartitionManager::GetVisibilityRevision 기준)
+	uint64 GetVisibilityRevision() const { return VisibilityRevision; }
+	void SetVisibilityRevision(uint64 InRevision) { VisibilityRevision = InRevision; }
+
+	// --- 프리미티브별 캐시 ---
+	const ECachedVisibility* FindVisibility(UPrimitiveComponent* Component) const { return CachedVisibility.Find(Component); }
+	void SetVisibility(UPrimitiveComponent* Component, ECachedVisibility Visibility) { CachedVisibility.Add(Component, Visibility); }
+	void ForgetVisibility(UPrimitiveComponent* Component) { CachedVisibility.Remove(Component); }
+	int32 GetNumCachedVisibility() const { return CachedVisibility.Num(); }
+
+	// 깊이 버퍼에 래스터화된 오클루더 (움직이면 깊이 버퍼 자체가 무효)
+	void AddOccluder(UPrimitiveComponent* Component) { CachedOccluders.Add(Component); }
+	bool IsOccluder(UPrimitiveComponent* Component) const { return CachedOccluders.Contains(Component); }
+	int32 GetNumOccluders() const { return CachedOccluders.Num(); }
+
+	// 마지막 전체 컬링 통계 (캐시 재사용 프레임에서 오클루더/깊이 버퍼 정보 표시용)
+	const FOcclusionStats& GetOcclusionStats() const { return LastFullCullStats; }
+	void SetOcclusionStats(const FOcclusionStats& InStats) { LastFullCullStats = InStats; }
+
+	// --- 메시 LOD (화면 크기 히스테리시스 기준이 되는 직전 LOD) ---
+	int32 FindMeshLOD(UPrimitiveComponent* Component) const { const int32* LODIndex = CachedMeshLODs.Find(Component); return LODIndex ? *LODIndex : -1; }
+	void SetMeshLOD(UPrimitiveComponent* Component, int32 LODIndex);
+
+	// 카메라 정지 판정 임계값 (ViewProj 행렬 원소의 최대 절대 차이)
+	static constexpr float CameraMoveThreshold = 1e-4f;
+
+private:
+	FOcclusionCullingManagerCPU* OcclusionCuller = nullptr;
+
+	// 마지막 전체 컬링 기준
+	bool bVisibilityValid = false;
+	const UWorld* CachedWorld = nullptr;
+	FMatrix CachedViewProj{};
+	int32 CachedViewWidth = 0;
+	int32 CachedViewHeight = 0;
+	uint64 VisibilityRevision = 0;
+
+	// 키는 비교용으로만 사용하고 역참조하지 않음 (제거된 컴포넌트는 변경 기록을 통해 지워짐)
+	TMap<UPrimitiveComponent*, ECachedVisibility> CachedVisibility;
+	TSet<UPrimitiveComponent*> CachedOccluders;
+	FOcclusionStats LastFullCullStats;
+
+	// 키는 비교용으로만 사용 (제거된 컴포넌트 항목은 MaxCachedMeshLODs를 넘으면 한꺼번에 비움)
+	static constexpr int32 MaxCachedMeshLODs = 65536;
+	TMap<UPrimitiveComponent*, int32> CachedMeshLODs;
+};
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Shader.h"
 #include "Hash.h"
+#include "CachedMeshDrawCommand.h"
 
 IMPLEMENT_CLASS(UShader)
 
@@ -399,6 +400,10 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 		{
 			FinalKey += "#PARTICLE_BEAM";
 		}
+		else if (Macro.Name == "MESH_INSTANCING" && Macro.Definition == "1")
+		{
+			FinalKey += "#MESH_INSTANCING";
+		}
 	}
 
 	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = UResourceManager::GetInstance().GetProperInputLayout(FinalKey);
@@ -516,6 +521,9 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 	UE_LOG("Hot Reloading Shader File: %s (%d variants)", FilePath.c_str(), ShaderVariantMap.Num());
 
+	// 기존 변형의 VS/PS/InputLayout은 성공/실패와 관계없이 교체되므로 캐시된 드로우 커맨드를 모두 무효화
+	FCachedMeshDrawCommandSet::InvalidateAll();
+
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
 	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
@@ -0,0 +1,544 @@
+#include "pch.h"
+#include "ShadowAtlasAllocator.h"
+#include "LightManager.h"
+#include "ShadowStats.h"
+#include "SceneView.h"
+#include "Frustum.h"
+#include "DirectionalLightComponent.h"
+
+// ─────────────── 스카이라인 패커
+
+void FSkylinePacker::Reset(uint32 InWidth, uint32 InHeight)
+{
+	AtlasWidth = InWidth;
+	AtlasHeight = InHeight;
+	Skyline.Empty();
+	if (AtlasWidth > 0)
+	{
+		Skyline.Add({ 0, 0, AtlasWidth });
+	}
+}
+
+bool FSkylinePacker::FindBaseline(int32 Index, uint32 Width, uint32& OutY) const
+{
+	if (Skyline[Index].X + Width > AtlasWidth)
+	{
+		return false;
+	}
+
+	// Width만큼 덮는 구간들 중 가장 높은 곳에 바닥을 맞춤
+	uint32 Baseline = 0;
+	uint32 Covered = 0;
+	for (int32 SegmentIndex = Index; SegmentIndex < Skyline.Num() && Covered < Width; ++SegmentIndex)
+	{
+		Baseline = std::max(Baseline, Skyline[SegmentIndex].Y);
+		Covered += Skyline[SegmentIndex].Width;
+	}
+
+	OutY = Baseline;
+	return true;
+}
+
+bool FSkylinePacker::Insert(uint32 Width, uint32 Height, uint32& OutX, uint32& OutY)
+{
+	if (Width == 0 || Height == 0 || Width > AtlasWidth || Height > AtlasHeight)
+	{
+		return false;
+	}
+
+	// 가장 낮은 자리, 같으면 가장 왼쪽 (구간은 X 오름차순)
+	int32 BestIndex = -1;
+	uint32 BestY = UINT32_MAX;
+	for (int32 Index = 0; Index < Skyline.Num(); ++Index)
+	{
+		uint32 Y = 0;
+		if (FindBaseline(Index, Width, Y) && Y + Height <= AtlasHeight && Y < BestY)
+		{
+			BestIndex = Index;
+			BestY = Y;
+		}
+	}
+	if (BestIndex < 0)
+	{
+		return false;
+	}
+
+	OutX = Skyline[BestIndex].X;
+	OutY = BestY;
+
+	// 새 구간을 끼우고, 그 아래에 가려진 구간은 지우거나 오른쪽으로 줄임
+	const uint32 NewEnd = OutX + Width;
+	Skyline.insert(Skyline.begin() + BestIndex, FSegment{ OutX, BestY + Height, Width });
+	for (int32 Index = BestIndex + 1; Index < Skyline.Num();)
+	{
+		FSegment& Segment = Skyline[Index];
+		if (Segment.X >= NewEnd)
+		{
+			break;
+		}
+
+		const uint32 SegmentEnd = Segment.X + Segment.Width;
+		if (SegmentEnd <= NewEnd)
+		{
+			Skyline.erase(Skyline.begin() + Index);
+			continue;
+		}
+
+		Segment.Width = SegmentEnd - NewEnd;
+		Segment.X = NewEnd;
+		break;
+	}
+
+	// 높이가 같은 이웃 구간 병합
+	for (int32 Index = 0; Index + 1 < Skyline.Num();)
+	{
+		if (Skyline[Index].Y == Skyline[Index + 1].Y)
+		{
+			Skyline[Index].Width += Skyline[Index + 1].Width;
+			Skyline.erase(Skyline.begin() + Index + 1);
+		}
+		else
+		{
+			++Index;
+		}
+	}
+	return true;
+}
+
+// ─────────────── 2D 아틀라스 할당
+
+namespace
+{
+	// 영역 식별자: 라이트 + 서브뷰(캐스케이드) + 뷰 (뷰마다 화면 점유율이 달라 히스테리시스를 따로 둠)
+	uint64 MakeRegionKey(const ULightComponent* Light, int32 SubViewIndex, const void* ViewIdentity)
+	{
+		uint64 Key = reinterpret_cast<uint64>(Light) * 31ull + static_cast<uint64>(SubViewIndex);
+		Key ^= reinterpret_cast<uint64>(ViewIdentity) + 0x9e3779b97f4a7c15ull + (Key << 6) + (Key >> 2);
+		return Key;
+	}
+
+	// 2D 아틀라스 텍셀당 바이트 (R24G8 뎁스 + R32G32 VSM), 큐브맵은 뎁스만
+	constexpr uint64 BytesPerTexel2D = 4 + 8;
+	constexpr uint64 BytesPerTexelCube = 4;
+}
+
+void FShadowAtlasAllocator::Initialize(uint32 InAtlasSize)
+{
+	AtlasSize = InAtlasSize;
+	PreviousLevels.Empty();
+	PreviousPlacementsByView.Empty();
+}
+
+float FShadowAtlasAllocator::ComputeScreenCoverage(const FSceneView* View, const FFrustum& ViewFrustum, const FVector& Center, float Radius)
+{
+	if (!View || Radius <= 0.0f)
+	{
+		return 1.0f;
+	}
+
+	// 영향 범위가 화면 밖이면 그림자를 받는 픽셀이 없음
+	const FVector Extent(Radius, Radius, Radius);
+	if (!IsAABBVisible(ViewFrustum, FAABB(Center - Extent, Center + Extent)))
+	{
+		return 0.0f;
+	}
+
+	const float ProjectionScale = std::max(View->ProjectionMatrix.M[0][0], View->ProjectionMatrix.M[1][1]);
+	if (View->ProjectionMode != ECameraProjectionMode::Perspective)
+	{
+		return std::clamp(Radius * ProjectionScale, 0.0f, 1.0f);
+	}
+
+	const float DistanceSquared = (Center - View->ViewLocation).SizeSquared();
+	const float RadiusSquared = Radius * Radius;
+	if (DistanceSquared <= RadiusSquared)
+	{
+		return 1.0f;
+	}
+
+	// 구의 투영 반지름 ≈ r / sqrt(d² - r²)
+	return std::clamp(Radius * ProjectionScale / std::sqrt(DistanceSquared - RadiusSquared), 0.0f, 1.0f);
+}
+
+int32 FShadowAtlasAllocator::PackCandidates(TArray<FCandidate>& Candidates, TArray<FPlacement>& PreviousPlacements, bool& bOutRepacked)
+{
+	std::sort(Candidates.begin(), Candidates.end(), [](const FCandidate& A, const FCandidate& B)
+	{
+		const uint32 SizeA = A.GetSize();
+		const uint32 SizeB = B.GetSize();
+		return SizeA != SizeB ? SizeA > SizeB : A.RegionKey < B.RegionKey;
+	});
+
+	// 입력(키, 크기)이 지난번과 같으면 지난 자리를 그대로 사용
+	bool bSameInput = Candidates.Num() == PreviousPlacements.Num();
+	for (int32 Index = 0; bSameInput && Index < Candidates.Num(); ++Index)
+	{
+		bSameInput = Candidates[Index].RegionKey == PreviousPlacements[Index].RegionKey
+			&& Candidates[Index].GetSize() == PreviousPlacements[Index].Size;
+	}
+	if (bSameInput)
+	{
+		for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+		{
+			Candidates[Index].bPlaced = true;
+			Candidates[Index].X = PreviousPlacements[Index].X;
+			Candidates[Index].Y = PreviousPlacements[Index].Y;
+		}
+		bOutRepacked = false;
+		return 0;
+	}
+
+	bOutRepacked = true;
+	Packer.Reset(AtlasSize, AtlasSize);
+	int32 NumFailed = 0;
+	for (FCandidate& Candidate : Candidates)
+	{
+		const uint32 Size = Candidate.GetSize();
+		Candidate.bPlaced = Packer.Insert(Size, Size, Candidate.X, Candidate.Y);
+		if (!Candidate.bPlaced)
+		{
+			++NumFailed;
+		}
+	}
+
+	if (NumFailed == 0)
+	{
+		PreviousPlacements.SetNum(Candidates.Num());
+		for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+		{
+			const FCandidate& Candidate = Candidates[Index];
+			PreviousPlacements[Index] = { Candidate.RegionKey, Candidate.GetSize(), Candidate.X, Candidate.Y };
+		}
+	}
+	return NumFailed;
+}
+
+void FShadowAtlasAllocator::Allocate(TArray<FShadowRenderRequest>& InOutRequests, const FSceneView* View, FShadowAtlasUsage& OutUsage)
+{
+	OutUsage.AtlasTexels2D = static_cast<uint64>(AtlasSize) * AtlasSize;
+	OutUsage.UsedTexels2D = 0;
+	OutUsage.Requests2D = static_cast<uint32>(InOutRequests.Num());
+	OutUsage.DegradedRequests2D = 0;
+	OutUsage.EvictedRequests2D = 0;
+	OutUsage.bRepacked2D = false;
+
+	const FFrustum ViewFrustum = View ? CreateFrustumFromViewProjection(View->GetViewProjectionMatrix()) : FFrustum();
+	const void* ViewIdentity = View ? static_cast<const void*>(View->ViewState) : nullptr;
+
+	if (PreviousLevels.Num() > MaxTrackedRegions)
+	{
+		PreviousLevels.Empty();
+	}
+	if (PreviousPlacementsByView.Num() >= MaxTrackedViews && !PreviousPlacementsByView.Contains(ViewIdentity))
+	{
+		PreviousPlacementsByView.Empty();
+	}
+	TArray<FPlacement>& PreviousPlacements = PreviousPlacementsByView[ViewIdentity];
+
+	// 1. 화면 점유율로 요청마다 해상도 단계 결정
+	TArray<FCandidate> Candidates;
+	Candidates.Reserve(InOutRequests.Num());
+	for (int32 RequestIndex = 0; RequestIndex < InOutRequests.Num(); ++RequestIndex)
+	{
+		FShadowRenderRequest& Request = InOutRequests[RequestIndex];
+		if (Request.Size == 0 || AtlasSize == 0)
+		{
+			Request.Size = 0;
+			continue;
+		}
+
+		FCandidate Candidate;
+		Candidate.RequestIndex = RequestIndex;
+		Candidate.RegionKey = MakeRegionKey(Request.LightOwner, Request.SubViewIndex, ViewIdentity);
+		Candidate.RequestedSize = std::min(Request.Size, AtlasSize);
+		while ((Candidate.RequestedSize >> (Candidate.MaxLevel + 1)) >= MinShadowResolution)
+		{
+			++Candidate.MaxLevel;
+		}
+
+		// 방향광 캐스케이드는 화면 전체를 덮음
+		const bool bDirectional = Cast<UDirectionalLightComponent>(Request.LightOwner) != nullptr;
+		Candidate.Importance = bDirectional ? 1.0f : ComputeScreenCoverage(View, ViewFrustum, Request.WorldLocation, Request.Radius);
+
+		if (View)
+		{
+			// 원하는 해상도 비율의 log2를 반올림, 지난 단계와 0.75단계 이내로 차이나면 유지 (경계에서 깜빡임 방지)
+			const float Ratio = std::clamp(Candidate.Importance / FullResolutionCoverage, 1.0f / 1024.0f, 1.0f);
+			const float DesiredLevel = -std::log2(Ratio);
+			int32 Level = static_cast<int32>(std::floor(DesiredLevel + 0.5f));
+			if (const int32* PreviousLevel = PreviousLevels.Find(Candidate.RegionKey))
+			{
+				if (std::abs(DesiredLevel - static_cast<float>(*PreviousLevel)) < 0.75f)
+				{
+					Level = *PreviousLevel;
+				}
+			}
+			Candidate.Level = std::clamp(Level, 0, Candidate.MaxLevel);
+		}
+		Candidates.Add(Candidate);
+	}
+
+	// 중요도가 낮은 순서 (예산 초과 시 이 순서로 낮추고 뺌)
+	TArray<int32> DegradeOrder;
+	DegradeOrder.SetNum(Candidates.Num());
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		DegradeOrder[Index] = Index;
+	}
+	std::stable_sort(DegradeOrder.begin(), DegradeOrder.end(), [&Candidates](int32 A, int32 B)
+	{
+		return Candidates[A].Importance < Candidates[B].Importance;
+	});
+
+	// 2. 면적 예산: 중요도가 낮은 요청부터 한 단계씩 낮춤
+	const uint64 Capacity = static_cast<uint64>(static_cast<double>(OutUsage.AtlasTexels2D) * MaxAtlasFill);
+	auto GetTotalArea = [&Candidates]()
+	{
+		uint64 Area = 0;
+		for (const FCandidate& Candidate : Candidates)
+		{
+			if (Candidate.Level >= 0)
+			{
+				const uint64 Size = Candidate.GetSize();
+				Area += Size * Size;
+			}
+		}
+		return Area;
+	};
+	// 중요도 대비 텍셀이 가장 많은 요청을 한 단계 낮춤, 낮출 것이 없으면 가장 덜 중요한 요청을 뺌 (Level = -1)
+	auto DegradeOnce = [&Candidates, &DegradeOrder]()
+	{
+		int32 BestIndex = -1;
+		float BestScore = -1.0f;
+		for (int32 Index : DegradeOrder)
+		{
+			const FCandidate& Candidate = Candidates[Index];
+			if (Candidate.Level >= 0 && Candidate.Level < Candidate.MaxLevel)
+			{
+				const float Score = static_cast<float>(Candidate.GetSize()) / (Candidate.Importance + 0.01f);
+				if (Score > BestScore)
+				{
+					BestIndex = Index;
+					BestScore = Score;
+				}
+			}
+		}
+		if (BestIndex >= 0)
+		{
+			++Candidates[BestIndex].Level;
+			return true;
+		}
+		for (int32 Index : DegradeOrder)
+		{
+			if (Candidates[Index].Level >= 0)
+			{
+				Candidates[Index].Level = -1;
+				return true;
+			}
+		}
+		return false;
+	};
+
+	while (GetTotalArea() > Capacity && DegradeOnce())
+	{
+	}
+
+	// 3. 패킹, 실패하면 한 단계 더 낮춰 다시 시도
+	TArray<FCandidate> Packed;
+	for (;;)
+	{
+		Packed.Empty();
+		for (const FCandidate& Candidate : Candidates)
+		{
+			if (Candidate.Level >= 0)
+			{
+				Packed.Add(Candidate);
+			}
+		}
+
+		bool bRepacked = false;
+		if (PackCandidates(Packed, PreviousPlacements, bRepacked) == 0 || !DegradeOnce())
+		{
+			OutUsage.bRepacked2D = bRepacked;
+			break;
+		}
+	}
+
+	// 4. 결과 기록
+	for (const FCandidate& Candidate : Candidates)
+	{
+		FShadowRenderRequest& Request = InOutRequests[Candidate.RequestIndex];
+		if (Candidate.Level < 0)
+		{
+			Request.Size = 0;
+			++OutUsage.EvictedRequests2D;
+			continue;
+		}
+		PreviousLevels.Add(Candidate.RegionKey, Candidate.Level);
+		if (Candidate.Level > 0)
+		{
+			++OutUsage.DegradedRequests2D;
+		}
+	}
+
+	for (const FCandidate& Candidate : Packed)
+	{
+		FShadowRenderRequest& Request = InOutRequests[Candidate.RequestIndex];
+		if (!Candidate.bPlaced)
+		{
+			Request.Size = 0;
+			++OutUsage.EvictedRequests2D;
+			continue;
+		}
+
+		const uint32 Size = Candidate.GetSize();
+		Request.Size = Size;
+		Request.AtlasViewportOffset = FVector2D(static_cast<float>(Candidate.X), static_cast<float>(Candidate.Y));
+		Request.AtlasScaleOffset = FVector4(
+			Size / static_cast<float>(AtlasSize),			// ScaleX
+			Size / static_cast<float>(AtlasSize),			// ScaleY
+			Candidate.X / static_cast<float>(AtlasSize),	// OffsetX
+			Candidate.Y / static_cast<float>(AtlasSize)		// OffsetY
+		);
+		OutUsage.UsedTexels2D += static_cast<uint64>(Size) * Size;
+	}
+}
+
+void FShadowAtlasAllocator::FitAtlasSizesToBudget(float BudgetMB, uint32& InOutAtlasSize2D, uint32& InOutAtlasSizeCube, uint32& InOutCubeArrayCount)
+{
+	const uint64 BudgetBytes = static_cast<uint64>(std::max(BudgetMB, 0.0f) * 1024.0 * 1024.0);
+
+	// 2D 아틀라스는 예산의 절반까지 (최소 해상도 하나는 들어가야 함)
+	while (InOutAtlasSize2D > MinShadowResolution
+		&& static_cast<uint64>(InOutAtlasSize2D) * InOutAtlasSize2D * BytesPerTexel2D > BudgetBytes / 2)
+	{
+		InOutAtlasSize2D /= 2;
+	}
+	const uint64 Bytes2D = static_cast<uint64>(InOutAtlasSize2D) * InOutAtlasSize2D * BytesPerTexel2D;
+	const uint64 RemainingBytes = BudgetBytes > Bytes2D ? BudgetBytes - Bytes2D : 0;
+
+	// 남은 예산으로 큐브맵 슬라이스가 최소 하나 들어갈 때까지 해상도를 낮춤
+	auto GetSliceBytes = [](uint32 Size) { return static_cast<uint64>(Size) * Size * 6 * BytesPerTexelCube; };
+	while (InOutAtlasSizeCube > MinShadowResolution && GetSliceBytes(InOutAtlasSizeCube) > RemainingBytes)
+	{
+		InOutAtlasSizeCube /= 2;
+	}
+
+	const uint64 SliceBytes = GetSliceBytes(InOutAtlasSizeCube);
+	const uint64 AffordableSlices = SliceBytes > 0 ? RemainingBytes / SliceBytes : 0;
+	InOutCubeArrayCount = static_cast<uint32>(std::min<uint64>(InOutCubeArrayCount, AffordableSlices));
+	if (InOutCubeArrayCount == 0)
+	{
+		InOutAtlasSizeCube = 0;
+	}
+}
+
+// ─────────────── 큐브맵 슬라이스 할당
+
+void FShadowCubeSliceAllocator::Allocate(TArray<FShadowRenderRequest>& InOutRequestsCube, const FSceneView* View, uint32 NumSlices, FShadowAtlasUsage& OutUsage)
+{
+	OutUsage.CubeSlices = NumSlices;
+	OutUsage.UsedCubeSlices = 0;
+	OutUsage.EvictedCubeLights = 0;
+
+	// 라이트별로 묶음 (라이트마다 6면 요청)
+	struct FCubeLight
+	{
+		ULightComponent* Light;
+		float Importance;
+		int32 Slice;
+	};
+	TArray<FCubeLight> Lights;
+	TMap<ULightComponent*, int32> LightIndices;
+
+	const void* ViewIdentity = View ? static_cast<const void*>(View->ViewState) : nullptr;
+	if (PreviousSlicesByView.Num() >= MaxTrackedViews && !PreviousSlicesByView.Contains(ViewIdentity))
+	{
+		PreviousSlicesByView.Empty();
+	}
+	TMap<ULightComponent*, int32>& PreviousSlices = PreviousSlicesByView[ViewIdentity];
+
+	const FFrustum ViewFrustum = View ? CreateFrustumFromViewProjection(View->GetViewProjectionMatrix()) : FFrustum();
+	for (const FShadowRenderRequest& Request : InOutRequestsCube)
+	{
+		if (Request.Size == 0 || LightIndices.Contains(Request.LightOwner))
+		{
+			continue;
+		}
+
+		float Importance = FShadowAtlasAllocator::ComputeScreenCoverage(View, ViewFrustum, Request.WorldLocation, Request.Radius);
+		if (PreviousSlices.Contains(Request.LightOwner))
+		{
+			Importance = Importance * RetainBias + KINDA_SMALL_NUMBER;
+		}
+		LightIndices.Add(Request.LightOwner, Lights.Num());
+		Lights.Add({ Request.LightOwner, Importance, -1 });
+	}
+
+	// 중요도 순으로 슬라이스 수만큼 선택 (같으면 등록 순서)
+	TArray<int32> Order;
+	Order.SetNum(Lights.Num());
+	for (int32 Index = 0; Index < Lights.Num(); ++Index)
+	{
+		Order[Index] = Index;
+	}
+	std::stable_sort(Order.begin(), Order.end(), [&Lights](int32 A, int32 B)
+	{
+		return Lights[A].Importance > Lights[B].Importance;
+	});
+	const int32 NumSelected = std::min(static_cast<int32>(NumSlices), Lights.Num());
+
+	// 선택된 라이트는 지난 슬라이스를 유지하고, 나머지는 빈 슬라이스를 앞에서부터 받음
+	TArray<bool> SliceUsed;
+	SliceUsed.SetNum(NumSlices);
+	for (int32 Rank = 0; Rank < NumSelected; ++Rank)
+	{
+		FCubeLight& CubeLight = Lights[Order[Rank]];
+		const int32* PreviousSlice = PreviousSlices.Find(CubeLight.Light);
+		if (PreviousSlice && *PreviousSlice < static_cast<int32>(NumSlices) && !SliceUsed[*PreviousSlice])
+		{
+			CubeLight.Slice = *PreviousSlice;
+			SliceUsed[CubeLight.Slice] = true;
+		}
+	}
+	int32 NextFreeSlice = 0;
+	for (int32 Rank = 0; Rank < NumSelected; ++Rank)
+	{
+		FCubeLight& CubeLight = Lights[Order[Rank]];
+		if (CubeLight.Slice >= 0)
+		{
+			continue;
+		}
+		while (SliceUsed[NextFreeSlice])
+		{
+			++NextFreeSlice;
+		}
+		CubeLight.Slice = NextFreeSlice;
+		SliceUsed[NextFreeSlice] = true;
+	}
+
+	PreviousSlices.Empty();
+	for (const FCubeLight& CubeLight : Lights)
+	{
+		if (CubeLight.Slice >= 0)
+		{
+			PreviousSlices.Add(CubeLight.Light, CubeLight.Slice);
+			++OutUsage.UsedCubeSlices;
+		}
+		else
+		{
+			++OutUsage.EvictedCubeLights;
+		}
+	}
+
+	for (FShadowRenderRequest& Request : InOutRequestsCube)
+	{
+		const int32* LightIndex = Request.Size > 0 ? LightIndices.Find(Request.LightOwner) : nullptr;
+		const int32 Slice = LightIndex ? Lights[*LightIndex].Slice : -1;
+		Request.AssignedSliceIndex = Slice;
+		if (Slice < 0)
+		{
+			Request.Size = 0;
+		}
+	}
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+class ULightComponent;
+class FSceneView;
+struct FShadowRenderRequest;
+struct FShadowAtlasUsage;
+struct FFrustum;
+
+/**
+ * @brief 스카이라인(bottom-left) 사각형 패커
+ * @details 아틀라스 바닥에서부터 쌓인 높이를 구간 목록으로 유지하고, 새 사각형을 가장 낮게(같으면 왼쪽에) 놓는다.
+ * 선반(Shelf) 방식과 달리 크기가 다른 영역 사이의 빈 공간도 다음 사각형이 채울 수 있다.
+ */
+class FSkylinePacker
+{
+public:
+	void Reset(uint32 InWidth, uint32 InHeight);
+
+	// 사각형을 놓을 자리를 찾아 스카이라인을 갱신, 자리가 없으면 false
+	bool Insert(uint32 Width, uint32 Height, uint32& OutX, uint32& OutY);
+
+private:
+	// Index 구간부터 Width만큼 덮을 때의 바닥 높이 (넘치면 false)
+	bool FindBaseline(int32 Index, uint32 Width, uint32& OutY) const;
+
+	struct FSegment
+	{
+		uint32 X;
+		uint32 Y;
+		uint32 Width;
+	};
+
+	uint32 AtlasWidth = 0;
+	uint32 AtlasHeight = 0;
+	TArray<FSegment> Skyline;
+};
+
+/**
+ * @brief 화면 점유율 기반 2D 그림자 아틀라스 할당기 (Spot/Directional)
+ * @details 요청 크기(라이트의 ShadowResolutionScale)를 상한으로, 라이트 영향 범위가 화면에서 차지하는 비율에 따라
+ * 2의 거듭제곱 단위로 해상도를 낮춘다. 방향광 캐스케이드는 화면 전체를 덮으므로 항상 최대 중요도로 본다.
+ *
+ * - 안정성: 해상도 단계에 히스테리시스를 두고, 입력이 같으면 지난 배치를 그대로 쓴다.
+ *   배치 순서는 (크기, 라이트, 서브뷰) 순으로 결정적이므로 다시 패킹해도 같은 입력은 같은 자리에 놓인다.
+ * - 예산: 요청 면적 합이 아틀라스 용량을 넘거나 패킹에 실패하면 중요도가 낮은 요청부터 한 단계씩 낮추고,
+ *   최소 해상도에서도 들어가지 않으면 그 요청을 뺀다 (Size = 0).
+ *
+ * FLightManager가 월드마다 하나씩 소유한다.
+ */
+class FShadowAtlasAllocator
+{
+public:
+	// 이보다 낮추지 않음 (요청 자체가 더 작으면 요청 크기)
+	static constexpr uint32 MinShadowResolution = 128;
+	// 영향 범위 반지름이 화면 절반 높이의 이 비율 이상이면 최대 해상도
+	static constexpr float FullResolutionCoverage = 0.5f;
+	// 면적 합이 아틀라스의 이 비율을 넘으면 패킹 전에 미리 낮춤 (스카이라인 낭비 여유)
+	static constexpr float MaxAtlasFill = 0.9f;
+
+	void Initialize(uint32 InAtlasSize);
+
+	/**
+	 * @brief 요청마다 해상도를 정하고 아틀라스에 배치
+	 * @details Size, AtlasViewportOffset, AtlasScaleOffset을 채운다. 배치하지 못한 요청은 Size = 0.
+	 * @param View 화면 점유율을 잴 뷰 (nullptr이면 모든 요청을 요청 크기 그대로 사용)
+	 */
+	void Allocate(TArray<FShadowRenderRequest>& InOutRequests, const FSceneView* View, FShadowAtlasUsage& OutUsage);
+
+	/**
+	 * @brief 구(라이트 영향 범위)가 화면에서 차지하는 반지름 비율 (0~1, 화면 절반 높이 기준)
+	 * @return 뷰 절두체 밖이면 0, 카메라가 구 안에 있으면 1
+	 */
+	static float ComputeScreenCoverage(const FSceneView* View, const FFrustum& ViewFrustum, const FVector& Center, float Radius);
+
+	/**
+	 * @brief 메모리 예산(MB)에 맞춰 아틀라스 크기를 정함
+	 * @details 2D 아틀라스(뎁스 + VSM)에 예산의 절반까지, 남은 예산으로 큐브맵 해상도와 슬라이스 수를 정한다.
+	 */
+	static void FitAtlasSizesToBudget(float BudgetMB, uint32& InOutAtlasSize2D, uint32& InOutAtlasSizeCube, uint32& InOutCubeArrayCount);
+
+private:
+	// 히스테리시스 상태를 이보다 많이 들고 있으면 비움 (사라진 라이트/뷰 정리)
+	static constexpr int32 MaxTrackedRegions = 1024;
+	// 지난 배치를 이보다 많은 뷰에 대해 들고 있으면 비움 (닫힌 뷰포트/프리뷰 정리)
+	static constexpr int32 MaxTrackedViews = 16;
+
+	struct FCandidate
+	{
+		int32 RequestIndex = -1;
+		uint64 RegionKey = 0;
+		uint32 RequestedSize = 0;
+		int32 Level = 0;		// 요청 크기에서 절반으로 줄인 횟수
+		int32 MaxLevel = 0;		// MinShadowResolution까지 줄일 수 있는 횟수
+		float Importance = 1.0f;
+		bool bPlaced = false;
+		uint32 X = 0;
+		uint32 Y = 0;
+
+		uint32 GetSize() const { return RequestedSize >> Level; }
+	};
+
+	// 지난 패킹 결과 하나 (정렬 순서 그대로 보관)
+	struct FPlacement
+	{
+		uint64 RegionKey;
+		uint32 Size;
+		uint32 X;
+		uint32 Y;
+	};
+
+	/**
+	 * @brief Candidates를 (크기 내림차순, 키 오름차순)으로 정렬해 배치
+	 * @details 이 뷰의 지난 배치와 입력이 같으면 다시 패킹하지 않고 지난 자리를 그대로 쓴다.
+	 * @param PreviousPlacements 이 뷰의 지난 배치 (모두 배치되면 이번 결과로 갱신)
+	 * @return 배치하지 못한 후보 수
+	 */
+	int32 PackCandidates(TArray<FCandidate>& Candidates, TArray<FPlacement>& PreviousPlacements, bool& bOutRepacked);
+
+	uint32 AtlasSize = 0;
+	FSkylinePacker Packer;
+
+	// 요청(라이트, 서브뷰, 뷰)별 지난 해상도 단계 (히스테리시스)
+	TMap<uint64, int32> PreviousLevels;
+
+	// 뷰(FSceneView::ViewState)별 지난 패킹 결과
+	// 에디터 뷰포트마다 화면 점유율이 달라 배치도 다르므로, 한 칸만 두면 뷰포트가 번갈아 그릴 때마다 다시 패킹함
+	TMap<const void*, TArray<FPlacement>> PreviousPlacementsByView;
+};
+
+/**
+ * @brief 점광원 큐브맵 슬라이스 할당기
+ * @details 큐브맵 배열은 슬라이스마다 해상도가 같으므로 해상도 대신 슬라이스를 화면 점유율 순으로 나눈다.
+ * 이미 슬라이스를 가진 라이트는 중요도에 가산점을 받고, 계속 선택되면 같은 슬라이스를 유지한다
+ * (슬라이스가 바뀌면 해당 면의 캐시된 뎁스를 쓸 수 없음).
+ */
+class FShadowCubeSliceAllocator
+{
+public:
+	// 지난 프레임에 슬라이스를 가졌던 라이트의 중요도 배율
+	static constexpr float RetainBias = 1.5f;
+
+	void Allocate(TArray<FShadowRenderRequest>& InOutRequestsCube, const FSceneView* View, uint32 NumSlices, FShadowAtlasUsage& OutUsage);
+
+private:
+	// 지난 슬라이스를 이보다 많은 뷰에 대해 들고 있으면 비움
+	static constexpr int32 MaxTrackedViews = 16;
+
+	// 뷰(FSceneView::ViewState)별 라이트의 지난 슬라이스 (2D 아틀라스와 같이 뷰포트마다 따로 유지)
+	TMap<const void*, TMap<ULightComponent*, int32>> PreviousSlicesByView;
+};
@@ -0,0 +1,224 @@
+#include "pch.h"
+#include "ShadowDepthCache.h"
+#include "LightManager.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "Frustum.h"
+#include "BoundingSphere.h"
+#include "Collision.h"
+
+namespace
+{
+	// FNV-1a (캐스터 집합 비교용)
+	constexpr uint64 FNVOffsetBasis = 14695981039346656037ull;
+	constexpr uint64 FNVPrime = 1099511628211ull;
+
+	inline uint64 HashCombine(uint64 Hash, uint64 Value)
+	{
+		return (Hash ^ Value) * FNVPrime;
+	}
+}
+
+bool FShadowViewKey::IsSameView(const FShadowViewKey& Other) const
+{
+	return Light == Other.Light
+		&& std::memcmp(&ViewProjection, &Other.ViewProjection, sizeof(FMatrix)) == 0
+		&& ViewportOffset.X == Other.ViewportOffset.X
+		&& ViewportOffset.Y == Other.ViewportOffset.Y
+		&& Size == Other.Size
+		&& SliceIndex == Other.SliceIndex
+		&& FaceIndex == Other.FaceIndex
+		&& AAMode == Other.AAMode
+		&& CasterHash == Other.CasterHash
+		&& NumCasters == Other.NumCasters;
+}
+
+void FShadowDepthCache::BeginFrame(UWorldPartitionManager* InPartition)
+{
+	// BVH는 프레임 사이에 갱신되므로 범위 쿼리는 프레임마다 새로
+	RangeQueryLight = nullptr;
+	RangeQueryResult.Empty();
+
+	if (InPartition != Partition)
+	{
+		// 월드 파티션이 바뀌면 이전 리비전과 비교할 수 없음
+		Partition = InPartition;
+		CasterChangeRevisions.Empty();
+		Invalidate();
+		PulledRevision = Partition ? Partition->GetVisibilityRevision() : 0;
+	}
+
+	bTrackingValid = Partition != nullptr;
+	if (!Partition)
+	{
+		return;
+	}
+
+	const uint64 Revision = Partition->GetVisibilityRevision();
+	if (Revision == PulledRevision)
+	{
+		return;
+	}
+
+	ChangedScratch.Empty();
+	if (!Partition->GetVisibilityChangesSince(PulledRevision, ChangedScratch)
+		|| CasterChangeRevisions.Num() + ChangedScratch.Num() > MaxTrackedCasters)
+	{
+		// 기록이 잘렸거나 너무 많이 쌓였으면 누가 움직였는지 대신 전부 다시 그림
+		CasterChangeRevisions.Empty();
+		Invalidate();
+	}
+	else
+	{
+		for (UPrimitiveComponent* Component : ChangedScratch)
+		{
+			CasterChangeRevisions.Add(Component, Revision);
+		}
+	}
+	PulledRevision = Revision;
+}
+
+const TSet<UPrimitiveComponent*>* FShadowDepthCache::QueryCastersInRange(const FShadowRenderRequest& Request)
+{
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || Request.Radius <= 0.0f)
+	{
+		return nullptr;
+	}
+
+	if (RangeQueryLight != Request.LightOwner || RangeQueryRadius != Request.Radius
+		|| RangeQueryLocation.X != Request.WorldLocation.X || RangeQueryLocation.Y != Request.WorldLocation.Y || RangeQueryLocation.Z != Request.WorldLocation.Z)
+	{
+		RangeQueryLight = Request.LightOwner;
+		RangeQueryLocation = Request.WorldLocation;
+		RangeQueryRadius = Request.Radius;
+
+		RangeQueryResult.Empty();
+		for (UPrimitiveComponent* Component : BVH->QueryIntersectedComponents(FBoundingSphere(Request.WorldLocation, Request.Radius)))
+		{
+			RangeQueryResult.Add(Component);
+		}
+	}
+	return &RangeQueryResult;
+}
+
+bool FShadowDepthCache::IsTrackedByBVH(UPrimitiveComponent* Component) const
+{
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	return BVH && BVH->Contains(Component) && !Partition->IsPendingUpdate(Component);
+}
+
+void FShadowDepthCache::CullCasters(const FShadowRenderRequest& Request, bool bDirectional, const TArray<FShadowCaster>& Casters,
+	const TSet<UPrimitiveComponent*>* InRangeCasters, TArray<uint32>& OutCasterIndices, FShadowViewKey& OutKey) const
+{
+	OutCasterIndices.Empty();
+
+	OutKey = FShadowViewKey();
+	OutKey.Light = Request.LightOwner;
+	OutKey.ViewProjection = Request.ViewMatrix * Request.ProjectionMatrix;
+	OutKey.ViewportOffset = Request.AtlasViewportOffset;
+	OutKey.Size = Request.Size;
+	OutKey.bCacheable = bTrackingValid;
+
+	FFrustum Frustum = CreateFrustumFromViewProjection(OutKey.ViewProjection);
+	if (bDirectional)
+	{
+		// 항상 통과하는 평면 (라이트 쪽으로 벗어난 캐스터도 캐스케이드에 그림자를 드리움)
+		Frustum.NearFace.Normal = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+		Frustum.NearFace.Distance = -FLT_MAX;
+	}
+	const FBoundingSphere LightSphere(Request.WorldLocation, Request.Radius);
+
+	uint64 Hash = FNVOffsetBasis;
+	for (int32 Index = 0; Index < Casters.Num(); ++Index)
+	{
+		const FShadowCaster& Caster = Casters[Index];
+		if (Caster.bHasBounds)
+		{
+			if (!bDirectional && Request.Radius > 0.0f)
+			{
+				const bool bInRange = (InRangeCasters && Caster.bInBVH)
+					? InRangeCasters->Contains(Caster.Component)
+					: Collision::Intersects(Caster.Bounds, LightSphere);
+				if (!bInRange)
+				{
+					continue;
+				}
+			}
+			if (!IsAABBVisible(Frustum, Caster.Bounds))
+			{
+				continue;
+			}
+		}
+
+		OutCasterIndices.Add(static_cast<uint32>(Index));
+		Hash = HashCombine(Hash, reinterpret_cast<uint64>(Caster.Component));
+		Hash = HashCombine(Hash, Caster.NumBatches);
+		Hash = HashCombine(Hash, static_cast<uint64>(static_cast<uint32>(Caster.LODIndex)));
+
+		if (Caster.bDynamic)
+		{
+			OutKey.bCacheable = false;
+		}
+		else if (const uint64* ChangeRevision = CasterChangeRevisions.Find(Caster.Component))
+		{
+			OutKey.LatestCasterChange = std::max(OutKey.LatestCasterChange, *ChangeRevision);
+		}
+	}
+
+	OutKey.CasterHash = Hash;
+	OutKey.NumCasters = static_cast<uint32>(OutCasterIndices.Num());
+}
+
+bool FShadowDepthCache::IsKeyCached(const FShadowViewKey& Cached, const FShadowViewKey& Key) const
+{
+	return Cached.bCacheable && Key.bCacheable
+		&& Key.LatestCasterChange <= Cached.RenderedRevision
+		&& Cached.IsSameView(Key);
+}
+
+bool FShadowDepthCache::IsAtlas2DCached(const TArray<FShadowViewKey>& Keys) const
+{
+	if (!bAtlas2DValid || Keys.Num() != CachedAtlas2D.Num())
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Keys.Num(); ++Index)
+	{
+		if (!IsKeyCached(CachedAtlas2D[Index], Keys[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FShadowDepthCache::StoreAtlas2D(const TArray<FShadowViewKey>& Keys)
+{
+	CachedAtlas2D = Keys;
+	for (FShadowViewKey& Key : CachedAtlas2D)
+	{
+		Key.RenderedRevision = PulledRevision;
+	}
+	bAtlas2DValid = true;
+}
+
+bool FShadowDepthCache::IsCubeFaceCached(const FShadowViewKey& Key) const
+{
+	const FShadowViewKey* Cached = CachedCubeFaces.Find(Key.SliceIndex * 6 + Key.FaceIndex);
+	return Cached && IsKeyCached(*Cached, Key);
+}
+
+void FShadowDepthCache::StoreCubeFace(const FShadowViewKey& Key)
+{
+	FShadowViewKey Stored = Key;
+	Stored.RenderedRevision = PulledRevision;
+	CachedCubeFaces.Add(Key.SliceIndex * 6 + Key.FaceIndex, Stored);
+}
+
+void FShadowDepthCache::Invalidate()
+{
+	CachedAtlas2D.Empty();
+	bAtlas2DValid = false;
+	CachedCubeFaces.Empty();
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "AABB.h"
+
+class UPrimitiveComponent;
+class ULightComponent;
+class UWorldPartitionManager;
+struct FShadowRenderRequest;
+
+/**
+ * @brief 그림자 캐스터 하나 (수집한 섀도우 배치 범위 + 컬링용 바운드)
+ * @details RenderShadowMaps가 캐스터를 수집하면서 배치 범위를 함께 기록하고, 요청마다 이 목록만 컬링한다.
+ */
+struct FShadowCaster
+{
+	UPrimitiveComponent* Component = nullptr;
+	FAABB Bounds;
+	uint32 FirstBatch = 0;
+	uint32 NumBatches = 0;
+	int32 LODIndex = -1;		// 수집한 메시 LOD (섹션 수는 LOD끼리 같으므로 LOD가 바뀌면 배치 수 대신 이 값으로 구분)
+	bool bHasBounds = false;	// 바운드가 없으면 (메시 파티클) 컬링하지 않고 항상 포함
+	bool bDynamic = false;		// 스키닝/파티클: 위치가 그대로여도 모양이 바뀌므로 이 캐스터가 포함된 뷰는 캐시하지 않음
+	bool bInBVH = false;		// BVH 구 쿼리 결과로 범위 판정 가능 (BVH 반영 대기 중이면 직접 검사)
+};
+
+/**
+ * @brief 그림자 뷰 하나를 그린 조건
+ * @details 라이트/행렬/아틀라스 위치/AA 방식/캐스터 집합이 같고 그 뒤로 캐스터가 움직이지 않았으면 뎁스 내용도 같다.
+ */
+struct FShadowViewKey
+{
+	ULightComponent* Light = nullptr;
+	FMatrix ViewProjection;
+	FVector2D ViewportOffset;
+	uint32 Size = 0;
+	int32 SliceIndex = -1;
+	int32 FaceIndex = -1;
+	uint32 AAMode = 0;
+
+	uint64 CasterHash = 0;
+	uint32 NumCasters = 0;
+
+	uint64 LatestCasterChange = 0;	// 포함된 캐스터가 마지막으로 움직인 리비전
+	uint64 RenderedRevision = 0;	// 이 키로 그린 시점의 리비전 (Store 시 기록)
+	bool bCacheable = true;
+
+	// 캐스터 변경 여부를 제외한 그리기 조건이 같은지
+	bool IsSameView(const FShadowViewKey& Other) const;
+};
+
+/**
+ * @brief 그림자 요청별 캐스터 컬링과 정적 그림자 뎁스 캐시
+ * @details 기존에는 모든 캐스터 배치를 스팟 라이트/캐스케이드/큐브 6면마다 전부 그렸다.
+ * 요청마다 라이트 절두체(+점/스팟은 BVH 구 쿼리)로 캐스터를 추리고,
+ * 캐스터 집합과 라이트가 그대로이고 그 캐스터들이 MarkDirty로 움직이지 않았으면 지난 뎁스를 그대로 쓴다.
+ *
+ * 캐스터 이동은 UWorldPartitionManager의 가시성 변경 기록(MarkDirty/Register/Unregister)으로 추적한다.
+ * 2D 아틀라스는 한 번에 지우고 다시 그리므로 아틀라스 전체 단위로, 큐브맵은 면(DSV) 단위로 캐시한다.
+ *
+ * FLightManager가 월드마다 하나씩 소유하며, 아틀라스가 지워지거나 다시 만들어지면 Invalidate해야 한다.
+ */
+class FShadowDepthCache
+{
+public:
+	// 변경 기록을 이만큼 넘게 들고 있으면 비우고 전부 다시 그림
+	static constexpr int32 MaxTrackedCasters = 4096;
+
+	/**
+	 * @brief 그림자 패스 시작 시 (뷰마다) 호출
+	 * @details 지난 호출 이후의 캐스터 변경을 가져와 캐스터별 변경 리비전을 갱신한다.
+	 */
+	void BeginFrame(UWorldPartitionManager* InPartition);
+
+	/**
+	 * @brief 점/스팟 라이트 범위(구) 안의 캐스터를 BVH로 찾음
+	 * @return BVH가 없으면 nullptr, BeginFrame 이후 같은 라이트 위치/반경이면 직전 결과를 재사용 (큐브 6면)
+	 */
+	const TSet<UPrimitiveComponent*>* QueryCastersInRange(const FShadowRenderRequest& Request);
+
+	// BVH 쿼리 결과를 믿어도 되는 캐스터인지 (BVH에 있고 반영 대기 중이 아님)
+	bool IsTrackedByBVH(UPrimitiveComponent* Component) const;
+
+	/**
+	 * @brief 요청 하나의 그림자에 들어갈 캐스터를 고르고 캐시 키를 만듦
+	 * @param bDirectional 방향광은 라이트와 캐스케이드 사이의 캐스터도 그림자를 드리우므로 Near 평면을 검사하지 않음
+	 * @param InRangeCasters QueryCastersInRange 결과 (nullptr이면 바운드로 직접 범위 검사)
+	 * @param OutCasterIndices Casters 인덱스 (수집 순서 유지)
+	 */
+	void CullCasters(const FShadowRenderRequest& Request, bool bDirectional, const TArray<FShadowCaster>& Casters,
+		const TSet<UPrimitiveComponent*>* InRangeCasters, TArray<uint32>& OutCasterIndices, FShadowViewKey& OutKey) const;
+
+	// 2D 아틀라스 전체가 Keys대로 이미 그려져 있는지
+	bool IsAtlas2DCached(const TArray<FShadowViewKey>& Keys) const;
+	void StoreAtlas2D(const TArray<FShadowViewKey>& Keys);
+
+	// 큐브맵 면 하나가 Key대로 이미 그려져 있는지
+	bool IsCubeFaceCached(const FShadowViewKey& Key) const;
+	void StoreCubeFace(const FShadowViewKey& Key);
+
+	// 모든 캐시 무효화 (아틀라스가 지워지거나 다시 만들어질 때)
+	void Invalidate();
+
+private:
+	bool IsKeyCached(const FShadowViewKey& Cached, const FShadowViewKey& Key) const;
+
+	UWorldPartitionManager* Partition = nullptr;
+	uint64 PulledRevision = 0;
+	bool bTrackingValid = false;	// 파티션이 없으면 움직임을 알 수 없으므로 캐시하지 않음
+
+	// 캐스터별 마지막 변경 리비전 (변경을 가져온 시점의 리비전, 실제 변경 이후임이 보장됨)
+	TMap<UPrimitiveComponent*, uint64> CasterChangeRevisions;
+	TArray<UPrimitiveComponent*> ChangedScratch;
+
+	// 2D 아틀라스에 마지막으로 그린 요청들 (순서 포함)
+	TArray<FShadowViewKey> CachedAtlas2D;
+	bool bAtlas2DValid = false;
+
+	// 큐브맵 면별 마지막으로 그린 요청 (Key: Slice * 6 + Face)
+	TMap<int32, FShadowViewKey> CachedCubeFaces;
+
+	// QueryCastersInRange 재사용
+	ULightComponent* RangeQueryLight = nullptr;
+	FVector RangeQueryLocation;
+	float RangeQueryRadius = -1.0f;
+	TSet<UPrimitiveComponent*> RangeQueryResult;
+};
@@ -67,6 +67,49 @@ struct FShadowStats
 	}
 };
 
+// 그림자 아틀라스 할당 결과 (마지막으로 할당한 뷰 기준)
+struct FShadowAtlasUsage
+{
+	// 2D 아틀라스 (Spot/Directional)
+	uint64 AtlasTexels2D = 0;
+	uint64 UsedTexels2D = 0;
+	uint32 Requests2D = 0;
+	uint32 DegradedRequests2D = 0;    // 요청 해상도보다 낮춰 배치한 요청 수
+	uint32 EvictedRequests2D = 0;     // 예산 초과로 배치하지 못한 요청 수
+	bool bRepacked2D = false;         // 지난 배치를 쓰지 못하고 다시 패킹했는지
+
+	// 큐브맵 배열 (Point)
+	uint32 CubeSlices = 0;
+	uint32 UsedCubeSlices = 0;
+	uint32 EvictedCubeLights = 0;     // 슬라이스를 받지 못한 점광원 수
+
+	float GetUtilization2D() const
+	{
+		return AtlasTexels2D > 0 ? static_cast<float>(static_cast<double>(UsedTexels2D) / static_cast<double>(AtlasTexels2D) * 100.0) : 0.0f;
+	}
+};
+
+// 섀도우 뎁스 드로우 통계 (한 프레임, 모든 뷰 합계)
+// 요청별 캐스터 컬링과 정적 그림자 캐시로 줄인 드로우를 추적
+struct FShadowDrawStats
+{
+	uint32 ShadowViews = 0;           // 그림자 요청 수 (스팟 + 캐스케이드 + 큐브 면)
+	uint32 RenderedViews = 0;         // 실제로 다시 그린 요청 수
+	uint32 CachedViews = 0;           // 지난 뎁스를 그대로 쓴 요청 수
+
+	uint32 CasterDraws = 0;           // 그린 캐스터 배치 수
+	uint32 CulledDraws = 0;           // 라이트 범위/절두체 밖이라 건너뛴 배치 수
+	uint32 CachedDraws = 0;           // 캐시 적중으로 건너뛴 배치 수
+
+	uint32 AtlasRepacks = 0;          // 2D 아틀라스를 다시 패킹한 횟수
+	FShadowAtlasUsage AtlasUsage;
+
+	void Reset()
+	{
+		*this = FShadowDrawStats();
+	}
+};
+
 // 섀도우 통계 전역 매니저 (싱글톤)
 // UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
 class FShadowStatManager
@@ -90,6 +133,50 @@ public:
 		return CurrentStats;
 	}
 
+	// 프레임 시작 시 호출 (URenderer::BeginFrame): 지난 프레임 드로우 누적값을 확정하고 새로 누적 시작
+	void BeginFrame()
+	{
+		CurrentDrawStats = FrameDrawStats;
+		FrameDrawStats.Reset();
+	}
+
+	/**
+	 * @brief 그림자 요청 하나의 결과 누적
+	 * @param NumDraws 컬링 후 남은 배치 수 (캐시 적중이면 건너뛴 수로 셈)
+	 * @param NumCulled 컬링으로 건너뛴 배치 수
+	 */
+	void AddShadowView(uint32 NumDraws, uint32 NumCulled, bool bCached)
+	{
+		++FrameDrawStats.ShadowViews;
+		FrameDrawStats.CulledDraws += NumCulled;
+		if (bCached)
+		{
+			++FrameDrawStats.CachedViews;
+			FrameDrawStats.CachedDraws += NumDraws;
+		}
+		else
+		{
+			++FrameDrawStats.RenderedViews;
+			FrameDrawStats.CasterDraws += NumDraws;
+		}
+	}
+
+	// 아틀라스 할당 결과 기록 (FLightManager가 할당할 때마다 호출)
+	void SetAtlasUsage(const FShadowAtlasUsage& InUsage)
+	{
+		FrameDrawStats.AtlasUsage = InUsage;
+		if (InUsage.bRepacked2D)
+		{
+			++FrameDrawStats.AtlasRepacks;
+		}
+	}
+
+	// 지난 프레임의 드로우 통계
+	const FShadowDrawStats& GetDrawStats() const
+	{
+		return CurrentDrawStats;
+	}
+
 	// 통계 리셋
 	void ResetStats()
 	{
@@ -103,4 +190,7 @@ private:
 	FShadowStatManager& operator=(const FShadowStatManager&) = delete;
 
 	FShadowStats CurrentStats;
+
+	FShadowDrawStats FrameDrawStats;
+	FShadowDrawStats CurrentDrawStats;
 };
@@ -0,0 +1,190 @@
+#include "pch.h"
+#include "SkinningLODBenchmark.h"
+#include "MeshSimplifier.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	constexpr int32 NumRings = 96;
+	constexpr int32 NumSegments = 64;
+	constexpr int32 NumBones = 8;
+	constexpr float CylinderRadius = 0.5f;
+	constexpr float CylinderHeight = 2.0f;
+
+	// 높이 방향으로 본이 늘어선 원통 (인접한 두 본에 선형 가중치)
+	void BuildSkinnedCylinder(FSkeletalMeshData& OutData)
+	{
+		OutData.PathFileName = "SkinningLODBenchmark";
+		OutData.Vertices.Reserve((NumRings + 1) * (NumSegments + 1));
+		for (int32 Ring = 0; Ring <= NumRings; ++Ring)
+		{
+			const float V = static_cast<float>(Ring) / NumRings;
+			const float BoneCoord = V * (NumBones - 1);
+			const uint32 LowerBone = std::min(static_cast<uint32>(BoneCoord), static_cast<uint32>(NumBones - 2));
+			const float UpperWeight = BoneCoord - static_cast<float>(LowerBone);
+
+			for (int32 Segment = 0; Segment <= NumSegments; ++Segment)
+			{
+				const float U = static_cast<float>(Segment) / NumSegments;
+				const float Angle = U * 2.0f * PI;
+
+				FSkinnedVertex Vertex;
+				Vertex.Normal = FVector(std::cos(Angle), std::sin(Angle), 0.0f);
+				Vertex.Position = FVector(Vertex.Normal.X * CylinderRadius, Vertex.Normal.Y * CylinderRadius, V * CylinderHeight);
+				Vertex.UV = FVector2D(U, V);
+				Vertex.Tangent = FVector4(-std::sin(Angle), std::cos(Angle), 0.0f, 1.0f);
+				Vertex.Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+				Vertex.BoneIndices[0] = LowerBone;
+				Vertex.BoneIndices[1] = LowerBone + 1;
+				Vertex.BoneWeights[0] = 1.0f - UpperWeight;
+				Vertex.BoneWeights[1] = UpperWeight;
+				OutData.Vertices.Add(Vertex);
+			}
+		}
+
+		OutData.Indices.Reserve(NumRings * NumSegments * 6);
+		for (int32 Ring = 0; Ring < NumRings; ++Ring)
+		{
+			for (int32 Segment = 0; Segment < NumSegments; ++Segment)
+			{
+				const uint32 I0 = Ring * (NumSegments + 1) + Segment;
+				const uint32 I1 = I0 + 1;
+				const uint32 I2 = I0 + (NumSegments + 1);
+				const uint32 I3 = I2 + 1;
+				OutData.Indices.Add(I0); OutData.Indices.Add(I2); OutData.Indices.Add(I1);
+				OutData.Indices.Add(I1); OutData.Indices.Add(I2); OutData.Indices.Add(I3);
+			}
+		}
+
+		FGroupInfo Group;
+		Group.StartIndex = 0;
+		Group.IndexCount = static_cast<uint32>(OutData.Indices.Num());
+		OutData.GroupInfos.Add(Group);
+	}
+
+	// USkinnedMeshComponent::PerformSkinning과 같은 블렌딩 (위치/법선/탄젠트)
+	void SkinVertices(const TArray<FSkinnedVertex>& SrcVertices, const TArray<FMatrix>& SkinningMatrices, TArray<FNormalVertex>& OutVertices)
+	{
+		OutVertices.SetNum(SrcVertices.Num());
+		for (int32 Idx = 0; Idx < SrcVertices.Num(); ++Idx)
+		{
+			const FSkinnedVertex& Src = SrcVertices[Idx];
+			const FVector TangentDir(Src.Tangent.X, Src.Tangent.Y, Src.Tangent.Z);
+			FVector Position(0.f, 0.f, 0.f);
+			FVector Normal(0.f, 0.f, 0.f);
+			FVector Tangent(0.f, 0.f, 0.f);
+			for (int32 Influence = 0; Influence < 4; ++Influence)
+			{
+				const float Weight = Src.BoneWeights[Influence];
+				if (Weight > 0.f)
+				{
+					const FMatrix& SkinMatrix = SkinningMatrices[Src.BoneIndices[Influence]];
+					Position += SkinMatrix.TransformPosition(Src.Position) * Weight;
+					Normal += SkinMatrix.TransformVector(Src.Normal) * Weight;
+					Tangent += SkinMatrix.TransformVector(TangentDir) * Weight;
+				}
+			}
+
+			FNormalVertex& Dst = OutVertices[Idx];
+			Dst.pos = Position;
+			Dst.normal = Normal.GetSafeNormal();
+			const FVector FinalTangent = Tangent.GetSafeNormal();
+			Dst.Tangent = FVector4(FinalTangent.X, FinalTangent.Y, FinalTangent.Z, Src.Tangent.W);
+			Dst.tex = Src.UV;
+		}
+	}
+
+	// UMeshComponent::SelectLOD와 같은 기준 (히스테리시스 없이, 화면 높이 절반 = 1, 90도 FOV)
+	int32 PickLOD(const TArray<float>& ScreenSizes, float BoundRadius, float Distance)
+	{
+		const float ScreenSize = Distance > BoundRadius ? BoundRadius / Distance : FLT_MAX;
+		int32 LODIndex = 0;
+		for (int32 Candidate = 1; Candidate < ScreenSizes.Num(); ++Candidate)
+		{
+			if (ScreenSize < ScreenSizes[Candidate])
+			{
+				LODIndex = Candidate;
+			}
+		}
+		return LODIndex;
+	}
+}
+
+void FSkinningLODBenchmark::Run(int32 NumInstances)
+{
+	if (NumInstances <= 0)
+	{
+		return;
+	}
+
+	FSkeletalMeshData Data;
+	BuildSkinnedCylinder(Data);
+
+	FScopeCycleCounter BuildCounter;
+	FMeshSimplifier::BuildSkeletalMeshLODs(Data);
+	const double BuildMs = BuildCounter.Finish();
+
+	// LOD별 원본 정점과 전환 화면 크기 (USkeletalMesh::CreateLODResources와 같은 배열 구성)
+	TArray<const TArray<FSkinnedVertex>*> LODVertices;
+	TArray<float> ScreenSizes;
+	LODVertices.Add(&Data.Vertices);
+	ScreenSizes.Add(1.0f);
+	for (const FSkeletalMeshLOD& LOD : Data.LODs)
+	{
+		LODVertices.Add(&LOD.Vertices);
+		ScreenSizes.Add(LOD.ScreenSize);
+	}
+
+	// 본마다 조금씩 구부린 포즈 (스키닝 비용은 행렬 값과 무관)
+	TArray<FMatrix> SkinningMatrices;
+	SkinningMatrices.SetNum(NumBones);
+	for (int32 Bone = 0; Bone < NumBones; ++Bone)
+	{
+		SkinningMatrices[Bone] = FMatrix::MakeTranslation(FVector(0.05f * Bone, 0.0f, 0.0f));
+	}
+
+	// 카메라에서 2~20 거리에 고르게 배치 (경계 구 반지름은 원통 절반 높이 기준)
+	const float BoundRadius = std::sqrt(CylinderRadius * CylinderRadius + 0.25f * CylinderHeight * CylinderHeight);
+	TArray<int32> InstanceLODs;
+	InstanceLODs.SetNum(NumInstances);
+	uint32 InstancesPerLOD[MaxMeshLODCount] = {};
+	for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+	{
+		const float Distance = 2.0f + 18.0f * static_cast<float>(Instance) / static_cast<float>(NumInstances);
+		InstanceLODs[Instance] = PickLOD(ScreenSizes, BoundRadius, Distance);
+		++InstancesPerLOD[std::min(InstanceLODs[Instance], MaxMeshLODCount - 1)];
+	}
+
+	// 첫 호출의 버퍼 할당이 섞이지 않도록 한 번 미리 실행
+	TArray<FNormalVertex> SkinnedVertices;
+	SkinVertices(Data.Vertices, SkinningMatrices, SkinnedVertices);
+
+	uint64 BaseVertices = 0;
+	FScopeCycleCounter BaseCounter;
+	for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+	{
+		SkinVertices(Data.Vertices, SkinningMatrices, SkinnedVertices);
+		BaseVertices += SkinnedVertices.Num();
+	}
+	const double BaseMs = BaseCounter.Finish();
+
+	uint64 LODVerticesSkinned = 0;
+	FScopeCycleCounter LODCounter;
+	for (int32 Instance = 0; Instance < NumInstances; ++Instance)
+	{
+		SkinVertices(*LODVertices[InstanceLODs[Instance]], SkinningMatrices, SkinnedVertices);
+		LODVerticesSkinned += SkinnedVertices.Num();
+	}
+	const double LODMs = LODCounter.Finish();
+
+	UE_LOG("[Bench] SkinningLOD: %d instances, %d verts / %d tris at LOD0, %d LOD(s), build %.2f ms",
+		NumInstances, Data.Vertices.Num(), Data.Indices.Num() / 3, LODVertices.Num(), BuildMs);
+	for (int32 LODIndex = 0; LODIndex < LODVertices.Num(); ++LODIndex)
+	{
+		UE_LOG("[Bench]   LOD%d: %d verts, screen size < %.3f, %u instance(s)",
+			LODIndex, LODVertices[LODIndex]->Num(), ScreenSizes[LODIndex], InstancesPerLOD[std::min(LODIndex, MaxMeshLODCount - 1)]);
+	}
+	UE_LOG("[Bench]   LOD0 only  : %.3f ms, %llu verts", BaseMs, BaseVertices);
+	UE_LOG("[Bench]   Screen LOD : %.3f ms, %llu verts", LODMs, LODVerticesSkinned);
+	UE_LOG("[Bench]   Skinning speedup: x%.2f", LODMs > 0.0 ? BaseMs / LODMs : 0.0);
+}
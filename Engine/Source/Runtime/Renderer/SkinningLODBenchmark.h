@@ -0,0 +1,12 @@
+#pragma once
+
+/**
+ * @brief 스켈레탈 메시 LOD의 CPU 스키닝 절감 효과 측정용 헤드리스 벤치마크 (콘솔 BENCH 명령에서 호출)
+ * @details 합성 원통 메시로 LOD 체인을 만들고, 거리별로 배치한 인스턴스를 LOD0 고정 vs 화면 크기 LOD로 스키닝한다.
+ */
+class FSkinningLODBenchmark
+{
+public:
+	// LOD 생성 시간, LOD0 고정/LOD 선택 스키닝 시간과 정점 수 비교
+	static void Run(int32 NumInstances);
+};
@@ -1,32 +1,37 @@
 ﻿#pragma once
 #include "UEContainer.h"
 
-// 타일 기반 라이트 컬링 통계
+// 클러스터(타일 x 깊이 슬라이스) 기반 라이트 컬링 통계
 // 성능 메트릭과 컬링 효율성을 추적
 struct FTileCullingStats
 {
-	// 타일 그리드 차원
+	// 클러스터 그리드 차원
 	uint32 TileCountX = 0;
 	uint32 TileCountY = 0;
+	uint32 ClusterCountZ = 0;
 	uint32 TotalTileCount = 0;
+	uint32 TotalClusterCount = 0;
+	uint32 NonEmptyClusters = 0;    // 라이트가 하나 이상인 클러스터 수
 
 	// 라이트 개수
 	uint32 TotalPointLights = 0;
 	uint32 TotalSpotLights = 0;
 	uint32 TotalLights = 0;
+	uint32 VisibleLights = 0;       // 화면/깊이 범위 안에 들어온 라이트 수
 
-	// 타일당 라이트 통계
+	// 라이트가 있는 클러스터당 라이트 통계
 	uint32 MinLightsPerTile = 0;
 	uint32 MaxLightsPerTile = 0;
 	float AvgLightsPerTile = 0.0f;
 
 	// 컬링 효율성 메트릭
-	float CullingEfficiency = 0.0f; // 컬링된 라이트 비율 (%)
-	uint32 TotalLightTests = 0;     // 전체 라이트-타일 테스트 수
-	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수
+	float CullingEfficiency = 0.0f; // 검사한 (클러스터, 라이트) 중 컬링된 비율 (%)
+	uint32 TotalLightTests = 0;     // 라이트 범위 안의 클러스터-라이트 테스트 수
+	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 (클러스터, 라이트) 수
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CPUCullTimeMS = 0.0f;     // CullLights 전체 (범위 계산 + 병렬 리스트 구성 + 업로드)
 	uint32 LightIndexBufferSizeBytes = 0;
 
 	// 시각화 모드
@@ -46,10 +51,14 @@ struct FTileCullingStats
 	{
 		TileCountX = 0;
 		TileCountY = 0;
+		ClusterCountZ = 0;
 		TotalTileCount = 0;
+		TotalClusterCount = 0;
+		NonEmptyClusters = 0;
 		TotalPointLights = 0;
 		TotalSpotLights = 0;
 		TotalLights = 0;
+		VisibleLights = 0;
 		MinLightsPerTile = 0;
 		MaxLightsPerTile = 0;
 		AvgLightsPerTile = 0.0f;
@@ -57,6 +66,7 @@ struct FTileCullingStats
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CPUCullTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
 	}
 
@@ -65,10 +75,11 @@ struct FTileCullingStats
 	{
 		TotalLights = TotalPointLights + TotalSpotLights;
 		TotalTileCount = TileCountX * TileCountY;
+		TotalClusterCount = TotalTileCount * ClusterCountZ;
 
-		if (TotalTileCount > 0)
+		if (NonEmptyClusters > 0)
 		{
-			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalTileCount);
+			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(NonEmptyClusters);
 		}
 
 		if (TotalLightTests > 0)
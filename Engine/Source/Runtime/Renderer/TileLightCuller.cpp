@@ -1,16 +1,61 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
+#include "PlatformTime.h"
+#include "TaskScheduler.h"
 #include <algorithm>
 
+namespace
+{
+	// 라이트가 없는 클러스터 헤더 표시 (행 구성 중에만 사용, 최종 버퍼에서는 공용 빈 항목 오프셋으로 바뀜)
+	constexpr uint32 EmptyClusterMarker = UINT32_MAX;
+
+	// 스팟 라이트(원뿔 + 구면 밑면)를 감싸는 최소 구
+	// 반각이 45도 이하이면 꼭지점과 밑면 가장자리를 지나는 구, 넓으면 밑면 원을 지름으로 하는 구
+	void ComputeSpotLightBoundingSphere(const FSpotLightInfo& Light, FVector& OutCenter, float& OutRadius)
+	{
+		const float Radius = Light.AttenuationRadius;
+		const float HalfAngle = DegreesToRadians(std::clamp(Light.OuterConeAngle, 0.0f, 90.0f));
+		const float CosHalfAngle = std::cos(HalfAngle);
+
+		if (Light.Direction.SizeSquared() < KINDA_SMALL_NUMBER || HalfAngle >= PI * 0.5f - KINDA_SMALL_NUMBER)
+		{
+			OutCenter = Light.Position;
+			OutRadius = Radius;
+			return;
+		}
+
+		const FVector Direction = Light.Direction.GetSafeNormal();
+		if (CosHalfAngle >= 0.70710678f)
+		{
+			const float SphereRadius = Radius / (2.0f * CosHalfAngle);
+			OutCenter = Light.Position + Direction * SphereRadius;
+			OutRadius = SphereRadius;
+		}
+		else
+		{
+			OutCenter = Light.Position + Direction * (Radius * CosHalfAngle);
+			OutRadius = Radius * std::sin(HalfAngle);
+		}
+	}
+}
+
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
 	, TileSize(16)
 	, TileCountX(0)
 	, TileCountY(0)
 	, TotalTileCount(0)
-	, LightIndexBuffer(nullptr)
-	, LightIndexBufferSRV(nullptr)
+	, TotalClusterCount(0)
+	, ViewportWidthF(0.0f)
+	, ViewportHeightF(0.0f)
+	, ClusterNear(1.0f)
+	, ClusterFar(1.0f)
+	, DepthSliceScale(0.0f)
+	, DepthSliceBias(0.0f)
+	, SliceDepths{}
 {
+	LightList.MaxItemsPerCluster = MaxLightsPerCluster;
+	DecalList.MaxItemsPerCluster = MaxDecalsPerCluster;
 }
 
 FTileLightCuller::~FTileLightCuller()
@@ -21,7 +66,7 @@ FTileLightCuller::~FTileLightCuller()
 void FTileLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
 {
 	RHI = InRHI;
-	TileSize = InTileSize;
+	TileSize = std::max(InTileSize, 1u);
 
 	// 초기화는 CullLights에서 뷰포트 크기를 알게 되면 수행
 }
@@ -36,384 +81,469 @@ void FTileLightCuller::CullLights(
 	UINT ViewportWidth,
 	UINT ViewportHeight)
 {
-	// 타일 그리드 계산
-	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
-	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
-	TotalTileCount = TileCountX * TileCountY;
+	FScopeCycleCounter CullCounter;
+
+	SetupClusterGrid(ViewMatrix, ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
 
 	// 통계 초기화
 	Stats.Reset();
 	Stats.TileCountX = TileCountX;
 	Stats.TileCountY = TileCountY;
+	Stats.ClusterCountZ = NumDepthSlices;
 	Stats.TotalTileCount = TotalTileCount;
+	Stats.TotalClusterCount = TotalClusterCount;
 	Stats.TotalPointLights = PointLights.Num();
 	Stats.TotalSpotLights = SpotLights.Num();
 	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
 
-	// 타일 라이트 인덱스 버퍼 크기 재조정
-	UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
-	if (TileLightIndices.Num() != RequiredSize)
+	// 1. 라이트마다 한 번 투영해 겹치는 클러스터 범위 계산
+	TArray<FClusterItemBounds>& LightBounds = LightList.Bounds;
+	LightBounds.Empty();
+	LightBounds.Reserve(PointLights.Num() + SpotLights.Num());
+
+	FClusterItemBounds Bounds;
+	for (int32 i = 0; i < PointLights.Num(); ++i)
 	{
-		TileLightIndices.SetNum(RequiredSize);
+		// 라이트 인덱스 (상위 16비트: 타입(0=Point), 하위 16비트: 인덱스)
+		if (ComputeClusterBounds(PointLights[i].Position, PointLights[i].AttenuationRadius, static_cast<uint32>(i), Bounds))
+		{
+			LightBounds.Add(Bounds);
+		}
 	}
+	for (int32 i = 0; i < SpotLights.Num(); ++i)
+	{
+		FVector SphereCenter;
+		float SphereRadius;
+		ComputeSpotLightBoundingSphere(SpotLights[i], SphereCenter, SphereRadius);
 
-	// 버퍼 초기화 (모든 타일의 라이트 개수를 0으로)
-	memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
+		// 라이트 인덱스 (상위 16비트: 타입(1=Spot), 하위 16비트: 인덱스)
+		if (ComputeClusterBounds(SphereCenter, SphereRadius, (1u << 16) | static_cast<uint32>(i), Bounds))
+		{
+			LightBounds.Add(Bounds);
+		}
+	}
+	Stats.VisibleLights = LightBounds.Num();
 
-	// Inverse View-Projection 행렬 계산
-	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
+	// 2~4. 행별 후보 분배, 병렬 리스트 구성, 업로드
+	BuildClusterList(LightList);
 
-	// 각 타일에 대해 컬링 수행
+	// 통계 업데이트
 	Stats.MinLightsPerTile = UINT_MAX;
-	Stats.MaxLightsPerTile = 0;
-	uint32 TotalLightsAcrossAllTiles = 0;
+	for (uint32 Cluster = 0; Cluster < TotalClusterCount; ++Cluster)
+	{
+		const uint32 LightCount = LightList.Indices[LightList.Indices[Cluster]];
+		if (LightCount > 0)
+		{
+			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
+			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
+		}
+	}
+	Stats.NonEmptyClusters = LightList.NumNonEmptyClusters;
+	Stats.TotalLightsPassed = LightList.NumEntries;
+	if (Stats.NonEmptyClusters == 0)
+	{
+		Stats.MinLightsPerTile = 0;
+	}
+	for (const FClusterRowScratch& Scratch : ThreadScratch)
+	{
+		Stats.TotalLightTests += static_cast<uint32>(Scratch.NumTests);
+	}
+
+	// 컬링 효율성 계산
+	Stats.CalculateStats();
 
-	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
+	Stats.LightIndexBufferSizeBytes = static_cast<uint32>(LightList.Indices.Num() * sizeof(uint32));
+	Stats.CPUCullTimeMS = static_cast<float>(CullCounter.Finish());
+}
+
+void FTileLightCuller::CullDecals(
+	const TArray<FClusterSphere>& DecalSpheres,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float NearPlane,
+	float FarPlane,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	SetupClusterGrid(ViewMatrix, ProjMatrix, NearPlane, FarPlane, ViewportWidth, ViewportHeight);
+
+	// 데칼 인덱스는 타입 비트 없이 배열 인덱스 그대로 기록
+	DecalList.Bounds.Empty();
+	DecalList.Bounds.Reserve(DecalSpheres.Num());
+
+	FClusterItemBounds Bounds;
+	for (int32 i = 0; i < DecalSpheres.Num(); ++i)
 	{
-		for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+		if (ComputeClusterBounds(DecalSpheres[i].Center, DecalSpheres[i].Radius, static_cast<uint32>(i), Bounds))
 		{
-			UINT TileIndex = TileY * TileCountX + TileX;
-			UINT TileDataOffset = TileIndex * MaxLightsPerTile;
+			DecalList.Bounds.Add(Bounds);
+		}
+	}
 
-			// 타일 프러스텀 생성
-			FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, NearPlane, FarPlane);
+	BuildClusterList(DecalList);
+}
 
-			uint32 LightCount = 0;
+void FTileLightCuller::SetupClusterGrid(const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, float NearPlane, float FarPlane, UINT ViewportWidth, UINT ViewportHeight)
+{
+	// 클러스터 그리드 계산
+	TileCountX = std::max((ViewportWidth + TileSize - 1) / TileSize, 1u);
+	TileCountY = std::max((ViewportHeight + TileSize - 1) / TileSize, 1u);
+	TotalTileCount = TileCountX * TileCountY;
+	TotalClusterCount = TotalTileCount * NumDepthSlices;
+
+	CullViewMatrix = ViewMatrix;
+	CullProjMatrix = ProjMatrix;
+	ViewportWidthF = static_cast<float>(std::max(ViewportWidth, 1u));
+	ViewportHeightF = static_cast<float>(std::max(ViewportHeight, 1u));
+
+	// 지수 깊이 분할: Slice = log2(ViewZ) * Scale + Bias
+	ClusterNear = std::max(NearPlane, 0.01f);
+	ClusterFar = std::max(FarPlane, ClusterNear * 2.0f);
+	DepthSliceScale = static_cast<float>(NumDepthSlices) / std::log2(ClusterFar / ClusterNear);
+	DepthSliceBias = -std::log2(ClusterNear) * DepthSliceScale;
+	for (UINT Slice = 0; Slice <= NumDepthSlices; ++Slice)
+	{
+		SliceDepths[Slice] = ClusterNear * std::pow(ClusterFar / ClusterNear, static_cast<float>(Slice) / NumDepthSlices);
+	}
+}
 
-			// Point Light 테스트
-			for (int32 i = 0; i < PointLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
+void FTileLightCuller::BuildClusterList(FClusterList& List)
+{
+	// 2. 행(슬라이스, 타일 Y)별 후보 (항목 순서 유지 → 클러스터 안에서도 입력 순)
+	const int32 NumRows = static_cast<int32>(NumDepthSlices * TileCountY);
+	List.RowItems.SetNum(NumRows);
+	for (TArray<uint32>& Candidates : List.RowItems)
+	{
+		Candidates.Empty();
+	}
+	for (int32 ItemIndex = 0; ItemIndex < List.Bounds.Num(); ++ItemIndex)
+	{
+		const FClusterItemBounds& ItemBound = List.Bounds[ItemIndex];
+		for (UINT Slice = ItemBound.MinZ; Slice <= ItemBound.MaxZ; ++Slice)
+		{
+			for (UINT TileY = ItemBound.MinY; TileY <= ItemBound.MaxY; ++TileY)
 			{
-				Stats.TotalLightTests++;
-
-				if (TestPointLightAgainstFrustum(PointLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(0=Point), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
+				List.RowItems[Slice * TileCountY + TileY].Add(static_cast<uint32>(ItemIndex));
 			}
+		}
+	}
 
-			// Spot Light 테스트
-			for (int32 i = 0; i < SpotLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
-			{
-				Stats.TotalLightTests++;
-
-				if (TestSpotLightAgainstFrustum(SpotLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(1=Spot), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = (1 << 16) | i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
-			}
+	// 3. 행 단위 병렬 리스트 구성 (헤더는 행 내부 오프셋, 리스트는 스레드별 스크래치에 이어쓰기)
+	const uint32 EmptyClusterOffset = TotalClusterCount;
+	const uint32 HeaderSize = TotalClusterCount + 1;
+	List.Indices.SetNum(HeaderSize);
+	List.Indices[EmptyClusterOffset] = 0;
 
-			// 첫 번째 요소에 라이트 개수 저장
-			TileLightIndices[TileDataOffset] = LightCount;
+	ThreadScratch.SetNum(std::max(FTaskScheduler::Get().GetMaxConcurrency(), 1));
+	for (FClusterRowScratch& Scratch : ThreadScratch)
+	{
+		Scratch.Data.Empty();
+		Scratch.NumTests = 0;
+	}
+	List.RowOutputs.SetNum(NumRows);
 
-			// 통계 업데이트
-			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
-			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
-			TotalLightsAcrossAllTiles += LightCount;
-		}
+	ParallelFor(NumRows, [this, &List](int32 Row)
+	{
+		const int32 ThreadIndex = FTaskScheduler::GetCurrentThreadIndex();
+		BuildClusterRow(List, Row, ThreadScratch[ThreadIndex], List.RowOutputs[Row]);
+		List.RowOutputs[Row].ThreadIndex = ThreadIndex;
+	}, 4);
+
+	// 4. 행 시작 오프셋 누적 후 병렬로 이어붙이고 헤더를 최종 오프셋으로 보정
+	TArray<uint32> RowBase;
+	RowBase.SetNum(NumRows);
+	uint32 TotalSize = HeaderSize;
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		RowBase[Row] = TotalSize;
+		TotalSize += List.RowOutputs[Row].Num;
 	}
+	List.Indices.SetNum(TotalSize);
 
-	// 평균 계산
-	if (TotalTileCount > 0)
+	ParallelFor(NumRows, [this, &List, &RowBase, EmptyClusterOffset](int32 Row)
 	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
+		const FClusterRowOutput& Output = List.RowOutputs[Row];
+		if (Output.Num > 0)
+		{
+			memcpy(List.Indices.GetData() + RowBase[Row],
+				ThreadScratch[Output.ThreadIndex].Data.GetData() + Output.Start,
+				Output.Num * sizeof(uint32));
+		}
+
+		uint32* Headers = List.Indices.GetData() + static_cast<size_t>(Row) * TileCountX;
+		for (UINT TileX = 0; TileX < TileCountX; ++TileX)
+		{
+			Headers[TileX] = Headers[TileX] == EmptyClusterMarker ? EmptyClusterOffset : RowBase[Row] + Headers[TileX];
+		}
+	}, 16);
+
+	// 비어 있지 않은 클러스터는 [개수, 인덱스...] 하나씩이므로 리스트 길이에서 바로 계산
+	uint32 NumNonEmpty = 0;
+	for (const FClusterRowOutput& Output : List.RowOutputs)
+	{
+		NumNonEmpty += Output.NumClusters;
 	}
+	List.NumNonEmptyClusters = NumNonEmpty;
+	List.NumEntries = TotalSize - HeaderSize - NumNonEmpty;
 
-	// 컬링 효율성 계산
-	Stats.CalculateStats();
+	UploadClusterList(List);
+}
 
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
+void FTileLightCuller::UploadClusterList(FClusterList& List)
+{
+	const UINT TotalSize = static_cast<UINT>(List.Indices.Num());
+
+	// GPU 버퍼 생성 또는 업데이트 (리스트 크기가 프레임마다 달라지므로 부족할 때만 여유 있게 다시 생성)
+	if (!List.Buffer || List.BufferCapacity < TotalSize)
 	{
-		// 버퍼 생성
+		ReleaseClusterList(List);
+
+		const UINT NewCapacity = TotalSize + TotalSize / 4;
 		HRESULT hr = RHI->CreateStructuredBuffer(
 			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
+			NewCapacity,
+			nullptr,
+			&List.Buffer
 		);
 
 		if (SUCCEEDED(hr))
 		{
 			// SRV 생성
-			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+			RHI->CreateStructuredBufferSRV(List.Buffer, &List.BufferSRV);
+			List.BufferCapacity = NewCapacity;
+		}
+		else
+		{
+			List.BufferCapacity = 0;
 		}
-
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
 	}
-	else
+
+	if (List.Buffer)
 	{
-		// 기존 버퍼 업데이트
 		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
+			List.Buffer,
+			List.Indices.GetData(),
+			TotalSize * sizeof(uint32)
 		);
 	}
 }
 
-FFrustum FTileLightCuller::CreateTileFrustum(
-	UINT TileX,
-	UINT TileY,
-	const FMatrix& InvViewProj,
-	float NearPlane,
-	float FarPlane)
+void FTileLightCuller::ReleaseClusterList(FClusterList& List)
 {
-	FFrustum Frustum;
-
-	// 타일의 NDC 좌표 계산
-	// NDC: [-1, 1] 범위, 왼쪽 아래가 (-1, -1), 오른쪽 위가 (1, 1)
-	// 주의: DirectX는 Y축이 위쪽이 양수
-
-	float TileMinX = static_cast<float>(TileX * TileSize);
-	float TileMaxX = static_cast<float>((TileX + 1) * TileSize);
-	float TileMinY = static_cast<float>(TileY * TileSize);
-	float TileMaxY = static_cast<float>((TileY + 1) * TileSize);
-
-	// 뷰포트 크기
-	float ViewportWidth = static_cast<float>(TileCountX * TileSize);
-	float ViewportHeight = static_cast<float>(TileCountY * TileSize);
-
-	// Screen Space -> NDC
-	float NDC_MinX = (TileMinX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MaxX = (TileMaxX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MinY = 1.0f - (TileMaxY / ViewportHeight) * 2.0f; // Y축 반전
-	float NDC_MaxY = 1.0f - (TileMinY / ViewportHeight) * 2.0f;
-
-	// 8개의 프러스텀 코너 (NDC 공간)
-	FVector4 FrustumCorners[8];
-
-	// Near plane corners
-	FrustumCorners[0] = FVector4(NDC_MinX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[1] = FVector4(NDC_MaxX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[2] = FVector4(NDC_MaxX, NDC_MaxY, 0.0f, 1.0f);
-	FrustumCorners[3] = FVector4(NDC_MinX, NDC_MaxY, 0.0f, 1.0f);
-
-	// Far plane corners
-	FrustumCorners[4] = FVector4(NDC_MinX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[5] = FVector4(NDC_MaxX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[6] = FVector4(NDC_MaxX, NDC_MaxY, 1.0f, 1.0f);
-	FrustumCorners[7] = FVector4(NDC_MinX, NDC_MaxY, 1.0f, 1.0f);
-
-	// NDC -> World Space 변환
-	FVector WorldCorners[8];
-	for (int i = 0; i < 8; ++i)
+	if (List.BufferSRV)
 	{
-		FVector4 WorldPos = FrustumCorners[i] * InvViewProj;
-		WorldPos /= WorldPos.W; // Perspective divide
-		WorldCorners[i] = FVector(WorldPos.X, WorldPos.Y, WorldPos.Z);
+		List.BufferSRV->Release();
+		List.BufferSRV = nullptr;
 	}
 
-	// 프러스텀 평면 생성 (외향 법선)
-	// 평면 방정식: Normal · P + Distance = 0
-
-	// Left plane (점: 0, 3, 7)
+	if (List.Buffer)
 	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.LeftFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.LeftFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
+		List.Buffer->Release();
+		List.Buffer = nullptr;
 	}
+	List.BufferCapacity = 0;
+}
 
-	// Right plane (점: 1, 5, 6)
+bool FTileLightCuller::ComputeClusterBounds(const FVector& WorldCenter, float Radius, uint32 PackedIndex, FClusterItemBounds& OutBounds) const
+{
+	if (Radius <= 0.0f)
 	{
-		FVector Edge1 = WorldCorners[5] - WorldCorners[1];
-		FVector Edge2 = WorldCorners[6] - WorldCorners[1];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.RightFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.RightFace.Distance = -FVector::Dot(Normal, WorldCorners[1]);
+		return false;
 	}
 
-	// Bottom plane (점: 0, 1, 5)
+	const FVector Center = CullViewMatrix.TransformPosition(WorldCenter);
+
+	// 깊이 범위
+	const float MinZ = Center.Z - Radius;
+	const float MaxZ = Center.Z + Radius;
+	if (MaxZ < ClusterNear || MinZ > ClusterFar)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.BottomFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.BottomFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
+		return false;
 	}
+	const float ClampedMinZ = std::max(MinZ, ClusterNear);
+	const float ClampedMaxZ = std::min(MaxZ, ClusterFar);
 
-	// Top plane (점: 2, 3, 7)
+	// Near 평면 앞쪽으로 자른 뷰 공간 AABB의 8개 코너를 투영 (모든 코너가 카메라 앞이므로 투영 영역이 AABB 투영을 감쌈)
+	float NDCMinX = FLT_MAX, NDCMaxX = -FLT_MAX;
+	float NDCMinY = FLT_MAX, NDCMaxY = -FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
 	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[2];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[2];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.TopFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.TopFace.Distance = -FVector::Dot(Normal, WorldCorners[2]);
+		const FVector CornerPos(
+			Center.X + ((Corner & 1) ? Radius : -Radius),
+			Center.Y + ((Corner & 2) ? Radius : -Radius),
+			(Corner & 4) ? ClampedMaxZ : ClampedMinZ);
+		const FVector4 Clip = CullProjMatrix.TransformPositionVector4(CornerPos);
+		const float InvW = 1.0f / std::max(Clip.W, KINDA_SMALL_NUMBER);
+		NDCMinX = std::min(NDCMinX, Clip.X * InvW);
+		NDCMaxX = std::max(NDCMaxX, Clip.X * InvW);
+		NDCMinY = std::min(NDCMinY, Clip.Y * InvW);
+		NDCMaxY = std::max(NDCMaxY, Clip.Y * InvW);
 	}
-
-	// Near plane (점: 0, 1, 2)
+	if (NDCMaxX < -1.0f || NDCMinX > 1.0f || NDCMaxY < -1.0f || NDCMinY > 1.0f)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[2] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.NearFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.NearFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
+		return false;
 	}
 
-	// Far plane (점: 4, 6, 5)
+	// NDC -> 픽셀 -> 타일 (DirectX는 화면 Y가 아래로 증가)
+	auto ToTile = [this](float Pixel, UINT TileCount)
 	{
-		FVector Edge1 = WorldCorners[6] - WorldCorners[4];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[4];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.FarFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.FarFace.Distance = -FVector::Dot(Normal, WorldCorners[4]);
-	}
+		const float Tile = std::floor(Pixel / static_cast<float>(TileSize));
+		return static_cast<UINT>(std::clamp(Tile, 0.0f, static_cast<float>(TileCount - 1)));
+	};
 
-	return Frustum;
+	OutBounds.ViewCenter = Center;
+	OutBounds.Radius = Radius;
+	OutBounds.PackedIndex = PackedIndex;
+	OutBounds.MinX = ToTile((NDCMinX * 0.5f + 0.5f) * ViewportWidthF, TileCountX);
+	OutBounds.MaxX = ToTile((NDCMaxX * 0.5f + 0.5f) * ViewportWidthF, TileCountX);
+	OutBounds.MinY = ToTile((0.5f - NDCMaxY * 0.5f) * ViewportHeightF, TileCountY);
+	OutBounds.MaxY = ToTile((0.5f - NDCMinY * 0.5f) * ViewportHeightF, TileCountY);
+	OutBounds.MinZ = GetDepthSlice(ClampedMinZ);
+	OutBounds.MaxZ = GetDepthSlice(ClampedMaxZ);
+	return true;
 }
 
-bool FTileLightCuller::TestPointLightAgainstFrustum(
-	const FPointLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
+void FTileLightCuller::BuildClusterRow(FClusterList& List, int32 Row, FClusterRowScratch& Scratch, FClusterRowOutput& OutRow)
 {
-	// Point Light는 구체로 근사
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
+	const UINT Slice = static_cast<UINT>(Row) / TileCountY;
+	const UINT TileY = static_cast<UINT>(Row) % TileCountY;
+	uint32* Headers = List.Indices.GetData() + static_cast<size_t>(Row) * TileCountX;
 
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+	OutRow.Start = static_cast<uint32>(Scratch.Data.Num());
+	OutRow.Num = 0;
+	OutRow.NumClusters = 0;
 
-bool FTileLightCuller::TestSpotLightAgainstFrustum(
-	const FSpotLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
-{
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
-
-	// Spot Light도 구체로 근사
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+	const TArray<uint32>& Candidates = List.RowItems[Row];
+	if (Candidates.Num() == 0)
+	{
+		std::fill(Headers, Headers + TileCountX, EmptyClusterMarker);
+		return;
+	}
 
-bool FTileLightCuller::SphereIntersectsFrustum(
-	const FVector& Center,
-	float Radius,
-	const FFrustum& Frustum)
-{
-	// 구체가 모든 평면의 앞쪽(양수)에 있으면 프러스텀 내부
-	// 하나라도 뒤쪽(음수)에 있고 거리가 반지름보다 크면 외부
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
+	// 후보 항목이 겹치는 타일 X 범위의 클러스터만 구-AABB 검사
+	Scratch.Counts.assign(TileCountX, 0);
+	Scratch.PairX.Empty();
+	Scratch.PairItem.Empty();
 
-	for (int i = 0; i < 6; ++i)
+	FVector ClusterMin, ClusterMax;
+	for (uint32 ItemIndex : Candidates)
 	{
-		// 평면 방정식: Normal · P + Distance = 0
-		// 점 P에서 평면까지의 부호 있는 거리 = Normal · P + Distance
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-		float SignedDistance = FVector::Dot(Normal3D, Center) + Planes[i]->Distance;
+		const FClusterItemBounds& Bounds = List.Bounds[ItemIndex];
+		const float RadiusSq = Bounds.Radius * Bounds.Radius;
 
-		// 구체가 평면 뒤쪽에 완전히 있으면 교차하지 않음
-		if (SignedDistance < -Radius)
+		for (UINT TileX = Bounds.MinX; TileX <= Bounds.MaxX; ++TileX)
 		{
-			return false;
-		}
-	}
-
-	return true;
-}
-
-bool FTileLightCuller::ConeIntersectsFrustum(
-	const FVector& Apex,
-	const FVector& Direction,
-	float Height,
-	float CosHalfAngle,
-	const FFrustum& Frustum)
-{
-	// 원뿔-프러스텀 교차 테스트
-	float SinHalfAngle = sqrt(1.0f - CosHalfAngle * CosHalfAngle);
+			if (Scratch.Counts[TileX] >= List.MaxItemsPerCluster)
+			{
+				continue;
+			}
 
-	// 원뿔 밑면의 반지름
-	float BaseRadius = Height * SinHalfAngle;
+			++Scratch.NumTests;
+			GetClusterViewBounds(TileX, TileY, Slice, ClusterMin, ClusterMax);
 
-	// 경계 구체의 중심은 원뿔 축을 따라 이동
-	float K = (CosHalfAngle > 0.707f) ? 0.5f : (0.5f + 0.5f * SinHalfAngle);
-	FVector SphereCenter = Apex + Direction * (Height * K);
+			const float DX = Bounds.ViewCenter.X - std::clamp(Bounds.ViewCenter.X, ClusterMin.X, ClusterMax.X);
+			const float DY = Bounds.ViewCenter.Y - std::clamp(Bounds.ViewCenter.Y, ClusterMin.Y, ClusterMax.Y);
+			const float DZ = Bounds.ViewCenter.Z - std::clamp(Bounds.ViewCenter.Z, ClusterMin.Z, ClusterMax.Z);
+			if (DX * DX + DY * DY + DZ * DZ <= RadiusSq)
+			{
+				++Scratch.Counts[TileX];
+				Scratch.PairX.Add(TileX);
+				Scratch.PairItem.Add(Bounds.PackedIndex);
+			}
+		}
+	}
 
-	// 경계 구체의 반지름 (원뿔의 꼭지점과 밑면 가장자리를 모두 포함)
-	float SphereRadius;
-	if (CosHalfAngle > 0.707f) // 각도가 45도 이하 (좁은 원뿔)
+	// 클러스터별 [개수, 인덱스...] 자리 잡기 (Counts를 쓰기 위치로 재사용)
+	uint32 LocalSize = 0;
+	for (UINT TileX = 0; TileX < TileCountX; ++TileX)
 	{
-		// 좁은 원뿔: 밑면 중심에서 가장자리까지의 거리
-		SphereRadius = sqrt(BaseRadius * BaseRadius + (Height * 0.5f) * (Height * 0.5f));
+		const uint32 ItemCount = Scratch.Counts[TileX];
+		if (ItemCount == 0)
+		{
+			Headers[TileX] = EmptyClusterMarker;
+			continue;
+		}
+		Headers[TileX] = LocalSize;
+		Scratch.Counts[TileX] = LocalSize + 1;
+		LocalSize += 1 + ItemCount;
+		++OutRow.NumClusters;
 	}
-	else // 각도가 45도 이상 (넓은 원뿔)
+
+	Scratch.Data.SetNum(OutRow.Start + LocalSize);
+	uint32* RowData = Scratch.Data.GetData() + OutRow.Start;
+	for (int32 PairIndex = 0; PairIndex < Scratch.PairX.Num(); ++PairIndex)
 	{
-		// 넓은 원뿔: 더 보수적인 반지름 사용
-		SphereRadius = Height * 0.866f; // sqrt(3)/2 ≈ 0.866
+		RowData[Scratch.Counts[Scratch.PairX[PairIndex]]++] = Scratch.PairItem[PairIndex];
 	}
-
-	// 2. 경계 구체가 프러스텀과 교차하는지 먼저 테스트 (빠른 거부)
-	if (!SphereIntersectsFrustum(SphereCenter, SphereRadius, Frustum))
+	// 쓰기 위치가 끝까지 밀렸으므로 개수 = 끝 - 시작 - 1
+	for (UINT TileX = 0; TileX < TileCountX; ++TileX)
 	{
-		return false;
+		if (Headers[TileX] != EmptyClusterMarker)
+		{
+			RowData[Headers[TileX]] = Scratch.Counts[TileX] - Headers[TileX] - 1;
+		}
 	}
 
-	// 3. 추가 정밀 테스트: 원뿔 끝점(밑면 중심)도 체크
-	FVector ConeEnd = Apex + Direction * Height;
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
+	OutRow.Num = LocalSize;
+}
 
-	// 원뿔의 꼭지점과 끝점이 모두 같은 평면 뒤쪽에 있는지 확인
-	for (int i = 0; i < 6; ++i)
+void FTileLightCuller::GetClusterViewBounds(UINT TileX, UINT TileY, UINT Slice, FVector& OutMin, FVector& OutMax) const
+{
+	const float NearZ = SliceDepths[Slice];
+	const float FarZ = SliceDepths[Slice + 1];
+
+	// 타일의 NDC 범위 (실제 뷰포트 크기 기준, 마지막 타일은 뷰포트 끝에서 자름)
+	const float PixelMinX = static_cast<float>(TileX * TileSize);
+	const float PixelMaxX = std::min(static_cast<float>((TileX + 1) * TileSize), ViewportWidthF);
+	const float PixelMinY = static_cast<float>(TileY * TileSize);
+	const float PixelMaxY = std::min(static_cast<float>((TileY + 1) * TileSize), ViewportHeightF);
+
+	const float NDCX[2] = { PixelMinX / ViewportWidthF * 2.0f - 1.0f, PixelMaxX / ViewportWidthF * 2.0f - 1.0f };
+	const float NDCY[2] = { 1.0f - PixelMaxY / ViewportHeightF * 2.0f, 1.0f - PixelMinY / ViewportHeightF * 2.0f };
+	const float Depths[2] = { NearZ, FarZ };
+
+	// 깊이 Z에서 NDC가 n인 뷰 공간 좌표: n * W(Z) = X * P00 + Z * P20 + P30 (원근/직교 공통, Z에 대해 선형이므로 양 끝만 보면 됨)
+	const auto& P = CullProjMatrix.M;
+	OutMin = FVector(FLT_MAX, FLT_MAX, NearZ);
+	OutMax = FVector(-FLT_MAX, -FLT_MAX, FarZ);
+	for (float Z : Depths)
 	{
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-
-		float ApexDistance = FVector::Dot(Normal3D, Apex) + Planes[i]->Distance;
-		float EndDistance = FVector::Dot(Normal3D, ConeEnd) + Planes[i]->Distance;
-
-		// 두 점이 모두 평면 뒤쪽에 있고, 밑면 반지름보다 멀리 있으면 완전히 외부
-		if (ApexDistance < -BaseRadius && EndDistance < -BaseRadius)
+		const float W = Z * P[2][3] + P[3][3];
+		for (float N : NDCX)
 		{
-			return false;
+			const float X = (N * W - Z * P[2][0] - P[3][0]) / P[0][0];
+			OutMin.X = std::min(OutMin.X, X);
+			OutMax.X = std::max(OutMax.X, X);
+		}
+		for (float N : NDCY)
+		{
+			const float Y = (N * W - Z * P[2][1] - P[3][1]) / P[1][1];
+			OutMin.Y = std::min(OutMin.Y, Y);
+			OutMax.Y = std::max(OutMax.Y, Y);
 		}
 	}
+}
 
-	// 모든 테스트를 통과하면 교차한다고 판단
-	return true;
+UINT FTileLightCuller::GetDepthSlice(float ViewZ) const
+{
+	const float Slice = std::floor(std::log2(std::max(ViewZ, ClusterNear)) * DepthSliceScale + DepthSliceBias);
+	return static_cast<UINT>(std::clamp(Slice, 0.0f, static_cast<float>(NumDepthSlices - 1)));
 }
 
 ID3D11ShaderResourceView* FTileLightCuller::GetLightIndexBufferSRV()
 {
-	return LightIndexBufferSRV;
+	return LightList.BufferSRV;
 }
 
 void FTileLightCuller::Release()
 {
-	if (LightIndexBufferSRV)
+	for (FClusterList* List : { &LightList, &DecalList })
 	{
-		LightIndexBufferSRV->Release();
-		LightIndexBufferSRV = nullptr;
+		ReleaseClusterList(*List);
+		List->Bounds.Empty();
+		List->RowItems.Empty();
+		List->RowOutputs.Empty();
+		List->Indices.Empty();
 	}
-
-	if (LightIndexBuffer)
-	{
-		LightIndexBuffer->Release();
-		LightIndexBuffer = nullptr;
-	}
-
-	TileLightIndices.Empty();
+	ThreadScratch.Empty();
 }
@@ -2,20 +2,43 @@
 #include "LightManager.h"
 #include "TileCullingStats.h"
 #include "D3D11RHI.h"
-#include "Frustum.h"
 
-// 타일 기반 라이트 컬링을 CPU에서 수행하는 클래스
-// Conservative(near, far) frustum 방식으로 각 타일에 영향을 주는 라이트를 계산
+// 클러스터(타일 x 깊이 슬라이스) 기반 라이트 컬링을 CPU에서 수행하는 클래스
+// 라이트마다 한 번 뷰 공간 경계 구를 투영해 겹치는 타일/슬라이스 범위를 구하고, 그 범위의 클러스터만 방문
+// (기존: 타일마다 프러스텀을 만들어 모든 라이트를 검사하는 타일 수 x 라이트 수 루프)
+//
+// 결과 버퍼 구조 (기존 타일 구조의 [개수, 인덱스...]를 압축 리스트로 유지):
+//   [ClusterIndex] = 클러스터 데이터 오프셋 (ClusterIndex = (Slice * TileCountY + TileY) * TileCountX + TileX)
+//   [Offset] = LightCount, [Offset + 1 ~ ...] = LightIndices (상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스)
+//   라이트가 없는 클러스터는 모두 공용 빈 항목(개수 0)을 가리킨다.
+//
+// 데칼도 같은 클러스터 그리드에 경계 구로 배치하며, 별도 버퍼에 같은 구조로 기록한다 (인덱스 = 데칼 배열 인덱스)
 class FTileLightCuller
 {
 public:
+	// 깊이 슬라이스 개수 (Near~Far를 지수 분할, 셰이더는 log2(ViewZ) * Scale + Bias로 슬라이스를 구함)
+	static constexpr UINT NumDepthSlices = 16;
+
+	// 클러스터당 최대 라이트 개수
+	static constexpr UINT MaxLightsPerCluster = 255;
+
+	// 클러스터당 최대 데칼 개수 (넘는 데칼은 배열 순서상 뒤쪽부터 빠짐)
+	static constexpr UINT MaxDecalsPerCluster = 64;
+
+	// 클러스터에 배치할 월드 공간 경계 구 (데칼용)
+	struct FClusterSphere
+	{
+		FVector Center;
+		float Radius;
+	};
+
 	FTileLightCuller();
 	~FTileLightCuller();
 
 	// 초기화 (Structured Buffer 생성)
 	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
 
-	// 타일 컬링 수행 (매 프레임 호출)
+	// 클러스터 컬링 수행 (매 프레임 호출)
 	void CullLights(
 		const TArray<FPointLightInfo>& PointLights,
 		const TArray<FSpotLightInfo>& SpotLights,
@@ -30,37 +53,113 @@ public:
 	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
+	// 데칼 클러스터 배치 (라이트 컬링 여부와 무관하게 같은 그리드를 다시 구성, 배열 순서 = 클러스터 안 순서)
+	void CullDecals(
+		const TArray<FClusterSphere>& DecalSpheres,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	// 데칼 배치 결과 SRV와 통계
+	ID3D11ShaderResourceView* GetDecalIndexBufferSRV() const { return DecalList.BufferSRV; }
+	uint32 GetNumBinnedDecals() const { return static_cast<uint32>(DecalList.Bounds.Num()); }
+	uint32 GetNumDecalClusterEntries() const { return DecalList.NumEntries; }
+	uint32 GetNumDecalLitClusters() const { return DecalList.NumNonEmptyClusters; }
+
+	// 마지막 컬링의 그리드 크기
+	UINT GetTileSize() const { return TileSize; }
+	UINT GetTileCountX() const { return TileCountX; }
+	UINT GetTileCountY() const { return TileCountY; }
+
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
+	// 셰이더 클러스터 인덱스 계산용 깊이 슬라이스 파라미터
+	UINT GetClusterCountZ() const { return NumDepthSlices; }
+	float GetDepthSliceScale() const { return DepthSliceScale; }
+	float GetDepthSliceBias() const { return DepthSliceBias; }
+
 	// 리소스 해제
 	void Release();
 
 private:
-	// 타일 프러스텀 생성 (Conservative near/far 방식)
-	FFrustum CreateTileFrustum(
-		UINT TileX,
-		UINT TileY,
-		const FMatrix& InvViewProj,
-		float NearPlane,
-		float FarPlane
-	);
-
-	// 라이트가 타일 프러스텀과 교차하는지 테스트
-	bool TestPointLightAgainstFrustum(const FPointLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
-	bool TestSpotLightAgainstFrustum(const FSpotLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
-
-	// 구체와 프러스텀 교차 테스트
-	bool SphereIntersectsFrustum(const FVector& Center, float Radius, const FFrustum& Frustum);
-
-	// 원뿔과 프러스텀 교차 테스트 (SpotLight용)
-	bool ConeIntersectsFrustum(
-		const FVector& Apex,           // 원뿔 꼭지점 (라이트 위치)
-		const FVector& Direction,      // 원뿔 방향 (정규화됨)
-		float Height,                  // 원뿔 높이 (AttenuationRadius)
-		float CosHalfAngle,            // cos(OuterConeAngle / 2)
-		const FFrustum& Frustum
-	);
+	// 라이트/데칼 하나의 뷰 공간 경계 구와 겹치는 클러스터 범위
+	struct FClusterItemBounds
+	{
+		FVector ViewCenter;
+		float Radius;
+		uint32 PackedIndex;
+		UINT MinX, MaxX;
+		UINT MinY, MaxY;
+		UINT MinZ, MaxZ;
+	};
+
+	// 행(슬라이스, 타일 Y) 하나의 결과가 어느 스레드 스크래치의 어디에 기록됐는지
+	struct FClusterRowOutput
+	{
+		int32 ThreadIndex;
+		uint32 Start;
+		uint32 Num;
+		uint32 NumClusters;	// 비어 있지 않은 클러스터 수
+	};
+
+	// 스레드별 행 처리 스크래치
+	struct FClusterRowScratch
+	{
+		TArray<uint32> Counts;		// 타일 X별 항목 개수
+		TArray<uint32> PairX;		// 통과한 (타일 X, 항목) 쌍
+		TArray<uint32> PairItem;
+		TArray<uint32> Data;		// 행들의 [개수, 인덱스...] 이어쓰기
+		uint64 NumTests = 0;
+	};
+
+	// 클러스터 리스트 하나 (라이트용, 데칼용)
+	struct FClusterList
+	{
+		UINT MaxItemsPerCluster = 0;
+
+		// 항목별 클러스터 범위, 행별 후보 항목 (Bounds 인덱스)
+		TArray<FClusterItemBounds> Bounds;
+		TArray<TArray<uint32>> RowItems;
+		TArray<FClusterRowOutput> RowOutputs;
+
+		// 클러스터 헤더 + 압축 리스트 (GPU 업로드 원본)
+		TArray<uint32> Indices;
+		uint32 NumEntries = 0;
+		uint32 NumNonEmptyClusters = 0;
+
+		// GPU 리소스
+		ID3D11Buffer* Buffer = nullptr;
+		ID3D11ShaderResourceView* BufferSRV = nullptr;
+		UINT BufferCapacity = 0;
+	};
+
+	// 뷰/뷰포트로부터 타일 수와 깊이 슬라이스 경계 계산
+	void SetupClusterGrid(const FMatrix& ViewMatrix, const FMatrix& ProjMatrix, float NearPlane, float FarPlane, UINT ViewportWidth, UINT ViewportHeight);
+
+	// List.Bounds를 행별 후보로 나누고 병렬로 클러스터 리스트를 만든 뒤 GPU에 업로드
+	void BuildClusterList(FClusterList& List);
+
+	// 리스트 버퍼 업로드 (부족할 때만 여유 있게 다시 생성)
+	void UploadClusterList(FClusterList& List);
+
+	void ReleaseClusterList(FClusterList& List);
+
+	// 경계 구를 뷰 공간으로 옮겨 겹치는 클러스터 범위를 구함 (화면/깊이 범위 밖이면 false)
+	bool ComputeClusterBounds(const FVector& WorldCenter, float Radius, uint32 PackedIndex, FClusterItemBounds& OutBounds) const;
+
+	// 행 하나의 클러스터별 리스트 구성 (헤더에는 행 내부 오프셋 기록)
+	void BuildClusterRow(FClusterList& List, int32 Row, FClusterRowScratch& Scratch, FClusterRowOutput& OutRow);
+
+	// 클러스터의 뷰 공간 AABB
+	void GetClusterViewBounds(UINT TileX, UINT TileY, UINT Slice, FVector& OutMin, FVector& OutMax) const;
+
+	// 뷰 공간 깊이가 속한 슬라이스 (셰이더와 같은 식)
+	UINT GetDepthSlice(float ViewZ) const;
 
 private:
 	D3D11RHI* RHI;
@@ -70,18 +169,23 @@ private:
 	UINT TileCountX;        // 가로 타일 개수
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
-
-	// 타일당 최대 라이트 개수 (보수적으로 설정)
-	static constexpr UINT MaxLightsPerTile = 256;
-
-	// 타일별 라이트 인덱스 저장
-	// [TileIndex * MaxLightsPerTile] 위치에 라이트 개수 저장
-	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
-	TArray<uint32> TileLightIndices;
-
-	// GPU 리소스
-	ID3D11Buffer* LightIndexBuffer;
-	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT TotalClusterCount; // 전체 클러스터 개수 (타일 수 x 슬라이스 수)
+
+	// 뷰 설정 (CullLights 동안 유효)
+	FMatrix CullViewMatrix;
+	FMatrix CullProjMatrix;
+	float ViewportWidthF;
+	float ViewportHeightF;
+	float ClusterNear;
+	float ClusterFar;
+	float DepthSliceScale;
+	float DepthSliceBias;
+	float SliceDepths[NumDepthSlices + 1];	// 슬라이스 경계의 뷰 공간 깊이
+
+	// 라이트/데칼 클러스터 리스트, 두 리스트가 공유하는 스레드별 스크래치
+	FClusterList LightList;
+	FClusterList DecalList;
+	TArray<FClusterRowScratch> ThreadScratch;
 
 	// 통계
 	FTileCullingStats Stats;
@@ -12,6 +12,9 @@
 #include "ShadowStats.h"
 #include "ParticleStats.h"
 #include "SkinningStats.h"
+#include "OcclusionStats.h"
+#include "DrawSortStats.h"
+#include "MeshLODStats.h"
 
 // Stats 패널 색상 (FutureEngine 패턴)
 namespace StatsColors
@@ -60,7 +63,7 @@ void UStatsOverlayD2D::Draw(FCanvas& Canvas)
 {
 	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal &&
 	                      !bShowTileCulling && !bShowLights && !bShowShadow && !bShowGPU &&
-	                      !bShowSkinning && !bShowParticles && !bShowPhysicsAsset))
+	                      !bShowSkinning && !bShowParticles && !bShowOcclusion && !bShowDrawSort && !bShowMeshLOD && !bShowPhysicsAsset))
 	{
 		return;
 	}
@@ -117,14 +120,17 @@ void UStatsOverlayD2D::Draw(FCanvas& Canvas)
 	if (bShowDecal)
 	{
 		uint32_t TotalCount = FDecalStatManager::GetInstance().GetTotalDecalCount();
-		uint32_t AffectedMeshCount = FDecalStatManager::GetInstance().GetAffectedMeshCount();
+		uint32_t BinnedCount = FDecalStatManager::GetInstance().GetBinnedDecalCount();
+		uint32_t ClusterEntryCount = FDecalStatManager::GetInstance().GetClusterEntryCount();
+		uint32_t DecalClusterCount = FDecalStatManager::GetInstance().GetDecalClusterCount();
+		uint32_t AtlasSliceCount = FDecalStatManager::GetInstance().GetAtlasSliceCount();
+		uint32_t AtlasUploadCount = FDecalStatManager::GetInstance().GetAtlasUploadCount();
 		double TotalTime = FDecalStatManager::GetInstance().GetDecalPassTimeMS();
 		double AverageTimePerDecal = FDecalStatManager::GetInstance().GetAverageTimePerDecalMS();
-		double AverageTimePerDraw = FDecalStatManager::GetInstance().GetAverageTimePerDrawMS();
 
 		wchar_t Buf[256];
-		swprintf_s(Buf, L"[Decal Stats]\nTotal: %u\nAffectedMesh: %u\n전체 소요 시간: %.3f ms\nAvg/Decal: %.3f ms\nAvg/Mesh: %.3f ms",
-		           TotalCount, AffectedMeshCount, TotalTime, AverageTimePerDecal, AverageTimePerDraw);
+		swprintf_s(Buf, L"[Decal Stats]\nTotal: %u (Binned %u)\nClusters: %u (%u entries)\nAtlas: %u slices (+%u)\n전체 소요 시간: %.3f ms\nAvg/Decal: %.3f ms",
+		           TotalCount, BinnedCount, DecalClusterCount, ClusterEntryCount, AtlasSliceCount, AtlasUploadCount, TotalTime, AverageTimePerDecal);
 
 		const float DecalPanelHeight = 140.0f;
 		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, DecalPanelHeight, StatsColors::Orange);
@@ -137,13 +143,14 @@ void UStatsOverlayD2D::Draw(FCanvas& Canvas)
 		const FTileCullingStats& TileStats = FTileCullingStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
-		           TileStats.TileCountX, TileStats.TileCountY, TileStats.TotalTileCount,
-		           TileStats.TotalLights, TileStats.TotalPointLights, TileStats.TotalSpotLights,
+		swprintf_s(Buf, L"[Tile Culling Stats]\nClusters: %u x %u x %u (%u lit)\nLights: %u (P:%u S:%u, %u in view)\nMin/Avg/Max (lit): %u / %.1f / %u\nTests: %u (Culled %.1f%%)\nCPU: %.3f ms\nBuffer: %u KB",
+		           TileStats.TileCountX, TileStats.TileCountY, TileStats.ClusterCountZ, TileStats.NonEmptyClusters,
+		           TileStats.TotalLights, TileStats.TotalPointLights, TileStats.TotalSpotLights, TileStats.VisibleLights,
 		           TileStats.MinLightsPerTile, TileStats.AvgLightsPerTile, TileStats.MaxLightsPerTile,
-		           TileStats.CullingEfficiency, TileStats.LightIndexBufferSizeBytes / 1024);
+		           TileStats.TotalLightTests, TileStats.CullingEfficiency, TileStats.CPUCullTimeMS,
+		           TileStats.LightIndexBufferSizeBytes / 1024);
 
-		const float TilePanelHeight = 160.0f;
+		const float TilePanelHeight = 180.0f;
 		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, TilePanelHeight, StatsColors::Cyan);
 		NextY += TilePanelHeight + Space;
 	}
@@ -167,16 +174,23 @@ void UStatsOverlayD2D::Draw(FCanvas& Canvas)
 	if (bShowShadow)
 	{
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
+		const FShadowDrawStats& ShadowDrawStats = FShadowStatManager::GetInstance().GetDrawStats();
 
-		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		wchar_t Buf[768];
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\nAtlas 2D Used: %.1f%%\n  Placed: %u/%u (Downsized %u, Dropped %u)\n  Repacks: %u\nCube Slices: %u/%u (%u dropped)\n\nShadow Views: %u (Rendered %u / Cached %u)\nCaster Draws: %u\n  Culled: %u\n  Cached: %u",
 		           ShadowStats.TotalShadowCastingLights, ShadowStats.ShadowCastingPointLights,
 		           ShadowStats.ShadowCastingSpotLights, ShadowStats.ShadowCastingDirectionalLights,
 		           ShadowStats.ShadowAtlas2DSize, ShadowStats.ShadowAtlas2DSize, ShadowStats.ShadowAtlas2DMemoryMB,
 		           ShadowStats.ShadowAtlasCubeSize, ShadowStats.ShadowAtlasCubeSize, ShadowStats.ShadowCubeArrayCount,
-		           ShadowStats.ShadowAtlasCubeMemoryMB, ShadowStats.TotalShadowMemoryMB);
-
-		const float ShadowPanelHeight = 260.0f;
+		           ShadowStats.ShadowAtlasCubeMemoryMB, ShadowStats.TotalShadowMemoryMB,
+		           ShadowDrawStats.AtlasUsage.GetUtilization2D(),
+		           ShadowDrawStats.AtlasUsage.Requests2D - ShadowDrawStats.AtlasUsage.EvictedRequests2D, ShadowDrawStats.AtlasUsage.Requests2D,
+		           ShadowDrawStats.AtlasUsage.DegradedRequests2D, ShadowDrawStats.AtlasUsage.EvictedRequests2D, ShadowDrawStats.AtlasRepacks,
+		           ShadowDrawStats.AtlasUsage.UsedCubeSlices, ShadowDrawStats.AtlasUsage.CubeSlices, ShadowDrawStats.AtlasUsage.EvictedCubeLights,
+		           ShadowDrawStats.ShadowViews, ShadowDrawStats.RenderedViews, ShadowDrawStats.CachedViews,
+		           ShadowDrawStats.CasterDraws, ShadowDrawStats.CulledDraws, ShadowDrawStats.CachedDraws);
+
+		const float ShadowPanelHeight = 440.0f;
 		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, ShadowPanelHeight, StatsColors::DeepPink);
 		NextY += ShadowPanelHeight + Space;
 
@@ -236,17 +250,113 @@ void UStatsOverlayD2D::Draw(FCanvas& Canvas)
 	if (bShowParticles)
 	{
 		const FParticleStats& ParticleStats = FParticleStatManager::GetInstance().GetStats();
+		const FParticleSimulationStats& SimulationStats = FParticleStatManager::GetInstance().GetSimulationStats();
 
-		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Particle Stats]\nEmitters: %u\nParticles: %u\nSprite: %u\nMesh: %u",
+		wchar_t Buf[1024];
+		swprintf_s(Buf, L"[Particle Stats]\nEmitters: %u\nParticles: %u\nSprite: %u\nMesh: %u\n\nSimulation (%u threads)\n  Systems: %u / Emitters: %u\n  Particles: %u\n  Time: %.3f ms (x%.2f)\n  Sum: %.3f ms / Max: %.3f ms\n\nSort (radix)\n  Emitters: %u / Particles: %u\n  Time: %.3f ms / Max: %.3f ms\nVertex gen: %u jobs / %.2f MB (%.3f ms)\n\nCulling\n  Frustum: %u / Offscreen: %u (skipped %u)\nBudget (%u particles / %u emitters)\n  Throttled: %u systems / %u emitters\n  Spawns dropped: %u\nWarm-up: %u simulated / %u restored (%.3f ms)\nCollision: %u emitters / %u queries (deferred %u)\n  Hits: %u / Events: %u / Height fields: %u (%.3f ms)\nInstances: %u / %u (stolen %u, completed %u)\n  Suspended: %u / Resumed: %u\nPool: %u hits / %u misses / %u released\n  Kept: %u (%.2f MB) / Discarded: %u",
 		           ParticleStats.TotalEmitters, ParticleStats.TotalParticles,
-		           ParticleStats.SpriteEmitters, ParticleStats.MeshEmitters);
-
-		const float ParticlePanelHeight = 120.0f;
+		           ParticleStats.SpriteEmitters, ParticleStats.MeshEmitters,
+		           SimulationStats.NumThreads,
+		           SimulationStats.SimulatedSystems, SimulationStats.SimulatedEmitters,
+		           SimulationStats.SimulatedParticles,
+		           SimulationStats.WallTimeMS, SimulationStats.GetParallelSpeedup(),
+		           SimulationStats.TotalSystemTimeMS, SimulationStats.MaxSystemTimeMS,
+		           ParticleStats.SortedEmitters, ParticleStats.SortedParticles,
+		           ParticleStats.SortTimeMS, ParticleStats.MaxEmitterSortTimeMS,
+		           ParticleStats.VertexGenerationJobs, static_cast<double>(ParticleStats.VertexGenerationBytes) / (1024.0 * 1024.0),
+		           ParticleStats.VertexGenerationTimeMS,
+		           ParticleStats.FrustumCulledSystems, SimulationStats.OffscreenSystems, SimulationStats.SkippedOffscreenSystems,
+		           SimulationStats.MaxLiveParticles, SimulationStats.MaxActiveEmitters,
+		           SimulationStats.ThrottledSystems, SimulationStats.ThrottledEmitters,
+		           SimulationStats.ThrottledSpawns,
+		           SimulationStats.WarmedUpSystems, SimulationStats.RestoredWarmupSystems, SimulationStats.WarmupTimeMS,
+		           SimulationStats.CollisionEmitters, SimulationStats.CollisionQueries, SimulationStats.DeferredCollisionQueries,
+		           SimulationStats.CollisionHits, SimulationStats.CollisionEvents, SimulationStats.HeightFieldRebuilds,
+		           SimulationStats.CollisionTimeMS,
+		           SimulationStats.ActiveEmitterInstances, SimulationStats.MaxEmitterInstances,
+		           SimulationStats.StolenSystems, SimulationStats.CompletedSystems,
+		           SimulationStats.SuspendedSystems, SimulationStats.ResumedSystems,
+		           SimulationStats.PoolHits, SimulationStats.PoolMisses, SimulationStats.PoolReleased,
+		           SimulationStats.PooledInstances, static_cast<double>(SimulationStats.PooledBytes) / (1024.0 * 1024.0),
+		           SimulationStats.PoolDiscarded);
+
+		const float ParticlePanelHeight = 528.0f;
 		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, ParticlePanelHeight, StatsColors::Cyan);
 		NextY += ParticlePanelHeight + Space;
 	}
 
+	// Occlusion
+	if (bShowOcclusion)
+	{
+		const FOcclusionStats& OcclusionStats = FOcclusionStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Occlusion Stats]\nDepth Buffer: %u x %u\nOccluders: %u / %u (Tris: %u)\nRasterized Tris: %u\n\nOccludees: %u\n  Occluded: %u\n  Offscreen: %u\n  Visible: %u\nCulled: %.1f%%\n\nMode: %s\n  Cached: %u / Retested: %u\n\nSetup: %.3f ms\nRaster+HZB: %.3f ms\nTest: %.3f ms\nTotal: %.3f ms",
+		           OcclusionStats.DepthBufferWidth, OcclusionStats.DepthBufferHeight,
+		           OcclusionStats.OccluderCount, OcclusionStats.OccluderCandidates, OcclusionStats.OccluderTriangles,
+		           OcclusionStats.RasterizedTriangles,
+		           OcclusionStats.TotalOccludees, OcclusionStats.OccludedPrimitives,
+		           OcclusionStats.OffscreenPrimitives, OcclusionStats.VisiblePrimitives,
+		           OcclusionStats.CulledPercentage,
+		           OcclusionStats.bReusedVisibility ? L"Cached" : L"Full",
+		           OcclusionStats.CachedPrimitives, OcclusionStats.RetestedPrimitives,
+		           OcclusionStats.SetupTimeMS, OcclusionStats.RasterTimeMS,
+		           OcclusionStats.TestTimeMS, OcclusionStats.TotalTimeMS);
+
+		const float OcclusionPanelHeight = 385.0f;
+		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, OcclusionPanelHeight, StatsColors::SkyBlue);
+		NextY += OcclusionPanelHeight + Space;
+	}
+
+	// Draw Sort
+	if (bShowDrawSort)
+	{
+		const FDrawSortStats& DrawSortStats = FDrawSortStatManager::GetInstance().GetStats();
+		const FConstantUploadStats& UploadStats = GEngine.GetRHIDevice()->GetConstantUploadStats();
+
+		wchar_t Buf[768];
+		swprintf_s(Buf, L"[Draw Sort / Instancing Stats]\nLists: %u\nDraws: %u\n\nState Changes (unsorted -> sorted)\n  Shader: %u -> %u\n  Material: %u -> %u\n  Buffer: %u -> %u\nSaved: %u (%.1f%%)\n\nSort: %.3f ms\n\nInstancing\n  Merged Draws: %u (Batches: %u)\n  Draw Calls Saved: %u\n\nConstant Uploads (%s)\n  Updates: %u (Skipped: %u)\n  Maps: %u (Discard: %u, Batched: %u)\n  Ring: %u allocs, %llu / %u KB\n  Ring full -> per-type: %u",
+		           DrawSortStats.SortedLists, DrawSortStats.SortedDraws,
+		           DrawSortStats.UnsortedChanges.ShaderChanges, DrawSortStats.SortedChanges.ShaderChanges,
+		           DrawSortStats.UnsortedChanges.MaterialChanges, DrawSortStats.SortedChanges.MaterialChanges,
+		           DrawSortStats.UnsortedChanges.BufferChanges, DrawSortStats.SortedChanges.BufferChanges,
+		           DrawSortStats.SavedStateChanges, DrawSortStats.SavedPercentage,
+		           DrawSortStats.SortTimeMS,
+		           DrawSortStats.InstancedDraws, DrawSortStats.InstancedBatches,
+		           DrawSortStats.DrawCallsSaved,
+		           GEngine.GetRHIDevice()->IsConstantUploadRingEnabled() ? L"Ring" : L"Per-Type",
+		           UploadStats.NumUpdates, UploadStats.NumSkippedUploads,
+		           UploadStats.NumMaps, UploadStats.NumDiscardMaps, UploadStats.NumBatchMaps,
+		           UploadStats.NumRingAllocations, UploadStats.RingBytes / 1024, UploadStats.RingCapacity / 1024,
+		           UploadStats.NumRingFallbacks);
+
+		const float DrawSortPanelHeight = 436.0f;
+		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, DrawSortPanelHeight, StatsColors::Orange);
+		NextY += DrawSortPanelHeight + Space;
+	}
+
+	// Mesh LOD
+	if (bShowMeshLOD)
+	{
+		const FMeshLODStats& LODStats = FMeshLODStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[768];
+		swprintf_s(Buf, L"[Mesh LOD Stats]\nMeshes: %u\n  LOD0: %u (%u tris)\n  LOD1: %u (%u tris)\n  LOD2: %u (%u tris)\n  LOD3: %u (%u tris)\n\nTriangles: %llu / %llu (LOD0)\nSaved: %llu (%.1f%%)\n\nCPU Skinning\n  Meshes: %u\n  Vertices: %llu / %llu (LOD0)\n  Time: %.3f ms",
+		           LODStats.NumMeshes,
+		           LODStats.MeshesPerLOD[0], LODStats.TrianglesPerLOD[0],
+		           LODStats.MeshesPerLOD[1], LODStats.TrianglesPerLOD[1],
+		           LODStats.MeshesPerLOD[2], LODStats.TrianglesPerLOD[2],
+		           LODStats.MeshesPerLOD[3], LODStats.TrianglesPerLOD[3],
+		           LODStats.DrawnTriangles, LODStats.BaseTriangles,
+		           LODStats.SavedTriangles, LODStats.SavedPercentage,
+		           LODStats.SkinnedMeshes, LODStats.SkinnedVertices, LODStats.BaseSkinnedVertices,
+		           LODStats.SkinningTimeMS);
+
+		const float MeshLODPanelHeight = 330.0f;
+		DrawTextPanel(Canvas, Buf, Margin, NextY, PanelWidth, MeshLODPanelHeight, StatsColors::LightGreen);
+		NextY += MeshLODPanelHeight + Space;
+	}
+
 	// PhysicsAsset
 	if (bShowPhysicsAsset)
 	{
@@ -26,6 +26,9 @@ public:
     void SetShowGPU(bool b) { bShowGPU = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
     void SetShowParticles(bool b) { bShowParticles = b; }
+    void SetShowOcclusion(bool b) { bShowOcclusion = b; }
+    void SetShowDrawSort(bool b) { bShowDrawSort = b; }
+    void SetShowMeshLOD(bool b) { bShowMeshLOD = b; }
     void SetShowPhysicsAsset(bool b) { bShowPhysicsAsset = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
@@ -37,6 +40,9 @@ public:
     void ToggleGPU() { bShowGPU = !bShowGPU; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
     void ToggleParticles() { bShowParticles = !bShowParticles; }
+    void ToggleOcclusion() { bShowOcclusion = !bShowOcclusion; }
+    void ToggleDrawSort() { bShowDrawSort = !bShowDrawSort; }
+    void ToggleMeshLOD() { bShowMeshLOD = !bShowMeshLOD; }
     void TogglePhysicsAsset() { bShowPhysicsAsset = !bShowPhysicsAsset; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
@@ -48,6 +54,9 @@ public:
     bool IsGPUVisible() const { return bShowGPU; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticlesVisible() const { return bShowParticles; }
+    bool IsOcclusionVisible() const { return bShowOcclusion; }
+    bool IsDrawSortVisible() const { return bShowDrawSort; }
+    bool IsMeshLODVisible() const { return bShowMeshLOD; }
     bool IsPhysicsAssetVisible() const { return bShowPhysicsAsset; }
 
     void SetGPUTimer(FGPUTimer* InGPUTimer) { GPUTimer = InGPUTimer; }
@@ -80,6 +89,9 @@ private:
     bool bShowGPU = false;
     bool bShowSkinning = false;
     bool bShowParticles = false;
+    bool bShowOcclusion = false;
+    bool bShowDrawSort = false;
+    bool bShowMeshLOD = false;
     bool bShowPhysicsAsset = false;
 
     // PhysicsAsset Stats 데이터
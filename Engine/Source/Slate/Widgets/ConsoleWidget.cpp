@@ -10,6 +10,14 @@
 #include <cstring>
 #include <algorithm>
 #include "MiniDump.h"
+#include "SpatialQueryBenchmark.h"
+#include "MeshDrawSortBenchmark.h"
+#include "RHICommandListBenchmark.h"
+#include "SceneGatherBenchmark.h"
+#include "SkinningLODBenchmark.h"
+#include "ParticleSimulationBenchmark.h"
+#include "ParticleVertexBenchmark.h"
+#include "ConstantUploadRingBenchmark.h"
 
 using std::max;
 using std::min;
@@ -53,6 +61,9 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
 	HelpCommandList.Add("STAT GPU");
+	HelpCommandList.Add("STAT LOD");
+	HelpCommandList.Add("LOD");
+	HelpCommandList.Add("BENCH");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -543,6 +554,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT GPU");
+		AddLog("- STAT OCCLUSION");
+		AddLog("- STAT DRAWSORT");
+		AddLog("- STAT LOD");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -591,6 +605,21 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleParticles();
 		AddLog("STAT PARTICLES TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT OCCLUSION") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleOcclusion();
+		AddLog("STAT OCCLUSION TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT DRAWSORT") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleDrawSort();
+		AddLog("STAT DRAWSORT TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT LOD") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleMeshLOD();
+		AddLog("STAT LOD TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -603,6 +632,9 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowGPU(true);
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
 		UStatsOverlayD2D::Get().SetShowParticles(true);
+		UStatsOverlayD2D::Get().SetShowOcclusion(true);
+		UStatsOverlayD2D::Get().SetShowDrawSort(true);
+		UStatsOverlayD2D::Get().SetShowMeshLOD(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
@@ -617,8 +649,68 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowGPU(false);
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
 		UStatsOverlayD2D::Get().SetShowParticles(false);
+		UStatsOverlayD2D::Get().SetShowOcclusion(false);
+		UStatsOverlayD2D::Get().SetShowDrawSort(false);
+		UStatsOverlayD2D::Get().SetShowMeshLOD(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "BENCH") == 0)
+	{
+		AddLog("BENCH commands:");
+		AddLog("- BENCH RAYBATCH");
+		AddLog("- BENCH SHAPEQUERY");
+		AddLog("- BENCH DRAWSORT");
+		AddLog("- BENCH RHICMD");
+		AddLog("- BENCH RHICMD SCENE");
+		AddLog("- BENCH SCENEGATHER");
+		AddLog("- BENCH SKINLOD");
+		AddLog("- BENCH PARTICLESIM");
+		AddLog("- BENCH PARTICLEVERTEX");
+		AddLog("- BENCH UPLOADRING");
+	}
+	else if (Stricmp(command_line, "BENCH RAYBATCH") == 0)
+	{
+		FSpatialQueryBenchmark::RunRayBatch(GWorld, 4096);
+	}
+	else if (Stricmp(command_line, "BENCH SHAPEQUERY") == 0)
+	{
+		FSpatialQueryBenchmark::RunShapeQueries(GWorld, 3072);
+	}
+	else if (Stricmp(command_line, "BENCH DRAWSORT") == 0)
+	{
+		FMeshDrawSortBenchmark::Run(50000);
+	}
+	else if (Stricmp(command_line, "BENCH RHICMD") == 0)
+	{
+		FRHICommandListBenchmark::Run(50000);
+	}
+	else if (Stricmp(command_line, "BENCH RHICMD SCENE") == 0)
+	{
+		FRHICommandListBenchmark::RequestScenePass();
+		AddLog("RHICMD SCENE: measuring the next opaque pass");
+	}
+	else if (Stricmp(command_line, "BENCH SCENEGATHER") == 0)
+	{
+		FSceneGatherBenchmark::Run(GWorld, 200);
+	}
+	else if (Stricmp(command_line, "BENCH SKINLOD") == 0)
+	{
+		FSkinningLODBenchmark::Run(512);
+	}
+	else if (Stricmp(command_line, "BENCH PARTICLESIM") == 0)
+	{
+		FParticleSimulationBenchmark::Run(10000, 120);
+		FParticleSimulationBenchmark::Run(100000, 120);
+	}
+	else if (Stricmp(command_line, "BENCH PARTICLEVERTEX") == 0)
+	{
+		FParticleVertexBenchmark::Run(200000, 1, 30);
+		FParticleVertexBenchmark::Run(200000, 100, 30);
+	}
+	else if (Stricmp(command_line, "BENCH UPLOADRING") == 0)
+	{
+		FConstantUploadRingBenchmark::Run(1000, 1000);
+	}
 	else if (Stricmp(command_line, "SKINNING") == 0)
 	{
 		AddLog("SKINNING CPU");
@@ -632,6 +724,22 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 	{
 		GWorld->GetRenderSettings().SetSkinningMode(ESkinningMode::CPU);
 	}
+	else if (Stricmp(command_line, "LOD") == 0)
+	{
+		AddLog("LOD AUTO");
+		AddLog("LOD <0-3>");
+	}
+	else if (Stricmp(command_line, "LOD AUTO") == 0)
+	{
+		GWorld->GetRenderSettings().SetForcedLOD(-1);
+		AddLog("LOD: AUTO");
+	}
+	else if (Strnicmp(command_line, "LOD ", 4) == 0 && isdigit(static_cast<unsigned char>(command_line[4])))
+	{
+		const int32 ForcedLOD = std::min(atoi(command_line + 4), MaxMeshLODCount - 1);
+		GWorld->GetRenderSettings().SetForcedLOD(ForcedLOD);
+		AddLog("LOD: FORCED %d", ForcedLOD);
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
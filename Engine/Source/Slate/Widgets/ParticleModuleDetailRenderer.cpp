@@ -20,6 +20,7 @@
 #include "Source/Runtime/Engine/Particle/Rotation/ParticleModuleMeshRotation.h"
 #include "Source/Runtime/Engine/Particle/Rotation/ParticleModuleMeshRotationRate.h"
 #include "Source/Runtime/Engine/Particle/SubUV/ParticleModuleSubUV.h"
+#include "Source/Runtime/Engine/Particle/Collision/ParticleModuleCollision.h"
 #include "Source/Runtime/Engine/Particle/ParticleEmitter.h"
 #include "Source/Runtime/Engine/Particle/ParticleTypes.h"
 #include "Source/Runtime/Renderer/Material.h"
@@ -353,6 +354,56 @@ bool UParticleModuleDetailRenderer::RenderSubUVInterpMethodCombo(const char* Lab
 	return false;
 }
 
+bool UParticleModuleDetailRenderer::RenderCollisionResponseCombo(const char* Label, EParticleCollisionResponse& Value)
+{
+	const char* Items[] = {
+		"Bounce",
+		"Stick",
+		"Kill"
+	};
+
+	int CurrentItem = static_cast<int>(Value);
+	if (ImGui::Combo(Label, &CurrentItem, Items, IM_ARRAYSIZE(Items)))
+	{
+		Value = static_cast<EParticleCollisionResponse>(CurrentItem);
+		return true;
+	}
+	return false;
+}
+
+bool UParticleModuleDetailRenderer::RenderCollisionCompleteCombo(const char* Label, EParticleCollisionComplete& Value)
+{
+	const char* Items[] = {
+		"Kill",
+		"Freeze",
+		"Halt Collisions"
+	};
+
+	int CurrentItem = static_cast<int>(Value);
+	if (ImGui::Combo(Label, &CurrentItem, Items, IM_ARRAYSIZE(Items)))
+	{
+		Value = static_cast<EParticleCollisionComplete>(CurrentItem);
+		return true;
+	}
+	return false;
+}
+
+bool UParticleModuleDetailRenderer::RenderCollisionModeCombo(const char* Label, EParticleCollisionMode& Value)
+{
+	const char* Items[] = {
+		"Scene BVH",
+		"Height Field"
+	};
+
+	int CurrentItem = static_cast<int>(Value);
+	if (ImGui::Combo(Label, &CurrentItem, Items, IM_ARRAYSIZE(Items)))
+	{
+		Value = static_cast<EParticleCollisionMode>(CurrentItem);
+		return true;
+	}
+	return false;
+}
+
 // ============================================================================
 // 메인 렌더링 함수
 // ============================================================================
@@ -441,6 +492,10 @@ void UParticleModuleDetailRenderer::RenderModuleDetails(UParticleModule* Module)
 	{
 		RenderSubUVModule(SubUV);
 	}
+	else if (UParticleModuleCollision* Collision = Cast<UParticleModuleCollision>(Module))
+	{
+		RenderCollisionModule(Collision);
+	}
 	else
 	{
 		// 기본 모듈 정보
@@ -662,6 +717,20 @@ void UParticleModuleDetailRenderer::RenderRequiredModule(UParticleModuleRequired
 			ImGui::SetTooltip("Emitter 지속 시간 완료 시 모든 활성 파티클 제거\n"
 				"기본값: false");
 		}
+
+		// Use SoA Layout
+		bool bUseSoALayout = Module->IsUseSoALayout();
+		if (ImGui::Checkbox("Use SoA Layout", &bUseSoALayout))
+		{
+			Module->SetUseSoALayout(bUseSoALayout);
+		}
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("파티클을 필드별 스트림(SoA)으로 저장하고 SIMD로 수명/이동/회전 업데이트\n"
+				"파티클 수가 많은 Emitter에서 Tick 비용 감소\n"
+				"Emitter 재초기화 시 적용\n"
+				"기본값: false");
+		}
 	}
 
 	// Duration 섹션
@@ -1238,7 +1307,8 @@ void UParticleModuleDetailRenderer::RenderTypeDataMeshModule(UParticleModuleType
 		if (ImGui::IsItemHovered())
 		{
 			ImGui::SetTooltip("Mesh 파티클의 충돌 감지 활성화\n"
-				"기본값: false (TBD - Mesh 파티클 충돌 미구현)");
+				"Collision 모듈이 없으면 기본 설정(Bounce, Scene BVH)으로 충돌\n"
+				"기본값: false");
 		}
 	}
 }
@@ -1615,3 +1685,154 @@ void UParticleModuleDetailRenderer::RenderSubUVModule(UParticleModuleSubUV* Modu
 		}
 	}
 }
+
+// ============================================================================
+// Collision 모듈 렌더링
+// ============================================================================
+
+void UParticleModuleDetailRenderer::RenderCollisionModule(UParticleModuleCollision* Module)
+{
+	if (!Module)
+	{
+		return;
+	}
+
+	FParticleCollisionSettings& Settings = Module->Settings;
+
+	if (BeginSection("Collision", true))
+	{
+		RenderCollisionModeCombo("Mode", Settings.Mode);
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("충돌 대상\n"
+				"Scene BVH: 파티클 이동 구간을 씬 BVH에 레이로 검사 (벽/천장 포함)\n"
+				"Height Field: 에미터 주변 지면 높이를 격자로 샘플링해 두고 높이만 비교 (비/불꽃 같은 대량 파티클용)\n"
+				"기본값: Scene BVH");
+		}
+
+		RenderCollisionResponseCombo("Response", Settings.Response);
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("충돌 시 반응\n"
+				"Bounce: 법선 방향으로 튕김\n"
+				"Stick: 충돌 지점에 고정\n"
+				"Kill: 파티클 제거\n"
+				"기본값: Bounce");
+		}
+
+		if (Settings.Response == EParticleCollisionResponse::Bounce)
+		{
+			ImGui::DragFloat("Restitution", &Settings.Restitution, 0.01f, 0.0f, 1.0f);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("법선 방향 속도 유지 비율\n"
+					"0: 튕기지 않음, 1: 완전 탄성\n"
+					"기본값: 0.5");
+			}
+
+			ImGui::DragFloat("Friction", &Settings.Friction, 0.01f, 0.0f, 1.0f);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("접선 방향 속도 감쇠 비율\n"
+					"0: 미끄러짐, 1: 접선 속도 제거\n"
+					"기본값: 0.2");
+			}
+		}
+
+		ImGui::DragFloat("Radius Scale", &Settings.RadiusScale, 0.01f, 0.0f, 10.0f);
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("파티클 크기 대비 충돌 반지름\n"
+				"표면에서 이 반지름만큼 떨어진 곳에서 충돌\n"
+				"기본값: 0.5");
+		}
+
+		ImGui::DragInt("Max Collisions", &Settings.MaxCollisions, 0.1f, 0, 100);
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("파티클 하나가 충돌할 수 있는 횟수\n"
+				"0: 제한 없음\n"
+				"기본값: 0");
+		}
+
+		if (Settings.MaxCollisions > 0)
+		{
+			RenderCollisionCompleteCombo("Collision Completion", Settings.CollisionCompletion);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("Max Collisions에 도달했을 때\n"
+					"Kill: 파티클 제거\n"
+					"Freeze: 그 자리에 고정\n"
+					"Halt Collisions: 이후 충돌 무시\n"
+					"기본값: Kill");
+			}
+		}
+	}
+
+	if (BeginSection("Performance", false))
+	{
+		if (Settings.Mode == EParticleCollisionMode::SceneBVH)
+		{
+			ImGui::DragInt("Max Queries Per Frame", &Settings.MaxQueriesPerFrame, 1.0f, 0, 100000);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("에미터당 프레임 레이 쿼리 상한\n"
+					"넘는 파티클은 다음 프레임에 밀린 이동 구간 전체를 검사\n"
+					"0: 제한 없음\n"
+					"기본값: 512");
+			}
+		}
+		else
+		{
+			ImGui::DragInt("Resolution", &Settings.HeightFieldResolution, 0.1f, 2, 256);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("높이장 격자 한 변의 점 개수 (Resolution x Resolution 레이)\n"
+					"기본값: 32");
+			}
+
+			ImGui::DragFloat("Cell Size", &Settings.HeightFieldCellSize, 1.0f, 1.0f, 10000.0f);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("격자 간격\n"
+					"기본값: 100.0");
+			}
+
+			ImGui::DragFloat("Trace Height", &Settings.HeightFieldTraceHeight, 1.0f, 1.0f, 100000.0f);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("에미터 높이 기준 위/아래로 지면을 찾을 범위\n"
+					"기본값: 2000.0");
+			}
+
+			ImGui::DragFloat("Refresh Interval", &Settings.HeightFieldRefreshInterval, 0.05f, 0.0f, 60.0f);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("높이장을 다시 샘플링할 주기 (초)\n"
+					"0: 에미터가 격자 한 칸 이상 움직였을 때만\n"
+					"기본값: 0.0");
+			}
+		}
+	}
+
+	if (BeginSection("Events", false))
+	{
+		ImGui::Checkbox("Generate Events", &Settings.bGenerateEvents);
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("충돌 이벤트 발행\n"
+				"같은 액터의 Lua 스크립트 OnParticleCollision(Other, Location, Normal, Velocity, EmitterIndex)로 전달\n"
+				"기본값: false");
+		}
+
+		if (Settings.bGenerateEvents)
+		{
+			ImGui::DragInt("Max Events Per Frame", &Settings.MaxEventsPerFrame, 0.1f, 1, 1000);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("에미터당 프레임 이벤트 상한\n"
+					"기본값: 16");
+			}
+		}
+	}
+}
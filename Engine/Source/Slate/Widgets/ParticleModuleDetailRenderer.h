@@ -18,6 +18,7 @@ class UParticleModuleRotationRate;
 class UParticleModuleMeshRotation;
 class UParticleModuleMeshRotationRate;
 class UParticleModuleSubUV;
+class UParticleModuleCollision;
 class UParticleEmitter;
 
 /**
@@ -56,6 +57,7 @@ private:
 	static void RenderMeshRotationModule(UParticleModuleMeshRotation* Module);
 	static void RenderMeshRotationRateModule(UParticleModuleMeshRotationRate* Module);
 	static void RenderSubUVModule(UParticleModuleSubUV* Module);
+	static void RenderCollisionModule(UParticleModuleCollision* Module);
 
 	// Distribution 타입 UI 헬퍼
 	static bool RenderFloatDistribution(const char* Label, struct FFloatDistribution& Dist);
@@ -68,6 +70,9 @@ private:
 	static bool RenderBlendModeCombo(const char* Label, enum class EParticleBlendMode& Value);
 	static bool RenderBurstMethodCombo(const char* Label, enum class EParticleBurstMethod& Value);
 	static bool RenderSubUVInterpMethodCombo(const char* Label, enum class EParticleSubUVInterpMethod& Value);
+	static bool RenderCollisionResponseCombo(const char* Label, enum class EParticleCollisionResponse& Value);
+	static bool RenderCollisionCompleteCombo(const char* Label, enum class EParticleCollisionComplete& Value);
+	static bool RenderCollisionModeCombo(const char* Label, enum class EParticleCollisionMode& Value);
 
 	// 섹션 헬퍼
 	static bool BeginSection(const char* Label, bool bDefaultOpen = true);
@@ -1047,6 +1047,18 @@ void SViewportToolbarWidget::RenderShowFlagDropdownMenu(const FViewportClient* V
 				StatsOverlay.ToggleParticles();
 			}
 
+			bool bShowOcclusion = StatsOverlay.IsOcclusionVisible();
+			if (ImGui::Checkbox("OCCLUSION", &bShowOcclusion))
+			{
+				StatsOverlay.ToggleOcclusion();
+			}
+
+			bool bShowDrawSort = StatsOverlay.IsDrawSortVisible();
+			if (ImGui::Checkbox("DRAW SORT", &bShowDrawSort))
+			{
+				StatsOverlay.ToggleDrawSort();
+			}
+
 			bool bShowPhysicsAsset = StatsOverlay.IsPhysicsAssetVisible();
 			if (ImGui::Checkbox("PHYSICS ASSET", &bShowPhysicsAsset))
 			{
@@ -1527,6 +1539,13 @@ void SViewportToolbarWidget::RenderShowFlagDropdownMenu(const FViewportClient* V
 			ImGui::EndMenu();
 		}
 
+		// CPU 오클루전 컬링 (저폴리 오클루더 소프트웨어 래스터화)
+		bool bOcclusionCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Culling);
+		if (ImGui::Checkbox("오클루전 컬링", &bOcclusionCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_Culling);
+		}
+
 		// GPU Skinning
 		if (IconSkinning && IconSkinning->GetShaderResourceView())
 		{
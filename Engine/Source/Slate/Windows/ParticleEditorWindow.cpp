@@ -40,6 +40,7 @@
 #include "Source/Runtime/Engine/Particle/Rotation/ParticleModuleMeshRotation.h"
 #include "Source/Runtime/Engine/Particle/Rotation/ParticleModuleMeshRotationRate.h"
 #include "Source/Runtime/Engine/Particle/SubUV/ParticleModuleSubUV.h"
+#include "Source/Runtime/Engine/Particle/Collision/ParticleModuleCollision.h"
 #include "Source/Slate/Widgets/ParticleModuleDetailRenderer.h"
 #include "Source/Slate/Widgets/PropertyRenderer.h"
 
@@ -2556,7 +2557,11 @@ void SParticleEmittersPanel::RenderModuleContextMenu(UParticleEmitter* Emitter,
 	// Collision 서브메뉴
 	if (ImGui::BeginMenu("Collision"))
 	{
-		ImGui::MenuItem("Collision", nullptr, false, false); // TODO
+		if (ImGui::MenuItem("Collision"))
+		{
+			UParticleModuleCollision* Module = new UParticleModuleCollision();
+			AddModuleAndUpdateInstances(LODLevel, Module);
+		}
 		ImGui::EndMenu();
 	}
 